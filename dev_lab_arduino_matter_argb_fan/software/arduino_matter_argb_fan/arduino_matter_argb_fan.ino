@@ -69,10 +69,29 @@ MatterFan matter_fan;
 #define ANALOG_WRITE_FAN_MIN 160
 #define ANALOG_WRITE_MIN 0
 
+// FAN INCLUDES
+
+#include "fan_tacho.h"  // Tacho edge timestamps using TIMER capture
+#include "tacho.h"      // RPM from tacho edge timestamps
+#include "fan_control.h"  // PID speed control and duty to RPM curve
+#include "nvm3_default.h"  // NVM for the calibrated curve
+
 // FAN DEFINES
 
 #define PIN_FAN_CONTROL D7  // Noctua=Blue
 #define PIN_FAN_TACHO D6    // Noctua=Green
+#define FAN_RPM_MIN 100     // Slowest RPM measured, slower is a stall
+#define FAN_RPM_MAX 10000   // Fastest RPM measured, shorter tacho periods are noise
+#define FAN_RPM_FILTER 2    // RPM filter, each tacho edge moves the filtered RPM 1/4 of the way
+#define FAN_RPM_CHANGE 10   // Change in filtered RPM that raises an RPM event
+#define FAN_PID_PERIOD 100  // Speed control period (ms)
+#define FAN_PID_KP 13107    // Proportional gain, 0.2 duty per RPM (16 fraction bits)
+#define FAN_PID_KI 3277     // Integral gain, 0.05 duty per RPM each period (16 fraction bits)
+#define FAN_PID_KD 0        // Derivative gain, not needed as the PID follows a model of the fan
+#define FAN_PID_SLEW 100    // Largest duty change each period
+#define FAN_CALIBRATE false          // Calibrate at every start up, not only when no curve is stored
+#define FAN_CALIBRATE_SAMPLES 50     // Most RPM samples at each calibration step, FAN_PID_PERIOD apart
+#define FAN_CURVE_KEY 0x0FA00        // NVM3 key for the calibrated curve, clear of the Matter and Thread keys
 #define FAN_MODES 7
 #define FAN_MODE_OFF 0
 #define FAN_MODE_LOW 1
@@ -84,14 +103,21 @@ MatterFan matter_fan;
 
 // FAN GLOBAL VARIABLES
 
-uint32_t fanTachoCounter = 0;
+volatile uint32_t fanTachoCounter = 0;
 PinStatus fanTachoInterrupt = RISING;  // CHANGE, RISING, FALLING
 uint32_t fanTachoCounterPerRev = 2;    // 4 for CHANGE, 2 for RISING and FALLING
-uint32_t fanRpmTachoCount = 0;
+tacho_t fanTacho;                      // RPM measurement, updated by the capture interrupt
+volatile bool fanRpmEvent = false;     // RPM changed or stalled, set by the capture interrupt and fanLoop()
 uint32_t fanRpmMillis;
-uint32_t fanRpmPeriod = 3000;
-uint32_t fanRpmMultiplier = 60000 / fanRpmPeriod;  // For calculating RPM
-uint32_t fanRpm;
+uint32_t fanRpmPeriod = 250;  // Shortest time between RPM updates, limits OLED updates
+uint32_t fanRpm;              // Filtered RPM shown
+uint32_t fanRpmInstant;       // RPM over the last revolution
+fan_curve_t fanCurve;         // Calibrated duty to RPM curve
+bool fanCurveValid = false;   // Curve is usable, otherwise percents map straight to duties
+fan_pid_t fanPid;             // Speed controller
+uint32_t fanRpmTarget = 0;    // Target RPM, 0 when not controlling speed
+uint32_t fanPidMillis;
+uint16_t fanDuty = ANALOG_WRITE_MIN;  // PWM duty written
 char fanModeStrings[FAN_MODES + 1][8] = { "Off", "Low", "Med", "High", "On", "Auto", "Smart", "Unknown" };
 uint8_t fanModePercents[] = { 0xFF, 0, 50, 100, 0xFF, 75, 25 };
 uint8_t fanMode = FAN_MODE_OFF;
@@ -128,7 +154,7 @@ uint8_t colorBlueLevel = 0;
 
 // ARGB INCLUDES
 
-#include <ezWS2812.h>
+#include "argb_frames.h"  // Encoded ARGB frames sent by LDMA
 
 // ARGB DEFINES
 
@@ -136,6 +162,8 @@ uint8_t colorBlueLevel = 0;
 #define ARGB_INNER_MAX 12
 #define ARGB_OUTER_MAX 20
 #define ARGB_MAX ARGB_INNER_MAX + ARGB_OUTER_MAX
+static_assert(ARGB_MAX <= ARGB_FRAMES_PIXEL_MAX, "Raise ARGB_FRAMES_PIXEL_MAX to fit the inner and outer LEDs in a frame");
+static_assert(ARGB_OUTER_MAX <= ARGB_FRAMES_MAX && ARGB_INNER_MAX <= ARGB_FRAMES_MAX, "Raise ARGB_FRAMES_MAX to fit a frame for each step of the animation");
 
 #define ARGB_CONFIG_ARCTIC_P12 0          // Inner = 12, Outer = 0
 #define ARGB_CONFIG_COOLERMASTER_HALO2 1  // Inner = 8, Outer = 16
@@ -151,17 +179,21 @@ uint8_t argbInnerFadeForward[ARGB_INNER_MAX];
 uint8_t argbOuterFadeForward[ARGB_OUTER_MAX];
 uint8_t argbInnerFadeReverse[ARGB_INNER_MAX];
 uint8_t argbOuterFadeReverse[ARGB_OUTER_MAX];
-uint8_t argbRed[ARGB_MAX];
-uint8_t argbGreen[ARGB_MAX];
-uint8_t argbBlue[ARGB_MAX];
 uint8_t argbInnerCount = 0;
 uint8_t argbOuterCount = 0;
 uint8_t argbCount = 0;
-uint8_t argbInnerIndex = 0;
-uint8_t argbOuterIndex = 0;
-uint32_t argbTachoCount = 0;
+uint8_t argbSteps = 0;               // Steps, one frame each, in a loop of the animation
+volatile uint8_t argbPhase = 0;      // Step shown
+volatile bool argbRunning = false;   // Tacho interrupt is stepping the frames
+volatile uint32_t argbTachoCount = 0;  // Tacho edges since the last step
 uint32_t argbTachoPerStep;
-ezWS2812 argb(ARGB_MAX);
+volatile uint32_t argbStepCount = 0;   // Steps sent
+volatile uint32_t argbMissCount = 0;   // Steps missed, the previous frame was still being sent
+bool argbBuilt = false;              // Frames are built for the direction and colors below
+bool argbBuiltReverse;
+uint8_t argbBuiltRed;
+uint8_t argbBuiltGreen;
+uint8_t argbBuiltBlue;
 
 // RGB LED DEFINES
 
@@ -186,6 +218,7 @@ uint32_t rgbTachoPerStep;
 #include <Fonts/FreeSansBold12pt7b.h>
 #include <Fonts/FreeSans12pt7b.h>
 #include "qrcode.h"
+#include "oled_pages.h"  // Sends only changed parts of the display
 
 // OLED DEFINES
 
@@ -193,15 +226,23 @@ uint32_t rgbTachoPerStep;
 #define PIN_OLED_SCL A5
 #define OLED_WIDTH 128
 #define OLED_HEIGHT 128
+#define OLED_ADDRESS 0x3D
+#define OLED_TITLE_PAGES 6  // Pages covering the title, rows 0-47
+#define OLED_QRCODE_PAYLOAD_KEY 0x0FA01  // NVM3 key for the payload of the stored QR code
+#define OLED_QRCODE_KEY 0x0FA02          // NVM3 key for the stored QR code, the display buffer as drawn, 1 bit per pixel in page order
+#define OLED_QRCODE_PAYLOAD_MAX 30       // Longest onboarding payload, including the terminator
 
 // OLED GLOBAL VARIABLES
 
 bool oledEnabled = false;
 Adafruit_SH1107 oled = Adafruit_SH1107(OLED_WIDTH, OLED_HEIGHT, &Wire, -1, 1000000, 100000);
+uint8_t oledTitle[OLED_TITLE_PAGES * OLED_WIDTH];  // Title as drawn, copied into the buffer rather than drawn again
+int16_t oledTitleBottom = -1;                       // Text top below the title, -1 until the title is cached
 
 // TIMER GLOBAL VARIABLES
 
 uint32_t nowMillis;
+uint32_t loopMicrosMax = 0;  // Longest loop pass since last printed
 
 // ARDUINO FUNCTIONS
 
@@ -224,32 +265,34 @@ void setup() {
   oledWriteText();
 #endif
   nowMillis = fanRpmMillis = millis();
-  fanRpmTachoCount = argbTachoCount = rgbTachoCount = fanTachoCounter;
-  attachInterrupt(digitalPinToInterrupt(PIN_FAN_TACHO), fanTachoIsr, fanTachoInterrupt);
+  rgbTachoCount = fanTachoCounter;
+  fanTachoSetup();
+  fanCalibrate();
+  nowMillis = fanPidMillis = millis();
 }
 
 void loop() {
   bool oledUpdate = false;
+  uint32_t startMicros = micros();
   nowMillis = millis();
-  argbLoop(false, 1);
+  argbLoop();
   rgbLoop();
   if (buttonLoop()) oledUpdate = true;
-  argbLoop(false, 1);
   rgbLoop();
 #if MATTER_ENABLED
   if (matterLoopMode()) oledUpdate = true;
-  argbLoop(false, 1);
   rgbLoop();
   if (matterLoopOnOffPercent()) oledUpdate = true;
-  argbLoop(false, 1);
   rgbLoop();
 #endif
   if (fanLoop()) oledUpdate = true;
-  argbLoop(false, 1);
   rgbLoop();
   if (oledUpdate) oledWriteText();
-  argbLoop(false, 1);
   rgbLoop();
+  oledLoop();
+  // Track longest pass
+  startMicros = micros() - startMicros;
+  if (startMicros > loopMicrosMax) loopMicrosMax = startMicros;
 }
 
 // MATTER FUNCTIONS
@@ -268,6 +311,7 @@ void matterSetup() {
   if (buttonState == PIN_BUTTON_DOWN /*&& Matter.isDeviceCommissioned()*/) {
     matterState = MATTER_STATE_LEAVE;
     oledWriteText();
+    oled_pages_flush();
     Serial.println("Decommission button pressed, release to continue...");
     decommission = true;
     if (argbOuterCount > 0) delayMs = (2000 / argbOuterCount);
@@ -275,11 +319,7 @@ void matterSetup() {
     else delayMs = 200;
     while (buttonState == PIN_BUTTON_DOWN) {
       buttonState = digitalRead(PIN_BUTTON);
-#if ARGB_FADE
-      argbStepFade(true, -1);
-#else
-      argbStepSingle(true);
-#endif
+      argbStep(true, -1);
       rgbToggle();
       delay(delayMs);
     }
@@ -293,6 +333,7 @@ void matterSetup() {
   if (!Matter.isDeviceCommissioned()) {
     matterState = MATTER_STATE_COMMISSION;
     oledWriteQRCode();
+    oled_pages_flush();
     Serial.println("Matter device is not commissioned");
     Serial.println("Commission it to your Matter hub with the manual pairing code or QR code");
     Serial.printf("Manual pairing code: %s\n", Matter.getManualPairingCode().c_str());
@@ -302,11 +343,7 @@ void matterSetup() {
     else delayMs = 150;
     Serial.println("Waiting for Matter commissioning...");
     while (!Matter.isDeviceCommissioned()) {
-#if ARGB_FADE
-      argbStepFade(true, -1);
-#else
-      argbStepSingle(true);
-#endif
+      argbStep(true, -1);
       rgbToggle();
       delay(delayMs);
     }
@@ -317,16 +354,13 @@ void matterSetup() {
   if (!Matter.isDeviceThreadConnected()) {
     matterState = MATTER_STATE_CONNECT;
     oledWriteText();
+    oled_pages_flush();
     Serial.println("Connecting to Thread network...");
     if (argbOuterCount > 0) delayMs = (1000 / argbOuterCount);
     else if (argbInnerCount > 0) delayMs = (1000 / argbInnerCount);
     else delayMs = 100;
     while (!Matter.isDeviceThreadConnected()) {
-#if ARGB_FADE
-      argbStepFade(true, -1);
-#else
-      argbStepSingle(true);
-#endif
+      argbStep(true, -1);
       rgbToggle();
       delay(delayMs);
     }
@@ -337,16 +371,13 @@ void matterSetup() {
   if (!matter_fan.is_online()) {
     matterState = MATTER_STATE_DISCOVER;
     oledWriteText();
+    oled_pages_flush();
     Serial.println("Waiting for Matter device discovery...");
     if (argbOuterCount > 0) delayMs = (500 / argbOuterCount);
     else if (argbInnerCount > 0) delayMs = (500 / argbInnerCount);
     else delayMs = 50;
     while (!matter_fan.is_online()) {
-#if ARGB_FADE
-      argbStepFade(true, -1);
-#else
-      argbStepSingle(true);
-#endif
+      argbStep(true, -1);
       rgbToggle();
       delay(delayMs);
     }
@@ -355,13 +386,10 @@ void matterSetup() {
   if (matter_fan.is_online()) {
     matterState = MATTER_STATE_ONLINE;
     oledWriteText();
+    oled_pages_flush();
     Serial.println("Matter device is now discovered");
     colorSet(false, true, false);
-#if ARGB_FADE
-    argbStepFade(false, -1);
-#else
-    argbStepSingle(true);
-#endif
+    argbStep(false, -1);
     rgbOn();
   }
 }
@@ -424,36 +452,167 @@ void fanSetup() {
   pinMode(PIN_FAN_TACHO, INPUT_PULLUP);
 }
 
+void fanTachoSetup() {
+  uint32_t ticksPerSecond;
+
+  // Timestamp tacho edges in hardware, RPM is calculated as each edge arrives
+  noInterrupts();
+  tacho_init(&fanTacho, FAN_TACHO_FREQ, fanTachoCounterPerRev, FAN_RPM_FILTER, FAN_RPM_MIN, FAN_RPM_MAX);
+  interrupts();
+  ticksPerSecond = fan_tacho_begin(PIN_FAN_TACHO, fanTachoInterrupt, fanTachoIsr);
+  // Clock not as requested ? Start again with the actual clock
+  if (ticksPerSecond != FAN_TACHO_FREQ) {
+    noInterrupts();
+    tacho_init(&fanTacho, ticksPerSecond, fanTachoCounterPerRev, FAN_RPM_FILTER, FAN_RPM_MIN, FAN_RPM_MAX);
+    interrupts();
+  }
+  Serial.print("fanTachoSetup() = ");
+  Serial.println(ticksPerSecond);
+}
+
+bool fanCalibrate() {
+  uint16_t samples[FAN_CALIBRATE_SAMPLES];
+  uint32_t rpm;
+  uint32_t rpmFrom = 0;
+  uint32_t tauSum = 0;
+  uint8_t tauCount = 0;
+  uint8_t s, t;
+
+#if !MATTER_ENABLED
+  nvm3_initDefault();
+#endif
+  // Stored curve ? Also stored when the fan did not turn, so open loop control starts without calibrating again
+  if (!FAN_CALIBRATE
+      && nvm3_readData(nvm3_defaultHandle, FAN_CURVE_KEY, &fanCurve, sizeof(fanCurve)) == ECODE_NVM3_OK
+      && fan_curve_calibrated(&fanCurve)) {
+    Serial.println("fanCalibrate() = stored");
+  } else {
+    Serial.println("fanCalibrate()");
+    for (uint8_t i = 0; i < FAN_CURVE_POINTS; i++) {
+      // Step duty up the range
+      fanCurve.duties[i] = map(i, 0, FAN_CURVE_POINTS - 1, ANALOG_WRITE_FAN_MIN, ANALOG_WRITE_FAN_MAX);
+      digitalWrite(PIN_FAN_CONTROL, LOW);
+      analogWrite(PIN_FAN_CONTROL, fanCurve.duties[i]);
+      // Sample RPM until it has not changed by 1% for a second
+      for (s = 0; s < FAN_CALIBRATE_SAMPLES;) {
+        delay(FAN_PID_PERIOD);
+        noInterrupts();
+        tacho_check(&fanTacho, fan_tacho_ticks());
+        samples[s++] = tacho_rpm(&fanTacho);
+        interrupts();
+        if (s > 10 && abs(samples[s - 1] - samples[s - 11]) <= samples[s - 1] / 100) break;
+      }
+      rpm = samples[s - 1];
+      fanCurve.rpms[i] = rpm;
+      // Time to reach 63% of the change, the first step is left out as it starts the fan
+      if (i > 0 && rpm > rpmFrom) {
+        for (t = 0; t < s && samples[t] < rpmFrom + ((rpm - rpmFrom) * 63) / 100; t++) {
+        }
+        tauSum += (t + 1) * FAN_PID_PERIOD;
+        tauCount++;
+      }
+      rpmFrom = rpm;
+      Serial.print("  fanCurve = ");
+      Serial.print(fanCurve.duties[i]);
+      Serial.print(", ");
+      Serial.println(fanCurve.rpms[i]);
+    }
+    fanCurve.tau = (tauCount > 0) ? tauSum / tauCount : 0;
+    fanCurve.magic = FAN_CURVE_MAGIC;
+    // Stop fan
+    analogWrite(PIN_FAN_CONTROL, ANALOG_WRITE_MIN);
+    digitalWrite(PIN_FAN_CONTROL, LOW);
+    fanDuty = ANALOG_WRITE_MIN;
+    // Store curve for next time, set FAN_CALIBRATE to calibrate again
+    nvm3_writeData(nvm3_defaultHandle, FAN_CURVE_KEY, &fanCurve, sizeof(fanCurve));
+  }
+  // Closed loop control if the fan turned and sped up along the curve
+  fanCurveValid = fan_curve_valid(&fanCurve);
+  fan_pid_init(&fanPid, FAN_PID_KP, FAN_PID_KI, FAN_PID_KD, ANALOG_WRITE_FAN_MIN, ANALOG_WRITE_FAN_MAX, FAN_PID_SLEW, FAN_PID_PERIOD, fanCurve.tau);
+  Serial.print("  fanCurve.tau = ");
+  Serial.println(fanCurve.tau);
+  Serial.print("  fanCurveValid = ");
+  Serial.println(fanCurveValid);
+
+  return fanCurveValid;
+}
+
 bool fanLoop() {
   bool result = false;
-  uint32_t tacho;
-  uint32_t tachoCount;
+  bool event;
+  uint32_t rpm;
+
+  // Speed control timer fired ?
+  if (fanRpmTarget > 0 && nowMillis - fanPidMillis >= FAN_PID_PERIOD) {
+    // Restart timer
+    fanPidMillis = nowMillis;
+    // Trim duty expected from the curve to reach the target RPM
+    noInterrupts();
+    rpm = tacho_rpm(&fanTacho);
+    interrupts();
+    fanDuty = fan_pid_update(&fanPid, fanRpmTarget, rpm, fan_curve_duty(&fanCurve, fanRpmTarget));
+    analogWrite(PIN_FAN_CONTROL, fanDuty);
+  }
+
+  // No tacho edge for an expected revolution ? Stalled
+  noInterrupts();
+  if (tacho_check(&fanTacho, fan_tacho_ticks())) fanRpmEvent = true;
+  event = fanRpmEvent;
+  interrupts();
 
-  // Tacho timer fired ?
-  if (nowMillis - fanRpmMillis >= fanRpmPeriod) {
+  // RPM event and not updated too recently ?
+  if (event && nowMillis - fanRpmMillis >= fanRpmPeriod) {
     Serial.println("fanLoop()");
     // Restart timer
     fanRpmMillis = nowMillis;
-    // Take local copy of rpm counter
-    tacho = fanTachoCounter;
-    tachoCount = tacho - fanRpmTachoCount;
-    fanRpmTachoCount = tacho;
-    // Calculate RPM
-    fanRpm = (tachoCount * fanRpmMultiplier) / fanTachoCounterPerRev;
+    // Take local copy of RPMs
+    noInterrupts();
+    fanRpmEvent = false;
+    fanRpm = tacho_rpm(&fanTacho);
+    fanRpmInstant = fanTacho.rpm;
+    interrupts();
     // Update leds
     if (fanRpm == 0) {
       rgbOn();
     }
     Serial.print("  fanRPM = ");
-    Serial.println(fanRpm);
+    Serial.print(fanRpm);
+    Serial.print(", fanRpmInstant = ");
+    Serial.print(fanRpmInstant);
+    Serial.print(", fanRpmTarget = ");
+    Serial.print(fanRpmTarget);
+    Serial.print(", fanDuty = ");
+    Serial.print(fanDuty);
+    Serial.print(", argbStepCount = ");
+    Serial.print(argbStepCount);
+    Serial.print(", argbMissCount = ");
+    Serial.print(argbMissCount);
+    Serial.print(", loopMicrosMax = ");
+    Serial.println(loopMicrosMax);
+    loopMicrosMax = 0;
     result = true;
   }
 
   return result;
 }
 
-void fanTachoIsr() {
+void fanTachoIsr(uint32_t ticks) {
+  uint32_t rpm;
+
   fanTachoCounter++;
+  // ARGB step due ? Send the frame for the new phase, the phase moves on
+  // even if the previous frame is still being sent
+  if (argbRunning && ++argbTachoCount >= argbTachoPerStep) {
+    argbTachoCount = 0;
+    argbPhase = (argbPhase + 1 >= argbSteps) ? 0 : argbPhase + 1;
+    if (argb_frames_send(argbPhase)) argbStepCount++;
+    else argbMissCount++;
+  }
+  // RPM updated and moved far enough from the RPM shown ? Raise event
+  if (tacho_edge(&fanTacho, ticks)) {
+    rpm = tacho_rpm(&fanTacho);
+    if (rpm >= fanRpm + FAN_RPM_CHANGE || rpm + FAN_RPM_CHANGE <= fanRpm) fanRpmEvent = true;
+  }
 }
 
 void fanSet(bool on, uint8_t percent) {
@@ -518,14 +677,33 @@ void fanSet(bool on, uint8_t percent) {
   if (fanIsOn) {
     colorSet(false, false, true);
     if (fanPercent >= 100) {
+      fanRpmTarget = 0;
+      fanDuty = ANALOG_WRITE_FAN_MAX;
       analogWrite(PIN_FAN_CONTROL, ANALOG_WRITE_MIN);
       digitalWrite(PIN_FAN_CONTROL, HIGH);
+    } else if (fanCurveValid) {
+      // Starting speed control ? Start from the duty and RPM now
+      if (fanRpmTarget == 0) {
+        noInterrupts();
+        uint32_t rpm = tacho_rpm(&fanTacho);
+        interrupts();
+        fan_pid_reset(&fanPid, constrain(fanDuty, ANALOG_WRITE_FAN_MIN, ANALOG_WRITE_FAN_MAX), rpm);
+        digitalWrite(PIN_FAN_CONTROL, LOW);
+      }
+      // Target RPM across the calibrated range, fanLoop() controls the duty
+      fanRpmTarget = map(fanPercent, 0, 100, fanCurve.rpms[0], fanCurve.rpms[FAN_CURVE_POINTS - 1]);
+      Serial.print("  fanRpmTarget = ");
+      Serial.println(fanRpmTarget);
     } else {
+      fanRpmTarget = 0;
+      fanDuty = map(fanPercent, 0, 100, ANALOG_WRITE_FAN_MIN, ANALOG_WRITE_FAN_MAX);
       digitalWrite(PIN_FAN_CONTROL, LOW);
-      analogWrite(PIN_FAN_CONTROL, map(fanPercent, 0, 100, ANALOG_WRITE_FAN_MIN, ANALOG_WRITE_FAN_MAX));
+      analogWrite(PIN_FAN_CONTROL, fanDuty);
     }
   } else {
     colorSet(false, true, false);
+    fanRpmTarget = 0;
+    fanDuty = ANALOG_WRITE_MIN;
     analogWrite(PIN_FAN_CONTROL, ANALOG_WRITE_MIN);
     digitalWrite(PIN_FAN_CONTROL, LOW);
   }
@@ -715,163 +893,99 @@ void argbSetup(uint8_t setupInner, uint8_t setupOuter) {
     Serial.println(argbTachoPerStep);
 
     // Start allowing the LEDs to be used
-    argb.begin();
+    argbSteps = (argbOuterCount > 0) ? argbOuterCount : argbInnerCount;
+    if (!argb_frames_begin(PIN_ARGB)) {
+      // No LDMA channel, leave the LEDs off
+      Serial.println("  argb_frames_begin() = failed");
+      argbCount = 0;
+    }
   }
 }
 
-void argbLoop(bool reverse, int8_t step) {
+void argbLoop() {
 
   if (argbCount > 0) {
-    // Take local copy of the argb counter
-    uint32_t tacho = fanTachoCounter;
-    uint32_t tachoCount = tacho - argbTachoCount;
-    if (tachoCount >= argbTachoPerStep) {
-#if ARGB_FADE
-      argbStepFade(reverse, step);
-#else
-      argbStepSingle(step);
-#endif
-      if (tachoCount > argbTachoPerStep) Serial.print("!");
-      argbTachoCount = tacho;
+    // Colors changed ? Rebuild frames with the tacho interrupt held off them
+    if (argbBuildNeeded(false)) {
+      argbRunning = false;
+      argbBuild(false);
+      argbShow();
     }
+    // Tacho interrupt steps through the frames as the fan turns
+    argbRunning = true;
   }
 }
 
-void argbStepSingle(int8_t step) {
+void argbStep(bool reverse, int8_t step) {
 
   if (argbCount > 0) {
-    if (argbOuterCount > 0) {
-      if (step < 0) {
-        argbOuterIndex--;
-        if (argbOuterIndex >= argbOuterCount) argbOuterIndex = argbOuterCount - 1;
-      } else if (step > 0) {
-        argbOuterIndex++;
-        if (argbOuterIndex >= argbOuterCount) argbOuterIndex = 0;
-      }
-      argbInnerIndex = argbOuterIndex / 2;
-    } else if (argbInnerCount > 0) {
-      if (step < 0) {
-        argbInnerIndex--;
-        if (argbInnerIndex >= argbInnerCount) argbInnerIndex = argbInnerCount - 1;
-      } else if (step > 0) {
-        argbInnerIndex++;
-        if (argbInnerIndex >= argbInnerCount) argbInnerIndex = 0;
-      }
+    if (argbBuildNeeded(reverse)) argbBuild(reverse);
+    if (step < 0) {
+      argbPhase = (argbPhase == 0) ? argbSteps - 1 : argbPhase - 1;
+    } else if (step > 0) {
+      argbPhase = (argbPhase + 1 >= argbSteps) ? 0 : argbPhase + 1;
     }
+    argbShow();
+  }
+}
 
-    noInterrupts();
-    for (uint8_t i = 0; i < argbInnerCount; i++) {
-      if (i == argbInnerIndex) {
-        argb.set_pixel(
-          1,                // Number of argb
-          colorRedLevel,    // Red level
-          colorGreenLevel,  // Green level
-          colorBlueLevel,   // Blue level
-          100,              // Brightness
-          false);           // End of transfer
-      } else {
-        argb.set_pixel(
-          1,    // Number of argb
-          0,    // Red level
-          0,    // Green level
-          0,    // Blue level
-          100,  // Brightness
-          false);
-      }  // End of transfer
-    }
-    for (uint8_t i = 0; i < argbOuterCount; i++) {
-      if (i == argbOuterIndex) {
-        argb.set_pixel(
-          1,                // Number of argb
-          colorRedLevel,    // Red level
-          colorGreenLevel,  // Green level
-          colorBlueLevel,   // Blue level
-          100,              // Brightness
-          false);           // End of transfer
-      } else {
-        argb.set_pixel(
-          1,    // Number of argb
-          0,    // Red level
-          0,    // Green level
-          0,    // Blue level
-          100,  // Brightness
-          false);
-      }
-    }
-    argb.end_transfer();
-    interrupts();
+void argbShow() {
+  // Wait for frame being sent then send frame for the step
+  while (argb_frames_busy()) {
   }
+  argb_frames_send(argbPhase);
 }
 
-void argbStepFade(bool reverse, int8_t step) {
+bool argbBuildNeeded(bool reverse) {
+  return !argbBuilt || argbBuiltReverse != reverse || argbBuiltRed != colorRedLevel || argbBuiltGreen != colorGreenLevel
+         || argbBuiltBlue != colorBlueLevel;
+}
 
-  if (argbCount > 0) {
-    if (argbOuterCount > 0) {
-      if (step < 0) {
-        argbOuterIndex--;
-        if (argbOuterIndex >= argbOuterCount) argbOuterIndex = argbOuterCount - 1;
-      } else if (step > 0) {
-        argbOuterIndex++;
-        if (argbOuterIndex >= argbOuterCount) argbOuterIndex = 0;
-      }
-      argbInnerIndex = argbOuterIndex / 2;
-    } else if (argbInnerCount > 0) {
-      if (step < 0) {
-        argbInnerIndex--;
-        if (argbInnerIndex >= argbInnerCount) argbInnerIndex = argbInnerCount - 1;
-      } else if (step > 0) {
-        argbInnerIndex++;
-        if (argbInnerIndex >= argbInnerCount) argbInnerIndex = 0;
-      }
-    }
+void argbBuild(bool reverse) {
+  uint32_t colors[ARGB_MAX];
+  uint8_t inner, outer, brightness, i, p;
 
-    noInterrupts();
-    if (reverse) {
-      for (uint8_t i = 0, p = argbInnerIndex; i < argbInnerCount; i++, p++) {
-        if (p >= argbInnerCount) p = 0;
-        argb.set_pixel(
-          1,                        // Number of argb
-          colorRedLevel,            // Red level
-          colorGreenLevel,          // Green level
-          colorBlueLevel,           // Blue level
-          argbInnerFadeReverse[p],  // Brightness
-          false);                   // End of transfer
-      }
-      for (uint8_t i = 0, p = argbOuterIndex; i < argbOuterCount; i++, p++) {
-        if (p >= argbOuterCount) p = 0;
-        argb.set_pixel(
-          1,                        // Number of argb
-          colorRedLevel,            // Red level
-          colorGreenLevel,          // Green level
-          colorBlueLevel,           // Blue level
-          argbOuterFadeReverse[p],  // Brightness
-          false);                   // End of transfer
-      }
-    } else {
-      for (uint8_t i = 0, p = argbInnerIndex; i < argbInnerCount; i++, p++) {
-        if (p >= argbInnerCount) p = 0;
-        argb.set_pixel(
-          1,                        // Number of argb
-          colorRedLevel,            // Red level
-          colorGreenLevel,          // Green level
-          colorBlueLevel,           // Blue level
-          argbInnerFadeForward[p],  // Brightness
-          false);                   // End of transfer
-      }
-      for (uint8_t i = 0, p = argbOuterIndex; i < argbOuterCount; i++, p++) {
-        if (p >= argbOuterCount) p = 0;
-        argb.set_pixel(
-          1,                        // Number of argb
-          colorRedLevel,            // Red level
-          colorGreenLevel,          // Green level
-          colorBlueLevel,           // Blue level
-          argbOuterFadeForward[p],  // Brightness
-          false);                   // End of transfer
-      }
+  // Wait for frame being sent, the frames are about to change
+  while (argb_frames_busy()) {
+  }
+  // Build frame for each step, the outer ring steps one LED and the inner
+  // ring half an LED, or the inner ring steps one LED if there is no outer ring
+  for (uint8_t step = 0; step < argbSteps; step++) {
+    outer = (argbOuterCount > 0) ? step : 0;
+    inner = (argbOuterCount > 0) ? step / 2 : step;
+    for (i = 0, p = inner; i < argbInnerCount; i++, p++) {
+      if (p >= argbInnerCount) p = 0;
+#if ARGB_FADE
+      brightness = (reverse ? argbInnerFadeReverse[p] : argbInnerFadeForward[p]);
+#else
+      brightness = (i == inner ? 100 : 0);
+#endif
+      colors[i] = argbColor(brightness);
     }
-    argb.end_transfer();
-    interrupts();
+    for (i = 0, p = outer; i < argbOuterCount; i++, p++) {
+      if (p >= argbOuterCount) p = 0;
+#if ARGB_FADE
+      brightness = (reverse ? argbOuterFadeReverse[p] : argbOuterFadeForward[p]);
+#else
+      brightness = (i == outer ? 100 : 0);
+#endif
+      colors[argbInnerCount + i] = argbColor(brightness);
+    }
+    argb_frames_encode(step, colors, argbCount);
   }
+  // Frames built
+  argbBuilt = true;
+  argbBuiltReverse = reverse;
+  argbBuiltRed = colorRedLevel;
+  argbBuiltGreen = colorGreenLevel;
+  argbBuiltBlue = colorBlueLevel;
+}
+
+uint32_t argbColor(uint8_t brightness) {
+  // Packed green, red, blue at brightness (0-100)
+  return ((uint32_t)(colorGreenLevel * brightness / 100) << 16)
+         | ((uint32_t)(colorRedLevel * brightness / 100) << 8)
+         | (uint32_t)(colorBlueLevel * brightness / 100);
 }
 
 // RGB FUNCTIONS
@@ -926,7 +1040,7 @@ bool oledSetup() {
   Serial.println("oledSetup()");
   Wire.begin();
   delay(250);
-  oledEnabled = oled.begin(0x3D, true);
+  oledEnabled = oled.begin(OLED_ADDRESS, true);
   oled.oled_commandList(antiFlicker, sizeof(antiFlicker));
   Serial.print("  oledEnabled =  ");
   Serial.println(oledEnabled);
@@ -934,10 +1048,21 @@ bool oledSetup() {
   oled.setTextSize(1);
   oled.setTextColor(SH110X_WHITE);
   oled.display();
+  // Display shows the buffer, send only changes from now on
+  if (oledEnabled) oled_pages_begin(&Wire, OLED_ADDRESS, oled.getBuffer());
 
   return oledEnabled;
 }
 
+bool oledLoop() {
+  bool result = false;
+
+  // Send changes to the display for a short time each pass
+  if (oledEnabled) result = oled_pages_loop();
+
+  return result;
+}
+
 bool oledWriteText() {
   if (oledEnabled) {
     int16_t yTextTop = -3;
@@ -950,15 +1075,22 @@ bool oledWriteText() {
     //oled.fillRect(0, 0, OLED_WIDTH, OLED_HEIGHT, SH110X_WHITE);
     //oled.setTextColor(SH110X_BLACK);
 
-    // Title
-    oled.setFont(&FreeSansBold12pt7b);
+    // Title, drawn once then copied from the cache
+    if (oledTitleBottom < 0) {
+      oled.setFont(&FreeSansBold12pt7b);
 #if MATTER_ENABLED
-    yTextTop = oledCenterText(yTextTop, "MATTER");
-    yTextTop = oledCenterText(yTextTop, "ARGB FAN") + 4;
+      yTextTop = oledCenterText(yTextTop, "MATTER");
+      yTextTop = oledCenterText(yTextTop, "ARGB FAN") + 4;
 #else
-    yTextTop = oledCenterText(yTextTop, "ARGB");
-    yTextTop = oledCenterText(yTextTop, "FAN") + 4;
+      yTextTop = oledCenterText(yTextTop, "ARGB");
+      yTextTop = oledCenterText(yTextTop, "FAN") + 4;
 #endif
+      memcpy(oledTitle, oled.getBuffer(), sizeof(oledTitle));
+      oledTitleBottom = yTextTop;
+    } else {
+      memcpy(oled.getBuffer(), oledTitle, sizeof(oledTitle));
+      yTextTop = oledTitleBottom;
+    }
 
     // Matter state
     oled.setFont(&FreeSans12pt7b);
@@ -976,11 +1108,9 @@ bool oledWriteText() {
     sprintf(line, "%d RPM", fanRpm);
     yTextTop = oledCenterText(yTextTop, line) + 4;
 
-    // Update display
-    noInterrupts();
-    oled.display();
-    interrupts();
+    // Update display, changed pages are sent by oledLoop()
     oled.setContrast(255);
+    oled_pages_update();
   }
 
   return oledEnabled;
@@ -990,48 +1120,71 @@ bool oledWriteText() {
 bool oledWriteQRCode() {
   if (oledEnabled) {
     Serial.print("oledWriteQRCode = ");
-    oled.clearDisplay();
-
-    // Create the QR code
-    QRCode qrcode;
-    uint8_t qrcodeData[qrcode_getBufferSize(4)];
     String payloadString = Matter.getOnboardingQRCodePayload();
-    char payload[30];
+    char payload[OLED_QRCODE_PAYLOAD_MAX] = {};
+    char stored[OLED_QRCODE_PAYLOAD_MAX];
+    uint32_t start = micros();
 
     payloadString.toCharArray(payload, sizeof(payload));
-    qrcode_initText(&qrcode, qrcodeData, 4, ECC_LOW, payload);
-    Serial.print("  qrcode.size = ");
-    Serial.println(qrcode.size);
-
-    uint8_t maxqrcode = OLED_HEIGHT;
-    if (OLED_WIDTH < maxqrcode) maxqrcode = OLED_WIDTH;
-    Serial.print("  maxqrcode = ");
-    Serial.println(maxqrcode);
-    uint8_t modqrcode = maxqrcode / qrcode.size;
-    Serial.print("  modqrcode = ");
-    Serial.println(modqrcode);
-    uint8_t xOffset = (OLED_WIDTH - (qrcode.size * modqrcode)) / 2;
-    uint8_t yOffset = (OLED_HEIGHT - (qrcode.size * modqrcode)) / 2;
-
-    oled.drawRect(0, 0, OLED_WIDTH, OLED_HEIGHT, SH110X_WHITE);
-    oled.fillRect(0, 0, OLED_WIDTH, OLED_HEIGHT, SH110X_WHITE);
-    for (uint8_t yQR = 0, yOLED = yOffset; yQR < qrcode.size; yQR++, yOLED += modqrcode) {
-      // Each horizontal module
-      for (uint8_t xQR = 0, xOLED = xOffset; xQR < qrcode.size; xQR++, xOLED += modqrcode) {
-        if (qrcode_getModule(&qrcode, xQR, yQR)) {
-          if (modqrcode < 2) oled.drawPixel(xOLED, yOLED, SH110X_BLACK);
-          else {
-            oled.drawRect(xOLED, yOLED, modqrcode, modqrcode, SH110X_BLACK);
-            oled.fillRect(xOLED, yOLED, modqrcode, modqrcode, SH110X_BLACK);
+    // QR code stored for this payload ? Read it straight into the display buffer
+    if (nvm3_readData(nvm3_defaultHandle, OLED_QRCODE_PAYLOAD_KEY, stored, sizeof(stored)) == ECODE_NVM3_OK
+        && memcmp(stored, payload, sizeof(payload)) == 0
+        && nvm3_readData(nvm3_defaultHandle, OLED_QRCODE_KEY, oled.getBuffer(), OLED_WIDTH * OLED_HEIGHT / 8) == ECODE_NVM3_OK) {
+      Serial.print("stored, read in ");
+      Serial.print(micros() - start);
+      Serial.println("us");
+    } else {
+      oled.clearDisplay();
+
+      // Create the QR code
+      QRCode qrcode;
+      uint8_t qrcodeData[qrcode_getBufferSize(4)];
+
+      qrcode_initText(&qrcode, qrcodeData, 4, ECC_LOW, payload);
+      Serial.println("drawn");
+      Serial.print("  qrcode.size = ");
+      Serial.println(qrcode.size);
+
+      uint8_t maxqrcode = OLED_HEIGHT;
+      if (OLED_WIDTH < maxqrcode) maxqrcode = OLED_WIDTH;
+      Serial.print("  maxqrcode = ");
+      Serial.println(maxqrcode);
+      uint8_t modqrcode = maxqrcode / qrcode.size;
+      Serial.print("  modqrcode = ");
+      Serial.println(modqrcode);
+      uint8_t xOffset = (OLED_WIDTH - (qrcode.size * modqrcode)) / 2;
+      uint8_t yOffset = (OLED_HEIGHT - (qrcode.size * modqrcode)) / 2;
+
+      oled.drawRect(0, 0, OLED_WIDTH, OLED_HEIGHT, SH110X_WHITE);
+      oled.fillRect(0, 0, OLED_WIDTH, OLED_HEIGHT, SH110X_WHITE);
+      for (uint8_t yQR = 0, yOLED = yOffset; yQR < qrcode.size; yQR++, yOLED += modqrcode) {
+        // Each horizontal module
+        for (uint8_t xQR = 0, xOLED = xOffset; xQR < qrcode.size; xQR++, xOLED += modqrcode) {
+          if (qrcode_getModule(&qrcode, xQR, yQR)) {
+            if (modqrcode < 2) oled.drawPixel(xOLED, yOLED, SH110X_BLACK);
+            else {
+              oled.drawRect(xOLED, yOLED, modqrcode, modqrcode, SH110X_BLACK);
+              oled.fillRect(xOLED, yOLED, modqrcode, modqrcode, SH110X_BLACK);
+            }
           }
         }
       }
+      Serial.print("  drawn in ");
+      Serial.print(micros() - start);
+      Serial.println("us");
+
+      // Store for next time, the old payload is deleted first so it never matches a partly written QR code
+      nvm3_deleteObject(nvm3_defaultHandle, OLED_QRCODE_PAYLOAD_KEY);
+      if (nvm3_writeData(nvm3_defaultHandle, OLED_QRCODE_KEY, oled.getBuffer(), OLED_WIDTH * OLED_HEIGHT / 8) == ECODE_NVM3_OK) {
+        nvm3_writeData(nvm3_defaultHandle, OLED_QRCODE_PAYLOAD_KEY, payload, sizeof(payload));
+      } else {
+        Serial.println("  not stored");
+      }
     }
 
-    noInterrupts();
-    oled.display();
-    interrupts();
+    // Update display, changed pages are sent by oledLoop()
     oled.setContrast(0);  // Dim for easier scanning
+    oled_pages_update();
   }
 
   return oledEnabled;
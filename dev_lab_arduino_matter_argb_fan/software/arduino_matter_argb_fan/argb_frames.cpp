@@ -0,0 +1,163 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * ARGB frame pool
+ *
+ * Encoding follows the WS2812 driver in the mood light Dev Lab, each frame
+ * ends with the low reset period so frames sent back to back are latched.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include <Arduino.h>
+#include "em_cmu.h"
+#include "em_core.h"
+#include "em_gpio.h"
+#include "em_usart.h"
+#include "dmadrv.h"
+#include "argb_frames.h"
+
+// Defines
+#define ARGB_FRAMES_USART USART0                                     // USART used for output, must not be used by another library
+#define ARGB_FRAMES_USART_INDEX 0                                    // USART index for routing
+#define ARGB_FRAMES_USART_CLOCK cmuClock_USART0                      // USART clock
+#define ARGB_FRAMES_USART_SIGNAL dmadrvPeripheralSignal_USART0_TXBL  // USART signal for LDMA
+#define ARGB_FRAMES_FREQ 2400000                                     // USART bit rate, 3 bits per WS2812 bit
+#define ARGB_FRAMES_PIXEL_BYTES 9                                    // Encoded bytes per pixel
+#define ARGB_FRAMES_RESET_BYTES 90                                   // Encoded bytes of low level for the reset period (>280us)
+#define ARGB_FRAMES_SIZE (ARGB_FRAMES_PIXEL_MAX * ARGB_FRAMES_PIXEL_BYTES + ARGB_FRAMES_RESET_BYTES)
+#define ARGB_FRAMES_TRANSFER_MAX 2048                                // Most items DMADRV sends in one transfer
+
+static_assert(ARGB_FRAMES_SIZE <= ARGB_FRAMES_TRANSFER_MAX, "Frame does not fit in one LDMA transfer, lower ARGB_FRAMES_PIXEL_MAX");
+
+// Encoded bits for each nibble, 4 WS2812 bits as 12 USART bits
+static const uint16_t argb_frames_nibbles[16] = { 0x924, 0x926, 0x934, 0x936, 0x9a4, 0x9a6, 0x9b4, 0x9b6, 0xd24, 0xd26, 0xd34, 0xd36, 0xda4, 0xda6, 0xdb4, 0xdb6 };
+
+// Pool data
+static uint8_t argb_frames_pool[ARGB_FRAMES_MAX][ARGB_FRAMES_SIZE];  // Encoded frames
+static uint16_t argb_frames_lengths[ARGB_FRAMES_MAX];                // Encoded bytes in each frame
+static unsigned int argb_frames_channel;                             // LDMA channel
+static bool argb_frames_ready = false;                               // LDMA channel allocated, frames can be sent
+static volatile bool argb_frames_transmitting = false;               // Frame is being transmitted
+static volatile uint8_t argb_frames_sending = ARGB_FRAMES_MAX;       // Frame being transmitted, or last transmitted
+static volatile uint8_t argb_frames_encoding = ARGB_FRAMES_MAX;      // Frame being encoded, not to be sent, ARGB_FRAMES_MAX when none
+
+// LDMA transfer complete callback
+static bool argb_frames_done(unsigned int channel, unsigned int sequence, void *param) {
+  (void)channel;
+  (void)sequence;
+  (void)param;
+  argb_frames_transmitting = false;
+  return true;
+}
+
+// Set up pool and USART
+bool argb_frames_begin(uint8_t pin) {
+  USART_InitSync_TypeDef init = USART_INITSYNC_DEFAULT;
+  GPIO_Port_TypeDef port = getSilabsPortFromArduinoPin(pinToPinName(pin));
+  uint32_t port_pin = getSilabsPinFromArduinoPin(pinToPinName(pin));
+  // Empty frames, just the reset period
+  memset(argb_frames_pool, 0, sizeof(argb_frames_pool));
+  for (uint8_t f = 0; f < ARGB_FRAMES_MAX; f++) argb_frames_lengths[f] = ARGB_FRAMES_RESET_BYTES;
+  // USART, transmit only, most significant bit first
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(ARGB_FRAMES_USART_CLOCK, true);
+  init.enable = usartDisable;
+  init.baudrate = ARGB_FRAMES_FREQ;
+  init.msbf = true;
+  USART_InitSync(ARGB_FRAMES_USART, &init);
+  // Route transmit to pin, low when idle
+  GPIO_PinModeSet(port, port_pin, gpioModePushPull, 0);
+  GPIO->USARTROUTE[ARGB_FRAMES_USART_INDEX].TXROUTE = ((uint32_t)port << _GPIO_USART_TXROUTE_PORT_SHIFT)
+                                                      | (port_pin << _GPIO_USART_TXROUTE_PIN_SHIFT);
+  GPIO->USARTROUTE[ARGB_FRAMES_USART_INDEX].ROUTEEN = GPIO_USART_ROUTEEN_TXPEN;
+  USART_Enable(ARGB_FRAMES_USART, usartEnableTx);
+  // LDMA
+  DMADRV_Init();
+  argb_frames_ready = (DMADRV_AllocateChannel(&argb_frames_channel, NULL) == ECODE_EMDRV_DMADRV_OK);
+  return argb_frames_ready;
+}
+
+// Encode packed GRB colors into a frame of the pool
+void argb_frames_encode(uint8_t frame, const uint32_t *colors, uint16_t count) {
+  uint8_t *out;
+  uint32_t color, bits;
+  bool claimed;
+  if (frame >= ARGB_FRAMES_MAX) return;
+  if (count > ARGB_FRAMES_PIXEL_MAX) count = ARGB_FRAMES_PIXEL_MAX;
+  // Claim the frame once LDMA is not reading it, an interrupt may be sending it
+  do {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    claimed = !(argb_frames_transmitting && argb_frames_sending == frame);
+    if (claimed) argb_frames_encoding = frame;
+    CORE_EXIT_ATOMIC();
+  } while (!claimed);
+  out = argb_frames_pool[frame];
+  // Green, red then blue
+  for (uint16_t p = 0; p < count; p++) {
+    color = colors[p];
+    for (int8_t shift = 16; shift >= 0; shift -= 8) {
+      bits = ((uint32_t)argb_frames_nibbles[(color >> (shift + 4)) & 0xF] << 12) | argb_frames_nibbles[(color >> shift) & 0xF];
+      *out++ = bits >> 16;
+      *out++ = bits >> 8;
+      *out++ = bits;
+    }
+  }
+  // Low for the reset period after the pixels
+  memset(out, 0, ARGB_FRAMES_RESET_BYTES);
+  argb_frames_lengths[frame] = count * ARGB_FRAMES_PIXEL_BYTES + ARGB_FRAMES_RESET_BYTES;
+  // Frame can be sent again, once the encoded bytes are written
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  argb_frames_encoding = ARGB_FRAMES_MAX;
+  CORE_EXIT_ATOMIC();
+}
+
+// Check if a frame is being transmitted
+bool argb_frames_busy() {
+  return argb_frames_transmitting;
+}
+
+// Start transmitting a frame
+bool argb_frames_send(uint8_t frame) {
+  bool send;
+  if (frame >= ARGB_FRAMES_MAX || !argb_frames_ready) return false;
+  // Claim the USART, an interrupt may be sending too, and skip a frame being encoded
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  send = !argb_frames_transmitting && frame != argb_frames_encoding;
+  if (send) {
+    argb_frames_transmitting = true;
+    argb_frames_sending = frame;
+  }
+  CORE_EXIT_ATOMIC();
+  if (send
+      && DMADRV_MemoryPeripheral(argb_frames_channel, ARGB_FRAMES_USART_SIGNAL, (void *)&ARGB_FRAMES_USART->TXDATA, argb_frames_pool[frame], true,
+                                 argb_frames_lengths[frame], dmadrvDataSize1, argb_frames_done, NULL)
+           != ECODE_EMDRV_DMADRV_OK) {
+    // Nothing was started so the done callback will not release the USART
+    argb_frames_transmitting = false;
+    send = false;
+  }
+  return send;
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * ARGB frame pool
+ *
+ * Holds a pool of ARGB frames already encoded into USART synchronous mode
+ * bits, 3 bits per WS2812 bit at 2.4MHz. Sending a frame only starts an LDMA
+ * transfer, so frames can be sent from an interrupt as the fan turns without
+ * any per-pixel work or disabling interrupts.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef ARGB_FRAMES_H
+#define ARGB_FRAMES_H
+
+#include <stdint.h>
+
+#ifndef ARGB_FRAMES_PIXEL_MAX
+#define ARGB_FRAMES_PIXEL_MAX 32  // Maximum number of pixels in a frame
+#endif
+#ifndef ARGB_FRAMES_MAX
+#define ARGB_FRAMES_MAX 20        // Number of frames in the pool
+#endif
+#define ARGB_FRAMES_MEMORY (ARGB_FRAMES_MAX * (ARGB_FRAMES_PIXEL_MAX * 9 + 90))  // Bytes of RAM used by the pool
+
+// Set up pool and USART, pin must not be used by another peripheral, returns
+// false if no LDMA channel is free and frames will not be sent
+bool argb_frames_begin(uint8_t pin);
+
+// Encode packed GRB colors into a frame of the pool, waits while the frame is
+// being transmitted and holds off sending it until it is encoded
+void argb_frames_encode(uint8_t frame, const uint32_t *colors, uint16_t count);
+
+// Check if a frame is being transmitted
+bool argb_frames_busy();
+
+// Start transmitting a frame, safe to call from an interrupt, returns false
+// without sending if the previous frame is still being transmitted, the frame
+// is being encoded or the transfer fails to start
+bool argb_frames_send(uint8_t frame);
+
+#endif // ARGB_FRAMES_H
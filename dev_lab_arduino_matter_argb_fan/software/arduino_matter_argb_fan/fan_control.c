@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan speed control
+ *
+ * The error is taken from the modelled RPM rather than the target, while
+ * the feed forward jumps straight to the target's duty, so a correct curve
+ * leaves no error to integrate during a speed change. The derivative acts on
+ * the measured RPM so a change of target does not kick the output. The
+ * integral term stops growing while the output is held at a limit or by the
+ * slew rate in the direction of the error, so it does not wind up.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "fan_control.h"
+
+// Check a curve has been calibrated
+bool fan_curve_calibrated(const fan_curve_t *curve) {
+  return curve->magic == FAN_CURVE_MAGIC;
+}
+
+// Check a curve is usable
+bool fan_curve_valid(const fan_curve_t *curve) {
+  if (!fan_curve_calibrated(curve)) return false;
+  if (curve->rpms[0] == 0) return false;
+  for (uint8_t i = 1; i < FAN_CURVE_POINTS; i++) {
+    if (curve->duties[i] <= curve->duties[i - 1]) return false;
+    if (curve->rpms[i] <= curve->rpms[i - 1]) return false;
+  }
+  return true;
+}
+
+// Duty expected to give rpm
+int32_t fan_curve_duty(const fan_curve_t *curve, uint32_t rpm) {
+  uint8_t i;
+  // Off the ends ?
+  if (rpm <= curve->rpms[0]) return curve->duties[0];
+  if (rpm >= curve->rpms[FAN_CURVE_POINTS - 1]) return curve->duties[FAN_CURVE_POINTS - 1];
+  // Interpolate between the points either side
+  for (i = 1; rpm > curve->rpms[i]; i++) {
+  }
+  return curve->duties[i - 1] + (int32_t)(((rpm - curve->rpms[i - 1]) * (uint32_t)(curve->duties[i] - curve->duties[i - 1]))
+                                          / (curve->rpms[i] - curve->rpms[i - 1]));
+}
+
+// Set up PID controller
+void fan_pid_init(fan_pid_t *pid, int32_t kp, int32_t ki, int32_t kd, int32_t out_min, int32_t out_max, int32_t slew, uint32_t period, uint32_t tau) {
+  pid->kp = kp;
+  pid->ki = ki;
+  pid->kd = kd;
+  pid->out_min = out_min;
+  pid->out_max = out_max;
+  pid->slew = slew;
+  // Model moves period / (tau + period) of the way each update, all the way without a time constant
+  pid->model_k = (int32_t)(((uint64_t)period << 16) / ((uint64_t)tau + period));
+  fan_pid_reset(pid, out_min, 0);
+}
+
+// Restart from the duty and RPM now
+void fan_pid_reset(fan_pid_t *pid, int32_t output, int32_t input) {
+  pid->model = input << 16;
+  pid->integral = 0;
+  pid->last = input;
+  pid->output = output;
+}
+
+// Update with the target and measured RPMs and the duty fed forward
+int32_t fan_pid_update(fan_pid_t *pid, int32_t setpoint, int32_t input, int32_t feed) {
+  int32_t error;
+  int32_t integral;
+  int32_t limit = (pid->out_max - pid->out_min) << 16;
+  int64_t sum;
+  int32_t output;
+  bool held = false;
+  // Move model towards the target, error is from where the fan should be now
+  pid->model += (int32_t)(((int64_t)((setpoint << 16) - pid->model) * pid->model_k) >> 16);
+  error = ((pid->model + 0x8000) >> 16) - input;
+  integral = pid->integral + pid->ki * error;
+  // Integral alone never needs more than the whole output range
+  if (integral > limit) integral = limit;
+  else if (integral < -limit) integral = -limit;
+  // Feed forward, proportional, integral and derivative on the measurement, rounded
+  sum = ((int64_t)feed << 16) + (int64_t)pid->kp * error + integral - (int64_t)pid->kd * (input - pid->last);
+  output = (int32_t)((sum + 0x8000) >> 16);
+  pid->last = input;
+  // Hold output within limits and slew rate
+  if (output > pid->out_max) {
+    output = pid->out_max;
+    held = (error > 0);
+  } else if (output < pid->out_min) {
+    output = pid->out_min;
+    held = (error < 0);
+  }
+  if (output > pid->output + pid->slew) {
+    output = pid->output + pid->slew;
+    held = held || (error > 0);
+  } else if (output < pid->output - pid->slew) {
+    output = pid->output - pid->slew;
+    held = held || (error < 0);
+  }
+  // Keep integral unless the output is being held against the error
+  if (!held) pid->integral = integral;
+  pid->output = output;
+  return output;
+}
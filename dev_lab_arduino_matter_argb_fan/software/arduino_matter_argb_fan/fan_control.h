@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan speed control
+ *
+ * Fixed point PID control of fan RPM. The duty expected to give the target
+ * RPM is read from a calibrated duty to RPM curve and fed forward, so the
+ * PID only trims out differences between fans, supply voltages and the
+ * curve. The PID follows a model of the fan reaching the target at its
+ * calibrated time constant, so it does not push against the fan's own lag.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef FAN_CONTROL_H
+#define FAN_CONTROL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FAN_CURVE_POINTS 5         // Points measured along the duty to RPM curve
+#define FAN_CURVE_MAGIC 0x46414E31  // Marks a calibrated curve, change if fan_curve_t changes
+
+// Duty to RPM curve, stored in NVM
+typedef struct fan_curve {
+  uint32_t magic;                     // FAN_CURVE_MAGIC when calibrated
+  uint16_t duties[FAN_CURVE_POINTS];  // PWM duties, rising
+  uint16_t rpms[FAN_CURVE_POINTS];    // RPM measured at each duty
+  uint16_t tau;                       // Time constant, time to reach 63% of a speed change (ms)
+} fan_curve_t;
+
+// PID controller, only change through the functions below
+typedef struct fan_pid {
+  // Configuration
+  int32_t kp;        // Proportional gain, duty per RPM of error (16 fraction bits)
+  int32_t ki;        // Integral gain, duty per RPM of error each update (16 fraction bits)
+  int32_t kd;        // Derivative gain, duty per RPM change each update (16 fraction bits)
+  int32_t out_min;   // Lowest output duty
+  int32_t out_max;   // Highest output duty
+  int32_t slew;      // Largest output change each update
+  int32_t model_k;   // Fraction of the way the model moves to the target each update (16 fraction bits)
+  // Data
+  int32_t model;     // Modelled RPM, following the target as the fan should (16 fraction bits)
+  int32_t integral;  // Integral term (16 fraction bits)
+  int32_t last;      // Input at last update
+  int32_t output;    // Output at last update
+} fan_pid_t;
+
+// Check a curve has been calibrated, it is stored even when not usable so a
+// fan that did not turn is not calibrated again at every start up
+bool fan_curve_calibrated(const fan_curve_t *curve);
+
+// Check a curve is usable, the fan turns at the lowest duty and RPMs rise
+bool fan_curve_valid(const fan_curve_t *curve);
+
+// Duty expected to give rpm, interpolated along the curve and held at its ends
+int32_t fan_curve_duty(const fan_curve_t *curve, uint32_t rpm);
+
+// Set up PID controller
+//   kp, ki, kd       - gains (16 fraction bits)
+//   out_min, out_max - output duty range
+//   slew             - largest output change each update
+//   period, tau      - update period and fan time constant, in the same units
+void fan_pid_init(fan_pid_t *pid, int32_t kp, int32_t ki, int32_t kd, int32_t out_min, int32_t out_max, int32_t slew, uint32_t period, uint32_t tau);
+
+// Restart from the duty and RPM now, clearing the integral term and starting
+// the model from the RPM
+void fan_pid_reset(fan_pid_t *pid, int32_t output, int32_t input);
+
+// Update with the target and measured RPMs and the duty fed forward,
+// returns the new duty
+int32_t fan_pid_update(fan_pid_t *pid, int32_t setpoint, int32_t input, int32_t feed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FAN_CONTROL_H
@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan tacho capture
+ *
+ * The TIMER is 16 bits, overflows are counted in the interrupt to extend the
+ * timestamps to 32 bits. A capture in the same interrupt as an overflow is
+ * placed before or after it by the captured value.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include <Arduino.h>
+#include "em_cmu.h"
+#include "em_core.h"
+#include "em_gpio.h"
+#include "em_timer.h"
+#include "fan_tacho.h"
+
+// Defines
+#define FAN_TACHO_TIMER TIMER4                      // TIMER used for capture, must not be used by another library
+#define FAN_TACHO_TIMER_INDEX 4                     // TIMER index for routing
+#define FAN_TACHO_TIMER_CLOCK cmuClock_TIMER4       // TIMER clock
+#define FAN_TACHO_TIMER_IRQ TIMER4_IRQn             // TIMER interrupt
+#define FAN_TACHO_TIMER_HANDLER TIMER4_IRQHandler   // TIMER interrupt handler
+#define FAN_TACHO_TIMER_TOP 0x10000                 // TIMER counts before overflow
+
+// Driver data
+static fan_tacho_callback_t fan_tacho_callback = NULL;  // Edge callback
+static volatile uint32_t fan_tacho_high = 0;            // Upper bits of timestamps, counted by overflows
+
+// Set up TIMER to timestamp edges on pin
+uint32_t fan_tacho_begin(uint8_t pin, PinStatus edge, fan_tacho_callback_t callback) {
+  TIMER_Init_TypeDef init = TIMER_INIT_DEFAULT;
+  TIMER_InitCC_TypeDef cc = TIMER_INITCC_DEFAULT;
+  GPIO_Port_TypeDef port = getSilabsPortFromArduinoPin(pinToPinName(pin));
+  uint32_t port_pin = getSilabsPinFromArduinoPin(pinToPinName(pin));
+  uint32_t prescale;
+  fan_tacho_callback = callback;
+  // Input with pull up and glitch filter
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(FAN_TACHO_TIMER_CLOCK, true);
+  GPIO_PinModeSet(port, port_pin, gpioModeInputPullFilter, 1);
+  // Capture channel 0 from pin
+  cc.mode = timerCCModeCapture;
+  cc.edge = (edge == CHANGE) ? timerEdgeBoth : ((edge == FALLING) ? timerEdgeFalling : timerEdgeRising);
+  cc.eventCtrl = timerEventEveryEdge;
+  cc.filter = true;
+  TIMER_InitCC(FAN_TACHO_TIMER, 0, &cc);
+  GPIO->TIMERROUTE[FAN_TACHO_TIMER_INDEX].CC0ROUTE = ((uint32_t)port << _GPIO_TIMER_CC0ROUTE_PORT_SHIFT)
+                                                     | (port_pin << _GPIO_TIMER_CC0ROUTE_PIN_SHIFT);
+  GPIO->TIMERROUTE[FAN_TACHO_TIMER_INDEX].ROUTEEN = GPIO_TIMER_ROUTEEN_CC0PEN;
+  // Count at the timestamp clock, or as close as the prescaler allows
+  prescale = CMU_ClockFreqGet(FAN_TACHO_TIMER_CLOCK) / FAN_TACHO_FREQ;
+  if (prescale < 1) prescale = 1;
+  if (prescale > 1024) prescale = 1024;
+  init.enable = false;
+  init.prescale = (TIMER_Prescale_TypeDef)(prescale - 1);
+  TIMER_Init(FAN_TACHO_TIMER, &init);
+  TIMER_TopSet(FAN_TACHO_TIMER, FAN_TACHO_TIMER_TOP - 1);
+  // Interrupt on captures and overflows
+  TIMER_IntClear(FAN_TACHO_TIMER, TIMER_IF_CC0 | TIMER_IF_OF);
+  TIMER_IntEnable(FAN_TACHO_TIMER, TIMER_IEN_CC0 | TIMER_IEN_OF);
+  NVIC_ClearPendingIRQ(FAN_TACHO_TIMER_IRQ);
+  NVIC_EnableIRQ(FAN_TACHO_TIMER_IRQ);
+  TIMER_Enable(FAN_TACHO_TIMER, true);
+  return CMU_ClockFreqGet(FAN_TACHO_TIMER_CLOCK) / prescale;
+}
+
+// Current timestamp
+uint32_t fan_tacho_ticks() {
+  uint32_t high, low;
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  high = fan_tacho_high;
+  low = TIMER_CounterGet(FAN_TACHO_TIMER);
+  // Overflowed but not yet counted ? Read again after it
+  if (TIMER_IntGet(FAN_TACHO_TIMER) & TIMER_IF_OF) {
+    high += FAN_TACHO_TIMER_TOP;
+    low = TIMER_CounterGet(FAN_TACHO_TIMER);
+  }
+  CORE_EXIT_ATOMIC();
+  return high | low;
+}
+
+// Capture and overflow interrupt
+extern "C" void FAN_TACHO_TIMER_HANDLER(void) {
+  uint32_t flags = TIMER_IntGet(FAN_TACHO_TIMER);
+  uint32_t high = fan_tacho_high;
+  uint32_t low;
+  bool overflow = (flags & TIMER_IF_OF) != 0;
+  TIMER_IntClear(FAN_TACHO_TIMER, flags & (TIMER_IF_CC0 | TIMER_IF_OF));
+  // Read each capture waiting in the buffer
+  while (!(FAN_TACHO_TIMER->STATUS & TIMER_STATUS_ICFEMPTY0)) {
+    low = TIMER_CaptureGet(FAN_TACHO_TIMER, 0);
+    // Captured after the overflow ? Low values only happen after it
+    if (fan_tacho_callback) fan_tacho_callback(((overflow && low < FAN_TACHO_TIMER_TOP / 2) ? high + FAN_TACHO_TIMER_TOP : high) | low);
+  }
+  // Count overflow
+  if (overflow) fan_tacho_high = high + FAN_TACHO_TIMER_TOP;
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan tacho capture
+ *
+ * Timestamps tacho edges with a TIMER input capture channel. The timestamps
+ * are taken in hardware, so they do not depend on interrupt latency, and
+ * are passed to a callback from the capture interrupt.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef FAN_TACHO_H
+#define FAN_TACHO_H
+
+#include <Arduino.h>
+
+#define FAN_TACHO_FREQ 1000000  // Timestamp clock, requested (Hz)
+
+// Edge callback, called from the capture interrupt with the edge timestamp
+typedef void (*fan_tacho_callback_t)(uint32_t ticks);
+
+// Set up TIMER to timestamp edges on pin, edge is RISING, FALLING or CHANGE,
+// returns the timestamp clock (Hz)
+uint32_t fan_tacho_begin(uint8_t pin, PinStatus edge, fan_tacho_callback_t callback);
+
+// Current timestamp, for checking how long since the last edge
+uint32_t fan_tacho_ticks();
+
+#endif // FAN_TACHO_H
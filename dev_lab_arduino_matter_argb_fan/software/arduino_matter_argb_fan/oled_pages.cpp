@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * OLED page updates
+ *
+ * Columns are taken from the buffer as they are sent, so drawing into the
+ * buffer while an update is being sent is safe, the next update picks up
+ * anything that changed after it was sent.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "oled_pages.h"
+
+// Defines
+#define OLED_PAGES_COUNT (OLED_PAGES_HEIGHT / 8)  // Pages in the buffer
+#define OLED_PAGES_CONTROL_COMMAND 0x00           // Control byte before commands
+#define OLED_PAGES_CONTROL_DATA 0x40              // Control byte before data
+#define OLED_PAGES_SETPAGE 0xB0                   // Command to set page address
+#define OLED_PAGES_SETCOLUMN_HIGH 0x10            // Command to set high nibble of column address
+#define OLED_PAGES_SETCOLUMN_LOW 0x00             // Command to set low nibble of column address
+
+// Page data
+static TwoWire *oled_pages_wire = NULL;                               // I2C bus
+static uint8_t oled_pages_address;                                    // Display address
+static const uint8_t *oled_pages_buffer = NULL;                       // Buffer drawn into
+static uint8_t oled_pages_shown[OLED_PAGES_COUNT][OLED_PAGES_WIDTH];  // Copy of what the display shows
+static uint8_t oled_pages_first[OLED_PAGES_COUNT];                    // First changed column in each page
+static uint8_t oled_pages_last[OLED_PAGES_COUNT];                     // Last changed column in each page, below first if unchanged
+static uint8_t oled_pages_page = 0;                                   // Page being sent
+static bool oled_pages_sending = false;                               // Changed columns waiting to be sent
+
+// Set up with the display's address and buffer
+void oled_pages_begin(TwoWire *wire, uint8_t address, const uint8_t *buffer) {
+  oled_pages_wire = wire;
+  oled_pages_address = address;
+  oled_pages_buffer = buffer;
+  memcpy(oled_pages_shown, buffer, sizeof(oled_pages_shown));
+  for (uint8_t p = 0; p < OLED_PAGES_COUNT; p++) {
+    oled_pages_first[p] = 1;
+    oled_pages_last[p] = 0;
+  }
+  oled_pages_page = 0;
+  oled_pages_sending = false;
+}
+
+// Find the changed columns of each page
+uint8_t oled_pages_update() {
+  const uint8_t *page;
+  uint8_t first, last;
+  uint8_t count = 0;
+  if (oled_pages_buffer == NULL) return 0;
+  for (uint8_t p = 0; p < OLED_PAGES_COUNT; p++) {
+    page = oled_pages_buffer + p * OLED_PAGES_WIDTH;
+    // Unchanged page ?
+    if (memcmp(page, oled_pages_shown[p], OLED_PAGES_WIDTH) == 0) {
+      oled_pages_first[p] = 1;
+      oled_pages_last[p] = 0;
+      continue;
+    }
+    // Narrow to changed columns
+    for (first = 0; page[first] == oled_pages_shown[p][first]; first++) {
+    }
+    for (last = OLED_PAGES_WIDTH - 1; page[last] == oled_pages_shown[p][last]; last--) {
+    }
+    oled_pages_first[p] = first;
+    oled_pages_last[p] = last;
+    count++;
+  }
+  // Start from the top
+  oled_pages_page = 0;
+  oled_pages_sending = (count > 0);
+  if (oled_pages_sending) oled_pages_wire->setClock(OLED_PAGES_FREQ);
+  return count;
+}
+
+// Send one chunk of changed columns, returns false when all are sent
+static bool oled_pages_chunk() {
+  uint8_t p, first, length;
+  // Next page with changed columns
+  for (p = oled_pages_page; p < OLED_PAGES_COUNT && oled_pages_first[p] > oled_pages_last[p]; p++) {
+  }
+  oled_pages_page = p;
+  if (p >= OLED_PAGES_COUNT) {
+    oled_pages_sending = false;
+    return false;
+  }
+  first = oled_pages_first[p];
+  length = oled_pages_last[p] - first + 1;
+  if (length > OLED_PAGES_CHUNK) length = OLED_PAGES_CHUNK;
+  // Page and column address
+  oled_pages_wire->beginTransmission(oled_pages_address);
+  oled_pages_wire->write(OLED_PAGES_CONTROL_COMMAND);
+  oled_pages_wire->write(OLED_PAGES_SETPAGE | p);
+  oled_pages_wire->write(OLED_PAGES_SETCOLUMN_HIGH | (first >> 4));
+  oled_pages_wire->write(OLED_PAGES_SETCOLUMN_LOW | (first & 0x0F));
+  oled_pages_wire->endTransmission();
+  // Columns, taken from the buffer now and recorded as shown
+  memcpy(&oled_pages_shown[p][first], oled_pages_buffer + p * OLED_PAGES_WIDTH + first, length);
+  oled_pages_wire->beginTransmission(oled_pages_address);
+  oled_pages_wire->write(OLED_PAGES_CONTROL_DATA);
+  oled_pages_wire->write(&oled_pages_shown[p][first], length);
+  oled_pages_wire->endTransmission();
+  // Move on through page
+  if (oled_pages_last[p] - first + 1 > length) oled_pages_first[p] = first + length;
+  else {
+    oled_pages_first[p] = 1;
+    oled_pages_last[p] = 0;
+  }
+  return true;
+}
+
+// Send changed columns for up to OLED_PAGES_BUDGET
+bool oled_pages_loop() {
+  uint32_t start = micros();
+  while (oled_pages_sending && micros() - start < OLED_PAGES_BUDGET) {
+    oled_pages_chunk();
+  }
+  return oled_pages_sending;
+}
+
+// Send all changed columns now
+void oled_pages_flush() {
+  while (oled_pages_sending) {
+    oled_pages_chunk();
+  }
+}
+
+// Check if there is more to send
+bool oled_pages_busy() {
+  return oled_pages_sending;
+}
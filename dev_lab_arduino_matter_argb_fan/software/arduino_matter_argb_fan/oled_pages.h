@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * OLED page updates
+ *
+ * Sends only the changed parts of an SH110X display buffer. Each page of the
+ * buffer is compared with a copy of what the display shows, then the changed
+ * columns are sent over I2C a small chunk at a time, so drawing a frame
+ * never holds up the loop for a whole display update.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef OLED_PAGES_H
+#define OLED_PAGES_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define OLED_PAGES_WIDTH 128        // Display width, bytes in each page
+#define OLED_PAGES_HEIGHT 128       // Display height, 8 rows in each page
+#define OLED_PAGES_FREQ 1000000     // I2C clock while sending (Hz)
+#define OLED_PAGES_CHUNK 31         // Data bytes sent in each I2C transfer, one less than the Wire buffer
+#define OLED_PAGES_BUDGET 1000      // Time oled_pages_loop() keeps sending for (us)
+
+// Set up with the display's address and buffer, the display must already
+// show the buffer
+void oled_pages_begin(TwoWire *wire, uint8_t address, const uint8_t *buffer);
+
+// Find the changed columns of each page, call after drawing into the buffer,
+// returns the number of pages to send
+uint8_t oled_pages_update();
+
+// Send changed columns for up to OLED_PAGES_BUDGET, returns true while there
+// is more to send
+bool oled_pages_loop();
+
+// Send all changed columns now
+void oled_pages_flush();
+
+// Check if there is more to send
+bool oled_pages_busy();
+
+#endif // OLED_PAGES_H
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan tachometer calculations
+ *
+ * Periods between edges are kept for the last revolution and summed as
+ * edges arrive, so each RPM update is a subtraction, an addition and one
+ * division. Until a whole revolution has been measured the RPM is scaled up
+ * from the edges seen so far.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "tacho.h"
+
+// Set up tachometer, starts stalled
+void tacho_init(tacho_t *tacho, uint32_t ticks_per_second, uint8_t edges_per_rev, uint8_t filter_shift, uint32_t rpm_min, uint32_t rpm_max) {
+  if (edges_per_rev < 1) edges_per_rev = 1;
+  if (edges_per_rev > TACHO_EDGES_MAX) edges_per_rev = TACHO_EDGES_MAX;
+  if (rpm_min < 1) rpm_min = 1;
+  if (rpm_max < rpm_min) rpm_max = rpm_min;
+  tacho->ticks_per_second = ticks_per_second;
+  tacho->edges_per_rev = edges_per_rev;
+  tacho->filter_shift = filter_shift;
+  tacho->period_min = (uint32_t)(((uint64_t)ticks_per_second * 60) / ((uint64_t)rpm_max * edges_per_rev));
+  tacho->stall_max = (uint32_t)(((uint64_t)ticks_per_second * 60) / rpm_min);
+  tacho->last = 0;
+  for (uint8_t i = 0; i < TACHO_EDGES_MAX; i++) tacho->periods[i] = 0;
+  tacho->rev = 0;
+  tacho->index = 0;
+  tacho->valid = 0;
+  tacho->running = false;
+  tacho->rpm = 0;
+  tacho->filtered = 0;
+}
+
+// Add an edge at timestamp ticks, returns true when the RPM is updated
+bool tacho_edge(tacho_t *tacho, uint32_t ticks) {
+  uint32_t period = ticks - tacho->last;
+  // First edge since start or a stall, nothing to measure from yet
+  if (!tacho->running) {
+    tacho->running = true;
+    tacho->last = ticks;
+    return false;
+  }
+  // Too soon after the last edge ? Ignore as noise
+  if (period < tacho->period_min) return false;
+  tacho->last = ticks;
+  // Replace the oldest period in the revolution
+  tacho->rev += period - tacho->periods[tacho->index];
+  tacho->periods[tacho->index] = period;
+  if (++tacho->index >= tacho->edges_per_rev) tacho->index = 0;
+  if (tacho->valid < tacho->edges_per_rev) tacho->valid++;
+  // RPM over the periods measured, a whole revolution once running
+  tacho->rpm = (uint32_t)(((uint64_t)tacho->ticks_per_second * 60 * tacho->valid) / ((uint64_t)tacho->rev * tacho->edges_per_rev));
+  // First RPM starts the filter, later RPMs move it part of the way
+  if (tacho->valid == 1) tacho->filtered = tacho->rpm << 8;
+  else tacho->filtered += (int32_t)((tacho->rpm << 8) - tacho->filtered) >> tacho->filter_shift;
+  return true;
+}
+
+// Check for a stall at timestamp ticks, returns true when the RPM drops to 0
+bool tacho_check(tacho_t *tacho, uint32_t ticks) {
+  uint32_t limit = tacho->stall_max;
+  bool stalled = (tacho->rpm != 0);
+  // Already stalled ?
+  if (!tacho->running) return false;
+  // Speed known ? Allow one expected revolution
+  if (tacho->valid > 0) {
+    uint32_t expected = (uint32_t)(((uint64_t)tacho->rev * tacho->edges_per_rev) / tacho->valid);
+    if (expected < limit) limit = expected;
+  }
+  // Edge in time ? Timestamps taken before the last edge are too
+  if ((int32_t)(ticks - tacho->last) <= (int32_t)limit) return false;
+  // Stalled, start again from the next edge
+  for (uint8_t i = 0; i < TACHO_EDGES_MAX; i++) tacho->periods[i] = 0;
+  tacho->rev = 0;
+  tacho->index = 0;
+  tacho->valid = 0;
+  tacho->running = false;
+  tacho->rpm = 0;
+  tacho->filtered = 0;
+  return stalled;
+}
+
+// Filtered RPM, rounded
+uint32_t tacho_rpm(const tacho_t *tacho) {
+  return (tacho->filtered + 0x80) >> 8;
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Fan tachometer calculations
+ *
+ * Calculates fan RPM from the timestamps of tacho edges. Each edge gives an
+ * RPM over the last revolution, so uneven spacing of the edges in a
+ * revolution cancels out. A first order filter smooths the RPM, and a stall
+ * is detected when no edge arrives within one expected revolution.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef TACHO_H
+#define TACHO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TACHO_EDGES_MAX 8  // Most edges per revolution
+
+// Tachometer state, only change through the functions below
+typedef struct tacho {
+  // Configuration
+  uint32_t ticks_per_second;          // Timestamp clock (Hz)
+  uint8_t edges_per_rev;              // Edges per revolution
+  uint8_t filter_shift;               // Each edge moves the filtered RPM 1 / 2^filter_shift of the way
+  uint32_t period_min;                // Shortest period between edges (ticks), shorter periods are noise
+  uint32_t stall_max;                 // Longest time without an edge (ticks), at the slowest RPM measured
+  // Data
+  uint32_t last;                      // Timestamp of last edge
+  uint32_t periods[TACHO_EDGES_MAX];  // Periods between the last edges, up to one revolution (ticks)
+  uint32_t rev;                       // Sum of periods (ticks)
+  uint8_t index;                      // Next period to replace
+  uint8_t valid;                      // Number of periods measured, up to edges_per_rev
+  bool running;                       // An edge has been seen since start or the last stall
+  uint32_t rpm;                       // RPM over the last revolution, 0 when stalled
+  uint32_t filtered;                  // Filtered RPM (8 fraction bits), 0 when stalled
+} tacho_t;
+
+// Set up tachometer, starts stalled
+//   ticks_per_second - timestamp clock (Hz)
+//   edges_per_rev    - edges per revolution, 2 for rising edges of most fans
+//   filter_shift     - filter strength, 0 for none
+//   rpm_min, rpm_max - range of RPM measured, slower is a stall, faster is noise
+void tacho_init(tacho_t *tacho, uint32_t ticks_per_second, uint8_t edges_per_rev, uint8_t filter_shift, uint32_t rpm_min, uint32_t rpm_max);
+
+// Add an edge at timestamp ticks, returns true when the RPM is updated
+bool tacho_edge(tacho_t *tacho, uint32_t ticks);
+
+// Check for a stall at timestamp ticks, returns true when the RPM drops to 0
+bool tacho_check(tacho_t *tacho, uint32_t ticks);
+
+// Filtered RPM, rounded
+uint32_t tacho_rpm(const tacho_t *tacho);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TACHO_H
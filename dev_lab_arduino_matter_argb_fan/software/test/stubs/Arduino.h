@@ -0,0 +1,34 @@
+// Host test stub of the Arduino core
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "em_gpio.h"
+
+typedef uint8_t PinName;
+
+// Time, moved on by the Wire stub as bytes are sent
+inline uint32_t &micros_stub() {
+  static uint32_t now = 0;
+  return now;
+}
+
+inline uint32_t micros() {
+  return micros_stub();
+}
+
+inline PinName pinToPinName(uint8_t pin) {
+  return pin;
+}
+
+inline GPIO_Port_TypeDef getSilabsPortFromArduinoPin(PinName pin) {
+  return (GPIO_Port_TypeDef)(pin >> 4);
+}
+
+inline uint32_t getSilabsPinFromArduinoPin(PinName pin) {
+  return pin & 0xF;
+}
+
+#endif // ARDUINO_H
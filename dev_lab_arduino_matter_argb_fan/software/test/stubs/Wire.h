@@ -0,0 +1,71 @@
+// Host test stub of the Arduino I2C library
+//
+// Transmissions are decoded as an SH1107 display would, page and column
+// address commands then data written along the page, into display RAM for
+// the test to compare with the buffer.
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+#define WIRE_BUFFER_SIZE 32  // Bytes in one transmission, as the Wire buffer
+#define WIRE_BYTE_MICROS 9   // Time to send a byte with its acknowledge at 1MHz
+
+class TwoWire {
+public:
+  uint8_t ram[16][128] = {};  // Display RAM
+  uint32_t bytes = 0;         // Bytes sent, including addresses
+  uint32_t transmissions = 0;
+  bool overflow = false;      // A transmission was longer than the Wire buffer
+
+  void setClock(uint32_t freq) {
+    (void)freq;
+  }
+
+  void beginTransmission(uint8_t address) {
+    (void)address;
+    length = 0;
+  }
+
+  size_t write(uint8_t data) {
+    if (length >= WIRE_BUFFER_SIZE) {
+      overflow = true;
+      return 0;
+    }
+    buffer[length++] = data;
+    return 1;
+  }
+
+  size_t write(const uint8_t *data, size_t count) {
+    for (size_t i = 0; i < count; i++) write(data[i]);
+    return count;
+  }
+
+  uint8_t endTransmission() {
+    transmissions++;
+    bytes += length + 1;
+    micros_stub() += (length + 1) * WIRE_BYTE_MICROS;
+    if (length == 0) return 0;
+    if (buffer[0] == 0x00) {
+      // Commands
+      for (uint8_t i = 1; i < length; i++) {
+        uint8_t command = buffer[i];
+        if ((command & 0xF0) == 0xB0) page = command & 0x0F;
+        else if ((command & 0xF0) == 0x10) column = (column & 0x0F) | ((command & 0x0F) << 4);
+        else if ((command & 0xF0) == 0x00) column = (column & 0xF0) | (command & 0x0F);
+      }
+    } else {
+      // Data along the page
+      for (uint8_t i = 1; i < length; i++) ram[page][column++ & 0x7F] = buffer[i];
+    }
+    return 0;
+  }
+
+private:
+  uint8_t buffer[WIRE_BUFFER_SIZE];
+  uint8_t length = 0;
+  uint8_t page = 0;
+  uint8_t column = 0;
+};
+
+#endif // WIRE_H
@@ -0,0 +1,33 @@
+// Host test stub of the Gecko SDK core interrupt functions
+//
+// Leaving an atomic section calls the test's interrupt, if it has set one,
+// as a pending interrupt would run on the board when interrupts are enabled.
+#ifndef EM_CORE_H
+#define EM_CORE_H
+
+typedef struct {
+  int depth;            // Atomic sections entered and not left
+  void (*interrupt)();  // Called when the last atomic section is left
+} core_stub_t;
+
+inline core_stub_t *core_stub() {
+  static core_stub_t stub;
+  return &stub;
+}
+
+inline void core_stub_exit() {
+  core_stub_t *stub = core_stub();
+  if (--stub->depth == 0 && stub->interrupt) {
+    // Interrupts do not nest
+    void (*interrupt)() = stub->interrupt;
+    stub->interrupt = nullptr;
+    interrupt();
+    stub->interrupt = interrupt;
+  }
+}
+
+#define CORE_DECLARE_IRQ_STATE int core_irq_state = 0
+#define CORE_ENTER_ATOMIC() ((void)core_irq_state, core_stub()->depth++)
+#define CORE_EXIT_ATOMIC() core_stub_exit()
+
+#endif // EM_CORE_H
@@ -0,0 +1,44 @@
+// Host test stub of the Gecko SDK GPIO driver
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdint.h>
+
+typedef enum {
+  gpioPortA,
+  gpioPortB,
+  gpioPortC,
+  gpioPortD
+} GPIO_Port_TypeDef;
+
+typedef enum {
+  gpioModePushPull
+} GPIO_Mode_TypeDef;
+
+typedef struct {
+  uint32_t ROUTEEN;
+  uint32_t TXROUTE;
+} GPIO_USARTROUTE_TypeDef;
+
+typedef struct {
+  GPIO_USARTROUTE_TypeDef USARTROUTE[1];
+} GPIO_TypeDef;
+
+inline GPIO_TypeDef *gpio_stub() {
+  static GPIO_TypeDef gpio;
+  return &gpio;
+}
+
+#define GPIO gpio_stub()
+#define _GPIO_USART_TXROUTE_PORT_SHIFT 0
+#define _GPIO_USART_TXROUTE_PIN_SHIFT 16
+#define GPIO_USART_ROUTEEN_TXPEN 0x8
+
+inline void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out) {
+  (void)port;
+  (void)pin;
+  (void)mode;
+  (void)out;
+}
+
+#endif // EM_GPIO_H
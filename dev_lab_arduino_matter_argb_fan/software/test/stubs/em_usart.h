@@ -0,0 +1,41 @@
+// Host test stub of the Gecko SDK USART driver
+#ifndef EM_USART_H
+#define EM_USART_H
+
+#include <stdint.h>
+
+typedef enum {
+  usartDisable,
+  usartEnableTx
+} USART_Enable_TypeDef;
+
+typedef struct {
+  USART_Enable_TypeDef enable;
+  uint32_t baudrate;
+  bool msbf;
+} USART_InitSync_TypeDef;
+
+typedef struct {
+  uint32_t TXDATA;
+} USART_TypeDef;
+
+#define USART_INITSYNC_DEFAULT { usartEnableTx, 1000000, false }
+
+inline USART_TypeDef *usart_stub() {
+  static USART_TypeDef usart;
+  return &usart;
+}
+
+#define USART0 usart_stub()
+
+inline void USART_InitSync(USART_TypeDef *usart, const USART_InitSync_TypeDef *init) {
+  (void)usart;
+  (void)init;
+}
+
+inline void USART_Enable(USART_TypeDef *usart, USART_Enable_TypeDef enable) {
+  (void)usart;
+  (void)enable;
+}
+
+#endif // EM_USART_H
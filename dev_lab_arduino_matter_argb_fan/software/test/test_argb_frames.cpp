@@ -0,0 +1,161 @@
+// Host test of the ARGB frame pool
+//
+// Runs the real argb_frames.cpp against stub Gecko SDK drivers. Encoded frames
+// are decoded back into colors from the bytes handed to LDMA. The tacho
+// interrupt is simulated as each atomic section is left, the bytes of a frame
+// being transmitted must not change while another frame is encoded or while
+// encoding waits for it, and a frame being encoded must not be sent.
+#include "argb_frames.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <Arduino.h>
+#include "em_core.h"
+#include "dmadrv.h"
+
+#define PIXEL_BYTES 9   // Encoded bytes per pixel
+#define RESET_BYTES 90  // Encoded bytes of the reset period
+#define WAIT_INTERRUPTS 3  // Interrupts before the frame being transmitted completes
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next() {
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+static void random_colors(uint32_t *colors, uint16_t count) {
+  for (uint16_t p = 0; p < count; p++) colors[p] = random_next() & 0xFFFFFF;
+}
+
+// Decode the last transfer, each WS2812 bit is 3 USART bits, 110 for 1 and 100 for 0, returns false if it is not a valid frame
+static bool sent(const uint32_t *colors, uint16_t count) {
+  const uint8_t *src = dmadrv_stub()->src;
+  if (dmadrv_stub()->len != count * PIXEL_BYTES + RESET_BYTES) return false;
+  for (uint16_t p = 0; p < count; p++) {
+    uint32_t color = 0;
+    for (uint8_t bit = 0; bit < 24; bit++) {
+      uint8_t symbol = 0;
+      for (uint8_t b = 0; b < 3; b++) {
+        uint16_t at = (p * 24 + bit) * 3 + b;
+        symbol = (symbol << 1) | ((src[at / 8] >> (7 - at % 8)) & 1);
+      }
+      if (symbol != 0b110 && symbol != 0b100) return false;
+      color = (color << 1) | (symbol == 0b110);
+    }
+    if (color != colors[p]) return false;
+  }
+  for (uint16_t i = 0; i < RESET_BYTES; i++) {
+    if (src[count * PIXEL_BYTES + i] != 0) return false;
+  }
+  return true;
+}
+
+// Frames decode to the colors encoded
+static void test_encode() {
+  uint32_t colors[ARGB_FRAMES_PIXEL_MAX + 4];
+  dmadrv_stub()->complete = true;
+  for (uint8_t f = 0; f < ARGB_FRAMES_MAX; f++) {
+    uint16_t count = (f == 0) ? ARGB_FRAMES_PIXEL_MAX + 4 : random_next() % (ARGB_FRAMES_PIXEL_MAX + 1);
+    random_colors(colors, count);
+    argb_frames_encode(f, colors, count);
+    CHECK(argb_frames_send(f));
+    // Frames are cut to the pool's pixels
+    CHECK(sent(colors, (count > ARGB_FRAMES_PIXEL_MAX) ? ARGB_FRAMES_PIXEL_MAX : count));
+  }
+  CHECK(!argb_frames_busy());
+  // Frames outside the pool are ignored
+  unsigned int transfers = dmadrv_stub()->transfers;
+  argb_frames_encode(ARGB_FRAMES_MAX, colors, 1);
+  CHECK(!argb_frames_send(ARGB_FRAMES_MAX));
+  CHECK(dmadrv_stub()->transfers == transfers);
+  // Transfer failing to start releases the USART
+  dmadrv_stub()->transfer_result = ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  CHECK(!argb_frames_send(0));
+  CHECK(!argb_frames_busy());
+  dmadrv_stub()->transfer_result = ECODE_EMDRV_DMADRV_OK;
+  dmadrv_stub()->complete = false;
+}
+
+// Simulated interrupts, what they saw and did
+static uint32_t sending_colors[ARGB_FRAMES_PIXEL_MAX];  // Colors of the frame being transmitted
+static uint8_t interrupt_frame;                         // Frame the tacho interrupt sends
+static int interrupts;
+static int intact;     // Interrupts that found the frame being transmitted unchanged
+static int sends;      // Sends tried by the tacho interrupt
+static int refused;    // Sends refused
+static uint8_t last_sent;
+
+// LDMA completes after a few interrupts, the tacho interrupt sends when LDMA is idle
+static void interrupt() {
+  interrupts++;
+  if (dmadrv_stub()->callback) {
+    intact += sent(sending_colors, ARGB_FRAMES_PIXEL_MAX) ? 1 : 0;
+    if (interrupts >= WAIT_INTERRUPTS) dmadrv_stub_complete();
+  } else {
+    sends++;
+    if (argb_frames_send(interrupt_frame)) last_sent = interrupt_frame;
+    else refused++;
+  }
+}
+
+static void start_interrupts(uint8_t frame) {
+  interrupt_frame = frame;
+  interrupts = intact = sends = refused = 0;
+  core_stub()->interrupt = interrupt;
+}
+
+// Encoding waits for the frame being transmitted and holds off sending it
+static void test_in_flight() {
+  uint32_t colors[ARGB_FRAMES_PIXEL_MAX];
+  random_colors(sending_colors, ARGB_FRAMES_PIXEL_MAX);
+  argb_frames_encode(0, sending_colors, ARGB_FRAMES_PIXEL_MAX);
+  CHECK(argb_frames_send(0));
+  CHECK(argb_frames_busy());
+  // Other frames are encoded while frame 0 is transmitted
+  start_interrupts(1);
+  random_colors(colors, ARGB_FRAMES_PIXEL_MAX);
+  argb_frames_encode(1, colors, ARGB_FRAMES_PIXEL_MAX);
+  printf("other frame: %d interrupts, %d found the frame being sent intact\n", interrupts, intact);
+  CHECK(interrupts == 2);
+  CHECK(intact == 2);
+  CHECK(argb_frames_busy());
+  // Frame 0 is rewritten once its transfer completes, with the tacho interrupt
+  // trying to send it as soon as LDMA is idle
+  start_interrupts(0);
+  random_colors(colors, ARGB_FRAMES_PIXEL_MAX);
+  argb_frames_encode(0, colors, ARGB_FRAMES_PIXEL_MAX);
+  printf("same frame: %d interrupts, %d found it intact, %d of %d sends refused\n", interrupts, intact, refused, sends);
+  CHECK(intact == WAIT_INTERRUPTS);
+  // Refused while encoded, sent once encoded
+  CHECK(sends == 2);
+  CHECK(refused == 1);
+  CHECK(last_sent == 0);
+  CHECK(sent(colors, ARGB_FRAMES_PIXEL_MAX));
+  // Other frames are sent while a frame is encoded
+  dmadrv_stub_complete();
+  start_interrupts(2);
+  argb_frames_encode(3, colors, ARGB_FRAMES_PIXEL_MAX);
+  CHECK(refused == 0);
+  CHECK(last_sent == 2);
+  core_stub()->interrupt = nullptr;
+  dmadrv_stub_complete();
+}
+
+int main() {
+  CHECK(argb_frames_begin(0x10));
+  test_encode();
+  test_in_flight();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+// Host test of the fan speed control
+//
+// Checks the curve helpers, then closes the loop around a simulated fan: a
+// first order lag behind a duty to RPM curve, measured by tacho.c from
+// jittered edges. The curve is calibrated at full supply voltage and the
+// PID must reach each target within 2% in SETTLE_MAX_MS and overshoot by
+// at most 2%, at full supply and at 85% of it.
+#include "fan_control.h"
+#include "tacho.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DUTY_MIN 160           // As ANALOG_WRITE_FAN_MIN
+#define DUTY_MAX 1023          // As ANALOG_WRITE_FAN_MAX
+#define PID_PERIOD 100         // As FAN_PID_PERIOD (ms)
+#define PID_KP 13107           // As FAN_PID_KP
+#define PID_KI 3277            // As FAN_PID_KI
+#define PID_KD 0               // As FAN_PID_KD
+#define PID_SLEW 100           // As FAN_PID_SLEW
+#define FAN_TAU 1.2            // Fan time constant (s)
+#define STEP_US 100            // Simulation step (us)
+#define SETTLE_MAX_MS 5000     // Longest time to settle within 2%
+#define OVERSHOOT_MAX 20       // Most overshoot (permille)
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Simulated fan
+typedef struct fan {
+  double supply;  // Supply voltage as a fraction of the calibration supply
+  double rpm;     // Actual RPM
+  double revs;    // Revolutions turned
+  int32_t duty;   // PWM duty
+  uint32_t us;    // Time
+  uint32_t seed;  // Edge jitter
+  tacho_t tacho;
+} fan_t;
+
+// RPM the fan settles at for a duty, stopped below the lowest duty
+static double fan_steady(const fan_t *fan) {
+  if (fan->duty < DUTY_MIN) return 0;
+  return fan->supply * (400 + 1400 * pow((fan->duty - DUTY_MIN) / (double)(DUTY_MAX - DUTY_MIN), 0.7));
+}
+
+// Run the fan for a millisecond, two tacho edges each revolution
+static void fan_run(fan_t *fan) {
+  for (int i = 0; i < 1000 / STEP_US; i++) {
+    double edges = fan->revs * 2;
+    fan->rpm += (fan_steady(fan) - fan->rpm) * (STEP_US / 1e6 / FAN_TAU);
+    fan->revs += fan->rpm / 60 * (STEP_US / 1e6);
+    fan->us += STEP_US;
+    if (floor(fan->revs * 2) != floor(edges)) {
+      fan->seed = fan->seed * 1103515245 + 12345;
+      tacho_edge(&fan->tacho, fan->us + (fan->seed >> 16) % 20);
+    }
+  }
+  tacho_check(&fan->tacho, fan->us);
+}
+
+static void fan_init(fan_t *fan, double supply) {
+  fan->supply = supply;
+  fan->rpm = 0;
+  fan->revs = 0;
+  fan->duty = DUTY_MIN;
+  fan->us = 0;
+  fan->seed = 12345;
+  tacho_init(&fan->tacho, 1000000, 2, 2, 100, 10000);
+}
+
+// Step the duty up the range as fanCalibrate() does, waiting for each RPM to settle
+static void fan_calibrate(fan_t *fan, fan_curve_t *curve) {
+  curve->magic = FAN_CURVE_MAGIC;
+  curve->tau = (uint16_t)(FAN_TAU * 1000);
+  for (int i = 0; i < FAN_CURVE_POINTS; i++) {
+    fan->duty = DUTY_MIN + i * (DUTY_MAX - DUTY_MIN) / (FAN_CURVE_POINTS - 1);
+    for (int ms = 0; ms < 5000; ms++) fan_run(fan);
+    curve->duties[i] = (uint16_t)fan->duty;
+    curve->rpms[i] = (uint16_t)tacho_rpm(&fan->tacho);
+  }
+}
+
+// Curve checks and interpolation
+static void test_curve(void) {
+  fan_curve_t curve = { FAN_CURVE_MAGIC, { 160, 375, 591, 807, 1023 }, { 400, 900, 1250, 1550, 1800 }, 1200 };
+  CHECK(fan_curve_calibrated(&curve));
+  CHECK(fan_curve_valid(&curve));
+  CHECK(fan_curve_duty(&curve, 0) == 160);
+  CHECK(fan_curve_duty(&curve, 400) == 160);
+  CHECK(fan_curve_duty(&curve, 650) == 160 + (375 - 160) / 2);
+  CHECK(fan_curve_duty(&curve, 1250) == 591);
+  CHECK(fan_curve_duty(&curve, 5000) == 1023);
+  // A fan that did not turn is calibrated but not usable, so it is stored and runs open loop
+  fan_curve_t stopped = { FAN_CURVE_MAGIC, { 160, 375, 591, 807, 1023 }, { 0, 0, 0, 0, 0 }, 0 };
+  CHECK(fan_curve_calibrated(&stopped));
+  CHECK(!fan_curve_valid(&stopped));
+  // Falling RPMs are not usable either
+  curve.rpms[2] = 800;
+  CHECK(!fan_curve_valid(&curve));
+  curve.magic = 0;
+  CHECK(!fan_curve_calibrated(&curve));
+}
+
+// Targets across the curve at full and low supply voltage
+static void test_settling(void) {
+  static const double supplies[] = { 1.0, 0.85 };
+  static const int percents[] = { 50, 20, 80, 35 };
+  fan_curve_t curve;
+  fan_t fan;
+  fan_init(&fan, 1.0);
+  fan_calibrate(&fan, &curve);
+  CHECK(fan_curve_valid(&curve));
+  printf("curve:");
+  for (int i = 0; i < FAN_CURVE_POINTS; i++) printf(" %u@%u", curve.rpms[i], curve.duties[i]);
+  printf(", tau %u ms\n", curve.tau);
+
+  for (unsigned s = 0; s < sizeof(supplies) / sizeof(supplies[0]); s++) {
+    fan_pid_t pid;
+    fan.supply = supplies[s];
+    fan_pid_init(&pid, PID_KP, PID_KI, PID_KD, DUTY_MIN, DUTY_MAX, PID_SLEW, PID_PERIOD, curve.tau);
+    // Speed control starts from the duty and RPM now, later targets carry on from there
+    fan_pid_reset(&pid, fan.duty, tacho_rpm(&fan.tacho));
+    for (unsigned p = 0; p < sizeof(percents) / sizeof(percents[0]); p++) {
+      int32_t target = curve.rpms[0] + (curve.rpms[FAN_CURVE_POINTS - 1] - curve.rpms[0]) * percents[p] / 100;
+      double start = fan.rpm;
+      double peak = start, trough = start;
+      int settled = -1;
+      for (int ms = 0; ms < 3 * SETTLE_MAX_MS; ms++) {
+        if (ms % PID_PERIOD == 0) {
+          fan.duty = fan_pid_update(&pid, target, tacho_rpm(&fan.tacho), fan_curve_duty(&curve, target));
+        }
+        fan_run(&fan);
+        if (fan.rpm > peak) peak = fan.rpm;
+        if (fan.rpm < trough) trough = fan.rpm;
+        if (fabs(fan.rpm - target) > target * 0.02) settled = -1;
+        else if (settled < 0) settled = ms;
+      }
+      int overshoot = (int)(((target > start) ? peak - target : target - trough) * 1000 / target);
+      if (overshoot < 0) overshoot = 0;
+      printf("settle: supply %3d%%, %2d%% target %4d rpm, within 2%% after %4d ms, overshoot %d.%d%%, duty %4d\n",
+             (int)(fan.supply * 100), percents[p], target, settled, overshoot / 10, overshoot % 10, fan.duty);
+      CHECK(settled >= 0 && settled <= SETTLE_MAX_MS);
+      CHECK(overshoot <= OVERSHOOT_MAX);
+      CHECK(fabs(fan.rpm - target) <= target * 0.01);
+    }
+  }
+}
+
+int main(void) {
+  test_curve();
+  test_settling();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+// Host test of the OLED page updates
+//
+// Runs the real oled_pages.cpp against a Wire stub that decodes the SH1107
+// commands into display RAM. After random drawing, including drawing while
+// earlier changes are still being sent, the display must match the buffer,
+// with each pass of oled_pages_loop() close to its budget and far fewer
+// bytes sent than redrawing the whole display.
+#include "oled_pages.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BUFFER_SIZE (OLED_PAGES_WIDTH * OLED_PAGES_HEIGHT / 8)
+#define FULL_BYTES ((OLED_PAGES_HEIGHT / 8) * ((4 + 1) + (OLED_PAGES_WIDTH + 1 + 1)))  // Address and data for each page
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static uint8_t buffer[BUFFER_SIZE];
+
+// Display RAM matches the buffer
+static bool shown(const TwoWire *wire) {
+  return memcmp(buffer, wire->ram, BUFFER_SIZE) == 0;
+}
+
+// Nothing sent when nothing changed, single columns at the page ends
+static void test_edges() {
+  TwoWire wire;
+  memset(buffer, 0, sizeof(buffer));
+  oled_pages_begin(&wire, 0x3D, buffer);
+  CHECK(oled_pages_update() == 0);
+  CHECK(!oled_pages_busy());
+  CHECK(!oled_pages_loop());
+  CHECK(wire.transmissions == 0);
+  buffer[0] = 0x01;
+  buffer[OLED_PAGES_WIDTH - 1] = 0x80;
+  buffer[BUFFER_SIZE - 1] = 0xFF;
+  CHECK(oled_pages_update() == 2);
+  oled_pages_flush();
+  CHECK(shown(&wire));
+  CHECK(!wire.overflow);
+  // Columns 0 to 127 of page 0 change, sent in chunks that fit the Wire buffer
+  memset(buffer, 0x5A, OLED_PAGES_WIDTH);
+  CHECK(oled_pages_update() == 1);
+  oled_pages_flush();
+  CHECK(shown(&wire));
+  CHECK(!wire.overflow);
+}
+
+// Random drawing, some of it while changes are being sent
+static void test_random() {
+  TwoWire wire;
+  uint32_t seed = 12345;
+  uint32_t passes = 0, pass_max = 0;
+  memset(buffer, 0, sizeof(buffer));
+  oled_pages_begin(&wire, 0x3D, buffer);
+  for (int frame = 0; frame < 2000; frame++) {
+    // A few bytes, as text and bars change, and now and then a run along a page
+    seed = seed * 1103515245 + 12345;
+    for (uint32_t k = (seed >> 16) % 6; k > 0; k--) {
+      seed = seed * 1103515245 + 12345;
+      buffer[(seed >> 8) % BUFFER_SIZE] = seed >> 24;
+    }
+    if ((seed >> 20) % 4 == 0) {
+      seed = seed * 1103515245 + 12345;
+      memset(buffer + ((seed >> 8) % (OLED_PAGES_HEIGHT / 8)) * OLED_PAGES_WIDTH, seed >> 24, (seed >> 12) % OLED_PAGES_WIDTH);
+    }
+    oled_pages_update();
+    for (;;) {
+      uint32_t start = micros();
+      bool more = oled_pages_loop();
+      uint32_t pass = micros() - start;
+      passes++;
+      if (pass > pass_max) pass_max = pass;
+      if (!more) break;
+      // Drawing between passes is picked up by the next update
+      seed = seed * 1103515245 + 12345;
+      if ((seed >> 16) % 4 == 0) buffer[(seed >> 4) % BUFFER_SIZE] ^= 0xFF;
+    }
+    oled_pages_update();
+    oled_pages_flush();
+    if (!shown(&wire)) {
+      CHECK(shown(&wire));
+      break;
+    }
+  }
+  printf("random: 2000 frames, %u bytes sent (%u per frame, full redraw %u), %u passes, longest pass %u us\n",
+         wire.bytes, wire.bytes / 2000, FULL_BYTES, passes, pass_max);
+  CHECK(!wire.overflow);
+  CHECK(wire.bytes / 2000 < FULL_BYTES / 4);
+  // A pass stops once the budget is used, finishing the chunk it started
+  CHECK(pass_max <= OLED_PAGES_BUDGET + 2 * (OLED_PAGES_CHUNK + 6) * WIRE_BYTE_MICROS);
+}
+
+int main() {
+  test_edges();
+  test_random();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
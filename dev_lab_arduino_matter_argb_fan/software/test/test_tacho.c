@@ -0,0 +1,183 @@
+// Host test of the fan tachometer calculations
+//
+// Feeds tacho.c edges from a simulated fan with uneven edge spacing and
+// random jitter, starting just before the timestamps wrap. The RPM must
+// stay close to the true speed with no false stalls from tacho_check()
+// called between edges, and a stopped fan must be reported within one
+// revolution plus one check period of its last edge.
+#include "tacho.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TICKS_PER_SECOND 1000000  // As FAN_TACHO_FREQ
+#define EDGES_PER_REV 2           // Rising edges of a 4 wire fan
+#define FILTER_SHIFT 2            // As FAN_RPM_FILTER
+#define RPM_MIN 100               // As FAN_RPM_MIN
+#define RPM_MAX 10000             // As FAN_RPM_MAX
+#define CHECK_TICKS 1000          // tacho_check() period, the main loop checks every millisecond or so
+#define START_TICKS 0xFFF00000u   // First edge, the timestamps wrap a second later
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static uint32_t seed = 12345;
+
+// Random number from -1000 to 1000
+static int32_t random_permille(void) {
+  seed = seed * 1103515245 + 12345;
+  return (int32_t)((seed >> 16) % 2001) - 1000;
+}
+
+// Simulated fan, edges are split unevenly within each revolution and jitter
+typedef struct fan {
+  uint32_t rpm;
+  uint32_t jitter;   // Largest jitter of each edge (permille of its period)
+  uint32_t ticks;    // Timestamp of the last edge
+  uint32_t edge;     // Edges since start
+} fan_t;
+
+// Ticks to the next edge, the first edge of each revolution takes 45% of it
+static uint32_t fan_period(fan_t *fan) {
+  uint32_t rev = (uint32_t)(((uint64_t)TICKS_PER_SECOND * 60) / fan->rpm);
+  uint32_t period = (fan->edge % EDGES_PER_REV == 0) ? rev * 45 / 100 : rev - rev * 45 / 100;
+  return period + (int32_t)((int64_t)period * fan->jitter * random_permille() / 1000000);
+}
+
+// Run the fan for a number of edges, checking for stalls every CHECK_TICKS,
+// returns the number of false stalls
+static int fan_run(tacho_t *tacho, fan_t *fan, int edges, uint32_t *check) {
+  int stalls = 0;
+  for (int e = 0; e < edges; e++) {
+    uint32_t next = fan->ticks + fan_period(fan);
+    // Checks between edges, the timestamps wrap so compare signed
+    while ((int32_t)(next - *check) > 0) {
+      if (tacho_check(tacho, *check)) stalls++;
+      *check += CHECK_TICKS;
+    }
+    fan->ticks = next;
+    fan->edge++;
+    tacho_edge(tacho, next);
+  }
+  return stalls;
+}
+
+// Error of an RPM against the true speed (permille)
+static int32_t rpm_error(uint32_t rpm, uint32_t actual) {
+  return (int32_t)(((int64_t)rpm - actual) * 1000 / actual);
+}
+
+// Speeds across the range with uneven edges and jitter, then a speed change
+static void test_jitter(void) {
+  static const uint32_t speeds[] = { 300, 800, 1500, 3000, 5000 };
+  static const uint32_t jitters[] = { 0, 20, 50 };
+  for (unsigned s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++) {
+    for (unsigned j = 0; j < sizeof(jitters) / sizeof(jitters[0]); j++) {
+      tacho_t tacho;
+      fan_t fan = { speeds[s], jitters[j], START_TICKS, 0 };
+      uint32_t check = START_TICKS;
+      int32_t instant_max = 0, filtered_max = 0;
+      tacho_init(&tacho, TICKS_PER_SECOND, EDGES_PER_REV, FILTER_SHIFT, RPM_MIN, RPM_MAX);
+      tacho_edge(&tacho, fan.ticks);
+      // Settle, then measure the worst error over many revolutions
+      int stalls = fan_run(&tacho, &fan, 32, &check);
+      for (int e = 0; e < 2000; e++) {
+        stalls += fan_run(&tacho, &fan, 1, &check);
+        // Every edge gives the RPM over a whole revolution, so uneven edges cancel out
+        int32_t instant = abs(rpm_error(tacho.rpm, fan.rpm));
+        int32_t filtered = abs(rpm_error(tacho_rpm(&tacho), fan.rpm));
+        if (instant > instant_max) instant_max = instant;
+        if (filtered > filtered_max) filtered_max = filtered;
+      }
+      printf("jitter: %4u rpm, %2u%% jitter, error max instant %2d.%d%%, filtered %2d.%d%%\n",
+             fan.rpm, fan.jitter / 10, instant_max / 10, instant_max % 10, filtered_max / 10, filtered_max % 10);
+      CHECK(stalls == 0);
+      // Two jittered edges end each revolution measured, so the error is at most twice the jitter
+      CHECK(instant_max <= (int32_t)(fan.jitter * 2 + 2));
+      CHECK(filtered_max <= (int32_t)(fan.jitter + 2));
+      // The filter follows a change in speed within a few revolutions, staying under RPM_MAX with uneven edges
+      fan.rpm = fan.rpm * 3 / 2;
+      stalls = fan_run(&tacho, &fan, 8 * EDGES_PER_REV, &check);
+      CHECK(stalls == 0);
+      CHECK(abs(rpm_error(tacho_rpm(&tacho), fan.rpm)) <= (int32_t)(fan.jitter + 10));
+    }
+  }
+}
+
+// Edges closer than the fastest RPM allows are noise and ignored
+static void test_noise(void) {
+  tacho_t tacho;
+  fan_t fan = { 1200, 0, START_TICKS, 0 };
+  uint32_t check = START_TICKS;
+  tacho_init(&tacho, TICKS_PER_SECOND, EDGES_PER_REV, FILTER_SHIFT, RPM_MIN, RPM_MAX);
+  tacho_edge(&tacho, fan.ticks);
+  fan_run(&tacho, &fan, 16, &check);
+  uint32_t rpm = tacho.rpm;
+  CHECK(!tacho_edge(&tacho, fan.ticks + 100));
+  CHECK(tacho.rpm == rpm);
+  fan_run(&tacho, &fan, 1, &check);
+  CHECK(abs(rpm_error(tacho.rpm, fan.rpm)) <= 1);
+}
+
+// A fan that stops is reported within one revolution and a check period
+static void test_stall(void) {
+  static const uint32_t speeds[] = { RPM_MIN, 300, 1500, 6000 };
+  for (unsigned s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++) {
+    tacho_t tacho;
+    fan_t fan = { speeds[s], 20, START_TICKS, 0 };
+    uint32_t check = START_TICKS;
+    uint32_t rev = (uint32_t)(((uint64_t)TICKS_PER_SECOND * 60) / fan.rpm);
+    tacho_init(&tacho, TICKS_PER_SECOND, EDGES_PER_REV, FILTER_SHIFT, RPM_MIN, RPM_MAX);
+    tacho_edge(&tacho, fan.ticks);
+    CHECK(fan_run(&tacho, &fan, 16, &check) == 0);
+    // A check timestamped before the last edge, taken before the edge interrupt, is not a stall
+    CHECK(!tacho_check(&tacho, fan.ticks - CHECK_TICKS));
+    CHECK(tacho.rpm != 0);
+    // Fan stops after its last edge
+    uint32_t latency = 0;
+    bool stalled = false;
+    while (!stalled && latency <= 2 * rev + CHECK_TICKS) {
+      latency = check - fan.ticks;
+      stalled = tacho_check(&tacho, check);
+      check += CHECK_TICKS;
+    }
+    // Revolution measured with jitter, allow the jitter on top
+    uint32_t limit = rev + rev * 2 * fan.jitter / 1000 + CHECK_TICKS;
+    printf("stall: %4u rpm, revolution %6u us, reported %6u us after the last edge\n", fan.rpm, rev, latency);
+    CHECK(stalled);
+    CHECK(latency >= rev - rev * 2 * fan.jitter / 1000);
+    CHECK(latency <= limit);
+    CHECK(tacho.rpm == 0 && tacho_rpm(&tacho) == 0);
+    // Reported once, then measured again from the next two edges
+    CHECK(!tacho_check(&tacho, check));
+    fan.ticks = check;
+    CHECK(!tacho_edge(&tacho, fan.ticks));
+    fan_run(&tacho, &fan, 1, &check);
+    CHECK(tacho.rpm != 0);
+  }
+}
+
+// A fan that never turns is already stalled, so there is nothing to report
+static void test_never_started(void) {
+  tacho_t tacho;
+  tacho_init(&tacho, TICKS_PER_SECOND, EDGES_PER_REV, FILTER_SHIFT, RPM_MIN, RPM_MAX);
+  for (uint32_t t = 0; t < 10 * TICKS_PER_SECOND; t += CHECK_TICKS * 100) {
+    CHECK(!tacho_check(&tacho, START_TICKS + t));
+  }
+  CHECK(tacho_rpm(&tacho) == 0);
+}
+
+int main(void) {
+  test_jitter();
+  test_noise();
+  test_stall();
+  test_never_started();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
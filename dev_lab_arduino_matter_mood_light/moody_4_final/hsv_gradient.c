@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * HSV gradient conversion
+ *
+ * Conversion follows fast_hsv2rgb_32bit() from fast_hsv2rgb.h, but returns a
+ * packed color so the channel order is picked by sextant rather than by
+ * swapping pointers. Scaling works on green and blue together and then red,
+ * as each product fits in 16 bits.
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "hsv_gradient.h"
+#include "fast_hsv2rgb.h"
+
+#define HSV_GRADIENT_HUE_ONE ((int32_t)HSV_HUE_STEPS << 16)  // One turn of the color wheel (16.16 fixed point)
+
+// Convert one color, h in fast_hsv2rgb steps (0 to HSV_HUE_MAX)
+static inline uint32_t hsv_gradient_color(uint16_t h, uint8_t s, uint8_t v) {
+  uint32_t top, bottom, slope, ww, d;
+  uint8_t fraction = h & 0xFF;
+  // Grey ?
+  if (s == 0) return ((uint32_t)v << 16) | ((uint32_t)v << 8) | v;
+  // Top level
+  top = v;
+  // Bottom level, v * (1.0 - s)
+  ww = v * (255 - s) + 1;
+  ww += ww >> 8;
+  bottom = ww >> 8;
+  // Slope up or down through the sextant
+  if (!((h >> 8) & 1)) d = v * ((255 << 8) - s * (256 - fraction));
+  else d = v * ((255 << 8) - s * fraction);
+  d += d >> 8;
+  d += v;
+  slope = d >> 16;
+  // Pack green, red, blue for the sextant
+  switch (h >> 8) {
+    case 0: return (slope << 16) | (top << 8) | bottom;
+    case 1: return (top << 16) | (slope << 8) | bottom;
+    case 2: return (top << 16) | (bottom << 8) | slope;
+    case 3: return (slope << 16) | (bottom << 8) | top;
+    case 4: return (bottom << 16) | (slope << 8) | top;
+    default: return (bottom << 16) | (top << 8) | slope;
+  }
+}
+
+// Fill colors with a gradient from h0, s0, v0 to h1, s1, v1 inclusive
+void hsv_gradient(uint16_t h0, uint8_t s0, uint8_t v0, uint16_t h1, uint8_t s1, uint8_t v1, uint32_t *colors, uint16_t count) {
+  hsv_gradient_part(h0, s0, v0, h1, s1, v1, colors, count, 0, count);
+}
+
+// Fill part of a gradient, colors first to first + length - 1 of count
+void hsv_gradient_part(uint16_t h0, uint8_t s0, uint8_t v0, uint16_t h1, uint8_t s1, uint8_t v1, uint32_t *colors, uint16_t count,
+                       uint16_t first, uint16_t length) {
+  int32_t steps = (count > 1) ? count - 1 : 1;
+  // Start and step for each channel (16.16 fixed point), rounded so the last color lands on h1, s1, v1
+  int32_t hue = (int32_t)(((int64_t)(h0 % 360) * HSV_GRADIENT_HUE_ONE) / 360) + 0x8000;
+  int32_t hue_step = (int32_t)((((int64_t)h1 - h0) * HSV_GRADIENT_HUE_ONE) / 360 / steps);
+  int32_t sat = ((int32_t)s0 << 16) + 0x8000;
+  int32_t sat_step = ((int32_t)s1 - s0) * 0x10000 / steps;
+  int32_t val = ((int32_t)v0 << 16) + 0x8000;
+  int32_t val_step = ((int32_t)v1 - v0) * 0x10000 / steps;
+  uint16_t end = (first + length > count) ? count : first + length;
+  // Skip to first color, the same as stepping there one color at a time
+  if (first > 0) {
+    hue = (int32_t)(((int64_t)hue + (int64_t)hue_step * first) % HSV_GRADIENT_HUE_ONE);
+    if (hue < 0) hue += HSV_GRADIENT_HUE_ONE;
+    sat += sat_step * first;
+    val += val_step * first;
+  }
+  for (uint16_t i = first; i < end; i++) {
+    colors[i] = hsv_gradient_color(hue >> 16, sat >> 16, val >> 16);
+    // Step, keeping hue on the color wheel
+    hue += hue_step;
+    if (hue >= HSV_GRADIENT_HUE_ONE) hue -= HSV_GRADIENT_HUE_ONE;
+    else if (hue < 0) hue += HSV_GRADIENT_HUE_ONE;
+    sat += sat_step;
+    val += val_step;
+  }
+}
+
+// Scale colors converted at full value by a value gradient from v0 to v1 inclusive
+void hsv_gradient_scale(const uint32_t *fulls, uint8_t v0, uint8_t v1, uint32_t *colors, uint16_t count) {
+  hsv_gradient_scale_part(fulls, v0, v1, colors, count, 0, count);
+}
+
+// Scale part of a gradient, colors first to first + length - 1 of count
+void hsv_gradient_scale_part(const uint32_t *fulls, uint8_t v0, uint8_t v1, uint32_t *colors, uint16_t count, uint16_t first, uint16_t length) {
+  int32_t steps = (count > 1) ? count - 1 : 1;
+  int32_t val_step = ((int32_t)v1 - v0) * 0x10000 / steps;
+  int32_t val = ((int32_t)v0 << 16) + 0x8000 + val_step * first;
+  uint16_t end = (first + length > count) ? count : first + length;
+  uint32_t v, gb, r;
+  for (uint16_t i = first; i < end; i++) {
+    v = val >> 16;
+    // Multiply, then divide by 255 as (x + (x >> 8) + 1) >> 8
+    gb = (fulls[i] & 0xFF00FF) * v;
+    gb = ((gb + ((gb >> 8) & 0xFF00FF) + 0x10001) >> 8) & 0xFF00FF;
+    r = ((fulls[i] >> 8) & 0xFF) * v;
+    r = (r + (r >> 8) + 1) >> 8;
+    colors[i] = gb | (r << 8);
+    val += val_step;
+  }
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * HSV gradient conversion
+ *
+ * Converts a whole gradient from HSV to packed RGB colors in one call using
+ * the same arithmetic as fast_hsv2rgb_32bit(). Hue, saturation and value are
+ * stepped along the gradient in fixed point, so there is no map() or modulo
+ * for each color.
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef HSV_GRADIENT_H
+#define HSV_GRADIENT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fill colors with a gradient from h0, s0, v0 to h1, s1, v1 inclusive
+//   h0, h1   - hues in degrees, may go above 359 to cross red
+//   s0, s1   - saturations (0-255)
+//   v0, v1   - values (0-255)
+//   colors   - packed colors, green << 16 | red << 8 | blue as sent to WS2812
+//   count    - number of colors
+void hsv_gradient(uint16_t h0, uint8_t s0, uint8_t v0, uint16_t h1, uint8_t s1, uint8_t v1, uint32_t *colors, uint16_t count);
+
+// Fill part of a gradient, colors first to first + length - 1 of count, so
+// long gradients can be built in slices, matches hsv_gradient() exactly
+void hsv_gradient_part(uint16_t h0, uint8_t s0, uint8_t v0, uint16_t h1, uint8_t s1, uint8_t v1, uint32_t *colors, uint16_t count,
+                       uint16_t first, uint16_t length);
+
+// Scale colors converted at full value by a value gradient from v0 to v1
+// inclusive, much cheaper than converting again when only values change
+//   fulls    - packed colors from hsv_gradient() with v0 and v1 of 255
+//   v0, v1   - values (0-255)
+//   colors   - scaled packed colors, may be the same array as fulls
+//   count    - number of colors
+void hsv_gradient_scale(const uint32_t *fulls, uint8_t v0, uint8_t v1, uint32_t *colors, uint16_t count);
+
+// Scale part of a gradient, colors first to first + length - 1 of count
+void hsv_gradient_scale_part(const uint32_t *fulls, uint8_t v0, uint8_t v1, uint32_t *colors, uint16_t count, uint16_t first, uint16_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HSV_GRADIENT_H
@@ -8,13 +8,22 @@
  * Sets up a Matter device with two color bulb endpoints each of which can be 
  * set independently
  *
- * - Uses a more subtle noise image
+ * - Generates ridged noise as needed instead of storing a noise image, so
+ *   noise animations never repeat
+ * - Animations move by fractions of a step, interpolating between noise
+ *   values and gradient colors, then frames are blended, gamma corrected and
+ *   dithered at a higher rate so they stay smooth at a low frame rate
+ * - Pixels are split into segments in segments[], each with its own bulbs,
+ *   mode and frame period, BULB_COUNT bulb endpoints can be shared by them
+ * - loop() runs one task each call, frame output first, tracking each task's
+ *   worst case execution time and missed deadlines, gradients are rebuilt in
+ *   slices between frames, send 's' over serial for stats or 'r' to reset them
  * - Setting WAIT_ONLINE to false allows mood light to run without waiting to 
  *   get into network
  * - Holding button 0 down for 5 seconds during startup to factory reset, LEDs
  *   are dim red while timing
  *
- * Button 0 cycles through display modes: 
+ * Button 0 cycles all segments through display modes: 
  * 0 - Solid color from bulb 0
  * 1 - Solid color from bulb 1
  * 2 - Animated color gradient, short path round color wheel
@@ -66,25 +75,31 @@
 // Library includes
 #include <Matter.h>
 #include <MatterLightbulb.h>
-#include <ezWS2812.h>
 
 // Application includes
 #include "fast_hsv2rgb.h"  // https://www.vagrearg.org/content/hsvrgb
-//#include "noise.h"         // https://auburn.github.io/FastNoiseLite + https://notisrac.github.io/FileToCArray
-#include "noise_subtle.h"  // https://auburn.github.io/FastNoiseLite + https://notisrac.github.io/FileToCArray
+#include "hsv_gradient.h"  // Whole gradient HSV to RGB conversion
+#include "noise_gen.h"     // Fixed point version of https://auburn.github.io/FastNoiseLite
+#include "noise_unpack.h"  // Decoder for noise images packed by pack_noise.py
+#include "ws2812.h"        // WS2812 output using USART and LDMA
 
 // Defines
 #define WAIT_ONLINE true               // Wait for device to come online before running
 #define FACTORY_RESET_PERIOD 5000      // Time button must be held on startup to factory reset (ms)
 #define BULB_BOOST_SATURATION 0        // Boost saturation 0-255, in Google Home the edge of the color wheel is only 80% saturated a value of 51 (20%) here will boost to full saturation
-#define BULB_COUNT 2                   // Number of bulb endpoints
-#define PIXEL_COUNT 80                 // Number of WS2812 RGB LEDs, adjust as required
+#define BULB_COUNT 2                   // Number of bulb endpoints (up to BULB_COUNT_MAX)
+#define BULB_COUNT_MAX 8               // Maximum number of bulb endpoints
+#define BULB_EVENT_COUNT 8             // Size of bulb change event queue, must be a power of 2
+#define PIXEL_COUNT 80                 // Number of WS2812 RGB LEDs in the chain, adjust as required (up to WS2812_PIXEL_MAX)
+#define SEGMENT_COUNT 1                // Number of pixel segments, set up in segments[]
+#define PIXEL_PIN PIN_SPI_MOSI         // Pin for WS2812 RGB LEDs
 #define GRADIENT_COUNT 256             // Size of gradient
+#define GRADIENT_SLICE 64              // Gradient colors built each time gradients are rebuilt between frames
 #define LED_MODE_PIN LED_BUILTIN       // Pin for mode LED
 #define BTN_MODE_PIN BTN_BUILTIN       // Pin for mode button
 #define BTN_ACTIVE LOW                 // State of button when pressed
-#define PIXEL_MODE_SOLID_0 0           // Solid color 0
-#define PIXEL_MODE_SOLID_1 1           // Solid color 1
+#define PIXEL_MODE_SOLID_0 0           // Solid color from segment's bulb 0
+#define PIXEL_MODE_SOLID_1 1           // Solid color from segment's bulb 1
 #define PIXEL_MODE_GRADIENT_SHORT 2    // Gradient short path round the color wheel
 #define PIXEL_MODE_GRADIENT_LONG 3     // Gradient long path round the color wheel
 #define PIXEL_MODE_NOISE_SLOW_SHORT 4  // Noise short path round the color wheel
@@ -92,64 +107,209 @@
 #define PIXEL_MODE_NOISE_FAST_SHORT 6  // Noise short path round the color wheel
 #define PIXEL_MODE_NOISE_FAST_LONG 7   // Noise long path round the color wheel
 #define PIXEL_MODE_COUNT 8             // Number of modes
+#define COLOR_GRB(r, g, b) (((uint32_t)(g) << 16) | ((uint32_t)(r) << 8) | (uint32_t)(b))  // Pack color in WS2812 order
+#define COLOR_R(c) (((c) >> 8) & 0xFF)   // Red from packed color
+#define COLOR_G(c) (((c) >> 16) & 0xFF)  // Green from packed color
+#define COLOR_B(c) ((c) & 0xFF)          // Blue from packed color
+#define NOISE_PACKED false             // Use packed noise image instead of generating noise
+#define NOISE_SEED 1337                // Noise seed, change for a different noise field
+#define NOISE_SCALE 200                // Noise feature size in pixels
+#define NOISE_OCTAVES 2                // Noise fractal octaves
+#define NOISE_BLACK -600               // Noise black point (1/1000ths)
+#define NOISE_WHITE 700                // Noise white point (1/1000ths)
+#define PIXEL_SPEED 25                 // Animation speed (steps per second)
+#define PIXEL_ELAPSED_MAX 1000         // Longest time animated in one frame (ms)
+#define PIXEL_GAMMA 2.2f               // Gamma correction for pixels, 1.0 for none
+#define FADE_FRAMES 2                  // Frames to fade from old to new colors when bulbs change
+#define DITHER_PERIOD 20               // Dither update period, frames are blended and written to pixels (ms)
+#define DIO_PERIOD 100                 // Period to poll, update digital IOs (ms)
+#define TASK_DITHER 0                  // Task, blend frames and write dithered colors to pixels
+#define TASK_BULBS 1                   // Task, read bulb events and start gradient rebuilds
+#define TASK_DIO 2                     // Task, read button and update LED
+#define TASK_STATS 3                   // Task, write task stats requested over serial
+#define TASK_GRADIENTS 4               // Task, build a slice of gradients when it fits before the next dither update
+#define TASK_SEGMENTS 5                // Task, render segment frames, one task for each segment
+#define TASK_COUNT (TASK_SEGMENTS + SEGMENT_COUNT)  // Number of tasks
+#define LOG_NONE 0                     // Log level, nothing
+#define LOG_INFO 1                     // Log level, start up and commissioning
+#define LOG_DEBUG 2                    // Log level, also bulb, gradient and mode changes
+#define LOG_LEVEL LOG_INFO             // Serial output, debug output slows updates
+
+// Logging, compiled out when above LOG_LEVEL
+#if LOG_LEVEL >= LOG_INFO
+#define INFO_PRINTF(...) Serial.printf(__VA_ARGS__)
+#else
+#define INFO_PRINTF(...)
+#endif
+#if LOG_LEVEL >= LOG_DEBUG
+#define DEBUG_PRINTF(...) Serial.printf(__VA_ARGS__)
+#else
+#define DEBUG_PRINTF(...)
+#endif
+
+// Noise image
+#if NOISE_PACKED
+#include "noise_subtle_packed.h"  // python3 pack_noise.py noise_subtle.h noise_subtle_packed.h
+#endif
 
 // General data
 uint32_t now_millis;  // For timers
 
 // Digital IO data
-uint16_t dio_period = 100;  // Period to poll, update digital IOs
-uint32_t dio_millis;        // Timer for digital IO
-uint16_t led_bit = 0b1;     // Bit for LED flashing
-bool btn_state;             // Button state
-
-// Matter bulb data
-MatterColorLightbulb bulbs[BULB_COUNT];         // Matter color bulb objects
-bool bulb_states[BULB_COUNT] = { true, true };  // Bulb states off/on
-uint16_t bulb_hues[BULB_COUNT] = { 240, 300 };  // Bulb hues, blue, magenta (0-359)
-uint8_t bulb_sats[BULB_COUNT] = { 254, 254 };   // Bulb saturations (1-254)
-uint8_t bulb_vals[BULB_COUNT] = { 254, 254 };   // Bulb values/brightness (1-254)
-uint8_t bulb_reds[BULB_COUNT];                  // Bulb red values
-uint8_t bulb_greens[BULB_COUNT];                // Bulb green values
-uint8_t bulb_blues[BULB_COUNT];                 // Bulb blue values
-uint32_t bulb_period = 100;                     // Bulb monitoring period
-uint32_t bulb_millis;                           // Bulb monitoring timer
-
-// Gradient data
-uint8_t gradient_short_reds[GRADIENT_COUNT];    // Short gradient red values
-uint8_t gradient_short_greens[GRADIENT_COUNT];  // Short gradient green values
-uint8_t gradient_short_blues[GRADIENT_COUNT];   // Short gradient blue values
-uint8_t gradient_long_reds[GRADIENT_COUNT];     // Long gradient red values
-uint8_t gradient_long_greens[GRADIENT_COUNT];   // Long gradient green values
-uint8_t gradient_long_blues[GRADIENT_COUNT];    // Long gradient blue values
-uint16_t gradient_index = 0;                    // Gradient index for animation
-bool gradient_sub = false;                      // Gradient animation index direction
-
-// Noise data
-uint32_t noise_row = 0;      // Noise row for animation
-uint32_t noise_col = 0;      // Noise column for animation
-bool noise_row_sub = false;  // Noise row animation direction
-bool noise_col_sub = false;  // Noise column animation direction
+uint16_t led_bit = 0b1;  // Bit for LED flashing
+bool btn_state;          // Button state
+
+// Matter bulb data, defaults set in setup()
+MatterColorLightbulb bulbs[BULB_COUNT];  // Matter color bulb objects
+bool bulb_states[BULB_COUNT];            // Bulb states off/on
+uint16_t bulb_hues[BULB_COUNT];          // Bulb hues, blue, magenta then round the color wheel (0-359)
+uint8_t bulb_sats[BULB_COUNT];           // Bulb saturations (1-254)
+uint8_t bulb_vals[BULB_COUNT];           // Bulb values/brightness (1-254)
+uint32_t bulb_colors[BULB_COUNT];        // Bulb colors, packed
+
+// Bulb event data, queued by Matter callbacks and read in loop(), one writer and one reader so no locks are needed
+volatile uint8_t bulb_event_bulbs[BULB_EVENT_COUNT];    // Bulb changed for each event
+volatile uint32_t bulb_event_micros[BULB_EVENT_COUNT];  // Time of each event
+volatile uint8_t bulb_event_head = 0;                   // Count of events written, only changed by callbacks
+volatile uint8_t bulb_event_tail = 0;                   // Count of events read, only changed by loop()
+volatile bool bulb_event_overflow = false;              // Queue was full, read all bulbs
+
+// Latency data, from bulb event to first pixels showing the change
+uint32_t latency_micros;                  // Time of first event not yet shown
+bool latency_pending = false;             // Change waiting to be rendered
+struct segment *latency_segment = NULL;   // Segment rendered with change, waiting to be written to pixels
+uint32_t latency_last = 0;                // Latency of last change (us)
+uint32_t latency_max = 0;                 // Longest latency (us)
+
+// Segment of pixels with its own bulbs, mode and frame period
+typedef struct segment {
+  // Configuration
+  uint16_t first;    // First pixel
+  uint16_t count;    // Number of pixels
+  uint8_t bulbs[2];  // Bulbs for colors 0 and 1
+  uint8_t mode;      // Display mode
+  uint32_t period;   // Frame period (ms)
+  // Frame data
+  uint32_t millis;                                  // Frame timer
+  uint32_t render_micros_max;                       // Longest time to render a frame (us)
+  const uint32_t *mode_palettes[PIXEL_MODE_COUNT];  // Palette for each mode
+  const uint32_t *mode_fades[PIXEL_MODE_COUNT];     // Palette to fade from for each mode
+  // Color data
+  uint32_t colors[2];                    // Bulb colors, packed
+  uint32_t shorts[GRADIENT_COUNT];       // Short gradient colors, packed
+  uint32_t longs[GRADIENT_COUNT];        // Long gradient colors, packed
+  uint32_t short_fulls[GRADIENT_COUNT];  // Short gradient colors at full value, packed
+  uint32_t long_fulls[GRADIENT_COUNT];   // Long gradient colors at full value, packed
+  uint16_t gradient_keys[6];             // Hues and saturations the full value gradients were built from
+  uint8_t gradient_vals[2];              // Values the gradients were scaled to
+  uint16_t gradient_slice;               // Next gradient color to build, GRADIENT_COUNT when built
+  bool gradient_fulls;                   // Full value gradients are being rebuilt
+  // Fade data
+  uint32_t fade_colors[2];               // Bulb colors to fade from, packed
+  uint32_t fade_shorts[GRADIENT_COUNT];  // Short gradient colors to fade from, packed
+  uint32_t fade_longs[GRADIENT_COUNT];   // Long gradient colors to fade from, packed
+  uint16_t fade_level;                   // Fade from old to new colors (8 fraction bits), 256 when complete
+  // Gradient animation data
+  uint32_t gradient_index;  // Gradient index for animation (8 fraction bits)
+  bool gradient_sub;        // Gradient animation index direction
+  // Noise animation data
+#if NOISE_PACKED
+  uint32_t noise_row;  // Noise row for animation (8 fraction bits)
+  uint32_t noise_col;  // Noise column for animation (8 fraction bits)
+  bool noise_row_sub;  // Noise row animation direction
+  bool noise_col_sub;  // Noise column animation direction
+#else
+  uint64_t noise_row;  // Noise row for animation (8 fraction bits)
+  uint64_t noise_col;  // Noise column for animation (8 fraction bits)
+#endif
+  uint8_t noise_cache[2][PIXEL_COUNT + 1];  // Noise rows either side of the current position, one extra value for interpolation
+  uint32_t noise_cache_rows[2];             // Noise row in each cache entry
+  uint32_t noise_cache_cols[2];             // Noise column in each cache entry
+} segment_t;
+
+// Segment data, add segments to split the pixels, bulbs can be shared by segments
+segment_t segments[SEGMENT_COUNT] = {
+  // first, count, bulbs, mode, period
+  { 0, PIXEL_COUNT, { 0, 1 }, PIXEL_MODE_NOISE_SLOW_SHORT, 100 },
+};
 
 // Pixel data
-ezWS2812 pixels(PIXEL_COUNT);                                                                                                                                          // RGB pixels object
-uint8_t pixel_mode = PIXEL_MODE_NOISE_SLOW_SHORT;                                                                                                                      // Default display mode
-uint16_t pixel_mode_led_masks[PIXEL_MODE_COUNT] = { 0b1, 0b101, 0b10101, 0b1010101, 0b1111111111111110, 0b1111111111111010, 0b1111111111101010, 0b1111111110101010 };  // LED flash patterns for each mode
-uint32_t pixel_period = 40;                                                                                                                                            // Pixel update period
-uint32_t pixel_millis;                                                                                                                                                 // Pixel update timer
+uint16_t pixel_mode_led_masks[PIXEL_MODE_COUNT] = { 0b1, 0b101, 0b10101, 0b1010101, 0b1111111111111110, 0b1111111111111010, 0b1111111111101010, 0b1111111110101010 };  // LED flash patterns for each mode, for segment 0
+uint16_t pixel_indexes[PIXEL_COUNT];     // Palette indexes for segment being rendered (8 fraction bits)
+uint16_t pixel_gamma[257];               // Gamma table, 8 bit channel to level (8 fraction bits), last entry for interpolation
+uint16_t pixel_levels[PIXEL_COUNT * 3];  // Gamma corrected channel levels for current frame, GRB order (8 fraction bits)
+uint16_t pixel_lasts[PIXEL_COUNT * 3];   // Channel levels for last frame, blended into the current frame
+uint32_t frame[PIXEL_COUNT];             // Colors for current frame, packed
+
+// Dither data
+uint8_t dither_errors[PIXEL_COUNT * 3];  // Fraction of each channel level not yet shown, carried to the next update
+
+// Task, run by loop() when due, periodic tasks are released every period and should finish before the next release
+typedef struct task {
+  const char *name;       // Name for stats
+  uint32_t period;        // Release period (ms), 0 for tasks run when they have work
+  uint32_t millis;        // Release timer
+  uint32_t start_micros;  // Start of current run
+  uint32_t late;          // Delay from release to start of current run (ms)
+  uint32_t runs;          // Number of runs
+  uint32_t missed;        // Deadlines missed, runs not finished before the next release
+  uint32_t late_max;      // Longest delay from release to start (ms)
+  uint32_t wcet_micros;   // Worst case execution time (us)
+} task_t;
+
+// Task data
+task_t tasks[TASK_COUNT];         // Tasks, set up in init_tasks()
+uint8_t stats_line = TASK_COUNT;  // Next line of stats to write, TASK_COUNT when not writing
 
 // Function prototypes
-bool read_bulbs();                                                                           // Read bulb data and react
-void write_gradients();                                                                      // Calculate gradients from bulb data
-void write_pixels();                                                                         // Write colors to pixels
+uint32_t read_bulbs();                                                                       // Read bulbs with queued events and react, returns bulbs changed
+void post_bulb_event(uint8_t bulb);                                                          // Queue bulb change event
+void init_segments();                                                                        // Set up segments
+void init_tasks();                                                                           // Set up tasks
+bool task_due(uint8_t t);                                                                    // Check if periodic task is due
+void task_begin(uint8_t t);                                                                  // Start task run, restart its timer
+void task_end(uint8_t t);                                                                    // End task run, update its stats
+bool task_fits(uint8_t t);                                                                   // Check if task fits before the next dither update
+void write_stats();                                                                          // Read stats requests, write next line of stats
+void report_memory();                                                                        // Report memory used
+void write_gradients(segment_t *segment);                                                    // Start building gradients from bulb data
+bool build_gradients(segment_t *segment);                                                    // Build next slice of gradients, true when built
+void next_frame(segment_t *segment);                                                         // Restart frame timer and render next frame
+void write_pixels(segment_t *segment, uint32_t elapsed);                                     // Render pixel levels for next frame
+void dither_pixels();                                                                        // Blend frames and write dithered colors to pixels
+void fill_pixels(uint32_t color);                                                            // Write one color to all pixels
+const uint16_t *index_solid(segment_t *segment, uint32_t step);                              // Palette indexes for solid modes
+const uint16_t *index_gradient(segment_t *segment, uint32_t step);                           // Palette indexes for gradient modes
+const uint16_t *index_noise_slow(segment_t *segment, uint32_t step);                         // Palette indexes for slow noise modes
+const uint16_t *index_noise_fast(segment_t *segment, uint32_t step);                         // Palette indexes for fast noise modes
+void read_noise(segment_t *segment);                                                         // Read noise values for current frame
+void next_noise(segment_t *segment, bool diagonal, uint32_t step);                           // Move through noise for next frame
+bool bounce(uint32_t *index, bool *sub, uint32_t step, uint32_t max);                        // Move index backwards and forwards between 0 and max
+void start_fade(segment_t *segment);                                                         // Start fading from the colors shown to new colors
+uint32_t blend_color(uint32_t from, uint32_t to, uint32_t level);                            // Blend between packed colors
 void fast_hsv_to_rgb(uint16_t h, uint8_t s, uint8_t v, uint8_t *r, uint8_t *g, uint8_t *b);  // Integer HSV to RGB conversion
 
+// Matter callbacks, the stack does not say which bulb changed so each bulb has its own
+void (*bulb_callbacks[BULB_COUNT_MAX])() = {
+  [] { post_bulb_event(0); }, [] { post_bulb_event(1); }, [] { post_bulb_event(2); }, [] { post_bulb_event(3); },
+  [] { post_bulb_event(4); }, [] { post_bulb_event(5); }, [] { post_bulb_event(6); }, [] { post_bulb_event(7); }
+};
+static_assert(BULB_COUNT <= BULB_COUNT_MAX, "Add bulb callbacks to raise BULB_COUNT_MAX");
+static_assert(BULB_COUNT <= 32, "Bulb changes are returned as bits");
+static_assert(PIXEL_COUNT <= WS2812_PIXEL_MAX, "Raise WS2812_PIXEL_MAX (up to 217) to drive more pixels");
+
+// Pixel modes
+const uint16_t *(*pixel_mode_indexes[PIXEL_MODE_COUNT])(segment_t *segment, uint32_t step) = { index_solid, index_solid, index_gradient, index_gradient, index_noise_slow, index_noise_slow, index_noise_fast, index_noise_fast };  // Palette index generator for each mode
+
 // Setup, called once at start up, put initialisation code here
 void setup() {
   // Data
   bool led_on = true;
+  uint8_t r, g, b;
+  uint32_t start_millis;
   // Initialise serial port
   Serial.begin(115200);
-  Serial.printf("\nMATTER MOOD LIGHT (FINAL)");
+  INFO_PRINTF("\nMATTER MOOD LIGHT (FINAL)");
   // Initialise LED to on
   pinMode(LED_MODE_PIN, OUTPUT);
   digitalWrite(LED_MODE_PIN, led_on);
@@ -163,38 +323,51 @@ void setup() {
   // Initialise matter
   Matter.begin();
   for (uint8_t u = 0; u < BULB_COUNT; u++) {
+    // Defaults, on, blue, magenta then round the color wheel
+    bulb_states[u] = true;
+    bulb_hues[u] = (240 + u * 60) % 360;
+    bulb_sats[u] = 254;
+    bulb_vals[u] = 254;
     bulbs[u].begin();
     bulbs[u].boost_saturation(BULB_BOOST_SATURATION);
     bulbs[u].set_onoff(bulb_states[u]);
     bulbs[u].set_true_hue(bulb_hues[u]);
     bulbs[u].set_saturation(bulb_sats[u]);
     bulbs[u].set_brightness(bulb_vals[u]);
-    fast_hsv_to_rgb(bulb_hues[u], bulb_sats[u], bulb_vals[u], &bulb_reds[u], &bulb_greens[u], &bulb_blues[u]);
+    bulbs[u].set_device_change_callback(bulb_callbacks[u]);
+    fast_hsv_to_rgb(bulb_hues[u], bulb_sats[u], bulb_vals[u], &r, &g, &b);
+    bulb_colors[u] = COLOR_GRB(r, g, b);
     // Debug
-    Serial.printf("\n%u: bulbs[%u]: state = %u, h = %u, s = %u, v = %u, r = %u, g = %u, b = %u",
+    DEBUG_PRINTF("\n%u: bulbs[%u]: state = %u, h = %u, s = %u, v = %u, r = %u, g = %u, b = %u",
                   millis(), u, bulb_states[u],
                   bulb_hues[u], bulb_sats[u], bulb_vals[u],
-                  bulb_reds[u], bulb_greens[u], bulb_blues[u]);
+                  r, g, b);
+  }
+  // Initialise segments and their gradients
+  init_segments();
+  // Initialise gamma table, 255 maps to full level
+  for (uint16_t i = 0; i <= 256; i++) {
+    pixel_gamma[i] = (uint16_t)(powf((i > 255 ? 255 : i) / 255.0f, PIXEL_GAMMA) * (255 << 8) + 0.5f);
   }
-  // Initialise gradients
-  write_gradients();
+#if !NOISE_PACKED
+  // Initialise noise
+  noise_gen_init(NOISE_SEED, NOISE_SCALE, NOISE_OCTAVES, NOISE_BLACK, NOISE_WHITE);
+#endif
   // Initialise pixels to off
-  pixels.begin();
-  noInterrupts();
-  pixels.set_all(0, 0, 0);
-  interrupts();
+  if (!ws2812_begin(PIXEL_PIN)) {
+    INFO_PRINTF("\nWS2812 output failed to start, no LDMA channel");
+  }
+  fill_pixels(COLOR_GRB(0, 0, 0));
   // Decommission - button held for 5 seconds at start up ?
   btn_state = digitalRead(BTN_MODE_PIN);
   if (btn_state == BTN_ACTIVE && Matter.isDeviceCommissioned()) {
-    Serial.printf("\nHold button for 5 seconds to complete factory reset...");
+    INFO_PRINTF("\nHold button for 5 seconds to complete factory reset...");
     // Set pixels to dim red
-    noInterrupts();
-    pixels.set_all(0x20, 0, 0);
-    interrupts();    
+    fill_pixels(COLOR_GRB(0x20, 0, 0));    
     // Start timer
-    now_millis = dio_millis = millis();
+    now_millis = start_millis = millis();
     // Wait for button to be released or timer to expire
-    while(btn_state == BTN_ACTIVE && now_millis - dio_millis < FACTORY_RESET_PERIOD) {
+    while(btn_state == BTN_ACTIVE && now_millis - start_millis < FACTORY_RESET_PERIOD) {
       // Update button and timer
       btn_state = digitalRead(BTN_MODE_PIN);
       now_millis = millis();
@@ -203,23 +376,21 @@ void setup() {
     if (btn_state == BTN_ACTIVE) {
       // Do factory reset by erasing non-volatile memory
       nvm3_eraseAll(nvm3_defaultHandle);
-      Serial.printf("\nFactory reset completed");
+      INFO_PRINTF("\nFactory reset completed");
     }
     // Button no longer pressed
     else {
-      Serial.printf("\nFactory reset cancelled");
+      INFO_PRINTF("\nFactory reset cancelled");
     }
   }
   // Matter commissioning
   if (!Matter.isDeviceCommissioned()) {
     // Set pixels to dim magenta
-    noInterrupts();
-    pixels.set_all(0x20, 0, 0x20);
-    interrupts();    
-    Serial.printf("\nMatter device is not commissioned");
-    Serial.printf("\nCommission it to your Matter hub with the manual pairing code or QR code");
-    Serial.printf("\nManual pairing code: %s", Matter.getManualPairingCode().c_str());
-    Serial.printf("\nQR code URL: %s", Matter.getOnboardingQRCodeUrl().c_str());
+    fill_pixels(COLOR_GRB(0x20, 0, 0x20));    
+    INFO_PRINTF("\nMatter device is not commissioned");
+    INFO_PRINTF("\nCommission it to your Matter hub with the manual pairing code or QR code");
+    INFO_PRINTF("\nManual pairing code: %s", Matter.getManualPairingCode().c_str());
+    INFO_PRINTF("\nQR code URL: %s", Matter.getOnboardingQRCodeUrl().c_str());
   }
 #if WAIT_ONLINE  
   while (!Matter.isDeviceCommissioned()) {
@@ -229,11 +400,9 @@ void setup() {
     digitalWrite(LED_MODE_PIN, led_on);
   }
   // Set pixels to dim yellow
-  noInterrupts();
-  pixels.set_all(0x20, 0x20, 0);
-  interrupts();
+  fill_pixels(COLOR_GRB(0x20, 0x20, 0));
   // Matter connection
-  Serial.printf("\nWaiting for Thread network...");
+  INFO_PRINTF("\nWaiting for Thread network...");
   while (!Matter.isDeviceThreadConnected()) {
     delay(200);
     if (led_on) led_on = false;
@@ -241,47 +410,87 @@ void setup() {
     digitalWrite(LED_MODE_PIN, led_on);    
   }
   // Matter online
-  Serial.printf("\nConnected to Thread network");
+  INFO_PRINTF("\nConnected to Thread network");
   // Set pixels to dim cyan
-  noInterrupts();
-  pixels.set_all(0, 0x20, 0x20);
-  interrupts();
+  fill_pixels(COLOR_GRB(0, 0x20, 0x20));
   // Bulbs online
-  Serial.printf("\nWaiting for Matter device discovery...");
-  while (bulbs[0].is_online() == false || bulbs[1].is_online() == false) {
-    delay(200);
-    if (led_on) led_on = false;
-    else led_on = true;
-    digitalWrite(LED_MODE_PIN, led_on);     
+  INFO_PRINTF("\nWaiting for Matter device discovery...");
+  for (uint8_t u = 0; u < BULB_COUNT; u++) {
+    while (bulbs[u].is_online() == false) {
+      delay(200);
+      if (led_on) led_on = false;
+      else led_on = true;
+      digitalWrite(LED_MODE_PIN, led_on);     
+    }
   }
-  Serial.printf("\nMatter device is now online");
+  INFO_PRINTF("\nMatter device is now online");
 #endif  
   // Turn off LED
   led_on = false;
   digitalWrite(LED_MODE_PIN, led_on);
-  // Start loop timers
-  now_millis = dio_millis = bulb_millis = pixel_millis = millis();
+  // Read bulbs in first loop, they may have changed while starting up
+  for (uint8_t u = 0; u < BULB_COUNT; u++) {
+    post_bulb_event(u);
+  }
+  // Report memory used
+  report_memory();
+  // Clear status colors, pixels outside segments stay off
+  fill_pixels(COLOR_GRB(0, 0, 0));
+  // Start frame and task timers
+  now_millis = millis();
+  for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+    segments[s].millis = now_millis;
+  }
+  init_tasks();
 }
 
-// Loop, called repeatedly, put processing code here
+// Loop, called repeatedly, put processing code here, runs the most urgent task that is due then returns
 void loop() {
   // Data
-  bool update = false;
+  uint32_t changes;
+  segment_t *segment;
   // Update time
   now_millis = millis();
-  // Bulb timer fired?
-  if (now_millis - bulb_millis >= bulb_period) {
-    // Restart timer
-    bulb_millis = now_millis;
+  // Dither timer fired ? Frame output comes first
+  if (task_due(TASK_DITHER)) {
+    task_begin(TASK_DITHER);
+    // Write to pixels
+    dither_pixels();
+    task_end(TASK_DITHER);
+    return;
+  }
+  // Segment frame timers fired ?
+  for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+    if (task_due(TASK_SEGMENTS + s)) {
+      task_begin(TASK_SEGMENTS + s);
+      // Render next frame
+      next_frame(&segments[s]);
+      task_end(TASK_SEGMENTS + s);
+      return;
+    }
+  }
+  // Bulb events queued ?
+  if (bulb_event_tail != bulb_event_head || bulb_event_overflow) {
+    task_begin(TASK_BULBS);
     // Read bulb status
-    update = read_bulbs();
-    // Updated - write gradients
-    if (update) write_gradients();
+    changes = read_bulbs();
+    // Update segments using changed bulbs
+    for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+      segment = &segments[s];
+      if (changes & ((1UL << segment->bulbs[0]) | (1UL << segment->bulbs[1]))) {
+        // Fade from the colors shown to new gradients, built in slices by later tasks
+        start_fade(segment);
+        write_gradients(segment);
+        // Nothing to build ? Render next frame now rather than waiting for the frame timer
+        if (segment->gradient_slice >= GRADIENT_COUNT) next_frame(segment);
+      }
+    }
+    task_end(TASK_BULBS);
+    return;
   }
   // Digital IO timer fired ?
-  if (now_millis - dio_millis >= dio_period) {
-    // Restart timer
-    dio_millis = now_millis;
+  if (task_due(TASK_DIO)) {
+    task_begin(TASK_DIO);
     // Read button
     bool state = digitalRead(BTN_MODE_PIN);
     // Button changed ?
@@ -289,10 +498,12 @@ void loop() {
       btn_state = state;
       // Button pressed ?
       if (btn_state == BTN_ACTIVE) {
-        // Change mode
-        pixel_mode++;
-        if (pixel_mode >= PIXEL_MODE_COUNT) pixel_mode = PIXEL_MODE_SOLID_0;
-        Serial.printf("\n%u: pixel_mode = %u", now_millis, pixel_mode);
+        // Change modes
+        for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+          segments[s].mode++;
+          if (segments[s].mode >= PIXEL_MODE_COUNT) segments[s].mode = PIXEL_MODE_SOLID_0;
+          DEBUG_PRINTF("\n%u: segments[%u].mode = %u", now_millis, s, segments[s].mode);
+        }
       }
     }
     // Make sure a led bit is set
@@ -300,29 +511,65 @@ void loop() {
       led_bit = 0b1;
     }
     // Update LEDs, on with off periods indicating modes
-    if (led_bit & pixel_mode_led_masks[pixel_mode]) digitalWrite(LED_MODE_PIN, LED_BUILTIN_ACTIVE);
+    if (led_bit & pixel_mode_led_masks[segments[0].mode]) digitalWrite(LED_MODE_PIN, LED_BUILTIN_ACTIVE);
     else digitalWrite(LED_MODE_PIN, LED_BUILTIN_INACTIVE);
     // Update bit for next time
     led_bit <<= 1;
+    task_end(TASK_DIO);
+    return;
   }
-  // Pixels timer fired ?
-  if (now_millis - pixel_millis >= pixel_period) {
-    // Restart timer
-    pixel_millis = now_millis;
-    // Write to pixels
-    write_pixels();
+  // Stats requested or being written ?
+  if (stats_line < TASK_COUNT || Serial.available()) {
+    task_begin(TASK_STATS);
+    write_stats();
+    task_end(TASK_STATS);
+    return;
+  }
+  // Gradients being built ?
+  for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+    segment = &segments[s];
+    if (segment->gradient_slice < GRADIENT_COUNT) {
+      // Slice would hold up the next dither update ? Try again after it
+      if (!task_fits(TASK_GRADIENTS)) return;
+      task_begin(TASK_GRADIENTS);
+      // Build slice, render next frame as soon as gradients are built
+      if (build_gradients(segment)) next_frame(segment);
+      task_end(TASK_GRADIENTS);
+      return;
+    }
   }
 }
 
-bool read_bulbs() {
+// Read bulbs with queued events and react, returns a bit for each bulb that changed
+uint32_t read_bulbs() {
   // Data
-  bool updates[BULB_COUNT] = { false, false };
+  bool reads[BULB_COUNT] = {};
+  bool updates[BULB_COUNT] = {};
+  uint32_t changes = 0;
   bool state;
   uint16_t hue;
   uint8_t sat;
   uint8_t val;
+  uint8_t r, g, b;
+  // Take queued events, noting the earliest change not yet shown
+  while (bulb_event_tail != bulb_event_head) {
+    uint8_t e = bulb_event_tail & (BULB_EVENT_COUNT - 1);
+    reads[bulb_event_bulbs[e]] = true;
+    if (!latency_pending) {
+      latency_micros = bulb_event_micros[e];
+      latency_pending = true;
+    }
+    bulb_event_tail = bulb_event_tail + 1;
+  }
+  // Events were lost ? Read all bulbs
+  if (bulb_event_overflow) {
+    bulb_event_overflow = false;
+    for (uint8_t u = 0; u < BULB_COUNT; u++) reads[u] = true;
+  }
   // Loop through bulbs
   for (uint8_t u = 0; u < BULB_COUNT; u++) {
+    // No event for bulb ?
+    if (!reads[u]) continue;
     // Get current data
     state = bulbs[u].get_onoff();
     hue = bulbs[u].get_true_hue();
@@ -350,40 +597,204 @@ bool read_bulbs() {
     }
     // Something changed ?
     if (updates[u]) {
+      changes |= 1UL << u;
       // Bulb is on ?
       if (bulb_states[u]) {
         // Convert color
-        fast_hsv_to_rgb(bulb_hues[u], bulb_sats[u], bulb_vals[u], &bulb_reds[u], &bulb_greens[u], &bulb_blues[u]);
+        fast_hsv_to_rgb(bulb_hues[u], bulb_sats[u], bulb_vals[u], &r, &g, &b);
       }
       // Bulb is off ?
       else {
         // Use black
-        bulb_reds[u] = bulb_greens[u] = bulb_blues[u] = 0;
+        r = g = b = 0;
       }
+      bulb_colors[u] = COLOR_GRB(r, g, b);
       // Debug
-      Serial.printf("\n%u: read_bulbs(%u) = %u, state = %u, h = %u, s = %u, v = %u, r = %u, g = %u, b = %u",
+      DEBUG_PRINTF("\n%u: read_bulbs(%u) = %u, state = %u, h = %u, s = %u, v = %u, r = %u, g = %u, b = %u",
                     millis(), u, updates[u], bulb_states[u],
                     bulb_hues[u], bulb_sats[u], bulb_vals[u],
-                    bulb_reds[u], bulb_greens[u], bulb_blues[u]);
+                    r, g, b);
+    }
+  }
+  // Nothing changed, nothing to show
+  if (changes == 0) latency_pending = false;
+  return changes;
+}
+
+// Queue bulb change event, called from the Matter stack
+void post_bulb_event(uint8_t bulb) {
+  uint8_t head = bulb_event_head;
+  // Queue full ? loop() will read all bulbs
+  if ((uint8_t)(head - bulb_event_tail) >= BULB_EVENT_COUNT) {
+    bulb_event_overflow = true;
+    return;
+  }
+  bulb_event_bulbs[head & (BULB_EVENT_COUNT - 1)] = bulb;
+  bulb_event_micros[head & (BULB_EVENT_COUNT - 1)] = micros();
+  // Publish event once written
+  bulb_event_head = head + 1;
+}
+
+// Set up segments
+void init_segments() {
+  segment_t *segment;
+  for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+    segment = &segments[s];
+    // Keep segment on the pixels and bulbs
+    if (segment->first >= PIXEL_COUNT) segment->first = PIXEL_COUNT - 1;
+    if (segment->first + segment->count > PIXEL_COUNT) segment->count = PIXEL_COUNT - segment->first;
+    if (segment->count == 0) segment->count = 1;
+    if (segment->bulbs[0] >= BULB_COUNT) segment->bulbs[0] = BULB_COUNT - 1;
+    if (segment->bulbs[1] >= BULB_COUNT) segment->bulbs[1] = BULB_COUNT - 1;
+    if (segment->period == 0) segment->period = 1;
+    // Palettes for each mode
+    for (uint8_t m = 0; m < PIXEL_MODE_COUNT; m++) {
+      switch (m) {
+        case PIXEL_MODE_SOLID_0:
+          segment->mode_palettes[m] = &segment->colors[0];
+          segment->mode_fades[m] = &segment->fade_colors[0];
+          break;
+        case PIXEL_MODE_SOLID_1:
+          segment->mode_palettes[m] = &segment->colors[1];
+          segment->mode_fades[m] = &segment->fade_colors[1];
+          break;
+        case PIXEL_MODE_GRADIENT_SHORT:
+        case PIXEL_MODE_NOISE_SLOW_SHORT:
+        case PIXEL_MODE_NOISE_FAST_SHORT:
+          segment->mode_palettes[m] = segment->shorts;
+          segment->mode_fades[m] = segment->fade_shorts;
+          break;
+        default:
+          segment->mode_palettes[m] = segment->longs;
+          segment->mode_fades[m] = segment->fade_longs;
+          break;
+      }
+    }
+    // Nothing cached yet, no fade
+    memset(segment->gradient_keys, 0xFF, sizeof(segment->gradient_keys));
+    segment->noise_cache_rows[0] = segment->noise_cache_rows[1] = UINT32_MAX;
+    segment->fade_level = 256;
+#if !NOISE_PACKED
+    // Segments along the chain show neighbouring parts of the noise field
+    segment->noise_col = (uint64_t)segment->first << 8;
+#endif
+    // Build whole gradients, nothing is being shown yet
+    write_gradients(segment);
+    while (!build_gradients(segment)) {
+    }
+  }
+}
+
+// Set up tasks, loop() checks them in priority order
+void init_tasks() {
+  const char *names[TASK_SEGMENTS] = { "dither", "bulbs", "dio", "stats", "gradients" };
+  const uint32_t periods[TASK_SEGMENTS] = { DITHER_PERIOD, 0, DIO_PERIOD, 0, 0 };
+  memset(tasks, 0, sizeof(tasks));
+  for (uint8_t t = 0; t < TASK_COUNT; t++) {
+    // Segment frames use the segment's frame period
+    if (t >= TASK_SEGMENTS) {
+      tasks[t].name = "segment";
+      tasks[t].period = segments[t - TASK_SEGMENTS].period;
+    } else {
+      tasks[t].name = names[t];
+      tasks[t].period = periods[t];
+    }
+    tasks[t].millis = now_millis;
+  }
+}
+
+// Check if periodic task is due
+bool task_due(uint8_t t) {
+  return now_millis - tasks[t].millis >= tasks[t].period;
+}
+
+// Start task run, periodic tasks restart their timers
+void task_begin(uint8_t t) {
+  task_t *task = &tasks[t];
+  task->start_micros = micros();
+  task->runs++;
+  if (task->period) {
+    task->late = now_millis - task->millis - task->period;
+    if (task->late > task->late_max) task->late_max = task->late;
+    task->millis = now_millis;
+  }
+}
+
+// End task run, update its stats
+void task_end(uint8_t t) {
+  task_t *task = &tasks[t];
+  uint32_t run_micros = micros() - task->start_micros;
+  if (run_micros > task->wcet_micros) task->wcet_micros = run_micros;
+  // Periodic task not finished before its next release ?
+  if (task->period && task->late * 1000 + run_micros >= task->period * 1000) task->missed++;
+}
+
+// Check if task's worst case execution time fits before the next dither update
+bool task_fits(uint8_t t) {
+  task_t *dither = &tasks[TASK_DITHER];
+  int32_t budget = (int32_t)(dither->start_micros + dither->period * 1000 - micros());
+  // Tasks that can never fit run anyway so their work gets done
+  return (int32_t)tasks[t].wcet_micros <= budget || tasks[t].wcet_micros >= dither->period * 1000;
+}
+
+// Read stats requests, 's' writes stats, 'r' resets them, one line is written each call so frames keep flowing
+void write_stats() {
+  task_t *task;
+  // Requests received ?
+  while (Serial.available()) {
+    switch (Serial.read()) {
+      case 's':
+        INFO_PRINTF("\n%u: stats, latency = %uus, max = %uus", now_millis, latency_last, latency_max);
+        stats_line = 0;
+        break;
+      case 'r':
+        for (uint8_t t = 0; t < TASK_COUNT; t++) {
+          tasks[t].runs = tasks[t].missed = tasks[t].late_max = tasks[t].wcet_micros = 0;
+        }
+        for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+          segments[s].render_micros_max = 0;
+        }
+        latency_max = 0;
+        INFO_PRINTF("\n%u: stats reset", now_millis);
+        break;
     }
   }
-  return (updates[0] | updates[1]);
+  // Writing stats ?
+  if (stats_line < TASK_COUNT) {
+    task = &tasks[stats_line];
+    INFO_PRINTF("\n%u: %s", stats_line, task->name);
+    if (stats_line >= TASK_SEGMENTS) INFO_PRINTF(" %u", stats_line - TASK_SEGMENTS);
+    INFO_PRINTF(", period = %ums, runs = %u, missed = %u, late max = %ums, wcet = %uus",
+                task->period, task->runs, task->missed, task->late_max, task->wcet_micros);
+    stats_line++;
+  }
 }
 
-// Write gradients
-void write_gradients() {
-  uint16_t short_hues[2] = { bulb_hues[0], bulb_hues[1] };
-  uint16_t long_hues[2] = { bulb_hues[0], bulb_hues[1] };
-  uint8_t sats[2] = { bulb_sats[0], bulb_sats[1] };
-  uint8_t vals[2] = { bulb_vals[0], bulb_vals[1] };
+// Report memory used
+void report_memory() {
+  uint32_t bulb_bytes = sizeof(bulbs) + sizeof(bulb_states) + sizeof(bulb_hues) + sizeof(bulb_sats) + sizeof(bulb_vals) + sizeof(bulb_colors)
+                        + sizeof(bulb_event_bulbs) + sizeof(bulb_event_micros);
+  uint32_t pixel_bytes = sizeof(pixel_indexes) + sizeof(pixel_gamma) + sizeof(pixel_levels) + sizeof(pixel_lasts) + sizeof(frame) + sizeof(dither_errors);
+  INFO_PRINTF("\nMemory: %u bulbs = %u bytes, %u segments = %u bytes (%u each), %u pixels = %u bytes, ws2812 = %u bytes, total = %u bytes",
+              BULB_COUNT, bulb_bytes, SEGMENT_COUNT, sizeof(segments), sizeof(segment_t), PIXEL_COUNT, pixel_bytes, WS2812_MEMORY,
+              bulb_bytes + sizeof(segments) + pixel_bytes + WS2812_MEMORY);
+}
+
+// Write gradients for segment from its bulbs
+void write_gradients(segment_t *segment) {
+  uint8_t u0 = segment->bulbs[0];
+  uint8_t u1 = segment->bulbs[1];
+  uint16_t short_hues[2] = { bulb_hues[u0], bulb_hues[u1] };
+  uint16_t long_hues[2] = { bulb_hues[u0], bulb_hues[u1] };
+  uint8_t sats[2] = { bulb_sats[u0], bulb_sats[u1] };
+  uint8_t vals[2] = { bulb_vals[u0], bulb_vals[u1] };
   uint16_t short_hue_range;
   uint16_t long_hue_range;
-  uint16_t short_hue;
-  uint16_t long_hue;
-  uint8_t sat;
-  uint8_t val;
   // Debug
-  Serial.printf("\n%u: write_gradients():", millis());
+  DEBUG_PRINTF("\n%u: write_gradients(%u):", millis(), (uint32_t)(segment - segments));
+  // Solid colors
+  segment->colors[0] = bulb_colors[u0];
+  segment->colors[1] = bulb_colors[u1];
   // Calculate short path hues going the short way around the color wheel allow hues greater than 360
   if (short_hues[0] > short_hues[1]) {
     short_hue_range = short_hues[0] - short_hues[1];
@@ -413,12 +824,12 @@ void write_gradients() {
     }
   }
   // Both bulbs are off ?
-  if (!bulb_states[0] && !bulb_states[1]) {
+  if (!bulb_states[u0] && !bulb_states[u1]) {
     // Set brightnesses to 0
     vals[0] = vals[1] = 0;
   }
   // Bulb 0 off but bulb 1 is on ?
-  else if (!bulb_states[0] && bulb_states[1]) {
+  else if (!bulb_states[u0] && bulb_states[u1]) {
     // Set brightness zero
     vals[0] = 0;
     // Copy hues and saturation from bulb 1 for single color fade to black
@@ -427,7 +838,7 @@ void write_gradients() {
     long_hues[0] = long_hues[1];
   }
   // Bulb 1 off but bulb 0 is on ?
-  else if (!bulb_states[1] && bulb_states[0]) {
+  else if (!bulb_states[u1] && bulb_states[u0]) {
     // Set brightness zero
     vals[1] = 0;
     // Copy hues and saturation from bulb 1 for single color fade to black
@@ -451,252 +862,335 @@ void write_gradients() {
     }
   }
   // Debug
-  Serial.printf(" short_hues = {%u, %u}, short_hue_range = %u", short_hues[0], short_hues[1], short_hue_range);
-  Serial.printf(", long_hues = {%u, %u}, long_hue_range = %u", long_hues[0], long_hues[1], long_hue_range);
-  Serial.printf(", sats = {%u, %u}, vals = {%u, %u}", sats[0], sats[1], vals[0], vals[1]);
-  // Build gradients
-  for (uint16_t i = 0; i < GRADIENT_COUNT; i++) {
-    // Scale values for this entry
-    short_hue = map(i, 0, GRADIENT_COUNT - 1, short_hues[0], short_hues[1]);
-    long_hue = map(i, 0, GRADIENT_COUNT - 1, long_hues[0], long_hues[1]);
-    sat = map(i, 0, GRADIENT_COUNT - 1, sats[0], sats[1]);
-    val = map(i, 0, GRADIENT_COUNT - 1, vals[0], vals[1]);
-    // Convert to rgb
-    fast_hsv_to_rgb(short_hue, sat, val, &gradient_short_reds[i], &gradient_short_greens[i], &gradient_short_blues[i]);
-    fast_hsv_to_rgb(long_hue, sat, val, &gradient_long_reds[i], &gradient_long_greens[i], &gradient_long_blues[i]);
+  DEBUG_PRINTF(" short_hues = {%u, %u}, short_hue_range = %u", short_hues[0], short_hues[1], short_hue_range);
+  DEBUG_PRINTF(", long_hues = {%u, %u}, long_hue_range = %u", long_hues[0], long_hues[1], long_hue_range);
+  DEBUG_PRINTF(", sats = {%u, %u}, vals = {%u, %u}", sats[0], sats[1], vals[0], vals[1]);
+  // Hues or saturations changed ? Rebuild gradients at full value
+  uint16_t keys[6] = { short_hues[0], short_hues[1], long_hues[0], long_hues[1], sats[0], sats[1] };
+  if (memcmp(keys, segment->gradient_keys, sizeof(keys)) != 0) {
+    memcpy(segment->gradient_keys, keys, sizeof(keys));
+    segment->gradient_fulls = true;
+    segment->gradient_slice = 0;
+  }
+  // Values changed ? Rescale gradients, all that is needed when only values change
+  if (vals[0] != segment->gradient_vals[0] || vals[1] != segment->gradient_vals[1]) {
+    segment->gradient_vals[0] = vals[0];
+    segment->gradient_vals[1] = vals[1];
+    segment->gradient_slice = 0;
+  }
+  // Debug
+  DEBUG_PRINTF(", build = %u, full = %u", segment->gradient_slice < GRADIENT_COUNT, segment->gradient_fulls);
+}
+
+// Build next slice of segment's gradients, returns true when they are built
+bool build_gradients(segment_t *segment) {
+  uint16_t *keys = segment->gradient_keys;
+  uint8_t *vals = segment->gradient_vals;
+  uint16_t first = segment->gradient_slice;
+  // Already built ?
+  if (first >= GRADIENT_COUNT) return true;
+  // Hues or saturations changed ? Build slice at full value
+  if (segment->gradient_fulls) {
+    hsv_gradient_part(keys[0], keys[4], 255, keys[1], keys[5], 255, segment->short_fulls, GRADIENT_COUNT, first, GRADIENT_SLICE);
+    hsv_gradient_part(keys[2], keys[4], 255, keys[3], keys[5], 255, segment->long_fulls, GRADIENT_COUNT, first, GRADIENT_SLICE);
+  }
+  // Scale slice to values
+  hsv_gradient_scale_part(segment->short_fulls, vals[0], vals[1], segment->shorts, GRADIENT_COUNT, first, GRADIENT_SLICE);
+  hsv_gradient_scale_part(segment->long_fulls, vals[0], vals[1], segment->longs, GRADIENT_COUNT, first, GRADIENT_SLICE);
+  // More to build ?
+  if (first + GRADIENT_SLICE < GRADIENT_COUNT) {
+    segment->gradient_slice = first + GRADIENT_SLICE;
+    return false;
+  }
+  segment->gradient_slice = GRADIENT_COUNT;
+  segment->gradient_fulls = false;
 #if 0
-    // Debug
-    Serial.printf("\n%u: sh = %u, s = %u, v = %u, sr = %u, sg= %u, sb=%u, lh = %u, s = %u, v = %u, lr = %u, lg= %u, lb=%u",
+  // Debug
+  for (uint16_t i = 0; i < GRADIENT_COUNT; i++) {
+    DEBUG_PRINTF("\n%u: sr = %u, sg= %u, sb=%u, lr = %u, lg= %u, lb=%u",
       i,
-      short_hue, sat, val, gradient_short_reds[i], gradient_short_greens[i], gradient_short_blues[i],
-      long_hue,  sat, val, gradient_long_reds[i],  gradient_long_greens[i],  gradient_long_blues[i]);
-#endif
+      COLOR_R(segment->shorts[i]), COLOR_G(segment->shorts[i]), COLOR_B(segment->shorts[i]),
+      COLOR_R(segment->longs[i]),  COLOR_G(segment->longs[i]),  COLOR_B(segment->longs[i]));
   }
+#endif
   // Debug
-  Serial.printf("\n%u: write_gradients(): DONE", millis());
+  DEBUG_PRINTF("\n%u: build_gradients(%u): DONE", millis(), (uint32_t)(segment - segments));
+  return true;
 }
 
-// Write to pixels
-void write_pixels() {
+// Restart segment's frame timer and render its next frame, called when due or to show changes now
+void next_frame(segment_t *segment) {
+  uint32_t elapsed = now_millis - segment->millis;
+  segment->millis = tasks[TASK_SEGMENTS + (segment - segments)].millis = now_millis;
+  write_pixels(segment, elapsed);
+}
+
+// Render pixel levels for segment's next frame
+void write_pixels(segment_t *segment, uint32_t elapsed) {
   // Data
-  uint32_t index;
-  bool sub;
-  uint8_t r, g, b;
+  const uint16_t *indexes;
+  const uint32_t *palette;
+  const uint32_t *fade;
+  uint16_t *levels = &pixel_levels[segment->first * 3];
+  uint16_t *lasts = &pixel_lasts[segment->first * 3];
+  uint32_t step, index, fraction, color_0, color_1;
+  int32_t channel;
+  uint32_t start_micros = micros();
   // Debug
-  //Serial.printf("\n(%u,%u)", noise_col, noise_row);
-  // Which mode:
-  switch (pixel_mode) {
-    // Solid bulb 0 color
-    case PIXEL_MODE_SOLID_0:
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, bulb_reds[0], bulb_greens[0], bulb_blues[0], 100, false);
-      }
-      pixels.end_transfer();
-      interrupts();
-      break;
-
-    // Solid bulb 1 color ?
-    case PIXEL_MODE_SOLID_1:
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, bulb_reds[1], bulb_greens[1], bulb_blues[1], 100, false);
-      }
-      pixels.end_transfer();
-      interrupts();
-      break;
-
-    // Short gradient ?
-    case PIXEL_MODE_GRADIENT_SHORT:
-      index = gradient_index;
-      sub = gradient_sub;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        // Ensure all pixels get set to first color at start of gradient
-        if (index < (PIXEL_COUNT / 2)) {
-          r = gradient_short_reds[0];
-          g = gradient_short_greens[0];
-          b = gradient_short_blues[0];
-        }
-        // Ensure all pixels get set to last color at end of gradient
-        else if (index > GRADIENT_COUNT + (PIXEL_COUNT / 2) - 1) {
-          r = gradient_short_reds[GRADIENT_COUNT - 1];
-          g = gradient_short_greens[GRADIENT_COUNT - 1];
-          b = gradient_short_blues[GRADIENT_COUNT - 1];
-        }
-        // Use gradient color when in gradient
-        else {
-          r = gradient_short_reds[index - (PIXEL_COUNT / 2)];
-          g = gradient_short_greens[index - (PIXEL_COUNT / 2)];
-          b = gradient_short_blues[index - (PIXEL_COUNT / 2)];
-        }
-        pixels.set_pixel(1, r, g, b, 100, false);
-        // Change direction ?
-        if (index == 0) sub = false;
-        else if (index == GRADIENT_COUNT + PIXEL_COUNT - 1) sub = true;
-        // Next gradient index
-        if (sub) index--;
-        else index++;
-      }
-      pixels.end_transfer();
-      interrupts();
-      // Change direction ?
-      if (gradient_index == 0) gradient_sub = false;
-      else if (gradient_index == GRADIENT_COUNT + PIXEL_COUNT - 1) gradient_sub = true;
-      // Next iteration
-      if (gradient_sub) gradient_index--;
-      else gradient_index++;
-      break;
-
-    // Long gradient ?
-    case PIXEL_MODE_GRADIENT_LONG:
-      index = gradient_index;
-      sub = gradient_sub;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        // Ensure all pixels get set to first color at start of gradient
-        if (index < (PIXEL_COUNT / 2)) {
-          r = gradient_long_reds[0];
-          g = gradient_long_greens[0];
-          b = gradient_long_blues[0];
-        }
-        // Ensure all pixels get set to last color at end of gradient
-        else if (index > GRADIENT_COUNT + (PIXEL_COUNT / 2) - 1) {
-          r = gradient_long_reds[GRADIENT_COUNT - 1];
-          g = gradient_long_greens[GRADIENT_COUNT - 1];
-          b = gradient_long_blues[GRADIENT_COUNT - 1];
-        }
-        // Use gradient color when in gradient
-        else {
-          r = gradient_long_reds[index - (PIXEL_COUNT / 2)];
-          g = gradient_long_greens[index - (PIXEL_COUNT / 2)];
-          b = gradient_long_blues[index - (PIXEL_COUNT / 2)];
-        }
-        pixels.set_pixel(1, r, g, b, 100, false);
-        // Change direction ?
-        if (index == 0) sub = false;
-        else if (index == GRADIENT_COUNT + PIXEL_COUNT - 1) sub = true;
-        // Next gradient index
-        if (sub) index--;
-        else index++;
-      }
-      pixels.end_transfer();
-      interrupts();
-      // Change direction ?
-      if (gradient_index == 0) gradient_sub = false;
-      else if (gradient_index == GRADIENT_COUNT + PIXEL_COUNT - 1) gradient_sub = true;
-      // Next iteration
-      if (gradient_sub) gradient_index--;
-      else gradient_index++;
-      break;
-
-    // Slow, short noise linear around noise image ?
-    case PIXEL_MODE_NOISE_SLOW_SHORT:
-      index = (noise_row * NOISE_WIDTH) + noise_col;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, gradient_short_reds[noise[index + p]], gradient_short_greens[noise[index + p]], gradient_short_blues[noise[index + p]], 100, false);
-      }
-      pixels.end_transfer();
-      interrupts();
-      // Get ready for next iteration (work up and down and backwards and forwards around the edges of the noise)
-      if (noise_row == 0) {
-        noise_row_sub = false;
-        if (noise_col_sub == true) {
-          noise_col -= 1;
-          if (noise_col == 0) noise_col_sub = false;
-        } else {
-          noise_col += 1;
-          if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-        }
-      } else if (noise_row >= NOISE_HEIGHT - 1) {
-        noise_row_sub = true;
-        if (noise_col_sub == true) {
-          noise_col -= 1;
-          if (noise_col == 0) noise_col_sub = false;
-        } else {
-          noise_col += 1;
-          if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-        }
-      }
-      if (noise_row_sub) noise_row -= 1;
-      else noise_row += 1;
-      break;
-
-    // Slow, long noise linear around noise image ?
-    case PIXEL_MODE_NOISE_SLOW_LONG:
-      index = (noise_row * NOISE_WIDTH) + noise_col;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, gradient_long_reds[noise[index + p]], gradient_long_greens[noise[index + p]], gradient_long_blues[noise[index + p]], 100, false);
-      }
-      pixels.end_transfer();
-      interrupts();
-      // Get ready for next iteration (work up and down and backwards and forwards around the edges of the noise)
-      if (noise_row == 0) {
-        noise_row_sub = false;
-        if (noise_col_sub == true) {
-          noise_col -= 1;
-          if (noise_col == 0) noise_col_sub = false;
-        } else {
-          noise_col += 1;
-          if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-        }
-      } else if (noise_row >= NOISE_HEIGHT - 1) {
-        noise_row_sub = true;
-        if (noise_col_sub == true) {
-          noise_col -= 1;
-          if (noise_col == 0) noise_col_sub = false;
-        } else {
-          noise_col += 1;
-          if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-        }
-      }
-      if (noise_row_sub) noise_row -= 1;
-      else noise_row += 1;
-      break;
-
-    // Fast, short noise diagonal around noise image ?
-    case PIXEL_MODE_NOISE_FAST_SHORT:
-      index = (noise_row * NOISE_WIDTH) + noise_col;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, gradient_short_reds[noise[index + p]], gradient_short_greens[noise[index + p]], gradient_short_blues[noise[index + p]], 100, false);
+  //DEBUG_PRINTF("\n(%u,%u)", (uint32_t)(segment->noise_col >> 8), (uint32_t)(segment->noise_row >> 8));
+  // Distance to animate, in steps (8 fraction bits)
+  if (elapsed > PIXEL_ELAPSED_MAX) elapsed = PIXEL_ELAPSED_MAX;
+  step = ((elapsed * PIXEL_SPEED) << 8) / 1000;
+  // Get palette indexes for mode and its palette
+  indexes = pixel_mode_indexes[segment->mode](segment, step);
+  palette = segment->mode_palettes[segment->mode];
+  fade = segment->mode_fades[segment->mode];
+  // Blend from the levels shown now, which are part way to the current frame when rendering early
+  index = (elapsed << 8) / segment->period;
+  if (index >= 256) memcpy(lasts, levels, segment->count * 3 * sizeof(uint16_t));
+  else {
+    for (uint16_t i = 0; i < segment->count * 3; i++) {
+      lasts[i] = (lasts[i] * (256 - index) + levels[i] * index) >> 8;
+    }
+  }
+  // Continue fade once gradients are built, changes start to show in the first frame after them
+  if (segment->fade_level < 256 && segment->gradient_slice >= GRADIENT_COUNT) {
+    segment->fade_level += 256 / FADE_FRAMES;
+    if (segment->fade_level > 256) segment->fade_level = 256;
+  }
+  // Render frame
+  for (uint16_t p = 0; p < segment->count; p++) {
+    // Colors either side of the palette index, solid palettes only have one color
+    index = indexes[p] >> 8;
+    fraction = indexes[p] & 0xFF;
+    color_0 = palette[index];
+    color_1 = palette[index + (fraction != 0)];
+    // Fading from old colors ?
+    if (segment->fade_level < 256) {
+      color_0 = blend_color(fade[index], color_0, segment->fade_level);
+      color_1 = blend_color(fade[index + (fraction != 0)], color_1, segment->fade_level);
+    }
+    for (uint8_t c = 0; c < 3; c++) {
+      // Interpolate channel between colors (8 fraction bits), green, red then blue
+      channel = (int32_t)(color_0 >> (16 - c * 8)) & 0xFF;
+      channel = (channel << 8) + ((((int32_t)(color_1 >> (16 - c * 8)) & 0xFF) - channel) * (int32_t)fraction);
+      // Gamma correct, interpolating between table entries
+      index = channel >> 8;
+      levels[p * 3 + c] = pixel_gamma[index] + (((pixel_gamma[index + 1] - pixel_gamma[index]) * (channel & 0xFF)) >> 8);
+    }
+  }
+  // Change rendered ?
+  if (latency_pending && segment->gradient_slice >= GRADIENT_COUNT) {
+    latency_pending = false;
+    latency_segment = segment;
+  }
+  // Frame time, reported as it grows
+  start_micros = micros() - start_micros;
+  if (start_micros > segment->render_micros_max) {
+    segment->render_micros_max = start_micros;
+    DEBUG_PRINTF("\n%u: write_pixels(%u): mode = %u, count = %u, max = %uus", millis(), (uint32_t)(segment - segments), segment->mode, segment->count, start_micros);
+  }
+}
+
+// Blend frames and write dithered colors to pixels
+void dither_pixels() {
+  // Data
+  segment_t *segment;
+  uint32_t blend, level, color;
+  bool shown = false;
+  for (uint8_t s = 0; s < SEGMENT_COUNT; s++) {
+    segment = &segments[s];
+    // Blend from last frame to current frame over the segment's frame period
+    blend = ((now_millis - segment->millis) << 8) / segment->period;
+    if (blend > 256) blend = 256;
+    if (segment == latency_segment && blend > 0) shown = true;
+    for (uint16_t p = segment->first; p < segment->first + segment->count; p++) {
+      color = 0;
+      for (uint8_t c = 0; c < 3; c++) {
+        level = (pixel_lasts[p * 3 + c] * (256 - blend) + pixel_levels[p * 3 + c] * blend) >> 8;
+        // Add the fraction not shown last time, show the whole part and carry the new fraction
+        level += dither_errors[p * 3 + c];
+        dither_errors[p * 3 + c] = level & 0xFF;
+        color = (color << 8) | (level >> 8);
       }
-      pixels.end_transfer();
-      interrupts();
-      // Get ready for next iteration (bounce around the edges of the noise)
-      if (noise_row == 0) noise_row_sub = false;
-      else if (noise_row >= NOISE_HEIGHT - 1) noise_row_sub = true;
-      if (noise_row_sub) noise_row -= 1;
-      else noise_row += 1;
-      if (noise_col == 0) noise_col_sub = false;
-      else if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-      if (noise_col_sub) noise_col -= 1;
-      else noise_col += 1;
-      break;
-
-    // Fast, long noise diagonal around noise image ?
-    case PIXEL_MODE_NOISE_FAST_LONG:
-    default:
-      index = (noise_row * NOISE_WIDTH) + noise_col;
-      noInterrupts();
-      for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
-        pixels.set_pixel(1, gradient_long_reds[noise[index + p]], gradient_long_greens[noise[index + p]], gradient_long_blues[noise[index + p]], 100, false);
+      frame[p] = color;
+    }
+  }
+  // Write frame, transmitted in the background with interrupts enabled
+  ws2812_write(frame, PIXEL_COUNT);
+  // First frame showing a change ?
+  if (shown) {
+    latency_segment = NULL;
+    latency_last = micros() - latency_micros;
+    if (latency_last > latency_max) latency_max = latency_last;
+    DEBUG_PRINTF("\n%u: latency = %uus, max = %uus", millis(), latency_last, latency_max);
+  }
+}
+
+// Write one color to all pixels
+void fill_pixels(uint32_t color) {
+  for (uint16_t p = 0; p < PIXEL_COUNT; p++) {
+    frame[p] = color;
+  }
+  ws2812_write(frame, PIXEL_COUNT);
+}
+
+// Palette indexes for solid modes, single color palette
+const uint16_t *index_solid(segment_t *segment, uint32_t step) {
+  memset(pixel_indexes, 0, segment->count * sizeof(uint16_t));
+  return pixel_indexes;
+}
+
+// Palette indexes for gradient modes, gradient moves backwards and forwards along pixels
+const uint16_t *index_gradient(segment_t *segment, uint32_t step) {
+  // Data
+  uint32_t index = segment->gradient_index;
+  bool sub = segment->gradient_sub;
+  uint32_t half = segment->count / 2;
+  for (uint16_t p = 0; p < segment->count; p++) {
+    // Ensure all pixels get set to first color at start of gradient
+    if (index < (half << 8)) pixel_indexes[p] = 0;
+    // Ensure all pixels get set to last color at end of gradient
+    else if (index > ((GRADIENT_COUNT + half - 1) << 8)) pixel_indexes[p] = (GRADIENT_COUNT - 1) << 8;
+    // Use gradient color when in gradient
+    else pixel_indexes[p] = index - (half << 8);
+    // Next gradient index
+    bounce(&index, &sub, 1 << 8, (GRADIENT_COUNT + segment->count - 1) << 8);
+  }
+  // Next iteration
+  bounce(&segment->gradient_index, &segment->gradient_sub, step, (GRADIENT_COUNT + segment->count - 1) << 8);
+  return pixel_indexes;
+}
+
+// Palette indexes for slow noise modes, noise values are the indexes
+const uint16_t *index_noise_slow(segment_t *segment, uint32_t step) {
+  read_noise(segment);
+  // Get ready for next iteration
+  next_noise(segment, false, step);
+  return pixel_indexes;
+}
+
+// Palette indexes for fast noise modes, noise values are the indexes
+const uint16_t *index_noise_fast(segment_t *segment, uint32_t step) {
+  read_noise(segment);
+  // Get ready for next iteration
+  next_noise(segment, true, step);
+  return pixel_indexes;
+}
+
+// Read noise values for current frame, interpolated between the surrounding noise values
+void read_noise(segment_t *segment) {
+  // Data
+  uint32_t row = segment->noise_row >> 8;
+  uint32_t col = segment->noise_col >> 8;
+  int32_t col_fraction = segment->noise_col & 0xFF;
+  int32_t row_fraction = segment->noise_row & 0xFF;
+  uint32_t rows[2] = { row, row + 1 };
+  int8_t entries[2] = { -1, -1 };
+  bool used[2] = { false, false };
+  const uint8_t *above, *below;
+  int32_t top, bottom;
+#if NOISE_PACKED
+  // Stay inside the noise image
+  if (rows[1] > NOISE_HEIGHT - 1) rows[1] = NOISE_HEIGHT - 1;
+#endif
+  // Use rows already in the cache, moving by less than a row per frame reuses both
+  for (uint8_t r = 0; r < 2; r++) {
+    for (uint8_t e = 0; e < 2; e++) {
+      if (!used[e] && segment->noise_cache_rows[e] == rows[r] && segment->noise_cache_cols[e] == col) {
+        entries[r] = e;
+        used[e] = true;
+        break;
       }
-      pixels.end_transfer();
-      interrupts();
-      // Get ready for next iteration (bounce around the edges of the noise)
-      if (noise_row == 0) noise_row_sub = false;
-      else if (noise_row >= NOISE_HEIGHT - 1) noise_row_sub = true;
-      if (noise_row_sub) noise_row -= 1;
-      else noise_row += 1;
-      if (noise_col == 0) noise_col_sub = false;
-      else if (noise_col + PIXEL_COUNT >= NOISE_WIDTH - 1) noise_col_sub = true;
-      if (noise_col_sub) noise_col -= 1;
-      else noise_col += 1;
-      break;
+    }
+  }
+  // Read missing rows into unused cache entries
+  for (uint8_t r = 0; r < 2; r++) {
+    if (entries[r] < 0) {
+      entries[r] = used[0] ? 1 : 0;
+      used[entries[r]] = true;
+      segment->noise_cache_rows[entries[r]] = rows[r];
+      segment->noise_cache_cols[entries[r]] = col;
+#if NOISE_PACKED
+      // Decode segment of noise image row
+      noise_unpack_row(noise_bits, noise_rows[rows[r]], noise_blocks[rows[r]], col, segment->noise_cache[entries[r]], segment->count + 1);
+#else
+      // Generate segment of noise field row
+      noise_gen_row(col, rows[r], segment->noise_cache[entries[r]], segment->count + 1);
+#endif
+    }
   }
+  above = segment->noise_cache[entries[0]];
+  below = segment->noise_cache[entries[1]];
+  // Interpolate along then between rows
+  for (uint16_t p = 0; p < segment->count; p++) {
+    top = (above[p] << 8) + (above[p + 1] - above[p]) * col_fraction;
+    bottom = (below[p] << 8) + (below[p + 1] - below[p]) * col_fraction;
+    pixel_indexes[p] = (top * (256 - row_fraction) + bottom * row_fraction) >> 8;
+  }
+}
+
+// Move through noise for next frame, down or diagonally
+void next_noise(segment_t *segment, bool diagonal, uint32_t step) {
+#if NOISE_PACKED
+  // Diagonal ?
+  if (diagonal) {
+    // Bounce around the edges of the noise
+    bounce(&segment->noise_row, &segment->noise_row_sub, step, (NOISE_HEIGHT - 1) << 8);
+    bounce(&segment->noise_col, &segment->noise_col_sub, step, (NOISE_WIDTH - 1 - segment->count) << 8);
+  }
+  // Down ?
+  else {
+    // Work up and down and backwards and forwards around the edges of the noise
+    if (bounce(&segment->noise_row, &segment->noise_row_sub, step, (NOISE_HEIGHT - 1) << 8)) {
+      bounce(&segment->noise_col, &segment->noise_col_sub, 1 << 8, (NOISE_WIDTH - 1 - segment->count) << 8);
+    }
+  }
+#else
+  // The noise field has no edges, keep moving
+  segment->noise_row += step;
+  if (diagonal) segment->noise_col += step;
+#endif
+}
+
+// Move index backwards and forwards between 0 and max, reflecting off the ends, returns true when reflected
+bool bounce(uint32_t *index, bool *sub, uint32_t step, uint32_t max) {
+  if (*sub) {
+    if (*index <= step) {
+      *index = step - *index;
+      *sub = false;
+      return true;
+    }
+    *index -= step;
+  } else {
+    if (*index + step >= max) {
+      *index = max - (*index + step - max);
+      *sub = true;
+      return true;
+    }
+    *index += step;
+  }
+  return false;
+}
+
+// Start fading from the colors shown to new colors, call before the segment's colors change
+void start_fade(segment_t *segment) {
+  // Fade from the colors currently shown, part way through a fade these are a blend
+  for (uint8_t u = 0; u < 2; u++) {
+    segment->fade_colors[u] = blend_color(segment->fade_colors[u], segment->colors[u], segment->fade_level);
+  }
+  for (uint16_t i = 0; i < GRADIENT_COUNT; i++) {
+    segment->fade_shorts[i] = blend_color(segment->fade_shorts[i], segment->shorts[i], segment->fade_level);
+    segment->fade_longs[i] = blend_color(segment->fade_longs[i], segment->longs[i], segment->fade_level);
+  }
+  segment->fade_level = 0;
+}
+
+// Blend between packed colors, level from 0 (from) to 256 (to), green and blue are blended together
+uint32_t blend_color(uint32_t from, uint32_t to, uint32_t level) {
+  uint32_t gb = (((from & 0xFF00FF) * (256 - level) + (to & 0xFF00FF) * level) >> 8) & 0xFF00FF;
+  uint32_t r = (((from & 0x00FF00) * (256 - level) + (to & 0x00FF00) * level) >> 8) & 0x00FF00;
+  return gb | r;
 }
 
 // Fast HSV to RGB conversion
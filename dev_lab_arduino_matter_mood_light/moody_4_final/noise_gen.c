@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Procedural noise generator
+ *
+ * Follows FastNoiseLite's OpenSimplex2 (2D) and ridged fractal using 16.16
+ * fixed point. Gradients, hash and constants match so the look is the same,
+ * values will differ slightly from the floating point version.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "noise_gen.h"
+
+// Fixed point constants (16.16 unless noted)
+#define NOISE_GEN_ONE 65536         // 1.0
+#define NOISE_GEN_HALF 32768        // 0.5, simplex kernel radius squared
+#define NOISE_GEN_RADIUS 46340      // sqrt(0.5), kernel is zero beyond this
+#define NOISE_GEN_F2 23988          // Skew factor (sqrt(3) - 1) / 2
+#define NOISE_GEN_G2 13849          // Unskew factor (3 - sqrt(3)) / 6
+#define NOISE_GEN_G2_2_1 (-37837)   // 2 * G2 - 1
+#define NOISE_GEN_NORMALISE 6542908 // Output scale 99.83685 to reach +/-1.0
+#define NOISE_GEN_PRIME_X 501125321u
+#define NOISE_GEN_PRIME_Y 1136930381u
+#define NOISE_GEN_HASH 0x27d4eb2du
+#define NOISE_GEN_POS_BITS 24       // Fraction bits of positions, extra bits stop steps drifting along a row
+
+// Gradients, 24 unit vectors 15 degrees apart (2.14 fixed point)
+static const int16_t noise_gen_gradients[24][2] = {
+  { 16244, 2139 }, { 15137, 6270 }, { 12998, 9974 }, { 9974, 12998 }, { 6270, 15137 }, { 2139, 16244 },
+  { -2139, 16244 }, { -6270, 15137 }, { -9974, 12998 }, { -12998, 9974 }, { -15137, 6270 }, { -16244, 2139 },
+  { -16244, -2139 }, { -15137, -6270 }, { -12998, -9974 }, { -9974, -12998 }, { -6270, -15137 }, { -2139, -16244 },
+  { 2139, -16244 }, { 6270, -15137 }, { 9974, -12998 }, { 12998, -9974 }, { 15137, -6270 }, { 16244, -2139 }
+};
+
+// Settings
+static int32_t noise_gen_seed = 1337;                       // Seed of first octave
+static uint8_t noise_gen_octaves = 2;                       // Fractal octaves
+static uint32_t noise_gen_steps[NOISE_GEN_OCTAVES_MAX];     // Noise distance per pixel for each octave (8.24 fixed point)
+static uint32_t noise_gen_skews[NOISE_GEN_OCTAVES_MAX];     // Skew per pixel for each octave (8.24 fixed point)
+static int32_t noise_gen_amps[NOISE_GEN_OCTAVES_MAX];       // Amplitude of each octave
+static int32_t noise_gen_black = -39322;                    // Noise value mapped to 0
+static int32_t noise_gen_white = 45875;                     // Noise value mapped to 255
+static uint32_t noise_gen_level = 0;                        // Level scale (8.24 fixed point)
+
+// Contribution of one simplex corner (8.24 fixed point)
+static inline int32_t noise_gen_corner(int32_t seed, uint32_t xp, uint32_t yp, int32_t dx, int32_t dy) {
+  uint32_t ax = (dx < 0) ? -dx : dx;
+  uint32_t ay = (dy < 0) ? -dy : dy;
+  int32_t a, a2, a4, dot;
+  uint32_t hash;
+  const int16_t *gradient;
+  // Outside kernel ? Also keeps the squares below in range
+  if (ax >= NOISE_GEN_RADIUS || ay >= NOISE_GEN_RADIUS) return 0;
+  a = NOISE_GEN_HALF - (int32_t)((ax * ax) >> 16) - (int32_t)((ay * ay) >> 16);
+  if (a <= 0) return 0;
+  // Falloff a^4
+  a2 = (a * a) >> 16;
+  a4 = (a2 * a2) >> 8;
+  // Pick gradient
+  hash = ((uint32_t)seed ^ xp ^ yp) * NOISE_GEN_HASH;
+  hash ^= hash >> 15;
+  gradient = noise_gen_gradients[((hash >> 16) * 24) >> 16];
+  dot = (dx * gradient[0] + dy * gradient[1]) >> 14;
+  return (int32_t)(((int64_t)a4 * dot) >> 16);
+}
+
+// OpenSimplex2 noise at a skewed position, cell and fraction (16.16 fixed point)
+static int32_t noise_gen_simplex(int32_t seed, uint32_t i, uint32_t j, int32_t xi, int32_t yi) {
+  int32_t t = ((xi + yi) * NOISE_GEN_G2) >> 16;
+  int32_t x0 = xi - t;
+  int32_t y0 = yi - t;
+  uint32_t xp = i * NOISE_GEN_PRIME_X;
+  uint32_t yp = j * NOISE_GEN_PRIME_Y;
+  int32_t n;
+  // First and last corners
+  n = noise_gen_corner(seed, xp, yp, x0, y0);
+  n += noise_gen_corner(seed, xp + NOISE_GEN_PRIME_X, yp + NOISE_GEN_PRIME_Y, x0 + NOISE_GEN_G2_2_1, y0 + NOISE_GEN_G2_2_1);
+  // Middle corner depends on which triangle
+  if (y0 > x0) {
+    n += noise_gen_corner(seed, xp, yp + NOISE_GEN_PRIME_Y, x0 + NOISE_GEN_G2, y0 + NOISE_GEN_G2 - NOISE_GEN_ONE);
+  } else {
+    n += noise_gen_corner(seed, xp + NOISE_GEN_PRIME_X, yp, x0 + NOISE_GEN_G2 - NOISE_GEN_ONE, y0 + NOISE_GEN_G2);
+  }
+  // Scale to +/-1.0
+  return (int32_t)(((int64_t)n * NOISE_GEN_NORMALISE) >> 24);
+}
+
+// Set up the noise field
+void noise_gen_init(int32_t seed, uint16_t scale, uint8_t octaves, int16_t black, int16_t white) {
+  int32_t bounding = 0;
+  int32_t amp = NOISE_GEN_ONE;
+  // Limit settings
+  if (scale == 0) scale = 1;
+  if (octaves < 1) octaves = 1;
+  if (octaves > NOISE_GEN_OCTAVES_MAX) octaves = NOISE_GEN_OCTAVES_MAX;
+  if (black < -1000) black = -1000;
+  if (white > 1000) white = 1000;
+  if (white <= black) white = black + 1;
+  noise_gen_seed = seed;
+  noise_gen_octaves = octaves;
+  // Each octave has double the frequency and half the amplitude of the last
+  for (uint8_t o = 0; o < octaves; o++) {
+    noise_gen_steps[o] = ((uint32_t)1 << (NOISE_GEN_POS_BITS + o)) / scale;
+    noise_gen_skews[o] = (uint32_t)(((uint64_t)noise_gen_steps[o] * NOISE_GEN_F2) >> 16);
+    bounding += amp;
+    amp >>= 1;
+  }
+  // Amplitudes sum to 1.0
+  amp = NOISE_GEN_ONE;
+  for (uint8_t o = 0; o < octaves; o++) {
+    noise_gen_amps[o] = (int32_t)(((int64_t)amp << 16) / bounding);
+    amp >>= 1;
+  }
+  // Levels
+  noise_gen_black = ((int32_t)black * NOISE_GEN_ONE) / 1000;
+  noise_gen_white = ((int32_t)white * NOISE_GEN_ONE) / 1000;
+  noise_gen_level = ((uint32_t)255 << 24) / (uint32_t)(noise_gen_white - noise_gen_black);
+}
+
+// Generate count values along row y starting at column x
+void noise_gen_row(uint32_t x, uint32_t y, uint8_t *values, uint16_t count) {
+  uint64_t xs[NOISE_GEN_OCTAVES_MAX];
+  uint64_t ys[NOISE_GEN_OCTAVES_MAX];
+  int32_t sum, n;
+  // Skewed start position of each octave, moving along the row only adds
+  for (uint8_t o = 0; o < noise_gen_octaves; o++) {
+    uint64_t skew = ((uint64_t)x + y) * noise_gen_skews[o];
+    xs[o] = (uint64_t)x * noise_gen_steps[o] + skew;
+    ys[o] = (uint64_t)y * noise_gen_steps[o] + skew;
+  }
+  for (uint16_t p = 0; p < count; p++) {
+    // Ridged fractal
+    sum = 0;
+    for (uint8_t o = 0; o < noise_gen_octaves; o++) {
+      n = noise_gen_simplex(noise_gen_seed + o,
+                            (uint32_t)(xs[o] >> NOISE_GEN_POS_BITS), (uint32_t)(ys[o] >> NOISE_GEN_POS_BITS),
+                            (int32_t)(xs[o] >> (NOISE_GEN_POS_BITS - 16)) & 0xFFFF,
+                            (int32_t)(ys[o] >> (NOISE_GEN_POS_BITS - 16)) & 0xFFFF);
+      if (n < 0) n = -n;
+      sum += (int32_t)(((int64_t)(NOISE_GEN_ONE - 2 * n) * noise_gen_amps[o]) >> 16);
+      xs[o] += noise_gen_steps[o] + noise_gen_skews[o];
+      ys[o] += noise_gen_skews[o];
+    }
+    // Map black to white points onto 0-255
+    if (sum <= noise_gen_black) values[p] = 0;
+    else if (sum >= noise_gen_white) values[p] = 255;
+    else values[p] = ((uint32_t)(sum - noise_gen_black) * noise_gen_level) >> 24;
+  }
+}
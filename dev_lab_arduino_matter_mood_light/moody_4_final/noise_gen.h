@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Procedural noise generator
+ *
+ * Fixed point OpenSimplex2 noise with a ridged fractal, producing the same
+ * style of field as the FastNoiseLite images previously stored in noise.h and
+ * noise_subtle.h. Only the values needed for each frame are generated so the
+ * field is unbounded and animations never repeat.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef NOISE_GEN_H
+#define NOISE_GEN_H
+
+#include <stdint.h>
+
+#define NOISE_GEN_OCTAVES_MAX 4  // Maximum number of fractal octaves
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Set up the noise field
+//   seed    - selects a different field
+//   scale   - feature size in pixels (FastNoiseLite frequency = 1 / scale)
+//   octaves - fractal octaves, 1 to NOISE_GEN_OCTAVES_MAX
+//   black   - noise value mapped to 0, in 1/1000ths (-1000 to 1000)
+//   white   - noise value mapped to 255, in 1/1000ths (-1000 to 1000)
+void noise_gen_init(int32_t seed, uint16_t scale, uint8_t octaves, int16_t black, int16_t white);
+
+// Generate count values along row y starting at column x
+void noise_gen_row(uint32_t x, uint32_t y, uint8_t *values, uint16_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NOISE_GEN_H
@@ -0,0 +1,4488 @@
+// Generated by pack_noise.py from noise_subtle.h, do not edit
+//
+// 230119 bytes packed into 70054 bytes
+
+#define NOISE_HEIGHT 359
+#define NOISE_WIDTH 641
+#define NOISE_BLOCKS 6
+
+// Bit offset of each row << 8 | Rice parameter
+const uint32_t noise_rows[] = {
+  0x00000000, 0x00055b00, 0x000a9f00, 0x000ff500, 0x00154900, 0x001a8f00, 0x001fe700, 0x00251d00,
+  0x002a5000, 0x002f6800, 0x00349e00, 0x0039dd00, 0x003f2600, 0x00447a00, 0x0049c500, 0x004f2d00,
+  0x00549400, 0x0059ee00, 0x005f3900, 0x00647b00, 0x0069c700, 0x006ee600, 0x00740200, 0x00791800,
+  0x007e8300, 0x0083df00, 0x00893f00, 0x008ea400, 0x00941b00, 0x00999500, 0x009f1200, 0x00a4ab00,
+  0x00a9e600, 0x00af2600, 0x00b45a00, 0x00b9a400, 0x00bef600, 0x00c44e00, 0x00c9ab00, 0x00cf1b00,
+  0x00d48800, 0x00d9e800, 0x00df4300, 0x00e4c700, 0x00ea5d00, 0x00efe700, 0x00f57900, 0x00fb2800,
+  0x0100af00, 0x01066900, 0x010bee00, 0x01116b00, 0x0116e900, 0x011c9500, 0x01221700, 0x0127d500,
+  0x012d9c00, 0x01337d00, 0x01391600, 0x013f1700, 0x01451200, 0x014afc00, 0x0150d900, 0x0156d100,
+  0x015ca500, 0x01629600, 0x01686900, 0x016e6400, 0x01743100, 0x017a3a00, 0x017ff600, 0x01859600,
+  0x018b5a00, 0x01912600, 0x0196e000, 0x019c6900, 0x01a20300, 0x01a79c00, 0x01ad3c00, 0x01b2ea00,
+  0x01b89d00, 0x01be3300, 0x01c3dc00, 0x01c97700, 0x01cf2a00, 0x01d4ef00, 0x01da7f00, 0x01dff900,
+  0x01e55900, 0x01eab100, 0x01f02500, 0x01f5b300, 0x01fb3f00, 0x0200a800, 0x02063200, 0x020ba900,
+  0x02111a00, 0x02165c00, 0x021bd300, 0x02216500, 0x02270600, 0x022c9400, 0x02321500, 0x02379e00,
+  0x023cda00, 0x02424100, 0x0247de00, 0x024d7100, 0x02531b00, 0x0258b600, 0x025e4800, 0x0263e400,
+  0x02695600, 0x026edf00, 0x02748700, 0x027a7c00, 0x02807f00, 0x02865e00, 0x028c5900, 0x02923b00,
+  0x02981d00, 0x029df500, 0x02a40c00, 0x02a9df00, 0x02afb600, 0x02b5be00, 0x02bbd100, 0x02c1e800,
+  0x02c7fd00, 0x02ce0000, 0x02d41a00, 0x02da2200, 0x02e02b00, 0x02e64d00, 0x02ec3a00, 0x02f1ee00,
+  0x02f7df00, 0x02fdb400, 0x03039300, 0x03097900, 0x030f4900, 0x03152500, 0x031b0500, 0x0320d900,
+  0x03270700, 0x032d0e00, 0x03332900, 0x03390700, 0x033f1c00, 0x03455400, 0x034b8700, 0x0351a500,
+  0x0357cc00, 0x035dcd00, 0x03640d00, 0x036a4800, 0x03704200, 0x03762b00, 0x037c5b00, 0x03825f00,
+  0x03887600, 0x038e7900, 0x03945500, 0x039a0200, 0x039fba00, 0x03a58000, 0x03ab1a00, 0x03b10400,
+  0x03b6da00, 0x03bcb300, 0x03c26d00, 0x03c83b00, 0x03ce3000, 0x03d40600, 0x03d9df00, 0x03dfef00,
+  0x03e5ef00, 0x03ec0300, 0x03f1e100, 0x03f7fd00, 0x03fdf900, 0x04041700, 0x040a2600, 0x04105000,
+  0x04166a00, 0x041ca000, 0x0422a900, 0x0428a400, 0x042ea900, 0x04348400, 0x043a6f00, 0x04403500,
+  0x04462300, 0x044c2a00, 0x0451f700, 0x0457cc00, 0x045da600, 0x04636600, 0x04694f00, 0x046f5400,
+  0x04753d00, 0x047b0f00, 0x0480ed00, 0x0486f100, 0x048cf400, 0x04930600, 0x04994700, 0x049f7e00,
+  0x04a5c600, 0x04abc500, 0x04b1d600, 0x04b81400, 0x04be4900, 0x04c45c00, 0x04ca6e00, 0x04d08b00,
+  0x04d67c00, 0x04dc9400, 0x04e29200, 0x04e88900, 0x04ee7b00, 0x04f44500, 0x04f9df00, 0x04ff5f00,
+  0x05050400, 0x050a8100, 0x050ffa00, 0x0515ad00, 0x051b2b00, 0x0520b000, 0x05263800, 0x052b9a00,
+  0x05312e00, 0x0536b100, 0x053c1900, 0x05418500, 0x0546e600, 0x054c1800, 0x05515b00, 0x0556aa00,
+  0x055bcf00, 0x05612100, 0x05669400, 0x056c0000, 0x05717800, 0x0576ea00, 0x057c5900, 0x0581b600,
+  0x0586ff00, 0x058c4d00, 0x0591a400, 0x0596db00, 0x059c2f00, 0x05a15c00, 0x05a67400, 0x05ab7d00,
+  0x05b0a000, 0x05b5b800, 0x05bac400, 0x05bfeb00, 0x05c50e00, 0x05ca0800, 0x05cf4f00, 0x05d48b00,
+  0x05da0200, 0x05df5900, 0x05e4ee00, 0x05ea9700, 0x05f04700, 0x05f5ec00, 0x05fb9300, 0x06014900,
+  0x0606d200, 0x060cdb00, 0x0612c900, 0x0618cb00, 0x061eaa00, 0x06248100, 0x062a3a00, 0x062fde00,
+  0x0635a200, 0x063b6b00, 0x06413100, 0x0646ee00, 0x064cd100, 0x0652ce00, 0x06588100, 0x065e6000,
+  0x06642d00, 0x0669de00, 0x066fc900, 0x0675d200, 0x067bcb00, 0x0681cd00, 0x0687a800, 0x068d8900,
+  0x06935c00, 0x06993d00, 0x069f6700, 0x06a57800, 0x06ab7e00, 0x06b15a00, 0x06b75300, 0x06bd4600,
+  0x06c33300, 0x06c8fa00, 0x06cea000, 0x06d47500, 0x06da5000, 0x06e04a00, 0x06e5f400, 0x06eb9e00,
+  0x06f15200, 0x06f6eb00, 0x06fc8400, 0x07023c00, 0x07080100, 0x070d9d00, 0x07132d00, 0x07190100,
+  0x071eab00, 0x07245300, 0x072a0d00, 0x072fc400, 0x07357800, 0x073af500, 0x0740a600, 0x07463300,
+  0x074bb100, 0x07513a00, 0x07569a00, 0x075c0e00, 0x07614700, 0x07668b00, 0x076bc100, 0x0770f600,
+  0x07762500, 0x077b4300, 0x07805700, 0x07858100, 0x078a9600, 0x078fe200, 0x07952600, 0x079a6800,
+  0x079fa900, 0x07a4e500, 0x07aa2800, 0x07af7600, 0x07b4f300, 0x07ba6600, 0x07bfd400, 0x07c51900,
+  0x07ca6400, 0x07cfdd00, 0x07d51c00, 0x07da7900, 0x07dfc100, 0x07e50700, 0x07ea7800,
+};
+
+// Bit offset of each block after the first from the start of its row
+const uint16_t noise_blocks[][NOISE_BLOCKS - 1] = {
+  { 236, 523, 757, 1063, 1363 },
+  { 252, 504, 746, 1014, 1340 },
+  { 243, 499, 754, 1052, 1358 },
+  { 247, 500, 757, 1056, 1356 },
+  { 230, 485, 734, 1010, 1342 },
+  { 216, 481, 740, 1039, 1360 },
+  { 220, 477, 724, 1006, 1326 },
+  { 221, 472, 731, 1024, 1323 },
+  { 217, 467, 706, 993, 1296 },
+  { 229, 497, 735, 1019, 1326 },
+  { 227, 489, 743, 1023, 1335 },
+  { 240, 504, 749, 1042, 1345 },
+  { 239, 528, 793, 1056, 1356 },
+  { 238, 509, 782, 1058, 1347 },
+  { 244, 499, 768, 1069, 1376 },
+  { 255, 513, 793, 1074, 1375 },
+  { 244, 496, 789, 1069, 1362 },
+  { 245, 493, 776, 1065, 1347 },
+  { 261, 487, 755, 1043, 1338 },
+  { 267, 500, 773, 1056, 1348 },
+  { 253, 478, 749, 1017, 1303 },
+  { 273, 488, 757, 1003, 1300 },
+  { 288, 501, 773, 1020, 1294 },
+  { 301, 539, 825, 1098, 1379 },
+  { 308, 537, 809, 1089, 1364 },
+  { 306, 539, 815, 1088, 1368 },
+  { 289, 523, 833, 1107, 1373 },
+  { 323, 547, 848, 1108, 1391 },
+  { 287, 519, 815, 1102, 1394 },
+  { 317, 545, 848, 1108, 1397 },
+  { 315, 547, 848, 1128, 1425 },
+  { 299, 534, 800, 1056, 1331 },
+  { 302, 549, 804, 1064, 1336 },
+  { 300, 545, 788, 1040, 1324 },
+  { 286, 547, 809, 1052, 1346 },
+  { 291, 548, 810, 1054, 1354 },
+  { 285, 548, 811, 1069, 1360 },
+  { 294, 559, 815, 1063, 1365 },
+  { 301, 570, 838, 1084, 1384 },
+  { 291, 574, 835, 1088, 1381 },
+  { 289, 551, 832, 1082, 1368 },
+  { 286, 566, 829, 1069, 1363 },
+  { 295, 593, 876, 1107, 1404 },
+  { 271, 576, 859, 1116, 1422 },
+  { 304, 601, 886, 1119, 1410 },
+  { 289, 584, 882, 1125, 1418 },
+  { 290, 586, 898, 1166, 1447 },
+  { 272, 559, 846, 1097, 1407 },
+  { 288, 584, 899, 1147, 1458 },
+  { 288, 588, 871, 1116, 1405 },
+  { 297, 584, 867, 1109, 1397 },
+  { 301, 584, 869, 1133, 1398 },
+  { 283, 569, 866, 1135, 1444 },
+  { 291, 572, 844, 1125, 1402 },
+  { 296, 606, 902, 1182, 1462 },
+  { 292, 609, 908, 1183, 1471 },
+  { 315, 633, 903, 1182, 1497 },
+  { 276, 585, 865, 1147, 1425 },
+  { 317, 622, 918, 1243, 1529 },
+  { 314, 631, 933, 1218, 1523 },
+  { 307, 618, 926, 1214, 1506 },
+  { 296, 618, 915, 1196, 1493 },
+  { 295, 614, 913, 1221, 1520 },
+  { 294, 604, 886, 1180, 1484 },
+  { 305, 605, 911, 1208, 1513 },
+  { 289, 586, 862, 1176, 1483 },
+  { 290, 602, 897, 1221, 1523 },
+  { 287, 602, 870, 1175, 1477 },
+  { 282, 603, 869, 1210, 1537 },
+  { 266, 574, 838, 1149, 1460 },
+  { 283, 597, 840, 1142, 1432 },
+  { 296, 609, 878, 1172, 1468 },
+  { 290, 602, 861, 1161, 1476 },
+  { 283, 581, 848, 1139, 1458 },
+  { 262, 561, 810, 1099, 1409 },
+  { 272, 577, 839, 1105, 1426 },
+  { 294, 600, 854, 1122, 1425 },
+  { 284, 598, 871, 1146, 1432 },
+  { 297, 608, 871, 1147, 1446 },
+  { 308, 604, 882, 1146, 1451 },
+  { 302, 592, 887, 1130, 1422 },
+  { 296, 596, 895, 1154, 1441 },
+  { 320, 616, 894, 1155, 1427 },
+  { 302, 610, 895, 1157, 1451 },
+  { 286, 616, 892, 1149, 1469 },
+  { 279, 573, 868, 1107, 1416 },
+  { 275, 583, 852, 1099, 1394 },
+  { 264, 568, 847, 1094, 1368 },
+  { 271, 564, 839, 1099, 1360 },
+  { 256, 552, 823, 1099, 1388 },
+  { 278, 587, 857, 1129, 1414 },
+  { 273, 578, 858, 1115, 1412 },
+  { 270, 552, 816, 1084, 1377 },
+  { 266, 585, 846, 1119, 1410 },
+  { 287, 584, 852, 1115, 1391 },
+  { 280, 563, 821, 1085, 1385 },
+  { 271, 525, 761, 1032, 1338 },
+  { 271, 548, 792, 1071, 1391 },
+  { 264, 534, 776, 1082, 1418 },
+  { 297, 566, 799, 1093, 1433 },
+  { 289, 560, 795, 1076, 1414 },
+  { 265, 535, 756, 1057, 1401 },
+  { 277, 534, 767, 1053, 1409 },
+  { 270, 514, 730, 988, 1332 },
+  { 245, 517, 728, 1023, 1375 },
+  { 275, 532, 751, 1053, 1429 },
+  { 275, 534, 760, 1057, 1419 },
+  { 277, 544, 791, 1086, 1442 },
+  { 266, 538, 786, 1079, 1427 },
+  { 268, 532, 772, 1077, 1418 },
+  { 275, 541, 778, 1090, 1428 },
+  { 256, 512, 752, 1060, 1386 },
+  { 265, 522, 765, 1080, 1409 },
+  { 273, 542, 777, 1112, 1440 },
+  { 305, 573, 815, 1154, 1517 },
+  { 298, 582, 820, 1173, 1531 },
+  { 282, 574, 822, 1171, 1495 },
+  { 279, 568, 833, 1185, 1523 },
+  { 289, 550, 805, 1170, 1498 },
+  { 295, 592, 821, 1192, 1498 },
+  { 290, 552, 804, 1165, 1488 },
+  { 306, 612, 863, 1234, 1551 },
+  { 293, 574, 827, 1181, 1483 },
+  { 295, 591, 845, 1190, 1487 },
+  { 302, 588, 857, 1211, 1536 },
+  { 321, 613, 858, 1215, 1547 },
+  { 293, 601, 869, 1230, 1551 },
+  { 300, 593, 858, 1227, 1549 },
+  { 302, 590, 852, 1208, 1531 },
+  { 299, 607, 877, 1239, 1554 },
+  { 323, 600, 873, 1229, 1536 },
+  { 293, 590, 843, 1213, 1537 },
+  { 311, 612, 864, 1230, 1562 },
+  { 302, 603, 847, 1195, 1509 },
+  { 281, 581, 821, 1159, 1452 },
+  { 306, 612, 867, 1216, 1513 },
+  { 301, 599, 834, 1192, 1485 },
+  { 291, 597, 843, 1204, 1495 },
+  { 308, 600, 853, 1204, 1502 },
+  { 303, 600, 839, 1190, 1480 },
+  { 296, 596, 845, 1204, 1492 },
+  { 283, 602, 848, 1217, 1496 },
+  { 293, 607, 857, 1218, 1484 },
+  { 329, 652, 917, 1291, 1574 },
+  { 286, 607, 883, 1245, 1535 },
+  { 323, 640, 891, 1255, 1555 },
+  { 302, 603, 851, 1211, 1494 },
+  { 322, 629, 905, 1273, 1549 },
+  { 313, 634, 922, 1295, 1584 },
+  { 313, 634, 918, 1274, 1579 },
+  { 317, 643, 907, 1266, 1558 },
+  { 313, 629, 913, 1269, 1567 },
+  { 288, 601, 879, 1231, 1529 },
+  { 294, 611, 916, 1280, 1592 },
+  { 304, 609, 889, 1259, 1587 },
+  { 293, 588, 856, 1215, 1522 },
+  { 286, 556, 826, 1186, 1505 },
+  { 299, 591, 887, 1252, 1576 },
+  { 285, 591, 888, 1221, 1532 },
+  { 295, 607, 911, 1267, 1551 },
+  { 288, 593, 899, 1246, 1531 },
+  { 288, 592, 878, 1215, 1492 },
+  { 283, 572, 865, 1150, 1445 },
+  { 313, 605, 893, 1171, 1456 },
+  { 302, 592, 860, 1156, 1470 },
+  { 293, 583, 849, 1131, 1426 },
+  { 308, 606, 904, 1190, 1506 },
+  { 315, 622, 879, 1180, 1486 },
+  { 300, 637, 910, 1183, 1489 },
+  { 318, 624, 898, 1164, 1458 },
+  { 317, 610, 877, 1147, 1478 },
+  { 295, 588, 868, 1155, 1517 },
+  { 304, 581, 837, 1108, 1486 },
+  { 315, 597, 869, 1122, 1489 },
+  { 340, 624, 925, 1174, 1544 },
+  { 327, 617, 881, 1147, 1528 },
+  { 323, 612, 888, 1165, 1548 },
+  { 332, 613, 876, 1138, 1494 },
+  { 338, 628, 901, 1173, 1556 },
+  { 308, 605, 866, 1157, 1524 },
+  { 322, 613, 886, 1167, 1558 },
+  { 321, 625, 903, 1180, 1543 },
+  { 314, 623, 900, 1176, 1570 },
+  { 311, 624, 902, 1168, 1554 },
+  { 322, 637, 931, 1200, 1582 },
+  { 306, 628, 924, 1187, 1537 },
+  { 287, 611, 874, 1139, 1523 },
+  { 278, 610, 887, 1155, 1533 },
+  { 267, 602, 859, 1122, 1491 },
+  { 273, 603, 878, 1146, 1507 },
+  { 255, 586, 857, 1106, 1470 },
+  { 261, 609, 886, 1150, 1510 },
+  { 264, 610, 897, 1168, 1535 },
+  { 290, 618, 899, 1158, 1477 },
+  { 268, 595, 868, 1160, 1485 },
+  { 266, 570, 865, 1179, 1490 },
+  { 251, 587, 867, 1159, 1464 },
+  { 266, 592, 874, 1193, 1505 },
+  { 276, 604, 918, 1234, 1533 },
+  { 260, 574, 881, 1195, 1505 },
+  { 264, 584, 872, 1178, 1482 },
+  { 275, 589, 875, 1185, 1494 },
+  { 273, 611, 874, 1228, 1532 },
+  { 307, 627, 898, 1232, 1531 },
+  { 292, 629, 918, 1243, 1546 },
+  { 321, 648, 945, 1285, 1593 },
+  { 305, 659, 935, 1262, 1583 },
+  { 288, 641, 936, 1277, 1600 },
+  { 293, 626, 896, 1220, 1527 },
+  { 298, 625, 902, 1241, 1545 },
+  { 310, 666, 949, 1274, 1590 },
+  { 305, 643, 916, 1267, 1581 },
+  { 291, 625, 884, 1224, 1547 },
+  { 285, 619, 877, 1202, 1546 },
+  { 284, 643, 897, 1211, 1557 },
+  { 283, 623, 876, 1203, 1513 },
+  { 272, 622, 867, 1230, 1552 },
+  { 273, 616, 866, 1218, 1526 },
+  { 264, 625, 878, 1194, 1519 },
+  { 280, 633, 893, 1210, 1514 },
+  { 272, 620, 873, 1181, 1474 },
+  { 279, 616, 851, 1132, 1426 },
+  { 256, 587, 817, 1119, 1400 },
+  { 280, 633, 870, 1157, 1437 },
+  { 271, 610, 845, 1149, 1397 },
+  { 288, 606, 848, 1131, 1393 },
+  { 297, 621, 893, 1184, 1451 },
+  { 271, 609, 867, 1145, 1398 },
+  { 296, 609, 871, 1162, 1405 },
+  { 296, 626, 888, 1167, 1408 },
+  { 297, 603, 872, 1136, 1370 },
+  { 324, 623, 885, 1166, 1420 },
+  { 320, 608, 881, 1159, 1403 },
+  { 321, 603, 858, 1136, 1376 },
+  { 325, 611, 891, 1139, 1380 },
+  { 315, 588, 859, 1121, 1369 },
+  { 312, 572, 838, 1104, 1322 },
+  { 330, 569, 819, 1086, 1339 },
+  { 345, 589, 846, 1105, 1351 },
+  { 331, 571, 808, 1077, 1309 },
+  { 346, 586, 856, 1110, 1354 },
+  { 355, 609, 849, 1131, 1387 },
+  { 358, 616, 861, 1151, 1380 },
+  { 355, 612, 852, 1142, 1392 },
+  { 359, 613, 856, 1161, 1386 },
+  { 352, 617, 856, 1154, 1383 },
+  { 375, 617, 855, 1143, 1365 },
+  { 352, 600, 831, 1124, 1345 },
+  { 372, 613, 849, 1135, 1350 },
+  { 338, 597, 836, 1133, 1359 },
+  { 337, 593, 825, 1121, 1327 },
+  { 342, 612, 861, 1164, 1356 },
+  { 339, 607, 821, 1115, 1317 },
+  { 325, 593, 817, 1100, 1296 },
+  { 303, 575, 794, 1085, 1281 },
+  { 339, 591, 807, 1097, 1307 },
+  { 305, 563, 796, 1068, 1296 },
+  { 277, 529, 752, 1038, 1284 },
+  { 277, 523, 763, 1046, 1311 },
+  { 281, 532, 760, 1037, 1307 },
+  { 251, 488, 721, 1012, 1266 },
+  { 279, 518, 755, 1066, 1343 },
+  { 264, 504, 756, 1057, 1332 },
+  { 279, 536, 787, 1091, 1391 },
+  { 270, 512, 762, 1068, 1359 },
+  { 284, 527, 785, 1115, 1421 },
+  { 280, 522, 788, 1131, 1441 },
+  { 279, 527, 777, 1118, 1448 },
+  { 270, 528, 779, 1127, 1437 },
+  { 288, 537, 801, 1117, 1439 },
+  { 301, 537, 792, 1128, 1454 },
+  { 289, 528, 791, 1103, 1409 },
+  { 314, 573, 844, 1170, 1537 },
+  { 306, 575, 849, 1176, 1510 },
+  { 311, 569, 832, 1167, 1530 },
+  { 293, 545, 800, 1140, 1495 },
+  { 314, 561, 818, 1144, 1487 },
+  { 297, 541, 810, 1130, 1457 },
+  { 301, 530, 779, 1116, 1436 },
+  { 305, 550, 800, 1154, 1468 },
+  { 279, 531, 806, 1149, 1473 },
+  { 290, 542, 809, 1143, 1470 },
+  { 269, 524, 810, 1157, 1461 },
+  { 296, 556, 825, 1163, 1499 },
+  { 295, 575, 865, 1207, 1525 },
+  { 283, 553, 823, 1142, 1451 },
+  { 281, 556, 832, 1172, 1495 },
+  { 293, 564, 843, 1172, 1477 },
+  { 297, 553, 831, 1137, 1449 },
+  { 291, 567, 860, 1179, 1507 },
+  { 282, 551, 864, 1197, 1537 },
+  { 308, 593, 870, 1188, 1521 },
+  { 301, 569, 856, 1195, 1530 },
+  { 279, 542, 824, 1158, 1491 },
+  { 313, 583, 847, 1165, 1497 },
+  { 279, 547, 835, 1168, 1483 },
+  { 286, 564, 838, 1169, 1497 },
+  { 314, 588, 891, 1232, 1570 },
+  { 293, 584, 886, 1217, 1545 },
+  { 275, 566, 871, 1209, 1534 },
+  { 289, 583, 857, 1171, 1492 },
+  { 313, 584, 872, 1184, 1521 },
+  { 294, 570, 864, 1185, 1515 },
+  { 294, 612, 881, 1197, 1509 },
+  { 288, 570, 854, 1154, 1471 },
+  { 272, 556, 830, 1124, 1438 },
+  { 270, 572, 835, 1156, 1485 },
+  { 278, 579, 855, 1155, 1491 },
+  { 277, 595, 885, 1183, 1522 },
+  { 253, 554, 822, 1117, 1442 },
+  { 269, 546, 798, 1081, 1442 },
+  { 268, 557, 828, 1096, 1452 },
+  { 272, 559, 812, 1079, 1425 },
+  { 278, 562, 807, 1073, 1425 },
+  { 294, 568, 842, 1118, 1456 },
+  { 292, 567, 835, 1134, 1469 },
+  { 287, 541, 819, 1077, 1428 },
+  { 277, 538, 807, 1077, 1416 },
+  { 312, 582, 854, 1116, 1484 },
+  { 286, 554, 824, 1094, 1442 },
+  { 289, 577, 835, 1104, 1440 },
+  { 296, 586, 861, 1106, 1458 },
+  { 283, 575, 856, 1113, 1455 },
+  { 290, 591, 866, 1107, 1452 },
+  { 261, 573, 845, 1067, 1397 },
+  { 271, 579, 896, 1120, 1449 },
+  { 252, 558, 842, 1093, 1413 },
+  { 245, 555, 851, 1094, 1398 },
+  { 246, 576, 866, 1100, 1409 },
+  { 222, 526, 816, 1046, 1368 },
+  { 246, 564, 856, 1094, 1388 },
+  { 246, 559, 819, 1052, 1329 },
+  { 249, 558, 857, 1083, 1340 },
+  { 237, 550, 840, 1066, 1326 },
+  { 239, 555, 844, 1075, 1325 },
+  { 241, 534, 817, 1064, 1319 },
+  { 240, 528, 808, 1050, 1302 },
+  { 242, 523, 817, 1046, 1292 },
+  { 247, 536, 825, 1064, 1314 },
+  { 244, 537, 800, 1033, 1293 },
+  { 256, 578, 842, 1084, 1348 },
+  { 251, 542, 823, 1068, 1340 },
+  { 235, 529, 827, 1073, 1338 },
+  { 238, 537, 807, 1059, 1337 },
+  { 246, 543, 819, 1060, 1332 },
+  { 247, 542, 810, 1072, 1339 },
+  { 271, 583, 841, 1091, 1350 },
+  { 290, 585, 871, 1133, 1397 },
+  { 278, 578, 855, 1114, 1387 },
+  { 280, 571, 852, 1124, 1382 },
+  { 273, 570, 827, 1073, 1341 },
+  { 299, 578, 843, 1088, 1347 },
+  { 282, 595, 859, 1111, 1393 },
+  { 274, 574, 842, 1087, 1335 },
+  { 284, 583, 851, 1096, 1365 },
+  { 290, 576, 834, 1079, 1344 },
+  { 301, 581, 838, 1076, 1342 },
+  { 298, 609, 862, 1114, 1385 },
+  { 312, 605, 856, 1114, 1403 },
+};
+
+// Packed rows
+const uint8_t noise_bits[] = {
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x5c, 0x30, 0xc6, 0xb3, 0x59, 0xfd, 0xff, 0xd9, 0x34, 0xd6, 0x0d,
+  0x6d, 0x66, 0x18, 0xc6, 0x61, 0x86, 0x03, 0x4d, 0x01, 0x68, 0x16, 0xb4, 0x69, 0xa1, 0x51, 0x51,
+  0xac, 0x6b, 0x0d, 0x63, 0x4c, 0x0d, 0x6b, 0x59, 0x68, 0x2d, 0x0b, 0x5a, 0x03, 0x5a, 0xcd, 0x63,
+  0x1b, 0xfe, 0xf9, 0x98, 0xc6, 0x67, 0xf7, 0xfd, 0x63, 0x58, 0xd7, 0xaf, 0x59, 0x99, 0x98, 0xda,
+  0xf1, 0x8d, 0xce, 0x4d, 0x7a, 0x60, 0x04, 0xdd, 0xa1, 0x2c, 0x00, 0x11, 0x86, 0x00, 0x00, 0x01,
+  0xff, 0xf7, 0x68, 0x1a, 0xc6, 0x1b, 0x5b, 0x18, 0xc6, 0x30, 0xd6, 0x6b, 0x58, 0xd6, 0xb2, 0xba,
+  0xd3, 0x5a, 0xc3, 0xff, 0xe6, 0x6b, 0x61, 0x9a, 0xf5, 0xeb, 0x31, 0x9a, 0xf5, 0x9a, 0xda, 0x00,
+  0x1d, 0xff, 0xfc, 0x18, 0x66, 0xbd, 0x6c, 0xcc, 0xd9, 0x99, 0xb1, 0x99, 0xff, 0x73, 0x19, 0x9b,
+  0x1e, 0xbc, 0x6c, 0x6c, 0x61, 0xff, 0xfe, 0x07, 0xff, 0xf7, 0xf5, 0x8d, 0x6c, 0x63, 0x66, 0xc6,
+  0xcd, 0x99, 0x99, 0x98, 0xc7, 0xfd, 0xff, 0xfc, 0x35, 0xeb, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xf1,
+  0x9a, 0xc6, 0xb5, 0xdf, 0xff, 0xed, 0x40, 0xd6, 0x61, 0xb0, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00,
+  0x07, 0x4d, 0x6d, 0x61, 0x83, 0x3f, 0xfe, 0xe2, 0x6b, 0x5a, 0xc1, 0x8d, 0x6d, 0x66, 0x30, 0xda,
+  0xda, 0xcd, 0x60, 0xd6, 0xb5, 0xa3, 0x4b, 0x5a, 0x02, 0xd6, 0x58, 0x34, 0x35, 0xa6, 0x06, 0x0d,
+  0x60, 0xd6, 0x01, 0xad, 0x68, 0x16, 0x82, 0x68, 0x06, 0xb5, 0x9a, 0xc6, 0x32, 0xb1, 0x98, 0xc3,
+  0xfe, 0xfe, 0xb3, 0x4c, 0xd6, 0x66, 0x33, 0x1b, 0x19, 0x98, 0xcd, 0x8d, 0xfb, 0x58, 0xcb, 0x05,
+  0xa6, 0xed, 0x08, 0x40, 0x20, 0x61, 0xaf, 0x58, 0x00, 0x00, 0x3f, 0xfb, 0xe6, 0x8d, 0x61, 0xaf,
+  0x59, 0x8c, 0x66, 0x19, 0xac, 0x60, 0x6b, 0x1a, 0x62, 0xeb, 0x01, 0xa6, 0x4f, 0xfa, 0xcc, 0x33,
+  0x18, 0xcc, 0x63, 0x31, 0x86, 0x00, 0x03, 0xff, 0xfb, 0x86, 0x18, 0x6c, 0x66, 0x6c, 0xcc, 0xcd,
+  0x8c, 0xc7, 0xdf, 0xd8, 0xcc, 0xd8, 0xd9, 0x9b, 0x19, 0x98, 0x7f, 0xff, 0x81, 0xff, 0xff, 0xed,
+  0xfd, 0x9a, 0xc6, 0x36, 0xbc, 0x6c, 0xcc, 0xd9, 0x99, 0x99, 0x8c, 0x7f, 0xff, 0xa5, 0xf1, 0xac,
+  0xc0, 0x00, 0x00, 0x00, 0x3f, 0xf6, 0x36, 0xb1, 0xad, 0x6f, 0xff, 0xf7, 0x0f, 0xff, 0xeb, 0x1a,
+  0xc6, 0x33, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x3e, 0xd6, 0x18, 0x60, 0xd7, 0xff, 0x75,
+  0x96, 0x9a, 0xcb, 0x6b, 0x5b, 0x59, 0xad, 0x86, 0x33, 0x0c, 0x60, 0x6b, 0x2c, 0xb5, 0xa0, 0x5a,
+  0xd0, 0x16, 0x08, 0x08, 0x35, 0xac, 0x6b, 0x03, 0x01, 0xac, 0xb1, 0xa1, 0xa2, 0xc9, 0xbb, 0x2d,
+  0x00, 0x69, 0xac, 0xd6, 0x6b, 0x68, 0x16, 0x60, 0x3f, 0xfb, 0xe0, 0x61, 0x8c, 0xd7, 0x86, 0xc6,
+  0x66, 0x36, 0x9a, 0x5b, 0x6d, 0xac, 0xd6, 0xb2, 0xc9, 0xab, 0x5a, 0xb4, 0x5a, 0x25, 0x83, 0x5b,
+  0x58, 0xc0, 0x00, 0x00, 0xff, 0xbf, 0xb5, 0xad, 0x61, 0x86, 0x33, 0x18, 0xc6, 0x18, 0x65, 0xe9,
+  0xac, 0x0d, 0x32, 0x33, 0xd9, 0xa3, 0x77, 0xfd, 0x8c, 0x63, 0x18, 0xda, 0xd8, 0x6d, 0x6d, 0x66,
+  0x00, 0x03, 0xfb, 0xff, 0x86, 0x0c, 0xd7, 0xad, 0x8d, 0x99, 0x99, 0xb1, 0x99, 0x85, 0xff, 0x19,
+  0x9b, 0x5e, 0x3d, 0x7a, 0xf5, 0xeb, 0x63, 0x1f, 0xff, 0xe0, 0x7f, 0xff, 0xfa, 0x26, 0xb6, 0xb3,
+  0x31, 0xb3, 0x33, 0x66, 0x66, 0x66, 0x61, 0xbb, 0xff, 0xfd, 0x2a, 0xda, 0xc6, 0x60, 0x00, 0x00,
+  0x00, 0x7f, 0xf8, 0xcd, 0x6d, 0x6b, 0x2f, 0xff, 0xf6, 0xde, 0x06, 0x19, 0x8c, 0x00, 0x07, 0xff,
+  0xf8, 0x00, 0x00, 0x00, 0xab, 0x19, 0x6d, 0x61, 0xaf, 0xff, 0xed, 0xd9, 0x6b, 0x5a, 0xc1, 0xac,
+  0xcb, 0xd6, 0x61, 0xb5, 0xb0, 0x06, 0x35, 0x8b, 0x0b, 0x2d, 0x02, 0xd6, 0x86, 0x82, 0x62, 0x7b,
+  0x58, 0x6b, 0x06, 0xb2, 0xda, 0x6b, 0x58, 0x00, 0xb5, 0xa0, 0x9a, 0x00, 0x18, 0x35, 0xeb, 0x18,
+  0x00, 0x07, 0xff, 0xdc, 0x1a, 0xcc, 0x31, 0xb5, 0xeb, 0x6b, 0xd7, 0xad, 0x8c, 0x33, 0xb5, 0x6b,
+  0xd6, 0xbd, 0x35, 0xad, 0x34, 0x5a, 0x2d, 0x16, 0xae, 0xb0, 0x30, 0xc6, 0x30, 0x00, 0x00, 0xfe,
+  0xfe, 0x59, 0x63, 0x59, 0xad, 0xad, 0x86, 0x61, 0x8d, 0x66, 0xb0, 0x6b, 0x01, 0x9a, 0xdb, 0xac,
+  0x07, 0x7f, 0x63, 0x19, 0xad, 0x8c, 0x66, 0x31, 0x8c, 0x60, 0x00, 0x3f, 0xff, 0xfd, 0x46, 0x5b,
+  0x5b, 0x5b, 0x19, 0x8f, 0x5e, 0x33, 0x63, 0x61, 0x8c, 0xff, 0xfb, 0x5e, 0xbd, 0x7a, 0xf1, 0xb1,
+  0xeb, 0x63, 0x07, 0xff, 0xf8, 0x1f, 0xff, 0xfe, 0x7a, 0xc3, 0x5e, 0xb3, 0x33, 0x36, 0x36, 0x66,
+  0x6d, 0x7a, 0xd8, 0x6f, 0xff, 0xef, 0xf8, 0x61, 0x98, 0x00, 0x00, 0x00, 0x3d, 0xfb, 0x63, 0x0d,
+  0x65, 0x7f, 0xff, 0xb5, 0xe0, 0x63, 0x19, 0x80, 0x00, 0x7f, 0xff, 0x80, 0x00, 0x00, 0x05, 0x06,
+  0x0c, 0x1b, 0xff, 0xff, 0xa0, 0x2d, 0x6b, 0x58, 0x18, 0x33, 0x5b, 0x5b, 0x0c, 0x00, 0x3d, 0x6b,
+  0x00, 0x16, 0xb4, 0x05, 0xad, 0x34, 0x5a, 0x5b, 0xac, 0x19, 0x63, 0x4c, 0x03, 0x5a, 0xd6, 0xa6,
+  0x0c, 0x63, 0xed, 0x68, 0x16, 0x1a, 0x61, 0x86, 0x68, 0x00, 0x07, 0xff, 0xf4, 0x35, 0x8d, 0x7a,
+  0xc6, 0xd6, 0xc6, 0x63, 0x6b, 0x61, 0x95, 0xa0, 0xda, 0xd6, 0xd3, 0x4d, 0x02, 0x6e, 0xc8, 0x1f,
+  0xc5, 0x9a, 0xc1, 0x9a, 0xf5, 0x80, 0x00, 0x07, 0x7f, 0xf0, 0x0d, 0x66, 0xb3, 0x18, 0xc6, 0x30,
+  0xd6, 0xd3, 0x06, 0xb5, 0x80, 0xe6, 0xea, 0xd6, 0x2d, 0xfd, 0x0c, 0xc3, 0x31, 0x98, 0xc6, 0x6b,
+  0x61, 0xa0, 0x00, 0xff, 0xef, 0xe3, 0x58, 0xc6, 0xbd, 0x6c, 0x66, 0xd7, 0x8d, 0x8d, 0x8c, 0x63,
+  0x2e, 0xf9, 0x99, 0x99, 0x9b, 0x19, 0x9a, 0x1f, 0xff, 0xe0, 0xbf, 0xff, 0xfc, 0xec, 0x30, 0xcc,
+  0x6d, 0x78, 0xf5, 0xb3, 0x36, 0x31, 0xb5, 0xb5, 0xff, 0xfe, 0x9f, 0xdb, 0x58, 0xd7, 0xa0, 0x00,
+  0x00, 0x00, 0xf7, 0xfb, 0x5b, 0x5b, 0x5a, 0xc7, 0xff, 0xdf, 0xff, 0xed, 0x56, 0x35, 0x8c, 0xc6,
+  0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x32, 0xf4, 0xff, 0xfa, 0x0b, 0x5a, 0xd6,
+  0x0c, 0x18, 0x66, 0x31, 0x80, 0x03, 0xd6, 0x0d, 0x00, 0x2d, 0x68, 0x2c, 0xb4, 0x66, 0x69, 0x60,
+  0xd6, 0x03, 0x58, 0x0e, 0x32, 0xda, 0x61, 0xaf, 0x58, 0x67, 0xf0, 0x2c, 0x06, 0x5e, 0x99, 0x80,
+  0x00, 0x07, 0xff, 0xff, 0xb0, 0xd6, 0x1a, 0xf5, 0x9a, 0xf5, 0xb1, 0x8d, 0xad, 0x8c, 0x62, 0x65,
+  0x6b, 0x35, 0x86, 0x8d, 0x16, 0x40, 0x8d, 0xdf, 0x2c, 0x6b, 0x1a, 0xda, 0xcc, 0x00, 0x00, 0x0f,
+  0xff, 0xa1, 0xad, 0x66, 0xb6, 0xb3, 0x0d, 0xac, 0x63, 0x58, 0x62, 0xf4, 0x6b, 0x0b, 0xcf, 0x6f,
+  0xa6, 0x99, 0xdf, 0x5b, 0x5b, 0x59, 0x8c, 0xc6, 0x33, 0x5e, 0xb3, 0x5e, 0x80, 0x01, 0xdf, 0xff,
+  0xc6, 0xb1, 0xaf, 0x58, 0xcc, 0xc6, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0xb3, 0xff, 0xb3, 0x33,
+  0x33, 0x33, 0x19, 0xc3, 0xff, 0xfc, 0x1d, 0xff, 0xff, 0xe4, 0x35, 0x9a, 0xda, 0xf5, 0xb3, 0x1b,
+  0x36, 0xbc, 0x66, 0x36, 0xb3, 0xfb, 0xff, 0xf8, 0x61, 0x8c, 0x00, 0x00, 0x00, 0x1f, 0xbf, 0x6b,
+  0x61, 0x96, 0x3f, 0xff, 0xdc, 0x7f, 0xff, 0xb0, 0x63, 0x5e, 0x1b, 0x00, 0x01, 0xff, 0xfe, 0x00,
+  0x00, 0x00, 0x05, 0x18, 0x35, 0x87, 0xff, 0x50, 0xb5, 0xac, 0xb0, 0xd6, 0x35, 0xeb, 0x18, 0xcc,
+  0x00, 0x1b, 0x03, 0x4d, 0x68, 0x05, 0xa3, 0x56, 0x07, 0x47, 0x58, 0x35, 0xac, 0x34, 0x96, 0x5b,
+  0x4d, 0x60, 0xc1, 0x8d, 0x6d, 0x61, 0xf4, 0x58, 0x0d, 0x66, 0xb3, 0x5b, 0x00, 0x00, 0xbf, 0xff,
+  0x9a, 0x60, 0xc3, 0x30, 0xd8, 0x6c, 0x36, 0xbd, 0x66, 0x06, 0x31, 0x8d, 0x60, 0x00, 0xb4, 0x0b,
+  0x57, 0xd6, 0x35, 0x86, 0xb6, 0xb6, 0xb6, 0x80, 0x00, 0x0f, 0xef, 0xed, 0x30, 0x31, 0x86, 0x33,
+  0x5b, 0x58, 0xd6, 0x35, 0x80, 0xd6, 0xb2, 0xd0, 0x70, 0xa0, 0xd7, 0xf0, 0xd6, 0xc3, 0x35, 0xeb,
+  0x61, 0x98, 0xc3, 0x34, 0x00, 0x1f, 0xff, 0xdc, 0xd6, 0x35, 0x98, 0xc6, 0xd6, 0xcc, 0xc6, 0xcc,
+  0x66, 0x30, 0xd6, 0x2f, 0xe6, 0xcc, 0xc6, 0xc6, 0x6f, 0xee, 0xc7, 0xff, 0xf8, 0x3e, 0xff, 0xfe,
+  0xd6, 0xb3, 0x5b, 0x59, 0xb5, 0xeb, 0x66, 0xd7, 0x8c, 0xcc, 0x66, 0xb7, 0xff, 0xf7, 0xf0, 0xc6,
+  0xb6, 0x00, 0x00, 0x00, 0x07, 0xfb, 0xcc, 0xc6, 0xb0, 0x7f, 0xff, 0xb8, 0x7f, 0xd8, 0x6b, 0x6b,
+  0x63, 0x36, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0a, 0x60, 0x6b, 0x1f, 0xdf, 0x41, 0x65,
+  0xac, 0x0d, 0x63, 0x1a, 0xf5, 0x99, 0xa0, 0x01, 0xb0, 0x6b, 0x5a, 0xc9, 0xa0, 0x5a, 0xd0, 0x10,
+  0x10, 0x46, 0x9a, 0x40, 0x69, 0x80, 0xd6, 0x35, 0x86, 0xb6, 0xb1, 0x86, 0xb7, 0xfc, 0xb0, 0x0c,
+  0x30, 0xc0, 0x00, 0x0e, 0xff, 0xe9, 0xad, 0x6d, 0x63, 0x5b, 0x1a, 0xf0, 0xcc, 0x66, 0x32, 0xf3,
+  0x06, 0x30, 0x65, 0x80, 0x16, 0xb4, 0x16, 0xfb, 0xec, 0x35, 0x8d, 0x6d, 0x63, 0x34, 0x00, 0x00,
+  0x3f, 0xff, 0xb2, 0xc6, 0xb1, 0xaf, 0x58, 0xc3, 0x35, 0x9a, 0xc1, 0x96, 0x1a, 0x6b, 0x5a, 0x8c,
+  0x8e, 0xb0, 0x7d, 0x5b, 0x59, 0x8c, 0x63, 0x30, 0xda, 0xda, 0xda, 0xdd, 0xf6, 0x80, 0x0f, 0xef,
+  0xfe, 0xd3, 0x0c, 0x33, 0x18, 0xda, 0xf5, 0xb3, 0x31, 0xb5, 0xeb, 0x30, 0xd6, 0x2c, 0xfe, 0x6c,
+  0x6c, 0x66, 0xee, 0x07, 0xff, 0xf8, 0x3f, 0xbf, 0xf9, 0x63, 0x5b, 0x59, 0x8c, 0xcc, 0xda, 0xf1,
+  0x99, 0x8c, 0x6b, 0xff, 0xfd, 0x4c, 0x6b, 0x6b, 0x34, 0x00, 0x00, 0x00, 0x1f, 0xef, 0x63, 0x0c,
+  0x0f, 0xff, 0xf6, 0xfe, 0x06, 0x61, 0xeb, 0x63, 0xd0, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xad, 0x63, 0x5a, 0xcb, 0xff, 0xa0, 0x5a, 0xcb, 0x03, 0x06, 0x31, 0x98, 0xc0, 0x03, 0x61, 0xac,
+  0xb0, 0xb2, 0x68, 0x16, 0x8d, 0x23, 0xa4, 0x2b, 0x4d, 0x6b, 0x00, 0xd6, 0x0d, 0x60, 0xc1, 0x86,
+  0x18, 0x65, 0xaf, 0xfb, 0x00, 0xc3, 0x0c, 0x00, 0x00, 0xef, 0xff, 0x9a, 0xcb, 0xd3, 0x18, 0x66,
+  0x1b, 0x0d, 0xad, 0xaf, 0x4b, 0x8b, 0xda, 0xda, 0xc6, 0xb0, 0xb0, 0x2c, 0x9a, 0x0f, 0xea, 0xcd,
+  0x61, 0x83, 0x30, 0xc0, 0x00, 0x03, 0xef, 0xe0, 0x61, 0x86, 0x30, 0xc6, 0xb3, 0x58, 0x6b, 0x58,
+  0x1a, 0x69, 0xa5, 0x65, 0xed, 0x67, 0xdd, 0x86, 0x33, 0x5e, 0xb3, 0x0d, 0x86, 0x31, 0xdf, 0x60,
+  0xc0, 0x1f, 0xff, 0xfe, 0xba, 0xd6, 0x30, 0xc6, 0x6b, 0xd6, 0xc6, 0x66, 0x63, 0x33, 0x0c, 0x6b,
+  0x2c, 0x2d, 0xf6, 0x66, 0x6e, 0x40, 0x7f, 0xff, 0x83, 0xfb, 0xff, 0x83, 0x59, 0x86, 0x36, 0x36,
+  0xbc, 0x66, 0x66, 0xbd, 0x66, 0xff, 0xbf, 0xfe, 0x18, 0x63, 0x40, 0x00, 0x00, 0x01, 0xfe, 0xf6,
+  0x33, 0x58, 0x1f, 0xff, 0xed, 0xfd, 0x9a, 0xc3, 0x6b, 0xd7, 0x8c, 0xcc, 0x03, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x56, 0x06, 0xb1, 0xff, 0x7d, 0xa2, 0xcb, 0x2c, 0x5e, 0x98, 0x36, 0xb3, 0x19,
+  0x80, 0x0c, 0xc6, 0xb5, 0x80, 0x2c, 0x9a, 0x2c, 0xb7, 0x72, 0x3a, 0x2e, 0x0d, 0x1a, 0xcb, 0x1a,
+  0xd6, 0x35, 0xad, 0xa6, 0x19, 0x7a, 0xc3, 0x1a, 0xc1, 0xfd, 0x01, 0x86, 0xb6, 0x40, 0x00, 0x1f,
+  0x7f, 0xf6, 0xb0, 0x35, 0xb5, 0x9a, 0xf5, 0x9a, 0xf5, 0xb0, 0xcc, 0x2d, 0x2e, 0x30, 0xc1, 0xac,
+  0x0b, 0x0b, 0x5a, 0xd3, 0x7f, 0xfd, 0x83, 0x06, 0x18, 0xd7, 0xac, 0x00, 0x00, 0x3a, 0xfe, 0x6b,
+  0x1a, 0xcd, 0x66, 0x18, 0x60, 0xc0, 0xd6, 0x00, 0x0d, 0x3f, 0x41, 0xa3, 0xb9, 0x8c, 0x6b, 0xd6,
+  0x63, 0x35, 0xb0, 0xcc, 0xff, 0xb2, 0xcb, 0x00, 0x3f, 0xfb, 0xeb, 0x2d, 0xac, 0x61, 0xb5, 0xb0,
+  0xd8, 0xcc, 0xc6, 0x66, 0xbd, 0x6b, 0xd3, 0x2c, 0x59, 0x68, 0x16, 0x9a, 0x1f, 0xff, 0xe0, 0xff,
+  0xbf, 0xa6, 0xb1, 0xad, 0xac, 0xcc, 0x6d, 0x78, 0xcc, 0xc6, 0x6b, 0xd7, 0xff, 0xf7, 0xcd, 0x61,
+  0x8c, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0xeb, 0x6b, 0x65, 0x9a, 0x7f, 0xff, 0xb7, 0xdb, 0x4c, 0x66,
+  0x36, 0x36, 0x60, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xac, 0x0c, 0xb3, 0xff, 0xfb, 0x41,
+  0x6b, 0x2c, 0x0d, 0x66, 0xb6, 0x19, 0x8c, 0xc0, 0x66, 0x0d, 0x60, 0x68, 0x2c, 0xb4, 0x2f, 0xec,
+  0x21, 0x20, 0x6b, 0x00, 0xd6, 0xb0, 0xd6, 0x0d, 0x63, 0x58, 0xd6, 0x6b, 0x1a, 0xda, 0x61, 0xab,
+  0xf8, 0x18, 0x6b, 0x6b, 0x00, 0x00, 0x7f, 0x7f, 0x2c, 0x1a, 0xc6, 0x18, 0xcd, 0x7a, 0xcc, 0x66,
+  0xbc, 0xb0, 0xb4, 0x63, 0x59, 0xa6, 0x58, 0x16, 0x16, 0xb3, 0xbf, 0x97, 0xa6, 0x0c, 0x6b, 0x6b,
+  0x35, 0xb0, 0x00, 0x1c, 0x1a, 0xfb, 0xb6, 0xb0, 0xc6, 0xb6, 0xb1, 0x97, 0xa6, 0x06, 0xb1, 0x60,
+  0x05, 0x4d, 0x51, 0x7c, 0xd6, 0x6b, 0x61, 0x8c, 0xd7, 0xac, 0xc6, 0x3f, 0x8d, 0x35, 0xad, 0x62,
+  0xce, 0xff, 0xfa, 0xc0, 0xc6, 0xbd, 0x63, 0x6b, 0x33, 0x19, 0x98, 0xcc, 0x63, 0x06, 0x59, 0x65,
+  0xad, 0x02, 0xd3, 0x47, 0xff, 0xf8, 0x3f, 0xef, 0xeb, 0x06, 0xb3, 0x5b, 0x18, 0xd8, 0xcc, 0xc6,
+  0xd6, 0xd6, 0xdf, 0xff, 0xeb, 0x23, 0x06, 0x6b, 0x00, 0x00, 0x00, 0x07, 0xfb, 0xd9, 0xad, 0x96,
+  0xd1, 0xff, 0xfe, 0xde, 0x35, 0x9a, 0xf5, 0xeb, 0x66, 0x66, 0xd0, 0x67, 0xff, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0xac, 0x0c, 0xb7, 0x7f, 0xf3, 0x4b, 0x2c, 0xb2, 0xcd, 0x31, 0x8c, 0x63, 0x33, 0x5e,
+  0xb3, 0x18, 0x32, 0xda, 0x34, 0x35, 0x65, 0xa7, 0xf4, 0x61, 0xe9, 0xdb, 0x59, 0x60, 0xd6, 0xb1,
+  0xad, 0x66, 0xb0, 0xc0, 0xc6, 0xb1, 0x83, 0x03, 0x5b, 0xfe, 0x8d, 0x63, 0x5b, 0x58, 0x00, 0x03,
+  0xfb, 0xfa, 0xc1, 0xac, 0x35, 0xb2, 0xf5, 0xb5, 0xb0, 0xcc, 0x62, 0xb2, 0xc0, 0xcd, 0x60, 0xcb,
+  0x05, 0x80, 0x5b, 0xbf, 0xad, 0xa6, 0x1a, 0xda, 0xc6, 0x18, 0x00, 0x17, 0x6b, 0x35, 0x87, 0x70,
+  0x63, 0x5b, 0x58, 0x60, 0xcb, 0x68, 0xcb, 0x2c, 0x2c, 0x2c, 0xed, 0x1f, 0xc1, 0x8c, 0x61, 0x98,
+  0xc6, 0x31, 0xbe, 0xec, 0x00, 0xd6, 0xb5, 0x9f, 0xff, 0x7f, 0xd6, 0x35, 0xaf, 0x58, 0xc6, 0x31,
+  0x99, 0xaf, 0x5e, 0xb6, 0xbd, 0x66, 0x35, 0x9a, 0xd6, 0x59, 0x6b, 0x40, 0x5a, 0xd1, 0xff, 0xfe,
+  0x0f, 0xfb, 0xf8, 0x35, 0x86, 0x1b, 0x5e, 0xb6, 0xbc, 0x63, 0x63, 0x5e, 0xb7, 0xdf, 0xff, 0xda,
+  0x61, 0x86, 0x00, 0x00, 0x00, 0x07, 0xfb, 0xd8, 0xcd, 0x63, 0x4f, 0xff, 0xf6, 0xfd, 0x35, 0x99,
+  0xaf, 0x19, 0xb1, 0xb0, 0x43, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x01, 0xac, 0xfe, 0xfa,
+  0x0b, 0x59, 0x65, 0x9a, 0xc3, 0x35, 0xb1, 0x98, 0xc6, 0x61, 0x8d, 0x61, 0xa6, 0xb4, 0xd0, 0xb7,
+  0x7f, 0xd8, 0x31, 0xc1, 0xb1, 0xad, 0x6b, 0x0d, 0x6b, 0x35, 0xac, 0xd6, 0x35, 0x8d, 0x63, 0x59,
+  0xac, 0x65, 0x9a, 0x6b, 0x77, 0xf3, 0x58, 0xd6, 0xd0, 0x00, 0x03, 0xfb, 0xfa, 0xc3, 0x5a, 0xcd,
+  0x66, 0xb3, 0x1a, 0xf5, 0xb5, 0xeb, 0x19, 0x51, 0x58, 0x61, 0xad, 0xa6, 0xb0, 0x00, 0x0f, 0xbe,
+  0x0d, 0x66, 0xb1, 0xad, 0xac, 0xd6, 0xd0, 0x07, 0x4d, 0x63, 0x59, 0xad, 0xaf, 0xf9, 0x8c, 0x18,
+  0x65, 0xe9, 0x96, 0xd1, 0xac, 0xb2, 0xd6, 0x59, 0x7d, 0x77, 0x61, 0x8d, 0x6c, 0x31, 0x8c, 0xc3,
+  0x2f, 0x9a, 0xd6, 0xb0, 0x1a, 0x6b, 0x7f, 0xf7, 0xff, 0x06, 0xb1, 0x8c, 0x33, 0x18, 0xc6, 0x66,
+  0x31, 0x98, 0x60, 0xd6, 0xb2, 0xcb, 0x40, 0x16, 0xb3, 0xff, 0xfc, 0x1f, 0xf7, 0xf3, 0x5a, 0xc6,
+  0xb1, 0x9a, 0xd9, 0xaf, 0x5e, 0xb6, 0x31, 0x9a, 0xfe, 0xff, 0xa6, 0x0c, 0x30, 0x00, 0x00, 0x00,
+  0x3f, 0x7f, 0xad, 0x86, 0x03, 0xff, 0xfd, 0xc3, 0xb5, 0x86, 0x63, 0x63, 0xd6, 0xcd, 0x85, 0x7f,
+  0xff, 0xc0, 0x00, 0x00, 0x00, 0x02, 0x58, 0x35, 0x97, 0xdf, 0xda, 0x59, 0x65, 0xac, 0x18, 0x61,
+  0xb0, 0xd8, 0x6d, 0x6c, 0x30, 0xc1, 0xad, 0x6b, 0x5a, 0x0e, 0xff, 0x8d, 0x66, 0x34, 0x32, 0xb3,
+  0x4d, 0x65, 0xb4, 0xc1, 0x97, 0xad, 0x6d, 0x61, 0xac, 0xd6, 0x18, 0x6b, 0x0d, 0x6b, 0x5b, 0xfb,
+  0x98, 0xcb, 0xd0, 0x00, 0x03, 0xfb, 0xf8, 0x0c, 0xb3, 0x58, 0xc3, 0x35, 0xeb, 0x31, 0x8c, 0xa6,
+  0xa9, 0x86, 0x35, 0x8d, 0x6b, 0x00, 0xd1, 0xad, 0xff, 0x7d, 0x8d, 0x61, 0x83, 0x18, 0x61, 0x81,
+  0xd0, 0xd6, 0x30, 0xc3, 0x37, 0xf7, 0x31, 0xac, 0x65, 0xb5, 0xac, 0x0d, 0x6b, 0x5a, 0xd6, 0xb4,
+  0xfe, 0xc0, 0xbd, 0xb1, 0x86, 0x35, 0xeb, 0x30, 0xda, 0xcc, 0xfa, 0x01, 0xac, 0xb0, 0x35, 0xbf,
+  0xef, 0xff, 0x83, 0x0c, 0x31, 0x8c, 0x66, 0xbd, 0x66, 0x6b, 0xd6, 0xc3, 0x1a, 0xcd, 0x35, 0x96,
+  0x5a, 0x34, 0x2c, 0x4f, 0xff, 0xf0, 0x7f, 0xdf, 0x58, 0xbd, 0x35, 0x98, 0x66, 0x33, 0x31, 0x98,
+  0xc3, 0xfe, 0xff, 0x99, 0x6d, 0x61, 0x80, 0x00, 0x00, 0x01, 0xfb, 0xf6, 0x31, 0x80, 0xff, 0xff,
+  0x71, 0xfa, 0xd6, 0xd6, 0x66, 0x66, 0x6c, 0x60, 0xd7, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3b,
+  0x2c, 0x35, 0x8f, 0xfb, 0xa2, 0xcb, 0x59, 0x61, 0xac, 0xc3, 0x31, 0x98, 0xda, 0xcc, 0x63, 0x58,
+  0xd3, 0x2c, 0xb5, 0xa5, 0xff, 0xf6, 0x0c, 0x18, 0x16, 0xe5, 0x8d, 0x30, 0x35, 0x9a, 0xc6, 0xb1,
+  0x83, 0x2f, 0x5a, 0xda, 0xc1, 0x83, 0x5a, 0xd6, 0x77, 0xd6, 0xd6, 0x00, 0x00, 0x0f, 0xef, 0xe0,
+  0xd6, 0xb1, 0xac, 0x61, 0x8c, 0x63, 0x30, 0x51, 0x52, 0xd7, 0xa6, 0x6b, 0x0d, 0x60, 0x1a, 0x6b,
+  0x2f, 0xef, 0xb1, 0xac, 0x30, 0x63, 0x06, 0x30, 0xbe, 0xc1, 0xad, 0xac, 0x33, 0x5b, 0x5b, 0x77,
+  0xf1, 0x83, 0x06, 0xb0, 0x1a, 0x69, 0xad, 0x17, 0xc6, 0x15, 0xf6, 0x35, 0xb5, 0x8c, 0xd6, 0xd6,
+  0xd6, 0xcb, 0xd7, 0x56, 0xb5, 0x86, 0x99, 0x60, 0x6f, 0xfb, 0xff, 0xed, 0x6b, 0x18, 0x6b, 0xd6,
+  0x61, 0x9a, 0xf5, 0x99, 0xaf, 0x59, 0x8c, 0x30, 0x6b, 0x5a, 0xcb, 0x4d, 0x0d, 0xd8, 0x3f, 0xff,
+  0xc1, 0xff, 0x7c, 0x1a, 0x65, 0xeb, 0x5e, 0xb3, 0x19, 0x8c, 0xc6, 0x6b, 0x6f, 0xff, 0xbf, 0x98,
+  0x18, 0xd6, 0xc0, 0x00, 0x00, 0x03, 0xdf, 0xec, 0x63, 0x01, 0xff, 0xfe, 0xe7, 0xff, 0xf6, 0xb3,
+  0x0c, 0xda, 0xf1, 0xb3, 0x31, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2c, 0x35, 0x97,
+  0x7f, 0xdb, 0xb1, 0x6b, 0x5a, 0xc6, 0xb1, 0x8c, 0xd7, 0xad, 0x8c, 0x66, 0x30, 0xc1, 0xad, 0x62,
+  0xd6, 0xb7, 0xff, 0xf4, 0xc1, 0xa2, 0xc2, 0x9d, 0x30, 0x35, 0x86, 0x5b, 0x58, 0x61, 0x86, 0xb1,
+  0xac, 0x60, 0x60, 0xd6, 0xb2, 0xd6, 0xfb, 0x8c, 0x00, 0x00, 0x1f, 0xdf, 0xc6, 0xb5, 0xac, 0xd3,
+  0x1a, 0xda, 0xcc, 0x6b, 0xd6, 0xc1, 0x41, 0x45, 0x86, 0x35, 0x8d, 0x60, 0x19, 0x65, 0x9f, 0xfd,
+  0x06, 0xb3, 0x58, 0x63, 0x59, 0xac, 0x67, 0xf6, 0xb0, 0x61, 0x86, 0x31, 0xaf, 0x58, 0xfe, 0xed,
+  0xad, 0x66, 0xb5, 0x80, 0x69, 0xa3, 0x5f, 0x76, 0xb3, 0x13, 0x03, 0x18, 0x63, 0x1a, 0xf5, 0x9a,
+  0xf5, 0x8b, 0xe0, 0x6b, 0x00, 0xd6, 0x07, 0xdf, 0xff, 0x5a, 0xcd, 0x63, 0x5b, 0x06, 0xd6, 0x61,
+  0xb5, 0xb5, 0xeb, 0x30, 0xc6, 0x5e, 0x8d, 0x65, 0xad, 0x6b, 0x46, 0x81, 0xff, 0xfe, 0x0f, 0xfb,
+  0xad, 0x35, 0x81, 0x8c, 0x6b, 0xd7, 0xac, 0xcc, 0x36, 0xb3, 0xff, 0xbf, 0xb5, 0x8d, 0x61, 0x80,
+  0x00, 0x00, 0x01, 0xbf, 0xf6, 0x31, 0xac, 0x6b, 0xff, 0xfb, 0xff, 0xfa, 0xcd, 0x66, 0x63, 0x66,
+  0x66, 0x62, 0x5f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x58, 0x1a, 0xce, 0xff, 0xab, 0x2d,
+  0x6b, 0x58, 0x6b, 0x31, 0x8c, 0x66, 0x63, 0x19, 0x83, 0x1a, 0xd6, 0x16, 0x5b, 0xfe, 0xfe, 0x1a,
+  0xc6, 0x29, 0x25, 0xda, 0x60, 0x6b, 0x0c, 0x18, 0xd6, 0x6b, 0x35, 0x86, 0xb1, 0x83, 0x58, 0xd3,
+  0x2c, 0xb2, 0x7d, 0x60, 0x00, 0x00, 0xfe, 0xfe, 0xd3, 0x58, 0x0d, 0x66, 0xb3, 0x0c, 0x66, 0x35,
+  0xe4, 0xe4, 0xf6, 0x18, 0x6b, 0x35, 0x81, 0xad, 0x60, 0xdf, 0xff, 0xcb, 0x35, 0x86, 0xb3, 0x59,
+  0xac, 0x6b, 0x1f, 0xdf, 0xda, 0xc3, 0x5b, 0x58, 0xc6, 0x18, 0xc3, 0x3b, 0xfb, 0x58, 0xd6, 0xb0,
+  0x1a, 0x34, 0x7f, 0xc3, 0x5b, 0x62, 0xe1, 0x1a, 0xda, 0xcd, 0x6c, 0x1b, 0x59, 0x87, 0xf5, 0x96,
+  0x35, 0xac, 0x06, 0xb0, 0xef, 0xff, 0xeb, 0x0d, 0x66, 0x0c, 0xc3, 0x0c, 0xc6, 0x31, 0x9a, 0xda,
+  0xcd, 0x63, 0x4d, 0x6b, 0x2d, 0x6b, 0x4d, 0x1a, 0x7f, 0xff, 0x83, 0xfb, 0xeb, 0x2c, 0x06, 0x1a,
+  0xf5, 0x98, 0xcc, 0x63, 0x19, 0xff, 0xdf, 0x58, 0x6b, 0x1a, 0xcc, 0x00, 0x00, 0x00, 0x3f, 0xfd,
+  0x8d, 0x7a, 0xc0, 0xfe, 0xff, 0xff, 0x6f, 0xb6, 0xb1, 0x99, 0x99, 0x9b, 0x30, 0xaf, 0xff, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x6b, 0x58, 0x6b, 0x0f, 0xff, 0xe2, 0xd6, 0x99, 0x61, 0x86, 0x6b,
+  0xd6, 0x66, 0x33, 0x18, 0xc3, 0x1a, 0xd6, 0x16, 0x2f, 0xff, 0xeb, 0x06, 0x04, 0xa4, 0x40, 0xc0,
+  0x61, 0xa6, 0xb0, 0xc3, 0x1a, 0xc3, 0x59, 0xac, 0x35, 0x9a, 0x6b, 0x16, 0x5a, 0xd7, 0xf6, 0x00,
+  0x00, 0x1f, 0xdf, 0x5a, 0xcb, 0x03, 0x03, 0x35, 0x98, 0xc6, 0x6b, 0xc9, 0xa9, 0xc6, 0x35, 0xb5,
+  0x86, 0xb1, 0xad, 0x60, 0xd3, 0xff, 0xe5, 0xb4, 0xc1, 0x86, 0xb6, 0xb5, 0xb5, 0x8f, 0xff, 0x93,
+  0x1a, 0xcc, 0xbd, 0x66, 0xb6, 0xb3, 0x0c, 0x32, 0x34, 0xc0, 0x03, 0x5f, 0x75, 0x9a, 0xc3, 0x1f,
+  0x10, 0xc3, 0x18, 0xd7, 0xac, 0x63, 0x1d, 0xf1, 0xac, 0x06, 0xb0, 0x1a, 0xcb, 0xff, 0xff, 0x60,
+  0x18, 0xd6, 0x6b, 0x6b, 0x35, 0xb5, 0x98, 0xc3, 0x6b, 0x6b, 0x30, 0xd6, 0x34, 0xd6, 0xb2, 0xd6,
+  0xb5, 0xad, 0x69, 0xff, 0xfe, 0x0f, 0xee, 0x8b, 0x1a, 0x6b, 0x35, 0x98, 0x66, 0x33, 0x0c, 0xd7,
+  0xdf, 0xf2, 0xda, 0x65, 0xeb, 0x5e, 0x80, 0x00, 0x00, 0x07, 0xfe, 0xf0, 0xcd, 0x60, 0x7f, 0xff,
+  0xb8, 0x8c, 0x36, 0x33, 0x63, 0x66, 0x18, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xb5,
+  0x86, 0xb0, 0xff, 0xbf, 0xb2, 0x6b, 0x5a, 0xcd, 0x63, 0x18, 0xcc, 0x66, 0x33, 0x5e, 0xb3, 0x59,
+  0xad, 0x60, 0xb3, 0xfe, 0xff, 0x9a, 0xc6, 0xb0, 0x88, 0x7e, 0xc3, 0x58, 0x00, 0x01, 0xb3, 0x59,
+  0xac, 0x30, 0x6b, 0x35, 0x83, 0x59, 0x61, 0x64, 0x00, 0x00, 0x07, 0xf7, 0xc5, 0x8b, 0x1a, 0x61,
+  0xac, 0xc3, 0x31, 0x86, 0x4c, 0x4c, 0xda, 0xcd, 0x6d, 0x61, 0xac, 0x6b, 0x03, 0x5a, 0xff, 0xfa,
+  0xc3, 0x58, 0x60, 0xc1, 0x86, 0xb7, 0xff, 0xf1, 0x86, 0xb6, 0xb3, 0x5b, 0x59, 0x86, 0x18, 0xc8,
+  0x00, 0x00, 0x5f, 0xd6, 0x18, 0x6c, 0x8c, 0x5d, 0x63, 0x0c, 0xd6, 0x61, 0x9a, 0xcf, 0xb8, 0x1a,
+  0xc0, 0xd6, 0x06, 0xb3, 0xff, 0xff, 0x58, 0x6b, 0x35, 0x8c, 0x31, 0xad, 0xad, 0xac, 0xd7, 0xac,
+  0xc3, 0x35, 0x9a, 0xc3, 0x4d, 0x65, 0x96, 0x5a, 0xcb, 0x4f, 0xff, 0xf0, 0x7d, 0xf4, 0x68, 0xd6,
+  0xb0, 0xc3, 0x19, 0xaf, 0x59, 0x8c, 0x6f, 0xbf, 0xf8, 0x35, 0xac, 0xd6, 0x30, 0x00, 0x00, 0x01,
+  0xfe, 0xfd, 0x6c, 0x18, 0x2f, 0xff, 0xf7, 0x3f, 0xf9, 0xad, 0x86, 0xc7, 0xad, 0x9b, 0x06, 0xff,
+  0xff, 0xe0, 0x00, 0x08, 0x30, 0xc6, 0x00, 0xe1, 0xad, 0x61, 0xac, 0x3e, 0xff, 0x93, 0x5a, 0xd6,
+  0x35, 0x9a, 0xf5, 0x98, 0xcc, 0xd7, 0xad, 0x86, 0x30, 0x6b, 0x02, 0xdf, 0xff, 0xeb, 0xb1, 0xac,
+  0x30, 0x80, 0x71, 0xac, 0xd3, 0x00, 0x00, 0x0f, 0x61, 0x83, 0x59, 0xac, 0x35, 0x9a, 0x65, 0x81,
+  0x64, 0xc0, 0x00, 0x03, 0xef, 0xe2, 0xc0, 0x35, 0xac, 0xd6, 0x6b, 0x6b, 0x61, 0x98, 0x96, 0x97,
+  0x98, 0x61, 0x86, 0xb3, 0x5a, 0xda, 0x6b, 0x1f, 0xff, 0xfa, 0x6c, 0x18, 0x18, 0x30, 0xd6, 0x37,
+  0xdf, 0xf3, 0x59, 0x97, 0xac, 0x61, 0x9a, 0xda, 0xc6, 0x18, 0x00, 0x00, 0x0f, 0xfe, 0xc1, 0x86,
+  0xca, 0xc7, 0xd6, 0x61, 0xaf, 0x58, 0xc6, 0xbd, 0x63, 0xfe, 0x58, 0x1a, 0xc1, 0xad, 0x61, 0xad,
+  0xff, 0xff, 0xa8, 0x98, 0x6b, 0x30, 0x63, 0x0c, 0x33, 0x0c, 0x66, 0xb6, 0xb1, 0xac, 0x35, 0xac,
+  0xb2, 0xcb, 0x0b, 0x1f, 0xff, 0xe0, 0xef, 0xeb, 0x26, 0xb5, 0x96, 0x6b, 0x18, 0xc6, 0x31, 0x8c,
+  0x6f, 0xff, 0xe8, 0x6b, 0x03, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xfa, 0xcc, 0x31, 0x67, 0xff, 0xdf,
+  0xff, 0xed, 0xda, 0xcc, 0x66, 0x66, 0x6c, 0x6c, 0x7b, 0xff, 0xfe, 0x00, 0x05, 0x18, 0x61, 0x86,
+  0x01, 0xc0, 0xd6, 0x0d, 0x63, 0x77, 0xff, 0xd6, 0x9a, 0xd6, 0x18, 0x63, 0x19, 0x9a, 0xf5, 0xeb,
+  0x31, 0x86, 0x1a, 0xc0, 0x7f, 0x7f, 0xf0, 0x30, 0x61, 0xe1, 0xa1, 0x80, 0x00, 0x00, 0x0f, 0x7a,
+  0xd6, 0x6b, 0x0c, 0x1a, 0xc6, 0xb5, 0x80, 0x2d, 0x60, 0x00, 0x01, 0xdf, 0xf0, 0x58, 0xd1, 0xac,
+  0x35, 0xb5, 0x98, 0xc6, 0x32, 0x52, 0x56, 0x6b, 0x6b, 0x18, 0x60, 0xc0, 0xc1, 0x7f, 0xff, 0x6b,
+  0x1a, 0xd6, 0xd3, 0x0d, 0x66, 0xb5, 0x9f, 0x7f, 0x18, 0xc3, 0x0c, 0xd6, 0xd6, 0x6b, 0x6b, 0x0c,
+  0x00, 0x00, 0x07, 0xff, 0x63, 0x58, 0xcc, 0xcc, 0x9d, 0x6d, 0x66, 0x1a, 0xf5, 0x8d, 0x7a, 0xc7,
+  0xfd, 0x6b, 0x58, 0x6b, 0x58, 0xd3, 0x03, 0x7f, 0xff, 0x56, 0x0c, 0x30, 0xc3, 0x0c, 0x31, 0x8c,
+  0x63, 0x0c, 0x35, 0x9a, 0x6b, 0x2c, 0x58, 0x04, 0xff, 0xff, 0x05, 0xff, 0x0b, 0x2c, 0xb0, 0x6b,
+  0x6b, 0x19, 0xad, 0x8d, 0x7a, 0xc7, 0xdf, 0xf3, 0x4d, 0x61, 0x96, 0xd0, 0x00, 0x00, 0x03, 0xdf,
+  0xec, 0x31, 0x96, 0x57, 0xff, 0xfb, 0x86, 0x19, 0x8c, 0xd8, 0xd9, 0x99, 0x0f, 0xff, 0xfc, 0x00,
+  0x39, 0x63, 0x5b, 0x58, 0xc3, 0x1a, 0xc7, 0x00, 0xd6, 0x35, 0x86, 0x7f, 0xff, 0x76, 0x9a, 0xd6,
+  0x35, 0xb5, 0x98, 0xc6, 0x66, 0x31, 0x98, 0x6b, 0x6b, 0x58, 0x2f, 0xfb, 0xfe, 0xc0, 0xc0, 0x38,
+  0x30, 0x18, 0x00, 0x00, 0x00, 0xde, 0xd6, 0xd3, 0x0c, 0x0c, 0x35, 0xac, 0x00, 0x2c, 0x00, 0x00,
+  0x77, 0xf4, 0x01, 0xa3, 0x2d, 0xac, 0x31, 0x9a, 0xf5, 0x99, 0x25, 0x27, 0x18, 0xc3, 0x0c, 0x18,
+  0x6b, 0x1a, 0xbf, 0xff, 0xb5, 0x83, 0x2d, 0xad, 0x66, 0xb0, 0x33, 0xff, 0xad, 0x63, 0x1a, 0xf5,
+  0x86, 0xd6, 0x30, 0xc3, 0x5b, 0x00, 0x00, 0x07, 0xfc, 0x35, 0x9a, 0xd9, 0xb9, 0x61, 0x8c, 0x31,
+  0xad, 0xac, 0xc3, 0xfe, 0x9a, 0x65, 0x9a, 0x60, 0x6b, 0x07, 0xfd, 0xf5, 0x8d, 0x63, 0x06, 0x18,
+  0x61, 0x8c, 0x6b, 0xd6, 0x31, 0x83, 0x03, 0x59, 0x60, 0x00, 0x7f, 0xff, 0x81, 0xff, 0xda, 0x16,
+  0x16, 0x35, 0x86, 0x19, 0x8c, 0x36, 0xb1, 0xff, 0xdc, 0xd6, 0xb0, 0xd6, 0x18, 0x00, 0x00, 0x03,
+  0xdf, 0xbd, 0x6d, 0x66, 0xb2, 0xd7, 0xff, 0xfb, 0x9f, 0xc6, 0xbd, 0x6c, 0xc6, 0xcd, 0xaf, 0x12,
+  0x7f, 0xff, 0xc0, 0x0b, 0xec, 0xd6, 0xd6, 0x19, 0xac, 0x61, 0x87, 0x56, 0x0d, 0x60, 0xc3, 0x5b,
+  0xfe, 0xff, 0xb4, 0xd6, 0x0d, 0x7a, 0xc6, 0x63, 0x19, 0x98, 0xc6, 0x18, 0x6b, 0x16, 0x7f, 0xff,
+  0xb2, 0xf6, 0xb0, 0xd6, 0x06, 0xc5, 0xb0, 0xc0, 0x00, 0x00, 0x01, 0xfb, 0x0d, 0x66, 0xb0, 0x61,
+  0xad, 0x61, 0xa0, 0x10, 0x00, 0x01, 0x7f, 0xd0, 0xd0, 0x69, 0xac, 0x30, 0xc3, 0x6b, 0x60, 0x90,
+  0x93, 0x66, 0x35, 0xeb, 0x5e, 0xb0, 0xc1, 0x83, 0x4f, 0xff, 0xfd, 0x66, 0xb0, 0xd6, 0x0c, 0x0c,
+  0xbd, 0x1f, 0xfc, 0x63, 0x5b, 0x5b, 0x59, 0x86, 0x18, 0xc1, 0x80, 0x00, 0x00, 0x7f, 0xcd, 0x33,
+  0x59, 0x9f, 0x9a, 0x30, 0xc3, 0x35, 0x8c, 0x31, 0xf7, 0xc0, 0xd6, 0x0d, 0x60, 0x6b, 0x1f, 0x7f,
+  0xf6, 0x35, 0x86, 0x0c, 0x6b, 0x35, 0x8c, 0x61, 0x8c, 0x61, 0x86, 0xb3, 0x4d, 0x60, 0x01, 0xa3,
+  0xff, 0xfc, 0x0f, 0xee, 0xd0, 0x00, 0x30, 0x63, 0x18, 0xc6, 0x31, 0x7f, 0xfd, 0xad, 0x65, 0xb4,
+  0xc0, 0x00, 0x00, 0x01, 0xbf, 0xde, 0xb3, 0x5b, 0x5a, 0xd3, 0xff, 0xbf, 0xff, 0x98, 0x66, 0x66,
+  0x6c, 0x6c, 0x4f, 0xff, 0xff, 0x00, 0x7f, 0x6b, 0x18, 0x63, 0x5b, 0x58, 0xc1, 0x8d, 0xfd, 0xc5,
+  0x9a, 0xd6, 0x6b, 0x0d, 0x6e, 0xff, 0xfa, 0x6b, 0x58, 0xc3, 0x5e, 0xb6, 0xbd, 0x66, 0x63, 0x19,
+  0x83, 0x1a, 0xd6, 0x3b, 0xff, 0xfa, 0x65, 0x9a, 0xc0, 0xd0, 0xae, 0xb6, 0x80, 0x00, 0x00, 0x01,
+  0xf9, 0xe9, 0x86, 0xb1, 0xac, 0x6b, 0x00, 0xd1, 0xa5, 0x80, 0x00, 0x0f, 0xfe, 0x9a, 0x68, 0x69,
+  0xac, 0x18, 0xd7, 0xac, 0xd7, 0xaf, 0x49, 0x09, 0x1a, 0xf5, 0x98, 0x61, 0x8c, 0xbd, 0x60, 0xd6,
+  0xbf, 0xff, 0xf6, 0x0c, 0xb6, 0x9a, 0xc6, 0xb0, 0x6b, 0x1d, 0xfc, 0x63, 0x1a, 0xf5, 0x8c, 0x6b,
+  0x6b, 0x32, 0xf4, 0xc6, 0x00, 0x00, 0x0f, 0xe9, 0xad, 0xac, 0x68, 0xe7, 0x9a, 0xcc, 0x35, 0xb5,
+  0x9a, 0xcd, 0x65, 0xff, 0x58, 0x19, 0x66, 0x98, 0x1a, 0xce, 0xff, 0xeb, 0xd3, 0x0d, 0x66, 0xb0,
+  0xc3, 0x0c, 0x31, 0x86, 0x6b, 0x6b, 0x1a, 0xc6, 0x98, 0xb3, 0x43, 0x5a, 0x3f, 0xff, 0xc0, 0xef,
+  0xec, 0x80, 0x06, 0xb5, 0xb5, 0x8c, 0xd6, 0xd7, 0xac, 0x63, 0xbf, 0xfb, 0x59, 0x61, 0xad, 0x6d,
+  0x00, 0x00, 0x00, 0x7f, 0xf8, 0xc6, 0x0d, 0x17, 0xff, 0xfb, 0x8e, 0x18, 0xcd, 0x8d, 0x99, 0x8a,
+  0xdf, 0xff, 0xe0, 0x2f, 0xec, 0xd6, 0x61, 0x8d, 0x66, 0x0c, 0x6b, 0x1a, 0xff, 0xec, 0x5e, 0x9a,
+  0xda, 0xc1, 0x96, 0xff, 0xfe, 0xed, 0x6b, 0x0c, 0x6b, 0xd6, 0x63, 0x1b, 0x5e, 0xb3, 0x18, 0x60,
+  0x65, 0xbe, 0xff, 0xfe, 0x6b, 0x58, 0x64, 0x32, 0x2b, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xb5,
+  0x83, 0x06, 0x0d, 0x61, 0xa6, 0x9a, 0x68, 0x00, 0x00, 0x7f, 0xdd, 0xad, 0x34, 0x69, 0xac, 0x0c,
+  0xd6, 0xd6, 0xc3, 0x64, 0x74, 0x8b, 0x35, 0xeb, 0x18, 0xc3, 0x0c, 0x18, 0x77, 0xff, 0xf3, 0x5a,
+  0xc3, 0x58, 0x35, 0x83, 0x5b, 0xfe, 0xb5, 0x9a, 0xda, 0xda, 0xda, 0xc6, 0x30, 0xd6, 0xd6, 0x00,
+  0x00, 0x00, 0xfb, 0x98, 0x6b, 0x6d, 0x3d, 0x13, 0x0c, 0x30, 0xd7, 0xa6, 0x6b, 0x1f, 0xf7, 0x6b,
+  0x0d, 0x6b, 0x1a, 0xd6, 0x19, 0x3f, 0xfe, 0xd3, 0x06, 0x0d, 0x66, 0xb1, 0x83, 0x35, 0x98, 0x63,
+  0x5e, 0xb5, 0xe9, 0x86, 0xb2, 0xcd, 0x1a, 0xd6, 0x8f, 0xff, 0xf0, 0x2f, 0xe1, 0x1a, 0x58, 0x69,
+  0x86, 0x18, 0xcc, 0x33, 0x59, 0xdf, 0xf5, 0x96, 0x0d, 0x60, 0x00, 0x00, 0x01, 0xff, 0xb1, 0x98,
+  0x0d, 0x3f, 0xff, 0xdd, 0x3f, 0xb6, 0xb3, 0x1e, 0xb6, 0x66, 0x6c, 0xb9, 0xff, 0xfe, 0x07, 0xdd,
+  0xad, 0xad, 0xac, 0x61, 0x8d, 0x66, 0xb3, 0x58, 0xc7, 0xff, 0x58, 0x18, 0x6b, 0x35, 0x87, 0xff,
+  0x7d, 0x30, 0x6b, 0xd6, 0x31, 0x8d, 0x86, 0x66, 0xb6, 0xb6, 0xb0, 0x35, 0xbf, 0xef, 0xfe, 0xd3,
+  0x58, 0x6b, 0x0d, 0x0a, 0x98, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x32, 0xf5, 0xac, 0xd6, 0x35, 0x81,
+  0xad, 0x6b, 0x5a, 0x00, 0x00, 0x1f, 0xdc, 0xb4, 0xd3, 0x4d, 0x32, 0xda, 0xc3, 0x31, 0x8d, 0x91,
+  0xd1, 0xf5, 0xeb, 0x30, 0xc6, 0x35, 0xb5, 0x8d, 0x61, 0x7f, 0xff, 0xee, 0x9a, 0xd6, 0x1a, 0xcb,
+  0xd1, 0x81, 0x7f, 0x18, 0xc6, 0xbd, 0x63, 0x18, 0x63, 0x59, 0xac, 0x68, 0x00, 0x00, 0x3b, 0xe6,
+  0x35, 0x9b, 0x57, 0x4d, 0x97, 0xac, 0x30, 0xd7, 0xa6, 0x35, 0x97, 0xff, 0x35, 0x83, 0x59, 0x7a,
+  0x6b, 0x0d, 0x6f, 0xff, 0xad, 0x61, 0xac, 0x6b, 0x0c, 0x18, 0xd6, 0x61, 0x86, 0x60, 0xc6, 0x5b,
+  0x4c, 0x06, 0x99, 0x61, 0xff, 0xfe, 0x03, 0xf9, 0xd9, 0x68, 0x00, 0xd6, 0x31, 0xad, 0x8d, 0x7a,
+  0xcd, 0x6d, 0xf7, 0xfd, 0x65, 0x83, 0x58, 0x60, 0x00, 0x00, 0x3f, 0xde, 0x31, 0x80, 0x3f, 0xef,
+  0xff, 0xe3, 0x35, 0xeb, 0xc6, 0x6c, 0x6c, 0xc5, 0xff, 0xfe, 0x0f, 0xe8, 0xc3, 0x30, 0xc3, 0x0c,
+  0x30, 0xd6, 0x6b, 0x3f, 0xbe, 0xc0, 0xc6, 0xb1, 0xac, 0x3b, 0xff, 0xfb, 0x58, 0x31, 0x86, 0x63,
+  0x31, 0x8c, 0xc3, 0x1a, 0xc3, 0x5b, 0xff, 0xbf, 0xe6, 0xb5, 0xac, 0xd6, 0x1a, 0x15, 0xd3, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0x7a, 0xc1, 0x8d, 0x61, 0x96, 0xd3, 0x59, 0x65, 0x90, 0x00, 0x02, 0xfa,
+  0x4b, 0x4d, 0x1a, 0x65, 0x9a, 0xc6, 0x6b, 0xd6, 0xd7, 0x91, 0xd1, 0xd9, 0x86, 0xd6, 0x33, 0x59,
+  0xad, 0xad, 0x6d, 0x1f, 0xff, 0xfc, 0x19, 0xa6, 0x58, 0xd6, 0xb0, 0x6b, 0x1f, 0xd1, 0x9a, 0xda,
+  0xda, 0xda, 0xcd, 0x7a, 0x66, 0xb1, 0xac, 0xdd, 0xfc, 0x2c, 0x00, 0xd6, 0x0b, 0xfa, 0xda, 0xc6,
+  0xd8, 0xd6, 0x31, 0x97, 0xac, 0x35, 0xb5, 0x83, 0x1f, 0xdf, 0x35, 0x81, 0xac, 0x1a, 0xc3, 0x5f,
+  0xdd, 0x61, 0xad, 0x6d, 0x6b, 0x35, 0x86, 0x1a, 0xda, 0xda, 0xc6, 0x30, 0xc6, 0xb0, 0xd6, 0x1a,
+  0x6b, 0x16, 0x3f, 0xff, 0xc0, 0x5f, 0xc2, 0xd0, 0x0b, 0x69, 0x86, 0x19, 0x8c, 0x36, 0xb3, 0x77,
+  0xff, 0x58, 0x5b, 0x4c, 0x18, 0x00, 0x00, 0x1f, 0xed, 0x98, 0x65, 0x81, 0xff, 0xfe, 0xe6, 0xc6,
+  0x36, 0x36, 0x66, 0x66, 0x8f, 0xff, 0xf0, 0xff, 0xac, 0x61, 0x9a, 0xda, 0xcd, 0x66, 0xb3, 0x58,
+  0xd6, 0x6b, 0x1f, 0x7f, 0x60, 0xd6, 0xd6, 0x19, 0x6d, 0x3f, 0xff, 0xf6, 0xac, 0x18, 0x63, 0x35,
+  0xb1, 0x98, 0x6d, 0x66, 0xb6, 0xb5, 0x8d, 0x7f, 0xdf, 0xf6, 0x9a, 0xd6, 0x34, 0x38, 0x2e, 0x30,
+  0x00, 0x00, 0x00, 0x01, 0xfe, 0xd6, 0x35, 0x8c, 0x1a, 0xcd, 0x32, 0xc0, 0xb0, 0x00, 0x03, 0xfe,
+  0x31, 0x56, 0x8d, 0x35, 0xac, 0x6b, 0x6b, 0x33, 0x18, 0x8e, 0x8e, 0xcc, 0x6b, 0xd6, 0x61, 0x9a,
+  0xcd, 0x63, 0x5a, 0xff, 0xff, 0xe4, 0xc1, 0xac, 0xb3, 0x4d, 0x60, 0xd5, 0xfd, 0x98, 0xc3, 0x30,
+  0xcd, 0x66, 0xb6, 0xb0, 0xc7, 0xdd, 0x62, 0xc5, 0x86, 0x9a, 0xc3, 0x59, 0xff, 0x58, 0x6d, 0xad,
+  0x86, 0x1a, 0xda, 0xd6, 0xd6, 0x18, 0x30, 0xfe, 0x6b, 0x58, 0x35, 0x83, 0x58, 0x3b, 0xf8, 0x0d,
+  0x63, 0x58, 0x30, 0xd6, 0xd6, 0x35, 0xb5, 0xb5, 0x9a, 0xda, 0xc6, 0x06, 0x06, 0xb1, 0x60, 0xff,
+  0xff, 0x00, 0xfe, 0x4b, 0x40, 0x58, 0x35, 0x9a, 0xcc, 0x6b, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0xfe,
+  0x2c, 0x0d, 0x66, 0xb0, 0x00, 0x00, 0x7f, 0xb6, 0x30, 0xd6, 0x16, 0xff, 0xfe, 0xfe, 0x19, 0x99,
+  0x99, 0x9b, 0x4d, 0xdf, 0xff, 0xe3, 0xfe, 0x8c, 0xd7, 0xac, 0x63, 0x0c, 0x30, 0xd6, 0x6b, 0x18,
+  0x3b, 0xfe, 0xc1, 0x86, 0x0c, 0x0d, 0xff, 0xfd, 0xcb, 0xd3, 0x35, 0x98, 0xc6, 0x33, 0x18, 0xc6,
+  0xb3, 0x58, 0x3f, 0xbf, 0xf8, 0xd6, 0xb0, 0x07, 0x86, 0x6f, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xdf,
+  0xb2, 0xf4, 0xcd, 0x61, 0xac, 0xd6, 0xb0, 0x00, 0x00, 0x03, 0xef, 0xb0, 0xda, 0xdf, 0x5a, 0x34,
+  0xd6, 0x18, 0x66, 0x33, 0x11, 0xd1, 0xf5, 0xb1, 0x8c, 0x63, 0x0c, 0xd6, 0x35, 0x97, 0xff, 0xff,
+  0x4d, 0x83, 0x4c, 0x5b, 0x4d, 0x61, 0x7f, 0x63, 0x18, 0xc6, 0x31, 0x86, 0x1a, 0xda, 0xdf, 0xf2,
+  0xcb, 0x2c, 0xb0, 0x35, 0x96, 0xd6, 0xb3, 0x5d, 0xf3, 0x37, 0x36, 0xec, 0x35, 0x9a, 0xc6, 0xb3,
+  0x5a, 0xda, 0xd6, 0x3e, 0x6b, 0x59, 0xa6, 0xb0, 0xd6, 0xb6, 0xbf, 0xf8, 0x1a, 0xc0, 0xc1, 0x97,
+  0xad, 0x7a, 0xd6, 0xcb, 0xd6, 0x6b, 0x6b, 0x35, 0xb5, 0x83, 0x06, 0xb5, 0x80, 0x7f, 0xff, 0x80,
+  0x5f, 0xda, 0xb5, 0xa5, 0x96, 0x58, 0xd6, 0x31, 0x8c, 0x63, 0x35, 0xb5, 0xbf, 0xef, 0xac, 0x06,
+  0xb3, 0x58, 0x00, 0x00, 0x7f, 0xb3, 0x35, 0xb5, 0xac, 0xb5, 0xdf, 0xff, 0xee, 0x66, 0x63, 0x36,
+  0x36, 0x33, 0xa7, 0xff, 0xf9, 0xff, 0x76, 0x31, 0x9a, 0xf5, 0x86, 0x6b, 0x35, 0x9a, 0xc3, 0x5b,
+  0x5a, 0xda, 0xef, 0xe0, 0x63, 0x5b, 0x4c, 0x1a, 0xfb, 0xff, 0xad, 0xac, 0x33, 0x5e, 0xb3, 0x5e,
+  0xb6, 0xb6, 0x1a, 0xf5, 0x83, 0x17, 0x7f, 0xf4, 0xd6, 0xb0, 0x08, 0x06, 0xc3, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0xfd, 0x63, 0x06, 0x19, 0x7a, 0x60, 0x34, 0x30, 0x00, 0x0f, 0xff, 0xb3, 0x18, 0xcd,
+  0xfd, 0x34, 0x6b, 0x06, 0x6b, 0x63, 0x19, 0x21, 0x21, 0x8d, 0xad, 0xaf, 0x58, 0xcd, 0x6d, 0x63,
+  0x58, 0x7f, 0xff, 0xf6, 0xeb, 0x03, 0x4c, 0xb0, 0xd3, 0x5f, 0xcc, 0xc3, 0x31, 0xaf, 0x58, 0xc6,
+  0x0c, 0x5f, 0x2d, 0x6b, 0x2d, 0x65, 0x86, 0x98, 0x6b, 0x0d, 0x63, 0xff, 0xb6, 0xfe, 0xee, 0x5e,
+  0x98, 0xd6, 0x19, 0x7a, 0x60, 0xc0, 0xeb, 0x2c, 0x35, 0x96, 0xd3, 0x0f, 0xee, 0x35, 0xac, 0xbd,
+  0x35, 0x8c, 0xb6, 0xb1, 0xac, 0xc3, 0x18, 0x63, 0x0c, 0x35, 0x8d, 0x6b, 0x00, 0x7f, 0xff, 0x80,
+  0x3e, 0xa5, 0xa2, 0xcb, 0x5a, 0xc3, 0x06, 0xd6, 0xd6, 0xc3, 0x31, 0xad, 0xdf, 0xff, 0x62, 0xcd,
+  0x6b, 0x6b, 0x00, 0x00, 0x0f, 0xfd, 0x6c, 0x6b, 0x69, 0xad, 0x1f, 0xff, 0xdf, 0x63, 0x33, 0x1b,
+  0x33, 0x1e, 0x7f, 0xff, 0xdf, 0xf7, 0x31, 0x8c, 0x63, 0x18, 0x61, 0x83, 0x0c, 0x1a, 0xda, 0xdf,
+  0x7f, 0x06, 0xb6, 0xb1, 0x96, 0x69, 0xbb, 0xff, 0xf8, 0xd6, 0x6b, 0x6b, 0x31, 0x8c, 0xd6, 0xc3,
+  0x5e, 0xb5, 0xb4, 0xcb, 0xff, 0xfd, 0xd5, 0xad, 0x6b, 0x01, 0x20, 0xf6, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0x98, 0xd6, 0x6b, 0x18, 0x30, 0x1a, 0xd3, 0x40, 0x00, 0x7f, 0x7d, 0x8c, 0x66, 0x36,
+  0xff, 0xe3, 0x4d, 0x61, 0x8c, 0x63, 0x62, 0x42, 0x43, 0x31, 0x9a, 0xf5, 0xb5, 0x98, 0xd6, 0x65,
+  0x8d, 0xff, 0xff, 0xe5, 0xad, 0x60, 0x35, 0xac, 0xb1, 0x7c, 0xc6, 0x31, 0x8c, 0x61, 0x9a, 0xda,
+  0xd5, 0xd6, 0xb5, 0xa6, 0xb5, 0xac, 0x5e, 0x8c, 0x1a, 0xcd, 0x6b, 0x69, 0xb8, 0xb8, 0x35, 0xb4,
+  0xc3, 0x2d, 0xad, 0x66, 0xb5, 0xb4, 0x01, 0xf6, 0xb0, 0xd6, 0xb0, 0xd6, 0x3f, 0xf8, 0x6b, 0x58,
+  0x35, 0x86, 0x5e, 0xb5, 0xb5, 0x9a, 0xda, 0xcd, 0x6d, 0x66, 0x1a, 0xda, 0xc1, 0xac, 0x18, 0x3f,
+  0xff, 0xc0, 0x0f, 0xe9, 0x68, 0x5a, 0x69, 0xac, 0x60, 0xda, 0xd8, 0x6d, 0x6d, 0x6d, 0x6d, 0x7f,
+  0xff, 0xaa, 0x65, 0x8d, 0x61, 0x80, 0x00, 0x0d, 0xfb, 0x0d, 0xac, 0x69, 0xa3, 0xfb, 0xff, 0xed,
+  0xad, 0xaf, 0x19, 0x99, 0x8f, 0xff, 0xff, 0xff, 0x7f, 0xcf, 0x58, 0xda, 0xd8, 0x61, 0x9a, 0xcd,
+  0x66, 0xb0, 0x61, 0xac, 0xca, 0xff, 0x83, 0x0c, 0x6b, 0x03, 0x5b, 0xff, 0xfb, 0x98, 0x33, 0x0c,
+  0x66, 0x18, 0xcd, 0x63, 0x59, 0xa6, 0xff, 0xfe, 0xad, 0x65, 0x80, 0x9c, 0x8a, 0xc3, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfd, 0x63, 0x0c, 0x18, 0xcb, 0x35, 0xad, 0x62, 0x00, 0x05, 0xff, 0xc6, 0x33,
+  0x1b, 0x5e, 0x9f, 0xf0, 0xd6, 0x0c, 0xc6, 0x36, 0x24, 0xa4, 0xb3, 0x19, 0x8c, 0x66, 0x18, 0x60,
+  0x6f, 0xff, 0xa6, 0xb2, 0xc0, 0x35, 0xad, 0xfc, 0x33, 0x5b, 0x0c, 0xc3, 0x30, 0x66, 0xba, 0x9a,
+  0x68, 0xd3, 0x5a, 0xd6, 0x34, 0xc3, 0x58, 0xd6, 0x1a, 0xdb, 0x7b, 0xf7, 0xf5, 0xe9, 0x86, 0xb0,
+  0x60, 0x60, 0x00, 0x50, 0x1a, 0xc3, 0x59, 0xfd, 0x4d, 0x6b, 0x03, 0x58, 0xd6, 0x35, 0x9a, 0xda,
+  0xcd, 0x6d, 0x66, 0x18, 0xd6, 0x65, 0xe9, 0xac, 0x68, 0x1f, 0xff, 0xe0, 0x05, 0xfc, 0x41, 0x34,
+  0x34, 0xc6, 0xb3, 0x19, 0x8c, 0x66, 0x19, 0xaf, 0xfe, 0xe5, 0x8d, 0x63, 0x5b, 0x00, 0x00, 0xf7,
+  0x98, 0xcd, 0x60, 0x6e, 0xcf, 0xff, 0xf7, 0x69, 0x98, 0xd8, 0xd8, 0xda, 0x13, 0xff, 0xf7, 0xff,
+  0x9a, 0xf5, 0xeb, 0x31, 0x8c, 0x61, 0x8d, 0x63, 0x59, 0xac, 0x18, 0x6b, 0x77, 0xfc, 0x35, 0xb5,
+  0x8d, 0x61, 0xa6, 0xbe, 0xff, 0xe6, 0x18, 0xc6, 0x19, 0x86, 0x6b, 0x30, 0x6b, 0x1b, 0xfb, 0xfe,
+  0x5a, 0xcb, 0x02, 0xc2, 0x66, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xf5, 0x98, 0x31, 0x86, 0xb1,
+  0xac, 0x58, 0x00, 0x03, 0xfb, 0xfb, 0x18, 0xda, 0xf5, 0xeb, 0xd6, 0xdf, 0xfd, 0x69, 0x83, 0x19,
+  0x8c, 0xc9, 0x49, 0x3e, 0x1e, 0xb3, 0x31, 0x8c, 0x33, 0x58, 0xd3, 0x5c, 0x69, 0xac, 0xb0, 0x1d,
+  0xd8, 0x66, 0x31, 0x8c, 0x63, 0x0c, 0x5f, 0x01, 0xa0, 0x69, 0xac, 0xb3, 0x5a, 0xda, 0x63, 0x58,
+  0x6b, 0x34, 0x75, 0x4d, 0xff, 0x4c, 0x1a, 0xc3, 0x58, 0x35, 0x80, 0x01, 0x43, 0x5a, 0xc3, 0x5b,
+  0xfe, 0xb5, 0xad, 0x60, 0xd6, 0x5e, 0xb5, 0xe9, 0x8c, 0x31, 0x86, 0x6b, 0x6b, 0x35, 0xb5, 0x83,
+  0x03, 0x03, 0xff, 0xfc, 0x00, 0x7d, 0xcb, 0x56, 0x80, 0x1a, 0xcd, 0x6d, 0x6c, 0x63, 0x31, 0x8c,
+  0x6b, 0xef, 0xf9, 0x66, 0xb5, 0xb5, 0x98, 0x00, 0x1b, 0xcd, 0xaf, 0x58, 0xc2, 0xc2, 0xfe, 0xfe,
+  0x19, 0x99, 0x98, 0xda, 0x2b, 0xff, 0xdb, 0x19, 0x9a, 0xf5, 0xb5, 0xb0, 0x6d, 0x61, 0x86, 0xb3,
+  0x5a, 0xda, 0x63, 0x2f, 0x7d, 0xff, 0xd8, 0xc3, 0x0c, 0x06, 0xb5, 0x7f, 0xff, 0x61, 0x86, 0x31,
+  0x86, 0x61, 0xaf, 0x5a, 0xda, 0xd6, 0x3f, 0xfb, 0x96, 0x58, 0x0c, 0x0a, 0xec, 0xb6, 0xb0, 0x00,
+  0x00, 0x00, 0x03, 0x7e, 0xc3, 0x0c, 0x60, 0xc6, 0xb0, 0x0c, 0x00, 0x0f, 0xff, 0xe3, 0x19, 0x99,
+  0x8d, 0x8d, 0xdf, 0xf3, 0x5a, 0xf4, 0xda, 0xd8, 0xcc, 0x96, 0x95, 0xe3, 0x1b, 0x18, 0xcc, 0x33,
+  0x58, 0x6b, 0x0b, 0x8d, 0x34, 0xd6, 0x57, 0x18, 0xc6, 0x31, 0x98, 0x66, 0x0c, 0xfe, 0x02, 0xc0,
+  0x34, 0x6b, 0x06, 0xb3, 0x58, 0x30, 0xd6, 0x31, 0xf2, 0xda, 0xd5, 0xfd, 0x83, 0x58, 0x35, 0x83,
+  0x20, 0x00, 0x1c, 0x35, 0x86, 0x9f, 0xf6, 0xb5, 0xac, 0x06, 0xb1, 0xac, 0xd6, 0x6b, 0x6b, 0x35,
+  0xb5, 0xb5, 0x98, 0x61, 0x86, 0x03, 0x03, 0xff, 0xfc, 0x00, 0x3f, 0xbb, 0x4b, 0x42, 0xc5, 0xb4,
+  0xc6, 0x6b, 0x63, 0x31, 0x98, 0x66, 0x4f, 0xff, 0xe2, 0xf4, 0xc6, 0xb6, 0xbd, 0x00, 0x1e, 0xcc,
+  0xc6, 0x1a, 0xcb, 0x2d, 0x7f, 0xff, 0x19, 0x8c, 0xcd, 0xad, 0xa3, 0xfe, 0x3b, 0xf1, 0x98, 0xcc,
+  0x63, 0x18, 0xc1, 0x86, 0x5b, 0x5a, 0xda, 0x61, 0x87, 0x7f, 0xf6, 0x60, 0xc6, 0xb0, 0xd6, 0x9a,
+  0xff, 0xfa, 0x18, 0xc3, 0x18, 0x66, 0xb6, 0xb1, 0xac, 0xd6, 0xb3, 0xff, 0xf9, 0x61, 0x66, 0x36,
+  0x30, 0x65, 0xb4, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xdb, 0x18, 0x63, 0x5b, 0x58, 0xcb, 0x34, 0xd6,
+  0x00, 0x0f, 0xbf, 0xfb, 0x19, 0x8d, 0xaf, 0x1b, 0x18, 0xff, 0xfb, 0x5a, 0xda, 0xcc, 0x66, 0xd2,
+  0x62, 0x63, 0x33, 0x31, 0x98, 0xc6, 0x30, 0x6b, 0x01, 0x70, 0x34, 0x77, 0x6b, 0x61, 0x8c, 0xc3,
+  0x6b, 0x6b, 0x6b, 0x33, 0xba, 0xcb, 0x2c, 0xb0, 0x06, 0xb5, 0x8d, 0x61, 0xad, 0xad, 0x6d, 0x6b,
+  0x17, 0xb8, 0x53, 0x59, 0x6f, 0xf8, 0x19, 0x66, 0x98, 0x0c, 0x00, 0x00, 0xa6, 0x59, 0xab, 0xfb,
+  0x5a, 0xd6, 0x59, 0xa6, 0x1a, 0xcc, 0x19, 0xad, 0xac, 0xc3, 0x30, 0xc3, 0x0c, 0x0d, 0x03, 0xff,
+  0xfc, 0x00, 0x3e, 0x7c, 0x21, 0x6b, 0x5a, 0xc6, 0x18, 0xcc, 0xd7, 0x86, 0xd7, 0xac, 0x6b, 0x6f,
+  0xff, 0xf4, 0xe8, 0x30, 0x6d, 0x66, 0x60, 0x66, 0xc6, 0xd6, 0xd6, 0x6b, 0x5a, 0xd1, 0xf7, 0xfd,
+  0x8c, 0xc6, 0xc6, 0x69, 0x4f, 0x1e, 0x8c, 0x3d, 0x66, 0x63, 0x30, 0xc6, 0x0c, 0x6b, 0x0d, 0x61,
+  0xac, 0x60, 0xfb, 0xf8, 0xd6, 0xd6, 0x6b, 0x06, 0x9a, 0xd7, 0xfd, 0xf6, 0x99, 0xac, 0xd6, 0xd6,
+  0x61, 0xaf, 0x58, 0x6b, 0x34, 0xd7, 0xff, 0xc2, 0xc0, 0x78, 0x6c, 0xd6, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0xb0, 0xc6, 0x19, 0xac, 0xd6, 0x1a, 0xcb, 0x00, 0x07, 0xff, 0xdc, 0xcc, 0x66, 0x66,
+  0x66, 0xd7, 0xad, 0xff, 0xdd, 0xac, 0xc3, 0x6b, 0xc6, 0x4d, 0x4d, 0x66, 0xc6, 0x3d, 0x66, 0xbd,
+  0x66, 0x06, 0x40, 0x17, 0x58, 0x7f, 0x06, 0x6b, 0x63, 0x0f, 0x58, 0xcc, 0x31, 0xbb, 0xed, 0x34,
+  0xd6, 0xb2, 0xc0, 0x35, 0x83, 0x2f, 0x58, 0x6b, 0x35, 0x82, 0xd2, 0xe3, 0x59, 0x62, 0xdf, 0xd1,
+  0xad, 0x61, 0xad, 0x63, 0x00, 0x00, 0x03, 0xb5, 0x85, 0xf5, 0xa6, 0xb2, 0xcd, 0x30, 0xd6, 0xd6,
+  0x31, 0x86, 0x6b, 0x61, 0x8c, 0x30, 0xc1, 0xa0, 0x3f, 0xff, 0xc0, 0x07, 0xc3, 0x7f, 0xda, 0x2d,
+  0x1a, 0x65, 0xeb, 0x19, 0x8c, 0xc6, 0xc3, 0x6b, 0x35, 0x9b, 0xff, 0xbf, 0x86, 0xb3, 0x0c, 0x66,
+  0x63, 0x6b, 0xc3, 0xd6, 0x30, 0x68, 0xd5, 0xbf, 0xfa, 0xd6, 0xd7, 0xaf, 0x5b, 0x1a, 0x67, 0xab,
+  0x85, 0x98, 0xd8, 0x6c, 0x33, 0x0c, 0x30, 0x60, 0x65, 0xb5, 0xad, 0xac, 0x37, 0xff, 0x73, 0x59,
+  0x83, 0x01, 0xad, 0x37, 0xdf, 0xfc, 0x63, 0x59, 0xad, 0xac, 0xd6, 0x61, 0xac, 0xd6, 0x1a, 0x7f,
+  0xf5, 0x60, 0xc8, 0x47, 0x8d, 0x60, 0x60, 0x00, 0x00, 0x00, 0x07, 0xed, 0x9a, 0xcc, 0x6b, 0x60,
+  0xc3, 0x58, 0x00, 0x05, 0xff, 0xff, 0xe9, 0x9a, 0xf5, 0xb3, 0x1b, 0x33, 0x33, 0x1f, 0xf7, 0x59,
+  0xaf, 0x59, 0x99, 0x93, 0x93, 0xb1, 0x9b, 0x19, 0x8c, 0xd7, 0xad, 0x7a, 0x60, 0x00, 0x75, 0xdf,
+  0x18, 0xc3, 0x31, 0x8c, 0xc6, 0x31, 0xaf, 0x4f, 0xe0, 0x1a, 0x6b, 0x5a, 0xc0, 0xd6, 0x0c, 0x35,
+  0xb5, 0xad, 0xad, 0x63, 0x55, 0xd8, 0x5a, 0xcb, 0x0b, 0x77, 0xc3, 0x5a, 0xc6, 0x98, 0x00, 0x00,
+  0x00, 0x8b, 0x3f, 0xed, 0x69, 0xac, 0x5e, 0x98, 0x61, 0x86, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+  0x35, 0x99, 0x6d, 0x30, 0x1f, 0xff, 0xe0, 0x07, 0x76, 0xd6, 0x7f, 0x4b, 0x40, 0x6b, 0x5e, 0xb1,
+  0x99, 0x8c, 0xcc, 0x66, 0xb6, 0xb1, 0xbe, 0xff, 0xf8, 0xd6, 0x31, 0x87, 0xac, 0xcc, 0xc6, 0xc3,
+  0x35, 0x80, 0x16, 0xff, 0xf9, 0x98, 0xda, 0xf5, 0xb2, 0x7b, 0x8f, 0x69, 0x8d, 0x8c, 0xc6, 0x63,
+  0x0c, 0x6b, 0x35, 0x81, 0x96, 0xd6, 0xb3, 0x58, 0xcf, 0xff, 0xa3, 0x35, 0x8c, 0xb6, 0x8d, 0x68,
+  0xdf, 0xff, 0xfa, 0x4d, 0x6d, 0x61, 0x86, 0x30, 0xc6, 0xb1, 0xac, 0x1b, 0xff, 0xb8, 0x04, 0x84,
+  0x39, 0x96, 0x35, 0x80, 0x00, 0x00, 0x00, 0x37, 0xfa, 0xcc, 0x33, 0x0c, 0x60, 0xc0, 0xc0, 0x03,
+  0xfe, 0xfe, 0xb3, 0x5e, 0x33, 0x63, 0x66, 0x63, 0x67, 0xfd, 0xfd, 0x9a, 0xda, 0xf5, 0xeb, 0xd2,
+  0x82, 0x83, 0x63, 0x66, 0x33, 0x18, 0xc1, 0x80, 0x00, 0x7f, 0xff, 0x2d, 0xad, 0xac, 0xc6, 0x6b,
+  0xd6, 0x66, 0xb6, 0x18, 0xdf, 0xf1, 0x60, 0x0d, 0x32, 0xc0, 0xcb, 0x6b, 0x0c, 0x18, 0xd6, 0x05,
+  0x1d, 0x3e, 0xb2, 0xc1, 0x63, 0xee, 0x69, 0xad, 0x66, 0x9a, 0xcc, 0x00, 0x00, 0x01, 0xd9, 0xfc,
+  0x9a, 0x6b, 0x03, 0x0c, 0x6b, 0x6b, 0x6b, 0x31, 0xaf, 0x59, 0x8c, 0x31, 0xac, 0xd0, 0x07, 0xff,
+  0xf8, 0x02, 0xfb, 0x18, 0xdf, 0xfc, 0x9b, 0xb0, 0xb3, 0x59, 0xaf, 0x59, 0xb5, 0xeb, 0x63, 0x31,
+  0x86, 0x19, 0xff, 0xfe, 0x90, 0xd6, 0x19, 0xad, 0x8c, 0x7a, 0xcc, 0xcc, 0x33, 0x58, 0xb0, 0xb5,
+  0x7f, 0x19, 0x9a, 0xf0, 0xd3, 0xfb, 0x9a, 0x5e, 0xb6, 0x33, 0x6b, 0x63, 0x18, 0xc3, 0x59, 0xac,
+  0x1a, 0xc1, 0xac, 0xd6, 0x19, 0xff, 0xfc, 0x6b, 0xd6, 0x19, 0x6d, 0x1a, 0xd1, 0xbf, 0xfe, 0xe6,
+  0x35, 0x9a, 0xcc, 0xbd, 0x63, 0x5b, 0x58, 0x30, 0x3b, 0xfe, 0xd0, 0x50, 0x4a, 0x6b, 0x58, 0x30,
+  0x00, 0x00, 0x00, 0x03, 0xfc, 0xc6, 0x61, 0x9a, 0xda, 0xcc, 0xb3, 0x5a, 0x00, 0x1f, 0xff, 0xdc,
+  0x6d, 0x6c, 0xcc, 0xcd, 0x8f, 0x5b, 0x1b, 0x7f, 0xdf, 0xf6, 0x63, 0x33, 0x32, 0x8a, 0x8e, 0x63,
+  0xc3, 0xd6, 0xc3, 0x30, 0x60, 0x00, 0x1f, 0xfd, 0xf6, 0xbd, 0x63, 0x18, 0xcc, 0x63, 0x31, 0xaf,
+  0x59, 0xbb, 0xfb, 0x4c, 0xb0, 0x06, 0xb2, 0xc6, 0xb0, 0x63, 0x59, 0xac, 0xd3, 0x0d, 0x4d, 0x4f,
+  0xac, 0x58, 0x58, 0xb7, 0x7d, 0x6d, 0x19, 0x66, 0x98, 0x00, 0x00, 0x00, 0x56, 0xff, 0x86, 0x9a,
+  0xc3, 0x59, 0xad, 0xac, 0xc3, 0x35, 0xb0, 0xda, 0xcc, 0x31, 0x97, 0xa6, 0x01, 0xff, 0xfe, 0x01,
+  0x7d, 0x86, 0xd6, 0xbf, 0xe8, 0x5a, 0xd6, 0x1a, 0xf5, 0x99, 0x8d, 0xaf, 0x0d, 0x86, 0x30, 0x67,
+  0xff, 0x7f, 0x35, 0xb5, 0xb5, 0x99, 0x8c, 0xcc, 0x66, 0x19, 0xad, 0x65, 0xad, 0x17, 0xd6, 0xc3,
+  0x63, 0x7f, 0xd3, 0xba, 0x99, 0x66, 0xc6, 0xc6, 0x63, 0x19, 0xac, 0xcb, 0x6b, 0x59, 0xa6, 0x03,
+  0x06, 0x19, 0xf7, 0xfd, 0xac, 0x6b, 0x6b, 0x01, 0xa6, 0x8d, 0xff, 0xdf, 0x65, 0xeb, 0x5e, 0x98,
+  0xc3, 0x0c, 0x35, 0x9a, 0xd6, 0x1f, 0x7f, 0x19, 0x5d, 0x45, 0xad, 0x60, 0xd6, 0x6b, 0x00, 0x00,
+  0x00, 0x0f, 0x7b, 0x18, 0xcd, 0x7a, 0xc6, 0x6b, 0x0c, 0xb0, 0x01, 0x7f, 0xff, 0xf9, 0xe3, 0x1b,
+  0x5e, 0x3d, 0x7a, 0xf1, 0xb3, 0x19, 0xbf, 0xef, 0xe6, 0x33, 0x33, 0x29, 0xa9, 0xe6, 0x66, 0xd7,
+  0x8c, 0x63, 0x0c, 0x00, 0x03, 0xfb, 0xfe, 0x61, 0x8c, 0xc3, 0x6b, 0x61, 0xb5, 0xb5, 0xb5, 0x9b,
+  0xfa, 0x86, 0xb2, 0xc0, 0x6b, 0x2c, 0xd6, 0x0c, 0x60, 0xc3, 0x58, 0xd2, 0x4e, 0x5f, 0x2c, 0x2c,
+  0x2c, 0xb5, 0xdc, 0xb3, 0x4d, 0x63, 0x58, 0x00, 0x00, 0x00, 0x5d, 0xbf, 0x83, 0x5a, 0xc6, 0x5e,
+  0xb1, 0x9a, 0xda, 0xda, 0xda, 0xd8, 0x6d, 0x66, 0xb6, 0xb0, 0xc0, 0x1f, 0xff, 0xe0, 0x1f, 0xc6,
+  0xc3, 0x37, 0xf7, 0xf1, 0x34, 0xd6, 0xb3, 0x18, 0xcc, 0xcc, 0x6c, 0x36, 0xb3, 0x2f, 0x5a, 0xdf,
+  0x7f, 0xfd, 0xac, 0xc3, 0x31, 0x8d, 0x8c, 0x6d, 0x6d, 0x61, 0xad, 0x68, 0x17, 0x2c, 0xcc, 0xea,
+  0x9c, 0xcd, 0xc3, 0xd8, 0xd8, 0xcd, 0xad, 0x8c, 0x31, 0x83, 0x58, 0xd3, 0x01, 0x83, 0x5b, 0x59,
+  0xff, 0x7d, 0xac, 0xd6, 0x6b, 0x01, 0xad, 0x1a, 0xff, 0xba, 0xc6, 0xb1, 0xac, 0xd6, 0xd6, 0x35,
+  0x9a, 0xc3, 0x58, 0x3f, 0xbe, 0x2f, 0x2c, 0xda, 0x65, 0x9a, 0x61, 0x80, 0x00, 0x00, 0x06, 0xfc,
+  0xcc, 0x63, 0x30, 0xcd, 0x66, 0xb0, 0x00, 0x3f, 0xbf, 0xfe, 0x63, 0x33, 0x33, 0x66, 0x66, 0xc6,
+  0xc3, 0x7f, 0x7f, 0xd8, 0xcc, 0x78, 0xaa, 0xab, 0x99, 0xb1, 0xeb, 0x61, 0xb5, 0x8c, 0x00, 0x03,
+  0xbf, 0xfe, 0x31, 0xad, 0x8d, 0x7a, 0xd8, 0x6d, 0x6d, 0x7a, 0xc6, 0x37, 0xf7, 0xd8, 0x69, 0xac,
+  0x59, 0xa6, 0xb0, 0xd6, 0x6b, 0x18, 0x31, 0xac, 0x1a, 0x8c, 0x90, 0xcb, 0x16, 0x16, 0x5a, 0xd3,
+  0xee, 0xd6, 0x0d, 0x63, 0x58, 0x60, 0x00, 0x00, 0x2a, 0xdf, 0xc0, 0xd6, 0x6b, 0x18, 0x66, 0x35,
+  0xeb, 0x6b, 0x6b, 0xd6, 0x6b, 0xd6, 0x30, 0x00, 0x3f, 0xff, 0xc0, 0x7f, 0x19, 0x8c, 0x67, 0xff,
+  0xd5, 0xa0, 0x35, 0xb5, 0x99, 0x8d, 0x8c, 0xcc, 0x66, 0xbd, 0x33, 0x5a, 0xcf, 0xff, 0xf4, 0x3c,
+  0x31, 0x8c, 0xd7, 0x86, 0xc6, 0x31, 0xac, 0x69, 0xa1, 0x68, 0x96, 0x50, 0x9a, 0xc5, 0xbb, 0xd8,
+  0xd9, 0x8c, 0xcc, 0x66, 0xb3, 0x59, 0xac, 0xbd, 0x19, 0x61, 0xac, 0x35, 0x98, 0x7f, 0xff, 0x6b,
+  0x1a, 0xcd, 0x60, 0xd3, 0x4d, 0x1f, 0xdf, 0xcc, 0x35, 0x9a, 0xcd, 0x63, 0x0c, 0x18, 0x35, 0x83,
+  0xf9, 0x99, 0x86, 0x6b, 0x58, 0x35, 0x8d, 0x60, 0x00, 0x00, 0x03, 0xf7, 0xad, 0x87, 0xac, 0x6d,
+  0x66, 0x18, 0x00, 0x07, 0xff, 0xdf, 0xf6, 0xd6, 0xcc, 0x6c, 0xcd, 0x99, 0xb1, 0x9b, 0x59, 0xfd,
+  0xfc, 0x3d, 0x7a, 0xf1, 0x5d, 0x5f, 0x36, 0x66, 0x66, 0x31, 0x9a, 0xc0, 0x00, 0x3f, 0xff, 0xbb,
+  0x6b, 0x31, 0x86, 0xc3, 0x33, 0x5b, 0x0c, 0xc3, 0x7f, 0xd2, 0xc3, 0x4d, 0x60, 0x35, 0x83, 0x0d,
+  0x6d, 0x66, 0xb0, 0xc0, 0xd4, 0x2c, 0x4e, 0x2c, 0x58, 0xb2, 0x69, 0xab, 0xf9, 0xad, 0x66, 0x98,
+  0xd6, 0x30, 0x00, 0x00, 0x17, 0x69, 0xd1, 0xac, 0x19, 0xad, 0x86, 0x33, 0x0d, 0xaf, 0x58, 0xda,
+  0xc6, 0x00, 0x07, 0xff, 0xf8, 0x1f, 0x76, 0xc6, 0x61, 0xb7, 0xf7, 0xfd, 0x05, 0x86, 0xb6, 0xb6,
+  0x33, 0x33, 0x1b, 0x5e, 0xb3, 0x1a, 0xcd, 0x62, 0xff, 0xbf, 0xb6, 0xb3, 0x5e, 0xb6, 0xb6, 0x33,
+  0x18, 0xc6, 0xb0, 0x37, 0x62, 0x16, 0xa0, 0x93, 0x37, 0xb6, 0x86, 0xc6, 0xcc, 0x66, 0x63, 0x5b,
+  0x58, 0xd6, 0x0d, 0x6b, 0x03, 0x2d, 0xad, 0x6d, 0x6d, 0xf7, 0xff, 0x35, 0xb5, 0x9a, 0xc0, 0x35,
+  0xa6, 0x9f, 0xfd, 0xda, 0xc6, 0xb1, 0x97, 0xac, 0x6b, 0x32, 0xf4, 0xc1, 0xac, 0x1a, 0x9a, 0x7f,
+  0xe6, 0xb5, 0x81, 0xac, 0x6b, 0x5b, 0x00, 0x00, 0x01, 0xef, 0x63, 0x1b, 0x0d, 0xad, 0xad, 0xac,
+  0x30, 0x00, 0xff, 0xff, 0xf4, 0x5e, 0xb3, 0x33, 0x66, 0x66, 0xcd, 0x8c, 0xcc, 0x3e, 0xff, 0xef,
+  0x5e, 0xb6, 0xc5, 0x95, 0x9d, 0x8f, 0x5e, 0x36, 0x1b, 0x5b, 0x5a, 0xd8, 0x00, 0x3f, 0xfb, 0xe1,
+  0x8c, 0x36, 0xbd, 0x66, 0x31, 0x98, 0xc3, 0x35, 0xf7, 0x59, 0x61, 0xad, 0x65, 0xb4, 0xd6, 0x35,
+  0x8c, 0x35, 0xb5, 0x8c, 0xb3, 0x4c, 0xfd, 0x06, 0x58, 0xb1, 0x6b, 0x5a, 0x34, 0xbe, 0x8d, 0x60,
+  0xd6, 0xd6, 0x35, 0xb0, 0x00, 0x00, 0xe8, 0x1f, 0x69, 0x86, 0x19, 0x8c, 0x63, 0x31, 0x8c, 0xc3,
+  0x35, 0x80, 0x03, 0xff, 0xfc, 0x1f, 0x76, 0xd6, 0xc6, 0x61, 0xbf, 0xff, 0xb8, 0xb5, 0xac, 0x6b,
+  0x6b, 0xd6, 0xc6, 0xc6, 0x66, 0x33, 0x5e, 0x99, 0xa6, 0x1f, 0xdf, 0xf1, 0x9a, 0xda, 0xf5, 0x99,
+  0x8c, 0x63, 0x1a, 0xcb, 0x02, 0x6a, 0xd1, 0x09, 0x31, 0x6d, 0x59, 0x9b, 0x33, 0x1e, 0xb6, 0x31,
+  0x86, 0x35, 0x81, 0xad, 0x60, 0xd6, 0xb3, 0x58, 0xc3, 0xfe, 0xf9, 0x8c, 0x1a, 0xc3, 0x4d, 0x35,
+  0xa7, 0xff, 0xf1, 0x81, 0x86, 0x18, 0x61, 0xac, 0xd6, 0x1a, 0xc9, 0x89, 0x92, 0x7f, 0xfd, 0xad,
+  0x60, 0x6b, 0x1a, 0xd6, 0x00, 0x00, 0x03, 0x7e, 0x66, 0x36, 0xbd, 0x6d, 0x7a, 0xc6, 0x35, 0x80,
+  0x0e, 0xff, 0xff, 0xf1, 0x6b, 0xd6, 0xcc, 0xcd, 0x99, 0xb3, 0x33, 0x33, 0x0d, 0xff, 0x7d, 0x6c,
+  0xd8, 0xb6, 0xb8, 0x6d, 0x8d, 0x98, 0xcd, 0x7a, 0x63, 0x00, 0x0f, 0xbf, 0xfa, 0xcd, 0x6d, 0x6d,
+  0x6c, 0x36, 0xb6, 0x19, 0x8c, 0x61, 0xbe, 0xfe, 0xd6, 0xb0, 0x35, 0xac, 0x1a, 0xc3, 0x0d, 0x6d,
+  0x66, 0xb1, 0x96, 0x69, 0x9e, 0x5f, 0x72, 0xc5, 0x96, 0x5a, 0x34, 0x2d, 0xf7, 0xd8, 0x6b, 0x1a,
+  0xcd, 0x6d, 0x61, 0x80, 0x00, 0x1f, 0xd9, 0x60, 0xeb, 0x0c, 0xd6, 0xd7, 0xac, 0xc6, 0x36, 0xb6,
+  0xbd, 0x66, 0x18, 0x00, 0x1f, 0xff, 0xe1, 0xdf, 0x36, 0x31, 0xb5, 0xb2, 0xef, 0xff, 0x96, 0x9a,
+  0x63, 0x5b, 0x19, 0x99, 0x98, 0xd8, 0x6d, 0x66, 0xb3, 0x59, 0x65, 0xff, 0xfd, 0xac, 0xc6, 0x31,
+  0x98, 0xcd, 0x7a, 0xd7, 0xa6, 0x58, 0xb5, 0xa2, 0xd2, 0x6e, 0xd4, 0xc5, 0x75, 0x26, 0xc6, 0xcd,
+  0xaf, 0x5e, 0xb6, 0x19, 0xac, 0xd6, 0x03, 0x58, 0xb6, 0x8c, 0xbd, 0x31, 0xad, 0xbb, 0xff, 0xed,
+  0x63, 0x0d, 0x60, 0x6b, 0x5a, 0xd6, 0xff, 0xbf, 0x8d, 0x63, 0x58, 0xd6, 0xd6, 0x35, 0xb5, 0x83,
+  0x06, 0xb2, 0xda, 0xe0, 0xdf, 0xfd, 0x58, 0x0c, 0xb1, 0xac, 0xb0, 0x00, 0x00, 0x7e, 0xf5, 0xeb,
+  0x6b, 0xc3, 0x61, 0xb5, 0x9a, 0xc0, 0x03, 0xfe, 0xff, 0xf8, 0x6c, 0x6c, 0x6d, 0x8f, 0x1b, 0x33,
+  0x6b, 0x61, 0x9f, 0xdf, 0xf6, 0xda, 0xf1, 0x79, 0x7b, 0x66, 0xc7, 0x8c, 0xc6, 0x18, 0xfb, 0xa0,
+  0x03, 0xff, 0xff, 0xda, 0xc3, 0x19, 0xaf, 0x59, 0x8c, 0xd7, 0xad, 0xac, 0xc6, 0x19, 0xff, 0xf0,
+  0xcb, 0x06, 0xb2, 0xcd, 0x30, 0xc1, 0x8c, 0x30, 0xd6, 0x1a, 0xce, 0x6f, 0x0b, 0x16, 0x5a, 0xd6,
+  0x80, 0x2d, 0xfd, 0x58, 0x30, 0xc3, 0x0c, 0x30, 0x00, 0x07, 0x73, 0x5a, 0xc3, 0x74, 0xc3, 0x31,
+  0x98, 0xc6, 0x63, 0x31, 0xaf, 0x5a, 0x00, 0x0f, 0xff, 0xf1, 0xdf, 0x33, 0x1b, 0x5e, 0xb3, 0x0f,
+  0xff, 0xfd, 0x8e, 0xd0, 0xd3, 0x0d, 0xad, 0x8d, 0x8d, 0x8c, 0xc6, 0x31, 0x83, 0x58, 0x3f, 0xfe,
+  0xec, 0xd6, 0xd7, 0xac, 0xc6, 0x33, 0x0c, 0x1a, 0xcb, 0x5a, 0x08, 0x21, 0x2f, 0x4d, 0x39, 0xb3,
+  0x33, 0x36, 0x33, 0x18, 0xc1, 0x81, 0xad, 0x65, 0x86, 0xb5, 0x8d, 0x66, 0xb6, 0xbf, 0xbf, 0x98,
+  0xd6, 0xd3, 0x03, 0x5a, 0xd6, 0xb5, 0xff, 0xfc, 0x35, 0x83, 0x1a, 0xcd, 0x66, 0xb3, 0x58, 0xd6,
+  0x1a, 0x53, 0x54, 0x0d, 0x5f, 0xfd, 0x80, 0xcb, 0x0d, 0x6b, 0x00, 0x00, 0x0f, 0x7e, 0xb6, 0xbc,
+  0x66, 0x33, 0x35, 0xb5, 0x8c, 0x00, 0xff, 0xfe, 0xff, 0xb1, 0xb5, 0xb3, 0x66, 0x67, 0xaf, 0x33,
+  0x33, 0x18, 0xc7, 0xf7, 0xd7, 0x8c, 0xc0, 0xc2, 0x79, 0x99, 0xb1, 0x98, 0x67, 0xff, 0x1a, 0x60,
+  0x1f, 0xfd, 0xfd, 0xad, 0xac, 0xd6, 0xc6, 0x31, 0x9a, 0xf5, 0xb5, 0xb5, 0x98, 0x67, 0xf7, 0xc3,
+  0x58, 0x1a, 0xd6, 0x69, 0x83, 0x1a, 0xf4, 0xcd, 0x63, 0x58, 0xd3, 0x37, 0x39, 0x96, 0x59, 0x6b,
+  0x46, 0x8b, 0x16, 0xbe, 0xe6, 0xb1, 0xac, 0xc3, 0x0c, 0x30, 0x00, 0x0b, 0xe0, 0xd6, 0xb3, 0x59,
+  0x5a, 0xd8, 0xc6, 0x63, 0x31, 0x98, 0xd7, 0xac, 0x00, 0x0f, 0xff, 0xf2, 0xfe, 0x33, 0x31, 0xb0,
+  0xcd, 0x7f, 0xdf, 0xfd, 0xa1, 0x7a, 0x61, 0xb1, 0x99, 0x99, 0x8d, 0x86, 0xd6, 0x6b, 0x1a, 0xc0,
+  0xff, 0xbe, 0x30, 0xcc, 0x66, 0xbd, 0x66, 0x1a, 0xda, 0x6b, 0x5a, 0x69, 0x68, 0x5a, 0x4b, 0xcf,
+  0x4a, 0x9e, 0xbd, 0x79, 0x8d, 0x8c, 0xc3, 0x1a, 0xc1, 0xad, 0x62, 0xc6, 0x9a, 0xc3, 0x0c, 0x1f,
+  0xff, 0xda, 0xc6, 0x1a, 0xc1, 0xad, 0x6b, 0x2d, 0xff, 0xdf, 0x59, 0xac, 0x1a, 0xf4, 0xcd, 0x63,
+  0x0d, 0x66, 0xb0, 0xc9, 0x69, 0x80, 0xd6, 0x7f, 0xfc, 0x06, 0xb1, 0x7a, 0x30, 0x00, 0x00, 0xf6,
+  0xf1, 0x99, 0x99, 0x8c, 0xc3, 0x1a, 0x00, 0x7f, 0xff, 0xfa, 0x73, 0x6b, 0x63, 0x6d, 0x79, 0x9e,
+  0xbc, 0x6c, 0xcc, 0x66, 0xb1, 0xdf, 0xfd, 0xe3, 0xcc, 0x6c, 0x7b, 0x66, 0x6c, 0xc6, 0xd6, 0xdf,
+  0x7c, 0x1a, 0x64, 0x1d, 0xff, 0xfc, 0xd6, 0xd6, 0x61, 0xb5, 0xb5, 0xeb, 0x35, 0xeb, 0x6b, 0x6b,
+  0x30, 0xcb, 0xff, 0x86, 0xb2, 0xcd, 0x32, 0xcd, 0x31, 0xad, 0xac, 0x33, 0x58, 0xd6, 0x1a, 0xcd,
+  0x4d, 0xf6, 0x2c, 0xb4, 0xd1, 0xab, 0x16, 0xb4, 0xfe, 0xed, 0xad, 0x7a, 0x66, 0x1a, 0xf5, 0x86,
+  0x18, 0x00, 0x7f, 0x58, 0x1a, 0xcd, 0x63, 0x10, 0xda, 0xf5, 0xb5, 0xeb, 0x6b, 0xd6, 0x61, 0x80,
+  0x01, 0xff, 0xfe, 0xbf, 0x8c, 0x66, 0x66, 0x31, 0x9d, 0xff, 0xff, 0xab, 0x2c, 0x5b, 0x58, 0xc6,
+  0xc6, 0xc6, 0xc6, 0x63, 0x18, 0xc1, 0xac, 0x0e, 0xff, 0xe3, 0x18, 0xc6, 0x63, 0x5e, 0xb3, 0x58,
+  0x69, 0xad, 0x02, 0x04, 0x96, 0x97, 0x8d, 0xd9, 0x9b, 0x33, 0x31, 0xb0, 0xc3, 0x59, 0xa6, 0xb2,
+  0xc0, 0x1a, 0xc3, 0x0d, 0x7a, 0xdf, 0xfd, 0xf3, 0x18, 0x35, 0x86, 0xb5, 0x8b, 0x3f, 0xbf, 0xeb,
+  0x0d, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0xb0, 0x43, 0x44, 0x03, 0x58, 0xff, 0xb9, 0xa3, 0x59, 0x66,
+  0x98, 0x00, 0x01, 0xbd, 0xe3, 0x33, 0x1e, 0xb6, 0x31, 0x8d, 0x60, 0x0b, 0xff, 0xff, 0xc4, 0xc6,
+  0x6c, 0x6d, 0x8f, 0x1e, 0x36, 0x66, 0x31, 0xac, 0x3f, 0xfe, 0xd8, 0xca, 0xcc, 0xd9, 0xb1, 0xe3,
+  0x1b, 0xfa, 0x58, 0xd3, 0x58, 0x1f, 0xff, 0xdc, 0xc3, 0x0d, 0xad, 0xad, 0xaf, 0x59, 0x86, 0xd6,
+  0xd6, 0x60, 0xcf, 0xbf, 0x86, 0xb0, 0x1a, 0xc1, 0x83, 0x5e, 0xb0, 0xc6, 0x0d, 0x66, 0x99, 0x99,
+  0xad, 0x65, 0xac, 0x9a, 0x05, 0x96, 0x9a, 0xef, 0xac, 0xd6, 0x19, 0xad, 0xac, 0xd6, 0xd6, 0x30,
+  0x00, 0xfe, 0x5a, 0xc3, 0x58, 0xc3, 0x35, 0x9a, 0xd6, 0x33, 0x19, 0x8d, 0x00, 0x00, 0x7f, 0xff,
+  0xbf, 0xfb, 0x19, 0x98, 0xcc, 0xc3, 0x37, 0xff, 0xfe, 0xc7, 0xcb, 0x5a, 0xc6, 0xbd, 0x66, 0x66,
+  0x6d, 0x7a, 0xd9, 0xaf, 0x59, 0x86, 0x0d, 0x60, 0x3f, 0xff, 0x98, 0x66, 0xb6, 0x31, 0x86, 0x6b,
+  0x0d, 0x34, 0xd1, 0x64, 0x2d, 0x2d, 0x1f, 0x0c, 0x78, 0xd9, 0xb5, 0xe3, 0x30, 0xcd, 0x60, 0xd6,
+  0xb1, 0x60, 0x69, 0x81, 0x8c, 0x17, 0xff, 0xda, 0xcd, 0x66, 0xb5, 0xb4, 0xd6, 0x58, 0x77, 0xff,
+  0xf6, 0xb0, 0x6b, 0x1a, 0xda, 0xc3, 0x1a, 0xda, 0xc3, 0x58, 0x78, 0x79, 0x97, 0xa6, 0xb5, 0x8e,
+  0xff, 0x86, 0x9a, 0xc0, 0xc0, 0x00, 0x0f, 0xf1, 0xeb, 0x66, 0x66, 0x63, 0x30, 0xc0, 0x07, 0xf7,
+  0xff, 0xff, 0x75, 0xeb, 0x33, 0x33, 0x66, 0xcd, 0x99, 0xb3, 0x1b, 0x5b, 0x58, 0x1f, 0xf0, 0xd0,
+  0xd1, 0xe6, 0x6c, 0xd8, 0xd7, 0xd6, 0xb0, 0x1a, 0xc1, 0xbf, 0xbf, 0xff, 0xfc, 0x5a, 0xcd, 0x6d,
+  0x6d, 0x6d, 0x6c, 0x33, 0x18, 0x6d, 0x66, 0xb3, 0x2f, 0x7f, 0xfd, 0x35, 0xac, 0x06, 0x5b, 0x4c,
+  0x35, 0xb5, 0x98, 0x30, 0xcb, 0x69, 0x98, 0xda, 0x2c, 0xb5, 0xad, 0x68, 0x16, 0x5a, 0x34, 0xff,
+  0x96, 0x18, 0x63, 0x35, 0x9a, 0xda, 0xcc, 0x30, 0x0f, 0xb8, 0xd6, 0x0c, 0x31, 0x8d, 0x7a, 0xc6,
+  0x30, 0x66, 0xb5, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xeb, 0x31, 0x98, 0xf5, 0x99, 0xad, 0xaf, 0xef,
+  0xff, 0xe5, 0xa6, 0xb1, 0x87, 0xad, 0x8d, 0x98, 0xcd, 0xac, 0xcd, 0x6d, 0x61, 0xac, 0xb0, 0x7f,
+  0xf5, 0x66, 0x35, 0xeb, 0x6b, 0x6b, 0x6b, 0x35, 0x83, 0x4d, 0x01, 0x68, 0x4b, 0x43, 0xbf, 0x36,
+  0x3d, 0x78, 0xd9, 0x8c, 0x63, 0x2f, 0x46, 0x59, 0x60, 0x1a, 0x6b, 0x35, 0x86, 0x33, 0xff, 0xfa,
+  0x66, 0xb1, 0xac, 0x35, 0xac, 0x0b, 0xff, 0xfa, 0x6b, 0x0d, 0x61, 0x8d, 0x66, 0xb6, 0xb1, 0xac,
+  0xd6, 0x1a, 0x1a, 0x65, 0xb4, 0xd6, 0x0d, 0xf7, 0xfc, 0x34, 0xd6, 0x5b, 0x58, 0x00, 0x07, 0xec,
+  0xf5, 0xb3, 0x33, 0x31, 0xb0, 0xd7, 0xa0, 0x0f, 0xff, 0xbf, 0xfa, 0xcc, 0xc6, 0xda, 0xf3, 0x66,
+  0x6d, 0x8d, 0x8d, 0xac, 0xd6, 0x05, 0xf3, 0x53, 0x5b, 0xc6, 0xd8, 0xdd, 0xc6, 0xb5, 0x83, 0x58,
+  0x1b, 0xfb, 0xff, 0xff, 0xb0, 0xc3, 0x35, 0xb0, 0xc6, 0x61, 0x98, 0xd7, 0xac, 0x61, 0x87, 0xff,
+  0x43, 0x2c, 0x6b, 0x58, 0x30, 0x63, 0x0c, 0x30, 0xd6, 0x1a, 0x60, 0x65, 0x5a, 0xd6, 0xb4, 0x6a,
+  0xc5, 0xa6, 0x83, 0xbf, 0x9a, 0xc3, 0x30, 0xc6, 0x30, 0xc6, 0x30, 0x0f, 0xb8, 0x18, 0x31, 0x8d,
+  0x7a, 0xcc, 0x33, 0x5b, 0x58, 0xd6, 0x34, 0x00, 0x07, 0xff, 0xd5, 0x8c, 0xc6, 0x66, 0x6b, 0xd6,
+  0xd6, 0x7f, 0xff, 0xea, 0xcd, 0x1a, 0xc6, 0x36, 0xbd, 0x78, 0xcc, 0xc0, 0x19, 0x9a, 0xc6, 0xb5,
+  0x80, 0xff, 0xba, 0xda, 0xda, 0xda, 0xd8, 0x63, 0x0c, 0x0d, 0x34, 0x02, 0x6a, 0x5e, 0x01, 0xdd,
+  0xb3, 0x36, 0x3d, 0x7a, 0xf5, 0x98, 0xd6, 0x35, 0xac, 0x58, 0x03, 0x4d, 0x63, 0x5b, 0x58, 0x6f,
+  0xfb, 0xfb, 0x5b, 0x58, 0x60, 0x6b, 0x00, 0xff, 0xff, 0xcf, 0xd1, 0x96, 0xd3, 0x1a, 0xcd, 0x6d,
+  0x61, 0x8c, 0x18, 0x5a, 0x5a, 0xc0, 0xd6, 0x0c, 0xbb, 0xfe, 0x03, 0x58, 0x30, 0x00, 0x1e, 0xf6,
+  0x36, 0x66, 0x66, 0x66, 0xbd, 0x63, 0x00, 0x7f, 0xff, 0xfb, 0x7f, 0xcc, 0x6c, 0x6c, 0xcd, 0xb3,
+  0x36, 0x6c, 0x6d, 0x7a, 0xcd, 0x62, 0xc1, 0xb1, 0xba, 0xdb, 0x36, 0xe8, 0x0d, 0x60, 0x6b, 0x06,
+  0x77, 0xff, 0xff, 0x39, 0x8c, 0x31, 0x9a, 0xf5, 0x8c, 0xc3, 0x30, 0xc3, 0x19, 0x7a, 0xff, 0xfb,
+  0x4d, 0x60, 0x6b, 0x06, 0xb6, 0xb0, 0xc6, 0x0c, 0x6b, 0x0d, 0x2f, 0x31, 0xda, 0xc9, 0xa6, 0x8b,
+  0x2d, 0x68, 0x07, 0xff, 0x06, 0x19, 0x86, 0x6b, 0x31, 0x8c, 0x30, 0x1f, 0x75, 0x83, 0x0d, 0x6c,
+  0x33, 0x18, 0xd7, 0xac, 0xc1, 0x86, 0xb0, 0x00, 0x1f, 0x5e, 0xb6, 0x36, 0xb6, 0x36, 0x31, 0x9a,
+  0xcf, 0xff, 0xef, 0xfa, 0x03, 0x0c, 0xcc, 0xc6, 0xcc, 0x00, 0x0f, 0x6b, 0x06, 0x58, 0x35, 0xff,
+  0x7d, 0x98, 0x63, 0x35, 0xeb, 0x35, 0xb5, 0xad, 0xa3, 0x5a, 0x34, 0x5a, 0xd2, 0xef, 0x2e, 0x0d,
+  0x9b, 0x1e, 0x33, 0x6b, 0xd6, 0x30, 0x6b, 0x0b, 0x00, 0x69, 0xad, 0x6d, 0x6b, 0xd6, 0x1b, 0xbf,
+  0xfe, 0x61, 0x86, 0xb3, 0x5a, 0xc0, 0x3f, 0xff, 0xf4, 0x21, 0xad, 0x6d, 0x31, 0xac, 0xd6, 0xd6,
+  0x35, 0xb5, 0x8c, 0x25, 0x26, 0x98, 0x32, 0xc6, 0xb0, 0xff, 0xee, 0x01, 0x97, 0xac, 0x00, 0x0f,
+  0x79, 0x9b, 0x33, 0x36, 0xbc, 0x36, 0x0c, 0x01, 0xff, 0xff, 0xe7, 0xc6, 0xc6, 0x66, 0xd8, 0xf3,
+  0x36, 0x66, 0xd7, 0x86, 0x6b, 0x58, 0x0c, 0xad, 0x29, 0xa0, 0x03, 0x59, 0x6d, 0x30, 0x65, 0xbf,
+  0xff, 0xf8, 0xad, 0x7a, 0x66, 0x19, 0xaf, 0x58, 0xcd, 0x6c, 0x31, 0xad, 0xac, 0xd6, 0x37, 0xff,
+  0xd6, 0xb5, 0x86, 0x98, 0x18, 0x61, 0x86, 0x35, 0x9a, 0xc0, 0x5d, 0x61, 0xd6, 0xb5, 0xa0, 0x0b,
+  0x5a, 0x00, 0xff, 0xbb, 0x0d, 0x7a, 0xcc, 0x33, 0x0c, 0x66, 0xbd, 0x60, 0x3e, 0xf9, 0x96, 0xd6,
+  0xbd, 0x63, 0x19, 0x8c, 0x63, 0x35, 0x98, 0x35, 0x80, 0x00, 0xfe, 0xf5, 0xef, 0xc6, 0x33, 0x33,
+  0x19, 0x8c, 0x3e, 0xff, 0xff, 0xd1, 0x00, 0xc6, 0x36, 0x33, 0x63, 0x00, 0x03, 0x6c, 0x0c, 0x03,
+  0x5f, 0xfd, 0x0c, 0xc3, 0x31, 0x8d, 0x7a, 0x61, 0xa6, 0xb5, 0xa6, 0x8b, 0x4c, 0x39, 0x34, 0xb6,
+  0xc7, 0x8d, 0x8f, 0x59, 0x8c, 0x1a, 0xc0, 0x00, 0x1a, 0xd6, 0x18, 0x63, 0x5b, 0xff, 0xff, 0x11,
+  0x86, 0xbd, 0x31, 0xad, 0x60, 0x6b, 0xff, 0xff, 0x40, 0x0d, 0x61, 0x83, 0x1a, 0xda, 0xc6, 0x18,
+  0x61, 0xf1, 0xf3, 0x03, 0x03, 0x0d, 0x7d, 0xff, 0x0b, 0x69, 0x86, 0x00, 0x0f, 0x6f, 0x5e, 0x36,
+  0x6d, 0x78, 0xda, 0xf5, 0x9a, 0xc0, 0x2f, 0xff, 0xff, 0x01, 0x99, 0x99, 0xb3, 0x66, 0xcd, 0x99,
+  0x99, 0x98, 0x35, 0x85, 0x97, 0xd8, 0xb5, 0xa0, 0x2c, 0x69, 0x81, 0xac, 0xd6, 0xb6, 0xff, 0xff,
+  0xde, 0xfb, 0x5b, 0x5b, 0x59, 0xaf, 0x58, 0xc6, 0x6b, 0x6b, 0x30, 0xc6, 0x0c, 0x1f, 0xdd, 0x6b,
+  0x06, 0xb5, 0x8d, 0x63, 0x0d, 0x6d, 0x66, 0xb1, 0xac, 0x0b, 0x8c, 0x0d, 0x6b, 0x4d, 0x0b, 0x2d,
+  0x34, 0x0b, 0x7f, 0x7d, 0xac, 0x6b, 0xd6, 0x63, 0x0c, 0xc6, 0x31, 0x86, 0x3f, 0xb9, 0xac, 0x18,
+  0xc6, 0x33, 0x19, 0x86, 0xd6, 0x6b, 0x6b, 0x58, 0x00, 0x0f, 0xee, 0xef, 0xea, 0xbd, 0x66, 0x33,
+  0x33, 0x35, 0xeb, 0x0d, 0xff, 0xff, 0xab, 0xcb, 0x06, 0xbd, 0x66, 0x66, 0x3d, 0x7a, 0x00, 0x01,
+  0xec, 0x18, 0x06, 0xb7, 0xff, 0xf9, 0xde, 0x30, 0xda, 0xda, 0xda, 0xf5, 0x86, 0x0d, 0x6b, 0x59,
+  0x69, 0xa4, 0xcb, 0x5b, 0x13, 0xc7, 0xaf, 0x33, 0x33, 0x19, 0x97, 0xa6, 0x00, 0x01, 0xa3, 0x58,
+  0x35, 0xb2, 0xf5, 0x9f, 0xff, 0xcb, 0x1a, 0xda, 0xc3, 0x58, 0x1a, 0x7f, 0xff, 0xe7, 0xe0, 0x35,
+  0x8d, 0x63, 0x5b, 0x59, 0xac, 0xd6, 0x60, 0x18, 0x18, 0x30, 0x30, 0x30, 0xc7, 0x7f, 0xfc, 0xb0,
+  0x31, 0x80, 0x03, 0xdb, 0x66, 0xc7, 0x8d, 0x8d, 0x8c, 0x60, 0x07, 0xdf, 0xff, 0xfd, 0xb8, 0xc6,
+  0xcc, 0xd9, 0x9e, 0xbc, 0xd9, 0x99, 0x98, 0xc6, 0xb5, 0x8b, 0x2c, 0xae, 0x34, 0x05, 0x81, 0xac,
+  0x35, 0x86, 0x0f, 0xff, 0xfd, 0xaf, 0xfe, 0xc3, 0x18, 0x66, 0xb6, 0x1a, 0xf5, 0x98, 0x63, 0x0c,
+  0x18, 0x6f, 0xbf, 0xac, 0x06, 0xb0, 0x31, 0xac, 0xc1, 0x8d, 0x66, 0xb0, 0x2d, 0xaf, 0xeb, 0x4d,
+  0x34, 0x59, 0x6b, 0x40, 0x2d, 0xf7, 0xf0, 0xc6, 0x31, 0xaf, 0x5b, 0x5b, 0x5b, 0x0c, 0xc3, 0x1f,
+  0xf7, 0xf1, 0xac, 0x30, 0xda, 0xda, 0xf5, 0xb0, 0xd8, 0x66, 0xb3, 0x58, 0x00, 0x07, 0xf7, 0x3a,
+  0xb9, 0x33, 0x19, 0x98, 0xcc, 0xc6, 0x1a, 0xff, 0xef, 0xff, 0xeb, 0x2c, 0x6b, 0x33, 0x1b, 0x1b,
+  0x00, 0x00, 0x1e, 0x6d, 0x30, 0x69, 0x9f, 0xdf, 0xc3, 0x18, 0xc6, 0x63, 0x5e, 0x98, 0xd6, 0x58,
+  0xb2, 0xc9, 0x34, 0xc8, 0xb7, 0x9e, 0xbc, 0x6d, 0x8d, 0xaf, 0x5b, 0x59, 0xac, 0x00, 0x68, 0x1a,
+  0x6b, 0x59, 0xac, 0xd6, 0x63, 0xff, 0xbe, 0x61, 0x9a, 0xc3, 0x58, 0x34, 0xbf, 0xff, 0xf3, 0xec,
+  0x06, 0xb1, 0xac, 0xd6, 0x31, 0xad, 0xac, 0x60, 0x24, 0x24, 0x30, 0xd6, 0x1a, 0xda, 0xc6, 0xef,
+  0xff, 0xf3, 0xed, 0x60, 0x63, 0x00, 0x0f, 0x6d, 0x99, 0xb3, 0x63, 0x66, 0x36, 0xb0, 0x03, 0xff,
+  0xbf, 0xff, 0xfa, 0xb0, 0xd8, 0xd9, 0xb3, 0x36, 0xcc, 0xd9, 0x99, 0x8c, 0x35, 0xac, 0xb2, 0x92,
+  0xb4, 0xd2, 0xc5, 0x80, 0xc0, 0xc3, 0x58, 0xdf, 0xff, 0xfa, 0xdf, 0xff, 0x5b, 0x58, 0xc3, 0x35,
+  0xb5, 0xb5, 0x98, 0x61, 0x9a, 0xda, 0xd7, 0xa6, 0x1a, 0xfe, 0xfb, 0x06, 0x98, 0x18, 0x61, 0xad,
+  0xac, 0xd6, 0x35, 0x82, 0xda, 0xfe, 0x9a, 0x68, 0x16, 0x4d, 0x02, 0xc7, 0xdf, 0xf6, 0x18, 0xc6,
+  0x6b, 0x6b, 0x61, 0x99, 0xad, 0x86, 0xb5, 0xff, 0xff, 0xe6, 0x18, 0x33, 0x0d, 0x8c, 0x6d, 0x7a,
+  0xcc, 0x63, 0x58, 0x60, 0x01, 0xfd, 0xc7, 0x26, 0xf9, 0x98, 0xcc, 0xc6, 0xd7, 0xac, 0x33, 0xbf,
+  0xff, 0xf4, 0xad, 0x60, 0x66, 0x33, 0x33, 0x36, 0x00, 0x00, 0x6f, 0x35, 0x81, 0x96, 0x7f, 0xff,
+  0x06, 0x6b, 0xd6, 0x63, 0x35, 0xb5, 0x8d, 0x6b, 0x00, 0x14, 0xda, 0xea, 0xa9, 0xeb, 0xcc, 0xd9,
+  0x8f, 0x59, 0xad, 0xac, 0x01, 0xa3, 0x41, 0xa6, 0xb5, 0x9a, 0xcd, 0x66, 0x3f, 0xef, 0xe6, 0x18,
+  0xc1, 0xac, 0x34, 0xdf, 0xdf, 0xff, 0xd9, 0x60, 0xd6, 0x1a, 0xda, 0xc3, 0x18, 0x63, 0x5b, 0x06,
+  0x06, 0x0c, 0x18, 0x35, 0xb5, 0x9a, 0xdd, 0xff, 0xfe, 0x7a, 0xd6, 0x1a, 0xd8, 0x00, 0x7b, 0x67,
+  0xaf, 0x33, 0x63, 0xd7, 0xaf, 0x59, 0x80, 0x0f, 0xff, 0xef, 0xff, 0x98, 0xda, 0xf1, 0xb6, 0x66,
+  0xd8, 0xf3, 0x33, 0x19, 0x83, 0x2d, 0x69, 0x35, 0x41, 0xa5, 0x8b, 0x2c, 0x35, 0x86, 0xb3, 0x58,
+  0x6f, 0xfe, 0xff, 0xff, 0xca, 0xb6, 0xb1, 0x8c, 0x31, 0xaf, 0x58, 0xc6, 0x18, 0x63, 0x59, 0xac,
+  0x34, 0xff, 0xe0, 0x6b, 0x58, 0xd6, 0x35, 0xb5, 0x8d, 0x66, 0x5e, 0x98, 0x2e, 0x30, 0x1a, 0x68,
+  0x0b, 0x5a, 0x00, 0x2e, 0xfe, 0x99, 0xaf, 0x58, 0xcd, 0x6c, 0x36, 0xb6, 0x31, 0x8d, 0x67, 0xff,
+  0xf7, 0xfc, 0x35, 0x98, 0x66, 0x33, 0x33, 0x18, 0xcc, 0x30, 0x68, 0x00, 0xff, 0xad, 0x6d, 0xed,
+  0xab, 0x18, 0xd8, 0xcc, 0x66, 0x1a, 0xcf, 0xff, 0xfd, 0x6f, 0xfb, 0x59, 0x66, 0xb6, 0x1e, 0xb6,
+  0x63, 0x00, 0x00, 0x1e, 0xc6, 0x0d, 0x61, 0xfd, 0xff, 0x61, 0xb5, 0x99, 0x86, 0xd6, 0x60, 0xcb,
+  0x68, 0x68, 0x69, 0xd5, 0x74, 0xf6, 0x6c, 0xcf, 0x5e, 0xbc, 0x36, 0xb6, 0xb2, 0xda, 0x34, 0xd1,
+  0xa1, 0xa6, 0xb0, 0x6b, 0x60, 0xcf, 0xef, 0xf9, 0xaf, 0x58, 0xd6, 0xd6, 0xb1, 0xa6, 0xbf, 0xbf,
+  0xfe, 0xd6, 0xb0, 0xd6, 0xb6, 0xb0, 0x66, 0xb3, 0x0d, 0x6d, 0x6c, 0x0e, 0x0f, 0x7a, 0x63, 0x58,
+  0x61, 0x8d, 0x7a, 0xff, 0xbf, 0xfb, 0x4c, 0x31, 0x80, 0x0f, 0x6c, 0xf5, 0xe6, 0x6c, 0xcc, 0xcc,
+  0xd6, 0xc0, 0x1f, 0xff, 0xfe, 0x9f, 0xcc, 0x66, 0x6c, 0xcd, 0x9b, 0x63, 0xc7, 0xaf, 0x5b, 0x0c,
+  0x6b, 0x5a, 0xd2, 0x3a, 0x5c, 0x16, 0x5a, 0xc0, 0xd6, 0x30, 0x60, 0xdd, 0xff, 0xff, 0x8f, 0x8c,
+  0x31, 0xaf, 0x5a, 0xf5, 0x8c, 0x61, 0x86, 0x30, 0x61, 0x81, 0x9d, 0xff, 0x06, 0xb5, 0x9a, 0xc3,
+  0x0c, 0x30, 0xd6, 0x6b, 0x0b, 0xac, 0x23, 0x43, 0x56, 0x2d, 0x0d, 0xd8, 0x17, 0x7f, 0xc6, 0x19,
+  0x86, 0x63, 0x18, 0xcc, 0xc3, 0x35, 0x9d, 0xff, 0xff, 0xd2, 0x18, 0x66, 0xbd, 0x6c, 0x66, 0x66,
+  0xbc, 0x31, 0x83, 0x40, 0x07, 0xfd, 0x35, 0xb6, 0x75, 0x31, 0xaf, 0x0d, 0x8c, 0xd7, 0xad, 0xad,
+  0x67, 0xfd, 0xff, 0xff, 0x9f, 0x6b, 0x59, 0xac, 0xcd, 0x78, 0xd8, 0xc0, 0x00, 0x03, 0xde, 0xb5,
+  0xb5, 0xac, 0x2f, 0xff, 0xe6, 0x6b, 0x6b, 0x63, 0x19, 0x86, 0x6b, 0x03, 0x5a, 0xd6, 0xb4, 0xf2,
+  0x8a, 0x4b, 0x3c, 0x6c, 0xcd, 0x8c, 0xc3, 0x59, 0xa6, 0x9a, 0xd1, 0xa3, 0x4d, 0x30, 0x61, 0x8c,
+  0xbb, 0xff, 0x8c, 0xc1, 0x9a, 0xd6, 0x34, 0xd7, 0xff, 0x7f, 0xda, 0xd6, 0x0d, 0x61, 0x83, 0x18,
+  0x61, 0x8c, 0x01, 0x01, 0x06, 0x35, 0x86, 0x18, 0xc6, 0x7f, 0xff, 0x9f, 0xf3, 0x58, 0x66, 0xbd,
+  0x00, 0xf7, 0xaf, 0x33, 0x66, 0xcc, 0xd8, 0xcc, 0x00, 0x3f, 0xff, 0xfc, 0x6d, 0x66, 0x66, 0x7a,
+  0xf1, 0xe3, 0xcc, 0xd8, 0xf5, 0xb0, 0xc3, 0x4d, 0x69, 0x09, 0x1a, 0x2c, 0xb5, 0x96, 0x06, 0x18,
+  0x30, 0xc7, 0xff, 0xfe, 0x29, 0xac, 0xd6, 0xd6, 0x30, 0xc6, 0xb6, 0xb6, 0xb1, 0x83, 0x18, 0x35,
+  0x9a, 0xc7, 0xdf, 0xc6, 0xb5, 0x8d, 0x63, 0x06, 0x35, 0xb5, 0x83, 0x59, 0x79, 0x88, 0xd0, 0x02,
+  0xd6, 0x80, 0x2c, 0xfe, 0xfe, 0x18, 0x66, 0x31, 0x8c, 0x66, 0x63, 0x18, 0xc3, 0xff, 0xff, 0x9b,
+  0x8d, 0x66, 0xb6, 0x31, 0xb1, 0xb5, 0xeb, 0x63, 0x1a, 0xda, 0xd6, 0x00, 0x7f, 0xf6, 0x98, 0xd4,
+  0xcf, 0xcd, 0x6c, 0x66, 0x33, 0x35, 0x99, 0x63, 0xff, 0xff, 0x4e, 0xb5, 0x83, 0x31, 0x99, 0x99,
+  0x80, 0x00, 0x06, 0xf3, 0x5e, 0x98, 0x0f, 0xff, 0xe9, 0x98, 0x6d, 0x7a, 0xcc, 0xc3, 0x18, 0x35,
+  0x96, 0x0a, 0x81, 0x2d, 0x0d, 0xeb, 0xc7, 0xaf, 0x31, 0xb1, 0x8d, 0x66, 0x9a, 0xd6, 0xb4, 0xd1,
+  0xa6, 0x99, 0x66, 0xb3, 0x06, 0x7d, 0xff, 0xf7, 0xac, 0x66, 0xb1, 0xac, 0x35, 0xad, 0xff, 0xff,
+  0xa3, 0xda, 0xd6, 0x06, 0x06, 0x35, 0xb5, 0x8d, 0x6d, 0x6d, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xcc,
+  0x31, 0x9f, 0x7f, 0xff, 0x9e, 0x1a, 0xcd, 0x66, 0x60, 0x36, 0xd9, 0xb3, 0x6c, 0x78, 0xd8, 0xcc,
+  0x60, 0x17, 0xff, 0xff, 0x78, 0xcc, 0xcc, 0xd9, 0xb3, 0x67, 0xaf, 0x5e, 0x63, 0x61, 0x83, 0x5a,
+  0x63, 0xe4, 0x10, 0xb5, 0xad, 0x6b, 0x0d, 0x66, 0xb1, 0xad, 0xac, 0x7f, 0xff, 0xe2, 0x7f, 0x18,
+  0x63, 0x5b, 0x58, 0xc3, 0x1a, 0xf4, 0xcd, 0x63, 0x0d, 0x66, 0xb0, 0xd6, 0x3b, 0xfe, 0x32, 0xcd,
+  0x61, 0x86, 0x18, 0x6b, 0x35, 0xa6, 0x06, 0x40, 0xd0, 0x16, 0xb4, 0xd1, 0x60, 0x7f, 0xdf, 0xda,
+  0xf5, 0x8c, 0x63, 0x18, 0xda, 0xd8, 0xcd, 0x7a, 0xcc, 0xbd, 0xff, 0xf7, 0xff, 0xf6, 0xd6, 0xbd,
+  0x63, 0x6b, 0xd6, 0xcc, 0x6d, 0x7a, 0xf5, 0x9a, 0xda, 0xd6, 0x00, 0x7f, 0xf1, 0xac, 0x67, 0xe5,
+  0x8d, 0xad, 0x8c, 0xc6, 0x31, 0x96, 0x3f, 0xfe, 0xff, 0xfe, 0x99, 0x66, 0xb6, 0x31, 0xeb, 0x63,
+  0x00, 0x00, 0x0f, 0x7a, 0xc6, 0x03, 0x7f, 0xff, 0x9d, 0xcc, 0x63, 0x31, 0x99, 0xad, 0x86, 0x1a,
+  0xc1, 0xa1, 0x44, 0x8a, 0x7d, 0x7a, 0xf3, 0x36, 0x66, 0x66, 0xb6, 0x5b, 0x4d, 0x6b, 0x2d, 0x69,
+  0xa3, 0x4d, 0x60, 0xc6, 0xb6, 0xb3, 0xfb, 0xfe, 0x6b, 0x61, 0xaf, 0x4c, 0x1a, 0xd6, 0xff, 0xff,
+  0xcf, 0x69, 0x8b, 0xd3, 0x59, 0xac, 0x30, 0xc6, 0xb6, 0xb0, 0x00, 0x00, 0x00, 0x36, 0x6b, 0x6b,
+  0x35, 0xeb, 0x1f, 0xff, 0xe7, 0xff, 0x18, 0x33, 0x18, 0x1e, 0x67, 0x8f, 0x33, 0x66, 0xcc, 0x6c,
+  0x30, 0x0f, 0xbf, 0xff, 0xfb, 0x33, 0x5e, 0xb6, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0x6c, 0x66, 0xb1,
+  0xa6, 0x98, 0xe8, 0xf4, 0xb2, 0xd3, 0x5a, 0xc1, 0x86, 0x1a, 0xda, 0xc7, 0xff, 0xf7, 0xff, 0xf1,
+  0x8d, 0x6d, 0x61, 0x8d, 0x6d, 0x63, 0x0c, 0x30, 0xd6, 0xd6, 0x1a, 0xcd, 0x61, 0xbf, 0xbf, 0xb5,
+  0x86, 0xb1, 0x97, 0xac, 0x6b, 0x35, 0x8d, 0x66, 0x36, 0x7b, 0x68, 0x05, 0x96, 0x8d, 0x2c, 0x0f,
+  0xfe, 0xf9, 0x86, 0x33, 0x0c, 0xd7, 0xad, 0x8c, 0x6c, 0x31, 0x93, 0xff, 0xff, 0x6b, 0x6b, 0x0c,
+  0xc6, 0x66, 0x66, 0x63, 0x33, 0x59, 0xac, 0x00, 0xbf, 0xe6, 0xb0, 0x65, 0x63, 0x35, 0xeb, 0x31,
+  0x99, 0xaf, 0x58, 0xcb, 0x0f, 0xff, 0xfd, 0x2b, 0x5a, 0xcd, 0x66, 0x63, 0x63, 0x30, 0x00, 0x00,
+  0xf6, 0x66, 0xb0, 0xd6, 0xff, 0xff, 0x3b, 0x9a, 0xf5, 0x98, 0xcc, 0xc6, 0x61, 0x8c, 0xb6, 0x9a,
+  0xd6, 0xa9, 0x50, 0x0e, 0x36, 0x66, 0x7a, 0xf1, 0x99, 0x8c, 0xbd, 0x35, 0x96, 0x5a, 0xd6, 0x9a,
+  0x69, 0x81, 0x8d, 0x6d, 0x67, 0xf7, 0xfc, 0x63, 0x18, 0x60, 0x35, 0xbb, 0xff, 0xff, 0x34, 0xd6,
+  0xb0, 0xd6, 0x1a, 0xda, 0xd7, 0xad, 0x7a, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x18, 0xd7, 0xac,
+  0xdf, 0xfd, 0xff, 0xf6, 0x98, 0x63, 0x60, 0x6c, 0xcd, 0xb6, 0x3c, 0xcd, 0x99, 0x8c, 0xc0, 0x1f,
+  0xf7, 0xff, 0xff, 0x56, 0x33, 0x1e, 0xbc, 0x6d, 0x9b, 0x36, 0x6c, 0x6c, 0x66, 0xb0, 0xd1, 0xa3,
+  0x63, 0x91, 0x6b, 0x4d, 0x35, 0x8d, 0x66, 0xb1, 0x86, 0x1f, 0xf7, 0xff, 0xfd, 0xce, 0xb1, 0xac,
+  0xd6, 0x6b, 0x35, 0x9a, 0xcd, 0x66, 0xb3, 0x59, 0xac, 0x6b, 0x35, 0x86, 0x0d, 0x77, 0xf5, 0x86,
+  0x0d, 0x7a, 0xd6, 0xd6, 0x6b, 0x06, 0x66, 0x69, 0xc0, 0x01, 0x69, 0xa0, 0x03, 0xff, 0xfa, 0x31,
+  0x86, 0x63, 0x0f, 0x59, 0x8d, 0xaf, 0x59, 0x86, 0x3f, 0xff, 0xf5, 0xed, 0x63, 0x5e, 0xb6, 0x36,
+  0xbc, 0x66, 0x66, 0xbd, 0x63, 0x00, 0x1d, 0xfc, 0xd6, 0x1a, 0xc5, 0xc2, 0xb1, 0x8c, 0xc6, 0x33,
+  0x0d, 0x60, 0xff, 0xfe, 0xff, 0xfe, 0xd6, 0x5b, 0x5b, 0x5b, 0x19, 0x8f, 0x58, 0x00, 0x00, 0xde,
+  0xc3, 0x06, 0x5f, 0xff, 0xd1, 0x8c, 0x6d, 0x7a, 0xd8, 0xcc, 0x33, 0x2f, 0x4d, 0x61, 0x6a, 0x73,
+  0xb3, 0x43, 0xd7, 0x99, 0x9b, 0x31, 0x8c, 0x19, 0x65, 0x8b, 0x5a, 0xd3, 0x4d, 0x65, 0xb5, 0x8c,
+  0x31, 0xff, 0xdf, 0x19, 0xad, 0xac, 0xd6, 0x1a, 0xd6, 0xfe, 0xff, 0xfe, 0x1a, 0xc0, 0xc1, 0xac,
+  0xcb, 0xd6, 0xbd, 0x60, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x6b, 0x31, 0x8d, 0x7f, 0xff, 0x9f, 0x0c,
+  0x31, 0x9b, 0x1b, 0x66, 0x6d, 0xb3, 0x36, 0xc7, 0xaf, 0x5e, 0xb3, 0x40, 0x3f, 0xff, 0xbf, 0xfe,
+  0xb6, 0xbd, 0x6c, 0xcd, 0x9b, 0x36, 0x6c, 0xcd, 0x8d, 0xad, 0xac, 0x34, 0x68, 0xcc, 0xd8, 0xb5,
+  0xa6, 0x8c, 0xb3, 0x58, 0xc3, 0x0c, 0x2f, 0xff, 0xfb, 0xa9, 0x8d, 0x6d, 0x6b, 0x6b, 0x1a, 0xda,
+  0xc3, 0x0c, 0x30, 0xc1, 0x86, 0xb6, 0xb5, 0xb5, 0x95, 0xff, 0xd9, 0xad, 0x6d, 0x61, 0x8c, 0xbd,
+  0x6b, 0x68, 0xd2, 0xdb, 0x60, 0x02, 0xc9, 0xa0, 0x03, 0xff, 0xff, 0x2f, 0x18, 0x63, 0x18, 0xc6,
+  0x63, 0x33, 0x18, 0xc6, 0xb7, 0xff, 0xf7, 0xfc, 0xc3, 0x19, 0x8d, 0x98, 0xd8, 0xcc, 0x63, 0x2f,
+  0x40, 0x7f, 0x56, 0x2f, 0x4c, 0xc1, 0xbd, 0xc6, 0x1b, 0x5b, 0x0c, 0xc3, 0x58, 0x2f, 0xff, 0xfd,
+  0x1b, 0x58, 0x63, 0x19, 0x8d, 0x8c, 0x00, 0x00, 0x6f, 0xd6, 0x30, 0xd6, 0x7f, 0xff, 0x9d, 0x63,
+  0x5e, 0xb6, 0xbd, 0x7a, 0xd8, 0xcc, 0x63, 0x5e, 0x98, 0x0d, 0x55, 0x1b, 0x17, 0xb6, 0x3d, 0x79,
+  0x8f, 0x5b, 0x0c, 0x6b, 0x58, 0x58, 0xb5, 0xad, 0x35, 0xad, 0x66, 0xb1, 0x86, 0x3f, 0xfe, 0xe3,
+  0x35, 0xb5, 0xb5, 0xac, 0xd6, 0xb5, 0xff, 0x7f, 0xf1, 0xad, 0x63, 0x58, 0x30, 0x61, 0x86, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xb6, 0xb3, 0x18, 0xcf, 0xff, 0xf3, 0xfa, 0x6b, 0x6b, 0x63, 0x36, 0x3c,
+  0xcf, 0x1e, 0x67, 0xaf, 0x33, 0x33, 0x1a, 0x01, 0xff, 0xff, 0xeb, 0xff, 0xd8, 0xcc, 0x7a, 0xf1,
+  0xe3, 0xc7, 0x8f, 0x5e, 0x63, 0x31, 0x80, 0xd0, 0x60, 0x66, 0x5a, 0xd1, 0xa6, 0xb0, 0xd6, 0xd6,
+  0x31, 0xac, 0xd7, 0xff, 0xfd, 0xd7, 0x58, 0xd6, 0x6b, 0x1a, 0xcd, 0x63, 0x06, 0x18, 0x61, 0xac,
+  0xd6, 0x6b, 0x18, 0x35, 0x8e, 0xff, 0x8c, 0xbd, 0x6b, 0x6b, 0x35, 0x8d, 0x66, 0x9b, 0x5c, 0x30,
+  0x58, 0x0b, 0x5a, 0x68, 0x07, 0x7f, 0xff, 0x6b, 0xd6, 0xbd, 0x66, 0xb6, 0x19, 0x8c, 0xc6, 0xd6,
+  0xc6, 0xb6, 0xb7, 0xff, 0x7f, 0xf5, 0x86, 0x6b, 0xc6, 0x3d, 0x7a, 0xd9, 0x8c, 0xc6, 0xb1, 0xa0,
+  0xff, 0x96, 0x06, 0xb2, 0xf6, 0xe7, 0x30, 0xc6, 0x61, 0x98, 0x30, 0xb3, 0xff, 0xef, 0xff, 0xfc,
+  0xbd, 0x61, 0x86, 0xd6, 0xc6, 0x66, 0x30, 0x00, 0x0f, 0x6d, 0x7a, 0xc3, 0x2b, 0xff, 0xfa, 0xc6,
+  0x63, 0x1e, 0xb6, 0x33, 0x19, 0xaf, 0x4c, 0x35, 0xad, 0x56, 0x99, 0x15, 0xb6, 0x66, 0xcc, 0xcc,
+  0xc6, 0x0c, 0xb0, 0x2c, 0xb5, 0xad, 0x69, 0x96, 0xd3, 0x35, 0x98, 0x7f, 0xff, 0xe0, 0x8c, 0xd6,
+  0xd6, 0xd6, 0xb6, 0x9a, 0xcf, 0xff, 0xef, 0xe1, 0xac, 0x18, 0x18, 0x6b, 0x6b, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xe6, 0x31, 0x8c, 0xff, 0xfe, 0xff, 0x9a, 0xc6, 0x33, 0x63, 0x67, 0xaf, 0x36,
+  0x6d, 0x9b, 0x33, 0x33, 0x18, 0x03, 0xff, 0xff, 0xcf, 0xfb, 0x19, 0x8f, 0x5e, 0x3c, 0x78, 0xf1,
+  0xe3, 0x63, 0x6b, 0x6b, 0x06, 0x81, 0x71, 0x89, 0x69, 0xa0, 0xd6, 0x1a, 0xda, 0xc6, 0x18, 0x6f,
+  0xff, 0xfb, 0xcf, 0xff, 0xed, 0x6d, 0x6b, 0xd3, 0x0c, 0x18, 0x60, 0xc3, 0x0c, 0x18, 0xd6, 0x6b,
+  0x35, 0x8d, 0x60, 0xbf, 0xf9, 0x83, 0x18, 0x30, 0xc0, 0xe2, 0xe9, 0x96, 0x00, 0xb2, 0xd3, 0x43,
+  0x47, 0xfd, 0xff, 0x6b, 0x6b, 0x18, 0xd7, 0xac, 0xc6, 0x63, 0x31, 0xb5, 0xb5, 0x8d, 0xfd, 0xff,
+  0xfd, 0x66, 0xb3, 0x31, 0x9b, 0x5e, 0x33, 0x31, 0x8c, 0x18, 0x77, 0xc0, 0x35, 0x85, 0xcd, 0xb1,
+  0x8d, 0x7a, 0xcc, 0x6b, 0xd6, 0x19, 0x61, 0x7f, 0xff, 0xe8, 0xcb, 0x35, 0x9a, 0xf5, 0xb5, 0xeb,
+  0x63, 0x1b, 0x00, 0x03, 0xf3, 0x5e, 0xb1, 0xac, 0xff, 0xbf, 0xeb, 0x18, 0xcc, 0xc6, 0xc6, 0x66,
+  0x30, 0xc6, 0xb2, 0xc5, 0x81, 0x71, 0x3e, 0x66, 0xc7, 0x8c, 0xcc, 0xd6, 0x6b, 0x0b, 0x02, 0xcb,
+  0x5a, 0x6b, 0x03, 0x0c, 0x6b, 0xdd, 0xff, 0xff, 0x81, 0x8c, 0x63, 0x1a, 0xcd, 0x35, 0x9f, 0xff,
+  0xf9, 0x9c, 0x6b, 0x2f, 0x4c, 0x19, 0x7a, 0xd6, 0xd6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xda,
+  0xcc, 0x66, 0xb7, 0xff, 0x7f, 0xf4, 0xc3, 0x19, 0x9b, 0x33, 0x6c, 0xd9, 0xb6, 0x67, 0xaf, 0x19,
+  0x8c, 0x01, 0xff, 0xff, 0xe3, 0xd8, 0xcc, 0x7a, 0xf1, 0xe3, 0xcc, 0xd9, 0xb0, 0x66, 0x30, 0x0d,
+  0x0b, 0x4c, 0x2c, 0x9a, 0x06, 0xb5, 0xb5, 0x8d, 0x6d, 0x66, 0xb3, 0x5f, 0x7f, 0xff, 0xda, 0xb1,
+  0xac, 0xd6, 0xb6, 0xb0, 0xd6, 0x6b, 0x1a, 0xcd, 0x63, 0x06, 0x35, 0x99, 0x7a, 0xc3, 0x58, 0x0f,
+  0xff, 0xb1, 0xac, 0xd6, 0x30, 0xd6, 0x67, 0x57, 0x8c, 0x58, 0x02, 0xcb, 0x4d, 0x1a, 0x3f, 0xff,
+  0xab, 0x5b, 0x59, 0x86, 0x31, 0x9a, 0xf0, 0xd8, 0xc6, 0x30, 0x7f, 0xff, 0xe1, 0xe1, 0x98, 0xc6,
+  0xcc, 0x6c, 0x6d, 0x7a, 0xcd, 0x6d, 0x31, 0xfd, 0x68, 0x35, 0xad, 0xa5, 0xad, 0x96, 0xb3, 0x5b,
+  0x5b, 0x59, 0x86, 0x1a, 0xcb, 0x2f, 0xbf, 0xff, 0xf3, 0x30, 0x61, 0x9a, 0xf5, 0xeb, 0x33, 0x0d,
+  0x80, 0x07, 0xb1, 0x9a, 0xda, 0xc7, 0xff, 0xf7, 0xda, 0xcc, 0x66, 0x63, 0x63, 0x33, 0x30, 0xc6,
+  0xb0, 0xd2, 0xd0, 0xa8, 0x8f, 0x63, 0x66, 0xc1, 0x98, 0xc6, 0xb0, 0x02, 0xc5, 0xad, 0x32, 0xc1,
+  0x8d, 0x7a, 0x6d, 0xfd, 0xff, 0xf3, 0x6b, 0x61, 0x86, 0x1a, 0xd6, 0xbf, 0xff, 0xf2, 0xb8, 0x6b,
+  0x1a, 0xc3, 0x59, 0xac, 0x30, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x07, 0xed, 0x66, 0x31, 0x9f, 0xf7,
+  0xff, 0xd3, 0x0c, 0xd7, 0x8c, 0xf5, 0xe6, 0x79, 0x9b, 0x66, 0xcc, 0xcc, 0xc6, 0x01, 0x7f, 0xff,
+  0xf7, 0xd8, 0xcc, 0xcc, 0xd9, 0xb3, 0xd7, 0x99, 0x80, 0xd8, 0xc0, 0x34, 0x2c, 0x2f, 0xb5, 0xa3,
+  0x41, 0xac, 0x31, 0xad, 0xac, 0xd6, 0x35, 0xff, 0xff, 0x6e, 0x0c, 0x1a, 0xda, 0x63, 0x58, 0x60,
+  0xc3, 0x06, 0x35, 0xb5, 0x86, 0x6b, 0x0c, 0x5e, 0x86, 0xff, 0xf8, 0x63, 0x06, 0x35, 0x87, 0xa7,
+  0xdd, 0x60, 0x0b, 0x16, 0x5a, 0x69, 0xab, 0xff, 0xff, 0x6c, 0xc1, 0x8c, 0x6b, 0xd6, 0x6b, 0xd6,
+  0xc6, 0x63, 0x30, 0xc3, 0xff, 0xfe, 0xfc, 0xd6, 0xd6, 0xc6, 0x66, 0x66, 0x3d, 0x66, 0x30, 0xd6,
+  0xbf, 0xfb, 0x46, 0x9a, 0xc3, 0x5a, 0xca, 0xbf, 0x0d, 0x7a, 0xc6, 0x19, 0xac, 0x69, 0x96, 0xb7,
+  0xff, 0xfe, 0x9f, 0xfc, 0x18, 0x63, 0x31, 0x98, 0xc6, 0x36, 0x01, 0xe6, 0x33, 0x5e, 0xb5, 0x9f,
+  0xff, 0xe7, 0x66, 0x19, 0x99, 0x8d, 0x8d, 0x8c, 0xc6, 0x32, 0xf4, 0xd6, 0x5b, 0x93, 0x90, 0x6c,
+  0xcc, 0x01, 0xb1, 0x9a, 0xc5, 0xe8, 0x2c, 0x59, 0x6b, 0x5a, 0xc3, 0x06, 0x6b, 0x6f, 0xff, 0xbf,
+  0xb1, 0x8c, 0x63, 0x2d, 0xad, 0x6b, 0x7f, 0xff, 0xe3, 0x8d, 0x61, 0xac, 0x6b, 0x1a, 0xcd, 0x61,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xde, 0x61, 0xb5, 0xb5, 0xbf, 0xbf, 0xff, 0xad, 0x66, 0x1b, 0x5e,
+  0x3d, 0x79, 0xb3, 0x66, 0xd9, 0xb3, 0x36, 0xbd, 0x6d, 0x00, 0xfb, 0xff, 0xff, 0xb6, 0xc6, 0x66,
+  0x6c, 0xcd, 0x9b, 0x66, 0x00, 0xd8, 0xd6, 0x34, 0x05, 0x65, 0xcb, 0x5a, 0x01, 0xac, 0x30, 0xc6,
+  0xbd, 0x31, 0xaf, 0xff, 0xfb, 0xbf, 0xff, 0xb0, 0xd6, 0x6b, 0x06, 0x0c, 0x1a, 0xda, 0xc1, 0x8c,
+  0x18, 0xc3, 0x5e, 0xb5, 0xb5, 0x96, 0xd0, 0xd7, 0xfc, 0xb3, 0x59, 0xac, 0xd6, 0x1f, 0xa0, 0xac,
+  0x2c, 0x00, 0xb2, 0xd6, 0x9a, 0xfe, 0xff, 0xe3, 0x59, 0xac, 0xd7, 0xa6, 0xd6, 0x66, 0xbd, 0x6c,
+  0x66, 0x30, 0xd6, 0xff, 0xff, 0xbb, 0xed, 0x66, 0x31, 0xb1, 0x9b, 0x19, 0x8c, 0xc1, 0x9f, 0xdf,
+  0xff, 0x5a, 0xd6, 0xb1, 0x7a, 0x62, 0xbe, 0xb6, 0xda, 0xc3, 0x35, 0x98, 0x30, 0xd3, 0x5a, 0x6f,
+  0xff, 0xfc, 0xf8, 0xd6, 0x33, 0x5b, 0x18, 0xc6, 0x63, 0x19, 0x99, 0x8d, 0xaf, 0x58, 0xc7, 0xf7,
+  0xff, 0xc3, 0x1b, 0x5b, 0x31, 0xb3, 0x1b, 0x19, 0x8d, 0x6d, 0x6b, 0x0b, 0xb2, 0x31, 0xd6, 0xd7,
+  0x98, 0x03, 0xcc, 0x35, 0x80, 0xdd, 0x82, 0xd6, 0xb5, 0x8b, 0xd3, 0x35, 0x98, 0x7f, 0xff, 0x73,
+  0x31, 0x9a, 0xda, 0xc1, 0xad, 0x6f, 0xff, 0xfc, 0x50, 0xc1, 0x83, 0x5b, 0x4c, 0x6b, 0x35, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xf6, 0x61, 0xb5, 0x99, 0xfd, 0xff, 0xfe, 0x7f, 0x96, 0xd6, 0x63, 0x66,
+  0x66, 0xd9, 0xb6, 0x6c, 0xcf, 0x5e, 0x33, 0x18, 0x07, 0xf7, 0xff, 0xff, 0x5b, 0x31, 0x99, 0xb3,
+  0x36, 0xcc, 0xdb, 0x00, 0xd8, 0xd6, 0xd0, 0x68, 0xac, 0xb8, 0x9a, 0x00, 0xd6, 0x6b, 0x18, 0xd6,
+  0xd6, 0x0f, 0xef, 0xff, 0xfb, 0x6b, 0x35, 0x83, 0x06, 0xb1, 0xac, 0x30, 0x60, 0x00, 0x36, 0x18,
+  0xc1, 0xac, 0x0d, 0x35, 0xf7, 0xdb, 0x59, 0xac, 0x6b, 0x21, 0x21, 0xd8, 0x00, 0x16, 0x2d, 0x65,
+  0xaf, 0xff, 0xee, 0x35, 0x8c, 0x19, 0x86, 0x33, 0x19, 0x98, 0xc6, 0xbd, 0x37, 0xff, 0xf7, 0xd8,
+  0x66, 0x31, 0xeb, 0x66, 0x36, 0xbd, 0x6d, 0x66, 0xb7, 0x7f, 0xff, 0xfa, 0x0b, 0x2c, 0x0c, 0x15,
+  0x95, 0x46, 0xb3, 0x59, 0xac, 0xd6, 0x6b, 0x0d, 0x34, 0x3b, 0xff, 0xff, 0x2d, 0xac, 0x31, 0x8c,
+  0x66, 0x31, 0x8c, 0xcc, 0x6c, 0x66, 0x61, 0x8f, 0xff, 0xef, 0xec, 0x66, 0xbd, 0x6c, 0xc6, 0xcc,
+  0xcc, 0xc6, 0x6b, 0x6b, 0x03, 0x5f, 0x90, 0x0d, 0x66, 0x30, 0x03, 0x6c, 0x6b, 0x00, 0xd5, 0x85,
+  0xac, 0xb5, 0x86, 0xb1, 0x8c, 0x5f, 0xff, 0xf7, 0xa6, 0x63, 0x35, 0x98, 0x1a, 0xd3, 0xff, 0xff,
+  0x08, 0xd6, 0x0c, 0x6b, 0x0d, 0x66, 0xb1, 0xac, 0xd0, 0x00, 0x00, 0x00, 0x01, 0xe6, 0x6b, 0x63,
+  0x5e, 0xb7, 0xfd, 0xff, 0xf2, 0xda, 0xc6, 0x36, 0x66, 0xcd, 0x9b, 0x3c, 0x78, 0xd9, 0xb5, 0xeb,
+  0x30, 0x0f, 0xfe, 0xff, 0xff, 0xe9, 0xc3, 0x6b, 0xc6, 0xcc, 0xf5, 0xe6, 0xcd, 0x80, 0x6c, 0xd6,
+  0x1a, 0x02, 0xc2, 0xf5, 0xa0, 0x06, 0xb5, 0xb5, 0x8c, 0x30, 0xc1, 0xbf, 0xff, 0xee, 0x81, 0x83,
+  0x58, 0xd6, 0x0c, 0xbd, 0x31, 0xac, 0x00, 0x06, 0xc6, 0x6b, 0x35, 0xac, 0x1a, 0x69, 0xbe, 0xf9,
+  0x8d, 0x6d, 0x62, 0x26, 0x33, 0x58, 0x00, 0xd5, 0x82, 0xcb, 0x77, 0xff, 0xff, 0x60, 0x6b, 0x35,
+  0x9a, 0xda, 0xcc, 0x36, 0xbd, 0x6d, 0x7a, 0xda, 0xf4, 0xcd, 0x7f, 0xf7, 0xd6, 0xd6, 0xd7, 0xac,
+  0xd8, 0xcc, 0xc6, 0xd7, 0xac, 0x33, 0xff, 0xff, 0xc6, 0xd1, 0x60, 0xd6, 0xb6, 0x95, 0x55, 0x0d,
+  0x63, 0x59, 0xac, 0xd6, 0x35, 0x81, 0xa1, 0x7d, 0xff, 0xff, 0x90, 0xc1, 0x86, 0xd6, 0xd6, 0x66,
+  0xb6, 0x31, 0xb1, 0x9b, 0x5e, 0xbd, 0x66, 0x3b, 0xff, 0xfc, 0xf1, 0x9a, 0xda, 0xf5, 0xb3, 0x33,
+  0x33, 0x33, 0x31, 0x9a, 0xc6, 0xb5, 0xb0, 0xc7, 0x86, 0x33, 0x30, 0x01, 0xb6, 0x35, 0x80, 0xd0,
+  0xb1, 0x6b, 0x2c, 0x0c, 0x6b, 0x6b, 0x3f, 0xbf, 0xf8, 0xcc, 0x63, 0x1a, 0xcd, 0x35, 0xaf, 0xff,
+  0xfc, 0x01, 0x83, 0x06, 0x18, 0x18, 0x61, 0xac, 0x00, 0x00, 0x00, 0x01, 0xe6, 0xb6, 0x18, 0xcd,
+  0x7f, 0xdf, 0xfc, 0x35, 0x9a, 0xf5, 0xeb, 0x6c, 0x78, 0xf3, 0x3c, 0x7a, 0xf3, 0x33, 0x30, 0x01,
+  0xff, 0xfd, 0xff, 0xfd, 0x8c, 0x6c, 0x6c, 0xd9, 0xb3, 0x66, 0xc0, 0x3c, 0x6b, 0x1a, 0x1a, 0x2d,
+  0x30, 0x5a, 0x00, 0x69, 0x8c, 0x18, 0xc3, 0x58, 0xdf, 0xff, 0xf7, 0xff, 0xfd, 0x66, 0xb0, 0xd6,
+  0x0c, 0x0d, 0x66, 0xb0, 0xc0, 0x00, 0x1b, 0xd6, 0x60, 0xd6, 0x03, 0x4d, 0x37, 0x7c, 0x31, 0xac,
+  0x8e, 0x92, 0xb2, 0xcd, 0x06, 0x80, 0x2c, 0x7f, 0xf7, 0xfd, 0x66, 0xb5, 0xb5, 0x8d, 0x7a, 0xc6,
+  0x31, 0x99, 0x8c, 0xd6, 0xd6, 0x3f, 0xef, 0xe3, 0x0d, 0xaf, 0x5b, 0x1b, 0x19, 0x98, 0x66, 0xb7,
+  0xff, 0xf7, 0xd6, 0x81, 0xa6, 0x5b, 0x4d, 0x51, 0x4d, 0xac, 0x35, 0xb5, 0xad, 0xac, 0x35, 0x80,
+  0xb2, 0xdf, 0xfd, 0xff, 0xfd, 0x83, 0x0d, 0xac, 0x66, 0x19, 0x9a, 0xf1, 0x99, 0x99, 0x98, 0x67,
+  0xff, 0xdf, 0xf6, 0xb6, 0xb6, 0x1e, 0xb6, 0x66, 0xc6, 0x6c, 0x6d, 0x66, 0x19, 0x63, 0x20, 0x70,
+  0x5b, 0x6b, 0xc0, 0x03, 0x6c, 0x6b, 0x06, 0x80, 0x59, 0x6b, 0x2c, 0x6b, 0x1a, 0xf5, 0x8f, 0xff,
+  0xee, 0x33, 0x18, 0xd7, 0xac, 0x1a, 0xd6, 0xff, 0xff, 0xbe, 0x18, 0x6b, 0x6b, 0x06, 0x1a, 0xcd,
+  0x61, 0x80, 0x00, 0x00, 0x00, 0x3d, 0x66, 0xb6, 0xb6, 0xb6, 0xb6, 0xbf, 0xfb, 0xfe, 0x1a, 0xda,
+  0xd8, 0xcc, 0xf5, 0xe6, 0x6d, 0x99, 0xe3, 0x66, 0x63, 0x00, 0x3f, 0xff, 0xfd, 0x7f, 0xe1, 0x98,
+  0xd9, 0x9b, 0x36, 0xc7, 0x98, 0x0f, 0x5b, 0x58, 0x1a, 0x05, 0xe6, 0x4b, 0x40, 0x03, 0x06, 0x18,
+  0xd6, 0x6b, 0x0e, 0xff, 0xff, 0xbc, 0xc1, 0x83, 0x58, 0x6b, 0x06, 0x06, 0x18, 0x00, 0x01, 0xf8,
+  0x60, 0xd6, 0x06, 0x9a, 0x6b, 0x5f, 0x58, 0x62, 0x52, 0x5f, 0x58, 0x34, 0x69, 0xa0, 0x03, 0xfb,
+  0xeb, 0x1a, 0xc3, 0x0c, 0x6b, 0x61, 0x99, 0xaf, 0x5e, 0xb1, 0x9a, 0xcf, 0xfb, 0xf9, 0xaf, 0x59,
+  0x8c, 0xcc, 0xcc, 0x66, 0x30, 0xdf, 0xf7, 0xff, 0x2d, 0x69, 0xa6, 0x59, 0xad, 0x6a, 0x7a, 0x56,
+  0x1a, 0xc3, 0x06, 0x0d, 0x6b, 0x0b, 0x5a, 0x7f, 0xf7, 0xff, 0x0d, 0x66, 0x18, 0xc6, 0x1b, 0x18,
+  0xf5, 0xb3, 0x33, 0x1b, 0x5a, 0xff, 0xff, 0x3e, 0x60, 0xd8, 0xcc, 0xcc, 0xcf, 0x5b, 0x33, 0x19,
+  0x86, 0x03, 0x34, 0x68, 0x53, 0xd6, 0xc0, 0x03, 0x7a, 0xda, 0xc0, 0x0d, 0xd8, 0x2d, 0x65, 0x86,
+  0xb1, 0x86, 0x3f, 0xff, 0xee, 0xb5, 0xeb, 0xd6, 0x63, 0x0c, 0x1a, 0xd6, 0xff, 0xff, 0xbb, 0xd3,
+  0x1a, 0xcd, 0x63, 0x03, 0x0d, 0x66, 0xb0, 0xc0, 0x00, 0x00, 0x18, 0x30, 0xc6, 0xbd, 0x66, 0x1f,
+  0xff, 0xe8, 0xb4, 0xc1, 0x98, 0xd8, 0xf5, 0xe6, 0x7a, 0xf3, 0x66, 0x7a, 0xd9, 0x8c, 0x00, 0xff,
+  0xff, 0xf4, 0xff, 0xb3, 0x18, 0xf5, 0xe3, 0x6c, 0xcd, 0xb3, 0x36, 0x33, 0x18, 0x1a, 0x34, 0x64,
+  0x69, 0x91, 0xab, 0x03, 0x58, 0x6b, 0xd3, 0x35, 0x86, 0x59, 0xff, 0xff, 0x85, 0xfc, 0x1a, 0xc6,
+  0xb0, 0x30, 0x35, 0x9a, 0xc0, 0x00, 0x00, 0xfc, 0x6b, 0x35, 0xac, 0x0d, 0x34, 0xd3, 0x4f, 0x8d,
+  0x69, 0xa9, 0xdd, 0x61, 0xa6, 0x9a, 0xd3, 0x46, 0x83, 0xff, 0xeb, 0x0c, 0xb6, 0xb1, 0xad, 0xad,
+  0xac, 0xc6, 0x63, 0x30, 0xc6, 0xbf, 0xbe, 0xb3, 0x0c, 0xc6, 0xc6, 0x66, 0x31, 0x8d, 0xf7, 0xff,
+  0xd1, 0x65, 0xac, 0xb1, 0xac, 0x29, 0x69, 0x2c, 0x6b, 0x06, 0xb3, 0x58, 0x1a, 0xd6, 0xb5, 0xa2,
+  0xfe, 0xff, 0xf9, 0xac, 0x31, 0x86, 0x6b, 0x61, 0xb1, 0xb3, 0x1b, 0x33, 0x19, 0xff, 0xfd, 0xfc,
+  0xc3, 0x19, 0x99, 0x9b, 0x33, 0x33, 0x36, 0xb6, 0x18, 0x69, 0xb4, 0x86, 0x04, 0xdb, 0x00, 0x07,
+  0x98, 0xcb, 0x34, 0x00, 0xb2, 0xcb, 0x06, 0xb3, 0x5b, 0x59, 0xfd, 0xff, 0xf3, 0x33, 0x5e, 0xb3,
+  0x0c, 0x1a, 0x6b, 0xff, 0xfe, 0xe6, 0xb5, 0xe9, 0x9a, 0xc6, 0xb3, 0x58, 0x30, 0xd6, 0x6b, 0x00,
+  0x40, 0x40, 0xd6, 0x35, 0x8c, 0x31, 0x9a, 0xf7, 0x7f, 0xff, 0xa2, 0xeb, 0x06, 0x33, 0x33, 0x33,
+  0x6c, 0xd9, 0x9e, 0xbc, 0x7a, 0xd8, 0xd0, 0x07, 0xff, 0xff, 0x97, 0x18, 0xcc, 0xd8, 0xf1, 0xb6,
+  0x6c, 0xd8, 0xd8, 0xcd, 0x63, 0x4d, 0x03, 0x43, 0x75, 0xa0, 0x01, 0xac, 0x60, 0xc6, 0xb1, 0xad,
+  0x6f, 0xef, 0xff, 0xfc, 0x0c, 0x35, 0x83, 0x01, 0x81, 0xac, 0xd6, 0xbd, 0x00, 0x00, 0x37, 0x8c,
+  0x1a, 0xc0, 0x1a, 0x6b, 0x5a, 0xd5, 0xd9, 0x3f, 0x47, 0x60, 0xd6, 0xb5, 0xad, 0x6b, 0x58, 0x0f,
+  0xbf, 0xec, 0x69, 0x8d, 0x66, 0xb3, 0x5b, 0x5b, 0x0c, 0xcc, 0x36, 0xb0, 0xfe, 0xf8, 0x63, 0x31,
+  0x98, 0xda, 0xf0, 0xcc, 0x37, 0xff, 0xff, 0x0e, 0x80, 0xb0, 0x6b, 0x58, 0xd4, 0x94, 0x61, 0xac,
+  0x1a, 0xc6, 0xb5, 0x9a, 0x34, 0xd0, 0x4e, 0xff, 0xff, 0xc0, 0x6b, 0x6b, 0x5e, 0xb1, 0x86, 0x63,
+  0x6b, 0xc6, 0x6c, 0xc6, 0xc6, 0xef, 0xff, 0xf4, 0x06, 0xb1, 0x8d, 0xaf, 0x5e, 0x36, 0x66, 0xc6,
+  0xcc, 0x63, 0x0c, 0xb3, 0x5c, 0x58, 0x4a, 0xf5, 0xb0, 0x03, 0x66, 0x6b, 0x58, 0xd0, 0x05, 0x96,
+  0x58, 0x30, 0x63, 0x1f, 0xff, 0xf7, 0x3d, 0xaf, 0x5b, 0x0c, 0xc3, 0x01, 0xad, 0xff, 0xfd, 0xfc,
+  0xc6, 0xb6, 0xb0, 0xc3, 0x03, 0x0d, 0x63, 0x58, 0x04, 0x84, 0xdb, 0x5a, 0xc6, 0xb0, 0xc6, 0x31,
+  0xaf, 0xbf, 0xf8, 0x0c, 0x63, 0x33, 0x36, 0x6c, 0xcf, 0x5e, 0x66, 0xc6, 0xc3, 0x00, 0x7f, 0xff,
+  0xf8, 0xc6, 0x63, 0x36, 0x66, 0xcf, 0x5e, 0x66, 0xc7, 0xad, 0x86, 0x1a, 0x68, 0xc6, 0xe7, 0x44,
+  0xd1, 0x60, 0x6b, 0x1a, 0xda, 0x66, 0xb5, 0x9a, 0xd6, 0xff, 0xff, 0xc8, 0xfe, 0xc3, 0x58, 0x6b,
+  0x06, 0xb0, 0xd6, 0x0c, 0x00, 0x00, 0x1f, 0x86, 0x0d, 0x60, 0x1a, 0x69, 0xad, 0x6b, 0x3a, 0x96,
+  0xa6, 0xc6, 0x9a, 0xcb, 0x2c, 0x40, 0x0f, 0xfe, 0xec, 0xd6, 0xb1, 0x83, 0x1a, 0xf5, 0x9a, 0xf5,
+  0xb0, 0xda, 0xcd, 0x67, 0xf7, 0xc6, 0x31, 0x98, 0xcc, 0xc6, 0xd6, 0x63, 0x7f, 0xff, 0x75, 0xa6,
+  0x80, 0x6b, 0x03, 0x52, 0x51, 0x6d, 0x35, 0x83, 0x58, 0x32, 0xc0, 0x69, 0x65, 0xa3, 0xff, 0xfe,
+  0xff, 0x59, 0xac, 0xd6, 0x6b, 0x6b, 0x6b, 0xd6, 0xcc, 0xcd, 0x8d, 0x98, 0xdf, 0xff, 0xe8, 0x9f,
+  0x35, 0x8c, 0xc6, 0x6c, 0x7a, 0xf1, 0xb3, 0x33, 0x31, 0x8d, 0x60, 0xdc, 0x15, 0x11, 0x33, 0x00,
+  0x3c, 0xc1, 0x80, 0x00, 0xb2, 0xcb, 0x0d, 0x63, 0x0c, 0xef, 0xff, 0xfb, 0x73, 0x31, 0x8c, 0xc1,
+  0x83, 0x4d, 0xff, 0xdf, 0xfd, 0x86, 0x18, 0x61, 0x97, 0xa6, 0x1a, 0xc3, 0x00, 0x38, 0x38, 0x32,
+  0xda, 0x61, 0x86, 0x6b, 0x67, 0xff, 0xf7, 0x0d, 0x61, 0x98, 0xcd, 0x99, 0xb3, 0x3d, 0x79, 0x99,
+  0xb1, 0x8c, 0x01, 0xff, 0xff, 0xe0, 0x61, 0xeb, 0x63, 0xc6, 0xd9, 0x9e, 0xbc, 0xcc, 0xcc, 0x30,
+  0xd6, 0x9a, 0x1d, 0x9f, 0x2d, 0x00, 0x06, 0x0c, 0x18, 0x6b, 0x06, 0xbf, 0xbf, 0xff, 0xf1, 0xec,
+  0x6b, 0x06, 0xb0, 0x6b, 0x06, 0x5b, 0x58, 0x00, 0x00, 0x7b, 0x35, 0x83, 0x58, 0x06, 0x8d, 0x69,
+  0x96, 0xa9, 0xab, 0x1c, 0xd3, 0x2c, 0x2c, 0x00, 0x0e, 0xff, 0x83, 0x58, 0xd6, 0x30, 0xc3, 0x6b,
+  0x6b, 0xd6, 0x63, 0x0c, 0xff, 0xe5, 0x8c, 0x63, 0x31, 0xb5, 0xeb, 0x6b, 0x6b, 0x6f, 0xfe, 0xfe,
+  0x16, 0xb4, 0x69, 0x96, 0x69, 0x94, 0x74, 0x4d, 0x32, 0xc6, 0xb5, 0x83, 0x59, 0x60, 0x59, 0x34,
+  0xb7, 0xff, 0xf7, 0x1a, 0xc6, 0xb6, 0xb1, 0x98, 0xd8, 0xf5, 0xeb, 0xc6, 0xc6, 0xdf, 0x7f, 0xff,
+  0xa1, 0x8d, 0x6c, 0x36, 0x36, 0x66, 0x6c, 0xd8, 0xd8, 0xcc, 0x6b, 0x1a, 0x71, 0x0a, 0x08, 0x33,
+  0x00, 0x3c, 0x31, 0x96, 0x00, 0x0b, 0x2c, 0x2f, 0x4c, 0x30, 0xcf, 0xfe, 0xff, 0xec, 0xcc, 0x63,
+  0x18, 0xd6, 0x1a, 0x3b, 0xff, 0xf9, 0x7a, 0xc6, 0x18, 0x6b, 0x6b, 0x58, 0xcb, 0x35, 0x83, 0x09,
+  0x89, 0x9a, 0xd6, 0x1a, 0xc6, 0x18, 0x65, 0xff, 0xfd, 0xa6, 0xb1, 0xad, 0x86, 0xcc, 0xcd, 0x99,
+  0xeb, 0xcc, 0xcc, 0xcc, 0x00, 0x77, 0xff, 0xff, 0x76, 0xb1, 0xb5, 0xb3, 0x63, 0xc7, 0x8f, 0x1e,
+  0xbc, 0x66, 0x30, 0x35, 0xad, 0x0f, 0xd0, 0x96, 0x80, 0x06, 0xb0, 0xd6, 0x6b, 0x06, 0x59, 0xa7,
+  0xff, 0xfe, 0x7f, 0xf6, 0x1a, 0xc1, 0xac, 0x1a, 0xc3, 0x58, 0x6b, 0x68, 0x00, 0x0d, 0xb0, 0xd6,
+  0x6b, 0x58, 0x01, 0xa6, 0x9a, 0xd6, 0xa4, 0xaa, 0xb0, 0xdd, 0x60, 0x00, 0x00, 0xff, 0xb8, 0x6b,
+  0x0c, 0x18, 0x63, 0x19, 0x8c, 0x61, 0x9a, 0xff, 0x83, 0x0d, 0xad, 0xaf, 0x5e, 0xb3, 0x35, 0xb1,
+  0xdf, 0xff, 0x01, 0x6b, 0x59, 0x60, 0xd6, 0x29, 0x28, 0xcd, 0x6b, 0x06, 0xb5, 0x81, 0xad, 0x65,
+  0x96, 0x9a, 0xb2, 0x77, 0xff, 0xc6, 0x5e, 0xb5, 0xb5, 0xb5, 0xb5, 0xe3, 0x36, 0x66, 0x6c, 0x6d,
+  0xff, 0xfe, 0x8f, 0xc3, 0x0c, 0xc7, 0xad, 0x9b, 0x1e, 0x36, 0x66, 0x3d, 0x66, 0xb3, 0x5a, 0xdc,
+  0xe2, 0x61, 0xf8, 0xcc, 0x0c, 0xc3, 0x1a, 0xc0, 0x05, 0x8b, 0x16, 0x0c, 0xbd, 0x61, 0x9f, 0xff,
+  0xf6, 0xcb, 0xd6, 0xc3, 0x61, 0xaf, 0x5a, 0xc1, 0xa7, 0xff, 0xfd, 0x51, 0xad, 0xac, 0x61, 0xad,
+  0xac, 0xbd, 0x30, 0x6b, 0x0d, 0x0c, 0x8c, 0x9a, 0xd6, 0x1a, 0xc3, 0x0c, 0xd6, 0xff, 0xee, 0xb2,
+  0xcd, 0x63, 0x19, 0x99, 0x9b, 0x36, 0x66, 0xcc, 0xc6, 0xc0, 0x07, 0xdf, 0xff, 0xfd, 0xba, 0xda,
+  0xd8, 0xcd, 0x99, 0xb6, 0x66, 0xcd, 0x8c, 0xcd, 0x66, 0x9a, 0xd6, 0x88, 0x68, 0xc5, 0xa0, 0x01,
+  0xac, 0x6b, 0x1a, 0xc1, 0xac, 0x1f, 0x7f, 0xff, 0xe7, 0xeb, 0x1a, 0xc3, 0x58, 0x1a, 0xc1, 0x83,
+  0x5e, 0x98, 0x00, 0x3c, 0xc1, 0x83, 0x5a, 0xc0, 0x1a, 0x35, 0xad, 0x51, 0x53, 0xe0, 0x35, 0xad,
+  0x00, 0x00, 0x3f, 0xff, 0xb6, 0x9a, 0xc6, 0xb1, 0x83, 0x30, 0xcc, 0x63, 0x18, 0xbf, 0x86, 0x30,
+  0xcc, 0xd7, 0xad, 0x86, 0xd6, 0x7f, 0xff, 0xe8, 0xe4, 0x05, 0x80, 0x35, 0x85, 0x25, 0x1b, 0x59,
+  0x60, 0x6b, 0x58, 0x06, 0xb5, 0xa3, 0x45, 0xad, 0x2f, 0xfb, 0xed, 0x63, 0x2f, 0x58, 0xcc, 0xcc,
+  0xcd, 0x99, 0xb1, 0xbf, 0xbf, 0xfe, 0x35, 0xaf, 0x59, 0x98, 0xf1, 0xb3, 0x36, 0x66, 0xc6, 0x66,
+  0xb6, 0xb5, 0x8e, 0xd1, 0x30, 0xfc, 0xcd, 0x7a, 0xcc, 0x63, 0x06, 0xb0, 0x0b, 0x0b, 0x2c, 0x06,
+  0xb6, 0xb1, 0xae, 0xff, 0xff, 0xb4, 0x63, 0x6b, 0xd6, 0x63, 0x06, 0x00, 0xff, 0xef, 0xed, 0x63,
+  0x18, 0x6b, 0x6b, 0x06, 0xb1, 0xac, 0x0c, 0x1f, 0x1f, 0xd3, 0x58, 0x1a, 0xc6, 0xb6, 0xb3, 0x7f,
+  0x7f, 0x01, 0xac, 0x6b, 0xd6, 0xd7, 0x8c, 0xf5, 0xe3, 0x66, 0xcc, 0x6c, 0x60, 0x07, 0xf7, 0xff,
+  0xff, 0x66, 0x19, 0x98, 0xd9, 0xb3, 0x66, 0xcc, 0xd9, 0x8c, 0xd6, 0x6b, 0x5a, 0xd6, 0x92, 0x12,
+  0xd6, 0xb4, 0x05, 0xe8, 0xc1, 0xac, 0xd3, 0x03, 0x59, 0x6f, 0xff, 0xfd, 0x8f, 0xfe, 0xc1, 0xac,
+  0x35, 0x97, 0xa6, 0xb0, 0xd6, 0x35, 0x98, 0x60, 0x1b, 0x0c, 0x35, 0x86, 0xb5, 0x80, 0x06, 0x9a,
+  0xd4, 0x14, 0xcb, 0x03, 0x5a, 0xc0, 0x00, 0x0f, 0xbf, 0x8d, 0x6b, 0x35, 0x86, 0xbd, 0x6b, 0xd6,
+  0x63, 0x19, 0xad, 0xad, 0xf7, 0x6b, 0x18, 0x66, 0x31, 0x98, 0x6d, 0x6f, 0xfe, 0xe5, 0xa6, 0x80,
+  0x34, 0xc5, 0x9a, 0x96, 0x91, 0xac, 0xb0, 0x34, 0xd6, 0x58, 0x34, 0x00, 0xb4, 0x13, 0xff, 0xeb,
+  0x0d, 0x6d, 0x66, 0x36, 0x3d, 0x78, 0xdb, 0x5e, 0x37, 0xff, 0xfa, 0x54, 0x35, 0x98, 0xcc, 0xcd,
+  0x99, 0xb3, 0x63, 0x66, 0x63, 0x0c, 0x0f, 0x41, 0x20, 0xf6, 0x31, 0x98, 0x63, 0x59, 0xad, 0x60,
+  0x2c, 0x59, 0x61, 0x7a, 0x60, 0xcd, 0x6f, 0xff, 0xfb, 0x6f, 0x99, 0xaf, 0x5b, 0x0c, 0xc1, 0xac,
+  0x07, 0x7f, 0xfd, 0x61, 0xb5, 0x8d, 0x6d, 0x61, 0xac, 0x35, 0x97, 0xa6, 0xb1, 0x31, 0x33, 0x4c,
+  0xb1, 0xad, 0x66, 0xb1, 0x9d, 0xfd, 0x34, 0xd6, 0x1a, 0xd8, 0x6c, 0x6c, 0xcd, 0x99, 0x9b, 0x19,
+  0x9a, 0x00, 0xff, 0xbf, 0xff, 0xfa, 0xf3, 0x5b, 0x19, 0x99, 0xb6, 0x66, 0xcd, 0x8f, 0x5b, 0x1a,
+  0xf4, 0xd6, 0xb2, 0x64, 0xd5, 0x0f, 0xb6, 0xcc, 0xe0, 0x0d, 0x61, 0xac, 0x1a, 0xc0, 0x6b, 0x5f,
+  0xff, 0xfb, 0x36, 0x0d, 0x61, 0xac, 0x0c, 0xb3, 0x58, 0x61, 0x86, 0x61, 0x8c, 0x6b, 0x69, 0x83,
+  0x5a, 0xcb, 0x00, 0x68, 0xd3, 0xf4, 0xb6, 0x58, 0x69, 0xac, 0x00, 0x00, 0xff, 0xeb, 0x4c, 0xb6,
+  0xb5, 0x99, 0x7a, 0xc6, 0x31, 0x9a, 0xda, 0xda, 0xfa, 0xc3, 0x0c, 0x66, 0x1b, 0x5b, 0x5e, 0x9f,
+  0x7f, 0x02, 0xd1, 0xa6, 0xb5, 0xac, 0x0d, 0x4d, 0x4b, 0xad, 0x61, 0x63, 0x46, 0xb5, 0x8b, 0x00,
+  0xb2, 0xd0, 0x5a, 0xdf, 0xdf, 0xf6, 0x35, 0x9a, 0xd8, 0xcc, 0xd9, 0xb1, 0xe3, 0x3f, 0xef, 0xe8,
+  0x6b, 0x6b, 0x6b, 0xc6, 0x6d, 0xaf, 0x36, 0x3d, 0x78, 0xcc, 0xc3, 0x06, 0xbe, 0x84, 0x83, 0xdb,
+  0x5b, 0x5b, 0x59, 0x86, 0xb3, 0x5a, 0xc5, 0x85, 0x96, 0x58, 0x06, 0x18, 0x6e, 0xff, 0xff, 0xb4,
+  0xbd, 0x6d, 0x7a, 0xda, 0xd8, 0x60, 0xcb, 0x0b, 0x7f, 0xf7, 0xf6, 0xd6, 0x31, 0xad, 0xac, 0x6b,
+  0x03, 0x2d, 0xa6, 0xb0, 0xb4, 0xb5, 0xad, 0x65, 0x9a, 0x60, 0xc2, 0xfe, 0xb2, 0xc5, 0xb4, 0xc6,
+  0x33, 0x31, 0xe3, 0x36, 0x6d, 0x78, 0xcd, 0x7a, 0x00, 0xff, 0xef, 0xff, 0xe3, 0x0d, 0x8d, 0x8f,
+  0x1b, 0x66, 0x6c, 0xcc, 0xc6, 0x1a, 0xcb, 0x5a, 0xf9, 0x29, 0x29, 0xb3, 0x66, 0x6e, 0xe3, 0x4d,
+  0x63, 0x5a, 0xc3, 0x5a, 0xc0, 0xd7, 0xf7, 0xff, 0xfe, 0xd6, 0xb0, 0xcb, 0x69, 0x80, 0xcb, 0x6b,
+  0x5b, 0x58, 0x66, 0x18, 0xc3, 0x35, 0x86, 0x03, 0x5a, 0xd6, 0x00, 0x09, 0xfa, 0x46, 0x58, 0x06,
+  0xb0, 0x00, 0x0f, 0xbb, 0x4a, 0xcb, 0xd3, 0x0d, 0x6d, 0x63, 0x30, 0xcd, 0x6d, 0x6b, 0xec, 0xd6,
+  0x18, 0xc6, 0x31, 0x9a, 0xf5, 0xf7, 0xcb, 0x45, 0x96, 0xb5, 0xac, 0x01, 0xaa, 0x7a, 0x7b, 0x58,
+  0xb0, 0x03, 0x5a, 0xd6, 0xb2, 0xc5, 0xad, 0x01, 0x69, 0xaf, 0xfe, 0x9a, 0xc3, 0x6b, 0x66, 0x6c,
+  0xcd, 0x99, 0xaf, 0xff, 0xf4, 0xd6, 0x8c, 0x31, 0xb5, 0xe6, 0x66, 0xd8, 0xf5, 0xe3, 0xd6, 0xc6,
+  0x6b, 0x34, 0xd7, 0xf8, 0x88, 0x79, 0x8d, 0x7a, 0xc6, 0x18, 0x1a, 0xcb, 0x16, 0x2d, 0x65, 0x81,
+  0x97, 0xac, 0x37, 0xff, 0xdf, 0xfd, 0x9a, 0xf5, 0xeb, 0x31, 0x86, 0x35, 0xac, 0xb2, 0x7f, 0xff,
+  0x35, 0x98, 0xd6, 0xd6, 0x35, 0x86, 0xb2, 0xda, 0x6b, 0x06, 0x86, 0x9a, 0x65, 0x80, 0xd6, 0x35,
+  0xbe, 0xe0, 0x0d, 0x30, 0xd7, 0xac, 0xcc, 0xcd, 0x8d, 0x99, 0x99, 0x8c, 0x00, 0x7f, 0xfd, 0xff,
+  0xf3, 0x0c, 0xcc, 0x78, 0xd9, 0xb3, 0x66, 0x66, 0xd6, 0xd6, 0xd3, 0x2c, 0xbb, 0xe2, 0x2a, 0x27,
+  0xaf, 0x33, 0x36, 0x37, 0x7d, 0xa6, 0x06, 0xb0, 0x1a, 0xd6, 0x07, 0xff, 0xff, 0x27, 0xfd, 0x81,
+  0xac, 0xd3, 0x03, 0x58, 0x65, 0xeb, 0x5e, 0xb1, 0x8d, 0x7a, 0xcd, 0x66, 0xb1, 0xac, 0x0d, 0x35,
+  0x96, 0x2c, 0x09, 0xfa, 0x43, 0x59, 0x60, 0xd0, 0x00, 0x1f, 0xd0, 0x35, 0x81, 0x59, 0xac, 0x63,
+  0x0c, 0xc3, 0x37, 0x46, 0xb1, 0x83, 0x30, 0xcc, 0x6b, 0xdf, 0x7f, 0x0b, 0x41, 0x61, 0x60, 0xd1,
+  0xad, 0x53, 0x53, 0x6b, 0x16, 0x16, 0x0d, 0x0d, 0x6b, 0x5a, 0x69, 0xa0, 0xb2, 0x68, 0xbf, 0xf9,
+  0xac, 0x66, 0x36, 0x66, 0xcd, 0x99, 0xbf, 0xfe, 0xfb, 0x46, 0xb3, 0x5b, 0x31, 0xeb, 0xc7, 0x8d,
+  0xb3, 0x33, 0x33, 0x18, 0x32, 0xdf, 0xe2, 0x21, 0xec, 0x61, 0x8d, 0x6d, 0x6b, 0x1a, 0xd6, 0x59,
+  0x65, 0xac, 0xb0, 0x1a, 0xda, 0xc3, 0x7f, 0xff, 0xda, 0xd8, 0xc6, 0xc3, 0x30, 0xc1, 0xad, 0x64,
+  0xdf, 0xdf, 0xf6, 0x19, 0xad, 0xac, 0x65, 0xb4, 0xcb, 0x68, 0xcb, 0x07, 0x87, 0x86, 0x59, 0x60,
+  0xd6, 0x1f, 0x2d, 0x69, 0xad, 0x6b, 0x0c, 0x33, 0x19, 0x99, 0xb1, 0xeb, 0x66, 0x33, 0x00, 0x1f,
+  0xff, 0xdf, 0xf5, 0x8c, 0x6d, 0x7a, 0xf3, 0x33, 0x6c, 0xcc, 0xda, 0xf0, 0xc6, 0xb2, 0xcf, 0xff,
+  0x98, 0x7e, 0x7e, 0x7a, 0xf3, 0x31, 0xb0, 0xbf, 0xb2, 0xcd, 0x35, 0x80, 0x6b, 0x59, 0x6f, 0xff,
+  0xfe, 0x6e, 0xd6, 0x6b, 0x2f, 0x4d, 0x63, 0x5a, 0xc6, 0xb3, 0x58, 0xc6, 0x19, 0xad, 0xac, 0x6b,
+  0x1a, 0xc0, 0x35, 0xad, 0x6b, 0x2c, 0x27, 0xe9, 0x0d, 0x35, 0x96, 0x34, 0x00, 0x3f, 0xe5, 0x81,
+  0x96, 0x35, 0x97, 0xa1, 0x31, 0x8c, 0x33, 0x39, 0xad, 0x66, 0xb1, 0x86, 0x31, 0x8d, 0x6f, 0xfe,
+  0x69, 0x6b, 0x40, 0x34, 0x34, 0xd6, 0xb5, 0x5d, 0x5d, 0x96, 0x58, 0xb0, 0x17, 0xa0, 0x68, 0xd0,
+  0x0b, 0x26, 0x9a, 0x3f, 0xbe, 0x63, 0x19, 0x9e, 0xbc, 0x6d, 0x99, 0xdf, 0xfd, 0x1a, 0x63, 0x5e,
+  0xb6, 0x66, 0xcc, 0xf5, 0xe3, 0xc6, 0xc6, 0xd7, 0xac, 0x65, 0x8f, 0xf1, 0x11, 0x0b, 0x30, 0xc6,
+  0xb1, 0xac, 0x34, 0xd6, 0x59, 0x6b, 0x59, 0x65, 0x9a, 0xd6, 0xd6, 0x37, 0xfd, 0xff, 0xff, 0x65,
+  0xeb, 0x33, 0x5e, 0xb6, 0x18, 0xd6, 0x35, 0xa6, 0xb4, 0xff, 0xb9, 0xad, 0xad, 0xac, 0x65, 0xe9,
+  0x96, 0x69, 0xac, 0x04, 0x34, 0x3d, 0x6b, 0x2c, 0x01, 0xc0, 0x2c, 0x58, 0x1a, 0xc6, 0x31, 0xb1,
+  0x9b, 0x1b, 0x1b, 0x18, 0xc0, 0x0f, 0xff, 0xef, 0xfe, 0xc6, 0x31, 0xb1, 0xeb, 0xcc, 0xcf, 0x5e,
+  0x36, 0x33, 0x06, 0x59, 0xff, 0xfe, 0x8f, 0xeb, 0xc3, 0xa3, 0x9c, 0xd9, 0x9b, 0x18, 0xcc, 0x77,
+  0xf6, 0x0d, 0x6b, 0x2c, 0x1a, 0x6b, 0x77, 0xff, 0xff, 0x43, 0x03, 0x06, 0x58, 0xd6, 0x0c, 0x18,
+  0xc6, 0xb6, 0x0c, 0xd6, 0x6b, 0x06, 0x58, 0x0d, 0x35, 0xad, 0x6b, 0x28, 0x29, 0x40, 0xd6, 0xb0,
+  0x00, 0x3f, 0xb8, 0xd6, 0x1a, 0xd6, 0x6b, 0x58, 0xd6, 0x03, 0x2c, 0x06, 0xb5, 0x86, 0x5b, 0x58,
+  0xc6, 0xb6, 0x0d, 0xff, 0x59, 0x0b, 0x5a, 0xd3, 0x4d, 0x35, 0xad, 0x65, 0x5d, 0x5b, 0x96, 0x59,
+  0x65, 0x96, 0x16, 0x00, 0x01, 0x65, 0x93, 0x46, 0x8b, 0xff, 0xb0, 0xcc, 0xcd, 0x99, 0xb6, 0x67,
+  0xff, 0xdd, 0xa3, 0x58, 0xc6, 0x66, 0xc7, 0x8f, 0x1e, 0xbc, 0xcc, 0xc6, 0xc1, 0x81, 0xfe, 0x22,
+  0x20, 0x61, 0x8d, 0x63, 0x5a, 0xcd, 0x34, 0xd6, 0x5a, 0xd6, 0xb5, 0x80, 0xc3, 0x5b, 0x5f, 0xff,
+  0xf6, 0xff, 0xdb, 0x0d, 0xaf, 0x59, 0x8c, 0x35, 0x9a, 0x34, 0x6a, 0xfb, 0xed, 0x7a, 0xcc, 0x35,
+  0xb4, 0xc0, 0xd6, 0x58, 0x32, 0x5a, 0x5e, 0xb5, 0x96, 0x71, 0xa6, 0x9a, 0x34, 0x1a, 0x1a, 0xc3,
+  0x0c, 0xcd, 0x78, 0xd8, 0xda, 0xf1, 0x8c, 0xc0, 0x0f, 0xff, 0xff, 0x6f, 0xe3, 0x0c, 0xcc, 0xcd,
+  0x99, 0xb3, 0x63, 0xd6, 0xc3, 0x35, 0x96, 0xff, 0xff, 0x48, 0x6c, 0x1a, 0x9a, 0x36, 0x6c, 0xc6,
+  0xc6, 0x18, 0xdf, 0x7c, 0x0d, 0x6b, 0x58, 0x01, 0xf7, 0xff, 0xff, 0x53, 0x0d, 0x61, 0xac, 0x1a,
+  0xc3, 0x2f, 0x58, 0xd7, 0xac, 0x61, 0x8d, 0x6d, 0x30, 0xd6, 0xb1, 0x66, 0x83, 0x4d, 0x6a, 0x86,
+  0x9a, 0xc0, 0x6b, 0x58, 0x01, 0xf7, 0xc0, 0xd6, 0x35, 0x83, 0x58, 0xd6, 0xb6, 0x9a, 0xc1, 0xa6,
+  0x58, 0x6b, 0x06, 0xb6, 0xb1, 0x8d, 0x6d, 0x7f, 0x05, 0xa1, 0x65, 0x96, 0xb2, 0xd6, 0x59, 0x6b,
+  0x1b, 0x0d, 0x65, 0xac, 0xb5, 0x96, 0xb2, 0xc5, 0x8b, 0x0b, 0x16, 0xb5, 0xad, 0x34, 0x68, 0xff,
+  0xe1, 0x8f, 0x5b, 0x66, 0x6d, 0x8e, 0xff, 0xad, 0x35, 0x86, 0x33, 0x63, 0xd7, 0x99, 0xeb, 0xc7,
+  0x8c, 0xd8, 0x6d, 0x60, 0x3f, 0xc4, 0x84, 0x58, 0x63, 0x58, 0x6b, 0x03, 0x4d, 0x6b, 0x4d, 0x6b,
+  0x59, 0x63, 0x58, 0x6b, 0x6f, 0xbf, 0xff, 0xed, 0x5b, 0x5e, 0xb3, 0x18, 0xcc, 0x18, 0x00, 0x17,
+  0x7c, 0x66, 0xb6, 0xb1, 0xac, 0x35, 0xac, 0x5b, 0x46, 0x53, 0x53, 0xd7, 0x65, 0x86, 0x99, 0x65,
+  0x96, 0xb5, 0xad, 0x6b, 0x2d, 0xa6, 0x6b, 0x6b, 0xd6, 0xc6, 0xc6, 0x66, 0x63, 0x00, 0x0f, 0xff,
+  0xff, 0x5e, 0xb5, 0xb5, 0xeb, 0x36, 0x36, 0xc6, 0xcd, 0x99, 0x8d, 0xac, 0xd6, 0xb7, 0xff, 0xfa,
+  0x4d, 0xe3, 0x0c, 0x0b, 0xbd, 0x79, 0x99, 0x99, 0x8c, 0x31, 0x97, 0x7c, 0x1a, 0x69, 0x96, 0x16,
+  0xff, 0xbf, 0xff, 0xb0, 0x30, 0x65, 0xb4, 0xcb, 0xd3, 0x1a, 0xda, 0xc6, 0x30, 0xd6, 0xd6, 0x35,
+  0x83, 0x4c, 0xb0, 0x00, 0xd2, 0x8e, 0x9f, 0x59, 0x60, 0xd6, 0xb0, 0x1f, 0xff, 0x6b, 0x03, 0x06,
+  0xb1, 0xac, 0x35, 0x8d, 0x60, 0x6b, 0x2c, 0x69, 0x96, 0x6b, 0x06, 0x35, 0xe9, 0x8f, 0xed, 0x02,
+  0x68, 0x16, 0x0b, 0x16, 0x2d, 0x69, 0x67, 0x96, 0xb5, 0xad, 0x6b, 0x5a, 0xd6, 0xb5, 0xac, 0xb5,
+  0x96, 0xb5, 0xad, 0x69, 0xa6, 0x9a, 0x37, 0xff, 0x4c, 0x67, 0xaf, 0x33, 0x66, 0xdf, 0xff, 0x76,
+  0xb4, 0xc1, 0x8d, 0x8f, 0x5e, 0x3c, 0x78, 0xf5, 0xe6, 0x36, 0x33, 0x58, 0xd1, 0xfe, 0x24, 0x23,
+  0x8c, 0x18, 0x35, 0x80, 0x69, 0xa6, 0xb4, 0xd6, 0xb2, 0xc6, 0xb0, 0xd6, 0xdf, 0xff, 0xf7, 0x5f,
+  0xf6, 0x1b, 0x5b, 0x18, 0xc6, 0xb6, 0xb2, 0xc0, 0x16, 0x9f, 0xf6, 0x31, 0x83, 0x0d, 0x6b, 0x00,
+  0xa1, 0x45, 0x3f, 0x59, 0x6d, 0x19, 0x60, 0x01, 0x60, 0xb3, 0x4c, 0x35, 0xeb, 0x33, 0x1b, 0x5e,
+  0x31, 0xb0, 0xc0, 0x07, 0xff, 0xff, 0xaf, 0xd8, 0x63, 0x33, 0x1e, 0x36, 0x6c, 0x6c, 0xcc, 0x61,
+  0xad, 0xff, 0xfd, 0xd8, 0xf5, 0xe2, 0xb2, 0x9d, 0x99, 0xb1, 0xb1, 0x8d, 0x7a, 0xc6, 0x0f, 0xfa,
+  0x00, 0xd6, 0xb5, 0xad, 0xff, 0xdf, 0xff, 0x6b, 0x6b, 0x59, 0xac, 0x0c, 0x0c, 0x6b, 0x6b, 0x18,
+  0x63, 0x5b, 0x5a, 0xda, 0xd6, 0x0d, 0x6b, 0x59, 0x60, 0x5e, 0x94, 0xb5, 0x2d, 0x32, 0xc1, 0xad,
+  0x63, 0xef, 0xe1, 0x81, 0xac, 0xd6, 0x0c, 0x18, 0x30, 0x32, 0xc6, 0x9a, 0xc0, 0xd6, 0x1a, 0xcd,
+  0x66, 0xb5, 0xd6, 0x40, 0x5a, 0x1a, 0x00, 0x16, 0x2d, 0xed, 0xec, 0xb4, 0xd6, 0xb4, 0xd3, 0x46,
+  0xb4, 0xd6, 0x9a, 0xd6, 0x9a, 0x69, 0xa6, 0xb4, 0xd6, 0xbf, 0xb9, 0x99, 0xb3, 0x66, 0xcd, 0x7f,
+  0xfd, 0x96, 0xb5, 0x8d, 0x7a, 0xd9, 0x99, 0xb6, 0x66, 0xd8, 0xf5, 0xe3, 0x1b, 0x58, 0x61, 0xfe,
+  0x24, 0x24, 0xd6, 0x6b, 0x06, 0xb0, 0x06, 0x9a, 0x69, 0xa6, 0xb5, 0x81, 0xac, 0xd6, 0x3f, 0xff,
+  0xee, 0x4c, 0x66, 0x33, 0x5e, 0xb3, 0x59, 0xad, 0x60, 0xb2, 0xd0, 0xba, 0xda, 0xc6, 0x0d, 0x64,
+  0x86, 0x86, 0x92, 0x51, 0xf0, 0x0c, 0xb1, 0xa3, 0x4d, 0x1a, 0x0d, 0x35, 0x86, 0xb6, 0x19, 0x8d,
+  0xaf, 0x5e, 0xb6, 0x35, 0xe8, 0x00, 0xff, 0xff, 0xf5, 0xfb, 0x35, 0x98, 0xda, 0xf1, 0xb3, 0x36,
+  0x3d, 0x78, 0x6d, 0x66, 0xb7, 0xff, 0xdf, 0x31, 0xb0, 0x98, 0x93, 0x36, 0x63, 0xd6, 0xc6, 0x31,
+  0x86, 0x0d, 0xf7, 0xf5, 0x80, 0x1a, 0x6b, 0xfe, 0xff, 0x81, 0x86, 0xb1, 0xa6, 0x35, 0x86, 0x30,
+  0x66, 0xb3, 0x58, 0xd6, 0x69, 0x80, 0x35, 0xad, 0x6b, 0x2c, 0x54, 0xf5, 0x66, 0x8c, 0xb0, 0x6b,
+  0x3f, 0xfa, 0x06, 0x06, 0x1a, 0xcd, 0x61, 0x83, 0x06, 0xb1, 0xa6, 0x58, 0x6b, 0x58, 0x35, 0x9a,
+  0xc3, 0x7d, 0xa2, 0xd6, 0x81, 0x6b, 0x4d, 0x34, 0x00, 0xae, 0xee, 0xed, 0x69, 0xa6, 0x9a, 0x1a,
+  0x0d, 0x0d, 0x1a, 0x68, 0xd3, 0x4d, 0x6b, 0x5a, 0xd3, 0x7f, 0xf5, 0x99, 0xb3, 0x3c, 0x79, 0xff,
+  0x75, 0xad, 0x60, 0x6d, 0x7a, 0xdb, 0x1e, 0x3c, 0x78, 0xdb, 0x1b, 0x5e, 0x18, 0x68, 0x7f, 0x89,
+  0x89, 0xeb, 0x35, 0x8d, 0x6b, 0x00, 0x68, 0xd3, 0x46, 0xb4, 0xcb, 0x1a, 0xc3, 0x1f, 0xfd, 0xff,
+  0xf0, 0xda, 0xd8, 0x6d, 0x6c, 0x18, 0x6b, 0x2c, 0x5a, 0x6a, 0xc9, 0xb8, 0x62, 0x00, 0x03, 0x4d,
+  0x20, 0xa0, 0x2d, 0xa6, 0xb0, 0x6b, 0x59, 0x65, 0xad, 0x6b, 0x5a, 0xc0, 0xd6, 0xd6, 0x63, 0x19,
+  0xb5, 0xb1, 0x8c, 0x00, 0x1f, 0xff, 0xfe, 0x96, 0x9b, 0x59, 0x8d, 0x98, 0xf1, 0xb3, 0x33, 0x31,
+  0x86, 0xfe, 0xff, 0xfb, 0x1b, 0x5e, 0x10, 0x8f, 0xe6, 0x66, 0x6d, 0x7a, 0xd8, 0x63, 0x0c, 0x19,
+  0x7f, 0xf5, 0xac, 0x58, 0x34, 0xef, 0xfe, 0x1a, 0xc6, 0xb0, 0xcb, 0x35, 0x8d, 0x6d, 0x63, 0x5b,
+  0x58, 0xd6, 0x6b, 0x03, 0x2c, 0x06, 0x8d, 0x69, 0xac, 0xaa, 0xae, 0x2c, 0xd3, 0x58, 0x0f, 0xff,
+  0xef, 0xeb, 0x03, 0x06, 0x1a, 0xcd, 0x66, 0xb0, 0xc1, 0x83, 0x58, 0x0d, 0x62, 0xf4, 0x60, 0x61,
+  0xda, 0xd0, 0x16, 0x80, 0xb2, 0xd6, 0xb4, 0x01, 0x7f, 0x7f, 0x6b, 0x46, 0x83, 0x40, 0x00, 0x0d,
+  0x06, 0x8d, 0x69, 0xac, 0xb5, 0xad, 0x7f, 0xf3, 0xd6, 0xd9, 0x9e, 0xbc, 0xdf, 0xff, 0x0b, 0x58,
+  0x31, 0x99, 0xb3, 0x36, 0xcc, 0xd9, 0xb3, 0x31, 0x98, 0x30, 0x7f, 0x8a, 0x0a, 0x63, 0x5b, 0x4c,
+  0xb0, 0x34, 0x34, 0x68, 0xd1, 0xad, 0x65, 0xb5, 0xac, 0xd6, 0x7f, 0xff, 0xdf, 0x43, 0x31, 0x8c,
+  0xd7, 0xac, 0x60, 0xd6, 0xb5, 0xad, 0x05, 0xa0, 0xb4, 0x00, 0x5b, 0x43, 0x4c, 0x39, 0x38, 0x1a,
+  0xd6, 0x35, 0xac, 0x0b, 0x00, 0xb0, 0x1a, 0xc3, 0x35, 0xb5, 0xb1, 0x98, 0xcc, 0x60, 0x00, 0xff,
+  0xff, 0xf4, 0xb5, 0x98, 0x66, 0x66, 0x6c, 0x6c, 0xcd, 0xaf, 0x5b, 0x59, 0xaf, 0xff, 0xf4, 0xe6,
+  0x33, 0x30, 0xe8, 0xdb, 0x36, 0x63, 0x63, 0x18, 0xcd, 0x6d, 0x61, 0xac, 0x7f, 0xfd, 0x35, 0xac,
+  0xb0, 0x3f, 0xfe, 0xb5, 0xad, 0xad, 0x6d, 0x30, 0x60, 0xc6, 0x0c, 0x6b, 0x35, 0x86, 0xb1, 0xa6,
+  0xb1, 0x60, 0x1a, 0x1a, 0xad, 0xb1, 0xb2, 0xc1, 0xac, 0xb3, 0xef, 0xff, 0xfe, 0xe6, 0xb0, 0x6b,
+  0x35, 0x8c, 0x18, 0x61, 0x83, 0x0c, 0xb3, 0x4d, 0x60, 0x1a, 0xc0, 0xd0, 0xb2, 0xd6, 0x82, 0xc8,
+  0xd0, 0xb1, 0x69, 0xa1, 0x6c, 0x4c, 0x3d, 0x34, 0x4c, 0x64, 0x01, 0x60, 0x00, 0x34, 0x6b, 0x5a,
+  0xcb, 0x2d, 0x6f, 0xee, 0x3d, 0x79, 0x9b, 0x65, 0xff, 0x0b, 0x2c, 0x61, 0x9b, 0x1e, 0x36, 0xcd,
+  0x9b, 0x33, 0x33, 0x18, 0x60, 0x7f, 0x8a, 0x0a, 0xb5, 0x8c, 0xb0, 0x34, 0x34, 0x68, 0xd0, 0xd3,
+  0x5a, 0xc3, 0x58, 0x6b, 0xbf, 0xff, 0xef, 0x98, 0xc6, 0x63, 0x18, 0xc3, 0x01, 0xad, 0x34, 0x59,
+  0x05, 0xa0, 0x02, 0xc3, 0x4d, 0x6b, 0x19, 0x18, 0x9a, 0xc0, 0xd6, 0x06, 0x8d, 0x0d, 0x06, 0x9a,
+  0xc6, 0xb3, 0x0c, 0xc6, 0x63, 0x18, 0xc0, 0x03, 0xff, 0xff, 0xd2, 0xc6, 0xb6, 0xbd, 0x66, 0xc6,
+  0xc6, 0xcd, 0xaf, 0x0d, 0xac, 0xdf, 0xff, 0x7f, 0xde, 0xb3, 0x1b, 0x0c, 0x8b, 0x9b, 0x33, 0x33,
+  0x18, 0xcc, 0x33, 0x58, 0xd6, 0x2d, 0xff, 0xfd, 0xa3, 0x5a, 0xc8, 0x7d, 0xff, 0x30, 0xd6, 0x18,
+  0x18, 0x6b, 0x6b, 0x1a, 0xcd, 0x63, 0x58, 0x6b, 0x06, 0x99, 0x6b, 0x16, 0x00, 0xb1, 0xb4, 0x6b,
+  0x58, 0x0d, 0x67, 0xff, 0xff, 0x6c, 0x6b, 0x0d, 0x66, 0xb1, 0xad, 0xac, 0x6b, 0x30, 0xd6, 0x65,
+  0x9a, 0xd6, 0x06, 0xb5, 0xac, 0x16, 0xb0, 0x2c, 0x5a, 0x68, 0xb2, 0xd3, 0x41, 0x64, 0xd1, 0x6c,
+  0x9c, 0x86, 0x8f, 0xb6, 0x31, 0xb5, 0xef, 0x96, 0x58, 0xb0, 0x58, 0x34, 0x69, 0x96, 0x58, 0xb2,
+  0x7f, 0xc6, 0xcd, 0x9e, 0xbc, 0xef, 0xa5, 0x8b, 0x18, 0xc6, 0xc7, 0x99, 0xb3, 0x6c, 0x7a, 0xf1,
+  0xb5, 0xeb, 0x1a, 0x07, 0xf8, 0xa8, 0xb6, 0xb6, 0xb5, 0x86, 0x9a, 0x69, 0xa3, 0x46, 0x8d, 0x1a,
+  0xd6, 0x1a, 0xc3, 0x5f, 0xff, 0xdf, 0xf3, 0x5e, 0xb3, 0x19, 0xaf, 0x59, 0xac, 0xcb, 0x1a, 0x1a,
+  0x2c, 0x81, 0x68, 0x16, 0x16, 0x34, 0x65, 0x85, 0x65, 0x4d, 0x60, 0xd6, 0x06, 0xb5, 0x96, 0xb5,
+  0xa6, 0xb5, 0x96, 0x35, 0x9a, 0xcc, 0x63, 0x19, 0x8c, 0x00, 0x07, 0xff, 0xff, 0xa5, 0xb5, 0x8c,
+  0x63, 0xd6, 0xc7, 0xaf, 0x5e, 0xbc, 0x63, 0x6b, 0x2f, 0xff, 0xf5, 0x0c, 0xc3, 0x36, 0x15, 0x13,
+  0x33, 0x63, 0x33, 0x19, 0x8c, 0x33, 0x59, 0xad, 0x61, 0xdf, 0xfc, 0x1a, 0x68, 0x1f, 0xff, 0x03,
+  0x06, 0x0d, 0x66, 0xb3, 0x58, 0x61, 0xac, 0x65, 0x9a, 0xd6, 0x06, 0x9a, 0xd6, 0xb5, 0xac, 0xb2,
+  0xd6, 0xe0, 0x35, 0xac, 0x35, 0xbf, 0xff, 0xbf, 0xfb, 0x34, 0xcb, 0xd6, 0xb6, 0xb1, 0xad, 0xac,
+  0x61, 0x8c, 0x18, 0xd6, 0xb3, 0x46, 0xb2, 0xc2, 0x35, 0xac, 0x00, 0x16, 0x9a, 0x2c, 0xb5, 0xa0,
+  0x5a, 0x0b, 0x3b, 0x35, 0xaf, 0x8d, 0xad, 0x8c, 0xc6, 0xfa, 0xcb, 0x59, 0x62, 0xc0, 0x69, 0xad,
+  0x61, 0x61, 0x6b, 0xfa, 0xc6, 0xd9, 0xeb, 0xce, 0xfa, 0x2c, 0x0c, 0x36, 0x66, 0x6d, 0x99, 0xe3,
+  0x6c, 0x6c, 0xd7, 0xac, 0xd0, 0x1f, 0xe2, 0xc2, 0xf9, 0xac, 0x1a, 0x65, 0xad, 0x34, 0xd3, 0x46,
+  0x8d, 0x35, 0x81, 0x96, 0xd3, 0xff, 0xff, 0x1b, 0x19, 0xad, 0x86, 0xd6, 0xd6, 0xd6, 0x35, 0x80,
+  0x05, 0xad, 0x16, 0xb4, 0x2c, 0x58, 0x06, 0xb5, 0x82, 0x42, 0x3d, 0x60, 0xcb, 0x34, 0xcb, 0x05,
+  0x8b, 0x16, 0x03, 0x58, 0xd6, 0xd6, 0xd6, 0xd6, 0xc3, 0x32, 0xf0, 0x01, 0x7f, 0xff, 0xf9, 0xb5,
+  0x8c, 0x36, 0x31, 0xeb, 0xd7, 0xaf, 0x19, 0x8d, 0xac, 0xff, 0xfb, 0xeb, 0x6b, 0xd6, 0x60, 0x90,
+  0x7e, 0x66, 0x36, 0x36, 0xb6, 0x1b, 0x5b, 0x5b, 0x58, 0x6b, 0x03, 0xfe, 0xf8, 0x06, 0x07, 0x7f,
+  0xf6, 0xd6, 0x1a, 0xcd, 0x6b, 0x6b, 0x5e, 0x98, 0xd6, 0x35, 0x86, 0xb0, 0x6b, 0x00, 0x0d, 0x34,
+  0xd6, 0xb5, 0xcd, 0xe2, 0xc6, 0x98, 0xbd, 0x7d, 0xff, 0xff, 0xcb, 0x60, 0xd6, 0x6b, 0x0c, 0x61,
+  0x86, 0x30, 0xc6, 0x1a, 0xc3, 0x59, 0x60, 0x2b, 0x0c, 0xb3, 0x46, 0x80, 0x2d, 0x68, 0x16, 0x40,
+  0x9a, 0xb3, 0x4f, 0x4b, 0x77, 0xda, 0xf5, 0xb1, 0x8d, 0x8c, 0xba, 0x6b, 0x2d, 0x62, 0xc1, 0xa6,
+  0xb0, 0xb0, 0x16, 0xff, 0xad, 0x79, 0xb3, 0x67, 0xbb, 0xfe, 0x02, 0xda, 0xc6, 0x3d, 0x78, 0xdb,
+  0x36, 0x6d, 0xaf, 0x33, 0x31, 0x8d, 0x01, 0xfe, 0x2e, 0x32, 0x60, 0xd6, 0x58, 0xb2, 0xd6, 0x9a,
+  0x68, 0xd1, 0xad, 0x60, 0x6b, 0x35, 0xff, 0xf7, 0xff, 0x2f, 0x59, 0x8c, 0x66, 0xbd, 0x63, 0x0d,
+  0x65, 0x81, 0x64, 0x04, 0xd1, 0x62, 0xc5, 0x8d, 0x35, 0x80, 0xf0, 0xee, 0xb1, 0xac, 0x1a, 0xc0,
+  0x00, 0x01, 0xa6, 0xb1, 0x97, 0xac, 0x63, 0x19, 0xad, 0xac, 0x00, 0x2f, 0xff, 0xff, 0x3d, 0x63,
+  0x0c, 0xc6, 0x66, 0x6d, 0x78, 0xcc, 0x66, 0x9f, 0xff, 0xea, 0xb6, 0x31, 0x8c, 0x20, 0x1a, 0xcc,
+  0xcc, 0xcc, 0x63, 0x33, 0x5b, 0x0d, 0x6d, 0x6b, 0x01, 0xff, 0xff, 0xe1, 0x96, 0x30, 0x0f, 0xef,
+  0x98, 0xd6, 0x18, 0x18, 0xd6, 0x18, 0x18, 0x19, 0x6d, 0x35, 0xac, 0x2c, 0x01, 0xa1, 0x7d, 0x81,
+  0xac, 0x06, 0xb1, 0xff, 0xff, 0xca, 0xb0, 0x32, 0xf5, 0x86, 0x30, 0xc6, 0xbd, 0x63, 0x18, 0x6b,
+  0x69, 0x8b, 0x34, 0x37, 0xc6, 0x18, 0x1a, 0xd6, 0x9a, 0xd0, 0x2d, 0x68, 0x2d, 0x69, 0x68, 0x1b,
+  0x3b, 0x1d, 0xc6, 0x33, 0x31, 0x99, 0x8d, 0xfd, 0x35, 0xad, 0x65, 0x80, 0xd6, 0xb0, 0x01, 0x67,
+  0xfd, 0x36, 0x67, 0x8f, 0x37, 0xff, 0xc0, 0x0d, 0x6d, 0x7a, 0xf5, 0xe6, 0x6c, 0xd9, 0xeb, 0xcc,
+  0xcc, 0xcd, 0x6d, 0x00, 0xff, 0x18, 0x1a, 0x63, 0x59, 0x60, 0x0b, 0x2d, 0x34, 0xd3, 0x4d, 0x32,
+  0xc3, 0x58, 0x3f, 0xff, 0xf4, 0x79, 0x9a, 0xf5, 0x8c, 0xc6, 0x30, 0xc1, 0x96, 0x58, 0xb4, 0x6e,
+  0xcb, 0x40, 0xb2, 0xcb, 0x0d, 0x30, 0x05, 0xc5, 0xc1, 0xac, 0xd3, 0x01, 0xa6, 0x9a, 0x34, 0x6b,
+  0x5a, 0xcd, 0x6b, 0x6b, 0x35, 0xb5, 0xb5, 0xb5, 0x9a, 0x00, 0x1d, 0xff, 0xfc, 0xbd, 0x33, 0x5b,
+  0x5e, 0xb6, 0x33, 0x36, 0xbd, 0x7a, 0xda, 0xf5, 0xbf, 0xfb, 0xfe, 0xc3, 0x5e, 0xb3, 0x06, 0x85,
+  0x33, 0x06, 0xd6, 0xc6, 0x63, 0x30, 0xcd, 0x66, 0xb2, 0xc0, 0xff, 0xbf, 0xb2, 0xc0, 0x07, 0xfd,
+  0x0c, 0x35, 0x8d, 0x63, 0x58, 0x65, 0x9a, 0xc0, 0xd6, 0x0d, 0x6b, 0x5a, 0xcb, 0x16, 0x03, 0x0f,
+  0x15, 0xa6, 0x06, 0xb7, 0xff, 0xf7, 0xfd, 0xa6, 0x06, 0x18, 0xd6, 0x63, 0x5b, 0x5b, 0x5b, 0x59,
+  0x86, 0x1a, 0xc1, 0xad, 0x35, 0xc3, 0x0c, 0x35, 0xac, 0x58, 0xb4, 0xd0, 0x5a, 0xd0, 0xb4, 0x5a,
+  0x2d, 0xbf, 0xb7, 0xd8, 0x6d, 0x6d, 0x78, 0x6c, 0x6d, 0x7b, 0xfb, 0x9a, 0x6b, 0x2c, 0x0d, 0x31,
+  0x66, 0x80, 0x5f, 0xdd, 0xb6, 0x67, 0x8f, 0x37, 0xfd, 0x40, 0x19, 0x8c, 0xcd, 0xb3, 0x36, 0xcd,
+  0x99, 0x9b, 0x5e, 0xb3, 0x40, 0x3f, 0xc6, 0x46, 0xf1, 0x96, 0x68, 0x68, 0x2c, 0xb5, 0xad, 0x34,
+  0xd6, 0xb5, 0x83, 0x5a, 0xdb, 0xff, 0xbf, 0xff, 0xf4, 0x9a, 0xcc, 0x63, 0x19, 0xad, 0x83, 0x06,
+  0xb5, 0x96, 0x9a, 0x16, 0xb4, 0x2c, 0xb2, 0xc0, 0x32, 0xcd, 0x09, 0x08, 0xe3, 0x58, 0x6b, 0x03,
+  0x5a, 0xd6, 0xb5, 0x96, 0xb5, 0xac, 0x1a, 0xc6, 0xb3, 0x0c, 0x61, 0x8c, 0x00, 0x3b, 0xff, 0xf8,
+  0x6b, 0x6b, 0x6b, 0x6b, 0x66, 0x33, 0x33, 0x31, 0x8d, 0xff, 0xfe, 0xb4, 0xb1, 0xaf, 0x59, 0x83,
+  0x02, 0x30, 0x01, 0xb6, 0x33, 0x1b, 0x5b, 0x59, 0x83, 0x58, 0xb0, 0xef, 0xff, 0xb5, 0x80, 0x03,
+  0xfe, 0x58, 0xd6, 0x19, 0x7a, 0x65, 0xe9, 0x96, 0xd3, 0x03, 0x58, 0x03, 0x4d, 0x6b, 0x5a, 0xd6,
+  0x5b, 0x23, 0x28, 0x69, 0x81, 0xf7, 0xff, 0xff, 0x01, 0xad, 0x63, 0x58, 0xc3, 0x18, 0x66, 0x19,
+  0x86, 0x31, 0xac, 0x69, 0x96, 0x5b, 0xeb, 0x18, 0xd6, 0xd6, 0xb0, 0x00, 0xb5, 0xa0, 0x26, 0xec,
+  0x84, 0x17, 0x16, 0xe1, 0x8c, 0x66, 0x36, 0x33, 0x33, 0x7d, 0xf3, 0x5a, 0xd6, 0x59, 0xa6, 0xb0,
+  0x03, 0x42, 0xff, 0xe6, 0xd8, 0xf3, 0x67, 0x9d, 0xfd, 0x00, 0xc3, 0x36, 0x36, 0xcc, 0xf1, 0xe3,
+  0xc6, 0xc6, 0x63, 0x00, 0x7f, 0x0d, 0x0e, 0x98, 0x1a, 0xd6, 0x9a, 0x05, 0x96, 0xb4, 0xd6, 0xb5,
+  0xac, 0x1a, 0xc3, 0xff, 0xff, 0x77, 0xe3, 0x5e, 0xb1, 0x98, 0x6d, 0x66, 0x0c, 0x1a, 0x6b, 0x4d,
+  0x0b, 0x5a, 0x16, 0x59, 0x65, 0x86, 0xb2, 0xda, 0x06, 0x06, 0x1a, 0xc3, 0x58, 0x35, 0xac, 0xb1,
+  0x62, 0xc5, 0x83, 0x5a, 0xcd, 0x63, 0x0c, 0x61, 0x80, 0x00, 0xfb, 0xff, 0xed, 0x6b, 0xd3, 0x30,
+  0xda, 0xd8, 0xd8, 0xc6, 0xc3, 0x6e, 0xff, 0xff, 0x5a, 0x60, 0xc6, 0x60, 0xa0, 0x7b, 0x00, 0x07,
+  0xb6, 0x33, 0x19, 0xad, 0xac, 0x6b, 0x2c, 0x59, 0x7f, 0xf7, 0x6b, 0x00, 0x07, 0xdc, 0xd6, 0x1a,
+  0xc3, 0x2c, 0x6b, 0x03, 0x58, 0x35, 0xac, 0x2d, 0xa0, 0x68, 0xd3, 0x5b, 0x3b, 0x3f, 0x03, 0x58,
+  0x7f, 0xff, 0xf1, 0x83, 0x58, 0x6b, 0x6b, 0x35, 0xb5, 0x98, 0xc3, 0x61, 0x8c, 0x31, 0xad, 0x60,
+  0x3e, 0x98, 0xc6, 0x18, 0x0d, 0x34, 0x69, 0x65, 0xa0, 0xb4, 0xb4, 0x42, 0xfb, 0x8f, 0x76, 0xf5,
+  0x8c, 0xc6, 0x6d, 0x7a, 0xd9, 0x8d, 0xdf, 0xda, 0x6b, 0x2c, 0x69, 0x96, 0x1a, 0x34, 0x1f, 0xdf,
+  0x66, 0x6c, 0xf1, 0xe6, 0xdf, 0xfd, 0xc0, 0x6b, 0x6b, 0x36, 0x3c, 0x6d, 0x9e, 0xbc, 0xcd, 0x8d,
+  0x8c, 0x00, 0x3d, 0x86, 0xc7, 0xb5, 0x9a, 0xd6, 0x59, 0x64, 0xd0, 0xb2, 0xd6, 0xb5, 0xad, 0x60,
+  0x19, 0x6e, 0xff, 0xff, 0xdf, 0xc3, 0x18, 0xc6, 0x31, 0x8c, 0x35, 0x86, 0x8d, 0x02, 0xd6, 0x81,
+  0x65, 0xac, 0xb1, 0xa6, 0x0d, 0x03, 0x83, 0xb5, 0x86, 0xb0, 0x6b, 0x2c, 0x00, 0x00, 0x6b, 0x59,
+  0xac, 0x30, 0xc6, 0x1a, 0xc0, 0x01, 0xfd, 0xff, 0x58, 0x61, 0x8c, 0x6d, 0x6c, 0x66, 0x6b, 0xc3,
+  0x3f, 0xbf, 0xeb, 0x06, 0x30, 0x14, 0x0c, 0x00, 0x01, 0xf9, 0xb1, 0x8c, 0xc3, 0x06, 0x59, 0x64,
+  0xdf, 0xf7, 0xf6, 0xb0, 0x00, 0x1f, 0xc1, 0xac, 0x1a, 0xc3, 0x5a, 0xc3, 0x4c, 0x0d, 0x32, 0xc5,
+  0x80, 0x03, 0x5a, 0x7a, 0xb6, 0x03, 0x2f, 0xff, 0xef, 0x80, 0xd6, 0x35, 0xb5, 0x8c, 0x63, 0x18,
+  0xcc, 0x63, 0x0c, 0x65, 0x86, 0x8b, 0xfb, 0x31, 0x9a, 0xda, 0xc3, 0x5a, 0xcb, 0x2d, 0x34, 0x5a,
+  0xd1, 0x04, 0x43, 0xfb, 0xb9, 0x37, 0x71, 0x86, 0xd7, 0xad, 0x98, 0xd8, 0xda, 0xf7, 0x7f, 0xcd,
+  0x6b, 0x01, 0x96, 0x1a, 0x69, 0xa1, 0xff, 0xf1, 0xb3, 0x6c, 0xd9, 0xb6, 0xbf, 0xfe, 0x06, 0xb0,
+  0xd8, 0xd9, 0xb3, 0x67, 0xaf, 0x33, 0xd6, 0xcc, 0x60, 0x03, 0xee, 0xe1, 0xc2, 0x00, 0xd6, 0x00,
+  0xad, 0x78, 0xdd, 0x62, 0xd6, 0x5a, 0xc0, 0x19, 0x6f, 0xff, 0xef, 0xff, 0x98, 0xc3, 0x35, 0xeb,
+  0x30, 0xcd, 0x66, 0xb2, 0xc6, 0x81, 0x65, 0xa0, 0x5a, 0xcb, 0x58, 0x1a, 0xc1, 0x80, 0x60, 0x6d,
+  0x63, 0x58, 0x69, 0x80, 0x06, 0x83, 0x4d, 0x6b, 0x0d, 0x63, 0x06, 0x35, 0xb5, 0x80, 0x01, 0xfd,
+  0xff, 0xd8, 0xd6, 0x31, 0xaf, 0x5b, 0x5b, 0x19, 0x8c, 0xc6, 0x7f, 0xdf, 0xf6, 0x59, 0xad, 0xac,
+  0x09, 0x05, 0xc0, 0x00, 0x0f, 0xf3, 0x19, 0x8c, 0x30, 0xd6, 0xb5, 0xad, 0x17, 0xff, 0xda, 0xc0,
+  0x00, 0x1d, 0x58, 0x19, 0x63, 0x4c, 0x5b, 0x4d, 0x60, 0x1a, 0xd6, 0xb2, 0xcb, 0x16, 0x0d, 0xad,
+  0xb6, 0xb2, 0xda, 0x7f, 0xdf, 0xfc, 0xb0, 0x30, 0x61, 0x9a, 0xda, 0xd8, 0x66, 0x31, 0x98, 0xd7,
+  0xa6, 0x1a, 0x6b, 0x5f, 0xf3, 0x31, 0xb5, 0x9a, 0xcd, 0x60, 0x0b, 0x16, 0x82, 0xd1, 0x08, 0x4f,
+  0xbf, 0x9c, 0xbb, 0xda, 0xda, 0xda, 0xd9, 0x8c, 0xd8, 0xcc, 0xcd, 0xdf, 0xd3, 0x2c, 0x69, 0x80,
+  0x6b, 0x5a, 0x37, 0xff, 0x71, 0xb3, 0x67, 0x8f, 0x36, 0x7f, 0x7f, 0x0d, 0x31, 0x8f, 0x5b, 0x36,
+  0x6d, 0x99, 0xe3, 0x66, 0x63, 0x00, 0x1f, 0xff, 0xfe, 0x9c, 0xe3, 0xc4, 0x43, 0x01, 0xa5, 0xf6,
+  0xcc, 0xcc, 0xcb, 0xac, 0xb1, 0x60, 0x1a, 0xd6, 0xff, 0xff, 0xef, 0x98, 0x63, 0x18, 0xc6, 0x35,
+  0xeb, 0x0d, 0x62, 0xc0, 0x5a, 0xd0, 0x2c, 0xb5, 0x96, 0x06, 0xb0, 0x00, 0x00, 0x06, 0x19, 0x7a,
+  0x32, 0xc1, 0xa3, 0x4d, 0x35, 0xad, 0x65, 0xb4, 0xd6, 0x6b, 0x18, 0x31, 0xa0, 0x00, 0x7f, 0xdf,
+  0xc6, 0xb1, 0x86, 0x31, 0x98, 0xcc, 0x63, 0x33, 0xff, 0xee, 0x58, 0xd6, 0x6b, 0x05, 0x02, 0xe0,
+  0x00, 0x03, 0xde, 0xcc, 0x63, 0x1a, 0xcd, 0x35, 0xa6, 0x8b, 0x7f, 0xf7, 0x60, 0x00, 0x00, 0x7c,
+  0x6b, 0x00, 0xcb, 0x03, 0x5a, 0x2f, 0x58, 0xcc, 0x93, 0x59, 0x65, 0x9c, 0x1c, 0x26, 0xb5, 0x8e,
+  0xff, 0xff, 0xe5, 0xd6, 0x58, 0xd6, 0x18, 0x66, 0xb6, 0xb6, 0x1b, 0x5e, 0xb3, 0x30, 0xcd, 0x63,
+  0x5a, 0xcb, 0x7f, 0xf6, 0xb3, 0x31, 0x8d, 0x7a, 0xd6, 0xd1, 0xa6, 0x80, 0x9a, 0x5a, 0x58, 0x03,
+  0xfb, 0xe7, 0x36, 0xfb, 0x0c, 0xd7, 0x8c, 0xcc, 0xcc, 0xcc, 0xce, 0xfe, 0xb2, 0xc6, 0xb2, 0xcd,
+  0x35, 0xad, 0x69, 0x7f, 0xfc, 0xd8, 0xf1, 0xe6, 0xd9, 0x9e, 0x7f, 0xff, 0x43, 0x58, 0xc7, 0xad,
+  0x9b, 0x66, 0x6d, 0x9b, 0x33, 0x31, 0x80, 0x1f, 0xf7, 0xff, 0xff, 0x66, 0xf8, 0xf9, 0x1e, 0xb0,
+  0x6b, 0x5b, 0xfe, 0x6b, 0xc7, 0xad, 0x98, 0xce, 0xfb, 0x05, 0x86, 0x8d, 0x6f, 0xbf, 0xff, 0xfc,
+  0x8c, 0x19, 0xaf, 0x58, 0xcc, 0x31, 0xad, 0xa6, 0xb2, 0xc2, 0xd6, 0x9a, 0x2c, 0xb2, 0xd6, 0xb0,
+  0x68, 0x00, 0x00, 0x00, 0x1e, 0xb1, 0xad, 0x60, 0x34, 0xd6, 0xb5, 0xad, 0x62, 0xcd, 0x35, 0x9a,
+  0xc1, 0x9a, 0xc3, 0x00, 0x03, 0xff, 0xba, 0x61, 0xac, 0xc6, 0xb6, 0x31, 0x8c, 0xc6, 0x37, 0xff,
+  0x7f, 0x60, 0x60, 0xc1, 0x40, 0xc0, 0x00, 0x00, 0xff, 0xc6, 0x33, 0x5b, 0x58, 0x34, 0xd0, 0x4d,
+  0xfd, 0xf1, 0x80, 0x00, 0x00, 0x50, 0x34, 0xd6, 0xa6, 0xb0, 0xd7, 0xac, 0xc6, 0x32, 0xa6, 0x99,
+  0x6e, 0x7e, 0x7c, 0xd3, 0x59, 0xff, 0xff, 0xd5, 0xad, 0x6b, 0x0d, 0x66, 0xb3, 0x5e, 0xb1, 0x9a,
+  0xf5, 0xb1, 0x98, 0xc6, 0x6b, 0x19, 0x60, 0xfe, 0xfb, 0x63, 0x31, 0x98, 0x61, 0xad, 0x65, 0x96,
+  0x80, 0x84, 0x00, 0x3b, 0xfe, 0xb9, 0xf8, 0x0c, 0x6b, 0xd7, 0xad, 0x98, 0xd9, 0x99, 0x8d, 0xbb,
+  0xff, 0xb0, 0x19, 0x6d, 0x1a, 0xcb, 0x5a, 0xdf, 0xff, 0xdd, 0xe3, 0x66, 0xcf, 0x1e, 0x6c, 0xd7,
+  0xff, 0xf0, 0xd6, 0x33, 0x1e, 0xbc, 0xcd, 0xb3, 0x66, 0xcc, 0xcc, 0x60, 0x07, 0xff, 0xff, 0x93,
+  0x5c, 0x84, 0x97, 0x59, 0xac, 0xb3, 0xfe, 0xb3, 0x33, 0x63, 0x63, 0x1a, 0xfe, 0x00, 0x69, 0x87,
+  0xff, 0xff, 0xab, 0x5a, 0xf5, 0x86, 0xd6, 0xd6, 0x63, 0x0d, 0x63, 0x5a, 0xcb, 0x5a, 0xd3, 0x45,
+  0x8b, 0x5a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcd, 0x32, 0xcd, 0x1a, 0xd6, 0xb2, 0xcb, 0x00,
+  0xd6, 0x0c, 0x18, 0x30, 0xc0, 0x00, 0xff, 0xef, 0xb5, 0x8c, 0xbd, 0x63, 0x0c, 0xc6, 0x6b, 0x63,
+  0x5e, 0xbf, 0xef, 0x96, 0x6b, 0x5b, 0x58, 0x30, 0x1f, 0x00, 0x00, 0x03, 0xfd, 0x99, 0x86, 0x6b,
+  0x00, 0x04, 0x1f, 0xf4, 0xc0, 0x00, 0x00, 0x00, 0xfa, 0x6b, 0x5b, 0x4c, 0x6b, 0x6b, 0x6b, 0x6b,
+  0xd6, 0xc7, 0x70, 0xd3, 0x76, 0xf7, 0x01, 0xaf, 0xff, 0xee, 0x8d, 0x65, 0xb5, 0xad, 0xac, 0xd6,
+  0xc3, 0x31, 0x98, 0xd8, 0x6d, 0x6d, 0x6d, 0x30, 0x37, 0xf7, 0xf6, 0x63, 0x33, 0x18, 0xc3, 0x00,
+  0x16, 0x5a, 0x2d, 0x00, 0x01, 0xff, 0xfd, 0xba, 0x38, 0x46, 0x31, 0xb1, 0x9b, 0x31, 0xb3, 0x1e,
+  0xb7, 0x7f, 0xf6, 0x1a, 0xc0, 0xd6, 0x59, 0x6b, 0x7f, 0xf7, 0xc6, 0x6c, 0xdb, 0x36, 0x6d, 0xb1,
+  0xfd, 0xff, 0x35, 0xad, 0xaf, 0x5b, 0x33, 0xd7, 0x9b, 0x36, 0x6c, 0xcc, 0xcc, 0x00, 0xff, 0xfb,
+  0xff, 0xad, 0x02, 0x32, 0x7c, 0x32, 0xc7, 0xdf, 0xd9, 0xeb, 0x66, 0x6c, 0x66, 0x30, 0xfe, 0x41,
+  0xa0, 0x3f, 0xfb, 0xf8, 0xc1, 0x98, 0x63, 0x30, 0xd7, 0xa6, 0x0d, 0x6b, 0x5a, 0x68, 0x0b, 0x2d,
+  0x6b, 0x58, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1a, 0xd6, 0x34, 0x6b, 0x2c, 0xb0, 0x03, 0x5a, 0xc6,
+  0xb0, 0x61, 0xac, 0x00, 0x01, 0xff, 0xf7, 0x61, 0x96, 0xd6, 0x6b, 0xd3, 0x6b, 0x6b, 0x33, 0x5b,
+  0x5b, 0x7f, 0xdf, 0xc0, 0x60, 0xc1, 0xa1, 0x30, 0x00, 0x00, 0x1f, 0xbd, 0x8c, 0x60, 0xc0, 0x58,
+  0x82, 0x3f, 0x80, 0x00, 0x00, 0x00, 0xfe, 0x18, 0x18, 0x33, 0x5e, 0xb1, 0xb5, 0xeb, 0x35, 0xfc,
+  0x34, 0xf5, 0xf5, 0xd6, 0x1b, 0xff, 0xfb, 0xe8, 0xd3, 0x2c, 0xd6, 0x30, 0xc6, 0x63, 0x1b, 0x5e,
+  0xbd, 0x6d, 0x7a, 0xda, 0xcd, 0x61, 0xa3, 0xff, 0xe6, 0x36, 0x36, 0xbd, 0x66, 0x35, 0x8d, 0x35,
+  0xa3, 0x76, 0x20, 0x00, 0x03, 0xff, 0xe7, 0x4f, 0x10, 0x63, 0x6b, 0xd6, 0xcd, 0x8d, 0x8d, 0x98,
+  0xdb, 0xfb, 0xf8, 0xd6, 0xb6, 0x9a, 0xd6, 0x2c, 0xbb, 0xff, 0xec, 0x66, 0xcd, 0x9e, 0x67, 0x8f,
+  0x33, 0xff, 0xfb, 0x9a, 0xc6, 0x66, 0x66, 0xd9, 0xb3, 0x66, 0xcc, 0xda, 0xd8, 0x02, 0xff, 0xff,
+  0xf1, 0xb6, 0x49, 0x29, 0x4e, 0x6b, 0x0d, 0xdf, 0xff, 0x7a, 0xdb, 0x1b, 0x33, 0x31, 0xb5, 0x8c,
+  0xef, 0xe0, 0x01, 0xdf, 0xff, 0xc3, 0x0c, 0x63, 0x1a, 0xf5, 0x9a, 0xcd, 0x60, 0x69, 0xa6, 0x81,
+  0x65, 0x96, 0xb5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x5a, 0xc0, 0x35, 0xac, 0x58, 0x06, 0x99,
+  0x63, 0x5a, 0xcd, 0x61, 0xac, 0x00, 0x01, 0xff, 0xfc, 0x1a, 0xc6, 0x0c, 0xd6, 0xd6, 0x63, 0x0c,
+  0xc7, 0x7f, 0xf0, 0x6b, 0x58, 0xc2, 0x01, 0x6c, 0x00, 0x00, 0x07, 0xef, 0x63, 0x35, 0x8d, 0x62,
+  0xcb, 0x5a, 0x5a, 0x5a, 0x80, 0x00, 0x00, 0x05, 0xf0, 0xc0, 0xc3, 0x18, 0x6d, 0x6d, 0x7a, 0xd8,
+  0xdf, 0x2d, 0xaf, 0xcf, 0xcd, 0x61, 0xdf, 0xff, 0xda, 0x1a, 0x60, 0x63, 0x0c, 0x66, 0x33, 0x31,
+  0x99, 0x9a, 0xf5, 0x9a, 0xc6, 0xb5, 0xbf, 0xfe, 0x8f, 0x5b, 0x31, 0x99, 0x8d, 0x6d, 0x32, 0xc2,
+  0xd3, 0x56, 0x00, 0x00, 0x3f, 0xef, 0xba, 0xb8, 0xec, 0x63, 0x1b, 0x1b, 0x36, 0x36, 0x36, 0x63,
+  0x7f, 0x7f, 0x6b, 0x59, 0xa6, 0x58, 0x58, 0xff, 0xff, 0xc9, 0xda, 0xf5, 0xe6, 0x6c, 0xf3, 0x3c,
+  0x79, 0x8f, 0xff, 0xf9, 0x63, 0x0c, 0xcc, 0xcd, 0xb3, 0x66, 0xcf, 0x5e, 0xbc, 0x60, 0x03, 0xff,
+  0xfb, 0xff, 0xb3, 0x04, 0x9c, 0xaf, 0x6b, 0x1a, 0xdf, 0xfd, 0xf6, 0xc7, 0xaf, 0x1b, 0x1b, 0x19,
+  0xad, 0xac, 0x00, 0x07, 0xff, 0xf7, 0x1a, 0xda, 0xcd, 0x6c, 0x31, 0x8d, 0x6d, 0x30, 0x0d, 0x00,
+  0x59, 0x6b, 0x5a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x35, 0x80, 0xd6, 0xb1, 0x60, 0x34, 0xd6,
+  0x06, 0xb0, 0x60, 0xd6, 0x00, 0x01, 0x7f, 0xfc, 0x32, 0xda, 0xc3, 0x0c, 0x61, 0x98, 0x63, 0x1f,
+  0xff, 0x43, 0x5a, 0xc6, 0x12, 0x0d, 0x60, 0x00, 0x00, 0x1f, 0xed, 0x8c, 0x60, 0xd6, 0xb5, 0xa0,
+  0xb5, 0x69, 0x00, 0x00, 0x00, 0x0e, 0xe1, 0x83, 0x5b, 0x58, 0xc6, 0x33, 0x5e, 0x19, 0x80, 0xff,
+  0xff, 0x03, 0xfe, 0xfe, 0x83, 0x4d, 0x66, 0xb0, 0xcc, 0x33, 0x19, 0x99, 0x98, 0xcc, 0xc3, 0x06,
+  0x5b, 0xfe, 0xfe, 0xcc, 0xcc, 0xcc, 0x6c, 0x33, 0x58, 0x00, 0x24, 0x00, 0x00, 0x3f, 0xbf, 0xbb,
+  0x39, 0x18, 0x63, 0x33, 0x63, 0x66, 0xc6, 0xcc, 0x7a, 0xdb, 0xff, 0xbe, 0xd6, 0x69, 0x8b, 0x02,
+  0xff, 0xfb, 0x8c, 0xcf, 0x5e, 0x66, 0xf5, 0xec, 0x79, 0x9b, 0xfb, 0xff, 0xe6, 0x19, 0x99, 0x9e,
+  0xbc, 0xd9, 0xb6, 0x66, 0x66, 0x00, 0x77, 0xff, 0xff, 0x7e, 0x2e, 0xca, 0x4b, 0x8c, 0x6b, 0x5f,
+  0xff, 0xcc, 0xd8, 0xd9, 0xb1, 0x99, 0x8c, 0x30, 0x00, 0x1f, 0xdf, 0xfc, 0x30, 0xc6, 0x30, 0xda,
+  0xc6, 0x0d, 0x60, 0x00, 0x59, 0x6b, 0x5a, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe6, 0xb0, 0x0d,
+  0x65, 0x80, 0x6b, 0x5a, 0xc1, 0xac, 0x1a, 0xc6, 0xb0, 0x00, 0x07, 0x7f, 0xf3, 0x5a, 0xda, 0xd6,
+  0xd6, 0x35, 0xb5, 0x9a, 0xda, 0xda, 0xcd, 0x6f, 0xbf, 0xe6, 0x9a, 0xc0, 0x2c, 0x21, 0x98, 0x00,
+  0x00, 0x07, 0xfb, 0xc3, 0x18, 0x1a, 0x68, 0x5a, 0x21, 0x16, 0xa0, 0x00, 0x00, 0x7d, 0x1a, 0xc3,
+  0x0c, 0x33, 0x5b, 0x0d, 0x86, 0xc0, 0x3f, 0xff, 0xc0, 0xff, 0xfb, 0xed, 0x03, 0x58, 0x31, 0xad,
+  0x86, 0x66, 0x33, 0x6b, 0xc6, 0x36, 0xb6, 0xb6, 0x98, 0xbb, 0xff, 0x9b, 0x5e, 0x33, 0x36, 0xbd,
+  0x7a, 0xc6, 0x0d, 0x6b, 0x5a, 0x5c, 0xd6, 0x00, 0x00, 0x77, 0xff, 0x76, 0xf2, 0x98, 0x66, 0x66,
+  0x66, 0xcc, 0xd8, 0xf5, 0xeb, 0x66, 0x7f, 0xfd, 0x06, 0xb0, 0x2c, 0x7f, 0xdf, 0xfd, 0xaf, 0x19,
+  0xb3, 0x6c, 0xdb, 0x3d, 0x79, 0x9b, 0x7f, 0xff, 0xd0, 0xfd, 0x86, 0x66, 0x6c, 0xcf, 0x1e, 0x66,
+  0xcc, 0xcc, 0x00, 0xff, 0xff, 0xf5, 0xf8, 0x5a, 0x15, 0x98, 0x31, 0xac, 0xfe, 0xff, 0xed, 0x99,
+  0x9b, 0x31, 0xeb, 0xd6, 0xc3, 0x1a, 0xc0, 0x00, 0xff, 0xff, 0xf5, 0x1a, 0xda, 0xcd, 0x7a, 0xc6,
+  0x30, 0xc1, 0xac, 0x16, 0x05, 0x96, 0xb5, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x35, 0x80,
+  0x6b, 0x58, 0x03, 0x5a, 0xc0, 0xd6, 0x5e, 0x98, 0x18, 0x00, 0x01, 0xf7, 0xfc, 0xd6, 0x35, 0x86,
+  0x1a, 0xda, 0xcd, 0x66, 0x18, 0xc7, 0xff, 0xd3, 0x5a, 0xcb, 0xd0, 0xc8, 0xa5, 0xb4, 0x00, 0x00,
+  0x03, 0xff, 0x63, 0x5b, 0x58, 0x00, 0xb4, 0x42, 0x11, 0x69, 0x00, 0x00, 0x3f, 0x86, 0xb1, 0xad,
+  0xac, 0x33, 0x0d, 0xad, 0x8c, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0xd9, 0x00, 0xcb, 0x32, 0xf5,
+  0x8c, 0xc6, 0x63, 0x66, 0x36, 0x33, 0x1a, 0xf4, 0xc2, 0xff, 0xff, 0x4d, 0xd8, 0xcd, 0x8d, 0x98,
+  0xda, 0xda, 0xda, 0xd6, 0x0b, 0x3e, 0xec, 0x30, 0x00, 0x02, 0xff, 0xfb, 0xbb, 0x98, 0x63, 0x1b,
+  0x1b, 0x36, 0x66, 0x7a, 0xdb, 0x5e, 0xbd, 0x7a, 0xff, 0xfe, 0x35, 0xac, 0x01, 0xf7, 0xff, 0xf3,
+  0x19, 0x9e, 0xbc, 0xcf, 0x36, 0x6d, 0x9b, 0x5e, 0xbf, 0xff, 0xe9, 0x6c, 0xd7, 0xad, 0xb5, 0xe6,
+  0xcd, 0x9b, 0x3d, 0x6d, 0xaf, 0x00, 0x3e, 0xff, 0xff, 0xee, 0xc2, 0xb8, 0xb8, 0xcd, 0x8c, 0x3f,
+  0xff, 0xa3, 0x63, 0xd7, 0x8d, 0x8d, 0xaf, 0x5b, 0x59, 0xac, 0x00, 0x0f, 0xfe, 0xfe, 0x35, 0x9a,
+  0xda, 0xcc, 0x61, 0x8d, 0x63, 0x5a, 0xc5, 0x85, 0x96, 0xb5, 0xad, 0x68, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x79, 0xac, 0x03, 0x5a, 0xc5, 0xe8, 0x6b, 0x2c, 0xd3, 0x58, 0x6b, 0x06, 0xb0, 0x00, 0x07,
+  0xfd, 0xd6, 0x0d, 0x63, 0x2f, 0x4c, 0xd6, 0x30, 0xc3, 0x35, 0xaf, 0xff, 0x9a, 0xd6, 0x01, 0xd1,
+  0x7c, 0x00, 0x00, 0x00, 0x7b, 0xf3, 0x6b, 0x0c, 0xb0, 0xb2, 0x16, 0xad, 0x11, 0x69, 0x6b, 0x4d,
+  0x00, 0x17, 0xc3, 0x2d, 0xac, 0x61, 0x86, 0xd6, 0x66, 0x30, 0x03, 0xff, 0xfc, 0x0f, 0xff, 0xff,
+  0x50, 0x0d, 0x6b, 0x6b, 0x0c, 0xd7, 0xac, 0xda, 0xd9, 0x99, 0x99, 0x8c, 0xc3, 0x03, 0xff, 0xfd,
+  0x36, 0xd8, 0xd9, 0x99, 0x99, 0x98, 0xc6, 0x5e, 0x86, 0x9f, 0x73, 0x00, 0x00, 0x01, 0xff, 0xfd,
+  0xdf, 0xcd, 0x9a, 0xc6, 0xd7, 0xaf, 0x1e, 0xbc, 0xcc, 0xd9, 0xb1, 0x99, 0xaf, 0xff, 0xe6, 0xb0,
+  0x01, 0xff, 0xff, 0xca, 0x36, 0xbd, 0x79, 0x9b, 0x6c, 0xd9, 0xb6, 0x6c, 0x6f, 0xef, 0xff, 0xad,
+  0x8c, 0xcc, 0xf1, 0xb6, 0xc7, 0x99, 0x98, 0x00, 0xff, 0xff, 0xf5, 0xfe, 0xcd, 0x53, 0x98, 0x1a,
+  0xe3, 0x58, 0xff, 0xff, 0x66, 0xd7, 0xaf, 0x1b, 0x1e, 0xbc, 0x66, 0x33, 0x06, 0x00, 0x07, 0x7f,
+  0xff, 0x0c, 0x30, 0xc6, 0x6b, 0x6b, 0x19, 0x6d, 0x35, 0x96, 0x2d, 0x65, 0xad, 0x35, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xda, 0xcb, 0x03, 0x5a, 0xd6, 0x1a, 0x6b, 0x01, 0xac, 0x35, 0xad, 0xa6,
+  0xb0, 0x00, 0x07, 0xff, 0x56, 0x35, 0xac, 0xd6, 0x18, 0x6b, 0x6b, 0x0c, 0xd6, 0x6b, 0x7d, 0xfd,
+  0x6b, 0x2c, 0x10, 0x8e, 0x5a, 0xf4, 0x00, 0x00, 0x03, 0xf7, 0xeb, 0x32, 0xf4, 0xd6, 0xb5, 0xa1,
+  0x37, 0x68, 0x84, 0x2d, 0x34, 0x06, 0x82, 0xfe, 0xcd, 0x61, 0x86, 0x18, 0xc6, 0x33, 0x5e, 0xbd,
+  0x00, 0xff, 0xff, 0x05, 0xff, 0xff, 0xe8, 0x00, 0xd6, 0x35, 0x98, 0x66, 0x36, 0xbc, 0x66, 0xc6,
+  0x6d, 0x6c, 0x35, 0x9a, 0xff, 0xfe, 0xad, 0x98, 0xf1, 0x9b, 0x31, 0x99, 0xac, 0x6b, 0x2d, 0x5f,
+  0xc3, 0x58, 0x00, 0x00, 0x7f, 0xfd, 0xe1, 0xcf, 0x86, 0x33, 0x1e, 0xbc, 0xcd, 0x99, 0xeb, 0xc6,
+  0xc6, 0x67, 0x7f, 0xf5, 0x80, 0x1b, 0xff, 0xff, 0xba, 0x35, 0xe3, 0x36, 0xcd, 0x9e, 0x3c, 0xd9,
+  0xb1, 0xb7, 0xff, 0xfd, 0x8f, 0xc6, 0x66, 0x6c, 0xd9, 0xb3, 0x66, 0xcc, 0xc0, 0x0f, 0xef, 0xff,
+  0xfe, 0xe0, 0xd4, 0x46, 0x67, 0x18, 0xc3, 0xbf, 0xff, 0x8d, 0x99, 0x9b, 0x1b, 0x31, 0x98, 0xc6,
+  0xb0, 0x00, 0x3f, 0xff, 0xb8, 0xd6, 0xd6, 0x31, 0x86, 0x6b, 0x35, 0x83, 0x5a, 0xd6, 0x5a, 0xd6,
+  0xb5, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xb5, 0x96, 0x01, 0xad, 0x60, 0xd6, 0xb0, 0x35,
+  0x83, 0x58, 0x6b, 0x58, 0x00, 0x03, 0xff, 0xe5, 0x9a, 0xd6, 0x35, 0x8d, 0x63, 0x2f, 0x5a, 0xda,
+  0xcd, 0x6d, 0x67, 0xdf, 0xf6, 0xb2, 0xc1, 0x31, 0x03, 0x2f, 0x40, 0x00, 0x00, 0x3f, 0xf3, 0x1a,
+  0xc3, 0x46, 0x96, 0x44, 0x12, 0xd1, 0x68, 0x06, 0x83, 0x4d, 0xff, 0x71, 0xad, 0xad, 0x7a, 0xc3,
+  0x35, 0xb5, 0xb0, 0xda, 0xd8, 0x07, 0xff, 0xf8, 0x3b, 0xff, 0xf8, 0x01, 0xac, 0x6b, 0x30, 0xcc,
+  0xc6, 0x6c, 0xc7, 0xad, 0x98, 0xc6, 0xb3, 0x5f, 0xfd, 0xfc, 0xcc, 0xcd, 0x8d, 0x99, 0x9b, 0x5b,
+  0x5b, 0x5a, 0xc0, 0xff, 0xeb, 0x1a, 0xc0, 0x00, 0x03, 0xff, 0xbc, 0x3a, 0x16, 0x61, 0xb1, 0xb3,
+  0x66, 0xcd, 0x99, 0xb1, 0xb3, 0x1b, 0xfe, 0xfe, 0x5e, 0x83, 0x5f, 0xff, 0x7f, 0x59, 0x8c, 0xd9,
+  0x9e, 0x3c, 0xdb, 0x36, 0xd7, 0x98, 0x7f, 0xff, 0xda, 0xb1, 0x99, 0x9e, 0x36, 0xd8, 0xf1, 0xb0,
+  0x00, 0xff, 0xff, 0xf4, 0xe3, 0x5a, 0x70, 0xd8, 0xef, 0x18, 0xdf, 0xfd, 0xff, 0x1b, 0x1b, 0x33,
+  0x33, 0x6b, 0xd7, 0xac, 0xc1, 0x80, 0x03, 0xbe, 0xef, 0x9a, 0xc6, 0x30, 0xc6, 0x30, 0x65, 0xe8,
+  0xd3, 0x5a, 0xd6, 0xb5, 0xa6, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x5a, 0xd6, 0x58, 0x35,
+  0xac, 0x0d, 0x60, 0x32, 0xcd, 0x6b, 0x1a, 0xd6, 0x00, 0x00, 0xbf, 0xfa, 0xcd, 0x30, 0x6b, 0x1a,
+  0xc6, 0xb3, 0x58, 0x63, 0x5b, 0x59, 0xf7, 0xf2, 0xcb, 0x0a, 0xc9, 0x4c, 0x00, 0x00, 0x00, 0x7b,
+  0xf6, 0xb3, 0x59, 0x60, 0x2d, 0x13, 0x76, 0x88, 0x26, 0x8b, 0x03, 0x46, 0xb5, 0xbf, 0xf9, 0x63,
+  0x5b, 0x58, 0xc3, 0x19, 0xad, 0x8c, 0xc0, 0x3f, 0xff, 0xc1, 0xf7, 0xff, 0xda, 0x59, 0xa3, 0x06,
+  0x19, 0x8c, 0x6c, 0xc7, 0xaf, 0x19, 0xb5, 0xeb, 0x30, 0x3e, 0xff, 0xfe, 0xcc, 0xda, 0xf1, 0xeb,
+  0xc6, 0xcc, 0x6d, 0x6d, 0x61, 0xa6, 0xfe, 0xfe, 0x60, 0xd6, 0x00, 0x00, 0x7f, 0xde, 0x3d, 0x36,
+  0xb6, 0xb6, 0x33, 0x66, 0x78, 0xdb, 0x36, 0x3d, 0x7a, 0xd9, 0x8f, 0xef, 0x80, 0x1f, 0xff, 0xdd,
+  0x66, 0x36, 0x36, 0xcd, 0xb3, 0x6c, 0xf5, 0xe3, 0x63, 0x7f, 0xdf, 0xfd, 0x66, 0x66, 0xcd, 0x9b,
+  0x36, 0x6c, 0x00, 0x1f, 0xf7, 0xff, 0xf6, 0x98, 0x97, 0x39, 0x3e, 0xcc, 0x1f, 0xfd, 0xff, 0x66,
+  0x6d, 0x78, 0xd9, 0x98, 0xf5, 0x99, 0xac, 0xd6, 0x00, 0x7f, 0x2c, 0x5f, 0xd6, 0x19, 0xad, 0xad,
+  0xac, 0xd6, 0x35, 0x83, 0x4d, 0x69, 0xad, 0x34, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x5a,
+  0x6b, 0x2c, 0x06, 0xb2, 0xda, 0x6b, 0x0d, 0x65, 0xe9, 0xac, 0x35, 0x80, 0x00, 0x0e, 0xff, 0xec,
+  0x6b, 0x59, 0xa6, 0x1a, 0xc6, 0xb0, 0xc1, 0x8c, 0x31, 0x7f, 0xfd, 0xac, 0xb1, 0x81, 0x51, 0xac,
+  0x00, 0x00, 0x00, 0xff, 0xc3, 0x34, 0xcb, 0x2d, 0x35, 0x68, 0xb5, 0x68, 0x4d, 0x58, 0x00, 0x69,
+  0x96, 0x7f, 0xf0, 0xd7, 0xa6, 0x6b, 0x30, 0xc6, 0x63, 0x00, 0x3f, 0xff, 0xc1, 0xf7, 0xff, 0xc0,
+  0x34, 0xc1, 0x86, 0x63, 0x31, 0xeb, 0xd7, 0x8d, 0x98, 0xf5, 0x8c, 0x37, 0xdf, 0xff, 0xe9, 0x18,
+  0xcd, 0x8f, 0x5e, 0x3d, 0x7a, 0xf1, 0x98, 0xc6, 0xb5, 0x97, 0xff, 0x5a, 0xd6, 0x6b, 0x00, 0x00,
+  0x3f, 0xbc, 0xba, 0x59, 0x7a, 0xcc, 0xcd, 0x8f, 0x36, 0x6c, 0xcf, 0x5e, 0xbc, 0x66, 0x00, 0x07,
+  0xff, 0xf7, 0xda, 0xf5, 0xb1, 0xb3, 0x66, 0xd9, 0xb6, 0xcc, 0xd8, 0xda, 0xdf, 0xff, 0xdf, 0x5e,
+  0x33, 0x66, 0x78, 0xf1, 0xeb, 0xc0, 0x01, 0xff, 0xff, 0xe6, 0xb2, 0xc9, 0x23, 0xc4, 0x21, 0x9a,
+  0xff, 0xfe, 0xfb, 0x1b, 0x33, 0x33, 0x63, 0x63, 0x1b, 0x58, 0xc0, 0x3b, 0x8b, 0x01, 0xfd, 0x32,
+  0xf5, 0x98, 0x63, 0x2f, 0x4c, 0x06, 0x8d, 0x34, 0xd3, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c,
+  0xd6, 0x9a, 0xd6, 0x58, 0x6b, 0x58, 0x6b, 0x03, 0x2d, 0xa6, 0x06, 0x58, 0x00, 0x01, 0xfd, 0xf0,
+  0xd6, 0x06, 0x06, 0x0d, 0x63, 0x59, 0xac, 0x63, 0x5b, 0x5f, 0xff, 0x59, 0x63, 0x62, 0xfc, 0xd6,
+  0xb6, 0x00, 0x00, 0x03, 0xdf, 0x8d, 0x66, 0x9a, 0x68, 0x20, 0x8b, 0x4b, 0x41, 0x62, 0xc1, 0xa6,
+  0xb2, 0xc3, 0xff, 0x98, 0x61, 0x86, 0x6b, 0x61, 0xb5, 0xb0, 0x0f, 0xff, 0xf0, 0x7d, 0xff, 0xf6,
+  0x80, 0x6b, 0x0c, 0x6b, 0xd6, 0x66, 0x66, 0xc6, 0xcd, 0x8c, 0xc6, 0x1a, 0xff, 0xff, 0x48, 0xf5,
+  0xb3, 0x1b, 0x63, 0x6c, 0x6c, 0xcc, 0x63, 0x58, 0x3b, 0xff, 0x83, 0x2f, 0x58, 0x00, 0xed, 0x98,
+  0xfe, 0xf2, 0xea, 0x9a, 0xf5, 0x8d, 0x99, 0xb6, 0x67, 0x8f, 0x1e, 0xbc, 0x6c, 0x60, 0x00, 0x7f,
+  0xff, 0xfb, 0x76, 0x31, 0xb1, 0xe3, 0xcd, 0x9e, 0x3c, 0xcd, 0x98, 0xc7, 0xff, 0xfe, 0x3e, 0x66,
+  0xc7, 0x8d, 0xb3, 0x66, 0x00, 0x0f, 0xfe, 0xff, 0xe5, 0x82, 0x35, 0x01, 0x17, 0x31, 0xaf, 0xff,
+  0xf7, 0x1d, 0x6c, 0x6c, 0x6c, 0xcc, 0xcc, 0xc6, 0x31, 0xac, 0x3e, 0xac, 0x2c, 0x34, 0x5f, 0xd8,
+  0x66, 0xb6, 0xb3, 0x58, 0xd6, 0x00, 0xd1, 0xa6, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1a,
+  0x69, 0xad, 0x6b, 0x03, 0x58, 0x35, 0x86, 0xb0, 0xd6, 0x1a, 0xd6, 0x6a, 0x00, 0x03, 0xfe, 0xe1,
+  0xac, 0x19, 0x66, 0xb5, 0x8d, 0x61, 0x83, 0x0c, 0x61, 0xbf, 0xfe, 0xac, 0x3b, 0x35, 0x0d, 0x66,
+  0x00, 0x00, 0x03, 0xff, 0x2f, 0x5a, 0xc0, 0xdd, 0x88, 0x22, 0xd2, 0xd0, 0x2d, 0x62, 0xcd, 0x19,
+  0x60, 0x1f, 0xfd, 0x9a, 0xcd, 0x6d, 0x63, 0x35, 0xb1, 0x80, 0x1f, 0xff, 0xe0, 0xef, 0xff, 0xe0,
+  0x0d, 0x65, 0xeb, 0x0c, 0xc6, 0x66, 0xc6, 0xd8, 0xd8, 0xd8, 0xd7, 0xa6, 0xff, 0xff, 0x49, 0x99,
+  0x99, 0x9b, 0x33, 0x66, 0x6c, 0x6d, 0x6d, 0x61, 0xa7, 0xf7, 0xf2, 0xcd, 0x63, 0x01, 0x73, 0x36,
+  0x3d, 0x7b, 0xcf, 0xa8, 0xd6, 0xd6, 0xc6, 0xcd, 0x9e, 0xbc, 0xdb, 0x1e, 0x36, 0x63, 0x30, 0x00,
+  0xff, 0xff, 0xf5, 0xb1, 0x8d, 0x99, 0xeb, 0xcd, 0x9e, 0x66, 0xd8, 0xf5, 0xb5, 0x9f, 0x7f, 0xff,
+  0x33, 0x36, 0x6c, 0xd9, 0x9b, 0x00, 0x07, 0xff, 0xff, 0x98, 0x0d, 0x12, 0x88, 0x93, 0x98, 0x3f,
+  0xff, 0xdc, 0xf6, 0x33, 0x36, 0x33, 0xd6, 0xc6, 0xc6, 0xbd, 0x63, 0x1f, 0x7f, 0xff, 0x6b, 0x58,
+  0x03, 0x46, 0xbe, 0x98, 0xc3, 0x18, 0x18, 0xb1, 0xa1, 0xa1, 0xa6, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xd1, 0xa6, 0x8d, 0x35, 0xac, 0x1a, 0xc6, 0xb5, 0x9a, 0xc0, 0xc1, 0x96, 0x35, 0xf4, 0x00,
+  0x0f, 0xff, 0x8d, 0x6b, 0x0d, 0x60, 0x65, 0xb4, 0xc1, 0x83, 0x0c, 0xd7, 0xa6, 0xfe, 0xfe, 0xb2,
+  0x09, 0xd8, 0x18, 0xc0, 0x00, 0x00, 0xfd, 0xb0, 0xd6, 0x58, 0xb5, 0xa2, 0x6e, 0xd6, 0xad, 0x05,
+  0xad, 0x65, 0x83, 0x5a, 0xc0, 0xd6, 0xaf, 0xe6, 0x18, 0xc3, 0x18, 0xcc, 0x00, 0xff, 0xff, 0x07,
+  0x7f, 0xff, 0x68, 0x0d, 0x65, 0xeb, 0x0c, 0xc6, 0xd7, 0x8d, 0xb1, 0xb3, 0x33, 0x35, 0xe9, 0xbf,
+  0xff, 0xd2, 0xbe, 0x33, 0x33, 0x66, 0x6c, 0xd9, 0x99, 0x98, 0xc3, 0x5a, 0xdf, 0xff, 0x7c, 0xc1,
+  0xad, 0x82, 0xfe, 0xd9, 0x9b, 0x1e, 0xbd, 0xe5, 0xd5, 0x69, 0x98, 0xcd, 0x9b, 0x36, 0xcd, 0xb3,
+  0x36, 0x66, 0x6b, 0xd0, 0x00, 0xff, 0xff, 0xf4, 0x63, 0x33, 0x33, 0x6c, 0xdb, 0x36, 0xcc, 0xd9,
+  0x8d, 0x7a, 0xff, 0xfb, 0xfb, 0x63, 0x66, 0xcc, 0xdb, 0x00, 0x03, 0xff, 0xef, 0xfb, 0x46, 0xb5,
+  0x0a, 0x90, 0x9b, 0x8d, 0xae, 0xff, 0xff, 0x75, 0xda, 0xf5, 0xeb, 0x66, 0x66, 0xc6, 0x66, 0x33,
+  0x5b, 0x5a, 0xff, 0xfe, 0xff, 0xad, 0x65, 0x9a, 0x1a, 0xd3, 0x5b, 0xb8, 0x66, 0xb3, 0x2d, 0xa6,
+  0x58, 0x1a, 0x0d, 0x35, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa3, 0x46, 0x83, 0x4d, 0x6b, 0x1a,
+  0xc1, 0xac, 0xd6, 0x0c, 0x0c, 0x0d, 0xdf, 0xf6, 0x00, 0x0b, 0xff, 0x86, 0xb0, 0x6b, 0x06, 0xb0,
+  0x35, 0x8d, 0x63, 0x0c, 0x33, 0x5e, 0xfb, 0xff, 0xa4, 0x84, 0x1c, 0xb3, 0x58, 0xc0, 0x00, 0x01,
+  0xef, 0x35, 0xb4, 0xd6, 0x9a, 0x0b, 0x4b, 0x45, 0xa5, 0x96, 0xb5, 0xac, 0x06, 0xb0, 0x34, 0xd6,
+  0x7d, 0xc3, 0x1a, 0xd8, 0x63, 0x18, 0x03, 0xff, 0xfc, 0x17, 0xff, 0xff, 0xa6, 0x81, 0xa6, 0x0c,
+  0x6b, 0xd6, 0xc6, 0xc7, 0xaf, 0x33, 0x63, 0x63, 0x0d, 0xff, 0xdf, 0xff, 0x36, 0x33, 0x66, 0x6c,
+  0xd9, 0x9b, 0x1e, 0xb3, 0x1a, 0xc1, 0xff, 0xff, 0xd0, 0x6b, 0x0c, 0x0f, 0xe8, 0xf3, 0x33, 0xd7,
+  0xaf, 0x74, 0xf5, 0x7f, 0xff, 0xf0, 0xe9, 0x8d, 0xaf, 0x1b, 0x67, 0xaf, 0x36, 0xcd, 0x99, 0x99,
+  0x8c, 0x00, 0x5f, 0xff, 0xfe, 0x6c, 0xd7, 0xaf, 0x5e, 0x36, 0xd9, 0x9e, 0x66, 0xd9, 0x8c, 0xc1,
+  0xff, 0xff, 0xb7, 0x36, 0x3c, 0x6d, 0x98, 0x00, 0x1d, 0xff, 0xff, 0xe5, 0x6b, 0x59, 0x68, 0x14,
+  0xc5, 0x1c, 0x6d, 0x7f, 0x7f, 0xff, 0x6d, 0x7a, 0xd8, 0xd9, 0x8f, 0x5e, 0xb6, 0x61, 0xb5, 0x8d,
+  0x7f, 0xff, 0xf4, 0xe9, 0x96, 0x34, 0x6b, 0x5a, 0xcb, 0x2b, 0xb1, 0xaf, 0x4c, 0x35, 0x96, 0x01,
+  0xa1, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb1, 0xa0, 0xd0, 0x0d, 0x35, 0x8d, 0x61, 0xac, 0xd6,
+  0x1a, 0xc6, 0xb0, 0x6b, 0xef, 0xeb, 0x5b, 0x40, 0x3b, 0xfe, 0x1a, 0xc3, 0x5a, 0xc3, 0x59, 0x6d,
+  0x32, 0xda, 0xc1, 0x98, 0x63, 0x5e, 0xbf, 0xff, 0x93, 0x91, 0xf2, 0xc6, 0xb3, 0x00, 0x00, 0x06,
+  0xfc, 0x30, 0x0d, 0x16, 0x45, 0xa2, 0xd1, 0x6b, 0x5a, 0x6b, 0x01, 0xac, 0x1a, 0xd6, 0x5a, 0xdf,
+  0x56, 0x19, 0xac, 0xc6, 0x6b, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0xda, 0x0d, 0x19, 0x66, 0x5e,
+  0xb3, 0x1b, 0x33, 0x36, 0x66, 0xcc, 0xcc, 0x37, 0xf7, 0xff, 0xfa, 0x3e, 0xb6, 0x36, 0x66, 0xcc,
+  0xf5, 0xe6, 0x66, 0x6d, 0x66, 0x02, 0xff, 0xff, 0xea, 0xc6, 0xb1, 0x83, 0xff, 0x8d, 0x9b, 0x33,
+  0xd7, 0xaf, 0x70, 0xf2, 0x7f, 0xf7, 0xfd, 0x31, 0x99, 0x9e, 0x3c, 0xcf, 0x33, 0xc7, 0x8d, 0xaf,
+  0x0c, 0x00, 0x77, 0xff, 0xff, 0x96, 0xbd, 0x66, 0x6c, 0x78, 0xf3, 0x66, 0xd9, 0x9e, 0xb6, 0x18,
+  0xdd, 0xff, 0xff, 0xc4, 0xcf, 0x5e, 0xbc, 0xcf, 0x40, 0x00, 0xff, 0xfe, 0xf9, 0x65, 0x8c, 0xfa,
+  0xa0, 0xab, 0x98, 0xdf, 0xff, 0xdf, 0xd7, 0xad, 0x8d, 0x8c, 0xd8, 0xd8, 0xda, 0xd8, 0x61, 0xff,
+  0x7f, 0xff, 0xf0, 0x8c, 0x03, 0x4c, 0xb2, 0xc2, 0xdb, 0xb9, 0x83, 0x06, 0xb2, 0xc0, 0x1a, 0x35,
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xd0, 0xd0, 0x16, 0x1a, 0x6b, 0x1a, 0xc6, 0xb3, 0x58, 0x6b,
+  0x35, 0x83, 0x5b, 0xff, 0xee, 0xd6, 0xbd, 0x30, 0x3e, 0xff, 0xbd, 0x35, 0x86, 0xb5, 0x8d, 0x32,
+  0xc6, 0xb5, 0x9a, 0xc3, 0x0d, 0xac, 0xd6, 0xd2, 0xa2, 0x75, 0x96, 0x6b, 0x0c, 0x00, 0x00, 0x3f,
+  0xd6, 0x6b, 0x16, 0x0b, 0x5a, 0x5a, 0x2d, 0x16, 0xb4, 0xd3, 0x5a, 0xc6, 0x98, 0x35, 0xad, 0x62,
+  0xd6, 0xee, 0x18, 0xc6, 0x1b, 0x58, 0x07, 0xff, 0xf8, 0x1f, 0xff, 0xdd, 0xa1, 0xa6, 0xb1, 0xac,
+  0xc6, 0x36, 0x66, 0xcc, 0xd9, 0x9b, 0x18, 0xcf, 0xff, 0xf4, 0x9d, 0xad, 0x99, 0x99, 0xeb, 0xcc,
+  0xd9, 0xb3, 0x31, 0x98, 0x6b, 0x5f, 0xdf, 0xfc, 0xb6, 0xb5, 0xb5, 0x9f, 0xff, 0xdb, 0x36, 0x6c,
+  0xcf, 0x5e, 0x36, 0x36, 0xf7, 0xff, 0xfe, 0xc5, 0x36, 0xb6, 0x6c, 0xcf, 0x36, 0x6d, 0x9e, 0xbc,
+  0x6c, 0x66, 0x00, 0x1f, 0x7f, 0xff, 0x61, 0xb1, 0xb3, 0x36, 0x78, 0xf3, 0x66, 0x6c, 0x66, 0x07,
+  0xdf, 0xfc, 0x6c, 0xd9, 0x98, 0x00, 0x1f, 0x7f, 0xff, 0x00, 0x69, 0xe9, 0x55, 0x69, 0xb1, 0xbf,
+  0xff, 0xe0, 0x38, 0xc6, 0x66, 0x66, 0xd7, 0x8c, 0xc6, 0xd6, 0x61, 0xff, 0xff, 0xbb, 0xcd, 0x6b,
+  0x0d, 0x35, 0x8b, 0x00, 0x6b, 0x7c, 0x18, 0x1a, 0xc5, 0x80, 0x68, 0xd6, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xd1, 0xa0, 0x16, 0x0b, 0x69, 0xac, 0x6b, 0x35, 0x8d, 0x6d, 0x6b, 0x6b, 0x5b, 0x4d, 0x6f,
+  0xff, 0xff, 0x41, 0xac, 0xd6, 0x0f, 0xfb, 0x9a, 0xd6, 0x1a, 0xcb, 0x34, 0xd6, 0x06, 0xb0, 0xc1,
+  0x8c, 0x63, 0x19, 0x51, 0x57, 0xff, 0xf9, 0x96, 0xd3, 0x35, 0xb0, 0x00, 0x03, 0xf6, 0xb1, 0xad,
+  0x65, 0xad, 0x04, 0xdd, 0xad, 0x2d, 0x68, 0x69, 0xac, 0x0c, 0x06, 0xb1, 0x62, 0xc9, 0xbf, 0x98,
+  0xc3, 0x31, 0x76, 0x81, 0xff, 0xfe, 0x07, 0xff, 0x7f, 0x34, 0x35, 0xac, 0x6b, 0x31, 0x98, 0xdb,
+  0x1e, 0x3d, 0x79, 0x98, 0xda, 0xdf, 0xff, 0xe9, 0x9f, 0xdb, 0x0f, 0x5e, 0x36, 0x6c, 0xd9, 0xb3,
+  0x6b, 0xc6, 0x61, 0x96, 0x7f, 0xfd, 0xfd, 0x60, 0xc1, 0xff, 0xfc, 0xd9, 0x9e, 0xbc, 0xd8, 0xf1,
+  0x9f, 0xa5, 0xbb, 0xff, 0xff, 0x3f, 0x59, 0x99, 0x9b, 0x66, 0xdb, 0x36, 0x7a, 0xf3, 0x31, 0x9a,
+  0x00, 0x3f, 0xbf, 0xfa, 0xcc, 0xc6, 0xcc, 0xf1, 0xe3, 0xcc, 0xf1, 0x9b, 0x0c, 0x0f, 0xef, 0xfb,
+  0x33, 0x3d, 0x00, 0x00, 0xff, 0xff, 0xf6, 0xe6, 0x8d, 0x6b, 0x3b, 0xad, 0x2f, 0x78, 0xcd, 0xff,
+  0xff, 0x07, 0xd9, 0x8c, 0xcc, 0xc7, 0xad, 0x99, 0x8c, 0x66, 0xb7, 0xf7, 0xff, 0xfe, 0xa8, 0xd6,
+  0x0d, 0x32, 0xc0, 0x0d, 0x6b, 0x17, 0x6b, 0x06, 0xb5, 0x8b, 0x03, 0x46, 0xb0, 0x00, 0x00, 0x00,
+  0x81, 0x06, 0x80, 0x16, 0x59, 0x61, 0xac, 0x18, 0xc1, 0x8d, 0x66, 0xb0, 0x63, 0xbf, 0xff, 0xb0,
+  0x61, 0x83, 0xff, 0xa6, 0xb5, 0x86, 0xb2, 0xcd, 0x35, 0x96, 0x69, 0x83, 0x5b, 0x59, 0x86, 0x60,
+  0x9e, 0xa4, 0xff, 0xff, 0x4e, 0xd6, 0x0c, 0x33, 0x00, 0x00, 0x7e, 0x6b, 0x06, 0xb4, 0xd0, 0xb4,
+  0x5a, 0x16, 0x8d, 0x06, 0xb0, 0x6b, 0x06, 0xb0, 0xb1, 0x65, 0xa1, 0xc6, 0x6b, 0x6e, 0x9a, 0x03,
+  0xf3, 0xf5, 0x61, 0xff, 0x7f, 0x4d, 0x34, 0xd6, 0x32, 0xf5, 0x99, 0x99, 0x9e, 0xbc, 0xcd, 0x99,
+  0xb5, 0xeb, 0x7f, 0xf7, 0xff, 0xf6, 0x33, 0x36, 0x3c, 0x78, 0xdb, 0x36, 0x3d, 0x7a, 0xd8, 0x60,
+  0x7f, 0xff, 0xf9, 0x7d, 0xac, 0x19, 0xbf, 0xff, 0x8c, 0xf5, 0xe6, 0x6d, 0x99, 0x98, 0xd9, 0x47,
+  0xff, 0xdf, 0xfd, 0x87, 0xad, 0xb3, 0x3c, 0xd9, 0xe6, 0x78, 0xd9, 0x98, 0xd0, 0x01, 0xfd, 0xff,
+  0xf6, 0x33, 0x1b, 0x6b, 0xcd, 0x9e, 0xbc, 0xcf, 0x5e, 0x33, 0x35, 0x81, 0xfd, 0xfc, 0x78, 0x00,
+  0x00, 0xff, 0xbf, 0xeb, 0x2d, 0x6b, 0x0e, 0xab, 0xec, 0x7e, 0xbc, 0x3f, 0xff, 0xe1, 0x70, 0xda,
+  0xd9, 0x8d, 0x8d, 0x8d, 0x86, 0xd6, 0x67, 0xff, 0xfe, 0x9f, 0xf0, 0x6b, 0x1a, 0x65, 0x80, 0x69,
+  0xac, 0xb6, 0xb5, 0xf6, 0x06, 0xb2, 0xc0, 0x06, 0xb5, 0x80, 0x00, 0x07, 0x81, 0x01, 0xb4, 0x34,
+  0x2c, 0x5a, 0xd6, 0xb0, 0x35, 0x9a, 0xcd, 0x66, 0xb6, 0xb0, 0xc1, 0x8b, 0xbf, 0xfe, 0x6b, 0x6b,
+  0x1a, 0xda, 0xff, 0xef, 0x9a, 0xd6, 0x1a, 0xc5, 0xb4, 0x65, 0x81, 0xac, 0x6b, 0x35, 0xb5, 0xb5,
+  0xb5, 0x89, 0x29, 0x87, 0xff, 0xdd, 0x61, 0xad, 0xac, 0xc0, 0x00, 0x6d, 0x9a, 0xc0, 0x01, 0x68,
+  0x40, 0x9a, 0x01, 0xac, 0x0c, 0x1a, 0xcb, 0x05, 0x96, 0x9a, 0xb2, 0x02, 0xd3, 0x40, 0xf6, 0xf6,
+  0xcb, 0x4d, 0xff, 0xfd, 0xf6, 0x8d, 0x6b, 0x06, 0x35, 0xeb, 0xd7, 0xaf, 0x1e, 0xbc, 0xd9, 0x9e,
+  0xb6, 0x37, 0x7f, 0xff, 0xa5, 0xe1, 0x9b, 0x1b, 0x66, 0x6d, 0x99, 0xb3, 0x63, 0x61, 0x83, 0x5f,
+  0xff, 0xfe, 0xb3, 0x58, 0x67, 0xff, 0xdf, 0x66, 0x6c, 0xdb, 0x33, 0x66, 0xd7, 0xd8, 0x39, 0xbf,
+  0xff, 0xf1, 0xac, 0xcc, 0xcd, 0xb6, 0x6c, 0xf3, 0x3c, 0xcc, 0xcc, 0x30, 0x01, 0xff, 0x7f, 0xf6,
+  0x63, 0x33, 0x36, 0x6c, 0xf5, 0xe6, 0x7a, 0xf1, 0x98, 0xd6, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff,
+  0x40, 0xb0, 0x33, 0x9b, 0x23, 0x47, 0xad, 0x9d, 0xff, 0xff, 0x11, 0x66, 0x33, 0x19, 0xb1, 0x99,
+  0x98, 0xcc, 0x2f, 0xff, 0xfc, 0xc5, 0xb5, 0xac, 0x35, 0x96, 0x0d, 0x34, 0xcb, 0x1a, 0xc5, 0xc1,
+  0xad, 0x65, 0x80, 0x69, 0x90, 0x00, 0x01, 0xec, 0x0e, 0x12, 0x68, 0x05, 0x93, 0x5a, 0x6b, 0x06,
+  0xb6, 0xb1, 0x86, 0x18, 0xc1, 0xac, 0x7f, 0xdf, 0xf0, 0xc6, 0x18, 0x77, 0xff, 0xcd, 0x6b, 0x1a,
+  0xd6, 0x01, 0xac, 0xb0, 0xd6, 0x0c, 0x33, 0x0c, 0xc2, 0x1a, 0x30, 0xfe, 0xff, 0xac, 0x6b, 0x35,
+  0xb0, 0x00, 0x1e, 0x6b, 0xd3, 0x58, 0x16, 0x5a, 0x13, 0x76, 0x5a, 0x00, 0x35, 0x8d, 0x60, 0xd6,
+  0x58, 0x16, 0x4d, 0x16, 0x9a, 0xb2, 0xd1, 0xa1, 0x77, 0xf8, 0x2d, 0x69, 0xbf, 0xff, 0xfa, 0xd3,
+  0x5a, 0xd6, 0x35, 0xb5, 0x99, 0x99, 0xeb, 0xc7, 0x99, 0xb3, 0x31, 0xbf, 0xff, 0xd3, 0xff, 0xb0,
+  0xd8, 0xd9, 0xb3, 0x66, 0xd9, 0x9b, 0x33, 0x31, 0x83, 0x4f, 0xff, 0x86, 0xb1, 0xbf, 0xef, 0xf8,
+  0xd9, 0xb3, 0x66, 0xcf, 0x5e, 0x2d, 0x6e, 0x6f, 0x5f, 0x7f, 0xff, 0xde, 0xe6, 0x3d, 0x79, 0xb3,
+  0xcc, 0xf3, 0x66, 0xcd, 0xaf, 0x5b, 0x58, 0x00, 0xff, 0xef, 0xe3, 0x5e, 0x33, 0x66, 0x6d, 0x99,
+  0xb6, 0x3d, 0x7a, 0xf5, 0x9a, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xdf, 0x34, 0x1a, 0x63, 0x8b, 0x4b,
+  0x6f, 0xad, 0x9f, 0xdf, 0xff, 0xd8, 0xc6, 0x36, 0xbd, 0x78, 0xc7, 0xad, 0x86, 0xd6, 0xdf, 0xff,
+  0xdf, 0xff, 0x60, 0xd6, 0x35, 0xac, 0x06, 0x9a, 0xd6, 0x0c, 0xbd, 0x37, 0xd0, 0xd6, 0x58, 0x5b,
+  0x43, 0x58, 0x00, 0x01, 0xb0, 0x12, 0x17, 0xa1, 0xa5, 0x96, 0xb4, 0xd1, 0xa6, 0x0c, 0x35, 0xeb,
+  0x18, 0xc3, 0x5b, 0x58, 0x3f, 0xfe, 0xfe, 0xc3, 0x35, 0x98, 0x6f, 0xff, 0xfe, 0xfb, 0x59, 0x6d,
+  0x35, 0x80, 0x6b, 0x59, 0x66, 0x98, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x1e, 0xa0, 0x05, 0xff, 0xfc,
+  0x0c, 0x6b, 0xd6, 0xd6, 0x00, 0xd8, 0xc1, 0xac, 0xb2, 0xd6, 0x8b, 0x41, 0x68, 0x16, 0x34, 0xc1,
+  0xac, 0x6b, 0x2c, 0x0b, 0x2d, 0x37, 0x65, 0xa0, 0xb4, 0xd0, 0x2e, 0x9e, 0xa5, 0xad, 0x69, 0xff,
+  0xff, 0xc8, 0xd6, 0xb5, 0x83, 0x18, 0xcc, 0xcd, 0xb3, 0x3d, 0x79, 0x9b, 0x1b, 0xfb, 0xff, 0xfd,
+  0x34, 0xcc, 0x6c, 0xcf, 0x5e, 0x6c, 0xd9, 0xb3, 0x36, 0x36, 0xb3, 0x59, 0x5f, 0xd8, 0x6b, 0x3b,
+  0xff, 0xff, 0xcd, 0xb5, 0xe6, 0x78, 0xf1, 0xe6, 0x6d, 0x5b, 0x61, 0x99, 0xff, 0xff, 0x7b, 0xfd,
+  0xeb, 0x66, 0xcd, 0x9e, 0x67, 0x9b, 0x66, 0x66, 0xd6, 0xd6, 0x00, 0x3f, 0xfb, 0xf8, 0xc6, 0xc6,
+  0xcc, 0xf5, 0xe6, 0x6d, 0x8d, 0x99, 0xaf, 0x4c, 0x10, 0x00, 0x00, 0x7f, 0x7f, 0xd6, 0x5a, 0x6b,
+  0x06, 0xf6, 0xe7, 0x33, 0x37, 0xff, 0x7f, 0xc3, 0x18, 0xcc, 0xcc, 0xc6, 0xd7, 0x86, 0x6b, 0x7f,
+  0xff, 0xe2, 0xf6, 0xb6, 0x98, 0x35, 0x80, 0x6b, 0x5a, 0xc1, 0xac, 0x65, 0xef, 0xb8, 0xd6, 0xb1,
+  0x60, 0x69, 0x80, 0x00, 0x1e, 0xb3, 0x06, 0x07, 0x1a, 0x05, 0xad, 0x34, 0x06, 0xb2, 0xf5, 0x86,
+  0x33, 0x59, 0x86, 0x18, 0x1f, 0xff, 0xfd, 0x5d, 0x83, 0x35, 0xb5, 0xb5, 0xdf, 0xff, 0x18, 0x1a,
+  0xd6, 0x03, 0x4d, 0x60, 0x35, 0x9a, 0xcd, 0x6c, 0x33, 0x0e, 0x0e, 0xb2, 0xf4, 0xff, 0xfb, 0x86,
+  0x18, 0xc6, 0xd6, 0xd6, 0xb3, 0x06, 0x34, 0xd6, 0xb4, 0x0b, 0x42, 0x68, 0xb0, 0x06, 0x0d, 0x66,
+  0xb5, 0x82, 0xc2, 0xd6, 0x8b, 0x5a, 0x16, 0xb4, 0x01, 0xc9, 0xc9, 0x96, 0xb4, 0x77, 0xff, 0xd6,
+  0xb5, 0xac, 0xd6, 0xbd, 0x66, 0x6c, 0x6d, 0x9b, 0x36, 0x6c, 0xc6, 0xff, 0xff, 0x51, 0xed, 0x66,
+  0x36, 0xc6, 0xdb, 0x33, 0x6c, 0xd8, 0xf5, 0xeb, 0xd6, 0x30, 0x16, 0x18, 0xff, 0xff, 0xf6, 0x99,
+  0x9b, 0x3d, 0x79, 0xb6, 0x3c, 0x52, 0x54, 0x0d, 0xdf, 0xff, 0xf6, 0x8c, 0xcd, 0x9b, 0x3c, 0xd9,
+  0xbd, 0x79, 0xb1, 0x99, 0xa0, 0x04, 0xfb, 0xff, 0xef, 0x58, 0xf5, 0xb3, 0x36, 0x66, 0xd8, 0xf1,
+  0xb3, 0x18, 0x65, 0x80, 0x00, 0x01, 0xdf, 0xfd, 0x05, 0x8b, 0x68, 0xdc, 0xe8, 0xf1, 0x99, 0xbf,
+  0xff, 0xbe, 0x18, 0xc6, 0x66, 0x36, 0x33, 0x31, 0x8d, 0xff, 0x7f, 0xff, 0xdf, 0xb0, 0x6b, 0x1a,
+  0xd6, 0x0d, 0x35, 0x96, 0x34, 0xc3, 0x0d, 0xdf, 0x69, 0xac, 0xb0, 0x0d, 0x6b, 0x35, 0x80, 0x19,
+  0x80, 0x38, 0x43, 0x40, 0x2d, 0x68, 0x00, 0x6b, 0x1a, 0xda, 0xda, 0xda, 0xcc, 0x31, 0x81, 0xbf,
+  0xff, 0xf9, 0xf6, 0xb1, 0x8d, 0x7a, 0xc6, 0xff, 0xfe, 0xed, 0x61, 0xa6, 0x58, 0x34, 0x6b, 0x58,
+  0x35, 0x86, 0x35, 0xeb, 0x6b, 0x68, 0xc8, 0xd3, 0x2f, 0x4d, 0xff, 0xdf, 0xc6, 0xb6, 0xb3, 0x18,
+  0xcd, 0x7a, 0xda, 0xcd, 0x60, 0xd1, 0xa1, 0x69, 0xbb, 0x20, 0x16, 0x03, 0x06, 0xb3, 0x5a, 0xc0,
+  0xb1, 0x68, 0x08, 0x09, 0xa0, 0x0d, 0xed, 0xf5, 0xad, 0x68, 0xfb, 0xff, 0xe6, 0xb5, 0x86, 0xb3,
+  0x19, 0x9b, 0x36, 0x6d, 0x99, 0xeb, 0xd7, 0xaf, 0xbf, 0xff, 0xd4, 0x06, 0x66, 0x66, 0xd9, 0x9e,
+  0x3c, 0xcf, 0x5e, 0x36, 0x31, 0xac, 0xd0, 0x03, 0xfe, 0xff, 0xec, 0x6c, 0xd9, 0xb6, 0x6c, 0xd9,
+  0xb4, 0xe4, 0xfe, 0x63, 0xff, 0xef, 0xfe, 0xcc, 0xcf, 0x33, 0xcd, 0x9e, 0x6c, 0xcd, 0x8c, 0x63,
+  0xb0, 0x07, 0xfd, 0xf5, 0x99, 0x99, 0xb1, 0xb6, 0x66, 0xcc, 0xd8, 0xcc, 0x35, 0x96, 0x00, 0x00,
+  0x1f, 0xff, 0xcb, 0x41, 0xa3, 0x59, 0xb5, 0xe9, 0xf9, 0xb1, 0xff, 0xfd, 0xc3, 0x19, 0xaf, 0x5b,
+  0x1b, 0x5e, 0xbd, 0x66, 0x63, 0x7f, 0xff, 0xe0, 0x7c, 0xd6, 0x6b, 0x06, 0xb0, 0x1a, 0xd6, 0x03,
+  0x58, 0xd6, 0xd6, 0x5f, 0xc6, 0xb2, 0xc0, 0x1a, 0xc3, 0x58, 0x0c, 0x6b, 0x01, 0x11, 0x30, 0x05,
+  0xa0, 0x0b, 0x06, 0xb3, 0x59, 0x86, 0xd6, 0x63, 0x5b, 0x59, 0xa5, 0xff, 0xff, 0xcb, 0x6d, 0x63,
+  0x35, 0xb5, 0xb5, 0x7f, 0xff, 0x30, 0x35, 0xac, 0x01, 0xa6, 0xb2, 0xcd, 0x31, 0x86, 0x33, 0x5e,
+  0x8b, 0x4b, 0xd9, 0x7a, 0x6e, 0xff, 0xff, 0x42, 0xf4, 0xcd, 0x6d, 0x6c, 0x63, 0x18, 0xc6, 0xb0,
+  0x00, 0x4d, 0x2d, 0x68, 0x59, 0x62, 0xf4, 0xd6, 0xd3, 0x1a, 0xd6, 0x0b, 0x16, 0xb4, 0x59, 0x02,
+  0xd0, 0x01, 0xb3, 0xb4, 0xb5, 0xad, 0x35, 0xff, 0xdf, 0xda, 0xd6, 0x0c, 0x36, 0xbc, 0x6c, 0xdb,
+  0x33, 0xc7, 0x8c, 0xdf, 0xff, 0xea, 0xdf, 0xf6, 0xd6, 0x66, 0x6c, 0xcf, 0x1e, 0x6c, 0xd9, 0xb3,
+  0x31, 0xb5, 0x86, 0x00, 0x3f, 0xff, 0xfc, 0xf6, 0xbc, 0x78, 0xf1, 0xe6, 0xcd, 0x9b, 0x4a, 0x4b,
+  0xe6, 0x1f, 0xff, 0xf5, 0x97, 0xaf, 0x1e, 0x67, 0x9b, 0x67, 0xaf, 0x36, 0x63, 0x1b, 0xff, 0xef,
+  0xb0, 0x06, 0xbf, 0xfb, 0xed, 0x8c, 0xda, 0xf3, 0x33, 0x66, 0xcc, 0xda, 0xf0, 0xc3, 0x59, 0x00,
+  0x00, 0x1f, 0xfd, 0xc2, 0xd6, 0x9a, 0xc1, 0xb6, 0x02, 0x0f, 0x66, 0xdf, 0xff, 0xf3, 0x43, 0x0c,
+  0x66, 0x36, 0xbd, 0x6c, 0x6d, 0x6d, 0x6e, 0xff, 0xff, 0xbb, 0x32, 0xf4, 0xc1, 0x96, 0x0d, 0x6b,
+  0x58, 0x6b, 0x59, 0xac, 0x63, 0x7d, 0xf6, 0xb5, 0xac, 0x01, 0xac, 0x35, 0x98, 0x33, 0x5a, 0xcc,
+  0x26, 0x2a, 0x35, 0x65, 0xad, 0x16, 0x2c, 0xb0, 0xcb, 0xd6, 0x33, 0x5e, 0xb3, 0x18, 0x61, 0xaf,
+  0xbf, 0xff, 0xac, 0x61, 0xb5, 0x98, 0x6f, 0xfe, 0xfe, 0xcb, 0x69, 0xac, 0xb0, 0x34, 0x6b, 0x58,
+  0x18, 0x6b, 0xd6, 0x63, 0x05, 0x05, 0x3e, 0xb0, 0x35, 0xff, 0xf7, 0x31, 0x86, 0x63, 0x31, 0x86,
+  0x35, 0x85, 0x81, 0x34, 0x5a, 0x05, 0xac, 0xb0, 0xd6, 0x18, 0x35, 0x96, 0x0b, 0x5a, 0x6a, 0xc8,
+  0x0b, 0x40, 0x16, 0xd5, 0xd5, 0xcb, 0x5a, 0x69, 0xbf, 0xff, 0xf4, 0xad, 0x65, 0xb4, 0xda, 0xcc,
+  0xd9, 0x9b, 0x66, 0xcd, 0xb1, 0xb7, 0x7f, 0xff, 0xaa, 0xdb, 0x59, 0x9b, 0x1e, 0x3c, 0xd9, 0xb6,
+  0x6c, 0xcc, 0xda, 0xd8, 0x34, 0x00, 0xff, 0xfb, 0xfe, 0xcd, 0xaf, 0x36, 0x67, 0x9b, 0x36, 0x64,
+  0x5c, 0x79, 0xaf, 0x5f, 0xf7, 0xff, 0xcd, 0x8f, 0x36, 0x6f, 0x1e, 0x6c, 0xd8, 0xda, 0xf5, 0xff,
+  0xf7, 0xf0, 0x06, 0x99, 0xff, 0xff, 0xb8, 0xc6, 0x6c, 0x7a, 0xf5, 0xe6, 0x66, 0xcc, 0xcc, 0x60,
+  0xd6, 0x80, 0x00, 0x1f, 0xdf, 0xda, 0x05, 0x8b, 0x6b, 0x36, 0x42, 0xc4, 0x9b, 0x5f, 0xff, 0xf3,
+  0xa6, 0xb3, 0x0c, 0xc6, 0x63, 0x63, 0x19, 0x9f, 0xff, 0xdf, 0xf1, 0xac, 0x65, 0xb5, 0xac, 0x06,
+  0xb5, 0x83, 0x58, 0x30, 0xc6, 0x7d, 0xf3, 0x59, 0x60, 0x1a, 0xc3, 0x59, 0x83, 0x35, 0x80, 0x54,
+  0x5c, 0x6e, 0xc5, 0xa0, 0xb2, 0xd6, 0xb0, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0x18, 0x66, 0xb5, 0xfd,
+  0xff, 0xfc, 0x66, 0xb6, 0xb6, 0x18, 0xcf, 0xff, 0xfd, 0x9d, 0x66, 0x9a, 0xcb, 0x00, 0xd1, 0xac,
+  0xb3, 0x5a, 0xf5, 0x86, 0xc3, 0x08, 0x89, 0x1a, 0xc1, 0xad, 0xff, 0xdf, 0xd8, 0x63, 0x35, 0xeb,
+  0x6b, 0x61, 0xad, 0xad, 0x62, 0xc5, 0xa6, 0xac, 0x81, 0x6b, 0x59, 0x66, 0x98, 0xd6, 0x1a, 0xc5,
+  0x85, 0xad, 0x05, 0xa0, 0x4d, 0x00, 0xb3, 0x43, 0x45, 0x6b, 0x5a, 0xd3, 0x7d, 0xff, 0xfd, 0xad,
+  0x63, 0x59, 0xaf, 0x19, 0xb6, 0x6c, 0xdb, 0x36, 0x3d, 0x7f, 0xdf, 0xff, 0xea, 0x98, 0xc6, 0x6c,
+  0x79, 0xb3, 0x67, 0x99, 0xb3, 0x66, 0x36, 0xb3, 0x5a, 0x00, 0xef, 0xff, 0xff, 0x16, 0x66, 0xc7,
+  0x9b, 0x36, 0xcd, 0x99, 0x07, 0x0e, 0x33, 0x5f, 0xff, 0xf4, 0x9f, 0x6c, 0x79, 0xb3, 0xcd, 0x9e,
+  0x3c, 0x6c, 0x67, 0xf7, 0xff, 0xc0, 0x68, 0xcb, 0x5f, 0xff, 0xd8, 0xd8, 0xd9, 0x9b, 0x1b, 0x63,
+  0x66, 0x33, 0x59, 0xa6, 0x80, 0x00, 0x3e, 0xfe, 0x5a, 0xd0, 0x1a, 0xd6, 0x6c, 0x8b, 0x8e, 0xcd,
+  0xbe, 0xff, 0xf8, 0xc3, 0x0c, 0xc6, 0x63, 0x33, 0x18, 0xdf, 0xff, 0xf7, 0x56, 0x6b, 0x19, 0x6d,
+  0x6b, 0x01, 0xac, 0xb1, 0xad, 0x66, 0xb1, 0xad, 0x87, 0xfc, 0xb5, 0x96, 0x03, 0x58, 0x6b, 0x30,
+  0xd6, 0xd6, 0x01, 0x71, 0x90, 0x16, 0x81, 0x6b, 0x5a, 0x65, 0x9a, 0xcc, 0x36, 0xb6, 0x31, 0x8d,
+  0x7a, 0xd6, 0xff, 0xfe, 0xff, 0x9a, 0xcd, 0x7a, 0xcc, 0x63, 0x3f, 0xbf, 0xe5, 0xb4, 0xd6, 0x2c,
+  0x03, 0x46, 0xb5, 0x86, 0xb3, 0x0c, 0xc3, 0x0f, 0x0f, 0xe6, 0xb0, 0xd6, 0xbb, 0xff, 0xad, 0xac,
+  0xc6, 0x33, 0x18, 0x61, 0xac, 0xb2, 0xd6, 0x82, 0xd0, 0x5a, 0xd6, 0xb2, 0xda, 0x63, 0x58, 0x6b,
+  0x2c, 0x59, 0x68, 0x2d, 0x02, 0xd3, 0x42, 0xc5, 0xb3, 0x73, 0x75, 0x96, 0xb4, 0xd6, 0xff, 0xfb,
+  0xfb, 0x58, 0x35, 0xeb, 0x33, 0x66, 0x78, 0xf3, 0x66, 0xcd, 0x9f, 0xff, 0xeb, 0x9f, 0xd9, 0xad,
+  0xaf, 0x1b, 0x66, 0xcd, 0xb6, 0x6c, 0xcf, 0x5e, 0x1e, 0xb1, 0xac, 0x00, 0xff, 0xff, 0xf6, 0xf9,
+  0x99, 0x9b, 0x66, 0x78, 0xf3, 0x66, 0xcf, 0x6f, 0xe3, 0x35, 0x7f, 0xff, 0xce, 0xe7, 0xaf, 0x36,
+  0xcd, 0xb6, 0x6c, 0xd9, 0x8d, 0xdf, 0xff, 0xfc, 0x3a, 0x03, 0x5a, 0xc6, 0xff, 0xbf, 0x98, 0xd9,
+  0x99, 0x9b, 0x33, 0x36, 0x33, 0x18, 0x1a, 0x00, 0x01, 0xf7, 0xd0, 0x5a, 0xd6, 0xb5, 0x83, 0x6c,
+  0x8c, 0xa3, 0x67, 0xdf, 0xfc, 0xc1, 0x86, 0x63, 0x35, 0xe1, 0xb0, 0xdb, 0xff, 0xbf, 0xff, 0xb0,
+  0xc1, 0x86, 0xb5, 0x86, 0x9a, 0xc0, 0xd6, 0x35, 0x8c, 0x6b, 0x6b, 0xff, 0xb5, 0xac, 0xb0, 0x69,
+  0x86, 0xb6, 0xb1, 0xaf, 0x4c, 0x03, 0x23, 0x60, 0x5a, 0x05, 0xad, 0x34, 0xd6, 0x0c, 0x63, 0x33,
+  0x5e, 0xb6, 0xbd, 0x61, 0x8f, 0xff, 0xfd, 0xbf, 0x86, 0x31, 0x8d, 0xac, 0xc7, 0xff, 0xdc, 0x1a,
+  0xd6, 0x16, 0x03, 0x46, 0xb5, 0x86, 0xb6, 0xb3, 0x18, 0xc3, 0x23, 0x76, 0x60, 0x35, 0xaf, 0xff,
+  0xe3, 0x5b, 0x0d, 0xad, 0x86, 0x30, 0x6b, 0x5a, 0xd6, 0x81, 0x01, 0x6b, 0x5a, 0xd6, 0x35, 0x86,
+  0x06, 0x59, 0x65, 0xa6, 0x96, 0xb4, 0x16, 0x9a, 0x2c, 0x59, 0x64, 0xe5, 0x5a, 0xcb, 0x5a, 0xd6,
+  0xef, 0xff, 0xeb, 0x2c, 0xd6, 0x36, 0xbc, 0x6d, 0x9b, 0x66, 0xd9, 0x9b, 0x3f, 0xff, 0xd7, 0x30,
+  0xc6, 0xc6, 0xd9, 0xb6, 0x6d, 0x9e, 0xbc, 0xcd, 0xaf, 0x18, 0x60, 0x03, 0xef, 0xff, 0xff, 0x01,
+  0xb3, 0x36, 0x6d, 0x9b, 0x3c, 0x7a, 0xf3, 0xa3, 0xbe, 0x6b, 0x69, 0xff, 0x7f, 0xf3, 0xd7, 0x9b,
+  0x67, 0x99, 0xe3, 0xc7, 0xad, 0xaf, 0xff, 0xee, 0x1a, 0x35, 0xac, 0x6b, 0x7f, 0xfd, 0xd9, 0x99,
+  0x8f, 0x19, 0xb3, 0x36, 0xbd, 0x6c, 0x30, 0x34, 0x00, 0x0f, 0xbe, 0x23, 0x76, 0x16, 0x0c, 0x6d,
+  0x97, 0x9a, 0x3c, 0xff, 0xbf, 0xb0, 0x31, 0x86, 0xd6, 0xc6, 0x33, 0x19, 0xff, 0xff, 0x75, 0xf6,
+  0x18, 0x30, 0x65, 0x83, 0x5a, 0xc0, 0xd6, 0x35, 0x98, 0x33, 0x3e, 0xfe, 0xd6, 0xb1, 0x63, 0x5a,
+  0xc6, 0xb6, 0xb1, 0xad, 0xac, 0x03, 0x63, 0xa2, 0xcb, 0x41, 0x6b, 0x46, 0x8d, 0x61, 0xaf, 0x59,
+  0x98, 0xcc, 0xd6, 0xc3, 0x2d, 0xff, 0xff, 0xb1, 0xf6, 0x19, 0xaf, 0x5b, 0x5e, 0xb3, 0x0f, 0xff,
+  0xfc, 0xdc, 0xd3, 0x58, 0xb0, 0x00, 0x35, 0xac, 0x35, 0xeb, 0x18, 0xcc, 0x2a, 0x2d, 0xaf, 0x4c,
+  0x34, 0xd6, 0xff, 0xef, 0x9a, 0xf5, 0xeb, 0x31, 0x8c, 0x30, 0xd3, 0x5a, 0xd0, 0x26, 0x96, 0x5a,
+  0x6b, 0x58, 0x18, 0xd6, 0x1a, 0xd6, 0x5a, 0xd6, 0x85, 0xa0, 0x26, 0x81, 0x65, 0x96, 0x36, 0x36,
+  0x59, 0x6b, 0x2d, 0x6f, 0xfe, 0xff, 0xb5, 0x83, 0x35, 0xe3, 0x3c, 0x79, 0x9e, 0x6c, 0xcd, 0xbb,
+  0xff, 0xfd, 0x7a, 0xcd, 0x6c, 0x6c, 0xd9, 0xb6, 0xcd, 0x9e, 0x3d, 0x79, 0x8d, 0xad, 0xac, 0x00,
+  0x7f, 0xff, 0xfb, 0x7f, 0x63, 0x66, 0x6c, 0xd9, 0xe6, 0x6d, 0x98, 0xd8, 0xdf, 0x98, 0x1b, 0xff,
+  0xfe, 0x58, 0xd9, 0xeb, 0xd9, 0xb6, 0x6c, 0xd9, 0x8f, 0xfe, 0xfe, 0xd1, 0xa6, 0xb5, 0x8d, 0x6b,
+  0x7f, 0xff, 0x19, 0x8f, 0x5e, 0xbc, 0x67, 0xad, 0x99, 0x8c, 0x30, 0x00, 0x01, 0xfd, 0x41, 0x68,
+  0x34, 0x6b, 0x1b, 0xa7, 0x67, 0xf3, 0x6f, 0xfe, 0xeb, 0x35, 0x86, 0xbd, 0x66, 0x33, 0x19, 0xaf,
+  0x5d, 0xff, 0xff, 0x6f, 0xac, 0xd6, 0x35, 0x8d, 0x65, 0x8d, 0x35, 0x81, 0xac, 0xd6, 0x35, 0xb5,
+  0xb5, 0x9f, 0xf7, 0x6b, 0x58, 0x06, 0xb1, 0xad, 0xac, 0x33, 0x5a, 0xc0, 0xe0, 0xf0, 0x5a, 0xd0,
+  0xb5, 0xa0, 0x68, 0xc1, 0x8c, 0xcc, 0x66, 0x33, 0x0c, 0x3f, 0xff, 0xf5, 0x35, 0xaf, 0x59, 0x98,
+  0xc6, 0x6b, 0xd7, 0xdf, 0xfc, 0x6b, 0x59, 0x60, 0x16, 0x0d, 0x1a, 0xc3, 0x0c, 0xc6, 0x04, 0x44,
+  0x98, 0xd6, 0x1a, 0x6b, 0x7f, 0x7f, 0xd8, 0x6d, 0x7a, 0xcc, 0x61, 0x81, 0xa6, 0x9a, 0x59, 0x35,
+  0x65, 0xa6, 0x9a, 0xc1, 0xac, 0xd6, 0x1a, 0xd6, 0xb5, 0xa6, 0x96, 0x40, 0xb4, 0xd0, 0xb2, 0xcb,
+  0x58, 0x78, 0x96, 0x59, 0x65, 0xac, 0xef, 0xff, 0xeb, 0x58, 0xd6, 0xc6, 0x6c, 0xcf, 0x36, 0x78,
+  0xf1, 0xeb, 0xbf, 0xff, 0xd7, 0xf0, 0xcc, 0x6c, 0xd9, 0xe6, 0x79, 0x9e, 0x66, 0xcc, 0xc6, 0xd6,
+  0x00, 0x3e, 0xff, 0xff, 0xef, 0xd6, 0xc6, 0xcd, 0x9b, 0x3c, 0x79, 0x9e, 0xbc, 0xca, 0xd1, 0x8c,
+  0x69, 0xdf, 0xff, 0xcd, 0x9e, 0x3c, 0xdb, 0x36, 0xc7, 0xad, 0xfd, 0xff, 0x5a, 0x69, 0x96, 0x0d,
+  0x63, 0xef, 0xfb, 0x5e, 0xbd, 0x7a, 0xd9, 0xb5, 0xe3, 0x63, 0x61, 0x8c, 0x00, 0x00, 0xff, 0x84,
+  0x05, 0xa6, 0xb0, 0x1c, 0x28, 0xe9, 0x3c, 0xcf, 0xfe, 0x86, 0xb1, 0xad, 0xac, 0xc6, 0x33, 0x19,
+  0xbf, 0xff, 0xef, 0x3f, 0xb5, 0x8c, 0x18, 0x35, 0x80, 0xd6, 0xb0, 0xd6, 0x18, 0x33, 0x0c, 0x77,
+  0xf5, 0xac, 0xb0, 0x6b, 0x59, 0xac, 0xc1, 0x8d, 0x60, 0x3c, 0x3f, 0x85, 0xad, 0x2c, 0xb4, 0x00,
+  0x6b, 0x35, 0xb5, 0xeb, 0x6b, 0xc6, 0x33, 0x1a, 0xcb, 0xff, 0xff, 0x44, 0x63, 0x31, 0x98, 0xc6,
+  0x6b, 0xfe, 0xfe, 0xd3, 0x2c, 0x58, 0x0b, 0x00, 0xd6, 0xb6, 0xb5, 0xeb, 0x33, 0x5e, 0x0d, 0x0e,
+  0x60, 0xc1, 0xa6, 0x8f, 0xff, 0x86, 0xd6, 0xc3, 0x30, 0xc0, 0x68, 0xd1, 0x64, 0x16, 0xb4, 0xd3,
+  0x59, 0x7a, 0x61, 0x81, 0xa6, 0xb5, 0xa0, 0xb5, 0xa2, 0xd6, 0x81, 0x62, 0xd6, 0xb6, 0x0e, 0x0e,
+  0x59, 0x62, 0xc5, 0xbf, 0xff, 0xbe, 0xcb, 0x35, 0xb1, 0x99, 0xe3, 0xcd, 0xb3, 0x67, 0xaf, 0x5f,
+  0x7f, 0xff, 0xb1, 0x59, 0x86, 0xc7, 0x99, 0xe6, 0x79, 0xb6, 0x67, 0xaf, 0x5e, 0x35, 0xeb, 0x00,
+  0x1f, 0xff, 0xfe, 0xdf, 0xcc, 0x66, 0xcd, 0x9b, 0x3c, 0x79, 0x9e, 0xbc, 0xba, 0xc2, 0x30, 0x6b,
+  0xfe, 0xff, 0xb6, 0x78, 0xf3, 0xd7, 0xb3, 0x36, 0x1f, 0xff, 0xf8, 0xd9, 0x35, 0xac, 0x5b, 0x4c,
+  0xb6, 0xbf, 0xee, 0xbd, 0x7a, 0xd9, 0x99, 0x99, 0xb5, 0xe1, 0xb5, 0xb5, 0xac, 0x00, 0x1d, 0xd6,
+  0x96, 0x9a, 0x58, 0x03, 0x4e, 0x35, 0x15, 0x4c, 0xdf, 0xff, 0x69, 0xac, 0x35, 0xb5, 0x98, 0xc6,
+  0x33, 0x1f, 0xff, 0xf7, 0x63, 0x18, 0x6b, 0x1a, 0xd6, 0x06, 0x98, 0x19, 0x7a, 0xd6, 0xd6, 0xd6,
+  0x33, 0x5f, 0xdf, 0x6b, 0x58, 0xbd, 0x19, 0x7a, 0x66, 0xb6, 0xb0, 0xd6, 0x07, 0xc8, 0x6c, 0x5a,
+  0x0b, 0x5a, 0x0b, 0x06, 0xb1, 0x87, 0xac, 0xda, 0xf5, 0xb1, 0x8d, 0x6d, 0xff, 0x7f, 0xff, 0xe6,
+  0x86, 0xd6, 0x66, 0x63, 0x19, 0xad, 0xff, 0xfd, 0xcd, 0x62, 0xc1, 0x60, 0xb0, 0x0d, 0x63, 0x5b,
+  0x5b, 0x18, 0x14, 0x16, 0x61, 0xac, 0x69, 0xa1, 0xfd, 0xf3, 0x31, 0x98, 0xd6, 0xd6, 0x06, 0x80,
+  0x5a, 0x0b, 0x5a, 0x34, 0xd6, 0x1a, 0xcd, 0x60, 0x6b, 0x4d, 0x02, 0x68, 0xb4, 0xd0, 0xb2, 0xcb,
+  0x5a, 0xd7, 0xf7, 0xf9, 0x65, 0x81, 0x67, 0xfd, 0xff, 0x5a, 0xcd, 0x6d, 0x7a, 0xf1, 0xb6, 0xcd,
+  0xb3, 0x6c, 0xcd, 0xfd, 0xff, 0xfe, 0xcb, 0x66, 0xbd, 0x6c, 0xcd, 0xb3, 0x6c, 0xf3, 0x66, 0xcc,
+  0xd8, 0xc6, 0x00, 0x3b, 0xff, 0xff, 0xc2, 0xf5, 0xb5, 0xe3, 0xc6, 0xdb, 0x36, 0x6d, 0x8f, 0x2b,
+  0xad, 0x3d, 0x60, 0xd3, 0xff, 0xfa, 0xcf, 0x1e, 0x78, 0xf3, 0x36, 0x6f, 0xff, 0xfc, 0x02, 0xd6,
+  0x59, 0x66, 0x99, 0x6d, 0x37, 0xff, 0xf5, 0xeb, 0xd6, 0xcc, 0x7a, 0xd9, 0x99, 0x8c, 0xd6, 0xd6,
+  0x58, 0x02, 0xfb, 0x4b, 0x45, 0xad, 0x0d, 0x1a, 0xc3, 0x9d, 0x75, 0x7e, 0x7b, 0xbf, 0xad, 0x60,
+  0x60, 0xda, 0xcc, 0x36, 0x1b, 0xff, 0xbf, 0xf8, 0xc3, 0x5b, 0x58, 0x19, 0x60, 0xd6, 0xb0, 0x6b,
+  0x6b, 0x5e, 0xb0, 0xda, 0xcd, 0x3f, 0xfe, 0x6b, 0x2c, 0x1a, 0xc1, 0x9a, 0xcd, 0x66, 0xb5, 0x84,
+  0x04, 0x56, 0x5a, 0x6e, 0xc4, 0x00, 0xb1, 0xad, 0x7a, 0xcc, 0x66, 0x66, 0x63, 0x18, 0x7f, 0xdf,
+  0xff, 0xf9, 0x3a, 0xda, 0xf5, 0x98, 0xd8, 0xc6, 0x6b, 0x5f, 0xff, 0xd6, 0xb2, 0xc1, 0x61, 0x61,
+  0x60, 0x6b, 0x1a, 0xd8, 0xc6, 0x07, 0x08, 0xbd, 0x61, 0x80, 0xd0, 0x5f, 0xfd, 0x98, 0xcc, 0x31,
+  0xac, 0x34, 0x01, 0x68, 0x5a, 0xd0, 0xd3, 0x58, 0x30, 0xcb, 0x68, 0xd1, 0xa2, 0xc8, 0x16, 0x81,
+  0x65, 0x96, 0xb5, 0xab, 0xdb, 0xdc, 0x58, 0x00, 0xef, 0xff, 0xfc, 0x06, 0x5b, 0x59, 0x99, 0xb3,
+  0x67, 0x99, 0xe6, 0xcd, 0x9f, 0xdf, 0xff, 0xed, 0x01, 0x98, 0xdb, 0x33, 0xcd, 0xb3, 0x6c, 0xdb,
+  0x1b, 0x19, 0xad, 0x80, 0x3f, 0xff, 0xbf, 0xfb, 0x31, 0x9b, 0x36, 0x6c, 0xdb, 0x63, 0xcc, 0x50,
+  0x53, 0xc6, 0x0d, 0x3b, 0xff, 0xed, 0x9b, 0x67, 0x8f, 0x33, 0x67, 0xfd, 0xf1, 0x65, 0x80, 0x6b,
+  0x06, 0xb7, 0xdf, 0xfd, 0xeb, 0xd6, 0xc7, 0xad, 0x8d, 0x8d, 0x86, 0xd6, 0x6b, 0x2c, 0x0e, 0x49,
+  0xbb, 0x5a, 0x2c, 0xb5, 0xad, 0x61, 0x9d, 0x6c, 0xed, 0x33, 0x5f, 0xf6, 0x58, 0x6b, 0x0c, 0x33,
+  0x0d, 0xac, 0xdf, 0xff, 0xf7, 0xf1, 0x83, 0x1a, 0xc6, 0xb5, 0x80, 0x6b, 0x06, 0x0c, 0x31, 0x8c,
+  0x6b, 0xdf, 0xff, 0x76, 0xb5, 0x80, 0x60, 0xc6, 0x18, 0x32, 0xc4, 0x24, 0x59, 0x6b, 0x45, 0xad,
+  0x02, 0xcb, 0x0d, 0x63, 0x31, 0x99, 0x99, 0x8c, 0x61, 0xff, 0xf7, 0xff, 0xf3, 0x1a, 0xf5, 0xeb,
+  0x63, 0x31, 0x9a, 0xdb, 0xfb, 0xff, 0xed, 0x62, 0xc0, 0xb1, 0x65, 0x96, 0x0d, 0x63, 0x18, 0xcc,
+  0x0a, 0x0b, 0x86, 0x6b, 0x00, 0x05, 0xdf, 0x63, 0x30, 0xc6, 0xb0, 0x68, 0x16, 0xb4, 0x2d, 0x34,
+  0x34, 0xd6, 0x32, 0xda, 0xc0, 0x34, 0x0b, 0x40, 0xb4, 0x0b, 0x5a, 0xd6, 0xb5, 0xad, 0x77, 0x78,
+  0x58, 0x03, 0x47, 0xff, 0xfe, 0x16, 0x98, 0xc6, 0x3c, 0x78, 0xf3, 0x6d, 0x9b, 0x36, 0x77, 0xff,
+  0xfb, 0x60, 0x66, 0x36, 0xcc, 0xf3, 0x6c, 0xf3, 0x36, 0xc6, 0xcc, 0x30, 0x02, 0xff, 0xff, 0xf1,
+  0xb3, 0x5e, 0x36, 0x67, 0x99, 0xb6, 0x6d, 0x8f, 0x24, 0xa6, 0xdb, 0x58, 0xd0, 0xfe, 0xfe, 0xcd,
+  0xb3, 0xc7, 0x99, 0xb7, 0xdf, 0xf0, 0x16, 0x0d, 0x30, 0x1a, 0xcf, 0xfe, 0xec, 0x6c, 0x6d, 0x78,
+  0xcd, 0xaf, 0x5b, 0x0c, 0x32, 0xcb, 0xa1, 0x16, 0x96, 0x9a, 0x16, 0x03, 0x59, 0xe2, 0xe2, 0xe5,
+  0xb7, 0x7c, 0x03, 0x58, 0xd6, 0x61, 0x8c, 0xc7, 0xdf, 0xff, 0xd6, 0xd6, 0x35, 0xb5, 0xac, 0xd6,
+  0xb1, 0x7a, 0x35, 0x97, 0xa6, 0x18, 0xd7, 0xac, 0x63, 0x1d, 0xff, 0xda, 0xd6, 0x58, 0x6b, 0x0c,
+  0x6b, 0x6b, 0x1a, 0xd6, 0x21, 0x23, 0x5a, 0x68, 0xb4, 0xd2, 0xcb, 0x2c, 0x1a, 0xda, 0xd8, 0xcc,
+  0xcc, 0x6c, 0x30, 0xff, 0xff, 0xc6, 0xff, 0xe3, 0x35, 0xeb, 0x63, 0x33, 0x19, 0x86, 0xff, 0xfb,
+  0xe2, 0xc0, 0xb1, 0x65, 0x96, 0xb2, 0xcd, 0x33, 0x5b, 0x0d, 0x80, 0x80, 0xec, 0x63, 0x58, 0x01,
+  0x64, 0xee, 0xd6, 0xc3, 0x19, 0x63, 0x40, 0x5a, 0x6a, 0xc9, 0xa0, 0xd3, 0x58, 0xd6, 0x6b, 0x58,
+  0x34, 0x16, 0xb4, 0x2d, 0x35, 0x65, 0xad, 0x69, 0xad, 0x6b, 0x5d, 0x5d, 0x96, 0x1a, 0x34, 0x6f,
+  0xff, 0xfc, 0x44, 0xc3, 0x33, 0x36, 0x6c, 0xf3, 0x66, 0xf5, 0xe6, 0x3f, 0xff, 0xdc, 0x06, 0xbd,
+  0x6c, 0xcd, 0xb6, 0x6d, 0x9b, 0xd7, 0x9b, 0x31, 0xeb, 0x30, 0x01, 0xff, 0xf7, 0xff, 0xd8, 0x6c,
+  0x6c, 0xcf, 0x33, 0x6c, 0xdb, 0x19, 0x0d, 0x1b, 0x18, 0x1a, 0x3f, 0xfe, 0x66, 0xcd, 0xb6, 0x66,
+  0xdf, 0xff, 0xc0, 0x01, 0xa6, 0x03, 0x5a, 0xd7, 0xff, 0xd8, 0xd8, 0xcc, 0xcc, 0xcc, 0x66, 0x35,
+  0xb5, 0xac, 0xff, 0xee, 0x44, 0x26, 0xac, 0xb4, 0x68, 0x6b, 0x58, 0xf7, 0x7b, 0x7b, 0xb2, 0xfb,
+  0x46, 0x98, 0x18, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0xfb, 0xfe, 0xc6, 0xb6, 0xb0, 0xc0, 0xd6, 0x00,
+  0xcb, 0x35, 0xaf, 0x58, 0x66, 0xbd, 0x63, 0x1b, 0xff, 0xee, 0x6b, 0x58, 0x1a, 0xc6, 0x18, 0xd6,
+  0x69, 0xa2, 0x22, 0x4b, 0x4d, 0x16, 0xb4, 0x16, 0x5a, 0xc0, 0xc6, 0x33, 0x33, 0x31, 0xb0, 0xc3,
+  0xff, 0xff, 0x07, 0xe6, 0xb6, 0xb6, 0x33, 0x33, 0x19, 0x8d, 0x6f, 0xff, 0xee, 0xb0, 0x0b, 0x2c,
+  0xb5, 0xad, 0x6b, 0x06, 0x35, 0xeb, 0x30, 0x04, 0x05, 0x86, 0x35, 0x80, 0x5a, 0xd0, 0xa5, 0x98,
+  0x30, 0x9a, 0xcc, 0x76, 0xb4, 0xb5, 0xa6, 0x81, 0xac, 0x18, 0x35, 0x80, 0x16, 0x40, 0x9a, 0xb1,
+  0x69, 0xa6, 0x9a, 0x6b, 0x5d, 0x5d, 0x60, 0x34, 0xd3, 0x5b, 0xff, 0xff, 0x1b, 0xb5, 0xad, 0x86,
+  0xcd, 0x9b, 0x3c, 0xd9, 0xe6, 0x6d, 0xaf, 0xff, 0xf7, 0x5f, 0x8d, 0x6c, 0xcc, 0xdb, 0x66, 0xd9,
+  0xe6, 0x78, 0xd9, 0x98, 0xc0, 0x07, 0xff, 0xff, 0x95, 0x86, 0xc6, 0xcd, 0x9b, 0x36, 0xcf, 0x5e,
+  0x3c, 0x7a, 0x81, 0x8c, 0x0d, 0x17, 0xff, 0x36, 0xd9, 0xb3, 0x6c, 0xff, 0xa9, 0xa0, 0x34, 0xd6,
+  0x0d, 0x6b, 0x2d, 0xff, 0x71, 0x9b, 0x5b, 0x31, 0xeb, 0x36, 0xb6, 0x18, 0x32, 0xff, 0xf8, 0x89,
+  0xbb, 0x20, 0x2c, 0xb5, 0xac, 0x07, 0xec, 0x2c, 0x27, 0x97, 0xda, 0x6b, 0x58, 0x30, 0x63, 0x0d,
+  0xad, 0xff, 0xff, 0x8c, 0xc3, 0x18, 0x35, 0x9a, 0x65, 0x81, 0xad, 0x63, 0x59, 0xac, 0xc3, 0x30,
+  0xcd, 0x77, 0xff, 0x69, 0xac, 0xb3, 0x4c, 0x60, 0xcd, 0x63, 0x4c, 0x44, 0x49, 0x68, 0x0b, 0x40,
+  0xb5, 0x96, 0xb1, 0xac, 0xc6, 0x66, 0x63, 0xd6, 0xd7, 0xac, 0x3f, 0xff, 0xef, 0x63, 0x5e, 0xb3,
+  0x33, 0x33, 0x35, 0xeb, 0x6b, 0x1f, 0xff, 0xf7, 0x65, 0x80, 0x5a, 0xd6, 0xb4, 0xd6, 0xb0, 0x63,
+  0x18, 0x00, 0x00, 0x18, 0xc1, 0x8b, 0x0b, 0x40, 0xb4, 0x59, 0x6b, 0x2c, 0xd6, 0x18, 0xcd, 0xf4,
+  0xb4, 0xd0, 0x1a, 0xd6, 0xd3, 0x1a, 0xcb, 0x02, 0xcb, 0x45, 0x90, 0x5a, 0xd3, 0x43, 0x46, 0xb5,
+  0x73, 0x74, 0x03, 0x5a, 0xcb, 0x3f, 0xff, 0xf2, 0x39, 0xac, 0x63, 0x66, 0xcd, 0x9e, 0x6c, 0xf3,
+  0x66, 0x6f, 0xff, 0xf7, 0xaf, 0xfe, 0x30, 0xd9, 0xb3, 0x3c, 0xdb, 0x66, 0xd9, 0xb3, 0x33, 0x18,
+  0x01, 0xff, 0x7f, 0xff, 0xf6, 0x30, 0xd8, 0xf5, 0xe3, 0xc7, 0x9b, 0x36, 0x6c, 0x38, 0x3b, 0x6d,
+  0x61, 0xa0, 0xfb, 0xfb, 0xcc, 0xdb, 0x66, 0x5f, 0xd6, 0x9a, 0x1a, 0xd6, 0xb0, 0x6b, 0x5a, 0xc7,
+  0x7f, 0xc6, 0x66, 0x36, 0x33, 0x33, 0x0d, 0xac, 0x35, 0xdf, 0xf1, 0x09, 0xbb, 0x2d, 0x00, 0x16,
+  0xd3, 0x50, 0x38, 0xd8, 0xcd, 0xae, 0x5a, 0xc5, 0xb4, 0xd6, 0x65, 0xeb, 0x35, 0xeb, 0xfb, 0xff,
+  0xe6, 0x35, 0x99, 0x7a, 0xd6, 0x35, 0xac, 0xb1, 0xa6, 0xb1, 0xac, 0xd6, 0x61, 0x98, 0xc3, 0x3f,
+  0xff, 0xa6, 0x99, 0x61, 0xac, 0xd6, 0x61, 0xac, 0x68, 0x46, 0x48, 0xd0, 0x2d, 0x01, 0x6b, 0x5a,
+  0xc1, 0x86, 0x66, 0x66, 0x3d, 0x6d, 0x6c, 0xbd, 0xdf, 0xff, 0xf7, 0x36, 0x6b, 0xd6, 0x66, 0x63,
+  0xd6, 0xc6, 0x30, 0xef, 0xff, 0xe0, 0x05, 0x96, 0xb4, 0x68, 0xd6, 0x0c, 0x66, 0x00, 0x00, 0x01,
+  0xb5, 0x9a, 0xd6, 0x2d, 0x68, 0x26, 0x96, 0x5a, 0xd6, 0x06, 0x30, 0xcd, 0x7b, 0xbe, 0xb4, 0x03,
+  0x4c, 0x1a, 0xcd, 0x6b, 0x16, 0x2d, 0x68, 0x5a, 0x0b, 0x4d, 0x01, 0xa3, 0x5a, 0xb9, 0xba, 0x03,
+  0x59, 0x61, 0x7f, 0xff, 0x7c, 0x6b, 0x33, 0x1b, 0x3c, 0x79, 0xe6, 0x79, 0xb3, 0x37, 0xf7, 0xff,
+  0xfb, 0xc9, 0xaf, 0x5b, 0x33, 0x6d, 0x9b, 0x67, 0x9b, 0x36, 0x66, 0x63, 0x00, 0x3f, 0xff, 0xfd,
+  0x3e, 0xd6, 0x63, 0x66, 0x6c, 0xdb, 0x36, 0x6c, 0xd8, 0x64, 0x6d, 0x66, 0x03, 0x45, 0xfc, 0x67,
+  0x8f, 0x33, 0xfa, 0xb5, 0xad, 0x35, 0xac, 0xb3, 0x46, 0xb2, 0xc3, 0xff, 0xa6, 0x63, 0x36, 0xbd,
+  0x6c, 0xd7, 0xaf, 0x58, 0xc1, 0xbf, 0xef, 0x96, 0x8b, 0x41, 0x64, 0xd0, 0xd1, 0xac, 0x42, 0xe5,
+  0x65, 0x1e, 0x7c, 0xb0, 0x06, 0xb1, 0xac, 0xd6, 0xd6, 0xdf, 0xff, 0xf9, 0xd4, 0xcd, 0x6d, 0x61,
+  0xac, 0x69, 0x96, 0x06, 0xb2, 0xf4, 0xcd, 0x66, 0x1b, 0x59, 0x8c, 0x7f, 0xdf, 0xda, 0x6b, 0x58,
+  0x35, 0xb5, 0x8c, 0x6b, 0x06, 0x23, 0x24, 0x68, 0x59, 0x1b, 0xb1, 0x6b, 0x5a, 0xc0, 0xcc, 0x3d,
+  0x6c, 0xcc, 0x6d, 0x6d, 0x67, 0x7f, 0xff, 0xda, 0x60, 0xd8, 0x6c, 0xcc, 0xc6, 0xd7, 0xac, 0x37,
+  0xfd, 0xff, 0xc0, 0x0b, 0x5a, 0xd0, 0x68, 0xd6, 0x30, 0xcc, 0x00, 0x00, 0x03, 0x6b, 0x69, 0xad,
+  0x6b, 0x41, 0x68, 0x59, 0x69, 0x96, 0x6b, 0x0c, 0xc6, 0x1a, 0xff, 0xb4, 0x01, 0xac, 0x30, 0x35,
+  0x96, 0x5a, 0xd0, 0x20, 0x26, 0x80, 0x03, 0x5a, 0xb9, 0xba, 0x0d, 0x6b, 0x00, 0xff, 0xff, 0xcc,
+  0xe1, 0x86, 0xd7, 0x99, 0xb6, 0xcd, 0xb6, 0xcc, 0xf1, 0xb7, 0xff, 0xfb, 0xf9, 0x86, 0xcc, 0xf5,
+  0xec, 0xdb, 0x3c, 0xcf, 0x33, 0x33, 0x18, 0x03, 0xbf, 0xff, 0xfb, 0xb6, 0xb6, 0xb6, 0x66, 0x6c,
+  0xdb, 0x36, 0x6c, 0xd8, 0x5c, 0x62, 0xcc, 0x06, 0x89, 0xfc, 0xcf, 0x33, 0x6e, 0xf8, 0x5a, 0xd6,
+  0xb2, 0xc1, 0xa6, 0xb5, 0x8b, 0x3e, 0xfe, 0x63, 0x33, 0x31, 0xb1, 0x8d, 0xac, 0xd6, 0x6b, 0xff,
+  0x9d, 0x90, 0x4d, 0x0b, 0x2d, 0x6b, 0x59, 0x63, 0x44, 0xe7, 0x66, 0xe6, 0xd7, 0x00, 0x35, 0x83,
+  0x0c, 0x35, 0xff, 0xff, 0x9e, 0xd6, 0x31, 0xac, 0xd6, 0x06, 0xb5, 0x80, 0xd6, 0x1a, 0xda, 0xcc,
+  0x6b, 0xd6, 0xd6, 0xc2, 0xff, 0xfe, 0x34, 0xd6, 0xb3, 0x5a, 0xf5, 0x86, 0x32, 0xcd, 0x11, 0x92,
+  0x00, 0xb4, 0xd5, 0x96, 0x4d, 0x65, 0x8c, 0x33, 0x31, 0xb3, 0x1b, 0x5b, 0x59, 0xfd, 0xff, 0xff,
+  0x60, 0xc6, 0xbd, 0x6c, 0xc7, 0xad, 0x98, 0xcc, 0x31, 0xff, 0xfd, 0xf6, 0x81, 0x65, 0xa0, 0x06,
+  0x98, 0x6b, 0xd6, 0xc0, 0x00, 0x00, 0x1b, 0x06, 0x9a, 0x69, 0x64, 0xdd, 0x8b, 0x4d, 0x6b, 0x0d,
+  0x6d, 0x66, 0x31, 0x8d, 0xfd, 0xf0, 0x06, 0xb0, 0xd6, 0x1a, 0xcb, 0x5a, 0xd0, 0x5a, 0x0b, 0x40,
+  0x0b, 0x0d, 0x32, 0xe6, 0xe8, 0xd6, 0xb0, 0x06, 0xff, 0xff, 0xce, 0xec, 0xd6, 0x33, 0x66, 0x6d,
+  0x9e, 0x6d, 0x9b, 0x6c, 0x6d, 0xff, 0xff, 0x0d, 0xff, 0xc6, 0x63, 0xd7, 0x99, 0xe6, 0xdb, 0x36,
+  0xcd, 0x99, 0x99, 0xa0, 0x0f, 0xff, 0xef, 0xfe, 0x31, 0x99, 0x99, 0xb6, 0x66, 0xdb, 0x1e, 0x31,
+  0x49, 0x66, 0xbd, 0x61, 0xa0, 0x57, 0xd9, 0xe6, 0x6d, 0xfd, 0x05, 0x96, 0x2c, 0x34, 0xd6, 0xb5,
+  0x8b, 0x2f, 0xfe, 0x36, 0xbd, 0x6c, 0x66, 0xd6, 0xc6, 0x33, 0x58, 0x7f, 0xf4, 0x5a, 0x16, 0x46,
+  0x85, 0x85, 0x86, 0xb4, 0x76, 0x8e, 0x86, 0x66, 0xe8, 0xd1, 0xa6, 0x5b, 0x4c, 0xd6, 0x37, 0xfd,
+  0xff, 0xc6, 0x18, 0x61, 0xac, 0x1a, 0xd6, 0x01, 0x96, 0xd6, 0x35, 0xeb, 0x31, 0x8c, 0x66, 0xbf,
+  0xfb, 0xe1, 0xa6, 0xb0, 0xc1, 0x9a, 0xcd, 0x60, 0x23, 0x24, 0x05, 0x93, 0x4b, 0x2d, 0x6b, 0x5a,
+  0xc3, 0x5b, 0x0f, 0x5b, 0x1b, 0x1b, 0x5b, 0x59, 0xff, 0xf7, 0xff, 0xfd, 0x5e, 0xb3, 0x5b, 0x31,
+  0xb3, 0x33, 0x19, 0x8d, 0x6d, 0x7f, 0xff, 0xde, 0x5a, 0x05, 0xad, 0x00, 0x5b, 0x4c, 0x31, 0x98,
+  0x00, 0x00, 0x03, 0xcb, 0x68, 0x68, 0xb2, 0x02, 0x6b, 0x4d, 0x61, 0xad, 0xad, 0xad, 0xaf, 0x58,
+  0xcb, 0xff, 0x80, 0x6b, 0x06, 0x06, 0xb5, 0xad, 0x02, 0xd0, 0x20, 0x0b, 0x2c, 0x1a, 0xd5, 0xd5,
+  0xd9, 0xad, 0x63, 0x46, 0xb7, 0xff, 0xfe, 0x85, 0x86, 0x33, 0x63, 0xcc, 0xf3, 0x7a, 0xf6, 0x6c,
+  0xd9, 0xbf, 0xef, 0xff, 0xf8, 0x5d, 0x66, 0x36, 0x7a, 0xf6, 0x6c, 0xf3, 0x6c, 0xd9, 0xb5, 0xeb,
+  0x60, 0x07, 0xff, 0xff, 0x89, 0xad, 0x8c, 0xcd, 0x99, 0xb6, 0x6c, 0xdb, 0x18, 0x94, 0xa1, 0x98,
+  0x1a, 0x0b, 0x7f, 0x1e, 0x3c, 0xba, 0xd0, 0xb0, 0x03, 0x5a, 0xd6, 0xb2, 0xcb, 0x3f, 0xfa, 0x66,
+  0x33, 0x6b, 0x66, 0x31, 0xb5, 0x99, 0x7b, 0xbf, 0xfb, 0x56, 0x40, 0x2d, 0x34, 0x34, 0x0d, 0x64,
+  0x96, 0xa6, 0x9b, 0x66, 0x7d, 0xa6, 0xb4, 0xd6, 0x0c, 0x18, 0xdf, 0xff, 0xfb, 0x3c, 0x61, 0xaf,
+  0x5a, 0xf4, 0xcb, 0x68, 0xcb, 0x01, 0xac, 0x6b, 0x30, 0xcc, 0x66, 0xbd, 0x66, 0xbb, 0xff, 0xe0,
+  0x69, 0x83, 0x0c, 0x33, 0x4c, 0x08, 0xc9, 0x05, 0x96, 0x9a, 0xb1, 0x6b, 0x4d, 0x60, 0x66, 0xbd,
+  0x6c, 0x6c, 0x6d, 0x7a, 0xcc, 0x7f, 0xff, 0xd6, 0xff, 0xfc, 0x66, 0xb6, 0x36, 0x66, 0x63, 0xd6,
+  0xd6, 0xd6, 0x6a, 0xff, 0xff, 0xbd, 0x80, 0x5a, 0x01, 0x60, 0x30, 0xcc, 0x60, 0x10, 0x00, 0x1b,
+  0x2c, 0x01, 0x69, 0xab, 0x2d, 0x34, 0xd6, 0xb1, 0x86, 0x31, 0x98, 0xc3, 0x7f, 0xff, 0x03, 0x4c,
+  0x18, 0x0d, 0x34, 0xd1, 0x6b, 0x45, 0xad, 0x0b, 0x2d, 0x65, 0x83, 0x5a, 0xee, 0xf0, 0xd6, 0x0d,
+  0x6b, 0x4f, 0xff, 0xfd, 0x1d, 0x66, 0xb3, 0x33, 0x66, 0xd9, 0xe6, 0xd9, 0xbd, 0x79, 0x8f, 0x7f,
+  0xff, 0xc6, 0x2c, 0xc6, 0xcd, 0xb3, 0xc7, 0xb3, 0x6c, 0xd9, 0x99, 0x80, 0x0f, 0xfe, 0xff, 0xfe,
+  0x6b, 0x31, 0x9b, 0x1e, 0xbc, 0xd9, 0xb3, 0xd7, 0x8c, 0x42, 0x48, 0xcc, 0x0d, 0x02, 0xbb, 0x36,
+  0x6b, 0xad, 0x00, 0xd0, 0xd3, 0x59, 0x6b, 0x2c, 0xb3, 0xfe, 0xe3, 0x63, 0x31, 0xb1, 0x8d, 0x86,
+  0x31, 0x7f, 0xd0, 0xb4, 0xd0, 0xb1, 0x6b, 0x5a, 0x6b, 0x58, 0x4b, 0xeb, 0xeb, 0x1b, 0x66, 0xfe,
+  0xd6, 0xb5, 0xac, 0xb6, 0x98, 0x61, 0xff, 0xff, 0xb5, 0x9a, 0xc6, 0xbd, 0x6b, 0x6b, 0x58, 0x69,
+  0xac, 0x06, 0xb0, 0xc3, 0x35, 0xeb, 0x6b, 0xd6, 0x63, 0x5e, 0xff, 0xff, 0x5b, 0x01, 0xad, 0x6d,
+  0x61, 0x9a, 0xcd, 0x6b, 0x08, 0xc9, 0x2c, 0x2d, 0x1a, 0xb1, 0x69, 0xad, 0x60, 0x66, 0xb6, 0x36,
+  0x33, 0x6b, 0xd6, 0x6b, 0x7f, 0xff, 0xd4, 0x7f, 0xcd, 0x6d, 0x6c, 0x6c, 0xc7, 0xaf, 0x5e, 0xb6,
+  0x35, 0xb5, 0x9f, 0xf7, 0xff, 0x40, 0x5a, 0x05, 0x96, 0xb0, 0xd6, 0x63, 0x30, 0x10, 0x08, 0x0c,
+  0xcb, 0x0b, 0x2d, 0x02, 0xd6, 0x86, 0x98, 0x19, 0xaf, 0x59, 0xaf, 0x5b, 0x5b, 0x59, 0xff, 0xdc,
+  0x0d, 0x61, 0x96, 0x68, 0xd0, 0x09, 0xab, 0x26, 0xac, 0x5a, 0xd6, 0xb2, 0xcd, 0x6a, 0xf2, 0xf5,
+  0xac, 0x1a, 0xd6, 0x3e, 0xff, 0xff, 0xd3, 0xd6, 0x19, 0x99, 0xb3, 0x67, 0x9b, 0x6d, 0x9b, 0x36,
+  0x67, 0xff, 0xdf, 0xff, 0xf1, 0xac, 0xc6, 0xd8, 0xf3, 0xc7, 0x9e, 0x67, 0x8f, 0x5e, 0xbd, 0x60,
+  0x07, 0xff, 0xff, 0xa7, 0xc6, 0x31, 0xb1, 0xb6, 0x37, 0xaf, 0x1e, 0x66, 0xc1, 0xd2, 0x0c, 0x30,
+  0xd3, 0x45, 0xae, 0xbc, 0x79, 0xd2, 0xd3, 0x46, 0x9a, 0x6b, 0x59, 0x6b, 0x2d, 0x65, 0xbf, 0xbf,
+  0xb6, 0x31, 0xb1, 0x99, 0x8c, 0xc6, 0x18, 0xff, 0xf9, 0xab, 0x2d, 0x68, 0x00, 0xb5, 0x96, 0x0d,
+  0x39, 0xb5, 0xb0, 0xf3, 0x36, 0x7f, 0x65, 0xac, 0xb0, 0x6b, 0x18, 0xfe, 0xff, 0xe0, 0xc6, 0x1a,
+  0xcd, 0x60, 0x35, 0xac, 0x06, 0x0d, 0x6c, 0x33, 0x19, 0x8c, 0x6b, 0xdf, 0xfd, 0xff, 0xd8, 0x06,
+  0xb1, 0x86, 0x18, 0xd6, 0xb1, 0x19, 0x1e, 0x2d, 0x69, 0xa5, 0x96, 0xb5, 0xad, 0x60, 0x66, 0xb6,
+  0x33, 0x63, 0x31, 0x8c, 0xff, 0xff, 0xa4, 0xfe, 0xf5, 0xaf, 0x5b, 0x1b, 0x1e, 0xbd, 0x78, 0xcc,
+  0x61, 0x87, 0xff, 0xdf, 0xf6, 0x85, 0xad, 0x2c, 0xb5, 0xad, 0x60, 0xc6, 0x60, 0x10, 0x0b, 0x01,
+  0xb4, 0xd6, 0x5a, 0xd0, 0x16, 0x9a, 0x0d, 0x6b, 0x35, 0x9a, 0xf5, 0x98, 0xcd, 0x7a, 0x66, 0xff,
+  0xfb, 0x86, 0xb5, 0x9a, 0xd6, 0x34, 0x01, 0x6b, 0x56, 0x4d, 0x59, 0x6b, 0x5a, 0x6b, 0x03, 0x2f,
+  0x6f, 0xe6, 0x0d, 0x62, 0xcf, 0xef, 0xff, 0xfd, 0x56, 0xb3, 0x5b, 0x33, 0x36, 0xd9, 0xe6, 0xcf,
+  0x36, 0xcc, 0xcb, 0xff, 0xfe, 0x53, 0x0d, 0x99, 0xb3, 0xcc, 0xf6, 0x6c, 0xf5, 0xe6, 0x66, 0x00,
+  0x7d, 0xff, 0xff, 0xdc, 0xd6, 0x33, 0x1e, 0xb6, 0xcc, 0xd9, 0xb6, 0x66, 0x61, 0xa1, 0xdd, 0x7a,
+  0xc3, 0x4d, 0x0b, 0x7c, 0x6c, 0xdc, 0xac, 0xb5, 0xa6, 0xb5, 0x96, 0xb2, 0xcb, 0x5a, 0xd6, 0xbe,
+  0xf8, 0xc6, 0xc6, 0x63, 0x6b, 0xd6, 0xc3, 0x35, 0x9f, 0xfc, 0x82, 0xcb, 0x4d, 0x34, 0x05, 0x86,
+  0x9a, 0x7b, 0x6f, 0x67, 0x33, 0xd7, 0x8e, 0xec, 0xb2, 0xc1, 0xac, 0x6b, 0x7f, 0xf7, 0xfd, 0x8d,
+  0x6d, 0x63, 0x59, 0xac, 0xb6, 0x8d, 0x6b, 0x06, 0xb5, 0xe9, 0x8c, 0xd7, 0xac, 0xcc, 0x66, 0xbd,
+  0x5f, 0xff, 0xec, 0x16, 0x2c, 0x6b, 0x0c, 0x33, 0x58, 0x6b, 0x11, 0x91, 0xe5, 0xad, 0x34, 0x59,
+  0x64, 0xd6, 0xb0, 0x6b, 0x6b, 0x63, 0x33, 0x33, 0x18, 0xd7, 0xff, 0xfc, 0xfc, 0x63, 0x19, 0xb3,
+  0x1e, 0x33, 0x6b, 0xd6, 0x6b, 0x07, 0xff, 0xfe, 0x37, 0xcd, 0x59, 0x02, 0xd3, 0x4d, 0x6b, 0x6b,
+  0x35, 0xe0, 0x18, 0x16, 0xcc, 0x30, 0xd3, 0x5a, 0x02, 0xd3, 0x40, 0x6b, 0x59, 0xac, 0xc6, 0x31,
+  0x98, 0xd6, 0x6b, 0xfe, 0xf8, 0x30, 0x35, 0x80, 0x02, 0x69, 0x6b, 0x42, 0xd6, 0x9a, 0x35, 0x96,
+  0xd3, 0x5f, 0xe0, 0x6b, 0x0d, 0x60, 0x3f, 0xfb, 0xff, 0xf8, 0xc1, 0xeb, 0x66, 0x6d, 0x9e, 0x6d,
+  0xb3, 0xcc, 0xd9, 0x9b, 0xff, 0xfe, 0x73, 0xff, 0xb3, 0x1b, 0x36, 0xcd, 0xb3, 0xcd, 0x9e, 0xbc,
+  0xcc, 0x00, 0x3f, 0xff, 0xbf, 0xf8, 0xc6, 0xbc, 0x3d, 0x78, 0xdb, 0x33, 0x6c, 0xcc, 0xf0, 0xb8,
+  0xd6, 0x18, 0xd3, 0x4d, 0x59, 0xf1, 0xb3, 0x3e, 0x05, 0x96, 0xb2, 0xc5, 0x8b, 0x5a, 0xd6, 0xb4,
+  0xfb, 0xeb, 0x63, 0x33, 0x19, 0x99, 0xaf, 0x5e, 0xb1, 0xaf, 0x7f, 0xf7, 0x34, 0x2c, 0x59, 0x6b,
+  0x4d, 0x03, 0x4d, 0x7f, 0x4e, 0x6e, 0xed, 0xb6, 0x67, 0x8d, 0xf4, 0xb1, 0x61, 0xac, 0x35, 0xff,
+  0xfd, 0x06, 0x18, 0xcb, 0xd3, 0x58, 0x69, 0xad, 0x61, 0xad, 0x6d, 0x63, 0x19, 0x8c, 0xc6, 0x6b,
+  0xd6, 0xff, 0xff, 0x64, 0xe5, 0xac, 0x19, 0x7a, 0xc6, 0x18, 0x34, 0x46, 0x47, 0xad, 0x6b, 0x40,
+  0xb2, 0xd6, 0xb5, 0xac, 0x30, 0xc6, 0x66, 0x66, 0x33, 0x07, 0xff, 0xfc, 0xd6, 0x31, 0x8d, 0x8d,
+  0x99, 0xb1, 0xb1, 0x86, 0x34, 0x7f, 0xff, 0xe4, 0x68, 0xb5, 0xab, 0x26, 0x83, 0x5a, 0xda, 0xcc,
+  0xc0, 0x90, 0x76, 0x31, 0x80, 0x34, 0x2d, 0x68, 0xd0, 0x06, 0x5e, 0xb0, 0xda, 0xf5, 0x98, 0xc6,
+  0x0c, 0xff, 0xfe, 0x8d, 0x60, 0xd6, 0x00, 0xb2, 0xd0, 0xb4, 0x0b, 0x4d, 0x0d, 0x32, 0xcd, 0x6c,
+  0x1c, 0x2d, 0x63, 0x58, 0x34, 0xff, 0xfe, 0xff, 0xe1, 0x8c, 0x6c, 0x79, 0xb3, 0xcd, 0xb3, 0xcd,
+  0xb3, 0x33, 0x7f, 0x7f, 0xff, 0xce, 0xe6, 0x36, 0x6c, 0xf1, 0xec, 0xdb, 0x3c, 0x6c, 0x6c, 0x00,
+  0xff, 0xff, 0xf1, 0xd3, 0x35, 0xb5, 0xe3, 0x36, 0x6c, 0xcf, 0x5e, 0x66, 0xc1, 0x51, 0x86, 0x60,
+  0x6b, 0x5a, 0x5b, 0xbb, 0xc6, 0xcb, 0x9a, 0x58, 0x2c, 0x0b, 0x16, 0xb4, 0xd3, 0x5f, 0xdf, 0x63,
+  0x1b, 0x19, 0x98, 0xda, 0xf5, 0x98, 0xc7, 0xdf, 0xda, 0x00, 0x05, 0x96, 0x9a, 0xd3, 0x3b, 0xf9,
+  0x37, 0xbd, 0xb8, 0x79, 0x9b, 0x36, 0xfb, 0xec, 0x58, 0x1a, 0xc6, 0xbf, 0xff, 0xfa, 0x75, 0x9a,
+  0xcc, 0x18, 0x35, 0x81, 0xad, 0x65, 0x9a, 0xd6, 0xd6, 0x31, 0x8d, 0xaf, 0x5b, 0x1a, 0xf5, 0xbf,
+  0xbf, 0xfe, 0xb5, 0xac, 0x1a, 0xda, 0xcd, 0x6d, 0x60, 0x11, 0x91, 0xeb, 0x4d, 0x00, 0xb5, 0xad,
+  0x6b, 0x01, 0x9a, 0xda, 0xf5, 0xb3, 0x1b, 0x5b, 0x0f, 0xbf, 0xff, 0xe5, 0x83, 0x33, 0x5e, 0x36,
+  0x6c, 0x6c, 0xc6, 0x60, 0xd6, 0xbe, 0xff, 0xff, 0xcb, 0x04, 0x13, 0x40, 0x1a, 0xf5, 0x8d, 0xa0,
+  0xd0, 0xad, 0xaf, 0x58, 0xcb, 0x00, 0xb2, 0x68, 0x2c, 0x1a, 0x63, 0x5b, 0x5b, 0x18, 0xc6, 0x6b,
+  0x69, 0x8f, 0xff, 0xfa, 0x71, 0xac, 0x35, 0x8b, 0x05, 0xad, 0x05, 0xa1, 0x6b, 0x53, 0x5e, 0x0b,
+  0x2f, 0x5a, 0xc3, 0xc5, 0xb0, 0xd6, 0x34, 0xd7, 0xff, 0xff, 0x37, 0xf0, 0xc3, 0x36, 0x3c, 0xcf,
+  0x3c, 0xcf, 0x66, 0xcf, 0x5e, 0x1b, 0xff, 0xfe, 0x97, 0xe3, 0x66, 0x6c, 0xdb, 0x67, 0x99, 0xe6,
+  0x6c, 0x60, 0x07, 0xfd, 0xff, 0xff, 0xd8, 0xcb, 0xd6, 0x63, 0x63, 0x6d, 0x79, 0xb3, 0x66, 0x6c,
+  0x12, 0x15, 0xc6, 0xb6, 0x99, 0x34, 0x3e, 0xbc, 0x6c, 0xdf, 0x5a, 0x01, 0xa0, 0xb1, 0x64, 0xd1,
+  0xa7, 0xfd, 0xcc, 0x6c, 0x63, 0xd6, 0xc6, 0x36, 0x19, 0x8b, 0xfe, 0xb4, 0xd0, 0x68, 0x05, 0x96,
+  0xb2, 0xbf, 0x89, 0xad, 0xfd, 0xcd, 0x99, 0xe3, 0x6d, 0x5f, 0x2c, 0x03, 0x58, 0xbf, 0xff, 0xfa,
+  0xd8, 0x61, 0x86, 0x0d, 0x60, 0x35, 0xac, 0x0d, 0x6d, 0x61, 0xb5, 0xb1, 0x99, 0xaf, 0x5b, 0x59,
+  0xff, 0xfe, 0xd5, 0xcd, 0x32, 0xcd, 0x66, 0xb6, 0xb1, 0x96, 0xd1, 0x19, 0x1e, 0x9a, 0x68, 0x2c,
+  0xb2, 0x65, 0xac, 0x6b, 0x18, 0xcc, 0x66, 0xc6, 0x35, 0xef, 0xff, 0xbf, 0xff, 0xe4, 0x46, 0x1b,
+  0x1b, 0x33, 0x3d, 0x6d, 0xaf, 0x5b, 0x59, 0xac, 0xb3, 0xff, 0xfb, 0xfe, 0x08, 0x5a, 0x0b, 0x03,
+  0x1a, 0xf5, 0xe8, 0x40, 0x37, 0x6b, 0x30, 0xd6, 0x58, 0xb5, 0xa6, 0x96, 0x16, 0x0d, 0x63, 0x5e,
+  0xb1, 0xb5, 0xeb, 0x31, 0xaf, 0x4c, 0x3e, 0xff, 0xe3, 0x58, 0x6b, 0x58, 0x59, 0x69, 0xa5, 0xad,
+  0x2c, 0xb9, 0xad, 0x8c, 0x7a, 0xdc, 0x33, 0x1b, 0x1f, 0x5b, 0x58, 0x1a, 0xd7, 0xff, 0xff, 0x4f,
+  0xf6, 0x35, 0xb1, 0x9b, 0x36, 0x79, 0xb6, 0xd9, 0xe3, 0xcc, 0xda, 0xdf, 0xfd, 0xff, 0xff, 0x4e,
+  0x6c, 0x78, 0xf3, 0x6c, 0xdb, 0x66, 0xcd, 0x8c, 0x00, 0xff, 0xff, 0xf4, 0xeb, 0x0c, 0x66, 0x3d,
+  0x7a, 0xf3, 0x36, 0x6c, 0xcd, 0x82, 0x02, 0x78, 0xc1, 0xac, 0xb4, 0x3f, 0x9e, 0x36, 0x67, 0xd6,
+  0x9a, 0x68, 0xd0, 0x2c, 0x9a, 0x03, 0xff, 0xbb, 0xd6, 0x66, 0x36, 0x33, 0x31, 0x99, 0xaf, 0x58,
+  0xfe, 0xfb, 0x5a, 0xd3, 0x5a, 0x68, 0x01, 0x67, 0xdf, 0x09, 0x9d, 0xfd, 0xcc, 0xf5, 0xe6, 0x6c,
+  0xce, 0xf8, 0xb0, 0x35, 0x8f, 0xbf, 0xfe, 0x61, 0xad, 0xac, 0xd6, 0x1a, 0xcb, 0x34, 0xd6, 0xb0,
+  0x65, 0xeb, 0x5e, 0xb3, 0x35, 0xe3, 0x1b, 0x5b, 0x0f, 0xfe, 0xff, 0xe6, 0x8d, 0x63, 0x59, 0x86,
+  0x1a, 0xc1, 0x19, 0x24, 0xd0, 0xd2, 0xc2, 0xd6, 0xb5, 0x96, 0x35, 0x8c, 0x36, 0x33, 0x6b, 0x61,
+  0x9f, 0xff, 0x7f, 0xff, 0x5b, 0x59, 0x9a, 0xf3, 0x1e, 0x3d, 0x78, 0xcc, 0xc3, 0x16, 0x1f, 0xff,
+  0xfa, 0xfc, 0x4d, 0xd9, 0x0b, 0x2c, 0xb6, 0xb5, 0xeb, 0x60, 0x50, 0x47, 0x19, 0xac, 0x6b, 0x5a,
+  0xd6, 0x80, 0xb2, 0xc5, 0x9a, 0x63, 0x1a, 0xf5, 0xb1, 0x8c, 0x63, 0x58, 0x3f, 0xfb, 0xed, 0x30,
+  0x6b, 0x2c, 0xb2, 0xd0, 0x5a, 0x07, 0xf3, 0x0d, 0x8c, 0x7a, 0xf5, 0xef, 0xe6, 0xb2, 0x32, 0xac,
+  0xd6, 0x1a, 0xd6, 0x7f, 0xff, 0xf5, 0xd8, 0x63, 0x33, 0x66, 0xd9, 0xb6, 0xdb, 0x36, 0xd9, 0x99,
+  0x8f, 0xff, 0xfa, 0xed, 0x6c, 0x78, 0xf3, 0x67, 0x9b, 0x3c, 0x7a, 0xf0, 0x00, 0xef, 0xff, 0xfe,
+  0xfd, 0x66, 0xb1, 0xb5, 0xe3, 0x36, 0x66, 0xcd, 0x99, 0xb0, 0x3c, 0x49, 0x98, 0x6b, 0x2c, 0x9b,
+  0xee, 0x7a, 0xf1, 0xeb, 0x6f, 0xe2, 0xd6, 0xb5, 0xa6, 0x85, 0x93, 0x42, 0xd7, 0xff, 0x59, 0x8d,
+  0xaf, 0x19, 0x8d, 0x8c, 0xc6, 0x30, 0xff, 0xfb, 0x5a, 0xcb, 0x59, 0x6b, 0x4d, 0x01, 0xf7, 0xc1,
+  0x31, 0xbf, 0xb8, 0xf1, 0xe3, 0xc7, 0xaf, 0x5d, 0xf1, 0x60, 0x6b, 0x3f, 0xbf, 0xf9, 0xad, 0xac,
+  0x61, 0xac, 0x6b, 0x58, 0x34, 0xcb, 0x1a, 0xc3, 0x5e, 0xb3, 0x1b, 0x5e, 0xb6, 0x33, 0x07, 0xff,
+  0xfb, 0x80, 0x1a, 0xc6, 0xb6, 0xb3, 0x5b, 0x5a, 0xc2, 0x42, 0x46, 0x83, 0x4b, 0x16, 0x5a, 0xd6,
+  0x58, 0xd6, 0x35, 0xeb, 0x6b, 0xd7, 0xad, 0x8c, 0x67, 0xff, 0xfc, 0x77, 0xfc, 0x31, 0x8d, 0x8f,
+  0x5e, 0x66, 0x6c, 0xc6, 0x35, 0x9a, 0x1f, 0x7f, 0xff, 0xed, 0x6e, 0xd0, 0x82, 0xd6, 0xb5, 0x86,
+  0x63, 0x06, 0x05, 0x70, 0xcd, 0x63, 0x46, 0x80, 0x2d, 0x6b, 0x2c, 0x18, 0x63, 0x19, 0x8c, 0x6d,
+  0x66, 0xb0, 0x2f, 0xff, 0xed, 0x30, 0x35, 0x96, 0xb5, 0xa0, 0x20, 0xfe, 0x18, 0x6c, 0x3d, 0x6c,
+  0xd9, 0x7d, 0xb2, 0xf3, 0x6d, 0xad, 0x7a, 0x6b, 0x1d, 0xff, 0xff, 0xdb, 0xac, 0x63, 0x33, 0x3c,
+  0x79, 0xe6, 0x7b, 0x36, 0xd9, 0x99, 0x8f, 0xff, 0xfb, 0x6f, 0xfe, 0xb6, 0x66, 0x79, 0xb3, 0xcd,
+  0x9b, 0x66, 0x60, 0x03, 0xff, 0xfb, 0xfe, 0x06, 0x33, 0x19, 0xb1, 0xe3, 0x66, 0xcd, 0x8f, 0x06,
+  0x88, 0x63, 0x0d, 0x62, 0xc9, 0xf5, 0x8f, 0x1b, 0x1b, 0xb8, 0xb2, 0xcb, 0x40, 0x5a, 0x0b, 0x3f,
+  0xbf, 0xb5, 0x9b, 0x5b, 0x33, 0x19, 0xb0, 0xd8, 0xc6, 0x37, 0xfd, 0xcb, 0x0b, 0x05, 0xad, 0x68,
+  0xd7, 0x7f, 0xda, 0xc4, 0xc6, 0xf6, 0xde, 0x66, 0xd9, 0xb1, 0xeb, 0xdd, 0xd6, 0x2c, 0xd3, 0x3f,
+  0xef, 0xf9, 0xac, 0xc1, 0x8d, 0x63, 0x5a, 0xc0, 0x6b, 0x2d, 0xa6, 0x1a, 0xf5, 0x98, 0xcc, 0xcc,
+  0x66, 0x1b, 0xff, 0xfd, 0xd7, 0xf8, 0x0d, 0x63, 0x5b, 0x06, 0x6b, 0x58, 0x94, 0x94, 0x34, 0x0b,
+  0x16, 0xb2, 0xd6, 0x03, 0x1a, 0xf5, 0x99, 0x8d, 0xaf, 0x59, 0xaf, 0xff, 0xf8, 0xaf, 0xfb, 0x35,
+  0xb5, 0xeb, 0x66, 0x66, 0xd8, 0xd9, 0x98, 0xd6, 0x69, 0xa3, 0xff, 0xef, 0xfb, 0xb4, 0x21, 0x68,
+  0xd3, 0x06, 0x66, 0x87, 0x46, 0x8d, 0xad, 0xad, 0x60, 0x01, 0x64, 0xd6, 0xb5, 0x83, 0x0c, 0x66,
+  0x31, 0xb5, 0xb5, 0xb5, 0x83, 0x4f, 0xfe, 0xfb, 0x5a, 0xc6, 0xb5, 0xad, 0x69, 0xa2, 0xc8, 0xfb,
+  0xb0, 0x6d, 0x66, 0x66, 0x66, 0x6c, 0xfb, 0x3f, 0x43, 0x1a, 0xcd, 0x65, 0x9f, 0xdf, 0xff, 0xfe,
+  0x16, 0xb6, 0xb3, 0x33, 0x36, 0xd9, 0xb6, 0xcf, 0x3c, 0x79, 0x99, 0x8e, 0xff, 0xff, 0xb8, 0xcc,
+  0xcd, 0x9b, 0x67, 0x99, 0xe6, 0x6c, 0xc0, 0x07, 0xff, 0xff, 0x90, 0x6b, 0x31, 0x8d, 0x99, 0x9b,
+  0x33, 0x66, 0xc7, 0x83, 0x03, 0xf1, 0x86, 0x2c, 0x27, 0xfd, 0xb1, 0xeb, 0xc6, 0x63, 0xe8, 0x2c,
+  0xb4, 0x0b, 0x45, 0x96, 0xff, 0xfa, 0x33, 0x1b, 0x19, 0xb5, 0xeb, 0xd6, 0xc6, 0x63, 0x19, 0xff,
+  0xf1, 0x61, 0xa0, 0xb1, 0x69, 0xbe, 0xfe, 0xb5, 0x89, 0x8d, 0xdd, 0xa6, 0xd9, 0x9b, 0x63, 0x66,
+  0x00, 0x07, 0xf7, 0xf4, 0xc6, 0xb3, 0x2f, 0x5a, 0xcd, 0x31, 0x6d, 0x1a, 0xc0, 0xc3, 0x0c, 0xc6,
+  0x66, 0x63, 0x31, 0x9f, 0xdf, 0xff, 0xee, 0xcb, 0x06, 0xb1, 0x86, 0x6b, 0x35, 0xa2, 0x62, 0x60,
+  0x00, 0x59, 0x6b, 0x2c, 0xb1, 0xad, 0x7a, 0xc6, 0x63, 0x33, 0x18, 0xdf, 0xff, 0xf0, 0xb1, 0xad,
+  0xad, 0x99, 0x9b, 0x33, 0xd7, 0x8c, 0xcd, 0x66, 0xb5, 0xa6, 0xbf, 0xff, 0xfa, 0x3a, 0xd5, 0xa2,
+  0xd0, 0x69, 0xad, 0xad, 0x81, 0x10, 0xf6, 0xd7, 0xac, 0x35, 0x85, 0x8b, 0x26, 0x9a, 0x6b, 0x58,
+  0x63, 0x5b, 0x18, 0xcc, 0xc3, 0x30, 0x1a, 0xdf, 0xdf, 0xfc, 0xd6, 0x06, 0x9a, 0xd6, 0x81, 0x6a,
+  0xfe, 0x35, 0x98, 0xc6, 0x66, 0x66, 0x6c, 0xda, 0x5a, 0x96, 0xd6, 0x35, 0x82, 0xff, 0xff, 0xf2,
+  0xd6, 0x19, 0x99, 0x9b, 0x67, 0x9b, 0x3c, 0xf3, 0x66, 0xcc, 0xc3, 0xff, 0xff, 0x03, 0xf9, 0x99,
+  0xb3, 0x6d, 0x9b, 0x3c, 0x78, 0xc4, 0xc0, 0xfb, 0xff, 0xff, 0xb4, 0xd6, 0x18, 0xcc, 0xcc, 0xcd,
+  0x9b, 0x33, 0x63, 0xc1, 0x61, 0xd8, 0xc6, 0x58, 0x0f, 0xee, 0xd8, 0xdb, 0x5e, 0xb6, 0x0f, 0xa0,
+  0x2d, 0x0b, 0x42, 0xd6, 0xef, 0xff, 0xb5, 0xb1, 0x99, 0x99, 0x98, 0xd8, 0xda, 0xd8, 0xc6, 0x77,
+  0xfc, 0x34, 0x68, 0xd2, 0xcb, 0x4f, 0xfe, 0x9a, 0xc4, 0xc6, 0xde, 0xc6, 0x3c, 0xcd, 0x9b, 0x33,
+  0x00, 0x02, 0xff, 0xfe, 0x30, 0xc3, 0x0d, 0x66, 0x9a, 0xc0, 0xd6, 0xb0, 0xd6, 0x30, 0xcc, 0x66,
+  0x66, 0x36, 0xb6, 0xb3, 0xff, 0xfd, 0xf3, 0xec, 0xb0, 0xd6, 0x6b, 0x6b, 0x32, 0xf4, 0xc5, 0x04,
+  0xf8, 0x00, 0x59, 0x65, 0xac, 0xb0, 0x6b, 0x18, 0xc6, 0xd7, 0xad, 0x86, 0x3f, 0xff, 0xe0, 0x43,
+  0x35, 0xeb, 0x66, 0xcc, 0xd9, 0x9b, 0x35, 0xeb, 0x35, 0x96, 0xb5, 0xbf, 0xbf, 0xff, 0xfb, 0x11,
+  0x0b, 0x45, 0x86, 0xb3, 0x5e, 0xb6, 0x27, 0x23, 0xcc, 0x30, 0xd6, 0xb2, 0xd6, 0xb4, 0x34, 0x35,
+  0xad, 0xac, 0x33, 0x19, 0x9a, 0xf5, 0xb0, 0xd6, 0xd6, 0xb5, 0xaf, 0xff, 0xfc, 0xaf, 0x4c, 0x06,
+  0xb4, 0xd0, 0x13, 0xef, 0xb1, 0x97, 0xad, 0xad, 0xaf, 0x0f, 0x19, 0xb3, 0x68, 0x6b, 0xff, 0xcd,
+  0x66, 0xb5, 0x83, 0xff, 0xff, 0xd7, 0x98, 0x66, 0x66, 0x6d, 0x9b, 0xc7, 0xb3, 0x7a, 0xf3, 0x66,
+  0x61, 0xfd, 0xff, 0xff, 0x86, 0xcc, 0xdb, 0x33, 0xcd, 0x9e, 0xbc, 0xda, 0xb8, 0x60, 0xff, 0xbf,
+  0xff, 0x9a, 0xc3, 0x0d, 0x8c, 0xd8, 0xd9, 0xb3, 0x36, 0x60, 0x58, 0x76, 0x31, 0xac, 0x03, 0xff,
+  0xb5, 0xe3, 0x66, 0x63, 0x1a, 0xdf, 0xf1, 0xab, 0x21, 0x68, 0xb5, 0xaf, 0xfb, 0xe6, 0x1e, 0xb6,
+  0x36, 0x36, 0x33, 0x61, 0xeb, 0x31, 0x9b, 0xfe, 0xfb, 0x4d, 0x6b, 0x5a, 0x01, 0x7f, 0xf4, 0x65,
+  0xb4, 0xc6, 0xce, 0xb3, 0x6c, 0x79, 0x9b, 0x1e, 0x80, 0x00, 0xff, 0xfe, 0x9a, 0xda, 0xcd, 0x63,
+  0x2c, 0xd6, 0xb0, 0x1a, 0xcb, 0x6b, 0x5b, 0x58, 0xcc, 0x66, 0x66, 0x36, 0xbd, 0x63, 0xff, 0xbf,
+  0xfe, 0x99, 0x63, 0x5b, 0x59, 0xad, 0xac, 0x31, 0x49, 0x48, 0x58, 0x0b, 0x2c, 0xb5, 0x96, 0x0d,
+  0x63, 0x5e, 0xb3, 0x31, 0x98, 0xce, 0xff, 0xff, 0x7d, 0xbd, 0x33, 0x19, 0x9b, 0x33, 0x6c, 0x7a,
+  0xd9, 0x86, 0xb1, 0x65, 0xaf, 0xff, 0xbf, 0xfa, 0x5a, 0x4d, 0x58, 0xb0, 0xc6, 0x30, 0xb0, 0xa3,
+  0x18, 0x61, 0xa6, 0xb4, 0x68, 0x01, 0xad, 0x66, 0x18, 0xc6, 0xd7, 0xad, 0x86, 0x60, 0xd6, 0x2d,
+  0xff, 0xff, 0xa1, 0x19, 0x66, 0x9a, 0x68, 0x09, 0xff, 0xda, 0xc6, 0x18, 0x7a, 0xcc, 0xcd, 0x8d,
+  0x9b, 0x33, 0x4f, 0x7f, 0x4b, 0xd6, 0xb0, 0x3f, 0xff, 0xbe, 0xb5, 0xb0, 0xd9, 0x9b, 0x67, 0x99,
+  0xec, 0xdb, 0x66, 0x7a, 0xd8, 0x6f, 0xff, 0xfc, 0xba, 0xf5, 0xe6, 0x6d, 0x9b, 0x67, 0xaf, 0x32,
+  0xf9, 0x9a, 0xc3, 0xff, 0xef, 0xfe, 0xd6, 0x18, 0x66, 0x36, 0x36, 0x66, 0xcd, 0x8f, 0x5e, 0x0a,
+  0x0d, 0xcd, 0x7a, 0xd6, 0x34, 0x77, 0xf3, 0x33, 0x66, 0x33, 0x5e, 0xb5, 0xb7, 0xff, 0x35, 0x6b,
+  0x56, 0x85, 0xa3, 0xff, 0xfa, 0xcc, 0x66, 0x66, 0x66, 0xd7, 0x8c, 0xcc, 0x66, 0x6b, 0x67, 0xff,
+  0x56, 0xb2, 0xcb, 0x4d, 0x17, 0xfd, 0xc6, 0xb0, 0x99, 0xd7, 0xd4, 0x6c, 0xd9, 0xb3, 0x66, 0x60,
+  0x00, 0x3f, 0xfe, 0xa6, 0x30, 0xd6, 0xd6, 0xb3, 0x4c, 0xb0, 0xd6, 0xb0, 0x60, 0xcd, 0x7a, 0xcc,
+  0xcc, 0xcc, 0x63, 0x0f, 0xff, 0xf8, 0x39, 0xac, 0xb6, 0xb1, 0x8d, 0x7a, 0xd6, 0xd1, 0x59, 0x5a,
+  0xc0, 0x58, 0xb2, 0xcb, 0x59, 0x61, 0xac, 0x33, 0x5b, 0x1b, 0x5b, 0x5e, 0xb7, 0xf7, 0xff, 0xfb,
+  0xc6, 0x6b, 0x31, 0xb1, 0xb3, 0x66, 0xcc, 0xcc, 0xc6, 0x58, 0x16, 0x9f, 0xdf, 0x20, 0x8b, 0x5a,
+  0xc1, 0x8c, 0xc3, 0x12, 0xdc, 0x31, 0xac, 0x1a, 0x00, 0x00, 0x60, 0xc6, 0x61, 0xeb, 0x33, 0x35,
+  0xb2, 0xf5, 0xac, 0x59, 0xff, 0xfd, 0xc6, 0xb0, 0x34, 0xd0, 0x1f, 0xdf, 0x35, 0x8d, 0x7a, 0xc6,
+  0x36, 0x33, 0x63, 0x6c, 0xc8, 0xcf, 0xcb, 0xf8, 0xd6, 0x03, 0xfe, 0xff, 0xfb, 0x58, 0xcc, 0x7a,
+  0xf3, 0x3c, 0xdb, 0x3c, 0xdb, 0x3d, 0x79, 0x8c, 0x3f, 0xef, 0xff, 0xfc, 0xf3, 0x36, 0xcc, 0xf3,
+  0x3c, 0x78, 0xbe, 0x6b, 0x35, 0x97, 0xff, 0xdf, 0xd6, 0x35, 0x8c, 0x66, 0x36, 0x66, 0xcc, 0xcd,
+  0x98, 0x14, 0x1b, 0x9a, 0xf5, 0x81, 0xa7, 0xfd, 0x33, 0x63, 0x36, 0xb6, 0xb3, 0x06, 0xff, 0xa2,
+  0x08, 0xb4, 0x7f, 0x7f, 0xc6, 0xd6, 0xcc, 0x6c, 0x7a, 0xf5, 0xb3, 0x33, 0x1b, 0x5b, 0x0c, 0xff,
+  0xe9, 0x60, 0xb2, 0x69, 0xff, 0x7c, 0x18, 0x26, 0x75, 0x34, 0x5b, 0x36, 0x6c, 0xd9, 0x98, 0x00,
+  0x0f, 0xfb, 0xfb, 0x58, 0x63, 0x06, 0xb1, 0xad, 0x60, 0x6b, 0x58, 0xd6, 0x30, 0xcd, 0x78, 0xc7,
+  0xad, 0x8c, 0xc1, 0xff, 0xfd, 0xff, 0xda, 0x6b, 0x0c, 0x31, 0x8d, 0x66, 0x2e, 0x2d, 0xcb, 0x0b,
+  0x0b, 0x2c, 0xb5, 0x96, 0x03, 0x0c, 0x63, 0x31, 0x98, 0x7f, 0xdf, 0xff, 0xc6, 0x0f, 0x5b, 0x1b,
+  0x66, 0x6c, 0xd8, 0xd8, 0x60, 0x05, 0x87, 0xff, 0x42, 0x16, 0x9a, 0xd6, 0x61, 0xb0, 0xdc, 0xcd,
+  0xaf, 0x58, 0xd6, 0x00, 0xb0, 0xb0, 0x0d, 0x18, 0x66, 0x33, 0x31, 0x98, 0xc3, 0x58, 0x0f, 0xff,
+  0xfd, 0x99, 0xad, 0x61, 0xa3, 0x40, 0xff, 0xf8, 0x65, 0xb5, 0x98, 0x66, 0x36, 0x36, 0x3c, 0x6c,
+  0x5c, 0xcc, 0xcf, 0xfe, 0x30, 0x0e, 0xff, 0xff, 0xf1, 0x61, 0x8d, 0x99, 0xeb, 0xcd, 0xb6, 0xcd,
+  0xb6, 0x6d, 0x8c, 0xc3, 0x7f, 0xff, 0xeb, 0xcd, 0x99, 0xb6, 0x6d, 0x99, 0xeb, 0x75, 0xb5, 0x8d,
+  0x6b, 0xff, 0xff, 0x9b, 0x86, 0xb1, 0x86, 0x66, 0x66, 0xc6, 0xda, 0xcc, 0xc0, 0xa0, 0xdc, 0xc3,
+  0x0d, 0x69, 0xff, 0xf6, 0x66, 0x66, 0x66, 0xbd, 0x63, 0x06, 0x7f, 0x75, 0xab, 0x45, 0xa5, 0xff,
+  0xfc, 0x31, 0x99, 0x99, 0xb1, 0xb3, 0x31, 0xb1, 0xb5, 0xeb, 0x30, 0xff, 0xe8, 0x02, 0xc9, 0xdf,
+  0xff, 0x6b, 0x6b, 0x5b, 0x53, 0x5a, 0x39, 0xbe, 0x3c, 0xcd, 0x9b, 0x33, 0x00, 0x01, 0xf7, 0xff,
+  0x6b, 0x5b, 0x2f, 0x58, 0x6b, 0x0d, 0x65, 0x8d, 0x30, 0x30, 0x66, 0xbd, 0x66, 0x66, 0x63, 0x61,
+  0x8d, 0xf7, 0xff, 0xfc, 0x50, 0xd6, 0xb3, 0x2f, 0x59, 0x86, 0xb0, 0xc4, 0xc1, 0x96, 0x16, 0x2c,
+  0xb2, 0xd6, 0x59, 0x66, 0x98, 0xc3, 0x31, 0xb5, 0x98, 0xff, 0xfb, 0xff, 0x9a, 0xc6, 0x66, 0x66,
+  0xcc, 0xf5, 0xe6, 0x66, 0x35, 0xb4, 0x35, 0x68, 0x3e, 0xfe, 0x25, 0xad, 0x0d, 0x63, 0x19, 0x8f,
+  0x4e, 0x36, 0xb6, 0xb1, 0xad, 0x62, 0xc5, 0x96, 0x58, 0x1a, 0x30, 0xda, 0xf5, 0xb5, 0xe1, 0xb0,
+  0xc6, 0x5b, 0x41, 0xff, 0xff, 0xbd, 0x0d, 0x60, 0xd0, 0x6e, 0x7f, 0xfd, 0x86, 0x0c, 0x6b, 0xd6,
+  0x66, 0x36, 0x66, 0x67, 0xb0, 0x72, 0x6f, 0x1b, 0xff, 0xa0, 0x07, 0xff, 0xff, 0xa5, 0xad, 0xaf,
+  0x5b, 0x33, 0x6c, 0xdb, 0x67, 0x9b, 0x36, 0xcc, 0xcc, 0x1f, 0xf7, 0xff, 0xfe, 0xde, 0x36, 0xcc,
+  0xf3, 0x36, 0xc5, 0x59, 0xac, 0x35, 0xff, 0xff, 0xc3, 0xa6, 0xb1, 0x86, 0x33, 0x6b, 0xc6, 0xcc,
+  0xd9, 0x98, 0x14, 0x1b, 0x98, 0xc1, 0xad, 0x77, 0xfd, 0x8f, 0x5e, 0xb6, 0x63, 0x18, 0x61, 0x87,
+  0xf7, 0xc0, 0x07, 0x7f, 0xff, 0x6b, 0x6b, 0xd6, 0xc6, 0xcc, 0xcd, 0x8d, 0x98, 0xd8, 0xc6, 0xd6,
+  0xd6, 0xff, 0xfa, 0x34, 0x0b, 0x5f, 0xff, 0xda, 0xc6, 0x5b, 0x53, 0x99, 0xb9, 0x4d, 0x9b, 0x66,
+  0x6c, 0xcc, 0xc0, 0x01, 0x7f, 0xff, 0x35, 0x8c, 0x30, 0x60, 0x6b, 0x03, 0x5a, 0xc6, 0xb3, 0x58,
+  0xcc, 0x66, 0x3d, 0x6c, 0x6d, 0x63, 0x5f, 0xff, 0xf2, 0x3f, 0xc1, 0xac, 0x61, 0x8c, 0x32, 0x34,
+  0x33, 0x6b, 0x2c, 0x58, 0xb2, 0xd6, 0xb2, 0xcb, 0x1a, 0xc3, 0x18, 0xcc, 0x66, 0xb7, 0xff, 0xfb,
+  0x97, 0xf6, 0xb5, 0xeb, 0x33, 0x36, 0x66, 0xcd, 0x9b, 0x18, 0xc3, 0x5a, 0x08, 0x0f, 0xff, 0xad,
+  0xda, 0x03, 0x4c, 0xd7, 0xad, 0x90, 0xcf, 0xb1, 0x8c, 0x1a, 0xd6, 0xb2, 0xd6, 0xb5, 0x96, 0x18,
+  0x33, 0x35, 0xeb, 0xd6, 0xc6, 0x63, 0x1a, 0xc6, 0x83, 0xff, 0xff, 0x88, 0x35, 0x80, 0x68, 0xfe,
+  0xfe, 0xc1, 0x83, 0x35, 0x99, 0xaf, 0x5e, 0xb6, 0x66, 0x7a, 0xd7, 0xd8, 0xbb, 0x18, 0x00, 0x7f,
+  0xff, 0x7f, 0x33, 0x5b, 0x33, 0x36, 0xcd, 0xb6, 0x6d, 0xb3, 0xd7, 0x99, 0x8c, 0x1f, 0xff, 0xfc,
+  0x73, 0x33, 0xc6, 0xdb, 0x1e, 0x39, 0x61, 0x83, 0xbf, 0xff, 0xac, 0xb3, 0x5a, 0xf5, 0x98, 0xd8,
+  0xd9, 0x99, 0xb3, 0x36, 0x0a, 0x0e, 0x1b, 0x59, 0xad, 0x67, 0xff, 0x76, 0x3d, 0x6c, 0xc6, 0x33,
+  0x06, 0x6b, 0x18, 0x00, 0x3f, 0xff, 0xfd, 0x58, 0x66, 0x66, 0xc6, 0xcc, 0xd8, 0xd8, 0xd8, 0xcc,
+  0x66, 0xb3, 0xfe, 0x58, 0x01, 0xff, 0xff, 0xed, 0xac, 0x65, 0xe9, 0x3b, 0x93, 0x8b, 0xe6, 0x6d,
+  0x9b, 0x1e, 0x33, 0x00, 0x03, 0xff, 0xfa, 0x65, 0xeb, 0x18, 0x30, 0x35, 0x96, 0xd3, 0x58, 0x6b,
+  0x18, 0x66, 0xbc, 0x3d, 0x6c, 0xc6, 0x60, 0xdf, 0xf7, 0xff, 0xfc, 0x8e, 0x34, 0xc3, 0x0d, 0xac,
+  0x30, 0xdc, 0xd9, 0xac, 0xb2, 0xcb, 0x2c, 0xb5, 0xac, 0xb1, 0x7a, 0x6b, 0x6b, 0x35, 0xeb, 0x6b,
+  0xd6, 0x37, 0xff, 0xfb, 0x77, 0x6b, 0x18, 0xd8, 0xd9, 0xb3, 0x66, 0x6c, 0x66, 0x1a, 0xd6, 0x84,
+  0x03, 0xfe, 0xf9, 0x37, 0x60, 0x35, 0xeb, 0x61, 0x21, 0x12, 0xcc, 0x30, 0x1a, 0x6b, 0x5a, 0x6b,
+  0x58, 0x35, 0xb5, 0x99, 0x8d, 0xaf, 0x5b, 0x1b, 0x59, 0xac, 0x6b, 0x4d, 0xf7, 0xff, 0xff, 0x36,
+  0x0c, 0xb1, 0xa0, 0xff, 0xf9, 0x61, 0xac, 0xd6, 0xd6, 0x33, 0x19, 0x99, 0xb1, 0xb2, 0xef, 0x0b,
+  0x63, 0x00, 0x0f, 0xfe, 0xff, 0xac, 0xd7, 0xad, 0x99, 0xeb, 0xcd, 0xb6, 0x6d, 0xb3, 0x66, 0xc6,
+  0x65, 0xb7, 0xfd, 0xff, 0xff, 0xd1, 0xeb, 0xc6, 0xd9, 0xb3, 0x61, 0xd3, 0x5b, 0x59, 0x7b, 0xff,
+  0xbf, 0xe0, 0x32, 0xf5, 0x8c, 0xc6, 0xcc, 0xcc, 0xf5, 0xb6, 0x02, 0xc3, 0xb3, 0x18, 0xd6, 0x2f,
+  0xff, 0x99, 0x8d, 0x8c, 0xc6, 0x35, 0xeb, 0x0c, 0x60, 0x00, 0xff, 0xfe, 0xe6, 0x31, 0xb1, 0xb3,
+  0x66, 0x66, 0x6c, 0xc6, 0x6d, 0x7a, 0xcd, 0x6c, 0x00, 0x0f, 0xff, 0xeb, 0x0c, 0x1a, 0x7f, 0x13,
+  0x07, 0x33, 0x6c, 0xd9, 0x9b, 0x18, 0x00, 0x1f, 0xfd, 0xf1, 0x8d, 0x6d, 0x61, 0xac, 0x6b, 0x58,
+  0x35, 0x81, 0x86, 0x19, 0xaf, 0x0f, 0x5b, 0x31, 0x9a, 0xf4, 0xcf, 0xff, 0xf9, 0x80, 0x6b, 0x0c,
+  0xd6, 0xd6, 0x30, 0xec, 0xe8, 0xd6, 0xb2, 0xcb, 0x2d, 0x65, 0xad, 0x65, 0x83, 0x59, 0xad, 0xad,
+  0xaf, 0x59, 0x87, 0xff, 0xfb, 0x56, 0xb0, 0xcc, 0xc7, 0xaf, 0x33, 0x66, 0xcc, 0xc6, 0x35, 0xad,
+  0x68, 0x00, 0x7d, 0xff, 0x45, 0x96, 0x5e, 0xb1, 0x98, 0x9c, 0x93, 0xad, 0xac, 0xd6, 0x03, 0x4d,
+  0x1a, 0xd6, 0xb0, 0xd6, 0xd6, 0xc6, 0x36, 0x36, 0xbd, 0x6d, 0x6d, 0x66, 0xb5, 0xad, 0x7f, 0xdf,
+  0xf2, 0xcd, 0x60, 0x0e, 0xff, 0xa6, 0x1a, 0xc6, 0xb6, 0xb6, 0xb3, 0x31, 0xb5, 0xe3, 0x66, 0x5c,
+  0x5f, 0xec, 0x6c, 0x00, 0x7d, 0xff, 0xfd, 0x66, 0xbd, 0x7a, 0xdb, 0x33, 0xcc, 0xf3, 0x6c, 0xdb,
+  0x33, 0x6b, 0x6b, 0x0f, 0xff, 0xff, 0x1f, 0xed, 0x8d, 0xb3, 0x66, 0x0f, 0x8d, 0x63, 0x59, 0xff,
+  0xdf, 0xc3, 0x59, 0x7a, 0x6d, 0x66, 0x66, 0x66, 0x6c, 0xcc, 0xc0, 0xb0, 0xf3, 0x18, 0xcb, 0x3b,
+  0xff, 0x98, 0xd8, 0xcc, 0x63, 0x35, 0xb5, 0x9a, 0xda, 0xc0, 0x03, 0xff, 0xbf, 0x8c, 0x66, 0x66,
+  0xc7, 0x8d, 0x9b, 0x1b, 0x1b, 0x19, 0x8c, 0x30, 0x00, 0x7f, 0xfd, 0xd8, 0xd6, 0x6b, 0x50, 0xdf,
+  0xde, 0x66, 0xcd, 0x9b, 0x36, 0x36, 0x00, 0x03, 0xfb, 0xfe, 0x35, 0xeb, 0x0c, 0x35, 0x86, 0xb0,
+  0x35, 0x97, 0xa6, 0x18, 0x66, 0x33, 0x1e, 0xb6, 0x33, 0x5e, 0x99, 0xff, 0xfd, 0xff, 0xfd, 0x81,
+  0x86, 0x19, 0x83, 0x1f, 0x9f, 0x0d, 0x6b, 0x2c, 0xb5, 0x96, 0xb5, 0xad, 0x60, 0x35, 0x98, 0x66,
+  0x30, 0xdd, 0xff, 0xfe, 0xcf, 0x6b, 0x6b, 0x6b, 0xc6, 0x6c, 0xd9, 0x9e, 0xbd, 0x78, 0x66, 0xb5,
+  0x96, 0x80, 0x03, 0xbf, 0xfe, 0x2d, 0x35, 0x8c, 0x63, 0x2a, 0x27, 0xb5, 0xeb, 0x0d, 0x60, 0x0d,
+  0x1a, 0x6b, 0x0c, 0x33, 0x5e, 0x31, 0xeb, 0x63, 0x6b, 0x30, 0xd6, 0xb1, 0x7f, 0xff, 0x75, 0x86,
+  0xb0, 0x1f, 0xdf, 0xc6, 0x0d, 0x66, 0x5e, 0xb1, 0x98, 0x7a, 0xd8, 0xd9, 0x99, 0x6b, 0x79, 0xb3,
+  0x5e, 0x80, 0x0f, 0xff, 0xff, 0x4b, 0x31, 0x99, 0x9e, 0xbc, 0xdb, 0x36, 0xd9, 0xb3, 0x66, 0x6b,
+  0xd6, 0xb2, 0xff, 0xfe, 0x36, 0x6c, 0xc0, 0x3e, 0x0c, 0x35, 0xbf, 0xff, 0xf6, 0x96, 0xb5, 0x8d,
+  0x66, 0xb6, 0x33, 0x33, 0x3d, 0x6c, 0xd8, 0x0c, 0x0f, 0xd8, 0x63, 0x07, 0xf7, 0xf1, 0xb1, 0x99,
+  0xaf, 0x59, 0x8c, 0x31, 0x8c, 0x00, 0x1f, 0xdf, 0xff, 0x63, 0x31, 0xb3, 0x36, 0x66, 0xcc, 0xd8,
+  0xd8, 0xd8, 0xc6, 0x34, 0x00, 0x1f, 0xfd, 0xf6, 0x30, 0x65, 0x1d, 0xd5, 0xbe, 0x6c, 0xdb, 0x33,
+  0x66, 0x60, 0x00, 0x3b, 0xff, 0xfb, 0x6b, 0x18, 0x60, 0xc1, 0xac, 0x06, 0x2f, 0x4c, 0x6b, 0x30,
+  0xda, 0xd9, 0x98, 0xcc, 0xc1, 0x9d, 0xff, 0xff, 0x41, 0x80, 0xc6, 0xbd, 0x61, 0x9a, 0x43, 0x42,
+  0x0d, 0x65, 0xac, 0xb5, 0x96, 0xb5, 0xad, 0x65, 0x9a, 0xd6, 0xd6, 0xd6, 0x63, 0x1b, 0xfe, 0xff,
+  0xeb, 0x18, 0x6c, 0x6c, 0xd9, 0x9b, 0x33, 0x63, 0x0c, 0xb2, 0xd0, 0x00, 0x3b, 0xff, 0xe4, 0x69,
+  0x86, 0x33, 0x2d, 0x2a, 0x8d, 0xac, 0x35, 0x8b, 0x0d, 0x0d, 0x30, 0x6b, 0xd6, 0x63, 0x36, 0x33,
+  0x31, 0x98, 0x32, 0xc2, 0xff, 0xff, 0xf2, 0x30, 0xd6, 0x07, 0xff, 0xd1, 0xac, 0xd6, 0xbd, 0x33,
+  0x5b, 0x59, 0x8d, 0xaf, 0x5b, 0x33, 0x32, 0xca, 0xe8, 0xd8, 0xc0, 0x07, 0xff, 0xf7, 0xd7, 0xac,
+  0xcd, 0x8d, 0xb3, 0x67, 0x99, 0xe6, 0x78, 0xcd, 0x83, 0x58, 0xad, 0x9b, 0x00, 0x3e, 0xb1, 0x81,
+  0x7f, 0xfd, 0x60, 0x35, 0x8c, 0x36, 0x33, 0x36, 0x66, 0x66, 0xc1, 0xa2, 0x1b, 0x5e, 0xb3, 0x59,
+  0xaf, 0xfe, 0xe6, 0x33, 0x1b, 0x5b, 0x0c, 0x63, 0x18, 0x60, 0x01, 0xf7, 0xff, 0xd6, 0x6b, 0xc6,
+  0x66, 0xd8, 0xf1, 0xb3, 0x66, 0x36, 0x63, 0x35, 0xb5, 0x80, 0x03, 0xfe, 0xfa, 0xda, 0xc6, 0x29,
+  0x6d, 0x6c, 0xb3, 0x67, 0x8f, 0x5e, 0x66, 0x66, 0x00, 0x07, 0xff, 0xff, 0xae, 0x6b, 0x6b, 0x18,
+  0x30, 0x6b, 0x2f, 0x46, 0x06, 0x5e, 0xb0, 0xcc, 0x66, 0x63, 0x63, 0x18, 0xd6, 0xbf, 0xff, 0xea,
+  0x3f, 0xfb, 0x03, 0x5e, 0x9b, 0x59, 0xac, 0xc8, 0xe8, 0xc3, 0x4d, 0x65, 0xac, 0xb5, 0xad, 0x6b,
+  0x5a, 0xcb, 0x69, 0x86, 0x33, 0x5b, 0x0f, 0xff, 0xbe, 0x0c, 0x66, 0x66, 0xc7, 0x8f, 0x5e, 0x63,
+  0x6b, 0x6b, 0x2c, 0x40, 0x00, 0x3b, 0xff, 0xfb, 0x40, 0xc6, 0xbd, 0x6c, 0xc0, 0xb5, 0x8c, 0x60,
+  0x65, 0x80, 0x0d, 0x60, 0xc3, 0x33, 0x1b, 0x31, 0xb5, 0xeb, 0x6b, 0x6b, 0x2c, 0xd5, 0xfd, 0xff,
+  0xf3, 0x58, 0xd6, 0xb2, 0xff, 0xf8, 0x30, 0x6b, 0xd3, 0x18, 0x66, 0xbd, 0x6c, 0x66, 0x66, 0x6d,
+  0x61, 0x6f, 0xb1, 0x98, 0x00, 0xff, 0xbf, 0xf8, 0xc6, 0x6c, 0x6d, 0x9b, 0x36, 0xd9, 0xb3, 0x66,
+  0x66, 0xb6, 0xb5, 0x80, 0x00, 0x1f, 0x58, 0x6b, 0x1f, 0xdf, 0xda, 0x0d, 0x60, 0xc6, 0x63, 0x36,
+  0x36, 0x66, 0xc0, 0x68, 0x89, 0x98, 0xc1, 0xbf, 0xff, 0xbb, 0xd6, 0x66, 0x33, 0x0c, 0xc6, 0xbd,
+  0x66, 0x18, 0x00, 0x5f, 0xff, 0xfe, 0x6c, 0x63, 0x66, 0x67, 0x8d, 0xb3, 0x33, 0x66, 0x66, 0x33,
+  0x0c, 0x00, 0x0f, 0xef, 0xe1, 0x86, 0x2a, 0x2b, 0xeb, 0x36, 0x67, 0x8f, 0x33, 0x36, 0x30, 0x00,
+  0x3f, 0xff, 0xa3, 0x0c, 0xd6, 0x18, 0x18, 0xbd, 0x35, 0x86, 0xb1, 0x97, 0xac, 0xc6, 0x63, 0x63,
+  0x6b, 0x6b, 0x35, 0x9f, 0xf7, 0xff, 0xfd, 0x4d, 0x81, 0x8d, 0x7a, 0xc6, 0xb6, 0x4c, 0x4b, 0x06,
+  0xb5, 0xad, 0x65, 0xad, 0x6b, 0x4d, 0x6b, 0x03, 0x5b, 0x58, 0xcc, 0x33, 0xff, 0xfd, 0x87, 0xb3,
+  0x59, 0x8d, 0x8d, 0x9b, 0x33, 0x66, 0x63, 0x35, 0x8b, 0x2d, 0x00, 0x01, 0xf7, 0xff, 0xc0, 0x31,
+  0x8d, 0x99, 0x58, 0x2c, 0xc3, 0x59, 0xad, 0x6b, 0x00, 0x6b, 0x06, 0x31, 0x99, 0x99, 0x98, 0xd8,
+  0xc3, 0x00, 0x7f, 0xf7, 0x35, 0x86, 0xb3, 0xfb, 0xfa, 0xc6, 0x0d, 0x6d, 0x61, 0x8c, 0x63, 0x33,
+  0x19, 0xb5, 0xe2, 0xb6, 0xd4, 0xd8, 0x00, 0x1d, 0xff, 0xff, 0xe4, 0xd6, 0xc6, 0xc6, 0xd9, 0xb3,
+  0x6c, 0xdb, 0x33, 0x63, 0x6b, 0x1a, 0x00, 0x00, 0x3e, 0xb5, 0x9a, 0xd6, 0xff, 0xee, 0xd6, 0xb5,
+  0xac, 0x6b, 0x6b, 0x31, 0xb1, 0xb3, 0x33, 0x60, 0x38, 0x48, 0xcc, 0x61, 0x9f, 0xff, 0xec, 0x37,
+  0xac, 0xc6, 0x63, 0x19, 0xad, 0xad, 0x86, 0x60, 0x00, 0x7f, 0xff, 0xfa, 0x35, 0xb5, 0xeb, 0xc6,
+  0xd8, 0xf3, 0x36, 0x6c, 0xcc, 0xcc, 0x6d, 0x6d, 0x68, 0x00, 0x3e, 0xff, 0x8d, 0x6d, 0x66, 0xab,
+  0xa9, 0xa7, 0xbc, 0xd9, 0xe3, 0x6c, 0x6c, 0x60, 0x02, 0x6f, 0xef, 0xf8, 0xd6, 0xcb, 0xd6, 0x18,
+  0x35, 0x81, 0x96, 0xd3, 0x0c, 0x1b, 0x5b, 0x5b, 0x31, 0x99, 0x8c, 0x35, 0xaf, 0xff, 0xfb, 0x0e,
+  0xb0, 0x61, 0x8d, 0x7a, 0xc2, 0x8a, 0x82, 0xf4, 0x6b, 0x5a, 0xd6, 0xb5, 0xad, 0x69, 0xad, 0x65,
+  0x8d, 0x63, 0x18, 0x66, 0xfb, 0xff, 0xe1, 0xaf, 0x59, 0x99, 0x9b, 0x33, 0x66, 0x66, 0x61, 0xac,
+  0x2d, 0x00, 0x00, 0x7f, 0xdf, 0xf2, 0xc3, 0x0d, 0xac, 0xd6, 0xca, 0xc6, 0x18, 0x1a, 0xcb, 0x03,
+  0x4c, 0x30, 0xc6, 0xd7, 0x8c, 0xcd, 0x8c, 0x63, 0x06, 0x8b, 0x83, 0x06, 0x7f, 0xfd, 0xda, 0xda,
+  0xd7, 0xa6, 0x35, 0x9a, 0xcc, 0x61, 0xb0, 0xf5, 0xb1, 0x9b, 0x55, 0xd9, 0x6c, 0x66, 0x00, 0x1f,
+  0xff, 0xfe, 0xdc, 0xcc, 0x6c, 0x78, 0xdb, 0x36, 0xcc, 0xf1, 0xb6, 0xbd, 0x7a, 0xd6, 0xd0, 0x00,
+  0x01, 0xf5, 0xac, 0x35, 0xdf, 0xc1, 0x60, 0x30, 0xc6, 0x63, 0x66, 0x3c, 0x66, 0xc1, 0xe2, 0x66,
+  0x66, 0xb6, 0xb5, 0xff, 0xfc, 0x33, 0x18, 0xcc, 0x33, 0x0d, 0xad, 0x86, 0x00, 0x0f, 0xff, 0xff,
+  0x58, 0xcc, 0xcc, 0xd9, 0x9e, 0x3c, 0xcc, 0xf5, 0xeb, 0xc6, 0x63, 0x1a, 0xc0, 0x01, 0xdf, 0xfc,
+  0xd6, 0x61, 0xab, 0xa8, 0xe8, 0x6f, 0x3d, 0x79, 0xb3, 0x66, 0x66, 0xbc, 0x02, 0x5b, 0x5f, 0xfd,
+  0xc6, 0x30, 0xc6, 0xb0, 0xd6, 0x0c, 0xb1, 0xac, 0x6b, 0x18, 0xc6, 0x63, 0x36, 0xb6, 0x30, 0x6b,
+  0x7f, 0xfd, 0xff, 0xff, 0x63, 0xac, 0x30, 0x66, 0xb6, 0xb1, 0x5d, 0x57, 0x2f, 0x46, 0xb5, 0xad,
+  0x64, 0xd6, 0x9a, 0xd3, 0x58, 0x18, 0x63, 0x1a, 0xdf, 0xf7, 0xf1, 0x86, 0x36, 0x36, 0x66, 0xcc,
+  0xd8, 0xcc, 0x6b, 0x16, 0x77, 0xf6, 0xbc, 0x00, 0x07, 0xff, 0xdf, 0x5a, 0xcd, 0x6d, 0x6c, 0x70,
+  0x6a, 0x61, 0x8d, 0x61, 0xad, 0x65, 0x8d, 0x30, 0x6b, 0xd6, 0x63, 0x63, 0x63, 0xd6, 0xd7, 0xad,
+  0xac, 0x6b, 0x4c, 0x23, 0x5b, 0x4f, 0xff, 0xe3, 0x06, 0x32, 0xf5, 0xad, 0xad, 0xac, 0x66, 0xbd,
+  0x6d, 0x7a, 0xd9, 0x8d, 0xaa, 0x6c, 0x36, 0x31, 0x80, 0x0f, 0xfe, 0xff, 0xb1, 0x8d, 0x99, 0xb3,
+  0x36, 0xcd, 0xb1, 0xe3, 0xd6, 0xd7, 0xad, 0x60, 0x00, 0x01, 0xdc, 0x6b, 0x1b, 0xff, 0xa3, 0x40,
+  0xd6, 0xb6, 0xb1, 0x99, 0x8f, 0x5b, 0x36, 0x36, 0x10, 0x13, 0xf5, 0x99, 0x86, 0xb7, 0xff, 0xfb,
+  0x25, 0xb0, 0xcc, 0x63, 0x18, 0xc6, 0x6b, 0xc3, 0x30, 0x01, 0xff, 0xff, 0xed, 0xf6, 0xd6, 0xc6,
+  0x7a, 0xf3, 0x3d, 0x79, 0xb3, 0x66, 0x6c, 0x66, 0x61, 0xac, 0x00, 0x0f, 0xff, 0xe3, 0x18, 0xcb,
+  0x19, 0xd9, 0xad, 0xb3, 0x66, 0xcd, 0xb5, 0xe3, 0x18, 0x14, 0xd6, 0xdd, 0xff, 0xf1, 0x86, 0x6b,
+  0x69, 0x8d, 0x65, 0xe9, 0xac, 0x6b, 0x5b, 0x58, 0x63, 0x19, 0xaf, 0x19, 0x8c, 0xcb, 0xd3, 0x4f,
+  0xff, 0xfb, 0x9b, 0x2d, 0xad, 0x7a, 0xc6, 0x18, 0xb8, 0xb7, 0x60, 0x6b, 0x5a, 0xd6, 0xb5, 0xa6,
+  0x9a, 0x6b, 0x58, 0x18, 0x66, 0xb3, 0x77, 0xff, 0x4c, 0x31, 0x99, 0x99, 0xeb, 0x6c, 0x6c, 0xc6,
+  0x19, 0x67, 0x7f, 0xd8, 0xda, 0xf0, 0x00, 0x3f, 0xff, 0xfd, 0x6d, 0x63, 0x5e, 0xb6, 0x9d, 0x9b,
+  0xf3, 0x18, 0x6b, 0x0d, 0x6b, 0x01, 0x96, 0xd6, 0x31, 0x8f, 0x5b, 0x33, 0x33, 0x19, 0x97, 0xad,
+  0x6b, 0x00, 0xb1, 0xf7, 0xfc, 0x30, 0xc3, 0x0c, 0x30, 0xc6, 0x31, 0x98, 0xcc, 0x6c, 0xd4, 0xf5,
+  0xd9, 0xb5, 0xeb, 0x00, 0x1d, 0xff, 0xff, 0xe5, 0x8c, 0x7a, 0xf5, 0xe3, 0x67, 0xaf, 0x36, 0x66,
+  0xda, 0xf0, 0xcd, 0x60, 0x00, 0x01, 0x7f, 0x66, 0xb1, 0xf7, 0xd9, 0x35, 0xa6, 0xb0, 0x63, 0x18,
+  0xf5, 0xb3, 0x33, 0x66, 0x11, 0x14, 0xd8, 0xcc, 0x6b, 0x3f, 0xff, 0xd9, 0xaf, 0x58, 0xc6, 0x6b,
+  0xd6, 0x33, 0x18, 0xcc, 0x6d, 0x00, 0x1f, 0xff, 0xfe, 0xdc, 0x33, 0x33, 0x66, 0xcd, 0xb3, 0x66,
+  0xcc, 0xd8, 0xd8, 0x66, 0xb0, 0x00, 0x1f, 0xff, 0x58, 0x66, 0x2d, 0x25, 0xe5, 0x36, 0xcd, 0x9e,
+  0x36, 0xc6, 0xc3, 0x05, 0xd9, 0xac, 0x7d, 0xff, 0x1b, 0x58, 0xc3, 0x06, 0xb1, 0xad, 0x66, 0x98,
+  0x60, 0xc6, 0x33, 0x19, 0x8d, 0x86, 0xbd, 0x1a, 0xff, 0xff, 0xc0, 0xff, 0xac, 0x18, 0x6b, 0xd6,
+  0x31, 0x89, 0x83, 0x58, 0x69, 0xad, 0x6b, 0x5a, 0xd3, 0x4d, 0x34, 0xd6, 0x5e, 0x98, 0xd6, 0xd6,
+  0xdf, 0xff, 0x56, 0xb6, 0xb3, 0x31, 0xb3, 0x36, 0x3d, 0x7a, 0xf5, 0xb5, 0xb5, 0xad, 0x7f, 0xf5,
+  0xeb, 0xd6, 0xc6, 0x00, 0x0f, 0xbf, 0xff, 0xb5, 0xad, 0xad, 0x8c, 0xf6, 0xe9, 0x8c, 0xcb, 0xd3,
+  0x06, 0xb2, 0xc6, 0xb5, 0x9a, 0xcd, 0x6c, 0x66, 0x66, 0xc6, 0x66, 0x31, 0xad, 0x60, 0x00, 0xfe,
+  0xff, 0x99, 0x83, 0x35, 0x8c, 0x30, 0xc6, 0xbd, 0x66, 0x31, 0xb5, 0xeb, 0x66, 0xa5, 0xac, 0xcc,
+  0xcd, 0x00, 0x0f, 0xff, 0xff, 0x68, 0xcc, 0xcc, 0xd8, 0xf3, 0x36, 0x6c, 0xd8, 0xd8, 0xc3, 0x58,
+  0x00, 0x01, 0x7c, 0x0d, 0xdf, 0x02, 0xcb, 0x2c, 0xd3, 0x35, 0xb5, 0xeb, 0x66, 0x66, 0x6c, 0x09,
+  0x0a, 0xec, 0x6d, 0x66, 0x1f, 0xff, 0xed, 0x03, 0x18, 0xc6, 0xbd, 0x66, 0x33, 0x19, 0x8c, 0xc0,
+  0x07, 0xff, 0xf7, 0xf6, 0x31, 0xb3, 0x3d, 0x79, 0xb6, 0x6c, 0xd9, 0x9e, 0xb6, 0x36, 0xb3, 0x58,
+  0x00, 0x0f, 0xfb, 0xec, 0x63, 0x16, 0xf2, 0x31, 0xdb, 0x66, 0xd9, 0xb3, 0x66, 0x36, 0xb0, 0xbb,
+  0x59, 0xac, 0xdf, 0xff, 0x73, 0x30, 0xd7, 0xad, 0x6d, 0x30, 0xd6, 0x0d, 0x63, 0x58, 0xd6, 0xc3,
+  0x19, 0x98, 0xda, 0xcc, 0x06, 0xfe, 0xff, 0xff, 0xc1, 0xcb, 0x35, 0x86, 0x6b, 0x6b, 0x34, 0x33,
+  0x6b, 0x03, 0x5a, 0xd6, 0xb5, 0xa6, 0x9a, 0x1a, 0x6b, 0x03, 0x18, 0x6f, 0xef, 0xac, 0x30, 0xd8,
+  0xcd, 0x8f, 0x5e, 0xbc, 0x66, 0x6b, 0x6b, 0x5f, 0xfc, 0xb6, 0xbd, 0x6c, 0xcc, 0x00, 0x1f, 0xff,
+  0x7f, 0x6b, 0x5e, 0xb3, 0x0f, 0xef, 0x36, 0xd6, 0xd6, 0x35, 0x83, 0x58, 0x1a, 0xcd, 0x61, 0xb5,
+  0xb1, 0x9b, 0x31, 0xb1, 0x98, 0x6b, 0x00, 0x03, 0xfe, 0xfe, 0xd6, 0x61, 0x86, 0x6b, 0x18, 0x61,
+  0x9a, 0xf5, 0x8c, 0xcd, 0x7a, 0xf5, 0xb5, 0x1d, 0x56, 0x66, 0x30, 0x00, 0xff, 0xbf, 0xe3, 0x6b,
+  0xd7, 0x8c, 0xd9, 0xb3, 0x3d, 0x79, 0x99, 0x98, 0xc3, 0x58, 0x00, 0x01, 0xfd, 0x61, 0x7d, 0xa6,
+  0x80, 0x06, 0xb6, 0xb1, 0x99, 0x99, 0x99, 0xb0, 0x24, 0x2c, 0xc6, 0xd6, 0xd6, 0xd7, 0xff, 0xf4,
+  0x61, 0x98, 0x63, 0x19, 0x8c, 0xcc, 0x66, 0x2d, 0x81, 0xff, 0xfd, 0xfd, 0xad, 0x8d, 0x8f, 0x33,
+  0x6d, 0x9b, 0x36, 0x6c, 0x7a, 0xd8, 0xc6, 0xb0, 0x00, 0x2e, 0xfe, 0x19, 0x85, 0xdc, 0x54, 0x43,
+  0x3c, 0xd9, 0xe3, 0x66, 0x63, 0x0b, 0x9a, 0xc6, 0xb6, 0xbf, 0xff, 0xb5, 0xb0, 0x66, 0xb1, 0x96,
+  0x6b, 0x2d, 0xad, 0x66, 0xb0, 0x66, 0xb6, 0xbd, 0x66, 0x36, 0xb6, 0x18, 0x0d, 0xff, 0xff, 0x93,
+  0xd6, 0x1a, 0xcd, 0x6d, 0x66, 0x9b, 0x9b, 0x35, 0x80, 0xd6, 0xb5, 0xad, 0x34, 0xd0, 0xd1, 0xa6,
+  0x0d, 0x6d, 0x67, 0x7f, 0x2c, 0xd6, 0x36, 0xbd, 0x6c, 0xd8, 0xd8, 0xd8, 0xcc, 0x1f, 0xdf, 0x19,
+  0xaf, 0x19, 0x98, 0x00, 0x1f, 0xff, 0xfe, 0x83, 0x35, 0xb1, 0x08, 0xfa, 0xda, 0xc6, 0x18, 0x0c,
+  0x5e, 0x99, 0x7a, 0x66, 0x19, 0x8d, 0x99, 0x99, 0x98, 0xc3, 0x00, 0x01, 0xff, 0x7f, 0x18, 0x6d,
+  0x66, 0xb6, 0xb1, 0xaf, 0x5a, 0xf5, 0x8c, 0x63, 0x19, 0xaf, 0x0d, 0xa8, 0x6a, 0x33, 0x30, 0xc0,
+  0x05, 0xff, 0xff, 0xe8, 0xc6, 0x66, 0xd7, 0x99, 0x9b, 0x36, 0x66, 0xcc, 0x63, 0x06, 0x00, 0x00,
+  0x7d, 0xda, 0x52, 0xcb, 0x5a, 0x34, 0x6b, 0x06, 0x63, 0x31, 0xeb, 0xc6, 0x7a, 0x13, 0x17, 0x63,
+  0x6b, 0xd6, 0x37, 0xff, 0xf7, 0x18, 0x63, 0x0c, 0xc6, 0x33, 0x31, 0x99, 0xdf, 0xff, 0xfe, 0xc7,
+  0xad, 0x87, 0xff, 0xf7, 0xfc, 0xc6, 0x66, 0xcd, 0x9e, 0xbd, 0x9b, 0x36, 0x6c, 0xcc, 0xc6, 0x35,
+  0x81, 0x46, 0x0c, 0xfe, 0xfb, 0x18, 0xd7, 0xf0, 0x90, 0x3b, 0x6c, 0xdb, 0x36, 0x66, 0x66, 0x0f,
+  0x83, 0x06, 0x6e, 0xff, 0xfb, 0x18, 0x66, 0xb3, 0x58, 0x32, 0xda, 0x60, 0xc1, 0xaf, 0x58, 0xc6,
+  0x63, 0x31, 0x8d, 0x60, 0x7f, 0xdf, 0xff, 0xf9, 0x58, 0x18, 0x36, 0xb1, 0x9d, 0x1c, 0xe6, 0x5e,
+  0x8d, 0x69, 0xad, 0x6b, 0x46, 0x80, 0xd3, 0x58, 0xd6, 0x37, 0xdf, 0x58, 0xd6, 0x33, 0x31, 0xb3,
+  0x33, 0x33, 0x1b, 0x59, 0xdf, 0xfd, 0x86, 0x63, 0x63, 0x36, 0x00, 0x0f, 0xfb, 0xff, 0x8c, 0x36,
+  0xbd, 0x11, 0x03, 0xad, 0xad, 0xac, 0x6b, 0x1a, 0xd6, 0x35, 0x86, 0xb3, 0x18, 0xcc, 0xcc, 0xd8,
+  0xcc, 0xc3, 0x2d, 0x80, 0x0f, 0xef, 0xfe, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x63, 0x5b, 0x59, 0x83,
+  0x30, 0xcc, 0x63, 0x31, 0x3f, 0x4f, 0x7a, 0xda, 0xf4, 0x00, 0x1f, 0xff, 0x7d, 0x98, 0xcc, 0xd8,
+  0xd9, 0xb3, 0x36, 0x66, 0x66, 0xbd, 0x65, 0xb0, 0x00, 0x03, 0xef, 0x85, 0xa6, 0xac, 0x5a, 0xd6,
+  0xb5, 0x8d, 0x66, 0x33, 0x1e, 0xbd, 0x78, 0xd8, 0x50, 0x60, 0xf5, 0xb5, 0xeb, 0x35, 0xfd, 0xff,
+  0x1a, 0xda, 0xc6, 0x6b, 0x6b, 0x63, 0x1b, 0x19, 0x9f, 0xff, 0xfd, 0xd6, 0xcc, 0x66, 0xbf, 0xff,
+  0xfa, 0xda, 0xf5, 0xb3, 0x66, 0x79, 0x9e, 0x6c, 0xdb, 0x33, 0x33, 0x18, 0xd6, 0x3f, 0xbb, 0x58,
+  0xc3, 0x5b, 0x5f, 0xf2, 0xcc, 0xc3, 0x7d, 0x7b, 0x6d, 0x9b, 0x66, 0xda, 0xf1, 0xb5, 0xb5, 0xbf,
+  0xfb, 0x06, 0x18, 0xdf, 0xdf, 0xc6, 0x30, 0xc3, 0x5b, 0x4c, 0x0c, 0x0c, 0x35, 0x9a, 0xda, 0xda,
+  0xd8, 0xc6, 0xd6, 0x6b, 0x0b, 0x3f, 0xff, 0xf4, 0x8b, 0x69, 0x8c, 0x30, 0x7b, 0x79, 0x30, 0x1a,
+  0x6b, 0x5a, 0xd3, 0x43, 0x40, 0x35, 0x83, 0x5b, 0xef, 0xb0, 0x61, 0x8d, 0x8c, 0xd8, 0xd9, 0x8c,
+  0xc6, 0xbf, 0xfa, 0x6b, 0xd6, 0x66, 0x63, 0x66, 0x00, 0x07, 0xff, 0xff, 0xa1, 0x86, 0x64, 0x64,
+  0x2b, 0x18, 0x61, 0x83, 0x58, 0x6b, 0x1a, 0xcc, 0x31, 0xeb, 0x36, 0x36, 0x3d, 0x66, 0x35, 0x80,
+  0x03, 0xfb, 0xff, 0x98, 0xc6, 0x61, 0x99, 0x7a, 0xc6, 0x18, 0xc3, 0x18, 0xc6, 0x33, 0x34, 0xf5,
+  0x2e, 0x36, 0xb3, 0x00, 0x0f, 0xbf, 0xfa, 0xf5, 0xb1, 0x99, 0xb1, 0xeb, 0xc6, 0xd8, 0xd8, 0xcc,
+  0x31, 0x00, 0x00, 0x7f, 0xc5, 0xa5, 0x93, 0x42, 0xc5, 0x8b, 0xd3, 0x18, 0xcc, 0x7a, 0xf5, 0xe3,
+  0x61, 0x51, 0x8f, 0x5b, 0x35, 0xeb, 0x6b, 0x7d, 0xff, 0xf0, 0xc6, 0xb3, 0x0c, 0xc6, 0x6b, 0xc6,
+  0x66, 0xff, 0xfe, 0xff, 0xbc, 0x7a, 0xd8, 0xcf, 0xff, 0xef, 0xfe, 0xb1, 0xb3, 0x36, 0xcd, 0xb3,
+  0x6c, 0xf1, 0xb6, 0xbc, 0x63, 0x1a, 0xcf, 0xff, 0xef, 0xf9, 0xac, 0x61, 0x86, 0xb7, 0xfd, 0x63,
+  0x1d, 0xdd, 0xd3, 0xcd, 0x9b, 0x6c, 0xcd, 0x8d, 0x86, 0x7f, 0xff, 0x76, 0x0c, 0x63, 0x5f, 0x7f,
+  0x30, 0xcd, 0x6d, 0x6b, 0x6b, 0x58, 0xd6, 0x0c, 0x0c, 0x6b, 0x6b, 0x31, 0x98, 0xcd, 0x6d, 0x6b,
+  0x16, 0xff, 0xfe, 0xff, 0xeb, 0x1a, 0xc3, 0x18, 0x41, 0x40, 0x0c, 0x0d, 0x69, 0xad, 0x69, 0xa0,
+  0xd0, 0x06, 0xb0, 0xbe, 0x2d, 0xad, 0x6d, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x33, 0x7f, 0xf7, 0x0c,
+  0x36, 0x33, 0x33, 0x33, 0x00, 0x0f, 0xfb, 0xff, 0xed, 0xad, 0xad, 0x92, 0x11, 0x26, 0x61, 0x86,
+  0xb3, 0x58, 0x32, 0xf4, 0xcd, 0x66, 0x33, 0x31, 0xeb, 0x66, 0x63, 0x35, 0x80, 0x03, 0xef, 0xff,
+  0xaf, 0x5b, 0x5e, 0xb3, 0x35, 0xb5, 0x98, 0x61, 0x86, 0x6b, 0x30, 0xc6, 0x63, 0x13, 0x94, 0x78,
+  0xda, 0xc0, 0x00, 0xef, 0xef, 0x99, 0xaf, 0x19, 0x9b, 0x1e, 0xbc, 0x6c, 0xcc, 0xc6, 0x19, 0x00,
+  0x01, 0xdf, 0x68, 0xb4, 0x0b, 0x40, 0x01, 0xac, 0x63, 0x31, 0xeb, 0x6d, 0x78, 0x16, 0x19, 0xd9,
+  0x8d, 0xad, 0x8b, 0xff, 0xfd, 0xe4, 0xd6, 0x6b, 0x18, 0xc6, 0x63, 0x33, 0x33, 0xfe, 0xff, 0xfb,
+  0x63, 0x66, 0xbd, 0x6d, 0xff, 0xff, 0xbd, 0x63, 0x66, 0x6c, 0xdb, 0x67, 0x8f, 0x36, 0x66, 0xc6,
+  0x31, 0xad, 0xff, 0x7f, 0xff, 0x1a, 0xc6, 0x18, 0x61, 0xbf, 0xb9, 0x98, 0xe2, 0xdd, 0xbc, 0x79,
+  0xeb, 0xcd, 0x8f, 0x5b, 0x1a, 0xdf, 0xff, 0xfe, 0x9f, 0x5a, 0xda, 0xc6, 0x63, 0xfe, 0xf9, 0xb5,
+  0x9a, 0xda, 0xc3, 0x58, 0xd6, 0x5e, 0x98, 0x35, 0x98, 0x33, 0x18, 0xda, 0xcc, 0x35, 0xac, 0xaf,
+  0xff, 0xfd, 0xbc, 0x1a, 0xcd, 0x66, 0x11, 0x30, 0xdb, 0x5a, 0xc6, 0x9a, 0xd6, 0xb4, 0xd0, 0xd1,
+  0x60, 0x69, 0x9d, 0xf6, 0x03, 0x0c, 0x63, 0x66, 0x3d, 0x6c, 0xc6, 0x67, 0x7f, 0xf3, 0x0c, 0x63,
+  0x63, 0x63, 0x63, 0x00, 0x07, 0xff, 0xff, 0x9e, 0x61, 0xb5, 0x29, 0x19, 0xb5, 0xb5, 0xb5, 0x9a,
+  0xc3, 0x2f, 0x4c, 0x35, 0xb5, 0x9a, 0xf5, 0x9b, 0x5e, 0xbc, 0x66, 0x66, 0x35, 0x98, 0x01, 0xdf,
+  0xff, 0xfe, 0x58, 0xc6, 0x66, 0x19, 0x8d, 0x6d, 0x66, 0xb3, 0x06, 0x6b, 0x31, 0xaf, 0x59, 0x89,
+  0xaa, 0x1c, 0x66, 0x5e, 0x80, 0x28, 0xfb, 0xfb, 0x1b, 0x19, 0x99, 0x9b, 0x33, 0x63, 0x6b, 0xc3,
+  0x06, 0x00, 0x0e, 0xa5, 0xa0, 0x9a, 0x16, 0x9a, 0x06, 0x98, 0x63, 0x31, 0xeb, 0x66, 0xc0, 0xb0,
+  0xd3, 0x1e, 0xb6, 0xbd, 0x63, 0xff, 0xef, 0x8c, 0x18, 0x66, 0x1b, 0x0f, 0x5b, 0x37, 0x7f, 0xff,
+  0xec, 0x1e, 0x36, 0x36, 0xb6, 0xff, 0xfb, 0xff, 0xff, 0x47, 0x1b, 0x1e, 0x3c, 0xd9, 0xe6, 0xd9,
+  0xb3, 0x36, 0x31, 0x8c, 0xfb, 0xff, 0xff, 0x80, 0x6b, 0x18, 0x63, 0x06, 0xb5, 0xa0, 0xd6, 0xd1,
+  0xb6, 0xd9, 0xe3, 0xc6, 0xcc, 0xc6, 0x3f, 0xff, 0xfc, 0x7f, 0xad, 0x63, 0x18, 0xc7, 0xfd, 0xc3,
+  0x30, 0xd6, 0xd3, 0x1a, 0xd6, 0x6b, 0x58, 0xd6, 0x35, 0x98, 0x66, 0x33, 0x5e, 0xb0, 0x6b, 0x4d,
+  0xff, 0xff, 0xc7, 0xf0, 0x6b, 0x18, 0x62, 0x3e, 0x34, 0xd6, 0x06, 0x9a, 0xd6, 0xb4, 0x68, 0x16,
+  0x03, 0x7f, 0xda, 0xc0, 0xd6, 0x30, 0xd8, 0xd8, 0xd8, 0xcd, 0xad, 0xaf, 0xfe, 0xb4, 0xcd, 0x6d,
+  0x7a, 0xd9, 0x99, 0x8f, 0x5b, 0x00, 0x0f, 0xff, 0xbf, 0x8c, 0x66, 0x97, 0x8f, 0xcc, 0x63, 0x06,
+  0x35, 0x8d, 0x63, 0x06, 0x31, 0x98, 0xd8, 0xd8, 0xd8, 0xc3, 0x30, 0x01, 0xff, 0xff, 0xe8, 0x6d,
+  0x6c, 0x66, 0x33, 0x0c, 0x61, 0x86, 0x35, 0xb5, 0x8c, 0x63, 0x5e, 0xb6, 0x99, 0xa0, 0x66, 0x30,
+  0x01, 0xc0, 0xef, 0xfb, 0xd6, 0xd7, 0xaf, 0x5e, 0xb6, 0x6c, 0x6c, 0xcc, 0xc6, 0x6b, 0x18, 0x00,
+  0xfb, 0x76, 0x82, 0x02, 0x68, 0xb5, 0xa6, 0x8d, 0x61, 0x8c, 0xcc, 0x6c, 0xcd, 0x85, 0xc6, 0xcf,
+  0x5b, 0x1b, 0x5b, 0x5f, 0xdf, 0xfc, 0xd6, 0xb6, 0xb1, 0x8c, 0x66, 0x3d, 0x66, 0xdf, 0xff, 0xfa,
+  0x7d, 0xb3, 0x36, 0x36, 0xb6, 0xbf, 0xff, 0xf4, 0x23, 0x36, 0x6c, 0xf1, 0xe7, 0x99, 0xe3, 0xc6,
+  0xc6, 0x6b, 0x6b, 0x7f, 0xff, 0xec, 0x06, 0xb3, 0x59, 0xaf, 0x5a, 0xf4, 0xc5, 0x98, 0xc8, 0xc4,
+  0xdb, 0x6c, 0xd9, 0xb3, 0x33, 0x18, 0xff, 0xfb, 0xff, 0xf8, 0xd6, 0xd6, 0x33, 0x1b, 0xff, 0xb9,
+  0x86, 0x6b, 0x35, 0x83, 0x2f, 0x4d, 0x61, 0xac, 0x6b, 0x30, 0xc6, 0x63, 0x1a, 0xcd, 0x1a, 0x7f,
+  0x7f, 0xff, 0xf2, 0x83, 0x06, 0x6b, 0x25, 0xa5, 0x06, 0xb0, 0xd3, 0x5a, 0xd6, 0x9a, 0x00, 0x58,
+  0xfa, 0x65, 0x83, 0x58, 0xd6, 0xc6, 0x6d, 0x7a, 0xf1, 0x98, 0xcb, 0xff, 0xed, 0x6d, 0x63, 0x1b,
+  0x5e, 0x33, 0x36, 0x33, 0x00, 0x0f, 0xbf, 0xff, 0x86, 0xd6, 0xd3, 0x52, 0x59, 0x8d, 0x7a, 0xc6,
+  0x0c, 0x30, 0x61, 0x8c, 0x36, 0x1e, 0xb6, 0x63, 0xd6, 0xd6, 0xc0, 0x00, 0xff, 0xff, 0xf5, 0x98,
+  0xcc, 0x6c, 0x36, 0xb6, 0xb6, 0xb1, 0x8d, 0x66, 0x5e, 0xb0, 0xcd, 0x66, 0x31, 0x2f, 0x3c, 0xcc,
+  0x6b, 0x01, 0x40, 0xd7, 0x7d, 0x6d, 0x7a, 0xd9, 0x8d, 0x99, 0xb1, 0xb5, 0xe1, 0x9a, 0xcd, 0x04,
+  0xb5, 0x37, 0x6b, 0x56, 0x5a, 0x16, 0xb4, 0xb2, 0xd6, 0x99, 0x66, 0x5e, 0x1b, 0x1b, 0x33, 0x61,
+  0x81, 0xbd, 0x99, 0x8d, 0xad, 0x97, 0xff, 0xfc, 0x40, 0xcb, 0xd3, 0x6b, 0x1b, 0x5b, 0x19, 0x9b,
+  0xff, 0xef, 0xf9, 0x9b, 0x63, 0x63, 0x0f, 0xfb, 0xff, 0xff, 0x10, 0xcd, 0x9b, 0x36, 0xd9, 0xe3,
+  0xd8, 0xf1, 0xb1, 0x9a, 0xda, 0xff, 0xff, 0xd0, 0xf8, 0x35, 0x9a, 0xda, 0xcd, 0x6d, 0x6b, 0x18,
+  0x6b, 0xeb, 0x9b, 0x7a, 0xf6, 0x6c, 0xd9, 0xb1, 0x8c, 0x7f, 0xdf, 0xff, 0xfd, 0x03, 0x0c, 0x63,
+  0x33, 0xfe, 0xfb, 0x5e, 0xb3, 0x5b, 0x5a, 0xda, 0x60, 0xd6, 0x1a, 0xd7, 0xa6, 0x18, 0xc6, 0x33,
+  0x5e, 0x98, 0x01, 0xff, 0xff, 0xd9, 0x1a, 0xd6, 0xd6, 0x19, 0x3b, 0x36, 0x18, 0x0d, 0x6b, 0x5a,
+  0xd1, 0xa1, 0x61, 0xf4, 0x1a, 0xc1, 0xac, 0x31, 0xb5, 0xb3, 0x31, 0xeb, 0x63, 0x3f, 0xbf, 0x8c,
+  0x31, 0x98, 0xcd, 0x8d, 0x99, 0x8c, 0xc0, 0x07, 0xff, 0xff, 0xaf, 0x6c, 0x36, 0x9d, 0x95, 0xc6,
+  0x61, 0x8c, 0x30, 0x61, 0x86, 0x35, 0xb0, 0xd8, 0xcc, 0xcc, 0xc6, 0xd6, 0x00, 0x1f, 0xff, 0xdf,
+  0x0d, 0x8c, 0xc6, 0xd6, 0xc6, 0x19, 0xad, 0xac, 0x30, 0xd6, 0xd6, 0x6b, 0x6b, 0x31, 0x2b, 0x38,
+  0xcd, 0x6d, 0x60, 0xa3, 0x46, 0xb5, 0x7f, 0x19, 0x98, 0xcd, 0x98, 0xd9, 0x98, 0xda, 0xcd, 0x67,
+  0xdf, 0xcb, 0x48, 0x21, 0x34, 0xb2, 0x02, 0x05, 0x96, 0xb0, 0x63, 0x35, 0xe3, 0x66, 0x60, 0xc0,
+  0xe3, 0x1e, 0xbd, 0x6d, 0x7a, 0xcf, 0xff, 0xbf, 0x86, 0x0c, 0x63, 0x31, 0x99, 0x9f, 0xdf, 0xff,
+  0xd9, 0x9b, 0x36, 0x33, 0x1a, 0xff, 0xff, 0xc3, 0xe6, 0x6c, 0xcf, 0x36, 0xcd, 0xeb, 0xd8, 0xf1,
+  0xeb, 0x6b, 0x61, 0xff, 0xdf, 0xfd, 0x61, 0x83, 0x18, 0x66, 0xb0, 0x5d, 0x2c, 0xab, 0x79, 0xb3,
+  0xcd, 0xb3, 0x33, 0x6b, 0xd6, 0x3e, 0xff, 0xff, 0xe5, 0x0c, 0x61, 0xb5, 0xeb, 0x3f, 0xbe, 0x1b,
+  0x58, 0xd6, 0x6b, 0x03, 0x17, 0xa6, 0xb3, 0x5a, 0xf5, 0xaf, 0x59, 0x86, 0xd6, 0x6b, 0x05, 0x97,
+  0xfd, 0xff, 0xf0, 0xcb, 0x35, 0x9a, 0xd4, 0xb4, 0x58, 0x6b, 0x1a, 0x6b, 0x5a, 0xd3, 0x40, 0x2f,
+  0xe6, 0x06, 0x58, 0xd6, 0x1a, 0xf0, 0xd8, 0xd8, 0xd8, 0xcc, 0xff, 0xef, 0xb1, 0xac, 0xc6, 0x66,
+  0x36, 0x66, 0x6d, 0x7a, 0xda, 0x00, 0x3f, 0xfe, 0xfe, 0x31, 0xb4, 0xfc, 0xc5, 0xb5, 0xb0, 0xcd,
+  0x66, 0xb3, 0x59, 0xac, 0x61, 0x8c, 0xd7, 0xad, 0x8c, 0xd8, 0xcc, 0x30, 0x01, 0xff, 0xdf, 0xf5,
+  0x99, 0x8c, 0xcc, 0xc6, 0x33, 0x0c, 0x30, 0xc1, 0x8d, 0x6d, 0x63, 0x5e, 0xb2, 0x4e, 0x69, 0x8c,
+  0x6b, 0x1c, 0x1a, 0x6b, 0x59, 0x7f, 0xcc, 0xc6, 0x66, 0xd7, 0x8c, 0xd8, 0xcc, 0x63, 0x57, 0xfc,
+  0x5a, 0x5a, 0x5a, 0x16, 0xb4, 0x59, 0x04, 0xd5, 0x8b, 0x2c, 0xd6, 0x1b, 0x19, 0xb3, 0x30, 0x64,
+  0x73, 0xd6, 0xcc, 0xcd, 0x7a, 0xdb, 0xfb, 0xff, 0xf8, 0x6b, 0x35, 0x98, 0x66, 0x66, 0x37, 0xff,
+  0xfe, 0x2e, 0x6c, 0xd9, 0x9b, 0x5e, 0xb6, 0xb7, 0xff, 0xdf, 0xff, 0xd8, 0xcf, 0x1e, 0x6d, 0x9b,
+  0xc7, 0x99, 0xb1, 0xb0, 0xcf, 0xbf, 0xff, 0xef, 0xb2, 0xcd, 0x63, 0x5b, 0x06, 0xd6, 0x05, 0x8a,
+  0x9a, 0x8b, 0x6d, 0x9e, 0x66, 0xcd, 0x8c, 0xc2, 0xff, 0xff, 0xe2, 0xb6, 0x99, 0xaf, 0x59, 0x8c,
+  0x77, 0xfc, 0xc6, 0x18, 0x30, 0x32, 0xcd, 0x30, 0x30, 0xd6, 0xc3, 0x19, 0xac, 0xd6, 0x59, 0x6a,
+  0xff, 0xff, 0xf6, 0x8d, 0x61, 0x86, 0x56, 0x54, 0xe1, 0xac, 0x34, 0xd6, 0xb5, 0xa6, 0x83, 0xbf,
+  0xbd, 0x35, 0x8d, 0x60, 0x6b, 0x6b, 0x31, 0x99, 0x9b, 0x5e, 0x31, 0xbf, 0xfb, 0xe6, 0x5e, 0xb3,
+  0x19, 0x99, 0x99, 0xb1, 0xb1, 0x98, 0x00, 0x7f, 0x7f, 0xfc, 0x63, 0x28, 0xa6, 0x9b, 0x5b, 0x0c,
+  0xd6, 0xd6, 0x30, 0x63, 0x0c, 0x63, 0x19, 0x8d, 0x98, 0xcc, 0x60, 0x03, 0xef, 0xff, 0xff, 0x06,
+  0x33, 0x19, 0xb1, 0x98, 0xc6, 0x30, 0xc3, 0x06, 0x1a, 0xda, 0xc6, 0x19, 0x23, 0x30, 0x6d, 0x63,
+  0x2f, 0xef, 0xfa, 0x34, 0xd6, 0xb0, 0xbf, 0x86, 0xd7, 0xad, 0x99, 0x99, 0x8f, 0x5b, 0x5b, 0x0e,
+  0xfa, 0x2d, 0x2d, 0x0b, 0x42, 0xc8, 0x13, 0x76, 0x40, 0x2c, 0x35, 0x98, 0xda, 0xf5, 0xe3, 0xd7,
+  0x86, 0x87, 0x76, 0x66, 0x63, 0x61, 0xbf, 0xff, 0xe6, 0x63, 0x58, 0xd6, 0xd6, 0xc3, 0x63, 0x6f,
+  0xff, 0xfc, 0x4e, 0x78, 0xf5, 0xe6, 0x66, 0x63, 0x5b, 0xff, 0xfe, 0xd5, 0x78, 0xf1, 0xe6, 0xd9,
+  0xe6, 0x79, 0x9b, 0x31, 0x8c, 0xff, 0xff, 0xb7, 0xd6, 0x0c, 0x19, 0x86, 0x35, 0x9a, 0x54, 0xa7,
+  0x25, 0xef, 0x1e, 0xcd, 0xb3, 0x33, 0x63, 0x5b, 0x5f, 0xff, 0xfb, 0xc1, 0xad, 0xad, 0x86, 0xd6,
+  0xd3, 0xff, 0xec, 0x63, 0x59, 0xac, 0x35, 0x97, 0xa3, 0x2c, 0xd3, 0x18, 0x36, 0xb3, 0x1a, 0xcd,
+  0x6b, 0x4d, 0x3b, 0xfb, 0x4c, 0x1a, 0xda, 0xd6, 0x76, 0x18, 0x30, 0x1a, 0xd6, 0xb5, 0xa0, 0xbf,
+  0xec, 0x0c, 0x1a, 0xc3, 0x59, 0xad, 0xaf, 0x5b, 0x33, 0x1e, 0xbd, 0x6d, 0x7f, 0x7f, 0x06, 0x33,
+  0x19, 0x99, 0xb1, 0xb3, 0x33, 0x18, 0x00, 0x5f, 0xff, 0xfe, 0x63, 0x32, 0x92, 0x71, 0xb5, 0xb0,
+  0xcc, 0x30, 0xc6, 0xb3, 0x0c, 0x33, 0x18, 0xcc, 0xcc, 0x66, 0x68, 0x01, 0x7f, 0xff, 0xf9, 0x30,
+  0xcc, 0x6c, 0xc6, 0xd7, 0xac, 0xc6, 0x18, 0x6b, 0x6b, 0x5b, 0x5a, 0xda, 0xc6, 0x19, 0x1d, 0x2a,
+  0xc3, 0x0c, 0xff, 0xef, 0xfe, 0xd6, 0xb5, 0xad, 0x62, 0xcf, 0xb9, 0x98, 0xd8, 0xd8, 0xd8, 0xcc,
+  0xc3, 0x5f, 0xf0, 0x20, 0x81, 0x34, 0x2d, 0x69, 0x6b, 0x56, 0xb4, 0x2c, 0x1a, 0xcc, 0x66, 0x66,
+  0x6c, 0x1a, 0x1e, 0x36, 0x6d, 0x7a, 0xd8, 0xcf, 0xfe, 0xff, 0xe0, 0xc3, 0x1a, 0xf5, 0xb1, 0x9b,
+  0xff, 0xef, 0xfe, 0xd9, 0x9b, 0x3d, 0x6c, 0xcc, 0x35, 0xff, 0x7f, 0xff, 0xd4, 0xec, 0x78, 0xf3,
+  0x6d, 0x9b, 0x66, 0xd8, 0xd8, 0xc6, 0xff, 0xff, 0xb0, 0xeb, 0x2d, 0xad, 0x6d, 0x6d, 0x66, 0xb6,
+  0xb3, 0x4d, 0x40, 0x92, 0x8d, 0xb6, 0xd9, 0xe6, 0x6d, 0x8d, 0xaf, 0x58, 0xdf, 0xff, 0xfb, 0x7c,
+  0x18, 0x6d, 0x6c, 0x61, 0x9f, 0xfd, 0x33, 0x58, 0xcb, 0xd3, 0x58, 0x35, 0x96, 0x6b, 0x59, 0xac,
+  0xd7, 0xac, 0x63, 0x59, 0xa3, 0x40, 0xff, 0xed, 0x6b, 0x35, 0x86, 0xba, 0xb7, 0xcb, 0xd6, 0xb1,
+  0xa6, 0xb5, 0xad, 0x34, 0xff, 0xa6, 0xb0, 0xc0, 0xc0, 0xc6, 0x1b, 0x19, 0xb1, 0xb1, 0xb5, 0x7f,
+  0xff, 0x6b, 0x0c, 0xc6, 0x66, 0xc6, 0xcc, 0xcd, 0x8c, 0xc0, 0x00, 0xff, 0xff, 0xf6, 0xfb, 0x6b,
+  0xd6, 0xa6, 0x9e, 0x66, 0x6b, 0xd6, 0x61, 0x9a, 0xcd, 0x66, 0x1a, 0xf5, 0x8c, 0x6d, 0x6c, 0x66,
+  0x36, 0x00, 0x07, 0xff, 0xff, 0xaf, 0x35, 0xb1, 0x99, 0x99, 0x8d, 0x86, 0x61, 0x86, 0xb3, 0x58,
+  0x6b, 0x35, 0x8c, 0x32, 0x32, 0x4c, 0xc6, 0x0d, 0xff, 0x7f, 0xf5, 0xad, 0x6b, 0x2c, 0x58, 0xee,
+  0xb6, 0x36, 0xbd, 0x78, 0xc7, 0xad, 0x8c, 0x5f, 0x41, 0x68, 0x5a, 0x0b, 0x5a, 0x0b, 0x42, 0x08,
+  0x00, 0xd6, 0x6b, 0xd6, 0xcc, 0xcd, 0x83, 0x63, 0xdb, 0x33, 0x33, 0x33, 0x5a, 0xff, 0xff, 0xa5,
+  0x34, 0xc6, 0x18, 0xcc, 0xcf, 0xbf, 0xff, 0xef, 0x99, 0xb3, 0x66, 0xcc, 0x6c, 0x19, 0xff, 0xff,
+  0x50, 0xc7, 0x99, 0xbc, 0x79, 0xb6, 0xcc, 0xd8, 0xda, 0xcf, 0xfe, 0xff, 0xac, 0xb1, 0x97, 0xac,
+  0x61, 0x99, 0x7a, 0x6a, 0x61, 0x11, 0x07, 0x6d, 0x9e, 0x6d, 0x99, 0xb1, 0x98, 0x6f, 0xff, 0xfd,
+  0x8f, 0xeb, 0x35, 0x9a, 0xf5, 0xb5, 0xeb, 0x30, 0xfe, 0xe1, 0x8d, 0x66, 0x98, 0x1a, 0xd6, 0x06,
+  0x5e, 0x98, 0xc6, 0xbd, 0x63, 0x2c, 0x69, 0x60, 0xfe, 0xac, 0x35, 0x9a, 0xc1, 0xbe, 0xd6, 0x6b,
+  0x03, 0x5a, 0xd6, 0xb4, 0xef, 0xe1, 0xac, 0x18, 0x32, 0xf4, 0xcd, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x7f, 0xff, 0x70, 0xc3, 0x63, 0x33, 0x63, 0x6d, 0x79, 0x98, 0xda, 0xf4, 0xc0, 0x0f, 0xff, 0xbf,
+  0xaf, 0x5e, 0xb5, 0x45, 0x03, 0x31, 0x98, 0xc6, 0x19, 0xac, 0xd6, 0xd6, 0x6b, 0x6b, 0x6b, 0x61,
+  0xb1, 0x98, 0xc0, 0x03, 0xff, 0xef, 0xf8, 0x6d, 0x6d, 0x78, 0xcd, 0xaf, 0x0d, 0x86, 0x30, 0x61,
+  0x96, 0xd3, 0x1a, 0xc3, 0x35, 0xa2, 0x64, 0x0c, 0x30, 0xdf, 0xdf, 0xff, 0x2c, 0xb2, 0xcb, 0x16,
+  0x1f, 0xc6, 0x66, 0x63, 0x63, 0x6b, 0xd6, 0xce, 0xfb, 0x41, 0x68, 0x13, 0x42, 0xc9, 0xa5, 0xa1,
+  0x04, 0xd2, 0xc6, 0x99, 0xad, 0x98, 0xd9, 0xb0, 0x70, 0x7f, 0x63, 0xd7, 0x8c, 0xcc, 0x6f, 0xff,
+  0xfa, 0xcf, 0x8d, 0x6b, 0xd6, 0xbd, 0x6d, 0x7a, 0xd9, 0xff, 0xff, 0x80, 0xd9, 0x9b, 0x66, 0xc6,
+  0xc6, 0x1a, 0xff, 0xbf, 0xff, 0xb1, 0xe6, 0x79, 0xb3, 0xcd, 0x9b, 0x63, 0x63, 0x5d, 0xff, 0xff,
+  0x3f, 0xac, 0xb3, 0x58, 0x66, 0xb6, 0xb6, 0xb0, 0xd6, 0x90, 0x3f, 0x3c, 0xdb, 0x67, 0x9b, 0x66,
+  0x66, 0xc6, 0xbd, 0x3f, 0xff, 0xbf, 0xff, 0xb0, 0xd6, 0xc3, 0x6b, 0x63, 0x5b, 0x4f, 0xfe, 0x6b,
+  0xd3, 0x1a, 0xc0, 0xd6, 0xb0, 0x1a, 0xc6, 0xb3, 0x0c, 0x33, 0x5a, 0xc2, 0xc0, 0x77, 0xd6, 0x6b,
+  0x0d, 0x91, 0x8b, 0xac, 0x6b, 0x0d, 0x6b, 0x5a, 0xd3, 0xef, 0xec, 0x0c, 0x0c, 0x6b, 0x0d, 0x6c,
+  0x36, 0x33, 0x63, 0xd6, 0xcd, 0x5f, 0xff, 0xe9, 0xba, 0xc6, 0x33, 0x33, 0x36, 0x66, 0xc7, 0xaf,
+  0x19, 0xaf, 0x58, 0x00, 0xff, 0xbf, 0xf8, 0x6c, 0xa9, 0xa1, 0xd7, 0xad, 0x8c, 0x63, 0x35, 0xb5,
+  0x9a, 0xcc, 0x31, 0x86, 0x63, 0x31, 0xb5, 0xb0, 0x00, 0xfe, 0xff, 0xff, 0xee, 0xcc, 0x31, 0xb1,
+  0xb1, 0xb1, 0x98, 0xc6, 0xbd, 0x30, 0xd6, 0x1a, 0xc3, 0x06, 0x1a, 0x1a, 0x34, 0x63, 0x03, 0xff,
+  0xff, 0xbd, 0x62, 0xcb, 0x2c, 0x2c, 0x77, 0x66, 0x36, 0x33, 0x31, 0xeb, 0x2f, 0x80, 0x26, 0x85,
+  0xad, 0x34, 0xb2, 0xd0, 0x84, 0x2d, 0x00, 0x6b, 0x6b, 0x63, 0x63, 0x6c, 0x1c, 0x20, 0x36, 0x6d,
+  0x78, 0xcc, 0xd7, 0x7f, 0xff, 0xd9, 0x66, 0x98, 0xc3, 0x31, 0xb7, 0xff, 0xfe, 0x1f, 0xf6, 0xd9,
+  0x9b, 0x36, 0xd7, 0x8d, 0xac, 0x6b, 0x7f, 0xff, 0xce, 0x19, 0xb6, 0x6d, 0xb3, 0x6d, 0x99, 0xb1,
+  0x9a, 0xff, 0xff, 0x99, 0xd6, 0xb0, 0x6b, 0x6b, 0x30, 0xc6, 0xb6, 0xb5, 0xa1, 0xce, 0x8d, 0xf6,
+  0xd9, 0xe6, 0xcf, 0x5e, 0x36, 0xbd, 0x63, 0x7f, 0xfd, 0xff, 0xff, 0x9b, 0xad, 0xac, 0x63, 0x6b,
+  0x61, 0x9a, 0xcf, 0xfa, 0x32, 0xf5, 0xac, 0x34, 0xcb, 0x03, 0x5a, 0xcd, 0x63, 0x5e, 0xb1, 0x83,
+  0x5a, 0xc0, 0x07, 0xfc, 0x18, 0x6c, 0xfc, 0xcd, 0x61, 0x80, 0xd6, 0xb5, 0xaf, 0xee, 0xb5, 0x83,
+  0x06, 0x0c, 0x30, 0xda, 0xd9, 0x8f, 0x5e, 0x33, 0x6b, 0xdf, 0xff, 0xdf, 0xc6, 0xb6, 0xbd, 0x6c,
+  0xcc, 0xd9, 0x9b, 0x33, 0x63, 0x61, 0xac, 0x00, 0xfb, 0xff, 0xfa, 0xf5, 0xb5, 0x57, 0x46, 0xcc,
+  0x6d, 0x7a, 0xcc, 0x36, 0xb1, 0x8d, 0x6d, 0x6d, 0x63, 0x30, 0xcc, 0xc6, 0x30, 0x02, 0xff, 0xff,
+  0xf1, 0xcd, 0x63, 0x33, 0x31, 0xeb, 0xd6, 0xcd, 0x7a, 0xcd, 0x6d, 0x60, 0xd6, 0x35, 0x83, 0x59,
+  0xac, 0xd4, 0x1c, 0x55, 0xb5, 0xb5, 0x83, 0xff, 0xfb, 0x8b, 0x2c, 0x59, 0x62, 0xc3, 0xe3, 0x6b,
+  0xd6, 0xcc, 0x6d, 0x7a, 0xe4, 0x02, 0xd6, 0x80, 0xb5, 0xad, 0x0b, 0x42, 0x10, 0x9a, 0x01, 0x8c,
+  0x66, 0x67, 0xaf, 0x07, 0x48, 0x36, 0x66, 0x6c, 0x6d, 0x7a, 0xcf, 0xff, 0xfb, 0xae, 0x0c, 0x31,
+  0x9a, 0xf5, 0xfd, 0xff, 0xfc, 0xd9, 0xb3, 0x66, 0xcc, 0xcc, 0xd6, 0xd3, 0x7f, 0xf7, 0xff, 0xf7,
+  0x8d, 0xb6, 0x6c, 0xf3, 0x66, 0xd8, 0xcc, 0xdf, 0xff, 0xf2, 0x74, 0xcb, 0x1a, 0xcd, 0x6d, 0x66,
+  0x1a, 0xda, 0xd6, 0x80, 0x36, 0x33, 0xd9, 0xec, 0xdb, 0x3d, 0x78, 0xcc, 0xc1, 0xfd, 0xff, 0xff,
+  0x95, 0x61, 0x8c, 0xd7, 0xad, 0x86, 0x6b, 0x0f, 0xfe, 0x61, 0x97, 0xa3, 0x5a, 0xc0, 0x1a, 0xc1,
+  0xaf, 0x5a, 0xf5, 0x9a, 0xc3, 0x4c, 0x00, 0x3e, 0xe6, 0xb1, 0xb5, 0xb4, 0xd9, 0x7a, 0x60, 0xd3,
+  0x59, 0x7f, 0x74, 0x6b, 0x0d, 0x66, 0xb0, 0xc3, 0x5e, 0xb3, 0x6b, 0xd7, 0x8d, 0x99, 0x8d, 0xbf,
+  0xff, 0xd2, 0xc1, 0x9a, 0xf1, 0xb3, 0x36, 0x6c, 0xcd, 0x8f, 0x5b, 0x1a, 0xc0, 0x05, 0xff, 0xff,
+  0xe7, 0x6c, 0x6a, 0xca, 0x46, 0xd6, 0xc6, 0xd6, 0x66, 0xbd, 0x63, 0x5e, 0xb1, 0x86, 0x6b, 0x6b,
+  0x33, 0x5e, 0xb6, 0xbd, 0x00, 0x1f, 0xff, 0xfe, 0x91, 0xac, 0xc6, 0x66, 0xd7, 0x8c, 0xcc, 0x66,
+  0xb3, 0x58, 0xd6, 0x06, 0x59, 0xac, 0x19, 0xa8, 0x08, 0x6c, 0x33, 0x58, 0x7f, 0xdf, 0xf0, 0x2c,
+  0xb2, 0xcb, 0x2c, 0x1f, 0x63, 0xd6, 0x6c, 0x63, 0x7c, 0x00, 0x59, 0x34, 0x00, 0xb4, 0x08, 0x45,
+  0xab, 0x4d, 0x2d, 0xa6, 0xbd, 0x66, 0x3c, 0x67, 0x83, 0xc4, 0x3b, 0x1e, 0x36, 0x36, 0x31, 0xff,
+  0xdf, 0xff, 0x06, 0x1a, 0xf5, 0x99, 0x7f, 0xff, 0xe1, 0x66, 0xcc, 0xdb, 0x33, 0xd6, 0xcc, 0x61,
+  0xa7, 0xff, 0xfc, 0x81, 0x9b, 0x36, 0xd9, 0xe3, 0xcc, 0xda, 0xf1, 0xff, 0xf7, 0xd6, 0xb5, 0x86,
+  0x0c, 0x63, 0x0c, 0x19, 0x3c, 0x19, 0x17, 0xe7, 0xb3, 0x7a, 0xf6, 0x3c, 0x66, 0x6b, 0x6b, 0xbf,
+  0xff, 0xf1, 0xb0, 0x63, 0x19, 0x8c, 0xd6, 0xcb, 0x69, 0x7f, 0x0c, 0x35, 0xad, 0x60, 0x06, 0xb5,
+  0x8c, 0xbd, 0x63, 0x0d, 0x60, 0x00, 0x05, 0xf4, 0xc6, 0xdd, 0xda, 0x6b, 0x1a, 0xc3, 0x4c, 0xb7,
+  0xf7, 0xf0, 0xd3, 0x03, 0x1a, 0xc6, 0x0d, 0xad, 0x8c, 0xd9, 0x99, 0xb1, 0x8f, 0xff, 0xf4, 0xa3,
+  0x5e, 0xb3, 0x33, 0x63, 0xcc, 0xd9, 0x9e, 0xbd, 0x7a, 0xf5, 0xb5, 0x9a, 0x00, 0x7f, 0xff, 0xfa,
+  0x0d, 0xaa, 0xea, 0x66, 0x66, 0x33, 0x31, 0x86, 0xd6, 0x6b, 0x6b, 0x30, 0x66, 0x19, 0x8c, 0x60,
+  0x01, 0xff, 0xfd, 0xfc, 0x6b, 0x19, 0xaf, 0x1b, 0x1b, 0x35, 0xe3, 0x0c, 0xd6, 0x1a, 0xc3, 0x4c,
+  0x0c, 0x18, 0xcf, 0xb0, 0x6c, 0x63, 0x58, 0xbf, 0xff, 0xfa, 0x41, 0x65, 0xac, 0xb5, 0x96, 0x07,
+  0x36, 0xbd, 0x7a, 0xd9, 0xf6, 0x00, 0x0b, 0x2d, 0x69, 0xa0, 0x16, 0x8b, 0x48, 0x42, 0xd0, 0x06,
+  0x33, 0x1b, 0x36, 0x61, 0xf2, 0x2c, 0xd9, 0xb1, 0xeb, 0x63, 0x35, 0xff, 0xff, 0x91, 0x66, 0xb0,
+  0xcd, 0x7a, 0xdf, 0xff, 0xf9, 0x1d, 0x99, 0xb3, 0x66, 0xcd, 0x98, 0xda, 0xc3, 0x5f, 0xf7, 0xff,
+  0x33, 0x6c, 0xdb, 0x36, 0xcf, 0x5e, 0x33, 0x7f, 0x7f, 0xfd, 0xad, 0x65, 0xb4, 0xcd, 0x66, 0xb6,
+  0xb3, 0x59, 0xad, 0x67, 0x12, 0xe2, 0xbc, 0xf3, 0xcd, 0xb3, 0x66, 0x66, 0x6b, 0x35, 0xff, 0xff,
+  0x87, 0xac, 0xd6, 0x63, 0x31, 0x98, 0x61, 0xac, 0xfb, 0xec, 0x19, 0x62, 0xc0, 0x68, 0xcb, 0x18,
+  0x33, 0x58, 0xd6, 0x00, 0x00, 0x3e, 0xec, 0x39, 0x38, 0x4d, 0x66, 0xb0, 0xd3, 0x5a, 0xff, 0xf9,
+  0x61, 0xad, 0x6d, 0x33, 0x58, 0x63, 0x0d, 0x98, 0xd9, 0xb1, 0xeb, 0xd6, 0xdf, 0xdf, 0xff, 0xe9,
+  0x03, 0x0d, 0x8f, 0x5e, 0x66, 0xcd, 0x9b, 0x36, 0x33, 0x35, 0xb4, 0x00, 0x7f, 0xff, 0xfb, 0x71,
+  0x9a, 0xbe, 0x9d, 0x99, 0x98, 0xda, 0xd8, 0x66, 0x18, 0xc3, 0x1a, 0xda, 0xda, 0xda, 0xda, 0xd8,
+  0x00, 0x7f, 0x7f, 0xff, 0xf7, 0x6d, 0x30, 0xcc, 0xc6, 0xcc, 0xcc, 0xc6, 0x31, 0x81, 0x8b, 0xd1,
+  0x96, 0x35, 0x86, 0x0f, 0x2f, 0xec, 0x33, 0x59, 0x6f, 0xfe, 0xfe, 0x05, 0xad, 0x6b, 0x5a, 0xcb,
+  0x16, 0x37, 0x66, 0xbd, 0xd9, 0x60, 0x00, 0xb1, 0x65, 0xad, 0x68, 0xd5, 0x90, 0x88, 0xb7, 0x64,
+  0x00, 0xc6, 0x33, 0x66, 0x6c, 0x40, 0x47, 0x9b, 0x36, 0x3d, 0x7a, 0xd8, 0x6f, 0xff, 0xfc, 0xff,
+  0xf8, 0x30, 0xc6, 0x3f, 0xfe, 0xff, 0x8f, 0x5b, 0x66, 0xcd, 0x99, 0xb1, 0x8c, 0x07, 0xff, 0xfc,
+  0x37, 0x67, 0xaf, 0x3d, 0x7b, 0x36, 0x6c, 0xcc, 0x7f, 0xff, 0xbf, 0xeb, 0x5a, 0xc3, 0x59, 0xad,
+  0xac, 0x63, 0x58, 0xd6, 0x35, 0x15, 0x13, 0xe7, 0x9e, 0x6c, 0xdb, 0x33, 0x31, 0x86, 0xff, 0xff,
+  0xc0, 0xec, 0x31, 0x8c, 0xc6, 0x6b, 0xd6, 0x35, 0x96, 0x77, 0xc6, 0x58, 0x00, 0x34, 0x65, 0x9a,
+  0xc6, 0x18, 0x34, 0x00, 0x00, 0x5f, 0x0e, 0xbe, 0x7c, 0xcb, 0xd3, 0x06, 0xb5, 0xbf, 0xfb, 0xac,
+  0x2f, 0x4c, 0x18, 0x61, 0xaf, 0x59, 0x98, 0xdb, 0x5e, 0x66, 0x6d, 0x79, 0xff, 0x7f, 0xff, 0xa3,
+  0xeb, 0x31, 0x9b, 0x1e, 0x3c, 0x79, 0x9b, 0x6b, 0xcc, 0x66, 0x0c, 0x00, 0xff, 0xfb, 0xfe, 0xcc,
+  0xd6, 0x35, 0x1e, 0x33, 0x33, 0x19, 0x8c, 0x63, 0x18, 0x63, 0x5b, 0x59, 0xad, 0x86, 0x00, 0x0b,
+  0xff, 0xff, 0xc8, 0x30, 0xc6, 0x66, 0x66, 0x6c, 0x66, 0x19, 0x96, 0xd6, 0xb0, 0x69, 0x80, 0xc1,
+  0x87, 0x57, 0xb3, 0x35, 0x9a, 0xc5, 0xff, 0xff, 0xce, 0x2c, 0xb5, 0xa6, 0xb4, 0xd6, 0x58, 0x06,
+  0x9a, 0xc5, 0x80, 0x01, 0x60, 0xb1, 0x6b, 0x42, 0xd2, 0x11, 0x16, 0x82, 0xcd, 0x66, 0xbd, 0x78,
+  0xd9, 0x84, 0x44, 0xad, 0xb3, 0x66, 0x63, 0xd6, 0xd6, 0xfb, 0xff, 0xff, 0x58, 0x18, 0xc6, 0x7f,
+  0x7f, 0xff, 0xe5, 0xb6, 0x36, 0xcc, 0xdb, 0x1e, 0xbc, 0x63, 0x58, 0x3e, 0xff, 0xfe, 0xd9, 0x9e,
+  0x6c, 0xdb, 0x63, 0xd7, 0xad, 0xff, 0xfd, 0x5a, 0xcb, 0x0c, 0x18, 0xc6, 0xb3, 0x59, 0xad, 0x66,
+  0x32, 0x72, 0x3f, 0x66, 0xf3, 0x3c, 0xd8, 0xf5, 0xeb, 0x30, 0x7f, 0xff, 0xde, 0x7c, 0x18, 0xc6,
+  0x36, 0x1b, 0x59, 0xad, 0x60, 0x3f, 0xec, 0x00, 0x06, 0x86, 0xb0, 0x6b, 0x6b, 0x35, 0x80, 0x00,
+  0x00, 0x3e, 0xb7, 0x8f, 0x70, 0xd6, 0xd6, 0x06, 0xb7, 0x7f, 0xfd, 0x96, 0xb0, 0x6b, 0x35, 0x86,
+  0x35, 0xeb, 0x31, 0xeb, 0xd7, 0x99, 0x9b, 0x1e, 0xb7, 0xfd, 0xff, 0xfe, 0x8e, 0x63, 0x1b, 0x36,
+  0x67, 0x99, 0xb6, 0x66, 0xcc, 0x66, 0x18, 0x00, 0xff, 0xef, 0xf8, 0xcd, 0x65, 0x54, 0xcd, 0x8c,
+  0xcc, 0x66, 0x35, 0xeb, 0x6b, 0x18, 0xd6, 0x61, 0x86, 0x6b, 0x00, 0x0f, 0xff, 0xff, 0x5e, 0x35,
+  0x86, 0x63, 0x63, 0x36, 0x63, 0x6b, 0x60, 0xc6, 0xb2, 0xc6, 0x9a, 0xc0, 0xd6, 0x6b, 0x1c, 0x5d,
+  0xb6, 0xb6, 0xb1, 0xac, 0x7f, 0xdf, 0xf1, 0x64, 0xd3, 0x46, 0x9a, 0xd6, 0x58, 0x34, 0xd6, 0xb1,
+  0x60, 0x06, 0x80, 0x01, 0x69, 0xbb, 0x44, 0x2b, 0x4b, 0x42, 0xc3, 0x5b, 0x5b, 0x33, 0x3d, 0x78,
+  0x8c, 0x99, 0xe3, 0x6c, 0xcc, 0xcc, 0x63, 0xff, 0xff, 0x7b, 0xfb, 0x35, 0xaf, 0x58, 0xdf, 0xff,
+  0xfa, 0x66, 0x67, 0xaf, 0x1e, 0x3c, 0x6c, 0xcc, 0x30, 0x2f, 0xff, 0xbb, 0x36, 0x6d, 0xb3, 0x66,
+  0xcc, 0x7f, 0x7f, 0x5a, 0xd6, 0x5b, 0x5a, 0xda, 0xcd, 0x6d, 0x61, 0x86, 0xb4, 0xb8, 0x46, 0x41,
+  0x9b, 0xcd, 0x9e, 0x66, 0xcc, 0x66, 0x0f, 0xff, 0xfb, 0x9f, 0xf8, 0x31, 0xaf, 0x0d, 0x8c, 0x61,
+  0x80, 0x07, 0x71, 0xa1, 0xa0, 0x1a, 0x6b, 0x0c, 0x30, 0xd0, 0x00, 0x00, 0x03, 0xfb, 0xdf, 0xd0,
+  0x6b, 0x35, 0x86, 0xb5, 0xfd, 0xf4, 0xd6, 0xb0, 0x6b, 0x35, 0x8c, 0x31, 0x99, 0x99, 0x9e, 0xbc,
+  0x7a, 0xf5, 0xeb, 0xdf, 0xff, 0x7f, 0xff, 0x0c, 0x66, 0x7a, 0xf3, 0x36, 0xd9, 0x9e, 0x36, 0x66,
+  0x30, 0xd0, 0x03, 0xfb, 0xff, 0xfb, 0x33, 0x59, 0xd5, 0xe3, 0x36, 0x36, 0xbd, 0x6d, 0x7a, 0xcc,
+  0x31, 0x8d, 0x66, 0xb3, 0x06, 0x60, 0x00, 0xff, 0xfb, 0xfe, 0x6b, 0x58, 0xc6, 0x66, 0x36, 0x66,
+  0x63, 0x6b, 0x35, 0x9a, 0x60, 0x1a, 0xd6, 0x06, 0x0c, 0x6c, 0x72, 0x19, 0x97, 0xa6, 0x2f, 0xff,
+  0xb9, 0x64, 0xd0, 0x34, 0x35, 0xac, 0x5b, 0x43, 0x59, 0x60, 0x03, 0x46, 0x8d, 0x34, 0x05, 0xab,
+  0x44, 0x84, 0xb4, 0x2c, 0x18, 0x6c, 0x6d, 0x8f, 0x12, 0x93, 0xf9, 0xb3, 0x36, 0x66, 0xd6, 0xc3,
+  0xfe, 0xff, 0xff, 0xe4, 0xc6, 0xb1, 0x8f, 0xff, 0xef, 0xfb, 0x33, 0x36, 0x67, 0x8d, 0xb1, 0xb1,
+  0x9a, 0xc5, 0x9f, 0x7f, 0xfd, 0x9b, 0x66, 0xcd, 0xb3, 0x66, 0x77, 0xff, 0x5a, 0xd6, 0x59, 0xac,
+  0x31, 0xad, 0xac, 0x6b, 0x1a, 0xd2, 0xb1, 0x00, 0xeb, 0xcd, 0xb6, 0xcd, 0x9b, 0x1b, 0x0c, 0x3f,
+  0xff, 0xbf, 0xfe, 0xb6, 0xb1, 0x8c, 0x6c, 0x63, 0x35, 0x83, 0x46, 0xac, 0x9d, 0x68, 0x68, 0x03,
+  0x5a, 0xcd, 0x66, 0xb0, 0x00, 0x00, 0x00, 0x3f, 0xbe, 0xb0, 0xc3, 0x2d, 0xa6, 0xbf, 0xfb, 0x9a,
+  0x6b, 0x58, 0xd6, 0x18, 0x61, 0xb5, 0xeb, 0x66, 0x6c, 0xd9, 0x99, 0xb1, 0xff, 0x7f, 0xff, 0xa3,
+  0xe1, 0x8f, 0x5b, 0x66, 0xcf, 0x1e, 0x6c, 0xcf, 0x5e, 0xbd, 0x6d, 0x6d, 0x68, 0x01, 0xdf, 0xff,
+  0xfe, 0x39, 0x9a, 0xd6, 0xb5, 0xb1, 0xb3, 0x1b, 0x5e, 0xb6, 0xb6, 0x18, 0xc3, 0x0c, 0x30, 0xc2,
+  0x8c, 0x07, 0xf7, 0xff, 0xf6, 0xb5, 0xaf, 0x4c, 0xc6, 0x66, 0x66, 0xd7, 0x8c, 0x63, 0x59, 0xac,
+  0xb0, 0xd3, 0x5a, 0xc0, 0xc3, 0x4d, 0x0d, 0xb8, 0xc6, 0x0d, 0x67, 0x7f, 0xff, 0x16, 0x9a, 0x00,
+  0x0d, 0x6b, 0x01, 0xa6, 0x58, 0x03, 0x4d, 0x35, 0xac, 0xb5, 0xa6, 0x96, 0x85, 0x6a, 0xd4, 0x2d,
+  0x59, 0x61, 0xad, 0xaf, 0x1b, 0x33, 0xc4, 0xe5, 0x3e, 0x66, 0xd8, 0xf1, 0x98, 0xcd, 0x7f, 0xff,
+  0xf6, 0x06, 0xb6, 0xb7, 0xfd, 0xff, 0xfc, 0xcc, 0xcc, 0xf5, 0xe6, 0x6c, 0xd8, 0xcc, 0x6b, 0x16,
+  0x7f, 0xff, 0x4d, 0xb3, 0x66, 0xd9, 0xb1, 0xef, 0xff, 0xf6, 0xb2, 0xd6, 0xb0, 0x60, 0xc6, 0x1a,
+  0xda, 0xd6, 0xd3, 0x4a, 0x03, 0xc3, 0x5e, 0x6d, 0xb6, 0x6d, 0x9b, 0x19, 0x8c, 0xb7, 0xfd, 0xff,
+  0xff, 0x5d, 0x9a, 0xc6, 0x33, 0x1b, 0x0c, 0xcb, 0xd3, 0x4d, 0x35, 0x6b, 0x76, 0x4a, 0xd0, 0x00,
+  0x03, 0x18, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfd, 0x1a, 0xda, 0xc0, 0xdd, 0xff, 0xd3, 0x46, 0x98,
+  0x35, 0x99, 0x7a, 0xcd, 0x7a, 0xd9, 0x99, 0xb3, 0x66, 0xc6, 0xc7, 0xf7, 0xff, 0xfa, 0x46, 0xb1,
+  0xb5, 0xe6, 0x6d, 0x9b, 0x67, 0x8f, 0x5e, 0x66, 0x66, 0xb6, 0xb2, 0x00, 0xbf, 0xff, 0xfc, 0xb3,
+  0x35, 0xbd, 0x7b, 0x63, 0xd6, 0xcc, 0xc6, 0x63, 0x18, 0xc3, 0x06, 0x30, 0x63, 0xe5, 0xb5, 0x82,
+  0xff, 0xff, 0xf2, 0xcb, 0x58, 0xd6, 0xd7, 0xad, 0xaf, 0x1b, 0x1b, 0x19, 0xaf, 0x58, 0x35, 0x80,
+  0x69, 0xac, 0xb3, 0x58, 0x66, 0x36, 0x8c, 0x33, 0x2f, 0x4c, 0x3f, 0xef, 0xfa, 0xd3, 0x45, 0x82,
+  0xc6, 0x9a, 0xcb, 0x1a, 0x6b, 0x58, 0x0d, 0x35, 0xac, 0xb0, 0x58, 0xb4, 0x2d, 0x5b, 0xe3, 0x35,
+  0xc4, 0x16, 0x58, 0xc6, 0x66, 0x6d, 0x85, 0x25, 0x7b, 0x6c, 0xcd, 0x99, 0xb5, 0xeb, 0x1b, 0xff,
+  0xff, 0xd3, 0xff, 0x83, 0x1b, 0xbf, 0xff, 0xf8, 0xcc, 0x6c, 0xcf, 0x5e, 0x3c, 0x6d, 0xaf, 0x0c,
+  0xd6, 0x59, 0x77, 0xff, 0x36, 0xcd, 0x9e, 0xbc, 0xd8, 0xfb, 0xf9, 0x6b, 0x58, 0x18, 0x61, 0xaf,
+  0x5a, 0xda, 0xd6, 0x69, 0x92, 0x86, 0xc6, 0x1b, 0x6d, 0xb3, 0x6c, 0xcc, 0xcd, 0x7a, 0xd6, 0xfb,
+  0xff, 0xfe, 0xaf, 0x35, 0x8c, 0xd7, 0xaf, 0x5b, 0x5e, 0xb6, 0xb3, 0x4c, 0xb5, 0xa1, 0x6a, 0xd2,
+  0xd5, 0xa1, 0x69, 0xad, 0x60, 0xc6, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf3, 0xed, 0x61, 0x97, 0xa6,
+  0xfb, 0xff, 0xb4, 0x0d, 0x30, 0x6b, 0x6b, 0x18, 0xcc, 0x6c, 0xcd, 0xb1, 0xe3, 0x66, 0x6f, 0xef,
+  0xff, 0xf4, 0xa1, 0x99, 0x9b, 0x36, 0x78, 0xf3, 0xc7, 0x8d, 0x9b, 0x5b, 0x06, 0x00, 0x1f, 0xff,
+  0xfe, 0x86, 0x6b, 0x8b, 0x0c, 0xcc, 0xcc, 0xcc, 0xc6, 0xd6, 0x63, 0x5b, 0x58, 0xc1, 0xad, 0xad,
+  0xdf, 0xf3, 0x06, 0x0f, 0xff, 0xff, 0x5e, 0x2c, 0x18, 0xc6, 0x36, 0x66, 0x3d, 0x6c, 0x61, 0x86,
+  0xb0, 0x01, 0xa6, 0xb0, 0x6b, 0x32, 0xf3, 0x1b, 0x30, 0x63, 0x58, 0x7f, 0xff, 0x72, 0x05, 0x96,
+  0x58, 0x1a, 0xd6, 0x06, 0x98, 0xb3, 0x4d, 0x6b, 0x58, 0x00, 0x04, 0x2d, 0xdf, 0x33, 0x63, 0x7f,
+  0x20, 0xb5, 0x83, 0x31, 0xb3, 0x66, 0x2b, 0x2d, 0xf1, 0xe3, 0xcc, 0xcc, 0xcc, 0x17, 0xf0, 0x6b,
+  0xd7, 0xff, 0xff, 0x6f, 0x0d, 0x99, 0x9b, 0x33, 0xd7, 0x99, 0x98, 0xc6, 0xb2, 0xd3, 0xff, 0xe3,
+  0x66, 0xcd, 0xb3, 0x36, 0xff, 0xfe, 0xb2, 0xd6, 0x59, 0xac, 0x30, 0xc3, 0x06, 0x00, 0x8a, 0x32,
+  0x2b, 0xbc, 0xcf, 0x66, 0xcd, 0x99, 0x8c, 0x6b, 0x77, 0xff, 0xfd, 0x43, 0x5a, 0xd8, 0x6d, 0x6c,
+  0xc6, 0x31, 0xac, 0x59, 0x68, 0xb4, 0x84, 0x5b, 0xb2, 0xd0, 0x6b, 0x06, 0x6b, 0x00, 0x00, 0x00,
+  0x1f, 0xff, 0xe1, 0xf6, 0x1a, 0xc6, 0xbb, 0xff, 0xb4, 0x01, 0xac, 0x30, 0xc3, 0x31, 0xb1, 0xb6,
+  0x66, 0xcd, 0x99, 0x9b, 0xbf, 0xff, 0xd3, 0x2d, 0xad, 0x8d, 0x9b, 0x66, 0xdb, 0x36, 0xcd, 0x99,
+  0x98, 0xc6, 0xb0, 0x01, 0xff, 0xff, 0xed, 0xf7, 0xaf, 0x2e, 0xac, 0xb3, 0x33, 0x63, 0x63, 0x31,
+  0x98, 0x63, 0x5b, 0x58, 0x31, 0xaf, 0xef, 0xe6, 0xb0, 0xd6, 0x77, 0xff, 0xff, 0x68, 0x06, 0x18,
+  0xd8, 0xcc, 0xcc, 0xcc, 0x63, 0x06, 0xb1, 0x60, 0x68, 0xd3, 0x06, 0x0b, 0x2b, 0xcc, 0x6b, 0xd6,
+  0x1a, 0xc6, 0xff, 0xff, 0xe5, 0xd0, 0xb2, 0xd6, 0xb5, 0x80, 0xd6, 0x03, 0x5a, 0xc3, 0x4d, 0x60,
+  0x0d, 0x34, 0xd0, 0xb4, 0xaf, 0x8c, 0xd9, 0x9b, 0xfe, 0x4b, 0x5a, 0xd6, 0x6b, 0x36, 0x36, 0xcc,
+  0x5a, 0x60, 0xcf, 0x1e, 0x66, 0x66, 0x33, 0x40, 0x59, 0xff, 0xdf, 0xff, 0x63, 0x1b, 0x1e, 0x36,
+  0xcc, 0xd8, 0xf5, 0xb5, 0xb4, 0xd6, 0xb5, 0xfd, 0xfd, 0xe3, 0x7a, 0xf3, 0x3d, 0x79, 0xf7, 0xf2,
+  0xd6, 0xb0, 0x35, 0x9a, 0xda, 0xc3, 0x06, 0xb0, 0x64, 0x01, 0x71, 0x3d, 0xb6, 0xd9, 0xb6, 0x6c,
+  0xc6, 0x61, 0xad, 0xff, 0xff, 0x4a, 0xd6, 0x35, 0xeb, 0x36, 0xbd, 0x6c, 0x6b, 0xd6, 0xb0, 0x2d,
+  0x04, 0x84, 0x42, 0x35, 0x6d, 0x18, 0x31, 0x86, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x0e, 0x18, 0x17,
+  0xff, 0xc0, 0x01, 0x83, 0x0c, 0x63, 0x36, 0x36, 0x6d, 0x8f, 0x33, 0x33, 0x3f, 0xff, 0xd3, 0x96,
+  0xd7, 0xaf, 0x5e, 0x6c, 0xf3, 0x3c, 0xd9, 0xe3, 0x6d, 0x7a, 0xd8, 0x30, 0x00, 0xff, 0xfe, 0xf9,
+  0x9a, 0xf2, 0xd3, 0x33, 0x63, 0xd7, 0xad, 0x8d, 0xad, 0xad, 0xad, 0xac, 0x30, 0x60, 0xff, 0xfa,
+  0x6b, 0x58, 0xd6, 0x7f, 0xfd, 0xfd, 0x59, 0xa6, 0xb6, 0xb6, 0xbd, 0x6c, 0x66, 0xc6, 0x66, 0x18,
+  0x35, 0x8b, 0x00, 0x1a, 0x60, 0xc2, 0xa2, 0xc7, 0xac, 0x66, 0xb1, 0xac, 0x6f, 0xef, 0xff, 0xa2,
+  0xd6, 0xb4, 0xd6, 0xb5, 0x8d, 0x32, 0xda, 0x32, 0xc6, 0x99, 0x60, 0xd3, 0x2d, 0x64, 0xd0, 0x9d,
+  0xfd, 0x8d, 0x8f, 0x1b, 0x7f, 0xfc, 0x13, 0x5a, 0xcd, 0x7a, 0xf5, 0xe3, 0xcc, 0x60, 0x65, 0xb6,
+  0x6c, 0xd9, 0x99, 0x8c, 0x60, 0x07, 0xff, 0xf7, 0xfc, 0xcc, 0x6c, 0xcc, 0xdb, 0x1e, 0x36, 0x36,
+  0xb1, 0xad, 0x69, 0xdf, 0xf3, 0x66, 0xcd, 0xb3, 0x37, 0xfd, 0xd6, 0xb2, 0xcb, 0xd3, 0x5b, 0x58,
+  0x63, 0x58, 0x65, 0x80, 0xec, 0x54, 0x47, 0x6d, 0xb3, 0xcc, 0xdb, 0x1b, 0x5b, 0x06, 0xbf, 0xff,
+  0xe8, 0xab, 0x5b, 0x59, 0x98, 0xcc, 0xc6, 0x30, 0x02, 0xd1, 0x6a, 0x11, 0x16, 0x8b, 0x01, 0x83,
+  0x18, 0x60, 0x00, 0x00, 0x7f, 0xff, 0x80, 0x76, 0xb0, 0xdd, 0xff, 0xf0, 0x2c, 0x06, 0x0c, 0x33,
+  0x19, 0x99, 0xb3, 0x67, 0xaf, 0x33, 0x36, 0xb7, 0xff, 0xfa, 0x8f, 0xf6, 0xb6, 0x3d, 0x79, 0x9b,
+  0xd7, 0xb3, 0x6d, 0x99, 0xeb, 0xd7, 0xad, 0xad, 0xac, 0x80, 0x1f, 0xfd, 0xff, 0x33, 0x5f, 0x5b,
+  0x66, 0xc7, 0xaf, 0x19, 0x98, 0xda, 0xcc, 0x30, 0xd6, 0x6b, 0x17, 0xff, 0xc0, 0xd6, 0x18, 0xff,
+  0xff, 0xe9, 0x86, 0x98, 0x33, 0x19, 0x98, 0xd9, 0x8c, 0xd7, 0xac, 0x19, 0x65, 0x82, 0xc0, 0x6b,
+  0x06, 0x27, 0x29, 0x98, 0xc3, 0x1a, 0xc6, 0xbf, 0xef, 0xfe, 0x2d, 0x34, 0x34, 0xd6, 0x0d, 0x60,
+  0x6b, 0x03, 0x59, 0x6d, 0x35, 0xac, 0x0b, 0x2d, 0x13, 0xff, 0xed, 0x8d, 0x99, 0xb3, 0x5f, 0xfc,
+  0x5a, 0x35, 0x8c, 0xc7, 0x8d, 0xb1, 0x99, 0xae, 0xcf, 0x5e, 0x6c, 0xcc, 0x6c, 0x00, 0x0f, 0xff,
+  0xff, 0x5e, 0xb3, 0x1b, 0x1b, 0x63, 0xc7, 0x8d, 0x8c, 0xd6, 0xd3, 0x5a, 0x5f, 0xfc, 0xd9, 0xb3,
+  0xd7, 0x98, 0xff, 0xa5, 0xac, 0xb0, 0xd6, 0x30, 0x61, 0x83, 0x59, 0x60, 0xdc, 0x4c, 0x3f, 0xcc,
+  0xf3, 0xc7, 0x99, 0x99, 0x8d, 0x6d, 0x3f, 0xff, 0xe8, 0x3f, 0xe6, 0x19, 0xaf, 0x5b, 0x19, 0x98,
+  0x61, 0xa0, 0x21, 0x12, 0x02, 0x0b, 0x2c, 0x1a, 0xda, 0xc6, 0xbd, 0x60, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x20, 0xd7, 0xff, 0xd5, 0x8b, 0x2c, 0x35, 0x8d, 0x66, 0x33, 0x1e, 0xbc, 0x78, 0xf3, 0x36,
+  0x66, 0xd7, 0xbf, 0xff, 0xd5, 0x3f, 0xf9, 0x8c, 0xd9, 0x9e, 0x6c, 0xf3, 0x6c, 0xdb, 0x33, 0x1b,
+  0x5b, 0x5a, 0xc0, 0x38, 0xff, 0xfe, 0x1b, 0x02, 0xe3, 0x36, 0x6c, 0x6c, 0x6d, 0x7a, 0xd8, 0x63,
+  0x06, 0x0c, 0x7f, 0x7f, 0x01, 0xac, 0x35, 0xdf, 0xff, 0xd1, 0xad, 0x61, 0x9a, 0xd8, 0xda, 0xf1,
+  0x8f, 0x59, 0x86, 0x1a, 0xcb, 0x2c, 0x59, 0x60, 0x35, 0x8c, 0x49, 0x4d, 0xcc, 0x6b, 0x6b, 0x35,
+  0x8d, 0x6f, 0xff, 0xfe, 0x6f, 0xed, 0x68, 0x03, 0x4c, 0x0d, 0x60, 0xcb, 0x1a, 0xd6, 0x1a, 0xd6,
+  0x00, 0xdd, 0x89, 0xbb, 0xff, 0xec, 0xc6, 0xcd, 0x99, 0xb7, 0xdf, 0xfd, 0xad, 0x0c, 0xbd, 0x66,
+  0xcc, 0xd8, 0x6e, 0x72, 0xf3, 0x6c, 0xcd, 0x98, 0xda, 0xcc, 0x00, 0xff, 0xff, 0xf4, 0xec, 0x63,
+  0x36, 0x66, 0xcd, 0x99, 0xb1, 0x9a, 0xda, 0x34, 0x3f, 0xfe, 0x6c, 0xd9, 0xb6, 0x36, 0xff, 0xf8,
+  0xb2, 0xcb, 0x35, 0x83, 0x19, 0x7a, 0x61, 0xad, 0x60, 0x68, 0x24, 0x1d, 0xb6, 0xcf, 0x33, 0xc6,
+  0xcc, 0xd6, 0xd6, 0x37, 0xff, 0xfc, 0xef, 0xff, 0x60, 0xcc, 0x66, 0x36, 0x31, 0x83, 0x5a, 0x0b,
+  0x56, 0xa0, 0x01, 0x2d, 0x35, 0xac, 0xd6, 0x35, 0xb5, 0x99, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00,
+  0x4d, 0xff, 0xf5, 0xd9, 0x6b, 0x2c, 0x18, 0x33, 0x5b, 0x1b, 0x1e, 0xbc, 0xd9, 0xb3, 0x66, 0xc6,
+  0x7f, 0xff, 0x7f, 0xff, 0xa7, 0xb5, 0xeb, 0x66, 0xd9, 0xb3, 0xcf, 0x1e, 0x6d, 0x8d, 0x98, 0xc3,
+  0x58, 0x17, 0x63, 0xbf, 0xf8, 0xd8, 0x57, 0x5b, 0x33, 0x63, 0xd7, 0xad, 0x9a, 0xf5, 0x98, 0xd6,
+  0x6b, 0x0c, 0xbf, 0xee, 0x00, 0xd6, 0x69, 0xff, 0x7f, 0xd6, 0xb5, 0xac, 0xd6, 0xd6, 0xd7, 0xad,
+  0x8d, 0x8c, 0x6d, 0x6d, 0x61, 0xad, 0x6b, 0x2d, 0x65, 0xac, 0xb0, 0xcb, 0x62, 0x22, 0x46, 0x31,
+  0x86, 0x6b, 0x1a, 0xd7, 0xff, 0xff, 0x2d, 0xa0, 0x58, 0x35, 0xac, 0xd6, 0xb3, 0x5a, 0xc3, 0x58,
+  0x35, 0x96, 0xd1, 0xad, 0x01, 0x6f, 0xff, 0xeb, 0x31, 0xeb, 0xc7, 0x8d, 0x9f, 0xf7, 0xf6, 0x83,
+  0x58, 0xcd, 0xaf, 0x36, 0x1d, 0x1e, 0x66, 0xd9, 0xeb, 0xc6, 0xc6, 0xd6, 0x00, 0x1f, 0xff, 0xfe,
+  0x6b, 0x31, 0xb1, 0xb6, 0x3c, 0x6c, 0xd8, 0xc6, 0x1a, 0x0b, 0xff, 0xb1, 0xe6, 0x6c, 0xd8, 0xff,
+  0xa5, 0x96, 0x5b, 0x4c, 0x35, 0xb5, 0x83, 0x06, 0xb5, 0x83, 0x01, 0x10, 0xdd, 0xb3, 0xcd, 0x9e,
+  0x36, 0x33, 0x1a, 0xc7, 0xff, 0x7f, 0xfd, 0x66, 0x0f, 0x59, 0x99, 0x8c, 0xc1, 0xac, 0x9a, 0xb4,
+  0x44, 0x00, 0x24, 0x34, 0xc3, 0x5b, 0x58, 0xc6, 0xbc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x77,
+  0xff, 0xcb, 0x26, 0xb5, 0x83, 0x06, 0x63, 0x33, 0x66, 0x6d, 0x99, 0xe6, 0x66, 0x67, 0xf7, 0xff,
+  0xfa, 0x99, 0x8d, 0x99, 0xbd, 0x7b, 0x36, 0xd9, 0xe3, 0xc6, 0xc6, 0xd6, 0x35, 0x83, 0xa6, 0x5b,
+  0xef, 0xf9, 0xb1, 0x2f, 0x4f, 0x1b, 0x33, 0x6b, 0xc3, 0x61, 0x8c, 0x18, 0x69, 0xff, 0xf0, 0x58,
+  0xd3, 0x06, 0xff, 0xff, 0xdf, 0xfb, 0x2d, 0x63, 0x59, 0xad, 0x8d, 0xaf, 0x5b, 0x19, 0x9a, 0xda,
+  0xc1, 0xad, 0x6b, 0x5a, 0xd6, 0xb4, 0xcb, 0x35, 0x81, 0xf2, 0x16, 0x1b, 0x58, 0xcd, 0x63, 0x59,
+  0xff, 0x7f, 0xfd, 0x05, 0x8b, 0x0d, 0x6b, 0x69, 0x86, 0xb0, 0xd6, 0x0d, 0x60, 0xd6, 0xb2, 0xd6,
+  0x83, 0xff, 0xbe, 0x66, 0x66, 0x6c, 0xf5, 0xb6, 0x7f, 0xff, 0xd1, 0x34, 0x0c, 0x63, 0x6c, 0xcc,
+  0x7c, 0x81, 0x9b, 0x3c, 0x6d, 0x8c, 0xcc, 0x00, 0x1f, 0xff, 0xfe, 0x5a, 0xda, 0xd8, 0xd9, 0x9b,
+  0x36, 0x66, 0x66, 0x6b, 0x1a, 0x0e, 0xff, 0x9b, 0x36, 0x6c, 0xd8, 0xfb, 0xeb, 0x2c, 0xb1, 0xac,
+  0x35, 0x9a, 0xcd, 0x6b, 0x1a, 0xd6, 0xb1, 0x70, 0x80, 0x66, 0xd9, 0xe6, 0x79, 0x99, 0xb0, 0xc6,
+  0xb3, 0xfb, 0xff, 0xfe, 0x53, 0x18, 0x66, 0x63, 0x33, 0x18, 0xd6, 0xb2, 0xd0, 0x88, 0x00, 0x05,
+  0x03, 0x5a, 0xda, 0xc6, 0xb6, 0x1a, 0xf0, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x01, 0xfd, 0xff, 0x5a,
+  0xd3, 0x4c, 0xb3, 0x58, 0xc6, 0x63, 0xd7, 0x8f, 0x1e, 0x67, 0x8d, 0xb5, 0xeb, 0x3f, 0xff, 0xd5,
+  0xc6, 0x66, 0xd9, 0x9e, 0x6f, 0x5e, 0xcd, 0xb3, 0x36, 0x33, 0x06, 0x87, 0xc6, 0xb0, 0xff, 0xee,
+  0xf6, 0x3d, 0xfe, 0xcf, 0x5b, 0x63, 0x63, 0x33, 0x18, 0x61, 0x83, 0x7f, 0x7f, 0x16, 0x01, 0xac,
+  0x1f, 0xff, 0xfb, 0x01, 0x63, 0x58, 0xc6, 0x63, 0x6b, 0xd7, 0xac, 0xcc, 0x18, 0x69, 0xad, 0x69,
+  0xa3, 0x46, 0xb5, 0x9a, 0xc1, 0xc9, 0xeb, 0x19, 0xad, 0xac, 0xc3, 0x58, 0xff, 0xff, 0xe5, 0xfa,
+  0xb2, 0xd6, 0xb0, 0x30, 0x30, 0xd6, 0x35, 0x83, 0x58, 0xd6, 0xb1, 0x61, 0x68, 0xfe, 0xff, 0x98,
+  0xcc, 0xd9, 0x9b, 0x63, 0x7d, 0xff, 0xf0, 0x0c, 0x36, 0x3c, 0x78, 0x84, 0x89, 0x99, 0xe6, 0x6c,
+  0xda, 0xf5, 0xb5, 0x80, 0x0f, 0xff, 0xff, 0x26, 0x33, 0x1b, 0x33, 0x66, 0xcc, 0xcc, 0xc6, 0x06,
+  0x8f, 0xfb, 0x9b, 0x3d, 0x78, 0xf5, 0xe2, 0xff, 0x96, 0x58, 0x1a, 0xcd, 0x61, 0x83, 0x58, 0x69,
+  0xac, 0x56, 0x1e, 0x17, 0xb6, 0x79, 0x9e, 0x36, 0xd6, 0xc6, 0x1a, 0xdf, 0x7f, 0xff, 0xc9, 0x1a,
+  0xda, 0xda, 0xf5, 0xeb, 0x63, 0x35, 0xb5, 0x8b, 0x10, 0x80, 0x00, 0x05, 0xd8, 0x0d, 0x6d, 0x63,
+  0x0c, 0xc0, 0x08, 0x33, 0x3f, 0x7f, 0xc0, 0x00, 0x07, 0xff, 0x7f, 0x6b, 0x43, 0x5a, 0xc3, 0x0c,
+  0xc6, 0x6c, 0xcd, 0xb3, 0x67, 0xaf, 0x33, 0x31, 0xff, 0xfe, 0xb7, 0xf1, 0x8f, 0x1b, 0x6c, 0xdb,
+  0x6c, 0xdb, 0x63, 0xc6, 0x66, 0xb3, 0x45, 0xda, 0x35, 0x87, 0xff, 0xcc, 0x9c, 0x26, 0x7a, 0xf1,
+  0xb3, 0x31, 0x99, 0xac, 0xc3, 0x58, 0xdf, 0xff, 0x3b, 0x05, 0x83, 0x58, 0x5f, 0xff, 0xfa, 0x61,
+  0x6d, 0x31, 0x86, 0xc3, 0xd6, 0xd7, 0xad, 0x81, 0xac, 0x0d, 0x34, 0x68, 0x06, 0x9a, 0xc6, 0x0c,
+  0xcd, 0xf5, 0x98, 0xd7, 0xac, 0xc3, 0x58, 0x7f, 0xff, 0xf2, 0x16, 0xb4, 0xd6, 0x06, 0x1a, 0xcd,
+  0x61, 0xac, 0x6b, 0x06, 0x58, 0x1a, 0xb1, 0x77, 0xff, 0xc3, 0x63, 0x36, 0x6c, 0xd9, 0x9b, 0xff,
+  0xfb, 0xeb, 0x03, 0x19, 0xb3, 0x36, 0x47, 0x49, 0x6c, 0xdb, 0x36, 0x66, 0x6b, 0xd6, 0x00, 0x5f,
+  0xff, 0xfe, 0x38, 0x66, 0x36, 0x6c, 0xcc, 0xf5, 0xeb, 0xc6, 0x35, 0x9a, 0x17, 0xff, 0x1b, 0x63,
+  0xc6, 0xcd, 0xaf, 0xee, 0x59, 0x61, 0xac, 0x18, 0x65, 0xe9, 0xac, 0x68, 0xd1, 0x50, 0x70, 0x57,
+  0xaf, 0x66, 0xcf, 0x5e, 0x63, 0x61, 0x83, 0x5f, 0xff, 0xf2, 0x06, 0x19, 0x9a, 0xf0, 0xf5, 0x98,
+  0xd6, 0x05, 0xa1, 0x40, 0x00, 0x07, 0x5a, 0xc1, 0xad, 0xac, 0x63, 0x18, 0x67, 0x35, 0x86, 0x6b,
+  0xdf, 0xe3, 0xd0, 0x00, 0x01, 0xff, 0xfd, 0xda, 0x0d, 0x18, 0x30, 0xda, 0xf5, 0xeb, 0xc7, 0x8f,
+  0x36, 0x6c, 0xd9, 0x8d, 0xbf, 0xff, 0xd8, 0x3f, 0xff, 0xb3, 0x1b, 0x36, 0xcf, 0x33, 0xcf, 0x33,
+  0xc7, 0xaf, 0x0d, 0xac, 0x35, 0xfc, 0x68, 0xd6, 0x2f, 0xfe, 0xcc, 0xc4, 0xf1, 0xe3, 0x66, 0x66,
+  0x63, 0x30, 0xc3, 0x58, 0xff, 0xf8, 0x2c, 0x2c, 0x35, 0xac, 0xbf, 0xff, 0xf3, 0x80, 0xd6, 0x18,
+  0xcc, 0x66, 0x63, 0x30, 0x35, 0x80, 0x68, 0x00, 0x59, 0xa6, 0x18, 0x5c, 0x64, 0x66, 0xbd, 0x63,
+  0x30, 0x63, 0x5f, 0xf7, 0xff, 0xf5, 0xa6, 0x8d, 0x60, 0xd6, 0xd6, 0x18, 0x35, 0xb5, 0xac, 0xd6,
+  0x5b, 0x46, 0x9a, 0x2d, 0xff, 0xff, 0xbf, 0x6d, 0x6d, 0x79, 0x99, 0xb3, 0xd7, 0xaf, 0x3b, 0xff,
+  0xfe, 0xa9, 0x60, 0xd7, 0xaf, 0x5e, 0x3c, 0x26, 0x26, 0xed, 0x9b, 0x66, 0x6c, 0x6c, 0x30, 0x02,
+  0xff, 0xff, 0xf1, 0xd7, 0xac, 0xcc, 0xcd, 0x99, 0x9e, 0xbc, 0x66, 0x35, 0xb4, 0x1f, 0xf7, 0xdb,
+  0x33, 0x66, 0xcc, 0xcd, 0x7f, 0xf5, 0x8b, 0x0d, 0x60, 0xc1, 0x83, 0x58, 0x0d, 0x14, 0x07, 0x05,
+  0x6d, 0x9b, 0x6c, 0xcc, 0xd8, 0xd7, 0xac, 0x0f, 0xff, 0xf8, 0xee, 0xd6, 0xd7, 0xac, 0xc6, 0xc6,
+  0x31, 0x80, 0x2d, 0x27, 0xf5, 0x86, 0x1a, 0xc6, 0xb2, 0xe6, 0xb2, 0xf4, 0xc6, 0xbd, 0x63, 0x30,
+  0xdf, 0xfc, 0x6b, 0x0c, 0x6f, 0x0f, 0x23, 0x60, 0x00, 0x07, 0xff, 0xff, 0xae, 0x80, 0x35, 0x86,
+  0x33, 0x1b, 0x33, 0x6c, 0xd9, 0xe3, 0x6c, 0xc6, 0x7f, 0xdf, 0xff, 0xeb, 0x98, 0xcd, 0x9b, 0x36,
+  0xdb, 0x3c, 0xcf, 0x36, 0x3d, 0x6c, 0x30, 0x7f, 0x7f, 0xfc, 0x34, 0x60, 0xec, 0xec, 0x7c, 0xcd,
+  0x99, 0x9b, 0x5e, 0x19, 0x86, 0x35, 0x9f, 0x7f, 0x01, 0x65, 0x81, 0xac, 0x77, 0xff, 0xf3, 0x46,
+  0xb5, 0xe9, 0xb5, 0x99, 0x9a, 0xf0, 0xcc, 0x60, 0xc0, 0x00, 0x2c, 0xb2, 0xc6, 0xb0, 0xc5, 0x25,
+  0xb7, 0xad, 0xac, 0xcd, 0x6c, 0x35, 0xb4, 0xdf, 0xff, 0xfc, 0x9d, 0x34, 0x1a, 0xc1, 0x8d, 0x66,
+  0x5e, 0x98, 0xd6, 0x18, 0x0d, 0x65, 0xa6, 0x9f, 0xff, 0xdf, 0x63, 0x1b, 0x33, 0x66, 0xcc, 0xd9,
+  0xbf, 0xff, 0xbf, 0xec, 0xb0, 0xcc, 0xcc, 0xdb, 0x28, 0xa9, 0x6c, 0xdb, 0x3d, 0x7a, 0xf1, 0x98,
+  0x00, 0x3b, 0xff, 0xff, 0xc4, 0x36, 0x33, 0x36, 0x66, 0xcc, 0xd8, 0xc3, 0x06, 0xbb, 0xff, 0x9b,
+  0x33, 0x66, 0x6c, 0xcc, 0xfb, 0xf9, 0x60, 0x32, 0xda, 0xd6, 0x6b, 0x06, 0xb0, 0x02, 0x70, 0xd0,
+  0xa6, 0x79, 0xb3, 0x66, 0x66, 0x6b, 0x6b, 0x07, 0xff, 0xfc, 0x67, 0xd8, 0xc6, 0x33, 0x31, 0xb5,
+  0x98, 0x00, 0x9d, 0xff, 0x0c, 0x30, 0xc1, 0xac, 0xb5, 0xfd, 0xa6, 0x1a, 0xda, 0xcc, 0x63, 0x17,
+  0xf1, 0xac, 0x30, 0xea, 0xeb, 0xcc, 0xc0, 0x00, 0x17, 0xff, 0xff, 0xa0, 0x0b, 0xd1, 0x8c, 0x36,
+  0xbc, 0x67, 0x8f, 0x33, 0xc7, 0x99, 0xb1, 0x97, 0xff, 0xfb, 0x0e, 0xbd, 0x78, 0xd9, 0xe6, 0x7b,
+  0x36, 0xcf, 0x33, 0x63, 0x6b, 0x6b, 0x0f, 0xfe, 0xff, 0xff, 0xf6, 0x01, 0x83, 0x68, 0xe5, 0x3c,
+  0x6c, 0xd8, 0xd8, 0xcc, 0x63, 0x5b, 0x5a, 0xff, 0x90, 0x16, 0x59, 0x66, 0x98, 0xbf, 0xff, 0xf1,
+  0x74, 0x6b, 0x06, 0x61, 0xb5, 0xeb, 0x63, 0x18, 0x66, 0xb5, 0x80, 0x16, 0x5a, 0xd6, 0xb5, 0x86,
+  0xb6, 0x89, 0x09, 0xf3, 0x5e, 0xb3, 0x18, 0xc6, 0x0c, 0xfe, 0xff, 0xff, 0xe2, 0xd0, 0x0d, 0x61,
+  0x8d, 0x66, 0x0c, 0x30, 0x60, 0x65, 0x8b, 0x2d, 0x7f, 0xdf, 0xfd, 0xad, 0x86, 0xcd, 0x8f, 0x33,
+  0x66, 0x6e, 0xff, 0xff, 0xb2, 0x5a, 0xcd, 0x6c, 0x6c, 0xd8, 0xac, 0xaf, 0xb3, 0x67, 0xaf, 0x33,
+  0x31, 0x80, 0x07, 0x7f, 0xff, 0xf8, 0x8c, 0x6c, 0x6c, 0xcc, 0xd9, 0xb1, 0x98, 0xcb, 0xd0, 0xff,
+  0xfe, 0x36, 0x6c, 0x6d, 0x8d, 0x8c, 0xfb, 0xf8, 0xb1, 0xa6, 0x0d, 0x66, 0xb5, 0x8d, 0x65, 0x80,
+  0x9c, 0x34, 0x29, 0x9e, 0x6c, 0xcf, 0x5e, 0xb6, 0x35, 0xb5, 0x96, 0xff, 0xfb, 0xf8, 0x66, 0x31,
+  0xb5, 0xeb, 0x61, 0x81, 0xa2, 0xef, 0xfe, 0xc3, 0x59, 0xac, 0xd6, 0x6b, 0x58, 0x2d, 0xfd, 0x6b,
+  0x1a, 0xda, 0xd8, 0x66, 0x3e, 0xe3, 0x5a, 0xda, 0xcd, 0xc7, 0xc9, 0x98, 0xd8, 0x00, 0x07, 0x7f,
+  0xff, 0x16, 0x2c, 0x6b, 0x18, 0xcc, 0x6d, 0x8f, 0x36, 0x6d, 0x9b, 0x33, 0x1b, 0x7f, 0xff, 0xb3,
+  0x75, 0xeb, 0x66, 0xcf, 0x1e, 0x79, 0xb3, 0xcc, 0xf1, 0x99, 0x86, 0x2f, 0xff, 0xbf, 0xff, 0x80,
+  0xd6, 0x1b, 0x4b, 0x36, 0x6c, 0xcd, 0x8f, 0x5b, 0x18, 0xc3, 0x35, 0xdf, 0x20, 0x2d, 0x65, 0x80,
+  0xcb, 0xdf, 0xff, 0xf8, 0x56, 0xb5, 0xad, 0xac, 0x36, 0xbd, 0x66, 0x63, 0x30, 0xd6, 0xd6, 0xb0,
+  0xb0, 0xb5, 0xa6, 0x8d, 0x32, 0xda, 0xcc, 0x3e, 0x47, 0x66, 0x31, 0x98, 0xc6, 0x1a, 0xcf, 0xff,
+  0xfe, 0x4f, 0xf8, 0x01, 0xac, 0xd6, 0x6b, 0x6b, 0x35, 0x8c, 0x18, 0x35, 0x80, 0x2d, 0xf7, 0xff,
+  0xff, 0x4b, 0x0d, 0xaf, 0x5e, 0x36, 0xcc, 0xdb, 0x5e, 0x3f, 0xfe, 0xff, 0xad, 0x63, 0x5e, 0xbc,
+  0x6d, 0x8b, 0x8b, 0xaf, 0x33, 0xc7, 0x8d, 0x8c, 0xc0, 0x03, 0xbf, 0xff, 0xfc, 0x4c, 0x3d, 0x6c,
+  0xcc, 0xd9, 0x99, 0xb1, 0x8c, 0xb6, 0x9f, 0xff, 0x4c, 0x7a, 0xf1, 0xeb, 0xc6, 0xc6, 0x3e, 0xfe,
+  0x2d, 0xa3, 0x06, 0xb0, 0xd6, 0x1a, 0xd6, 0x58, 0x4e, 0x1a, 0x14, 0xcf, 0x36, 0x66, 0xc6, 0xc3,
+  0x5e, 0x9a, 0xdf, 0xfd, 0xff, 0x35, 0xeb, 0x1b, 0x5e, 0xb6, 0x1b, 0x58, 0x68, 0x77, 0xff, 0x58,
+  0x18, 0x63, 0x59, 0xac, 0x00, 0xbe, 0xb0, 0x66, 0x1b, 0x5b, 0x2f, 0xa3, 0x5a, 0xcd, 0x7a, 0xdc,
+  0xdd, 0xc6, 0xd7, 0x80, 0x00, 0x3e, 0xff, 0xfa, 0xcb, 0x2c, 0x30, 0xcc, 0x66, 0xcc, 0xf1, 0xe6,
+  0xcd, 0x9e, 0xb6, 0x33, 0xff, 0xfd, 0xaf, 0xff, 0xe1, 0xb3, 0x3c, 0xcf, 0x36, 0xd9, 0xb6, 0xc7,
+  0xaf, 0x5e, 0xb0, 0xcb, 0xff, 0xff, 0xd3, 0xff, 0x96, 0x34, 0xc6, 0xb3, 0xf3, 0xbe, 0xed, 0x9b,
+  0x31, 0xeb, 0x63, 0x19, 0xac, 0x7f, 0x56, 0x81, 0x6b, 0x59, 0x60, 0x6b, 0x3f, 0xfb, 0xfb, 0x58,
+  0x0c, 0xc3, 0x33, 0x18, 0xda, 0xc6, 0x1a, 0xd6, 0x59, 0x64, 0xd0, 0x06, 0x98, 0x60, 0x6c, 0x79,
+  0x8c, 0xc6, 0x61, 0xb5, 0x9a, 0xc7, 0x7f, 0xff, 0xf1, 0x16, 0x03, 0x0d, 0x7a, 0xc6, 0x18, 0xc1,
+  0x86, 0xb0, 0x34, 0x17, 0xff, 0xff, 0x7d, 0xad, 0xad, 0xaf, 0x1b, 0x36, 0x6c, 0xcd, 0x9b, 0xbf,
+  0xff, 0xee, 0xed, 0x61, 0x99, 0x9b, 0x33, 0x13, 0x1b, 0x6c, 0xdb, 0x33, 0x33, 0x18, 0x00, 0xef,
+  0xff, 0xff, 0x16, 0xb6, 0x33, 0x33, 0x63, 0xc6, 0xc6, 0x66, 0xb0, 0x7f, 0xdf, 0x5b, 0x33, 0x36,
+  0x66, 0x6d, 0x7a, 0xcd, 0xf7, 0xfd, 0x63, 0x4c, 0xb6, 0xb5, 0x8d, 0x65, 0xb4, 0xd6, 0xb0, 0x9c,
+  0x34, 0x29, 0xb3, 0x6c, 0xcd, 0x8c, 0xd7, 0xac, 0x1a, 0xfb, 0xff, 0xe6, 0x31, 0x98, 0xcc, 0x66,
+  0xb1, 0xad, 0x3f, 0xff, 0xad, 0x65, 0xb5, 0x86, 0x30, 0x60, 0x34, 0x27, 0xd6, 0x31, 0x8c, 0xc6,
+  0xef, 0x86, 0x98, 0x63, 0x57, 0x59, 0x9b, 0x5b, 0x30, 0x00, 0x1f, 0xdf, 0xfd, 0x6b, 0x5a, 0xc6,
+  0xb3, 0x19, 0x99, 0xb3, 0x67, 0x8f, 0x33, 0xc6, 0x6d, 0x6f, 0xfb, 0xff, 0xfd, 0xa3, 0x35, 0xe6,
+  0x6d, 0x9e, 0x6c, 0xf3, 0x6c, 0xcf, 0x5b, 0x1a, 0xf4, 0xd7, 0xff, 0xff, 0x8f, 0xc0, 0x6b, 0x0d,
+  0x9b, 0x98, 0xf9, 0x79, 0x8f, 0x5e, 0xbd, 0x6d, 0x6c, 0x1b, 0xbe, 0x26, 0x8b, 0x2d, 0x6b, 0x5a,
+  0xc6, 0xb5, 0xbe, 0xff, 0xe5, 0x83, 0x5b, 0x5b, 0x5b, 0x18, 0xcc, 0x61, 0x83, 0x5a, 0xd6, 0x4d,
+  0x00, 0x58, 0x6b, 0x5e, 0xb0, 0x58, 0x65, 0x8c, 0x66, 0x33, 0x18, 0x60, 0xff, 0xff, 0xe4, 0xff,
+  0xfb, 0x16, 0x0d, 0x6d, 0x66, 0xbd, 0x63, 0x0c, 0x30, 0xcb, 0x69, 0xad, 0x34, 0xff, 0xff, 0xf4,
+  0xac, 0x31, 0xb3, 0x33, 0x66, 0xd8, 0xd9, 0x9f, 0xff, 0xdf, 0xfd, 0xac, 0x1e, 0xb6, 0x66, 0xcd,
+  0x0d, 0x2d, 0x9b, 0x66, 0xc7, 0xad, 0xaf, 0x58, 0x01, 0xdf, 0xff, 0xfe, 0x53, 0x6b, 0x63, 0x36,
+  0x66, 0x6c, 0x6c, 0x66, 0xb0, 0xfe, 0xff, 0xb5, 0xeb, 0x66, 0x6c, 0xcc, 0xcc, 0xd7, 0xad, 0xdf,
+  0xfc, 0x0d, 0x60, 0xd6, 0x0d, 0x60, 0xd3, 0x58, 0xa0, 0x34, 0x29, 0xb6, 0x66, 0xcd, 0xaf, 0x5e,
+  0xb0, 0xc0, 0xef, 0xff, 0xac, 0xc6, 0x33, 0x35, 0xeb, 0x6b, 0x0d, 0x3f, 0xbf, 0xe6, 0xb5, 0x83,
+  0x0c, 0xd6, 0x6b, 0x1a, 0x34, 0x07, 0xdd, 0x8c, 0xc3, 0x61, 0xdc, 0x68, 0xc1, 0x99, 0xd9, 0xde,
+  0xbd, 0x6c, 0xc6, 0x00, 0x03, 0xfe, 0xff, 0xa6, 0xb5, 0x83, 0x19, 0x8d, 0x8f, 0x33, 0xc7, 0x9b,
+  0x36, 0x66, 0x33, 0xff, 0xfd, 0xbb, 0x19, 0xb3, 0x67, 0x9b, 0x3c, 0xdb, 0x63, 0xc6, 0xd6, 0xd6,
+  0x35, 0xff, 0xff, 0xdf, 0x00, 0xcb, 0xd6, 0xca, 0xc9, 0xd5, 0xcd, 0x99, 0xb5, 0xeb, 0x6b, 0x60,
+  0xfe, 0x08, 0x0b, 0x5a, 0x6b, 0x58, 0x19, 0x6f, 0xff, 0xe8, 0x1a, 0xcd, 0x6c, 0x63, 0x31, 0x8c,
+  0x30, 0x69, 0xad, 0x68, 0x05, 0x96, 0x58, 0x6b, 0x30, 0x48, 0x54, 0xcc, 0x63, 0x33, 0x18, 0x60,
+  0xef, 0xff, 0xfe, 0x15, 0x96, 0x1a, 0xda, 0xc6, 0x61, 0x9a, 0xcd, 0x66, 0xb0, 0xd6, 0xb2, 0xd6,
+  0xff, 0xbf, 0xed, 0x63, 0x18, 0xd9, 0xb3, 0x66, 0x6c, 0xcc, 0x7f, 0xff, 0xe2, 0x35, 0x86, 0xc6,
+  0xcd, 0x9b, 0x9b, 0xd9, 0xb6, 0xc7, 0x8c, 0xcc, 0x60, 0x05, 0xff, 0xff, 0xe5, 0xad, 0x8c, 0x6c,
+  0xcc, 0xd9, 0x8f, 0x5b, 0x0c, 0x3e, 0xff, 0xfb, 0x6b, 0xd7, 0xad, 0xb1, 0xb3, 0x31, 0xb0, 0x67,
+  0xff, 0xd0, 0xd6, 0x06, 0xb0, 0x6b, 0x01, 0xa1, 0x50, 0x70, 0x57, 0x99, 0xb6, 0x66, 0x63, 0x30,
+  0xd6, 0x17, 0xff, 0xf0, 0xcc, 0x63, 0x6b, 0x61, 0x83, 0x7d, 0xff, 0xd6, 0xb4, 0xd6, 0x35, 0xb5,
+  0x9a, 0xda, 0xc3, 0x4d, 0x68, 0x0e, 0xe1, 0xb5, 0xb1, 0x8f, 0xe6, 0x83, 0x59, 0xad, 0x8d, 0x8e,
+  0xc6, 0x6c, 0x66, 0x00, 0x07, 0xff, 0x7f, 0x4d, 0x35, 0x8c, 0x36, 0xbc, 0x66, 0xd9, 0xb6, 0x6c,
+  0xdb, 0x1b, 0x0d, 0xff, 0xfe, 0xe9, 0xff, 0x6d, 0x78, 0xdb, 0x36, 0xdb, 0x36, 0xcf, 0x1b, 0x33,
+  0x0c, 0x2f, 0xff, 0xfe, 0xd0, 0x0c, 0x1b, 0x23, 0x1f, 0x5a, 0xe6, 0x66, 0x66, 0x33, 0x5b, 0xeb,
+  0x76, 0x5a, 0x16, 0x4d, 0x34, 0xd6, 0x0c, 0xb7, 0xdf, 0xfc, 0x1a, 0xc6, 0x31, 0x8d, 0xaf, 0x58,
+  0xc6, 0x59, 0xa3, 0x4d, 0x02, 0xc9, 0xad, 0x30, 0x33, 0x41, 0xc2, 0x26, 0x31, 0xb0, 0xd8, 0xc3,
+  0x03, 0xff, 0xff, 0x8f, 0xff, 0xed, 0x65, 0x8d, 0x66, 0x35, 0xeb, 0x31, 0x86, 0x1a, 0xda, 0xd6,
+  0x58, 0x1f, 0xff, 0x59, 0x7a, 0xc6, 0x66, 0x6c, 0xd9, 0xb3, 0x36, 0x37, 0xff, 0xfe, 0x6f, 0xff,
+  0x18, 0x66, 0x6c, 0xd9, 0xd5, 0xd7, 0x66, 0xcf, 0x5e, 0x66, 0x36, 0xb6, 0x00, 0x5f, 0xff, 0xfe,
+  0x76, 0xd6, 0xc6, 0x66, 0xc6, 0xcc, 0xcc, 0xc3, 0x1f, 0x7f, 0xfd, 0x98, 0xcc, 0xcc, 0xd9, 0x8d,
+  0x8c, 0x31, 0xfd, 0xfc, 0x35, 0x81, 0x96, 0x35, 0xac, 0x00, 0xb0, 0x38, 0x2d, 0xeb, 0xcc, 0xf5,
+  0xb3, 0x19, 0xac, 0x6b, 0x2d, 0xff, 0xfd, 0x33, 0x0d, 0xaf, 0x59, 0x8d, 0x6d, 0x3f, 0xfb, 0xad,
+  0x34, 0xd6, 0x30, 0x6d, 0x66, 0xb1, 0xad, 0x6b, 0x5a, 0x05, 0xfd, 0xb5, 0xb1, 0x99, 0x7c, 0x06,
+  0x98, 0x6b, 0xfc, 0x03, 0x33, 0x1e, 0xb6, 0x00, 0x03, 0xff, 0xbf, 0xe1, 0xa6, 0x18, 0xcc, 0x7a,
+  0xf1, 0xe3, 0xcd, 0xb3, 0x3d, 0x7a, 0xf5, 0xb5, 0xff, 0xf7, 0xff, 0xfb, 0x8e, 0x66, 0xc7, 0x9b,
+  0x6c, 0xdb, 0x66, 0xcd, 0x8d, 0xad, 0xad, 0x6e, 0xff, 0xff, 0xec, 0xb0, 0x35, 0x86, 0xc7, 0xc6,
+  0x31, 0x77, 0x8c, 0xcc, 0x63, 0xad, 0x16, 0x9a, 0xb2, 0xd1, 0xa3, 0x5a, 0xc3, 0x58, 0xff, 0xef,
+  0x86, 0x5e, 0xb1, 0x9a, 0xf5, 0xb1, 0xaf, 0x58, 0xd6, 0x0d, 0x0d, 0x2c, 0xb5, 0xa1, 0xa3, 0x2d,
+  0xac, 0xc1, 0x61, 0xb8, 0xcc, 0x6d, 0x6c, 0x66, 0x18, 0x37, 0xf7, 0xff, 0xff, 0x05, 0xac, 0xb6,
+  0xb5, 0xeb, 0x31, 0x8c, 0x63, 0x0c, 0x35, 0x80, 0x1d, 0xff, 0x58, 0x6b, 0xd6, 0x6c, 0x6d, 0x99,
+  0xb3, 0x63, 0x6a, 0xff, 0xff, 0xcd, 0xd3, 0x19, 0x99, 0xb6, 0x7c, 0x7c, 0x79, 0x9e, 0x3d, 0x78,
+  0xda, 0xd8, 0x00, 0x3f, 0xff, 0xfc, 0xf6, 0xb3, 0x31, 0xb1, 0xeb, 0xd7, 0x8c, 0xcc, 0x6b, 0x77,
+  0xff, 0xf3, 0x31, 0x99, 0x99, 0xb3, 0x1b, 0x5b, 0x0d, 0x63, 0xff, 0xf8, 0xd6, 0x03, 0x58, 0x35,
+  0x96, 0x02, 0xe0, 0xe0, 0xbc, 0xd9, 0x9b, 0x33, 0x5e, 0xb6, 0xb0, 0x68, 0xff, 0xba, 0xda, 0xf5,
+  0x98, 0xcd, 0x7a, 0xc3, 0xfb, 0xee, 0xc9, 0xa6, 0xb5, 0xb5, 0x9a, 0xda, 0xcc, 0x0c, 0xb2, 0xc9,
+  0xa5, 0xaf, 0xed, 0x8c, 0xc6, 0xea, 0x00, 0xd6, 0xd5, 0xc5, 0xc6, 0x63, 0x63, 0x63, 0x30, 0x00,
+  0x7f, 0xfd, 0xfc, 0x34, 0xc6, 0x1b, 0x5e, 0x36, 0x6d, 0x9b, 0x66, 0x78, 0xd8, 0xcd, 0xff, 0x7f,
+  0xff, 0xbb, 0x99, 0x9b, 0x3c, 0x79, 0xb6, 0xcf, 0x1b, 0x6b, 0xc3, 0x1a, 0xdf, 0xf7, 0xff, 0xff,
+  0x50, 0x06, 0x0d, 0x8b, 0x89, 0xad, 0x66, 0xe3, 0x6b, 0xd6, 0xdc, 0xb4, 0x16, 0x82, 0xd6, 0x81,
+  0xa6, 0xb0, 0xd6, 0x1f, 0xff, 0xf3, 0xc6, 0x5b, 0x59, 0x8c, 0x63, 0x6b, 0x6b, 0x19, 0x60, 0xd0,
+  0x59, 0x34, 0x00, 0x6b, 0x30, 0x08, 0x0a, 0x6d, 0x6c, 0x3d, 0x6c, 0x63, 0x35, 0x9a, 0x3f, 0xff,
+  0xf8, 0x7f, 0xad, 0x60, 0xc6, 0xbd, 0x6c, 0x33, 0x1a, 0xf5, 0xad, 0xac, 0x03, 0x0f, 0xef, 0xac,
+  0x6b, 0x6b, 0x66, 0x3c, 0x7a, 0xf3, 0x36, 0x63, 0x3f, 0xff, 0xf5, 0xbf, 0xed, 0x6b, 0xd6, 0xcc,
+  0xcd, 0x05, 0x05, 0x9b, 0x36, 0x6c, 0xcc, 0x66, 0x00, 0x1f, 0xff, 0xfe, 0x8c, 0x36, 0xbd, 0x7a,
+  0xf5, 0xe3, 0x63, 0x63, 0x1a, 0xef, 0xfe, 0xb0, 0xda, 0xf5, 0xeb, 0xd7, 0x8d, 0x8c, 0xc6, 0x18,
+  0x3f, 0xbf, 0x9a, 0xc0, 0x65, 0x86, 0xb5, 0x96, 0x18, 0x87, 0x86, 0x66, 0xcd, 0x8d, 0x8c, 0xc3,
+  0x58, 0x0f, 0xbf, 0xed, 0xad, 0xaf, 0x59, 0x8c, 0x62, 0xff, 0xfb, 0x56, 0xb4, 0xd3, 0x59, 0xac,
+  0xc3, 0x18, 0x32, 0xc2, 0xc9, 0xa5, 0xbe, 0xb5, 0xeb, 0x63, 0x7c, 0x85, 0x83, 0x0b, 0x1b, 0x16,
+  0xd7, 0x8c, 0xcc, 0xc6, 0x00, 0x0f, 0xff, 0xef, 0x86, 0xb5, 0xb5, 0xb0, 0xd9, 0xb3, 0x3c, 0xcd,
+  0xb6, 0x3d, 0x78, 0x66, 0xff, 0xff, 0x7d, 0x33, 0x36, 0x6c, 0xf3, 0x6c, 0xf1, 0xe3, 0xd6, 0xc6,
+  0xb6, 0x9f, 0xfd, 0xff, 0xfc, 0x0d, 0x30, 0x31, 0x30, 0xda, 0xc1, 0xac, 0xb2, 0xd6, 0x9a, 0x5a,
+  0xd1, 0x64, 0x68, 0x06, 0xb0, 0x6b, 0x17, 0xff, 0xf3, 0x06, 0x31, 0x9a, 0xf5, 0xb0, 0xd7, 0xa6,
+  0x00, 0xb1, 0x6b, 0x42, 0xc5, 0x83, 0x2d, 0x60, 0x28, 0x3b, 0x35, 0xeb, 0x63, 0x6b, 0xd6, 0xc3,
+  0x0d, 0x3f, 0xbf, 0xff, 0xf7, 0xb5, 0xac, 0x6b, 0x6b, 0x33, 0x0f, 0x58, 0xc6, 0x19, 0x6d, 0x34,
+  0x0f, 0xfe, 0x83, 0x5b, 0x19, 0x99, 0xb3, 0x66, 0xc7, 0xad, 0x8f, 0xbf, 0xff, 0xf5, 0xda, 0xc6,
+  0xc6, 0xcf, 0x44, 0xc4, 0xb6, 0x7a, 0xf3, 0x36, 0x33, 0x1f, 0x4b, 0x01, 0xff, 0xff, 0xea, 0xb6,
+  0x1b, 0x1b, 0x1e, 0xb6, 0x66, 0x31, 0xbf, 0xbf, 0xfb, 0x58, 0xc6, 0x66, 0x66, 0xd7, 0x8c, 0xd7,
+  0xac, 0x60, 0x3f, 0xff, 0xb5, 0xac, 0x1a, 0xcb, 0x34, 0x6b, 0x23, 0x40, 0xf0, 0xd3, 0x66, 0xc7,
+  0xac, 0xcd, 0x66, 0xb2, 0xc3, 0xef, 0xed, 0x66, 0x33, 0x18, 0x67, 0xff, 0x76, 0x8b, 0x46, 0x98,
+  0x30, 0xda, 0xcd, 0x66, 0xb0, 0x58, 0x5a, 0x0b, 0xe6, 0x36, 0xbc, 0xfa, 0x16, 0x2c, 0xd6, 0x55,
+  0x55, 0x1e, 0xb6, 0x3d, 0x6c, 0xc6, 0x00, 0x07, 0xff, 0xf7, 0xc0, 0xc6, 0xbd, 0x6c, 0x6c, 0xd9,
+  0xb3, 0xc7, 0x99, 0xb1, 0xb5, 0x9f, 0xff, 0xf0, 0x7f, 0xf3, 0x33, 0x3c, 0x79, 0xb6, 0x79, 0x9b,
+  0x63, 0x31, 0x83, 0xff, 0xfb, 0xff, 0x81, 0xa6, 0x0d, 0x87, 0x84, 0xd6, 0x5e, 0x9a, 0xd6, 0xb5,
+  0xa0, 0x26, 0xac, 0xb4, 0x00, 0x35, 0xad, 0xa6, 0x0f, 0xbf, 0xeb, 0x35, 0x8c, 0xc6, 0x31, 0x9a,
+  0xcd, 0x6b, 0x01, 0x65, 0xa0, 0x2d, 0x6b, 0x2c, 0x03, 0x01, 0x82, 0x7a, 0xcc, 0xc6, 0x66, 0x36,
+  0x18, 0x34, 0xff, 0xff, 0xe0, 0xfb, 0x58, 0x31, 0x8c, 0xc6, 0x63, 0x1a, 0xf4, 0xc3, 0x5a, 0x05,
+  0xff, 0xc1, 0xad, 0xad, 0x8c, 0xd9, 0x9b, 0x6b, 0xcc, 0xcc, 0x6f, 0xff, 0xfe, 0x0f, 0x9a, 0xd8,
+  0xcc, 0xf2, 0x42, 0x41, 0x9b, 0x66, 0xcc, 0xc6, 0xd7, 0xdf, 0xfd, 0x8b, 0x2d, 0x3f, 0xff, 0xb8,
+  0xc6, 0xd7, 0xaf, 0x5e, 0xbd, 0x78, 0xcc, 0x66, 0xff, 0xbf, 0xed, 0x6b, 0x6b, 0x63, 0x33, 0x33,
+  0x33, 0x19, 0xad, 0xad, 0x6d, 0x37, 0xfd, 0xfd, 0xac, 0x06, 0xb0, 0x0d, 0x68, 0xe0, 0x40, 0x37,
+  0xd6, 0xd8, 0xd8, 0xda, 0xda, 0xc3, 0x59, 0x69, 0xff, 0xd8, 0xc6, 0x33, 0x5b, 0x3f, 0xee, 0x22,
+  0xd3, 0x46, 0x5b, 0x58, 0xc6, 0x35, 0xb5, 0x80, 0x2c, 0x41, 0x75, 0x8c, 0xcd, 0xf3, 0xb1, 0x6b,
+  0x06, 0xa8, 0xe8, 0xb6, 0x33, 0x36, 0x33, 0x6b, 0xd6, 0x00, 0x1f, 0xff, 0xfe, 0xdc, 0x35, 0x8c,
+  0x66, 0x6c, 0x79, 0x9b, 0x6c, 0xcd, 0x99, 0x9a, 0xdf, 0xff, 0x7f, 0xff, 0xc0, 0xb3, 0x33, 0x6c,
+  0xdb, 0x66, 0xd9, 0xb3, 0x33, 0x5b, 0x58, 0xff, 0xff, 0xe9, 0xfe, 0x06, 0xb5, 0x8d, 0x61, 0xe1,
+  0x0d, 0x63, 0x4d, 0x69, 0xa0, 0x5a, 0x05, 0xa0, 0x2c, 0x1a, 0x61, 0x96, 0x1d, 0xff, 0xf6, 0x6b,
+  0x6b, 0x31, 0x9a, 0xf5, 0x9a, 0xcd, 0x6b, 0x05, 0x96, 0x80, 0xb5, 0xa6, 0x98, 0x00, 0x02, 0x05,
+  0xb5, 0xb1, 0x99, 0x8d, 0x8c, 0x60, 0xd3, 0xff, 0xef, 0xff, 0xeb, 0x2c, 0xc3, 0x19, 0x98, 0xcc,
+  0x31, 0x83, 0x58, 0x07, 0xdf, 0xc3, 0x2f, 0x59, 0x8d, 0x99, 0xb3, 0x36, 0x66, 0x63, 0x7f, 0xfd,
+  0xff, 0xfd, 0x31, 0x99, 0x9b, 0x4b, 0xcb, 0x6c, 0xd9, 0xeb, 0xc6, 0x6d, 0x67, 0xff, 0xff, 0xa6,
+  0x58, 0xb4, 0x7d, 0xff, 0xf6, 0xb6, 0xb6, 0x36, 0x36, 0x63, 0x33, 0x1f, 0xf7, 0xd3, 0x59, 0xad,
+  0x8c, 0xcc, 0xcc, 0xc6, 0xd6, 0x61, 0xac, 0xd6, 0xb7, 0xff, 0xfa, 0xee, 0xb0, 0x1a, 0xd6, 0x0d,
+  0x07, 0x82, 0x21, 0xde, 0xbc, 0x6c, 0xc6, 0x61, 0x83, 0x4d, 0x1f, 0xdd, 0xeb, 0x31, 0x8c, 0x77,
+  0xf6, 0xad, 0x16, 0x9a, 0x32, 0xf4, 0xcc, 0x31, 0x8d, 0x60, 0x00, 0xb4, 0x5d, 0x6b, 0xd7, 0xad,
+  0xbb, 0x8b, 0x5a, 0xd6, 0x1a, 0x72, 0x6f, 0x31, 0xb3, 0x33, 0x33, 0x18, 0x00, 0x3f, 0xff, 0xfd,
+  0xb8, 0x30, 0xda, 0xd9, 0x99, 0xb6, 0x6c, 0xdb, 0x33, 0x63, 0x1b, 0xef, 0xff, 0xf8, 0x76, 0x66,
+  0x6d, 0x9b, 0x3c, 0xd9, 0xb6, 0x36, 0x35, 0xe9, 0xaf, 0xff, 0xfe, 0x8f, 0x86, 0x9a, 0xc1, 0xb0,
+  0xb0, 0x4d, 0x6b, 0x1a, 0x34, 0x01, 0x35, 0x65, 0xa0, 0x58, 0xb0, 0xd6, 0x1a, 0xc0, 0xef, 0xfe,
+  0x6b, 0x6b, 0x6b, 0xd6, 0x6b, 0xd6, 0x60, 0x65, 0x85, 0xad, 0x02, 0xd3, 0x41, 0xac, 0x00, 0x00,
+  0x01, 0xe6, 0x33, 0x1b, 0x1b, 0x5e, 0xb3, 0x06, 0xb7, 0x7f, 0xff, 0xef, 0x6b, 0x0d, 0x7a, 0xc6,
+  0xc6, 0x36, 0xbd, 0x63, 0x59, 0xac, 0x00, 0xff, 0xb9, 0xac, 0x31, 0x99, 0x99, 0xb3, 0x66, 0x66,
+  0x63, 0x3f, 0xff, 0xfa, 0x5a, 0xcc, 0x6c, 0xda, 0x7a, 0x77, 0x36, 0xcc, 0xd9, 0x98, 0xdf, 0xfd,
+  0xf6, 0xb1, 0x6b, 0x47, 0xff, 0xf4, 0x36, 0x33, 0x31, 0xeb, 0xd6, 0xc6, 0x7f, 0xf7, 0xcd, 0x31,
+  0x86, 0x66, 0x66, 0x63, 0xd6, 0x33, 0x06, 0x0d, 0x67, 0xfd, 0xf2, 0xc0, 0xd6, 0xb0, 0x04, 0x01,
+  0x10, 0xfc, 0x6c, 0xc6, 0xc3, 0x35, 0x80, 0x0f, 0xbb, 0x5b, 0x18, 0xce, 0xf9, 0x16, 0xac, 0x9a,
+  0x32, 0xcd, 0x6d, 0x66, 0x35, 0xb5, 0x80, 0xd0, 0x2d, 0x0f, 0xe3, 0x31, 0xeb, 0x7f, 0xd9, 0x68,
+  0x6b, 0x09, 0x59, 0x4d, 0x78, 0xcd, 0x8d, 0x8f, 0x59, 0x98, 0x00, 0x7f, 0xff, 0xfb, 0x7d, 0x9a,
+  0xc6, 0x63, 0x36, 0x6c, 0xd9, 0xb6, 0x67, 0xaf, 0x5b, 0x0d, 0xff, 0xff, 0x1b, 0x66, 0x66, 0xcd,
+  0xb6, 0x6c, 0xf1, 0xb6, 0xbd, 0x7a, 0x66, 0x9f, 0xff, 0xfc, 0xe8, 0x69, 0x81, 0xb0, 0xb0, 0x46,
+  0xb5, 0x86, 0x80, 0x5a, 0xd0, 0xb4, 0x05, 0x96, 0x58, 0xd6, 0x0d, 0x60, 0x3f, 0xff, 0xb5, 0xeb,
+  0x19, 0x8c, 0x61, 0x8d, 0x6b, 0x2c, 0xb4, 0xd5, 0x96, 0x80, 0x0c, 0x00, 0x00, 0x01, 0xb3, 0x31,
+  0x9b, 0x5e, 0xbd, 0x6c, 0x6b, 0x35, 0xa7, 0xff, 0xff, 0x07, 0xff, 0x60, 0xd7, 0xac, 0xc6, 0xc6,
+  0x36, 0xb6, 0xb0, 0xcb, 0x00, 0x7f, 0xfd, 0xa6, 0x1a, 0xf5, 0xb5, 0xe3, 0x66, 0x6c, 0xcc, 0xda,
+  0xda, 0xdf, 0xff, 0xfe, 0x5f, 0xff, 0x35, 0xb1, 0xb3, 0x29, 0x69, 0x1e, 0x36, 0xcc, 0xd8, 0xcf,
+  0xbf, 0xad, 0x65, 0x96, 0x8f, 0xbf, 0xf8, 0xda, 0xd8, 0xd8, 0xd8, 0xcc, 0x6f, 0xff, 0xeb, 0x5a,
+  0xd6, 0xd6, 0x63, 0x33, 0x1e, 0xb6, 0x31, 0x8c, 0x18, 0x6b, 0x0f, 0xff, 0xf6, 0x5d, 0x60, 0x69,
+  0x96, 0x04, 0x51, 0x21, 0x0c, 0xcc, 0xc7, 0xac, 0x63, 0x58, 0x16, 0x4f, 0xec, 0x66, 0xbd, 0x5d,
+  0x12, 0xd2, 0xd6, 0x9a, 0x65, 0xb5, 0x9a, 0xda, 0xda, 0xcd, 0x61, 0xa6, 0x80, 0xb4, 0xbe, 0x1b,
+  0x1b, 0x3e, 0xa3, 0x40, 0xc4, 0x74, 0x6b, 0x31, 0xb3, 0x36, 0x33, 0x6b, 0x60, 0x00, 0xff, 0xff,
+  0xf5, 0x8c, 0xbd, 0x6d, 0x6c, 0xd8, 0xf1, 0xe6, 0x78, 0xf5, 0xe3, 0x30, 0xff, 0xff, 0x93, 0xff,
+  0xb3, 0x33, 0x66, 0xcf, 0x33, 0xcc, 0xd9, 0x8c, 0xd6, 0x1f, 0xff, 0xfc, 0xe6, 0x8c, 0xb0, 0x6c,
+  0x2c, 0x10, 0xd6, 0x58, 0x02, 0xc8, 0x0b, 0x42, 0xcb, 0x5a, 0xcb, 0x35, 0xad, 0xad, 0x60, 0x1f,
+  0xfd, 0x30, 0xda, 0xda, 0xda, 0xda, 0xc3, 0x59, 0x6b, 0x20, 0x26, 0x8b, 0x16, 0x34, 0x00, 0x00,
+  0x01, 0xb6, 0x36, 0xbd, 0x7a, 0xd9, 0x8c, 0x61, 0xa6, 0xff, 0xef, 0xff, 0xfd, 0xdb, 0x1a, 0xda,
+  0xda, 0xf5, 0xb1, 0xb5, 0xeb, 0x35, 0x9a, 0xc0, 0x07, 0x7f, 0x5a, 0xc6, 0xb6, 0x1b, 0x31, 0xe3,
+  0x66, 0x6c, 0x63, 0x3f, 0xbf, 0xff, 0xfc, 0x9a, 0xf5, 0x99, 0xb2, 0xb2, 0xad, 0xb3, 0x66, 0xcc,
+  0x6d, 0x7f, 0xf4, 0xcb, 0x2d, 0x68, 0xbf, 0xef, 0xb3, 0x19, 0x99, 0x98, 0xda, 0xf7, 0x7f, 0xf5,
+  0xa6, 0x59, 0xac, 0xc6, 0x66, 0x36, 0x33, 0x18, 0x61, 0x83, 0x2c, 0x7f, 0x7f, 0xd9, 0x61, 0xa6,
+  0xb0, 0x92, 0x84, 0xc4, 0x73, 0x63, 0x31, 0x9a, 0xcd, 0x6b, 0x16, 0x87, 0x4c, 0x65, 0xc8, 0x88,
+  0x2d, 0x34, 0xd6, 0x35, 0x98, 0xd7, 0xac, 0x6b, 0x1a, 0x69, 0xa0, 0x45, 0xfc, 0xcd, 0x8d, 0x97,
+  0xf6, 0x96, 0x03, 0x22, 0x21, 0xb6, 0x33, 0x36, 0x66, 0x66, 0x36, 0xb0, 0x00, 0xff, 0xff, 0xf5,
+  0x9a, 0xcd, 0x7a, 0xd8, 0xf5, 0xe6, 0x6d, 0x9b, 0x33, 0xd6, 0xc6, 0x3f, 0xfe, 0xff, 0xfe, 0xcc,
+  0xcc, 0xdb, 0x66, 0xcd, 0xb3, 0x6b, 0xc6, 0xbd, 0x6b, 0x77, 0xff, 0xff, 0x3c, 0xd3, 0x59, 0x63,
+  0x58, 0x78, 0x38, 0x6b, 0x59, 0x61, 0x65, 0xa0, 0x26, 0x96, 0x5a, 0xd3, 0x58, 0x19, 0x7a, 0x60,
+  0x07, 0xdf, 0xd8, 0xc6, 0x33, 0x5b, 0x58, 0x6b, 0x59, 0x68, 0xdd, 0x93, 0x4b, 0x2c, 0xb0, 0x00,
+  0x00, 0x00, 0x3d, 0x8c, 0x6c, 0x6c, 0x66, 0x30, 0x68, 0xff, 0xff, 0xde, 0x86, 0xb6, 0x19, 0xb5,
+  0xb3, 0x18, 0xc3, 0x00, 0x07, 0xdf, 0xda, 0xc6, 0xb6, 0xb6, 0xbd, 0x7a, 0xf5, 0xe3, 0xd7, 0x8d,
+  0xaf, 0x0d, 0x3f, 0xee, 0xb5, 0xe1, 0xeb, 0xcb, 0x3b, 0x1d, 0xb3, 0x36, 0x6d, 0x78, 0xff, 0xb9,
+  0xac, 0xb2, 0xd0, 0x77, 0xff, 0x35, 0xeb, 0x63, 0x63, 0x33, 0x57, 0xff, 0x65, 0xad, 0x63, 0x5b,
+  0x5b, 0x5e, 0xbd, 0x6c, 0x66, 0x6b, 0x61, 0x83, 0x0d, 0x60, 0xbf, 0xfe, 0xb2, 0xc6, 0x9a, 0xcb,
+  0x28, 0x0a, 0x09, 0x7a, 0xd8, 0xcc, 0xc3, 0x5b, 0x5a, 0xd6, 0x9a, 0xb5, 0xd8, 0xdc, 0x91, 0x16,
+  0xac, 0x9a, 0x6b, 0x59, 0xac, 0x63, 0x18, 0x60, 0x6b, 0x5a, 0x35, 0x64, 0xfe, 0x99, 0x9b, 0x1b,
+  0x7f, 0xd0, 0xb5, 0x83, 0x41, 0x40, 0x63, 0x63, 0xd7, 0xaf, 0x31, 0xb3, 0x5e, 0xb6, 0x00, 0x1f,
+  0xff, 0xfe, 0xb6, 0xb1, 0x8c, 0xd8, 0xf5, 0xe6, 0xcd, 0x9b, 0x33, 0x31, 0x9f, 0xdf, 0xff, 0xf2,
+  0xf9, 0x8d, 0xb3, 0x66, 0xd9, 0xb3, 0x66, 0x63, 0x0d, 0x77, 0xff, 0xff, 0x3c, 0xd6, 0xb5, 0x81,
+  0xb0, 0xf0, 0x80, 0x6b, 0x2c, 0xb5, 0xa6, 0x8b, 0x5a, 0x2c, 0xb4, 0xd3, 0x5a, 0xc6, 0xb0, 0xd6,
+  0x00, 0xb7, 0xfd, 0x6b, 0xd6, 0x33, 0x0d, 0x66, 0x99, 0x69, 0xa1, 0x68, 0x2d, 0x6b, 0x5a, 0xc6,
+  0x00, 0x00, 0x00, 0xf3, 0x1b, 0x5e, 0x33, 0x33, 0x0c, 0x1a, 0x7f, 0xff, 0xef, 0xff, 0xf3, 0x5a,
+  0xf5, 0x98, 0xd8, 0xcc, 0xd7, 0xac, 0xd6, 0x00, 0x0f, 0xfa, 0xb1, 0x97, 0xac, 0xc6, 0x6c, 0x6c,
+  0xcd, 0x8d, 0x86, 0x8f, 0xef, 0xe6, 0xd6, 0xcc, 0xd7, 0x37, 0x06, 0xd9, 0xb1, 0xb3, 0x7f, 0x7d,
+  0xa6, 0x59, 0x6b, 0x44, 0xef, 0xfb, 0x35, 0xe3, 0x31, 0xb1, 0xbf, 0xfa, 0x16, 0xb0, 0x31, 0x9a,
+  0xf5, 0xb3, 0x5e, 0x1b, 0x5b, 0x59, 0x83, 0x06, 0xb0, 0x3f, 0xfb, 0xac, 0x03, 0x5a, 0xca, 0xc2,
+  0xa2, 0x8c, 0xc6, 0xc3, 0x35, 0x86, 0xb4, 0x6e, 0xca, 0xd2, 0x24, 0x2b, 0x42, 0xd6, 0x9a, 0x61,
+  0xac, 0xc3, 0x35, 0xb5, 0x83, 0x5a, 0xd6, 0x9a, 0x5a, 0xbf, 0xec, 0xcc, 0xcd, 0x8b, 0xf8, 0xb4,
+  0xd6, 0x0f, 0x8f, 0x4c, 0xcc, 0xcf, 0x5b, 0x63, 0x36, 0x19, 0x80, 0x07, 0xff, 0xff, 0xb7, 0x30,
+  0xda, 0xd9, 0xb1, 0xb6, 0x6c, 0xf5, 0xe3, 0x63, 0x1b, 0xbf, 0xff, 0xe7, 0x6f, 0x5b, 0x33, 0x6c,
+  0xd9, 0xb6, 0x6c, 0x6d, 0x7a, 0xc1, 0xdf, 0xff, 0xfc, 0xfa, 0x6b, 0x2c, 0x0d, 0x89, 0x86, 0xb0,
+  0xd3, 0x5a, 0xd6, 0x8d, 0x59, 0x68, 0x16, 0x8d, 0x1a, 0x60, 0xd6, 0x6b, 0x58, 0x02, 0xd7, 0xdd,
+  0xeb, 0x30, 0xc6, 0x06, 0xb5, 0xa6, 0x96, 0x41, 0x6b, 0x46, 0xb5, 0x8c, 0x00, 0x00, 0x03, 0xc6,
+  0x66, 0x66, 0x63, 0x6b, 0x6b, 0x0d, 0x3e, 0xff, 0xff, 0xdd, 0x35, 0xb5, 0xb0, 0xf5, 0xb1, 0x99,
+  0xad, 0xac, 0x00, 0x0f, 0xfe, 0xb3, 0x58, 0x63, 0x31, 0xeb, 0x66, 0x6c, 0x6c, 0x63, 0x07, 0xf7,
+  0xf6, 0x63, 0x66, 0xc0, 0xbe, 0xcd, 0x9b, 0x33, 0x35, 0xff, 0x1a, 0xd6, 0x59, 0x35, 0x69, 0xfd,
+  0xd8, 0x6c, 0x6d, 0x7a, 0xcf, 0xfe, 0x02, 0xc0, 0xd6, 0xc3, 0x31, 0xb1, 0x8c, 0xc3, 0x35, 0x9a,
+  0xc3, 0x58, 0xb1, 0xf7, 0xfd, 0x60, 0x1a, 0xd2, 0xe0, 0xb0, 0xae, 0x33, 0x30, 0xcd, 0x60, 0xd0,
+  0x22, 0xdd, 0xa4, 0xb7, 0x69, 0x69, 0x6b, 0x4d, 0x35, 0x86, 0x18, 0xc6, 0x18, 0x1a, 0xcb, 0x5a,
+  0x0b, 0x7f, 0xf5, 0x8f, 0x5b, 0x6b, 0xcc, 0xff, 0xbb, 0x43, 0x4d, 0x67, 0x67, 0x3f, 0x59, 0xb3,
+  0x33, 0x66, 0x66, 0x63, 0x34, 0x00, 0x3f, 0xff, 0xfd, 0xbb, 0x0c, 0xc6, 0xcc, 0xd9, 0xb6, 0x3c,
+  0xcc, 0xc6, 0x37, 0xff, 0xfd, 0x11, 0x8f, 0x5e, 0x3c, 0xcf, 0x33, 0x66, 0x66, 0x35, 0x8e, 0xff,
+  0xff, 0xe8, 0x6b, 0x59, 0x60, 0xd6, 0x2e, 0x22, 0xc0, 0xd1, 0xa6, 0x82, 0xc8, 0x16, 0xb4, 0x0d,
+  0x35, 0x83, 0x0d, 0x60, 0x2c, 0x5a, 0x5f, 0x66, 0x30, 0xd6, 0x69, 0xad, 0x34, 0x5a, 0x05, 0xa0,
+  0xd3, 0x2d, 0xa0, 0x00, 0x00, 0x3c, 0x63, 0x63, 0x63, 0x61, 0xb5, 0x80, 0x7f, 0xff, 0xef, 0x76,
+  0x5e, 0xb1, 0xb1, 0x98, 0xf5, 0x98, 0x60, 0x00, 0x77, 0xf3, 0x4c, 0x31, 0x8c, 0xcc, 0xcc, 0xd9,
+  0x8c, 0xc6, 0x07, 0xf7, 0xc6, 0x6c, 0x63, 0x62, 0x66, 0x6d, 0xaf, 0x31, 0xff, 0x06, 0x59, 0x65,
+  0xa2, 0x1f, 0xd1, 0x99, 0x98, 0xdf, 0xd2, 0x05, 0x83, 0x59, 0xaf, 0x59, 0x8d, 0x86, 0xd6, 0xc3,
+  0x0c, 0x65, 0xb5, 0xac, 0xb0, 0x7f, 0xff, 0xbd, 0xeb, 0x01, 0xac, 0xc4, 0x2e, 0x2f, 0x6c, 0xc6,
+  0x19, 0xac, 0x00, 0x42, 0x42, 0x84, 0xb4, 0xb5, 0xa6, 0x9a, 0xc1, 0x8c, 0x33, 0x5b, 0x58, 0x6b,
+  0x5a, 0xcb, 0x41, 0x77, 0xf1, 0xb1, 0xeb, 0xc6, 0xcb, 0xff, 0x80, 0x0c, 0xe0, 0xdd, 0x7a, 0xd9,
+  0xb1, 0xb3, 0x66, 0x63, 0x31, 0x80, 0x03, 0xff, 0xff, 0xda, 0x18, 0xcd, 0x8d, 0xb3, 0x36, 0xcc,
+  0xcd, 0x86, 0x3f, 0xff, 0xe9, 0xf9, 0x98, 0xf1, 0xe6, 0x6d, 0x99, 0xeb, 0x63, 0x1a, 0xce, 0xff,
+  0xff, 0xe9, 0xd6, 0xb5, 0x80, 0x31, 0xf1, 0x75, 0x80, 0x0d, 0x05, 0x93, 0x4b, 0x26, 0x80, 0x34,
+  0xc3, 0x58, 0xd6, 0x0b, 0x0b, 0x4d, 0xd9, 0x6e, 0x33, 0x59, 0x0c, 0x19, 0xa5, 0x0b, 0x5a, 0x01,
+  0xac, 0x30, 0x00, 0x00, 0x6d, 0x6c, 0x66, 0x66, 0xd7, 0xad, 0xaf, 0x4c, 0x07, 0xff, 0xf7, 0xff,
+  0x2d, 0xad, 0xad, 0x8d, 0x8c, 0xc6, 0x6b, 0x00, 0x03, 0xef, 0xb4, 0xc3, 0x1a, 0xf5, 0xb1, 0x9b,
+  0x1b, 0x1b, 0x18, 0xc0, 0x7f, 0x7c, 0xcc, 0xdb, 0x37, 0x2b, 0xc6, 0xd9, 0x99, 0xbf, 0xe0, 0x65,
+  0x96, 0x5a, 0x2d, 0x2e, 0xec, 0x6c, 0x65, 0xf0, 0x80, 0x06, 0x5e, 0xb3, 0x0f, 0x59, 0x9a, 0xf5,
+  0xb5, 0x98, 0x61, 0x97, 0xa6, 0x58, 0x59, 0xff, 0xf4, 0xb0, 0x68, 0xd2, 0x32, 0x31, 0xb5, 0xeb,
+  0x61, 0x86, 0xb0, 0x0b, 0x44, 0xb7, 0x69, 0x2d, 0x5a, 0x5a, 0xd1, 0xa6, 0xb0, 0xc3, 0x18, 0xc3,
+  0x06, 0xb5, 0x96, 0x4d, 0x17, 0xff, 0xda, 0xf1, 0xb1, 0xeb, 0xcc, 0x7f, 0x7c, 0xb2, 0xc0, 0xd6,
+  0xd1, 0xaf, 0x1b, 0x1e, 0x36, 0x6c, 0x6d, 0x7a, 0xcc, 0x80, 0x07, 0xff, 0xf7, 0x1a, 0xf1, 0x99,
+  0xb3, 0x36, 0xcd, 0x8f, 0x5e, 0xb3, 0x2f, 0xff, 0xfa, 0xcf, 0x99, 0x8f, 0x1b, 0x67, 0xaf, 0x33,
+  0x36, 0xbd, 0x63, 0x5b, 0xbf, 0xff, 0xfa, 0xed, 0x65, 0x96, 0x34, 0xc8, 0xc7, 0xb2, 0xc0, 0x16,
+  0x0b, 0x4d, 0x59, 0x68, 0xd5, 0x80, 0xd6, 0x0c, 0x19, 0x60, 0xb2, 0xd3, 0x76, 0x5a, 0x02, 0xc6,
+  0x98, 0xc3, 0x6b, 0x77, 0x26, 0x80, 0x0c, 0x35, 0xb0, 0x08, 0x0e, 0x19, 0x99, 0x8d, 0x98, 0xcc,
+  0x31, 0x63, 0xbf, 0xff, 0xf7, 0x71, 0x86, 0x66, 0x63, 0x6b, 0xd6, 0xd6, 0x00, 0x03, 0xfb, 0xb2,
+  0xcd, 0x66, 0xb6, 0x31, 0xb1, 0xb3, 0x1b, 0x18, 0x00, 0xfe, 0xfb, 0x31, 0xed, 0x3d, 0x0d, 0x9e,
+  0xb6, 0xc6, 0xfe, 0x03, 0x2c, 0x59, 0x04, 0x27, 0xcc, 0x7a, 0x74, 0xdd, 0xad, 0x00, 0xd6, 0xb6,
+  0xb3, 0x18, 0xcc, 0x66, 0x19, 0xad, 0xac, 0x6b, 0x1a, 0xd6, 0x16, 0x5f, 0x7f, 0xd9, 0x63, 0x47,
+  0x01, 0xa1, 0xa6, 0x33, 0x1a, 0xda, 0xd6, 0x0b, 0x21, 0x11, 0x22, 0x21, 0x68, 0xd1, 0xac, 0x18,
+  0xc6, 0xb6, 0x0c, 0x35, 0x96, 0x59, 0x68, 0x7f, 0xf7, 0x33, 0x36, 0x36, 0xc6, 0xd7, 0xff, 0xd6,
+  0xb4, 0xd6, 0xcc, 0xcc, 0x6c, 0x6c, 0xd8, 0xf1, 0xb3, 0x33, 0x35, 0xb5, 0x80, 0x03, 0xff, 0xef,
+  0x8d, 0xad, 0x99, 0x9b, 0x36, 0x6c, 0xcd, 0x8c, 0x37, 0xff, 0xfd, 0x8f, 0xcc, 0x7a, 0xdb, 0x33,
+  0xc7, 0xaf, 0x33, 0x31, 0xad, 0xa6, 0xff, 0xff, 0xed, 0xb5, 0x96, 0x2c, 0xd3, 0x2b, 0x26, 0xd6,
+  0x58, 0xb0, 0xb2, 0xd6, 0x82, 0xd3, 0x45, 0x82, 0xda, 0x60, 0xc1, 0xac, 0x16, 0x26, 0x8b, 0x5a,
+  0x05, 0x83, 0x58, 0xc3, 0x31, 0xbe, 0xe8, 0x00, 0x35, 0x8c, 0x02, 0x01, 0xfa, 0xcc, 0xc6, 0x6c,
+  0x66, 0xd6, 0xd6, 0xd6, 0xb2, 0xd7, 0xff, 0xfe, 0xff, 0xf1, 0x8c, 0x6d, 0x78, 0x7a, 0xda, 0xd8,
+  0x00, 0x03, 0xfe, 0x2d, 0xa6, 0x6b, 0x6b, 0xd6, 0x66, 0x36, 0x66, 0x33, 0x00, 0x0f, 0xee, 0x36,
+  0x6c, 0xeb, 0x67, 0xaf, 0x1b, 0x3e, 0xb0, 0x6b, 0x2c, 0x2d, 0x08, 0x48, 0x48, 0x41, 0x1a, 0x0d,
+  0x61, 0x8c, 0x63, 0x31, 0x8c, 0x63, 0x0c, 0x35, 0x9a, 0xd6, 0xb1, 0x65, 0xdf, 0xfd, 0x80, 0x3b,
+  0x8e, 0x0e, 0x33, 0x35, 0xb5, 0x9a, 0xd6, 0x2c, 0x42, 0x15, 0xbb, 0x48, 0xb7, 0x64, 0x68, 0x35,
+  0x86, 0x35, 0xb5, 0x98, 0x60, 0xd6, 0x2c, 0x5a, 0x6e, 0xef, 0xfe, 0xcc, 0xcc, 0xd9, 0x9b, 0x33,
+  0xfe, 0xfe, 0xd0, 0x6b, 0x30, 0xaf, 0x19, 0x9b, 0x33, 0x66, 0xc7, 0xad, 0x8c, 0x6b, 0x00, 0x07,
+  0xff, 0x7f, 0x33, 0x1b, 0x1e, 0xbc, 0xcd, 0xb1, 0xb3, 0x18, 0xdf, 0xff, 0xf6, 0xbd, 0xad, 0x99,
+  0x9b, 0x3d, 0x79, 0x9b, 0x31, 0x8c, 0x0f, 0xff, 0xee, 0xb5, 0x96, 0x01, 0x9b, 0x96, 0xd6, 0xb5,
+  0x96, 0x2d, 0x6b, 0x41, 0x64, 0x02, 0xc5, 0x86, 0xb1, 0xac, 0x6b, 0x58, 0x2c, 0x9a, 0x59, 0x00,
+  0x58, 0x6b, 0x18, 0x66, 0x33, 0x7f, 0xf4, 0x16, 0x03, 0x06, 0x03, 0x03, 0x19, 0x8c, 0xc7, 0xaf,
+  0x5b, 0x30, 0xc6, 0xb5, 0xad, 0xff, 0xdf, 0xff, 0xda, 0xcd, 0x7a, 0xd8, 0xd8, 0xc6, 0xd0, 0x00,
+  0x07, 0xfc, 0x0c, 0x30, 0xda, 0xd8, 0xcc, 0xcc, 0x6c, 0x30, 0x00, 0xfe, 0xe6, 0xcd, 0xed, 0xbc,
+  0xd9, 0x99, 0xf1, 0x83, 0x58, 0x2c, 0xb4, 0x42, 0x22, 0x41, 0x16, 0x9a, 0x34, 0xc3, 0x5b, 0x59,
+  0x9a, 0xd8, 0xc3, 0x6b, 0x35, 0xb5, 0x8d, 0x61, 0xac, 0xb2, 0xd6, 0xaf, 0xfe, 0xb0, 0x1f, 0x87,
+  0x47, 0xaf, 0x59, 0x8d, 0x66, 0xb5, 0x85, 0xad, 0x5a, 0x24, 0xb5, 0x16, 0xad, 0x03, 0x46, 0xb1,
+  0xad, 0xac, 0xc3, 0x1a, 0xcd, 0x6b, 0x16, 0x2d, 0x37, 0x7f, 0xff, 0x31, 0xb3, 0x36, 0x66, 0xc7,
+  0xbb, 0xff, 0xea, 0xc0, 0xcb, 0xab, 0x38, 0xd8, 0xf1, 0xb6, 0x66, 0x6d, 0x78, 0x66, 0xb0, 0x00,
+  0x3f, 0xef, 0xeb, 0x63, 0x33, 0x66, 0xcd, 0x8f, 0x1b, 0x5e, 0xb1, 0xff, 0xff, 0x75, 0xcc, 0x6c,
+  0xcd, 0x9b, 0x36, 0x6d, 0x78, 0x6d, 0x6b, 0x1f, 0xf7, 0xff, 0x65, 0x96, 0x01, 0x9f, 0x9b, 0xa6,
+  0xb5, 0xad, 0x6b, 0x5a, 0x69, 0x65, 0xa6, 0xac, 0x59, 0x65, 0x9a, 0x63, 0x58, 0xd6, 0xb1, 0x62,
+  0xd0, 0x5a, 0x01, 0x60, 0x6b, 0x6b, 0x19, 0x8c, 0xcf, 0xbf, 0x85, 0x96, 0x35, 0xad, 0xac, 0x12,
+  0x12, 0x36, 0xb6, 0x36, 0x36, 0x33, 0x18, 0x69, 0xa3, 0xff, 0xff, 0x7e, 0xc6, 0x6b, 0xd7, 0xad,
+  0x8d, 0xaf, 0x40, 0x00, 0x17, 0xf6, 0x9a, 0x63, 0x31, 0xb5, 0x8d, 0xaf, 0x5e, 0xbd, 0x6c, 0x00,
+  0x01, 0xfd, 0xd9, 0xb9, 0x38, 0x5b, 0x36, 0x70, 0x61, 0xac, 0xb0, 0x2d, 0x16, 0xad, 0x22, 0x22,
+  0xd2, 0xd6, 0xb4, 0xd6, 0x06, 0x6b, 0x6b, 0x6b, 0xd6, 0x33, 0x0c, 0x61, 0x86, 0xb3, 0x4d, 0x6b,
+  0x2d, 0x0f, 0xff, 0xac, 0x34, 0x28, 0xf9, 0x01, 0x98, 0x60, 0xd6, 0x2c, 0x9a, 0x84, 0x48, 0x90,
+  0x40, 0x06, 0x5b, 0x59, 0x86, 0xbd, 0x66, 0xb1, 0xad, 0x60, 0xb2, 0xd3, 0xff, 0xfa, 0x63, 0x66,
+  0x66, 0xcd, 0x99, 0xbf, 0xfb, 0xf9, 0x6b, 0x05, 0x95, 0x56, 0x66, 0x6c, 0xd9, 0x9b, 0x33, 0x31,
+  0x8c, 0xbd, 0x00, 0x0f, 0xbf, 0xfe, 0xda, 0xf5, 0xeb, 0xd7, 0x99, 0xb3, 0x66, 0x3d, 0x66, 0x3f,
+  0xff, 0xef, 0x76, 0xbd, 0x6c, 0xcd, 0x99, 0xeb, 0xcc, 0xcc, 0x61, 0x8a, 0xff, 0xff, 0xf2, 0xcb,
+  0x2c, 0x03, 0x4b, 0x40, 0xd6, 0x9a, 0xd3, 0x4d, 0x05, 0xad, 0x01, 0x65, 0xad, 0x61, 0xac, 0x30,
+  0x6b, 0x2c, 0x5a, 0xd0, 0xb5, 0xa2, 0xc5, 0x80, 0xc3, 0x30, 0xda, 0xd8, 0x7f, 0xfc, 0x59, 0x60,
+  0xcb, 0xd6, 0x0d, 0x0c, 0xc6, 0x36, 0xbc, 0x66, 0x63, 0x61, 0x80, 0xd5, 0xff, 0xdf, 0xf1, 0xaf,
+  0x5b, 0x19, 0x98, 0xd8, 0x00, 0x01, 0x7f, 0xc3, 0x5e, 0xb6, 0xbd, 0x7a, 0xd8, 0xda, 0xf1, 0xb2,
+  0x6c, 0x00, 0x00, 0xfe, 0x9b, 0xa7, 0x99, 0x9e, 0x93, 0x1a, 0xc6, 0xb0, 0x05, 0xa1, 0x09, 0x0a,
+  0xd1, 0x05, 0x93, 0x2c, 0x18, 0x66, 0xb6, 0xb6, 0xbd, 0x63, 0x18, 0x63, 0x5b, 0x5a, 0xc6, 0xb4,
+  0xd6, 0x9a, 0x5f, 0xf4, 0x11, 0x84, 0x24, 0x4c, 0x66, 0xb0, 0xd6, 0x2c, 0xb4, 0x53, 0x27, 0x69,
+  0x11, 0x68, 0xb0, 0x18, 0x31, 0xaf, 0x58, 0xc6, 0xb3, 0x5a, 0xc1, 0x62, 0xd7, 0xff, 0x7d, 0x7a,
+  0xcd, 0x8d, 0xb1, 0xe3, 0xd7, 0x97, 0xff, 0xfc, 0x34, 0xd3, 0x0a, 0xaa, 0x26, 0x6c, 0xcd, 0x9b,
+  0x33, 0x66, 0x33, 0x0c, 0x00, 0x03, 0xbf, 0xfe, 0x66, 0x66, 0x6c, 0xcd, 0x9b, 0x19, 0x8d, 0xf7,
+  0xff, 0xfe, 0x09, 0x98, 0xd9, 0xb3, 0x3d, 0x78, 0xd8, 0xcc, 0x19, 0x6f, 0xff, 0xff, 0x6a, 0xcb,
+  0x2c, 0x0d, 0x5d, 0x33, 0x46, 0x9a, 0x34, 0x16, 0x4d, 0x0b, 0x2d, 0x6b, 0x59, 0x66, 0xb0, 0xc1,
+  0xac, 0xb2, 0xd6, 0x81, 0x34, 0xb2, 0xcb, 0x03, 0x0c, 0x66, 0xbd, 0x6c, 0x37, 0xfd, 0xfd, 0xac,
+  0xb0, 0x61, 0x84, 0x04, 0x2c, 0xd7, 0xaf, 0x5b, 0x1e, 0xb6, 0xbc, 0x36, 0xb5, 0x80, 0xfb, 0xff,
+  0xff, 0x7d, 0x86, 0x66, 0x33, 0x30, 0x00, 0x00, 0xff, 0xfb, 0x5b, 0x59, 0x8c, 0xcc, 0xc6, 0xc6,
+  0xc6, 0xd7, 0xac, 0x00, 0x00, 0xfe, 0xb7, 0x77, 0x57, 0xad, 0x31, 0x8d, 0x66, 0xb0, 0x02, 0xc8,
+  0x84, 0x44, 0xb5, 0x68, 0x16, 0x58, 0x1a, 0xcc, 0x31, 0x8c, 0x63, 0x5e, 0xb1, 0x86, 0x0c, 0x06,
+  0x9a, 0x37, 0x65, 0xfd, 0xc6, 0x94, 0x23, 0x24, 0xc6, 0x35, 0xb4, 0xd6, 0x16, 0xb4, 0xfb, 0x31,
+  0xbe, 0xb7, 0x69, 0x08, 0x2c, 0x5b, 0x4c, 0x61, 0x8c, 0x33, 0x58, 0xd6, 0x58, 0x16, 0xb7, 0xf7,
+  0xff, 0xcc, 0x66, 0x6c, 0xcd, 0x9b, 0x33, 0x3f, 0xfb, 0xfa, 0x0c, 0x52, 0x4d, 0xc7, 0xad, 0xb3,
+  0x36, 0x6c, 0xcd, 0x8c, 0x63, 0x58, 0xc0, 0x01, 0xff, 0xff, 0xed, 0x98, 0xd9, 0x9b, 0x36, 0x66,
+  0x63, 0x37, 0xff, 0xdf, 0xf3, 0x5e, 0xb6, 0x3c, 0x6c, 0xd9, 0x9b, 0x18, 0xd6, 0xd6, 0xb7, 0xfd,
+  0xff, 0x59, 0x65, 0x8b, 0x36, 0x35, 0x8d, 0x0d, 0x00, 0x16, 0xb4, 0x16, 0x5a, 0x6b, 0x5a, 0xc6,
+  0xb0, 0xc0, 0xcb, 0x2d, 0x68, 0x16, 0x82, 0xd6, 0xb2, 0xc3, 0x0c, 0x63, 0x35, 0xeb, 0xd6, 0x7d,
+  0xff, 0xda, 0xcb, 0x0d, 0x66, 0x14, 0x13, 0xd6, 0xd7, 0xac, 0xda, 0xf1, 0x98, 0xda, 0xcd, 0x61,
+  0x65, 0xff, 0xff, 0xc1, 0x0c, 0x66, 0x66, 0xbc, 0x00, 0x00, 0x3f, 0xfa, 0x63, 0x18, 0xda, 0xf5,
+  0xb3, 0x1b, 0x1b, 0x19, 0x80, 0x00, 0x0b, 0xf9, 0xdf, 0xd6, 0x66, 0x18, 0xc1, 0xac, 0x1a, 0x16,
+  0xb7, 0x65, 0x69, 0x10, 0x96, 0x80, 0xb0, 0x35, 0x9a, 0xc6, 0x31, 0x8d, 0x7a, 0xc6, 0x18, 0xd6,
+  0x6b, 0x00, 0xd0, 0x2d, 0x3b, 0xf8, 0x9c, 0x25, 0x27, 0x30, 0xc3, 0x58, 0xb1, 0x6a, 0xe6, 0x66,
+  0x75, 0x5a, 0x84, 0x16, 0x58, 0x30, 0xd7, 0xac, 0x66, 0xb3, 0x59, 0xad, 0x60, 0x2c, 0xaf, 0xff,
+  0xf9, 0xe3, 0x19, 0x99, 0xb6, 0x3c, 0x6d, 0x87, 0xff, 0xfb, 0xf5, 0x83, 0x27, 0x24, 0xe3, 0x36,
+  0x6c, 0xcd, 0x9b, 0x33, 0x1b, 0x59, 0xac, 0x00, 0x01, 0xff, 0xdc, 0xd8, 0xd9, 0xb3, 0x36, 0x36,
+  0x35, 0xef, 0xff, 0xfc, 0xe9, 0xaf, 0x5b, 0x1e, 0xbc, 0xcc, 0xd9, 0x99, 0x86, 0x0d, 0x6f, 0x96,
+  0xb2, 0xc5, 0x9b, 0x9b, 0x40, 0x1a, 0x0b, 0x16, 0x9a, 0x2c, 0xb4, 0xd3, 0x5a, 0xc1, 0xac, 0xd6,
+  0x1a, 0xd6, 0x5a, 0xd0, 0x5a, 0x0b, 0x5a, 0xd6, 0xb0, 0xd6, 0x61, 0xb5, 0xb0, 0xda, 0xc7, 0xff,
+  0xf5, 0xac, 0x5e, 0x98, 0x19, 0x18, 0x33, 0x19, 0x8d, 0x8d, 0x8c, 0x63, 0x5a, 0xc8, 0xfb, 0xff,
+  0xfb, 0x6b, 0x33, 0x5e, 0x31, 0x80, 0x00, 0x1f, 0xf7, 0x18, 0xc6, 0x63, 0x33, 0x1b, 0x31, 0xb1,
+  0x8d, 0xac, 0x00, 0x07, 0xf4, 0xec, 0xe8, 0x61, 0xb5, 0x8c, 0x35, 0x81, 0xa0, 0x4d, 0xda, 0x25,
+  0xa8, 0x42, 0xd0, 0x01, 0xac, 0x30, 0xc6, 0x30, 0xc6, 0x35, 0xb5, 0x9a, 0xc3, 0x58, 0x00, 0x5a,
+  0x17, 0xfd, 0xa8, 0xca, 0x0a, 0x8d, 0xac, 0x19, 0x60, 0xb5, 0xd1, 0xb5, 0xeb, 0x6f, 0xee, 0xd2,
+  0x5a, 0x2c, 0xb5, 0x83, 0x5e, 0xb1, 0xaf, 0x59, 0xad, 0xac, 0x6b, 0x58, 0x0b, 0x2f, 0xff, 0xfa,
+  0x08, 0x66, 0x66, 0x6c, 0xd9, 0xb3, 0x33, 0x7f, 0xfd, 0xff, 0xda, 0xc1, 0x31, 0x1b, 0xd6, 0xcc,
+  0xd9, 0x9e, 0xbc, 0xcd, 0x8d, 0xaf, 0x58, 0x60, 0x00, 0x07, 0xf7, 0xc6, 0xc7, 0xaf, 0x1e, 0xbc,
+  0x66, 0x37, 0xdf, 0xff, 0xc3, 0x33, 0x1b, 0x36, 0x66, 0xcc, 0x6d, 0x6d, 0x60, 0xd2, 0xac, 0xb2,
+  0xcb, 0x70, 0x6f, 0x00, 0x0b, 0x0b, 0x4d, 0x05, 0xad, 0x68, 0xd3, 0x58, 0x35, 0xb4, 0xc6, 0x9a,
+  0xcb, 0x4d, 0x2d, 0x68, 0x5a, 0xd3, 0x4d, 0x61, 0x86, 0x33, 0x18, 0xcd, 0x6d, 0x7f, 0xf7, 0x5a,
+  0xc3, 0x58, 0x3a, 0x38, 0x63, 0x31, 0x99, 0xb5, 0xb3, 0x5e, 0xb0, 0xd6, 0x83, 0xff, 0xff, 0x8a,
+  0x66, 0x31, 0xb1, 0x80, 0x00, 0x1f, 0xdf, 0x1a, 0xda, 0xd8, 0x6d, 0x78, 0xc7, 0xad, 0x8d, 0x8c,
+  0xd7, 0xac, 0x00, 0x0e, 0xf8, 0xe9, 0xe5, 0xd6, 0xd6, 0xd6, 0x6b, 0x19, 0x66, 0x9a, 0x35, 0x64,
+  0xb4, 0x85, 0x69, 0x69, 0x69, 0xa0, 0x6b, 0x58, 0xcb, 0xd6, 0x30, 0xcd, 0x66, 0x18, 0x61, 0x83,
+  0x58, 0x58, 0x2d, 0x04, 0xfa, 0xac, 0xa8, 0xb6, 0xcd, 0x66, 0xb2, 0xc0, 0xb7, 0xf2, 0xd8, 0xcc,
+  0xdd, 0xf4, 0x8b, 0x56, 0x4d, 0x6b, 0x1a, 0xcd, 0x6c, 0x30, 0xcd, 0x63, 0x58, 0x2c, 0x17, 0xff,
+  0x7f, 0xcc, 0xd6, 0xcc, 0x78, 0xf1, 0xb6, 0x66, 0xce, 0xff, 0xff, 0x75, 0xd6, 0xb1, 0x25, 0x10,
+  0xcc, 0xd9, 0xb3, 0x66, 0xcc, 0xcc, 0xc6, 0xbd, 0x30, 0xb0, 0x00, 0x5f, 0xfd, 0x8d, 0x99, 0x9b,
+  0x33, 0x19, 0xbf, 0xff, 0xf6, 0xb8, 0xc3, 0x66, 0x3c, 0x6c, 0xd8, 0xcc, 0xc3, 0x2d, 0xa0, 0xa5,
+  0xac, 0xb3, 0x93, 0x88, 0x2c, 0x05, 0x96, 0x9a, 0x16, 0x5a, 0x68, 0xd3, 0x58, 0x35, 0x9a, 0xc3,
+  0x5a, 0xd6, 0x9a, 0x2d, 0x02, 0xd1, 0xa3, 0x5a, 0xda, 0xc3, 0x6b, 0x6b, 0xd6, 0x63, 0x0d, 0xfd,
+  0xff, 0xda, 0xc1, 0xac, 0x44, 0x42, 0x33, 0x19, 0x8d, 0x8d, 0x86, 0x60, 0x1a, 0xb7, 0xfd, 0xff,
+  0x66, 0xb6, 0x31, 0xb0, 0x00, 0x03, 0xbf, 0xeb, 0xd3, 0x19, 0xaf, 0x5b, 0x5e, 0x33, 0x1e, 0xb6,
+  0x36, 0xb6, 0x18, 0x00, 0x1f, 0xf5, 0xb7, 0x3f, 0x1b, 0x18, 0xc6, 0xb3, 0x58, 0x69, 0xad, 0x02,
+  0x11, 0x11, 0x08, 0xb5, 0xa3, 0x4d, 0x60, 0xc3, 0x5b, 0x59, 0xad, 0xac, 0xd6, 0x60, 0xc6, 0xb1,
+  0xad, 0x65, 0x96, 0x40, 0xb5, 0x59, 0x16, 0x98, 0x0c, 0x32, 0xc0, 0x1f, 0xd3, 0x1b, 0x5e, 0x33,
+  0xfe, 0x91, 0x16, 0xb4, 0xd3, 0x1a, 0xcc, 0x33, 0x5e, 0xb5, 0xeb, 0x0d, 0x62, 0xc0, 0xbf, 0xbf,
+  0xfe, 0xd6, 0x1b, 0x1e, 0xb6, 0xcd, 0x9b, 0x33, 0x36, 0xff, 0xff, 0x75, 0xfe, 0x35, 0x91, 0xd0,
+  0x73, 0x1b, 0x63, 0xcc, 0xd9, 0xb3, 0x1b, 0x5b, 0x2f, 0x5a, 0xcb, 0x00, 0x01, 0xfd, 0xd8, 0xd9,
+  0x9b, 0x1b, 0x19, 0xfd, 0xff, 0xc3, 0x18, 0xd9, 0x99, 0xb3, 0x33, 0x31, 0x8d, 0x60, 0x03, 0xed,
+  0x65, 0xae, 0x9e, 0x7b, 0x0b, 0x0b, 0x2d, 0x68, 0x05, 0xad, 0x1a, 0x1a, 0xd6, 0x35, 0x86, 0x06,
+  0x9a, 0xd3, 0x4b, 0x5a, 0x5a, 0xd0, 0x68, 0x6b, 0x18, 0x63, 0x31, 0x98, 0x63, 0x3b, 0xff, 0xeb,
+  0x03, 0x44, 0xe4, 0xd6, 0xd6, 0xd6, 0xc6, 0xd7, 0x87, 0xac, 0xc6, 0xb0, 0x16, 0xbf, 0xff, 0x8c,
+  0x63, 0x30, 0x00, 0x00, 0xff, 0xfa, 0xcd, 0x63, 0x35, 0xeb, 0x63, 0x33, 0x33, 0x31, 0x99, 0xad,
+  0xac, 0x00, 0x3f, 0xa3, 0x72, 0x70, 0x33, 0x0c, 0x60, 0xc0, 0xd6, 0xb5, 0xa0, 0x84, 0x84, 0x45,
+  0xab, 0x2d, 0x6b, 0x59, 0x66, 0xb0, 0xc1, 0x9a, 0xcc, 0x19, 0xac, 0xd6, 0x32, 0xcd, 0x35, 0xad,
+  0x68, 0x10, 0x59, 0x18, 0x19, 0xb0, 0x6b, 0x06, 0x87, 0xf7, 0x66, 0x63, 0x36, 0xbd, 0xf7, 0xf2,
+  0xb4, 0xb5, 0xa1, 0xac, 0x31, 0xaf, 0x59, 0x86, 0x30, 0x6b, 0x02, 0xc7, 0x7f, 0xff, 0xd0, 0x66,
+  0xb3, 0x19, 0xb3, 0x66, 0x78, 0xdb, 0x19, 0xdf, 0xff, 0xed, 0xd6, 0x69, 0x14, 0xfd, 0xb5, 0xe3,
+  0xd7, 0x9b, 0x33, 0x66, 0xd7, 0x86, 0x60, 0xd6, 0x2c, 0x00, 0x07, 0xfc, 0xc6, 0xcc, 0xd8, 0xc6,
+  0xff, 0xff, 0xe5, 0x0c, 0x63, 0x66, 0x3c, 0x6c, 0xcc, 0xd7, 0xac, 0x6b, 0x00, 0x0e, 0xb5, 0xae,
+  0xee, 0xcb, 0x2c, 0xb1, 0x6b, 0x5a, 0x01, 0x6b, 0x46, 0x86, 0x99, 0x6d, 0x6b, 0x35, 0x83, 0x5a,
+  0x68, 0x13, 0x56, 0xb4, 0x00, 0x35, 0x8c, 0x63, 0x18, 0xda, 0xda, 0xcc, 0xbd, 0xff, 0xfe, 0x8f,
+  0xd9, 0x7a, 0x62, 0xd2, 0xb6, 0x61, 0x99, 0x98, 0xd8, 0xc6, 0x19, 0x62, 0xd3, 0xfb, 0xfb, 0x0d,
+  0xad, 0x80, 0x00, 0x07, 0xfd, 0xc0, 0xcc, 0x33, 0x1b, 0x19, 0x99, 0x98, 0xcc, 0x63, 0x00, 0x0e,
+  0xf8, 0x6e, 0x1d, 0xdc, 0x61, 0x9a, 0xc6, 0xb3, 0x4c, 0xb2, 0xd3, 0x56, 0x84, 0x84, 0x82, 0x0b,
+  0x2c, 0xb1, 0xad, 0x6d, 0x6b, 0x6b, 0x18, 0x61, 0x8d, 0x6d, 0x60, 0xc0, 0x68, 0xd0, 0x5a, 0x25,
+  0x99, 0xa1, 0xbb, 0x1a, 0xc1, 0xa3, 0x5f, 0xdd, 0x87, 0xad, 0x8c, 0xda, 0xff, 0xaa, 0x08, 0x34,
+  0xd6, 0x31, 0x8c, 0x63, 0x5b, 0x58, 0xd6, 0x58, 0x0b, 0xff, 0xfe, 0x93, 0xb1, 0x86, 0x6c, 0x6d,
+  0x99, 0xb6, 0x66, 0xc6, 0xff, 0xff, 0x6d, 0xe0, 0x43, 0x3d, 0x66, 0x66, 0xcc, 0xf1, 0xeb, 0xcc,
+  0xc6, 0xd6, 0xd6, 0x69, 0xac, 0x80, 0x00, 0x3f, 0x8f, 0x5b, 0x33, 0x31, 0xff, 0xf7, 0x0d, 0x6d,
+  0x6c, 0xc6, 0xcd, 0x8d, 0x98, 0xc6, 0x1a, 0xc0, 0x01, 0xcb, 0x79, 0xf8, 0xda, 0xcb, 0x2d, 0x64,
+  0xd0, 0x2c, 0x9a, 0x34, 0x1a, 0xcb, 0x6b, 0x5b, 0x4c, 0x1a, 0x69, 0xa2, 0xd0, 0x5a, 0x16, 0x2c,
+  0x1a, 0xcd, 0x6c, 0x33, 0x18, 0xcd, 0x6d, 0x63, 0xfb, 0xff, 0xb2, 0xf4, 0x32, 0x30, 0xd6, 0x63,
+  0x31, 0x99, 0x98, 0xcd, 0x66, 0xb5, 0xad, 0x0f, 0xff, 0x86, 0x33, 0x00, 0x00, 0x1d, 0xff, 0x58,
+  0x61, 0x98, 0xc6, 0xc6, 0x66, 0x66, 0x33, 0x18, 0xcb, 0x00, 0x7f, 0xf6, 0x33, 0x7b, 0x6b, 0x35,
+  0xb5, 0x9a, 0xcd, 0x61, 0xac, 0x58, 0xb4, 0x11, 0x16, 0xed, 0x2d, 0x5a, 0x6a, 0xc0, 0x1a, 0xc1,
+  0x86, 0x0c, 0x61, 0xaf, 0x4c, 0xd6, 0x0c, 0xb0, 0x68, 0xb2, 0xd2, 0xd2, 0xcc, 0xdc, 0xec, 0x30,
+  0x69, 0xa6, 0xfe, 0xf8, 0xcc, 0xc6, 0xc6, 0x6e, 0xff, 0xe5, 0xbb, 0x5a, 0x01, 0x86, 0x31, 0x8c,
+  0x61, 0x86, 0xb2, 0xc0, 0xbf, 0xff, 0xbe, 0xb0, 0xcd, 0x78, 0xcd, 0xb3, 0x36, 0xcc, 0xcd, 0x9f,
+  0xfd, 0xff, 0xfd, 0x61, 0x08, 0xf0, 0xcd, 0x99, 0xb3, 0x66, 0xcd, 0x8d, 0xaf, 0x58, 0xc3, 0x4d,
+  0x68, 0x00, 0x01, 0x73, 0xd6, 0xcc, 0x6f, 0xfe, 0xf8, 0x6b, 0x19, 0x8d, 0x99, 0x99, 0xb1, 0x98,
+  0x63, 0x58, 0x00, 0x0b, 0xbe, 0x7d, 0xb5, 0xad, 0x6b, 0x2d, 0x34, 0x05, 0xad, 0x34, 0x0d, 0x35,
+  0x86, 0xb1, 0xac, 0x1a, 0x34, 0x13, 0x4b, 0x40, 0xb5, 0xac, 0xb3, 0x58, 0x66, 0x1b, 0x5e, 0xb3,
+  0x18, 0x61, 0xdf, 0xff, 0x2f, 0x43, 0x83, 0x63, 0x35, 0xeb, 0x33, 0x31, 0x99, 0x86, 0x06, 0x81,
+  0xf7, 0xf3, 0x18, 0xc0, 0x00, 0x07, 0xff, 0x56, 0x18, 0x66, 0x33, 0x19, 0xb5, 0xe1, 0xeb, 0x6b,
+  0xd6, 0xd6, 0xd6, 0xb0, 0x0f, 0xf8, 0x63, 0x6f, 0x60, 0x66, 0xb6, 0xb0, 0xc1, 0xac, 0x05, 0x90,
+  0x44, 0x42, 0x41, 0x68, 0x06, 0x99, 0x6d, 0x30, 0xc1, 0x8d, 0x66, 0x0c, 0x18, 0x6b, 0x58, 0x58,
+  0xb4, 0x08, 0xb4, 0x3b, 0x3f, 0x30, 0x35, 0xad, 0x6e, 0xff, 0xec, 0x66, 0x36, 0x63, 0x33, 0xff,
+  0xba, 0x2d, 0x16, 0x1a, 0xcd, 0x6d, 0x6d, 0x7a, 0xc6, 0x35, 0x8d, 0x62, 0xc1, 0xff, 0xf7, 0xfd,
+  0x30, 0xc6, 0x66, 0xc7, 0x99, 0xb6, 0x66, 0x6c, 0x7f, 0xff, 0xb2, 0xeb, 0x10, 0x4e, 0xb3, 0x33,
+  0x66, 0x6d, 0x99, 0xb3, 0x33, 0x18, 0x60, 0xd3, 0x40, 0x00, 0x00, 0x59, 0x8e, 0xff, 0x83, 0x59,
+  0xad, 0x98, 0xd9, 0x99, 0x9b, 0x5b, 0x0c, 0x19, 0x60, 0x00, 0x7f, 0xfe, 0x35, 0xad, 0x69, 0xad,
+  0x34, 0x2c, 0xb4, 0xd0, 0x34, 0xd6, 0x06, 0x1a, 0xc0, 0x34, 0x16, 0x84, 0xd2, 0xd6, 0x9a, 0x6b,
+  0x0d, 0x60, 0x06, 0xda, 0xd8, 0x63, 0x03, 0xff, 0xfa, 0x07, 0xa7, 0x6d, 0x66, 0x33, 0x19, 0x98,
+  0xcc, 0x30, 0x02, 0xd7, 0xdf, 0x66, 0xbd, 0x00, 0x00, 0x1d, 0xff, 0xda, 0xc6, 0xb3, 0x0d, 0xad,
+  0x9a, 0xf1, 0x99, 0x98, 0xcc, 0x61, 0x88, 0x1f, 0x7d, 0x99, 0x7b, 0x63, 0x54, 0xc6, 0xb6, 0xb1,
+  0xac, 0xd6, 0x59, 0xa0, 0xb2, 0x2d, 0xd9, 0x5a, 0x42, 0x16, 0x9a, 0x35, 0xac, 0x1a, 0xc3, 0x06,
+  0x1a, 0xf4, 0xc6, 0x5b, 0x58, 0x1a, 0xcb, 0x5a, 0x68, 0xb4, 0x56, 0xc7, 0xe8, 0x7a, 0xc6, 0xb5,
+  0x96, 0x5f, 0xfc, 0xb3, 0x31, 0xb1, 0xb1, 0x97, 0xff, 0xf6, 0xed, 0x01, 0x66, 0xb1, 0x8c, 0xd7,
+  0xac, 0xd6, 0x60, 0x65, 0x85, 0xbe, 0xff, 0xff, 0xa7, 0x35, 0x8c, 0x66, 0x66, 0xcd, 0x9e, 0xbc,
+  0xcc, 0xd8, 0xff, 0xfe, 0xff, 0xf9, 0xa4, 0x03, 0x9c, 0x6c, 0xcd, 0x9b, 0x36, 0x66, 0xc6, 0xc3,
+  0x1a, 0xc3, 0x41, 0x00, 0x00, 0x00, 0x2f, 0xfe, 0x0d, 0x66, 0xbd, 0x6c, 0x6c, 0xcc, 0xcc, 0xd7,
+  0xad, 0xac, 0x35, 0x80, 0x00, 0xff, 0xff, 0x74, 0xd6, 0x9a, 0xd1, 0xa2, 0xcb, 0x5a, 0x34, 0x34,
+  0xd6, 0x0c, 0xb6, 0xb5, 0x81, 0xa0, 0xb4, 0x2d, 0x16, 0xb4, 0x0d, 0x30, 0x60, 0x01, 0xbc, 0x36,
+  0xb3, 0x58, 0xd7, 0xfd, 0xfc, 0x21, 0xa0, 0x8c, 0xd7, 0xac, 0xcc, 0xc6, 0x36, 0xb1, 0x96, 0x0b,
+  0x47, 0xf4, 0xc6, 0x00, 0x00, 0x3f, 0xfa, 0xb0, 0x63, 0x5e, 0xb3, 0x31, 0xb1, 0x99, 0x98, 0xcc,
+  0x33, 0x58, 0x0f, 0xb8, 0xd6, 0x6d, 0x5d, 0x2d, 0x63, 0x0d, 0x7a, 0x63, 0x58, 0x1a, 0x02, 0xd2,
+  0xd5, 0xab, 0x48, 0x5a, 0xb2, 0xd6, 0xb5, 0x80, 0xd6, 0x35, 0x86, 0x1a, 0xcd, 0x66, 0xb0, 0x60,
+  0x34, 0x68, 0x13, 0x56, 0xad, 0xd1, 0x12, 0x30, 0x65, 0x82, 0xfb, 0xf8, 0xcc, 0xc6, 0xc6, 0xc6,
+  0x6f, 0xff, 0xbe, 0x40, 0xb0, 0x6b, 0x6b, 0x6b, 0xd6, 0x6b, 0xd6, 0x35, 0x9a, 0xd6, 0x2c, 0x7f,
+  0xff, 0xd6, 0x03, 0x18, 0xcc, 0xcd, 0x9b, 0x36, 0x6c, 0xd8, 0xce, 0xff, 0xff, 0x5e, 0x31, 0xf9,
+  0xcd, 0x99, 0xb3, 0x36, 0x7a, 0xf3, 0x33, 0x33, 0x0c, 0xd6, 0x02, 0xc8, 0x00, 0x00, 0x00, 0xff,
+  0xf8, 0x35, 0x98, 0x6c, 0x6c, 0xcc, 0x7a, 0xd8, 0x66, 0xb1, 0xac, 0x00, 0x07, 0xff, 0xf8, 0xe4,
+  0xd3, 0x4d, 0x01, 0x6b, 0x4d, 0x0d, 0x1a, 0xc0, 0xc0, 0xd6, 0x00, 0x16, 0x8b, 0x45, 0xa0, 0x00,
+  0xd6, 0xd0, 0x00, 0x3d, 0x99, 0xad, 0xac, 0x35, 0xdf, 0xff, 0x12, 0x51, 0xb3, 0x59, 0x8c, 0xc6,
+  0x63, 0x6b, 0x30, 0xd6, 0xb2, 0xd0, 0xbb, 0xb3, 0x00, 0x00, 0x1d, 0xff, 0x59, 0x7a, 0x63, 0x5e,
+  0xb3, 0x31, 0xb1, 0x99, 0x98, 0xc6, 0xd6, 0x35, 0x83, 0xbe, 0x35, 0x8d, 0xa7, 0xa0, 0xc3, 0x0c,
+  0x30, 0xd6, 0x1a, 0xd3, 0x40, 0x84, 0x45, 0xbb, 0x45, 0xa1, 0x65, 0x80, 0x6b, 0x0d, 0x61, 0x97,
+  0xad, 0x6d, 0x61, 0xac, 0xd3, 0x00, 0x16, 0x5a, 0x11, 0x72, 0x92, 0x9b, 0x9a, 0xcb, 0x02, 0xff,
+  0xf8, 0x63, 0x63, 0x3d, 0x6c, 0x66, 0xef, 0xff, 0xe4, 0x16, 0xb0, 0xd6, 0xd6, 0xd6, 0xc3, 0x6b,
+  0x18, 0x1a, 0xc5, 0x9f, 0xff, 0xf6, 0x3f, 0xd8, 0x6b, 0x6b, 0x33, 0x33, 0x3c, 0x79, 0x9b, 0x33,
+  0x33, 0x7f, 0xff, 0xaf, 0x7c, 0x1f, 0x9c, 0x33, 0x33, 0x66, 0x78, 0xf5, 0xe6, 0x3d, 0x66, 0x30,
+  0xcb, 0x0b, 0x40, 0x00, 0x00, 0x03, 0xff, 0xe3, 0x4c, 0x61, 0xb1, 0xb3, 0x1b, 0x35, 0xe1, 0x86,
+  0x35, 0xa0, 0x00, 0x7f, 0xff, 0x83, 0xf9, 0x86, 0x1a, 0x8b, 0x2d, 0x34, 0x34, 0xd6, 0x5b, 0x4c,
+  0xbd, 0x35, 0x80, 0x16, 0x9b, 0xb5, 0xab, 0x5a, 0x2c, 0xb2, 0xc3, 0x58, 0x00, 0x06, 0xf3, 0x30,
+  0xc1, 0xad, 0xff, 0xfe, 0xa4, 0x9e, 0x99, 0x86, 0x6b, 0xd6, 0x66, 0x33, 0x18, 0xd6, 0xd3, 0x5a,
+  0x6a, 0xd2, 0xe0, 0x00, 0x00, 0xff, 0xba, 0xc1, 0xac, 0xc6, 0x31, 0xb1, 0x99, 0x99, 0x8c, 0x66,
+  0x0c, 0x1d, 0xf6, 0x98, 0x36, 0x86, 0x6e, 0x0c, 0x6b, 0x6b, 0x0d, 0x66, 0xb5, 0xad, 0x6b, 0x42,
+  0x11, 0x6e, 0xd1, 0x16, 0x80, 0x06, 0xb5, 0x81, 0x97, 0xa6, 0x1a, 0xcd, 0x61, 0xac, 0x69, 0x96,
+  0x2c, 0xb4, 0x08, 0x5d, 0xa7, 0x29, 0x9a, 0xc6, 0x83, 0xff, 0xba, 0xda, 0xda, 0xf1, 0x9b, 0x1b,
+  0x0d, 0xff, 0x7f, 0xf0, 0x5a, 0xcb, 0x35, 0xb5, 0xb5, 0xeb, 0x30, 0xcd, 0x61, 0xad, 0x62, 0xff,
+  0xef, 0xfe, 0xb0, 0x63, 0x5e, 0xb6, 0x66, 0xcd, 0x9b, 0x36, 0x66, 0x63, 0xff, 0xbf, 0xff, 0xd5,
+  0x83, 0xf3, 0x83, 0x63, 0xd7, 0x99, 0xb6, 0x3c, 0x66, 0xd7, 0xac, 0x61, 0xac, 0xb5, 0xa1, 0x00,
+  0x00, 0x00, 0xff, 0xe8, 0xd6, 0x30, 0xd8, 0xd8, 0xd9, 0xaf, 0x1a, 0xf5, 0x9a, 0xcd, 0x30, 0x00,
+  0x3f, 0xff, 0xc1, 0xf5, 0xac, 0xc3, 0x0a, 0xb5, 0xad, 0x34, 0xd3, 0x58, 0x1a, 0xc3, 0x58, 0xb0,
+  0x16, 0x8b, 0x42, 0x04, 0xd6, 0x99, 0x66, 0x80, 0x00, 0x1f, 0x9b, 0x59, 0x96, 0xd3, 0x15, 0x14,
+  0xac, 0x63, 0x19, 0x8c, 0x6d, 0x6d, 0x6d, 0x60, 0x68, 0x2d, 0x5a, 0x00, 0x00, 0x1f, 0xff, 0x59,
+  0x66, 0xb1, 0x86, 0xd6, 0xc6, 0xd7, 0xaf, 0x5e, 0xb6, 0x31, 0x9a, 0xda, 0xd6, 0x5f, 0xfc, 0x65,
+  0xb5, 0xac, 0xec, 0xbd, 0x7a, 0x66, 0xb1, 0x83, 0x06, 0xb1, 0x62, 0xd0, 0x44, 0x5b, 0xb4, 0x41,
+  0x68, 0x68, 0xd6, 0xb2, 0xda, 0x65, 0xe9, 0x83, 0x59, 0xac, 0x35, 0x83, 0x5a, 0x6b, 0x4d, 0x59,
+  0x6a, 0xcb, 0xe5, 0x35, 0x8d, 0x61, 0xa6, 0xb7, 0xdf, 0xff, 0x19, 0x8c, 0xcc, 0xd8, 0xda, 0xf5,
+  0x9f, 0xff, 0xfa, 0x71, 0x69, 0x96, 0x6b, 0x31, 0x9a, 0xf5, 0xb5, 0x8c, 0x0d, 0x65, 0xbf, 0xbf,
+  0xff, 0xec, 0xb5, 0x83, 0x0c, 0xcc, 0x78, 0xdb, 0x36, 0x6c, 0xcc, 0xc3, 0xff, 0xfd, 0x5b, 0x0f,
+  0xcd, 0xf6, 0x33, 0x6d, 0x79, 0xb3, 0x66, 0x66, 0x36, 0xb3, 0x59, 0xa6, 0xb4, 0x16, 0xe0, 0x00,
+  0x00, 0x3f, 0xfa, 0xd3, 0x06, 0xd6, 0xc6, 0xc6, 0xc6, 0x66, 0xbd, 0x63, 0x5b, 0x4c, 0x00, 0x0f,
+  0xff, 0xf0, 0x77, 0x30, 0xc6, 0xb6, 0xb5, 0xd6, 0xb4, 0xd6, 0x9a, 0xc0, 0xd6, 0x06, 0xb0, 0xb0,
+  0xb4, 0x26, 0xed, 0x6a, 0xc8, 0xd0, 0x6b, 0x00, 0x00, 0x03, 0xdb, 0x61, 0xac, 0xd3, 0x2a, 0x2b,
+  0xff, 0xd6, 0xd6, 0x33, 0x18, 0xcc, 0x66, 0xb6, 0xb2, 0xda, 0x16, 0x44, 0x00, 0x00, 0x3b, 0xff,
+  0xb2, 0xc6, 0xb1, 0x86, 0xd6, 0xc6, 0x66, 0x66, 0x33, 0x19, 0xac, 0xd6, 0x3f, 0xbf, 0xff, 0xfd,
+  0x35, 0x83, 0x19, 0x79, 0x36, 0xd6, 0x18, 0x6b, 0x6b, 0x0c, 0xb0, 0x05, 0xa1, 0x10, 0x88, 0xb4,
+  0x5a, 0xd3, 0x5a, 0xd6, 0x03, 0x58, 0x6b, 0x06, 0x0c, 0x0d, 0x60, 0x1a, 0x0b, 0x5a, 0x26, 0xc0,
+  0x59, 0x5e, 0xc1, 0xad, 0x6b, 0x7f, 0xff, 0x71, 0x8c, 0xcc, 0xda, 0xf1, 0xb5, 0xb1, 0xfd, 0xff,
+  0xf2, 0xd6, 0x9a, 0xcd, 0x66, 0x31, 0xb5, 0x98, 0x60, 0x6b, 0x5b, 0xbf, 0xff, 0xee, 0x2c, 0xb0,
+  0xc3, 0x33, 0x1e, 0x36, 0xcd, 0x99, 0xb3, 0x31, 0xbf, 0xff, 0xd5, 0xff, 0x87, 0xe6, 0xfb, 0x5e,
+  0xbc, 0x6d, 0x99, 0xb6, 0x36, 0x36, 0xbd, 0x61, 0x81, 0xa0, 0x84, 0x00, 0x00, 0x0f, 0xfb, 0x8c,
+  0xb6, 0xb6, 0xb6, 0x36, 0x33, 0x6b, 0xd6, 0xd6, 0xd6, 0xd6, 0x0c, 0x00, 0x0f, 0xff, 0xf0, 0x77,
+  0x30, 0xc6, 0xb3, 0x2c, 0xf9, 0x6b, 0x4d, 0x62, 0xcd, 0x6b, 0x03, 0x58, 0xb1, 0x64, 0x2d, 0x2d,
+  0x16, 0x82, 0xc0, 0xd6, 0x00, 0x00, 0x0d, 0xf8, 0xcd, 0x63, 0x44, 0xe5, 0x47, 0xff, 0xf5, 0xeb,
+  0x1a, 0xf0, 0xcc, 0x63, 0x35, 0x9a, 0xc1, 0x62, 0x08, 0x00, 0x00, 0xfe, 0xfa, 0xc0, 0xc1, 0x98,
+  0xc6, 0x66, 0x63, 0xd6, 0x6d, 0x6d, 0x6d, 0x63, 0x2d, 0xff, 0x7f, 0xfc, 0xb3, 0x5a, 0xdb, 0x27,
+  0x1e, 0xf4, 0xc6, 0xb6, 0xb5, 0xeb, 0x5b, 0x59, 0x6d, 0x0d, 0x16, 0xb4, 0x00, 0x1c, 0xb4, 0x16,
+  0x59, 0x60, 0x0d, 0x60, 0xcb, 0x35, 0x83, 0x58, 0xd6, 0xb2, 0xc1, 0x65, 0xa1, 0x68, 0xc4, 0x5f,
+  0x65, 0x0d, 0x62, 0xdf, 0x7f, 0xfd, 0x6d, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x1f, 0xff, 0xfb, 0xfd,
+  0x69, 0xa6, 0x1a, 0xf5, 0x99, 0x86, 0xd6, 0x30, 0x34, 0xd7, 0xff, 0xfd, 0xf7, 0x4d, 0x61, 0x86,
+  0x66, 0x66, 0x7a, 0xf3, 0x66, 0x6c, 0xcc, 0x3f, 0xfb, 0xff, 0xfd, 0x3c, 0x7e, 0x6f, 0x99, 0x9b,
+  0x1e, 0x66, 0xcc, 0xcd, 0xaf, 0x59, 0xad, 0xac, 0x05, 0x96, 0x90, 0x00, 0x00, 0x1f, 0xf7, 0x6b,
+  0x59, 0xad, 0xad, 0x8d, 0x8c, 0xcc, 0xc3, 0x6b, 0x35, 0x86, 0x00, 0x07, 0xff, 0xf8, 0x2f, 0x8c,
+  0x63, 0x59, 0xac, 0x6b, 0xe5, 0xac, 0xb0, 0x1a, 0xcb, 0x69, 0xad, 0x62, 0xc9, 0xab, 0x41, 0x2d,
+  0x02, 0xd6, 0xb0, 0x30, 0x00, 0x00, 0x3f, 0xcc, 0x6b, 0x34, 0x48, 0x4e, 0xd7, 0xff, 0x7d, 0xeb,
+  0x35, 0xeb, 0x31, 0x8c, 0xd7, 0xac, 0x35, 0x96, 0x5a, 0xd2, 0x60, 0x00, 0x07, 0xff, 0x4b, 0x1a,
+  0xd6, 0xd6, 0x6b, 0xd6, 0x6d, 0x6c, 0xc6, 0xc6, 0x36, 0xb3, 0x0d, 0x67, 0xff, 0x7f, 0xf0, 0x30,
+  0x63, 0xe2, 0x8c, 0x35, 0x98, 0x30, 0xc0, 0x6b, 0x5a, 0x00, 0x00, 0x02, 0xed, 0x16, 0x05, 0x9a,
+  0x35, 0x96, 0x6b, 0x58, 0xd6, 0x0d, 0x60, 0xd3, 0x59, 0x69, 0xa1, 0x68, 0x31, 0xd9, 0x5a, 0xda,
+  0xcb, 0x07, 0xff, 0xf7, 0xd8, 0x66, 0x36, 0x66, 0x66, 0x66, 0xb2, 0xff, 0xff, 0xe3, 0xd3, 0x46,
+  0x0c, 0xc6, 0x33, 0x1a, 0xf4, 0xc1, 0xa6, 0xff, 0xff, 0xc4, 0xfe, 0xb4, 0xc0, 0xcc, 0x63, 0x66,
+  0xcd, 0x99, 0xb6, 0x36, 0x6b, 0xd5, 0xff, 0xfe, 0x9f, 0x8f, 0xce, 0x2f, 0x5b, 0x33, 0x66, 0xcd,
+  0x8f, 0x5e, 0xb6, 0x31, 0x83, 0x2c, 0x5a, 0xd2, 0xd5, 0xa0, 0x00, 0x03, 0xfb, 0xe6, 0xb0, 0xcd,
+  0x6c, 0xd7, 0x8c, 0xcc, 0x66, 0xbd, 0x63, 0x59, 0xac, 0x00, 0x1f, 0xff, 0xe0, 0xbe, 0x6b, 0x6b,
+  0x18, 0x60, 0xc7, 0xf2, 0xc5, 0x8d, 0x35, 0x81, 0xad, 0x6b, 0x2d, 0x68, 0xb4, 0x41, 0x0b, 0x4d,
+  0x1a, 0xd6, 0x68, 0x00, 0x00, 0x1f, 0xe6, 0x30, 0x10, 0x52, 0x2d, 0x7f, 0x7f, 0x65, 0xeb, 0x6b,
+  0x33, 0x5e, 0xb3, 0x0c, 0x35, 0xad, 0x64, 0x10, 0x00, 0x01, 0xff, 0xf2, 0xc3, 0x58, 0x33, 0x5e,
+  0xb3, 0x31, 0xb1, 0x99, 0x9a, 0xf5, 0x98, 0x35, 0xbf, 0xfb, 0xff, 0x86, 0x59, 0xac, 0x5c, 0x33,
+  0x59, 0xac, 0x61, 0xad, 0xac, 0x1a, 0xcb, 0x2d, 0x00, 0x00, 0x00, 0x3e, 0x01, 0xa1, 0xa6, 0x58,
+  0x6b, 0x2d, 0xad, 0x61, 0xac, 0xb1, 0xa3, 0x40, 0x5a, 0x0b, 0x65, 0xb6, 0x39, 0x6b, 0x00, 0xef,
+  0xff, 0xfb, 0x86, 0xb3, 0x31, 0xb1, 0xb3, 0x33, 0x18, 0x7f, 0xf7, 0xff, 0x68, 0x6b, 0x0c, 0xd7,
+  0xad, 0x86, 0xd6, 0x32, 0xcd, 0x1f, 0xdf, 0xff, 0xf8, 0x3a, 0xd3, 0x59, 0xac, 0xd7, 0xaf, 0x5b,
+  0x6b, 0xcd, 0x99, 0xb3, 0x66, 0x31, 0xbf, 0xff, 0xd4, 0x3e, 0x3f, 0x38, 0x1b, 0x33, 0x66, 0x7a,
+  0xf1, 0xb3, 0x18, 0xcd, 0x63, 0x5a, 0xd6, 0x82, 0x12, 0x00, 0x00, 0x7f, 0x74, 0xc1, 0x9a, 0xf5,
+  0xb1, 0x99, 0x8d, 0xad, 0x86, 0x18, 0x68, 0x00, 0x3f, 0xff, 0xc0, 0xff, 0xbd, 0x61, 0x8c, 0x30,
+  0x61, 0xbf, 0xe0, 0x0d, 0x6b, 0x03, 0x5a, 0xd6, 0xb5, 0xa2, 0xd1, 0x6a, 0xd0, 0xb4, 0x00, 0x61,
+  0x80, 0x00, 0x01, 0xfe, 0x66, 0xb0, 0x3b, 0x42, 0x9a, 0xbf, 0xfe, 0xc3, 0x18, 0xcc, 0x63, 0x5e,
+  0xb0, 0x6b, 0x5a, 0x69, 0x68, 0x00, 0x02, 0xff, 0xe5, 0x8d, 0x6b, 0x18, 0x63, 0x31, 0xb5, 0xe3,
+  0x31, 0xb0, 0xcd, 0x66, 0xb3, 0xff, 0xef, 0xf9, 0xac, 0x1a, 0xc3, 0xc1, 0x6b, 0x1a, 0xcd, 0x63,
+  0x0c, 0x1a, 0xc0, 0x58, 0x00, 0x00, 0x00, 0x17, 0x34, 0x69, 0xac, 0xb0, 0xd6, 0xb0, 0x65, 0x8d,
+  0x6b, 0x2c, 0x05, 0x96, 0x82, 0xd3, 0x39, 0xcd, 0xea, 0xc0, 0xd3, 0xff, 0xef, 0xe3, 0x0d, 0x8c,
+  0xd8, 0xf5, 0xb3, 0x18, 0x3f, 0xff, 0xfc, 0x10, 0x6b, 0x19, 0xaf, 0x5b, 0x0c, 0xc3, 0x58, 0x17,
+  0xff, 0xfe, 0x46, 0x9a, 0x65, 0xb5, 0x98, 0xcc, 0xcc, 0xf1, 0xb6, 0x3c, 0x6c, 0x36, 0xbf, 0xff,
+  0xd4, 0x3f, 0xf9, 0x00, 0xe3, 0x31, 0xb3, 0x66, 0x6c, 0xd8, 0xda, 0xf5, 0x98, 0x60, 0x68, 0xd5,
+  0xad, 0x5a, 0xb5, 0x00, 0x00, 0xfb, 0xfb, 0x58, 0x6b, 0x63, 0x19, 0x99, 0x8c, 0xc6, 0x30, 0xc1,
+  0x80, 0x03, 0xff, 0xfc, 0x0f, 0xe3, 0x0c, 0x61, 0x83, 0x0c, 0x7f, 0xc3, 0x4d, 0x60, 0x0d, 0x35,
+  0xad, 0x02, 0x2d, 0x20, 0x80, 0xb5, 0x83, 0x5b, 0x00, 0x00, 0x01, 0xfe, 0xd7, 0xad, 0x61, 0xb1,
+  0xe3, 0x4d, 0x7f, 0xfd, 0x6d, 0x66, 0xbd, 0x66, 0x31, 0x8d, 0x63, 0x4d, 0x68, 0x16, 0x00, 0x01,
+  0xdf, 0xf0, 0x1a, 0xc3, 0x5b, 0x5b, 0x5b, 0x19, 0x98, 0xf5, 0xb1, 0x8c, 0x61, 0xad, 0xff, 0xf7,
+  0xf5, 0xac, 0xd3, 0x30, 0xb0, 0x1a, 0xc6, 0x5e, 0xb5, 0xeb, 0x0c, 0x35, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xed, 0x6b, 0x58, 0x06, 0xb0, 0x19, 0x63, 0x4d, 0x65, 0xac, 0x9a, 0x09, 0xa5, 0xa6,
+  0xf7, 0x03, 0x86, 0x9a, 0x7f, 0xff, 0xe2, 0x61, 0x9a, 0xf1, 0x99, 0xb3, 0x1b, 0x1a, 0xcd, 0xff,
+  0x7f, 0xfd, 0x03, 0x0c, 0x63, 0x61, 0x98, 0x32, 0xc6, 0xff, 0xff, 0xcf, 0x4d, 0x35, 0x86, 0xbd,
+  0x6d, 0x7a, 0xf5, 0xe3, 0xc6, 0xd8, 0xf5, 0xe3, 0x35, 0xb7, 0xff, 0xdf, 0xff, 0xe9, 0x08, 0x07,
+  0x36, 0xcc, 0x78, 0xdb, 0x1b, 0x63, 0x31, 0x8c, 0x30, 0x02, 0xd6, 0xad, 0x21, 0x00, 0x01, 0xdf,
+  0xf6, 0xb0, 0xc3, 0x33, 0x5e, 0x1e, 0xb3, 0x31, 0x86, 0x32, 0xf4, 0x00, 0x0f, 0xff, 0xf0, 0x3f,
+  0x8c, 0x31, 0x86, 0x0c, 0x6b, 0x1b, 0xff, 0xb4, 0xcb, 0x00, 0x69, 0xad, 0x34, 0xb4, 0x21, 0x08,
+  0x5a, 0xd3, 0x5a, 0xc3, 0x00, 0x00, 0x00, 0x7f, 0xb1, 0xac, 0x30, 0x36, 0x69, 0xad, 0xff, 0xf4,
+  0x63, 0x18, 0xc6, 0x31, 0xac, 0x69, 0xad, 0x02, 0x00, 0x01, 0xdf, 0xf0, 0x1a, 0xc3, 0x5b, 0x59,
+  0x8c, 0xc6, 0xc6, 0xc6, 0x6b, 0xd6, 0xd6, 0x35, 0xbf, 0xfb, 0xff, 0xb0, 0x6b, 0x5b, 0x02, 0xfe,
+  0x63, 0x58, 0x63, 0x5e, 0x98, 0xd6, 0xe6, 0x35, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2c, 0x1a,
+  0x65, 0x8d, 0x32, 0xc1, 0xa6, 0x8d, 0x05, 0xa0, 0xb6, 0xbc, 0x1c, 0x4e, 0x69, 0xad, 0x7f, 0xdf,
+  0xfd, 0x63, 0x19, 0x99, 0x99, 0xb3, 0x19, 0xac, 0x2f, 0xf8, 0x1a, 0xda, 0xcc, 0xc6, 0x33, 0x06,
+  0xb0, 0xff, 0xfe, 0xff, 0xb4, 0x69, 0x96, 0xd6, 0xd6, 0xd7, 0x8c, 0xd9, 0xb3, 0x36, 0x66, 0x63,
+  0x1d, 0xff, 0xfe, 0x90, 0x82, 0x73, 0x8d, 0x99, 0xb3, 0x36, 0x66, 0x63, 0x31, 0xac, 0xd6, 0x58,
+  0xb2, 0x16, 0xad, 0x5a, 0x80, 0x01, 0x7f, 0xf6, 0x59, 0xac, 0xc6, 0x33, 0x33, 0x5e, 0xbd, 0x63,
+  0x35, 0xb5, 0x80, 0x00, 0x3f, 0xff, 0xc0, 0xfe, 0x6b, 0x19, 0xac, 0x61, 0xac, 0xd6, 0x6b, 0x3f,
+  0xe5, 0x96, 0x0d, 0x1a, 0x68, 0x08, 0x5a, 0x9b, 0xb4, 0x2d, 0x00, 0xd6, 0x18, 0x00, 0x00, 0x03,
+  0xff, 0x06, 0x15, 0x98, 0x9a, 0x69, 0xfd, 0xf3, 0x5b, 0x5b, 0x0c, 0xd7, 0xac, 0x6b, 0x1a, 0x6b,
+  0x41, 0x60, 0x00, 0x3e, 0xfe, 0x68, 0xd6, 0x5e, 0x98, 0x66, 0xbd, 0x6c, 0x66, 0x66, 0x63, 0x31,
+  0xad, 0xad, 0x7f, 0x7f, 0xf5, 0xe8, 0xd6, 0x2f, 0xef, 0xad, 0x6d, 0x6b, 0x6b, 0x1a, 0xf5, 0xaf,
+  0x55, 0xaf, 0x58, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb4, 0xd6, 0x06, 0xb5, 0x96, 0x00,
+  0x2d, 0x68, 0xb5, 0xad, 0xc8, 0xb9, 0x21, 0x96, 0x5f, 0xff, 0xfa, 0x5c, 0xc6, 0xbd, 0x6c, 0xc7,
+  0x8c, 0xd8, 0xc6, 0x03, 0xbe, 0x0c, 0x63, 0x19, 0x9a, 0xf5, 0x86, 0xb2, 0xfe, 0xff, 0xfa, 0xd1,
+  0xa6, 0xb3, 0x5b, 0x5e, 0xb3, 0x63, 0x66, 0xcc, 0xd9, 0x98, 0xcc, 0xb7, 0xff, 0xfa, 0x4a, 0x09,
+  0xce, 0x66, 0x66, 0xcc, 0xcf, 0x5e, 0xb6, 0x33, 0x5b, 0x58, 0x6b, 0x5a, 0xd0, 0x22, 0x12, 0x15,
+  0xa0, 0x4f, 0xbe, 0xc1, 0x8c, 0x63, 0x33, 0x19, 0x8c, 0x66, 0xb3, 0x58, 0xf9, 0x60, 0x07, 0xff,
+  0xf8, 0x1f, 0xcd, 0x66, 0xb6, 0xb1, 0x86, 0x0c, 0x30, 0x7f, 0x4b, 0x0d, 0x0d, 0x1a, 0x2c, 0x88,
+  0x5b, 0xb4, 0x20, 0x2c, 0x0c, 0x30, 0x00, 0x00, 0x0d, 0xfe, 0xbd, 0x31, 0x31, 0x60, 0xd3, 0x5b,
+  0xfe, 0xf9, 0xaf, 0x58, 0xcc, 0x61, 0x9a, 0xc3, 0x4d, 0x68, 0x20, 0x00, 0x3e, 0xfe, 0xd3, 0x4c,
+  0xb1, 0xac, 0xd6, 0x66, 0xbd, 0x7a, 0xd9, 0x8d, 0x8c, 0x66, 0xb6, 0xb5, 0xf7, 0xff, 0xc6, 0xb5,
+  0x85, 0xf5, 0xed, 0x86, 0xb1, 0x86, 0x18, 0xf9, 0x98, 0xc6, 0xb3, 0x4c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x34, 0xd6, 0xb2, 0xcb, 0x5a, 0xd0, 0x5a, 0x1c, 0x12, 0x73, 0x5a, 0xd6, 0x2e,
+  0xff, 0xff, 0xd6, 0xda, 0xc6, 0x63, 0x63, 0xd7, 0x8c, 0xda, 0xda, 0xc0, 0x3e, 0xe6, 0xb3, 0x0d,
+  0x8c, 0x63, 0x06, 0x57, 0xff, 0xfe, 0xe6, 0xb4, 0xd3, 0x58, 0x63, 0x31, 0xb3, 0x33, 0x3d, 0x78,
+  0xd9, 0x8c, 0x6b, 0x7f, 0xff, 0xa4, 0xa0, 0x9d, 0x5e, 0xbd, 0x78, 0xd9, 0x9b, 0x1e, 0xb6, 0x30,
+  0xcd, 0x60, 0x68, 0xdd, 0x88, 0xb5, 0x6a, 0xd2, 0x22, 0x16, 0xaf, 0xeb, 0x6b, 0x18, 0xc6, 0x66,
+  0x33, 0x18, 0x6d, 0x63, 0x3b, 0x8d, 0x6b, 0x01, 0xff, 0xfe, 0x07, 0xf3, 0x59, 0xad, 0xac, 0xd6,
+  0x6b, 0x35, 0x86, 0x0c, 0x38, 0x1a, 0x0d, 0x16, 0xb4, 0xb5, 0x69, 0x69, 0x69, 0x65, 0xad, 0x6b,
+  0x35, 0x8c, 0x00, 0x00, 0x03, 0xdf, 0x86, 0x21, 0x27, 0x1a, 0x6b, 0x5f, 0xdf, 0x6b, 0x31, 0xaf,
+  0x5e, 0xb1, 0x86, 0x0d, 0x35, 0xa0, 0x00, 0x03, 0xef, 0xad, 0x35, 0x96, 0x35, 0x8d, 0x7a, 0xcc,
+  0x6c, 0x6d, 0x78, 0xc6, 0xd6, 0xd6, 0x6b, 0x77, 0xff, 0xfe, 0xb3, 0x5a, 0xc1, 0x7d, 0x79, 0x81,
+  0x86, 0x18, 0xd6, 0xfe, 0xc6, 0xd7, 0xac, 0x61, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0xb4, 0x2d, 0xcb, 0x39, 0x47, 0xac, 0x17, 0xff, 0xf7, 0xf0, 0xc6, 0x36, 0x36,
+  0x3d, 0x78, 0xcd, 0x7a, 0xc8, 0x07, 0xf2, 0xcd, 0x7a, 0xcc, 0xc6, 0x30, 0x6b, 0x7f, 0xff, 0xf2,
+  0x2d, 0x68, 0xd6, 0x5e, 0xb1, 0xb5, 0xb3, 0x33, 0x36, 0x66, 0xc6, 0xc3, 0x35, 0xbf, 0xff, 0xd2,
+  0x50, 0x4e, 0x8c, 0xd8, 0xd9, 0x9b, 0x33, 0x19, 0xad, 0x97, 0xa6, 0x00, 0x5a, 0x6e, 0xd0, 0x96,
+  0xad, 0x5a, 0xb4, 0x4d, 0xdb, 0xee, 0xd6, 0x31, 0x98, 0xc6, 0x66, 0x19, 0x8d, 0x63, 0xe0, 0xd6,
+  0xb5, 0x83, 0xff, 0xfc, 0x0f, 0xe6, 0xb3, 0x5b, 0x59, 0x83, 0x0c, 0x18, 0x30, 0x01, 0x40, 0x2d,
+  0x08, 0x44, 0x5a, 0x5a, 0xd0, 0xd3, 0x06, 0x68, 0x00, 0x00, 0x07, 0xef, 0x01, 0xd2, 0x30, 0x6b,
+  0x59, 0xff, 0xf5, 0xad, 0xad, 0xad, 0x86, 0x61, 0xad, 0xa6, 0xb5, 0xad, 0x00, 0x00, 0x77, 0xfd,
+  0xad, 0x65, 0x80, 0xc3, 0x18, 0xcc, 0xcc, 0xcc, 0x6c, 0x36, 0xb1, 0xad, 0xff, 0xff, 0xa8, 0xb2,
+  0xc6, 0xaf, 0x6f, 0x0b, 0xd3, 0x1a, 0xcd, 0x6d, 0x6f, 0xfb, 0x33, 0x31, 0x8c, 0x1a, 0xc8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x56, 0x4e, 0xaa, 0x5a, 0xdb, 0x03, 0xbf,
+  0xff, 0xf9, 0x6c, 0xd6, 0x63, 0x33, 0x63, 0xd7, 0xaf, 0x5b, 0x0d, 0x60, 0x07, 0xf1, 0xad, 0x8c,
+  0xc3, 0x6b, 0x06, 0xff, 0xff, 0xec, 0xf9, 0x69, 0xa6, 0xb0, 0x66, 0x33, 0x33, 0x36, 0x66, 0x66,
+  0xc6, 0x30, 0x7f, 0xff, 0x21, 0x1d, 0x6c, 0x6c, 0x6d, 0x8d, 0x98, 0xda, 0xd8, 0x30, 0xd6, 0x2c,
+  0xb5, 0xa2, 0xd2, 0xd2, 0x12, 0xd5, 0xa2, 0xd0, 0xbe, 0x5e, 0xb1, 0x8d, 0xad, 0x8c, 0x63, 0x30,
+  0xcf, 0xed, 0x63, 0x46, 0xb2, 0xc7, 0xff, 0xf8, 0x1f, 0xcd, 0x66, 0xb6, 0x5e, 0xb1, 0xad, 0xac,
+  0x18, 0x00, 0x00, 0x0e, 0x21, 0x08, 0x49, 0xbb, 0x5a, 0x00, 0x6b, 0x30, 0xc0, 0x00, 0x00, 0x3f,
+  0xf5, 0xb0, 0xc8, 0xfa, 0xf4, 0xd6, 0xb2, 0xff, 0xf8, 0xc6, 0x63, 0x18, 0xc3, 0x0d, 0x6b, 0x2c,
+  0x80, 0x00, 0x5f, 0xfd, 0xac, 0xb2, 0xc1, 0xac, 0x6b, 0x63, 0x1b, 0x19, 0xb1, 0x98, 0xcd, 0x6d,
+  0x67, 0xff, 0xdf, 0xd8, 0x06, 0xbd, 0xbc, 0x06, 0xb6, 0xb0, 0xc6, 0xff, 0x99, 0x8d, 0xaf, 0x59,
+  0x83, 0x2c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xae, 0xfa, 0xfb,
+  0x6c, 0x07, 0xff, 0xdf, 0xff, 0x60, 0xcc, 0x66, 0x66, 0xc7, 0xad, 0x8c, 0xd6, 0x00, 0x0f, 0x96,
+  0xc6, 0x33, 0x0c, 0x1f, 0xf7, 0xff, 0x16, 0xb4, 0xd6, 0xb1, 0x8c, 0x6c, 0x66, 0xc6, 0xcd, 0xaf,
+  0x19, 0x86, 0x1f, 0xff, 0xc8, 0x47, 0x5e, 0xb6, 0x66, 0x66, 0xcc, 0xc6, 0xd6, 0xd6, 0x30, 0x35,
+  0xad, 0x68, 0x10, 0x84, 0x5b, 0xb4, 0x5a, 0xb5, 0xa2, 0xd7, 0xcc, 0x31, 0xb5, 0xb0, 0xda, 0xd8,
+  0x63, 0xed, 0x6b, 0x03, 0x4d, 0x6b, 0x5f, 0xdf, 0xe0, 0x7f, 0x18, 0xd7, 0xac, 0x6b, 0x6b, 0x18,
+  0x18, 0x00, 0x00, 0x00, 0x75, 0x11, 0x6a, 0xd2, 0xd0, 0xb2, 0xc0, 0xc6, 0xbd, 0x00, 0x00, 0x00,
+  0xf7, 0xb0, 0x58, 0x6f, 0x06, 0xb2, 0xcf, 0xfb, 0xed, 0x66, 0x31, 0x98, 0x66, 0xb3, 0x5a, 0xc2,
+  0xc0, 0x00, 0x0f, 0xff, 0xb2, 0xc5, 0x80, 0xd6, 0x31, 0x8c, 0xcc, 0xc7, 0xad, 0x9a, 0xf5, 0xb2,
+  0xf5, 0x9f, 0x7f, 0xfd, 0x66, 0x8d, 0x5f, 0x5e, 0x61, 0xac, 0x6b, 0x6b, 0x1d, 0xf6, 0x66, 0x66,
+  0x6b, 0xd6, 0x19, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe7, 0xad,
+  0xce, 0x06, 0x06, 0xff, 0xff, 0xf4, 0x98, 0xd6, 0xd7, 0xaf, 0x5e, 0xbc, 0x6c, 0x6c, 0x61, 0x80,
+  0x00, 0xbb, 0x5e, 0xb6, 0xbd, 0x63, 0x0f, 0xbf, 0xff, 0xb7, 0x65, 0xa6, 0xb5, 0x8d, 0x6d, 0x7a,
+  0xd8, 0xd8, 0xf5, 0xb6, 0xbc, 0x66, 0x31, 0xac, 0xff, 0xfe, 0x42, 0x3b, 0x66, 0x66, 0xc6, 0xcc,
+  0xcc, 0x6b, 0xd6, 0x35, 0x81, 0xa1, 0xbb, 0x2d, 0x10, 0xb5, 0x69, 0x04, 0x5a, 0x02, 0x70, 0xcc,
+  0x63, 0x1b, 0x5b, 0x5b, 0x5c, 0x35, 0xac, 0x0d, 0x1a, 0x6f, 0x7f, 0x9d, 0x07, 0xf1, 0x8d, 0x7a,
+  0xc6, 0x18, 0x60, 0xd6, 0x30, 0x00, 0x00, 0x01, 0x7d, 0x11, 0x0b, 0x56, 0x5a, 0x6b, 0x06, 0x30,
+  0x00, 0x00, 0x01, 0xfe, 0x61, 0x21, 0x8b, 0x1a, 0xd6, 0x17, 0xff, 0xc6, 0x33, 0x5e, 0xb6, 0xb6,
+  0x18, 0x6b, 0x00, 0x00, 0x00, 0xff, 0xbb, 0x0b, 0x00, 0x6b, 0x35, 0xb5, 0xeb, 0x36, 0x33, 0x63,
+  0x33, 0x1a, 0xf5, 0x8f, 0xff, 0xfc, 0xf8, 0xd3, 0x5a, 0xfa, 0xf4, 0x18, 0x6b, 0x6b, 0x2f, 0xe6,
+  0x36, 0x36, 0x31, 0x8d, 0x61, 0x60, 0x0e, 0x1a, 0xf5, 0x8c, 0xb3, 0x4c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xfa, 0xc2, 0xca, 0x1a, 0x5f, 0xff, 0x6b, 0x5b, 0x5b, 0x0f, 0x5b, 0x36, 0xbc,
+  0xc6, 0x6b, 0xd0, 0x00, 0x00, 0xec, 0x63, 0x18, 0x7d, 0xff, 0xc1, 0x69, 0xad, 0x66, 0xb1, 0xb5,
+  0xeb, 0x66, 0x66, 0x66, 0xd7, 0xaf, 0x59, 0x83, 0x5f, 0xff, 0x21, 0x1d, 0xb6, 0x36, 0x36, 0xd7,
+  0xaf, 0x0d, 0xac, 0xd6, 0x35, 0x80, 0x0b, 0x4d, 0xd9, 0x16, 0x90, 0x45, 0xab, 0x20, 0x16, 0x7d,
+  0x86, 0xd6, 0xd6, 0xc6, 0xbd, 0x2b, 0x0d, 0x32, 0xc0, 0xd0, 0xde, 0x3e, 0x60, 0xbf, 0xe6, 0x1a,
+  0xf5, 0x9a, 0xda, 0xc3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe9, 0x6e, 0xc8, 0xb4, 0xd1, 0xad,
+  0x66, 0xb6, 0xb3, 0x00, 0x00, 0x01, 0xef, 0x61, 0x01, 0x5d, 0x66, 0xb5, 0x83, 0xff, 0xb9, 0xaf,
+  0x59, 0x8c, 0xc6, 0x30, 0xc0, 0x34, 0x00, 0x01, 0xfd, 0xc1, 0x60, 0x06, 0xb3, 0x0c, 0xcc, 0xc6,
+  0xcc, 0xc6, 0xc3, 0x35, 0xb7, 0xfd, 0xff, 0xcd, 0x35, 0xab, 0xfb, 0xe0, 0x61, 0xaf, 0x4d, 0xbf,
+  0xf9, 0x6d, 0xaf, 0x5e, 0x31, 0xb5, 0x9a, 0xc0, 0x07, 0x76, 0x30, 0xda, 0xc6, 0xb0, 0x6b, 0x58,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0xd4, 0xda, 0x63, 0xbf, 0xb5, 0x8c, 0x63, 0xd6,
+  0xcc, 0xda, 0xf1, 0x9a, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xfc, 0x16, 0xb5, 0xac, 0x31, 0x8d,
+  0xaf, 0x19, 0x99, 0xb1, 0x98, 0xc6, 0x07, 0xff, 0xfa, 0x42, 0x09, 0xdd, 0xeb, 0x66, 0x66, 0xc6,
+  0xd7, 0xac, 0xc3, 0x03, 0x2c, 0x59, 0x6b, 0x45, 0xa1, 0x04, 0xb4, 0x5a, 0x2d, 0x00, 0xb0, 0xe6,
+  0xd6, 0x66, 0xbd, 0x13, 0x58, 0x1a, 0xd6, 0x16, 0x34, 0x75, 0xf6, 0xd8, 0x5b, 0xfe, 0xb3, 0x5b,
+  0x59, 0x86, 0x0c, 0x35, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xb5, 0xfc, 0x41, 0x68, 0x06, 0xb0, 0xc6,
+  0x68, 0x00, 0x00, 0x0f, 0xf6, 0x0e, 0x13, 0x60, 0xc0, 0x7f, 0x7f, 0xdb, 0x5b, 0x5b, 0x19, 0xaf,
+  0x5b, 0x59, 0xac, 0x6b, 0x4d, 0x60, 0x00, 0x3b, 0xf8, 0x0b, 0x00, 0x6b, 0x6b, 0x31, 0x99, 0x9b,
+  0x19, 0xb0, 0xf5, 0x8c, 0x3f, 0xfe, 0xf9, 0xad, 0x6b, 0x02, 0xfc, 0x35, 0x9a, 0xc6, 0x5f, 0xfd,
+  0xb1, 0xb1, 0xb3, 0x19, 0x86, 0x00, 0x77, 0xff, 0x63, 0x5e, 0xb6, 0xb3, 0x5b, 0x5a, 0xc3, 0x59,
+  0x61, 0xa6, 0x98, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x7d, 0xf3, 0x03, 0xef, 0xb5, 0xb5, 0x99,
+  0x8d, 0x99, 0x99, 0xb5, 0xb5, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xbf, 0xe8, 0xb5, 0xad, 0x61, 0xad,
+  0x86, 0xcc, 0x66, 0xc6, 0xc6, 0x61, 0x9a, 0xcb, 0x7f, 0xff, 0xa4, 0x20, 0x9d, 0x99, 0xb1, 0xb1,
+  0xb3, 0x5e, 0xb6, 0xb1, 0x96, 0xd3, 0x5a, 0xd6, 0xb4, 0x08, 0x2d, 0x5a, 0xdd, 0x91, 0x69, 0x64,
+  0x00, 0x00, 0x6b, 0x2c, 0x1a, 0xd6, 0x06, 0x99, 0x60, 0xb1, 0xcb, 0xcd, 0x96, 0xb4, 0xbe, 0x33,
+  0x5b, 0x59, 0xad, 0xa6, 0x35, 0xac, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x9d, 0xf4, 0x2d, 0x16, 0x03,
+  0x2f, 0x59, 0xaf, 0x5b, 0x00, 0x00, 0x07, 0xec, 0x18, 0x22, 0xd6, 0xd6, 0xb3, 0x4f, 0xbf, 0xeb,
+  0xd6, 0x63, 0x1b, 0x0d, 0xac, 0xc1, 0xac, 0xb0, 0x00, 0x05, 0xfd, 0x00, 0xb0, 0x0d, 0x6d, 0x66,
+  0x63, 0x63, 0x66, 0x63, 0xd6, 0x63, 0x1b, 0xef, 0xff, 0xad, 0x65, 0xb0, 0xb0, 0x33, 0x4c, 0x30,
+  0xcf, 0xef, 0x9b, 0x33, 0x36, 0x33, 0x35, 0xb5, 0x8d, 0x0d, 0xff, 0xff, 0xeb, 0xc6, 0xd6, 0x63,
+  0x0c, 0x6b, 0x2f, 0x4d, 0x60, 0x35, 0xad, 0x65, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x3d, 0x50,
+  0x07, 0xf7, 0x63, 0x0f, 0x5b, 0x1b, 0x33, 0x33, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xed,
+  0x59, 0x6b, 0x2c, 0xd6, 0x63, 0x33, 0x33, 0x1b, 0x1b, 0x5e, 0xb3, 0x58, 0xd6, 0xef, 0xff, 0xf4,
+  0x74, 0x13, 0xaf, 0x5b, 0x33, 0x33, 0x33, 0x18, 0xc1, 0x96, 0xd1, 0xa6, 0x80, 0xb4, 0x26, 0xec,
+  0x8b, 0x42, 0x0b, 0x46, 0x85, 0x86, 0x86, 0xb5, 0x96, 0x69, 0xad, 0x61, 0xa6, 0xb5, 0xac, 0x59,
+  0xbf, 0xc3, 0x69, 0xa0, 0xee, 0xcd, 0x7a, 0xc3, 0x19, 0x6d, 0x37, 0x01, 0x80, 0x00, 0x00, 0x01,
+  0xc3, 0xfb, 0xad, 0x05, 0x96, 0x0c, 0x1b, 0x59, 0x98, 0x00, 0x00, 0x7b, 0xc1, 0x62, 0x06, 0x18,
+  0x1b, 0xfb, 0xff, 0xb1, 0x8c, 0xcc, 0x63, 0x6b, 0x6b, 0x19, 0x60, 0xc0, 0x00, 0x3f, 0xb8, 0x6e,
+  0xc2, 0xc0, 0x31, 0x8c, 0xcc, 0xcc, 0xcd, 0x8d, 0xaf, 0x59, 0x8c, 0xff, 0xef, 0xeb, 0x58, 0xc3,
+  0xc2, 0x1a, 0xc3, 0x0c, 0xff, 0xfa, 0xf5, 0xe3, 0x63, 0xd7, 0xad, 0x8c, 0xd6, 0x1a, 0x6b, 0xff,
+  0xff, 0xb5, 0x98, 0xc3, 0x6b, 0x30, 0x6b, 0x0d, 0x65, 0xb4, 0xd6, 0xb2, 0xc0, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0xb3, 0xd3, 0x00, 0x3f, 0xe0, 0xcc, 0xc6, 0xc6, 0xcd, 0x1b, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xfe, 0x8b, 0x2c, 0xb1, 0x86, 0x36, 0x33, 0x33, 0x33, 0x18, 0xc6, 0xb0, 0xdf, 0xfd,
+  0xff, 0x20, 0x1d, 0x63, 0x36, 0x36, 0x33, 0x30, 0xd6, 0x6b, 0x00, 0x34, 0xb1, 0x35, 0x64, 0x2d,
+  0x16, 0x8b, 0x41, 0x34, 0x01, 0xa0, 0xd3, 0x59, 0x61, 0xa6, 0x58, 0x1a, 0x6b, 0x5a, 0xd3, 0x6b,
+  0x6d, 0xa0, 0xb2, 0xd4, 0x18, 0xc1, 0x1a, 0x6b, 0x2c, 0x69, 0xac, 0x00, 0x00, 0x00, 0xe6, 0xbb,
+  0xfa, 0x0b, 0x5a, 0xcb, 0x69, 0x9a, 0xda, 0xd8, 0xc0, 0x00, 0x07, 0xbc, 0x14, 0x1e, 0x6b, 0xd6,
+  0xb3, 0x4e, 0xff, 0xf9, 0x98, 0xc6, 0xc6, 0x36, 0xb6, 0xb6, 0xb0, 0x34, 0x00, 0x01, 0xdf, 0xcd,
+  0x02, 0xd6, 0x58, 0xd6, 0x31, 0x99, 0xb1, 0xb3, 0x33, 0x1e, 0xb3, 0x18, 0xff, 0xff, 0xce, 0x96,
+  0x31, 0x71, 0x06, 0xb0, 0xc6, 0xaf, 0xfe, 0x6c, 0x7a, 0xf5, 0xe3, 0x63, 0x31, 0x83, 0x5a, 0xfb,
+  0xff, 0xf9, 0x86, 0x63, 0x18, 0xd6, 0x6b, 0x03, 0x01, 0xac, 0xb0, 0x0d, 0x1a, 0x00, 0x00, 0x00,
+  0xff, 0xf7, 0xff, 0x00, 0x1f, 0xf5, 0xeb, 0x31, 0xb4, 0x3d, 0x78, 0xd8, 0xcc, 0x68, 0x00, 0x00,
+  0x00, 0x07, 0xff, 0xf2, 0xb1, 0x62, 0xf5, 0xaf, 0x59, 0x98, 0xd8, 0xd8, 0xcc, 0x63, 0x5e, 0x99,
+  0x67, 0xff, 0xfa, 0x64, 0x80, 0x75, 0x8f, 0x5b, 0x33, 0x33, 0x1a, 0xf5, 0xac, 0xd6, 0xb0, 0x02,
+  0xc9, 0xa2, 0xd0, 0x40, 0x82, 0xd1, 0x64, 0x68, 0x03, 0x46, 0x9a, 0xc2, 0xf4, 0x6b, 0x58, 0x06,
+  0x8d, 0x1b, 0x57, 0x58, 0x2c, 0xb4, 0x01, 0x65, 0x96, 0x2c, 0xd3, 0x58, 0x0d, 0x60, 0xd6, 0x00,
+  0x00, 0x15, 0xa7, 0xff, 0xc2, 0xd6, 0xb5, 0xac, 0x6b, 0x35, 0xeb, 0x31, 0x80, 0x00, 0x1f, 0x81,
+  0x41, 0xf6, 0xc3, 0x5b, 0x4d, 0xff, 0x7f, 0xcc, 0x66, 0x36, 0xbd, 0x6c, 0x66, 0xbd, 0x6b, 0xd3,
+  0x59, 0x00, 0x00, 0xff, 0xe3, 0x1b, 0x7f, 0x65, 0xad, 0x60, 0x63, 0x31, 0xb1, 0xb3, 0x63, 0x63,
+  0x63, 0x18, 0xbf, 0xff, 0xf3, 0xd6, 0x32, 0x31, 0xc3, 0x06, 0x1b, 0xfe, 0xfe, 0xd9, 0x9b, 0x1e,
+  0xbd, 0x78, 0xc6, 0xd6, 0x1a, 0xd7, 0xfd, 0xff, 0xf6, 0x63, 0x5e, 0xb6, 0x18, 0x63, 0x58, 0x35,
+  0x86, 0xb5, 0x80, 0xd3, 0x5a, 0xcb, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x2f, 0xe6, 0xe6,
+  0x36, 0x3d, 0x78, 0xd8, 0xf5, 0x98, 0xc8, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0xf8, 0x58, 0xb3, 0x58,
+  0xc6, 0x66, 0x66, 0x63, 0x31, 0x8c, 0xb6, 0x9a, 0xef, 0xff, 0xec, 0x7e, 0x73, 0xb1, 0xb1, 0xb1,
+  0xb5, 0xb5, 0xb5, 0x81, 0xac, 0x58, 0x59, 0x34, 0x5a, 0xd1, 0x68, 0x2d, 0x0b, 0x41, 0x69, 0xa0,
+  0xd0, 0x34, 0xd6, 0xb2, 0xc3, 0x4d, 0x65, 0x80, 0x01, 0xa1, 0xa2, 0xb2, 0xd0, 0x0b, 0x5a, 0xd3,
+  0x4d, 0x65, 0x86, 0xb5, 0x83, 0x58, 0x35, 0x8d, 0x60, 0x00, 0x0e, 0xd6, 0xff, 0xfe, 0x2d, 0x34,
+  0xd6, 0x1a, 0xda, 0xcc, 0x66, 0x30, 0x00, 0x37, 0x81, 0x61, 0xfa, 0xf5, 0xb5, 0x86, 0xbf, 0xef,
+  0xe6, 0x1e, 0xb3, 0x33, 0x31, 0x98, 0x66, 0xb2, 0xc0, 0x00, 0x1f, 0xfc, 0x19, 0x98, 0xfa, 0xd6,
+  0x98, 0x31, 0x99, 0x8f, 0x1b, 0x1e, 0x33, 0x6b, 0xd6, 0xd6, 0xd7, 0xdf, 0xff, 0x16, 0xca, 0xc9,
+  0x35, 0xac, 0xd6, 0xd6, 0xff, 0xfe, 0xb3, 0x63, 0x6c, 0x6c, 0xc6, 0xc3, 0x1a, 0x67, 0xff, 0xfe,
+  0xe7, 0x59, 0x8c, 0x63, 0x30, 0x63, 0x58, 0x6b, 0x0d, 0x6b, 0x0d, 0x35, 0x96, 0x00, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xe0, 0x03, 0xfe, 0xe3, 0x6b, 0x66, 0x66, 0x6c, 0x7a, 0xf5, 0xb5, 0xe9, 0x80,
+  0x00, 0x00, 0x00, 0x7d, 0xff, 0xda, 0xb0, 0xb6, 0x99, 0x8c, 0x6c, 0x66, 0xd6, 0xc6, 0x6b, 0x35,
+  0x80, 0xff, 0xff, 0x50, 0x0f, 0x8e, 0x59, 0x99, 0xb5, 0xeb, 0x63, 0x06, 0x0d, 0x6b, 0x2c, 0xb5,
+  0xa6, 0x96, 0x40, 0xb4, 0x2d, 0x37, 0x65, 0xa1, 0x6b, 0x4d, 0x0d, 0x06, 0x9a, 0x65, 0x8b, 0x68,
+  0xd6, 0xb5, 0x85, 0x82, 0xd9, 0x99, 0x9a, 0xd0, 0x0b, 0x4d, 0x03, 0x43, 0x4c, 0x06, 0xb0, 0xd6,
+  0x0c, 0x1a, 0xcd, 0x60, 0x00, 0x56, 0x7f, 0xf7, 0xda, 0x34, 0xd6, 0xb3, 0x58, 0xcd, 0x7a, 0xcc,
+  0xd7, 0x80, 0x07, 0xb0, 0x30, 0x41, 0x98, 0x61, 0x9f, 0xff, 0xec, 0x3d, 0xb0, 0xd8, 0xcc, 0x7a,
+  0xd8, 0xc6, 0x35, 0x9a, 0x60, 0x00, 0x7f, 0x7c, 0x66, 0x63, 0x33, 0xee, 0xd1, 0x97, 0xac, 0x66,
+  0x66, 0xcc, 0xcd, 0x99, 0x99, 0x8c, 0x67, 0xff, 0xdf, 0xc3, 0x37, 0x30, 0xd6, 0xb3, 0x2f, 0x4f,
+  0xff, 0xfc, 0x6d, 0x98, 0xf1, 0xb3, 0x36, 0x33, 0x35, 0x9a, 0xd6, 0xff, 0xff, 0xd5, 0xb5, 0x98,
+  0xcc, 0x33, 0x0d, 0x6d, 0x6b, 0x6b, 0x58, 0xd6, 0x03, 0x58, 0x03, 0x4d, 0x68, 0x00, 0x03, 0xbf,
+  0x3f, 0xff, 0xc0, 0x17, 0xff, 0xd8, 0xc6, 0x66, 0x66, 0xc7, 0xaf, 0x5e, 0xbd, 0x66, 0xb0, 0x00,
+  0x00, 0x00, 0x07, 0xff, 0xf4, 0x16, 0x18, 0x36, 0x31, 0xeb, 0x63, 0x6b, 0x61, 0x83, 0x58, 0xbf,
+  0xef, 0xec, 0x3d, 0x38, 0xcc, 0x6c, 0xc6, 0xc3, 0x0c, 0x06, 0xb5, 0xad, 0x6b, 0x40, 0xb4, 0x0b,
+  0x41, 0x68, 0x16, 0x81, 0x6b, 0x4d, 0x06, 0x86, 0x9a, 0xd6, 0x58, 0x0d, 0x69, 0x96, 0xb2, 0xd6,
+  0xb2, 0x32, 0x0d, 0x58, 0xb4, 0xd0, 0x58, 0x58, 0x35, 0xac, 0x35, 0x83, 0x58, 0xd6, 0x6b, 0x5b,
+  0x58, 0x00, 0x04, 0x5f, 0x7f, 0xc6, 0x86, 0xb0, 0x63, 0x0d, 0xad, 0x86, 0xd7, 0xa0, 0x6c, 0x60,
+  0xe1, 0x1d, 0x8c, 0xd6, 0xd2, 0xff, 0xfe, 0x18, 0xcc, 0xcc, 0xcc, 0x6d, 0x7a, 0xcc, 0x1a, 0xc0,
+  0x00, 0xbf, 0xfe, 0x66, 0x33, 0x33, 0x33, 0xfe, 0x83, 0x0c, 0x6c, 0x6c, 0xcd, 0x99, 0xb1, 0xeb,
+  0x63, 0x30, 0xff, 0xff, 0xd4, 0xe3, 0x43, 0x3c, 0xd6, 0x0c, 0x6f, 0xef, 0xfe, 0xcc, 0xcd, 0x9b,
+  0x1b, 0x33, 0x31, 0x86, 0xb5, 0xff, 0xff, 0x9d, 0x9a, 0xda, 0xd8, 0x6d, 0x6d, 0x66, 0xb1, 0x81,
+  0x86, 0xb0, 0x35, 0x81, 0xad, 0x65, 0x85, 0x80, 0x0e, 0xcb, 0x7b, 0xff, 0xff, 0x80, 0x7f, 0x7f,
+  0x6b, 0x6b, 0x63, 0x33, 0x63, 0xd7, 0x8c, 0xcc, 0x6b, 0x34, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0xe8,
+  0x59, 0xa6, 0x6b, 0xd6, 0xd7, 0x8c, 0xcc, 0x66, 0x1a, 0xda, 0x69, 0xbf, 0xfb, 0xeb, 0xd1, 0xe1,
+  0xc1, 0x9b, 0x19, 0x98, 0xc3, 0x2c, 0xd3, 0x4d, 0x6b, 0x40, 0x2d, 0x05, 0xad, 0x0b, 0x5a, 0x0b,
+  0x40, 0x5a, 0xd3, 0x46, 0x86, 0x8d, 0x6b, 0x5a, 0xc0, 0x1a, 0x69, 0xa6, 0x9a, 0xc4, 0xc4, 0x16,
+  0x4d, 0x05, 0x96, 0xb5, 0xac, 0xb0, 0xd6, 0x06, 0x5e, 0x98, 0x6b, 0x35, 0x86, 0x1a, 0xf0, 0x00,
+  0x76, 0xbb, 0xfe, 0x83, 0x4c, 0x1a, 0xd8, 0x63, 0x35, 0xeb, 0x63, 0x19, 0x99, 0x84, 0x04, 0xf6,
+  0x1b, 0x59, 0xaf, 0xef, 0xfe, 0x6d, 0x6d, 0x7a, 0xf5, 0xb3, 0x33, 0x1b, 0x0c, 0x6b, 0x00, 0x00,
+  0xff, 0xef, 0xbd, 0x66, 0x66, 0x63, 0xd6, 0xdf, 0xdf, 0x0d, 0x63, 0x31, 0xb3, 0x36, 0x6c, 0xcd,
+  0x98, 0xd8, 0x6d, 0x3f, 0xff, 0xf5, 0x8d, 0x3d, 0x26, 0xb5, 0x8c, 0xbd, 0x7f, 0xdf, 0xd8, 0xd9,
+  0x99, 0xb6, 0x36, 0x36, 0x19, 0xa6, 0xfb, 0xff, 0xff, 0x22, 0xcd, 0x6c, 0x6b, 0xd7, 0xac, 0x63,
+  0x59, 0xac, 0x6b, 0x1a, 0xc1, 0x96, 0x69, 0xac, 0x00, 0x68, 0x15, 0xad, 0x63, 0xcb, 0xff, 0xfc,
+  0x07, 0xff, 0xd3, 0x0c, 0xc6, 0x6c, 0xcc, 0xcd, 0x8c, 0xcd, 0x61, 0xa0, 0x00, 0x00, 0x00, 0x7f,
+  0xff, 0xfb, 0x00, 0xd6, 0xbd, 0x66, 0x63, 0xd6, 0xd7, 0x86, 0xd6, 0x6b, 0x01, 0xbf, 0xfb, 0xfb,
+  0x18, 0xec, 0xdd, 0x99, 0x99, 0x98, 0x63, 0x2c, 0x68, 0xd6, 0x9b, 0xec, 0x6b, 0x35, 0xa8, 0x4d,
+  0x0b, 0x26, 0x85, 0xad, 0x02, 0xd6, 0x9a, 0x34, 0x1a, 0x69, 0xad, 0x65, 0x80, 0x03, 0x40, 0xc1,
+  0xc0, 0xcb, 0x40, 0x2d, 0x68, 0xd1, 0xa6, 0x58, 0xd6, 0xb3, 0x5a, 0xf4, 0xc3, 0x59, 0xac, 0xd6,
+  0x35, 0x9a, 0x00, 0x1d, 0xa7, 0xff, 0xf3, 0x43, 0x58, 0x31, 0x86, 0x63, 0x18, 0xcc, 0xc6, 0xd7,
+  0x84, 0xc5, 0xb3, 0x19, 0x83, 0xff, 0xfd, 0x69, 0x66, 0x33, 0x1e, 0xbd, 0x7a, 0xf5, 0xeb, 0x63,
+  0x1a, 0xcd, 0x00, 0x07, 0x7f, 0xfc, 0xcc, 0xc6, 0xc6, 0xcc, 0xce, 0xff, 0xac, 0x6b, 0x6b, 0xd7,
+  0xaf, 0x5e, 0x66, 0xcd, 0x99, 0xb3, 0x19, 0x8c, 0xfe, 0xff, 0xfe, 0x6b, 0xeb, 0x1a, 0xc3, 0x59,
+  0xbf, 0xff, 0xb9, 0x8f, 0x1b, 0x33, 0x66, 0xc6, 0x63, 0x0d, 0x7d, 0xff, 0xff, 0x83, 0xac, 0xc3,
+  0x6b, 0xd6, 0x6b, 0xd6, 0x30, 0x63, 0x58, 0xd6, 0x1a, 0xc3, 0x58, 0x06, 0x9a, 0xd6, 0x9c, 0xd3,
+  0x59, 0x6d, 0xdb, 0xff, 0xfe, 0x0b, 0xff, 0xfb, 0x35, 0x98, 0xc6, 0xcc, 0xcc, 0xd9, 0x8d, 0x86,
+  0x1a, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xfe, 0x06, 0xb5, 0xb5, 0xb1, 0x99, 0x8f, 0x59, 0x9a, 0xcd,
+  0x6b, 0x07, 0xff, 0x7d, 0xaf, 0x58, 0xe8, 0xdb, 0x1e, 0xb6, 0x63, 0x18, 0xd6, 0x0d, 0x35, 0x76,
+  0x6b, 0x18, 0x30, 0x3a, 0x69, 0x62, 0x68, 0x0b, 0x4d, 0x58, 0xb5, 0xa3, 0x43, 0x41, 0xa6, 0xb5,
+  0xad, 0x62, 0xc0, 0x2c, 0x5a, 0xfa, 0xf5, 0xa0, 0x5a, 0xd0, 0x00, 0x69, 0xac, 0x35, 0x8d, 0x61,
+  0x86, 0x0c, 0x6b, 0x35, 0x8c, 0x00, 0x0e, 0x1f, 0xf7, 0xc6, 0x9a, 0xc6, 0xb3, 0x5b, 0x5b, 0x59,
+  0x9a, 0xd8, 0xcc, 0xc6, 0x16, 0x19, 0xc6, 0x66, 0xb6, 0xff, 0xbf, 0xf8, 0xcc, 0x66, 0x3d, 0x7a,
+  0xf1, 0x99, 0x9a, 0xf5, 0x8d, 0x60, 0x00, 0xff, 0xfb, 0x98, 0xcc, 0xcd, 0x8f, 0x5e, 0xbd, 0x5f,
+  0xff, 0x65, 0xeb, 0x19, 0x9b, 0x33, 0x6c, 0x79, 0x99, 0xb1, 0x99, 0x87, 0xff, 0x7f, 0xf6, 0xd6,
+  0xce, 0xb5, 0x86, 0xb6, 0xbf, 0xff, 0xf5, 0x17, 0x8d, 0x8f, 0x1e, 0xbc, 0xc7, 0xad, 0x8c, 0x1b,
+  0xff, 0xbf, 0xff, 0x9a, 0xda, 0xda, 0xf5, 0x98, 0xc6, 0x18, 0x61, 0xad, 0xa6, 0x35, 0x86, 0xb0,
+  0xd3, 0x58, 0xb1, 0x6f, 0xef, 0xe3, 0x5a, 0xc1, 0xd1, 0xff, 0xfe, 0x1f, 0xdf, 0xc1, 0x8c, 0x66,
+  0x66, 0x6c, 0x6c, 0xcc, 0xc3, 0x34, 0xd0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x70, 0x6b, 0x0c, 0xc6,
+  0xd7, 0x8c, 0xc6, 0x65, 0xe9, 0x96, 0x3f, 0xff, 0xbb, 0xd6, 0xc1, 0xc9, 0xae, 0xc6, 0xc6, 0x63,
+  0x1a, 0xc1, 0xa7, 0x46, 0x0c, 0xd6, 0x35, 0x9a, 0x67, 0xd1, 0x65, 0xad, 0x00, 0xb4, 0xd5, 0x8b,
+  0x5a, 0x68, 0x1a, 0x0d, 0x1a, 0xd3, 0x2d, 0x65, 0x96, 0xb5, 0xad, 0x77, 0x74, 0x0b, 0x4d, 0x05,
+  0x8b, 0x2c, 0x0d, 0x61, 0xac, 0xd6, 0x18, 0x6b, 0xd3, 0x35, 0x8d, 0x66, 0xb1, 0x80, 0x14, 0x4f,
+  0xff, 0x8d, 0x6b, 0x0c, 0x19, 0x86, 0x31, 0x98, 0xda, 0xf1, 0x86, 0x87, 0x59, 0x98, 0x6d, 0xff,
+  0xfe, 0xac, 0x6b, 0x63, 0x1e, 0xbd, 0x78, 0xcd, 0x8c, 0xcd, 0x7a, 0x60, 0x00, 0x77, 0xff, 0xf6,
+  0x33, 0x1b, 0x36, 0x36, 0x6d, 0x7b, 0xfe, 0xfe, 0xb5, 0xb5, 0xeb, 0x3d, 0x6d, 0x99, 0xb6, 0x66,
+  0xd8, 0xcd, 0x86, 0x6b, 0xff, 0xfb, 0x7b, 0x75, 0xac, 0x18, 0x3f, 0xff, 0xf5, 0xcd, 0x99, 0x9b,
+  0x36, 0x66, 0xc6, 0x66, 0x5e, 0x9f, 0xfd, 0xff, 0xf1, 0x86, 0x63, 0x19, 0xad, 0x86, 0xb6, 0xb1,
+  0xac, 0xd6, 0x32, 0xda, 0xc1, 0xac, 0xb0, 0x03, 0xff, 0xbb, 0x4d, 0x61, 0xae, 0x3f, 0xff, 0xf1,
+  0xff, 0xdf, 0x61, 0x86, 0x36, 0x33, 0x63, 0xd7, 0xaf, 0x19, 0x8c, 0x35, 0xad, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0xfc, 0x69, 0xad, 0xac, 0xcc, 0xc6, 0xc6, 0x61, 0x8d, 0x6b, 0x4f, 0xff, 0xf6, 0xb6,
+  0xc6, 0x63, 0x83, 0x56, 0x66, 0x66, 0x31, 0xac, 0x0d, 0xff, 0x18, 0x63, 0x06, 0x6b, 0x0d, 0x61,
+  0xfc, 0x59, 0x68, 0xd0, 0xb2, 0xd0, 0x2d, 0x6b, 0x43, 0x40, 0x0d, 0x0d, 0x34, 0xd6, 0xb4, 0xd1,
+  0xa5, 0xcd, 0xbe, 0x26, 0x81, 0x6b, 0x5a, 0xd6, 0xb5, 0x81, 0xac, 0xd6, 0x18, 0x61, 0x86, 0x18,
+  0x6b, 0x6b, 0x0d, 0x60, 0x0e, 0xb2, 0xdf, 0xf7, 0xda, 0x60, 0x63, 0x5b, 0x59, 0xaf, 0x58, 0xcc,
+  0xc6, 0xc0, 0xf1, 0x0b, 0x1b, 0x5e, 0xb7, 0xff, 0x7f, 0x0c, 0xc3, 0xd6, 0xcd, 0x8d, 0x8f, 0x5b,
+  0x18, 0xc0, 0x00, 0x3f, 0xfb, 0xf9, 0x8d, 0xaf, 0x1b, 0x6b, 0xcc, 0xd8, 0xdf, 0xff, 0x74, 0xc6,
+  0x66, 0x66, 0xd9, 0x9e, 0x66, 0xcc, 0xd8, 0xcc, 0x6b, 0x71, 0x70, 0xb5, 0x86, 0xb1, 0x7f, 0xff,
+  0xec, 0xe6, 0x6c, 0x6d, 0x8f, 0x1b, 0x33, 0x30, 0xcd, 0x7f, 0xfd, 0xff, 0xd6, 0xd6, 0xd6, 0xd7,
+  0xac, 0xc6, 0x19, 0xad, 0xac, 0x30, 0xc3, 0x5b, 0x58, 0x35, 0x86, 0x9a, 0x34, 0xff, 0xfe, 0x1a,
+  0xc1, 0x9b, 0xdf, 0xbf, 0xe7, 0xff, 0xff, 0xb6, 0x06, 0x19, 0x98, 0xd9, 0x99, 0x9b, 0x1b, 0x5e,
+  0xb1, 0xad, 0x6b, 0x44, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x9a, 0x61, 0x8d, 0xaf, 0x5b, 0x31, 0xb5,
+  0xb5, 0x8d, 0x35, 0xfd, 0xff, 0x6b, 0xd6, 0xc6, 0x37, 0x34, 0xc6, 0xcc, 0xc3, 0x6b, 0x2f, 0x47,
+  0xf5, 0x8c, 0x30, 0xc6, 0x18, 0x35, 0x81, 0xfd, 0x6b, 0x5a, 0x34, 0x16, 0xb4, 0x05, 0xa6, 0x86,
+  0x80, 0x00, 0x0d, 0x06, 0x81, 0x6b, 0x7b, 0x5d, 0x34, 0xb1, 0x69, 0xa0, 0xd1, 0xad, 0x63, 0x58,
+  0x61, 0x83, 0x35, 0x98, 0x31, 0xac, 0x60, 0xd6, 0xc0, 0x2e, 0x68, 0x7f, 0xd5, 0x81, 0x86, 0x18,
+  0xd7, 0xac, 0xd7, 0x87, 0xad, 0x84, 0x64, 0xd7, 0x8c, 0xc7, 0x7f, 0xff, 0x63, 0x0c, 0xcc, 0xcd,
+  0x8d, 0x99, 0xb5, 0xb1, 0x86, 0x80, 0x07, 0xff, 0xff, 0xa8, 0xc7, 0xad, 0xb1, 0xe3, 0x66, 0xcc,
+  0x7f, 0xff, 0xc2, 0x1a, 0xda, 0xf5, 0xe3, 0x6c, 0xd9, 0xb3, 0xc6, 0xd8, 0xda, 0xf5, 0xb5, 0x9c,
+  0xbc, 0xb6, 0x59, 0xad, 0x6d, 0xfd, 0xff, 0xfd, 0x8d, 0x99, 0x9b, 0x63, 0xd7, 0x8d, 0x8c, 0x61,
+  0xff, 0xf7, 0xff, 0xd8, 0xd7, 0xac, 0xc6, 0x31, 0x98, 0x33, 0x59, 0xac, 0xd6, 0x30, 0xc3, 0x58,
+  0x6b, 0x5a, 0xcb, 0x5f, 0x7f, 0xc3, 0x2d, 0xac, 0x6c, 0xfc, 0x7f, 0x7d, 0xff, 0xcb, 0x0c, 0x31,
+  0x99, 0x99, 0x9b, 0x1b, 0x33, 0x5e, 0xb3, 0x59, 0x6b, 0x42, 0xfe, 0x36, 0x60, 0x00, 0x03, 0xfe,
+  0xfa, 0x60, 0xcc, 0x6d, 0x7a, 0xf0, 0xd8, 0x60, 0x6b, 0xff, 0xfa, 0x36, 0x33, 0x0d, 0x8c, 0xf6,
+  0x36, 0x33, 0x0c, 0x1b, 0xfb, 0x8c, 0x30, 0xcc, 0x35, 0xeb, 0x5b, 0x4c, 0x02, 0xfa, 0xd6, 0x9a,
+  0x00, 0xb4, 0x0b, 0x5a, 0x68, 0x05, 0x80, 0x58, 0x00, 0xb1, 0x6b, 0x5a, 0xd9, 0xb5, 0x65, 0xad,
+  0x00, 0x16, 0x69, 0xac, 0x6b, 0x1a, 0xda, 0xc6, 0xb6, 0xb6, 0xb1, 0x86, 0xb3, 0x58, 0x60, 0x01,
+  0xf0, 0xb0, 0xff, 0xa0, 0xd6, 0x35, 0x98, 0x6b, 0xd6, 0x63, 0x6b, 0xc6, 0x29, 0x2b, 0x6c, 0xc6,
+  0xbf, 0xff, 0x81, 0x98, 0xcc, 0xcd, 0x8f, 0x19, 0xb1, 0x98, 0x6b, 0x00, 0x1f, 0x7f, 0xff, 0x31,
+  0xb1, 0xb3, 0x66, 0x6d, 0x8f, 0x5e, 0xbf, 0xbf, 0xf8, 0x66, 0x36, 0x66, 0xd9, 0xeb, 0xd8, 0xf3,
+  0x36, 0x33, 0x18, 0xe2, 0xe9, 0xff, 0xfa, 0xc0, 0xc3, 0xfb, 0xff, 0xed, 0x7a, 0xf1, 0xb3, 0x36,
+  0x6c, 0xcc, 0xc6, 0xd6, 0x3f, 0xff, 0xbf, 0xfb, 0x0c, 0x63, 0x31, 0x8c, 0x33, 0x06, 0x30, 0xc3,
+  0x18, 0x30, 0xd6, 0xb0, 0x2c, 0xff, 0xfe, 0x86, 0x0c, 0x35, 0x3d, 0x3e, 0xbf, 0xff, 0xfc, 0xac,
+  0x1a, 0xcd, 0x7a, 0xd8, 0xcd, 0x8d, 0x99, 0x99, 0x8c, 0x6b, 0x16, 0x43, 0xef, 0xfb, 0x66, 0x66,
+  0x00, 0x00, 0x7f, 0xdf, 0xda, 0xc6, 0x33, 0x19, 0xb1, 0x8c, 0xd6, 0x1b, 0xef, 0xff, 0xec, 0x36,
+  0x63, 0x63, 0x53, 0x36, 0x66, 0x66, 0x18, 0x6b, 0xfa, 0xb1, 0x86, 0x6b, 0x6b, 0x6b, 0x35, 0x8d,
+  0x60, 0x05, 0xfc, 0xd6, 0xb4, 0x35, 0x65, 0xa0, 0x2d, 0x1a, 0x16, 0x16, 0x2c, 0xb1, 0x62, 0xcb,
+  0x5a, 0x69, 0x69, 0x64, 0xb2, 0xd0, 0x16, 0x59, 0x65, 0x86, 0xb5, 0x99, 0x6d, 0x66, 0xb6, 0xb1,
+  0x8c, 0x30, 0xc1, 0xad, 0xad, 0x66, 0xb0, 0x3b, 0xb5, 0xad, 0x68, 0xff, 0x8d, 0x63, 0x58, 0xc3,
+  0x0d, 0xad, 0x98, 0xd8, 0xb8, 0xc1, 0xb1, 0x8f, 0xff, 0xe0, 0x61, 0xb5, 0xeb, 0xc6, 0xcc, 0xd8,
+  0xf5, 0xb1, 0x9a, 0xcc, 0x00, 0x7f, 0xfd, 0xfc, 0x66, 0x66, 0xcc, 0xdb, 0x33, 0x66, 0xd7, 0xbf,
+  0xff, 0xdf, 0x03, 0x31, 0xeb, 0xcd, 0x9b, 0x6c, 0xcf, 0x1e, 0x36, 0x31, 0x8d, 0xce, 0x9f, 0xff,
+  0xfe, 0xdf, 0xfb, 0x0d, 0x61, 0xff, 0x7f, 0xf1, 0xb1, 0xb6, 0xbc, 0xd8, 0xf5, 0xe3, 0x63, 0x0c,
+  0xff, 0xfe, 0xff, 0xac, 0x63, 0x5e, 0xb6, 0xbd, 0x66, 0xbd, 0x63, 0x5e, 0xb1, 0xad, 0xad, 0xac,
+  0x63, 0x59, 0xad, 0x63, 0x40, 0xfe, 0xff, 0x8d, 0x63, 0x58, 0xd9, 0xfd, 0xfd, 0xff, 0xff, 0xc0,
+  0x61, 0xaf, 0x0d, 0x98, 0xd9, 0xb1, 0x9b, 0x0c, 0xd6, 0x58, 0x43, 0xff, 0xa3, 0x66, 0xc6, 0x00,
+  0x00, 0xff, 0xbf, 0xb0, 0xcd, 0x7a, 0xd9, 0x8c, 0xcc, 0x30, 0x7f, 0xf7, 0xf6, 0xb6, 0xbd, 0x7a,
+  0xf5, 0xe1, 0xa1, 0x96, 0x63, 0xd6, 0xc3, 0x0d, 0x7f, 0x71, 0xaf, 0x58, 0xc6, 0x35, 0xeb, 0x35,
+  0x9a, 0xd6, 0x00, 0x3b, 0xad, 0x35, 0xa0, 0x2d, 0x02, 0xd3, 0x41, 0x62, 0xcb, 0x5a, 0xd6, 0xb5,
+  0xad, 0x68, 0xd0, 0xac, 0xec, 0x6d, 0x1a, 0xb1, 0x6b, 0x4d, 0x69, 0x96, 0x1a, 0xc6, 0xb6, 0xb1,
+  0x86, 0x6b, 0x6b, 0x35, 0x9a, 0xcd, 0x6b, 0x6b, 0x59, 0xad, 0x05, 0xf0, 0x34, 0xb0, 0xfe, 0x59,
+  0xac, 0x30, 0xc6, 0x33, 0x33, 0x63, 0x43, 0x66, 0x61, 0xff, 0xf1, 0x7a, 0x63, 0x19, 0xb5, 0xe6,
+  0x6c, 0x78, 0xcc, 0xc6, 0x34, 0x00, 0x7f, 0xff, 0xfa, 0x06, 0xc7, 0xaf, 0x1e, 0x66, 0xd9, 0x9b,
+  0x1f, 0xf7, 0xff, 0x58, 0xda, 0xf1, 0xb6, 0x78, 0xf3, 0x67, 0x8f, 0x5e, 0x36, 0xb6, 0x1a, 0xdc,
+  0x6f, 0xff, 0xff, 0x18, 0x32, 0xf5, 0xff, 0xdf, 0xfd, 0x99, 0x9b, 0x1e, 0x36, 0x6c, 0xcc, 0xc6,
+  0x33, 0xff, 0xfb, 0xfe, 0xb0, 0xcc, 0x33, 0x18, 0xc6, 0x19, 0xac, 0xc3, 0x0d, 0xac, 0x61, 0x96,
+  0xd3, 0x4d, 0x37, 0xff, 0xfe, 0x98, 0x61, 0x86, 0x65, 0x75, 0x72, 0xfc, 0x0d, 0x66, 0x1b, 0x5e,
+  0xbd, 0x7a, 0xf1, 0xb1, 0xb3, 0x18, 0x61, 0x61, 0x2f, 0xff, 0x99, 0xb3, 0x36, 0x60, 0x00, 0x0f,
+  0xfb, 0xe6, 0xb1, 0xb5, 0xeb, 0xd6, 0xc6, 0x63, 0x58, 0xff, 0xff, 0x95, 0x35, 0xb1, 0x9b, 0x1e,
+  0x33, 0x32, 0x36, 0x33, 0x32, 0xf4, 0xdf, 0x7f, 0xcc, 0x33, 0x0c, 0xc6, 0x19, 0xac, 0xd6, 0xb0,
+  0x01, 0x6b, 0xeb, 0x5a, 0xd1, 0xbb, 0x10, 0x16, 0x80, 0x2d, 0x6b, 0x5a, 0x69, 0xa3, 0x40, 0x2c,
+  0xac, 0xec, 0x00, 0x5a, 0xd3, 0x40, 0xd3, 0x5a, 0xc6, 0xb3, 0x58, 0xc6, 0x18, 0xc6, 0x35, 0xb5,
+  0x83, 0x06, 0x06, 0xb0, 0x7f, 0xd8, 0x59, 0x6b, 0x2d, 0x67, 0xf6, 0xb5, 0xb5, 0x86, 0x33, 0x19,
+  0xeb, 0x1d, 0x9e, 0x66, 0xcf, 0xbf, 0xac, 0x35, 0x8c, 0xc6, 0x6c, 0xd8, 0xdb, 0x1b, 0x35, 0xeb,
+  0x6b, 0x40, 0x0e, 0xff, 0xff, 0xf1, 0x63, 0x33, 0x3c, 0x78, 0xf3, 0x66, 0x6c, 0xd7, 0xff, 0xfb,
+  0x9e, 0xb3, 0x1b, 0x36, 0x6d, 0x9e, 0x67, 0x99, 0xb6, 0x33, 0x30, 0xd0, 0xdd, 0x77, 0xff, 0xff,
+  0xa8, 0xcb, 0x6b, 0xff, 0xef, 0xfb, 0x1b, 0x1e, 0xbc, 0x7a, 0xf3, 0x33, 0x36, 0xbd, 0x63, 0x7f,
+  0xfd, 0xff, 0xd6, 0x18, 0xcd, 0x6c, 0x33, 0x1a, 0xda, 0xda, 0xcd, 0x6c, 0x30, 0xda, 0xc6, 0x0d,
+  0x6b, 0x2d, 0x7f, 0x7f, 0xf6, 0x30, 0xd6, 0xd6, 0xd8, 0xbc, 0x7b, 0x60, 0xd6, 0x6b, 0x33, 0x1b,
+  0x1b, 0x1b, 0x33, 0x31, 0x9a, 0xc0, 0x2d, 0x7f, 0xdf, 0xde, 0x36, 0x66, 0x6c, 0x00, 0x00, 0xfb,
+  0xfe, 0x63, 0x19, 0x99, 0x9a, 0xf5, 0x9a, 0xdf, 0x7f, 0xfd, 0x63, 0x33, 0x1b, 0x36, 0x33, 0x31,
+  0xf5, 0xe3, 0x31, 0x86, 0x5f, 0xff, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x0c, 0xc3, 0x06, 0x00, 0x59,
+  0x68, 0xb9, 0x6b, 0x40, 0xb4, 0x16, 0x80, 0x5a, 0xd3, 0x46, 0x80, 0x05, 0x96, 0x8b, 0x3b, 0x05,
+  0x89, 0xa1, 0xbb, 0x00, 0x1a, 0xc1, 0x8d, 0x66, 0x19, 0xad, 0x83, 0x6b, 0x1a, 0xcd, 0x60, 0xd6,
+  0x35, 0xac, 0x3f, 0x96, 0x8d, 0x1a, 0x35, 0xac, 0xb7, 0x4c, 0x18, 0xcc, 0xcc, 0xc8, 0x48, 0x6d,
+  0x9f, 0xfc, 0x2f, 0x46, 0x19, 0x98, 0xd9, 0xb3, 0x36, 0x66, 0x66, 0x18, 0x00, 0x7f, 0xdf, 0xff,
+  0xdb, 0x5b, 0x31, 0xe6, 0x7a, 0xf6, 0x6c, 0xd9, 0x99, 0xff, 0xfe, 0xe7, 0xfd, 0xac, 0xcc, 0xd9,
+  0xb6, 0x79, 0x9e, 0x6d, 0x8f, 0x19, 0x9a, 0xf5, 0x97, 0xaf, 0x9f, 0xf7, 0xff, 0x6b, 0x58, 0x7f,
+  0xf7, 0xfc, 0xda, 0xf5, 0xe3, 0x66, 0xc7, 0x8d, 0x98, 0xcc, 0x3f, 0xbf, 0xff, 0xe5, 0x72, 0xf5,
+  0x86, 0xd6, 0x66, 0xb6, 0x18, 0xd7, 0xac, 0x63, 0x35, 0xb0, 0xc6, 0xb6, 0x98, 0x58, 0xef, 0xff,
+  0xeb, 0x35, 0xb5, 0x8c, 0x30, 0x36, 0x34, 0x63, 0x5a, 0xda, 0xcd, 0x7a, 0xf5, 0xb3, 0x33, 0x33,
+  0x63, 0x1b, 0x58, 0x01, 0x5f, 0xff, 0xd9, 0xb1, 0xb3, 0x36, 0x30, 0x00, 0x0b, 0xff, 0x86, 0x36,
+  0xbc, 0x3d, 0x66, 0x1b, 0xff, 0xef, 0xed, 0x66, 0xbd, 0x7a, 0xf5, 0xe3, 0x63, 0x23, 0x1c, 0xc6,
+  0xc6, 0x35, 0x9f, 0xf7, 0xf3, 0x35, 0xb5, 0xb0, 0xd8, 0x63, 0x35, 0x8c, 0xb0, 0x05, 0xad, 0x0b,
+  0x55, 0x68, 0x00, 0x00, 0xec, 0xb4, 0xd0, 0x00, 0xb2, 0xd6, 0xb4, 0x16, 0x76, 0x16, 0xb4, 0xd0,
+  0xb1, 0x65, 0x8b, 0x34, 0xc3, 0x06, 0x6b, 0x61, 0x8c, 0x36, 0xb1, 0xad, 0xa6, 0x1a, 0xd6, 0x35,
+  0xac, 0x7d, 0xc0, 0x16, 0x03, 0x5a, 0xc3, 0x2e, 0xd6, 0x63, 0x36, 0x64, 0x94, 0x9f, 0x5f, 0xc0,
+  0x0c, 0x31, 0x8f, 0x5b, 0x66, 0x67, 0xaf, 0x1b, 0x18, 0xc6, 0x00, 0x7f, 0xff, 0xfb, 0x7c, 0x33,
+  0x63, 0x6c, 0xf1, 0xe6, 0xcd, 0x9b, 0x1f, 0xdf, 0xff, 0xed, 0x46, 0x36, 0x66, 0xd9, 0xb6, 0xd9,
+  0xb6, 0x6c, 0xcc, 0xcc, 0x31, 0x74, 0x73, 0x56, 0x03, 0xbf, 0xff, 0xfc, 0x99, 0x8d, 0x99, 0xb3,
+  0x36, 0x66, 0x66, 0x35, 0xef, 0xef, 0xff, 0xf9, 0x2c, 0x1a, 0xf5, 0x98, 0x6d, 0x66, 0x30, 0xc6,
+  0x6b, 0x6b, 0x61, 0xb5, 0x9a, 0xda, 0xd6, 0x1a, 0x3f, 0xff, 0xf0, 0x2b, 0x6b, 0x18, 0xc3, 0x5e,
+  0x67, 0xe3, 0xb4, 0xc1, 0x8c, 0x6d, 0x78, 0xcd, 0x8d, 0x8d, 0x8c, 0x6b, 0x68, 0x07, 0xff, 0xf5,
+  0x78, 0xcd, 0x99, 0x99, 0x80, 0x00, 0x1f, 0xf5, 0x66, 0x33, 0x33, 0x1a, 0xf7, 0x7f, 0xff, 0xd9,
+  0x6b, 0x59, 0x8c, 0xd8, 0xdb, 0x0c, 0x8c, 0x76, 0x33, 0x30, 0xc3, 0xff, 0xfd, 0x77, 0x6b, 0x19,
+  0x8c, 0x66, 0x31, 0x8c, 0x35, 0x81, 0x61, 0x68, 0x5a, 0x16, 0x00, 0x00, 0x00, 0xe6, 0x85, 0x8b,
+  0x2d, 0x69, 0xa0, 0x5a, 0xd2, 0xc3, 0x40, 0x16, 0xb5, 0xad, 0x6b, 0x2c, 0x6b, 0x0c, 0x31, 0x8d,
+  0x7a, 0xda, 0xda, 0xcc, 0x18, 0xd6, 0x0d, 0x60, 0x6b, 0x4e, 0xf9, 0x6b, 0x5a, 0xd6, 0xb5, 0x83,
+  0x2c, 0xd6, 0x1a, 0xd5, 0x99, 0x89, 0xa9, 0x5a, 0x06, 0x8c, 0x18, 0xcd, 0xaf, 0x1b, 0x66, 0x67,
+  0xaf, 0x5b, 0x18, 0xd0, 0x03, 0xff, 0xff, 0xce, 0xc6, 0x3c, 0x6d, 0x9b, 0x66, 0xd9, 0xeb, 0xcc,
+  0x6f, 0xff, 0xf6, 0xa1, 0x8f, 0x1b, 0x66, 0xdb, 0x66, 0xd9, 0xe3, 0x66, 0x66, 0x17, 0xf9, 0x80,
+  0x00, 0xff, 0xff, 0xf6, 0xec, 0x66, 0x6c, 0xcc, 0xd9, 0x9b, 0x19, 0x8c, 0x7f, 0xff, 0xc8, 0x6b,
+  0x35, 0x9a, 0xd8, 0x66, 0x19, 0xad, 0xad, 0xad, 0xad, 0xad, 0x8c, 0x63, 0x0c, 0x1a, 0x6b, 0xfe,
+  0xff, 0xed, 0x6d, 0x66, 0x35, 0xeb, 0x2d, 0xf1, 0x6f, 0x75, 0x96, 0x6b, 0x30, 0xf5, 0xb1, 0xb3,
+  0x1e, 0xbd, 0x7a, 0xd8, 0x60, 0x68, 0x7d, 0xff, 0xf3, 0x33, 0x36, 0x66, 0x36, 0x30, 0x00, 0x07,
+  0xff, 0xdb, 0x5b, 0x19, 0x98, 0x6f, 0xfb, 0xfe, 0x6b, 0x0c, 0x6c, 0x6d, 0x8c, 0x64, 0x64, 0x7a,
+  0xf5, 0xb0, 0xc3, 0xfb, 0xfe, 0xb3, 0x0c, 0xcc, 0x63, 0x31, 0x8c, 0x19, 0x60, 0x2c, 0x85, 0xa0,
+  0x80, 0x00, 0x00, 0x01, 0xd6, 0x59, 0x34, 0xd0, 0x16, 0x4b, 0x5b, 0x10, 0x2c, 0xb4, 0xd1, 0xa6,
+  0xb5, 0x83, 0x59, 0x83, 0x30, 0xcc, 0x61, 0xb5, 0x8c, 0xbd, 0x6b, 0x0d, 0x65, 0x9a, 0x68, 0xff,
+  0xe3, 0x40, 0x1a, 0x60, 0x60, 0xc1, 0xac, 0xb2, 0xd2, 0x32, 0x1e, 0x9a, 0x34, 0xd6, 0x6b, 0x31,
+  0xb1, 0xb3, 0x66, 0xc7, 0x8c, 0xcc, 0x30, 0x03, 0xbf, 0xff, 0xfc, 0x0c, 0x6c, 0xcd, 0x9b, 0x6c,
+  0xf1, 0xe6, 0xcc, 0xcf, 0xff, 0xf6, 0xaf, 0xfb, 0x35, 0xe6, 0x67, 0x9b, 0x3c, 0xf1, 0xe7, 0xaf,
+  0x33, 0x31, 0x9a, 0xe7, 0x18, 0x60, 0x07, 0xf7, 0xff, 0xf7, 0x86, 0xcc, 0xcd, 0x8f, 0x1b, 0x1b,
+  0x18, 0xcf, 0xff, 0xf8, 0xee, 0xb3, 0x58, 0xcd, 0x6d, 0x6c, 0x31, 0xaf, 0x59, 0x8c, 0x66, 0x31,
+  0x98, 0x60, 0xd6, 0xb7, 0x7f, 0xff, 0xd9, 0x99, 0x86, 0x33, 0x1a, 0xca, 0xf2, 0xd3, 0x58, 0x30,
+  0xc6, 0x66, 0x66, 0x66, 0xc6, 0x66, 0x18, 0x69, 0xa3, 0xff, 0xff, 0x2e, 0x66, 0x66, 0xc6, 0xc6,
+  0xd6, 0xd6, 0x00, 0x01, 0x7f, 0x5b, 0x1b, 0x5e, 0xb2, 0xff, 0xfe, 0xd6, 0xb5, 0x9a, 0xf5, 0xb3,
+  0x36, 0x6c, 0x66, 0x65, 0xe3, 0x36, 0xb6, 0xb3, 0x5f, 0xff, 0x7c, 0xc3, 0x6b, 0x63, 0x1b, 0x0d,
+  0xac, 0xc1, 0x96, 0x05, 0x90, 0x5a, 0x2d, 0x05, 0x80, 0x00, 0x00, 0x0f, 0xb5, 0xa0, 0x05, 0x93,
+  0x4b, 0x6b, 0x21, 0x65, 0xa3, 0x40, 0x68, 0xd6, 0x0c, 0x19, 0xaf, 0x58, 0xc6, 0x61, 0x98, 0x6b,
+  0x69, 0x81, 0xac, 0x01, 0xaf, 0xfb, 0xff, 0xf8, 0xb2, 0xd6, 0x01, 0x83, 0x0c, 0x0c, 0xb2, 0xc8,
+  0xfc, 0xf3, 0x5a, 0x6b, 0x5a, 0xc6, 0xb6, 0xbd, 0x6c, 0xcc, 0xdb, 0x1e, 0x36, 0x36, 0x18, 0x00,
+  0xff, 0xbf, 0xff, 0x86, 0x66, 0xcd, 0x9b, 0x6c, 0xdb, 0x3c, 0x78, 0xcf, 0xfb, 0xff, 0xfd, 0x81,
+  0xb5, 0xeb, 0xc7, 0x9b, 0x3c, 0xdb, 0x67, 0x8f, 0x1e, 0xbd, 0x6d, 0x7a, 0xb4, 0xc1, 0x00, 0x03,
+  0xff, 0xff, 0xd0, 0xd8, 0xcd, 0x8d, 0xb1, 0xb3, 0x33, 0x18, 0xdf, 0xff, 0x7f, 0xc1, 0x86, 0x30,
+  0xda, 0xcc, 0x6b, 0x61, 0x98, 0xcc, 0xd7, 0xad, 0xad, 0xac, 0x6b, 0x2c, 0xff, 0xff, 0xad, 0xb5,
+  0x98, 0xc6, 0x33, 0x2b, 0xac, 0xea, 0xf0, 0x35, 0x98, 0xc6, 0xc6, 0x6c, 0x6c, 0xc6, 0x63, 0x06,
+  0xb4, 0x7f, 0x7f, 0xfd, 0x99, 0x99, 0x9b, 0x19, 0x98, 0x60, 0x00, 0x03, 0xfa, 0xd8, 0xc6, 0xff,
+  0xfe, 0x2d, 0x30, 0xd7, 0x8c, 0xd9, 0x9b, 0x19, 0x99, 0xe6, 0x3d, 0x66, 0x0d, 0xff, 0xfe, 0xc9,
+  0x6d, 0x6d, 0x6c, 0x63, 0x63, 0x19, 0x86, 0x35, 0x96, 0x0b, 0x5a, 0x2d, 0x16, 0x85, 0x91, 0x80,
+  0x00, 0x00, 0x17, 0x02, 0xcb, 0x4d, 0x05, 0xc5, 0xa2, 0xd6, 0x9a, 0x00, 0x5b, 0x46, 0xb0, 0x61,
+  0x8d, 0x7a, 0xcc, 0x66, 0x19, 0xad, 0xac, 0x35, 0x86, 0x99, 0x60, 0x1b, 0xff, 0xff, 0xd7, 0xfb,
+  0x4d, 0x1a, 0x65, 0xb4, 0xc6, 0xb3, 0x03, 0x59, 0x62, 0x38, 0x36, 0xb5, 0xad, 0x6b, 0x06, 0x1b,
+  0x5e, 0xbd, 0x78, 0xf1, 0xb6, 0x66, 0x63, 0x6b, 0x30, 0x07, 0xff, 0xf7, 0xfd, 0x6d, 0x6c, 0xcd,
+  0xb3, 0x6c, 0xf3, 0x67, 0x8f, 0x1b, 0x77, 0xff, 0xfb, 0x03, 0x1b, 0x33, 0xc7, 0x9e, 0x6c, 0xf3,
+  0x6c, 0xd8, 0xd8, 0xcd, 0x5d, 0x76, 0x68, 0x00, 0xff, 0xfb, 0xf9, 0x99, 0x8f, 0x5e, 0xbc, 0x7a,
+  0xf1, 0x99, 0x9a, 0xdb, 0xef, 0xff, 0xf8, 0x30, 0xc3, 0x0d, 0xac, 0xd6, 0xc3, 0x18, 0xcc, 0x66,
+  0x63, 0x35, 0xeb, 0x1a, 0xc5, 0xbf, 0xfe, 0xff, 0x8c, 0x66, 0xb6, 0x33, 0x15, 0x55, 0x54, 0x6b,
+  0xd1, 0x8d, 0x6c, 0x66, 0x36, 0x66, 0x63, 0xd6, 0xd7, 0xac, 0x1a, 0xd6, 0xef, 0xff, 0xfb, 0xfb,
+  0x33, 0x33, 0x33, 0x33, 0x18, 0xc0, 0x00, 0x00, 0xfe, 0xda, 0x7f, 0xd0, 0xb5, 0x83, 0x1b, 0x1b,
+  0x63, 0xd1, 0xa1, 0xa6, 0x6c, 0x63, 0x1a, 0xbf, 0xff, 0xd9, 0x58, 0xc6, 0x66, 0x33, 0x31, 0x9a,
+  0xf5, 0x86, 0xb1, 0x62, 0xd3, 0x76, 0x42, 0x05, 0xa3, 0x4b, 0x00, 0x00, 0x00, 0x5c, 0xb5, 0xad,
+  0x00, 0x5d, 0x5b, 0x5a, 0xd0, 0x05, 0x85, 0x83, 0x4c, 0x35, 0xb5, 0x9a, 0xd8, 0x66, 0x33, 0x5b,
+  0x5b, 0x58, 0x6b, 0x06, 0x99, 0x65, 0x82, 0xff, 0xff, 0xef, 0x02, 0xc6, 0x98, 0x6b, 0x6b, 0x18,
+  0x35, 0x96, 0x23, 0x12, 0xfb, 0x2d, 0x65, 0x8d, 0x63, 0x31, 0x9b, 0x33, 0x66, 0xcd, 0x8c, 0xcc,
+  0x30, 0x07, 0xff, 0xff, 0xaf, 0xf3, 0x1b, 0x33, 0x66, 0xdb, 0x3c, 0xd9, 0xe3, 0xcc, 0xcf, 0xff,
+  0xf6, 0x0e, 0x6c, 0x67, 0x99, 0xbc, 0xd9, 0xe6, 0xdb, 0x33, 0x3d, 0x66, 0x2a, 0x6d, 0x86, 0x80,
+  0x1d, 0xff, 0xff, 0xe3, 0xeb, 0x6b, 0xc6, 0x6c, 0x7a, 0xf1, 0xb1, 0x99, 0x87, 0xff, 0xf7, 0xc3,
+  0x0d, 0x7a, 0xc6, 0x33, 0x59, 0x8c, 0x66, 0xbc, 0x66, 0x33, 0x18, 0xd6, 0x0f, 0xef, 0xff, 0xe1,
+  0x9a, 0xf5, 0xb5, 0xeb, 0x63, 0x53, 0x50, 0xcd, 0x1a, 0xd6, 0x6b, 0x33, 0x19, 0x99, 0x9b, 0x19,
+  0x8c, 0xc1, 0xad, 0x6b, 0xff, 0xef, 0xac, 0xcc, 0x7a, 0xd9, 0x98, 0xcc, 0x30, 0x00, 0x00, 0x1d,
+  0xff, 0x76, 0x81, 0x60, 0xcc, 0xcc, 0xd9, 0x98, 0xd4, 0xd8, 0xd8, 0xda, 0xcd, 0x6f, 0xfb, 0xff,
+  0xe6, 0xb6, 0x1b, 0x19, 0x98, 0xcc, 0xd7, 0xad, 0x7a, 0x65, 0x8b, 0x20, 0x41, 0x0b, 0x5a, 0x05,
+  0x96, 0x98, 0x00, 0x01, 0x2d, 0x28, 0x02, 0xd5, 0xed, 0xc6, 0x80, 0x16, 0x59, 0x65, 0x86, 0xb5,
+  0x9a, 0xcd, 0x66, 0x31, 0x98, 0x6d, 0x6d, 0x66, 0x5e, 0x99, 0x66, 0x8d, 0x6b, 0x2c, 0x5b, 0xff,
+  0xbf, 0xff, 0xfa, 0x74, 0xd6, 0xb0, 0x18, 0xc3, 0x0c, 0x35, 0x96, 0x05, 0x45, 0x05, 0x96, 0x06,
+  0xb6, 0xb3, 0x31, 0xeb, 0xc6, 0xd9, 0x9b, 0x31, 0xb5, 0xb5, 0x80, 0x3f, 0xff, 0xfc, 0xa3, 0x63,
+  0x3d, 0x79, 0xeb, 0xd9, 0xe6, 0xcf, 0x33, 0x66, 0x7f, 0xff, 0xb0, 0x7f, 0xfc, 0xcc, 0xcd, 0xb3,
+  0x6d, 0xb3, 0xcd, 0x9e, 0x3c, 0x66, 0x62, 0x92, 0xc4, 0x68, 0x00, 0xff, 0xff, 0xf6, 0xe6, 0x63,
+  0x66, 0x66, 0x6c, 0x7a, 0xd8, 0xcc, 0x7d, 0xff, 0xfc, 0x30, 0xc3, 0x18, 0xc3, 0x30, 0x33, 0x19,
+  0x99, 0x8c, 0xc3, 0x59, 0xab, 0xff, 0xfe, 0x6e, 0xda, 0xcc, 0x66, 0x36, 0x32, 0x8a, 0x66, 0x49,
+  0xad, 0x66, 0xb3, 0x18, 0xd8, 0xd8, 0xd8, 0xda, 0xf5, 0xb5, 0x8d, 0x6b, 0x57, 0xff, 0xfd, 0x99,
+  0x99, 0x8d, 0x8d, 0x8d, 0xad, 0xad, 0xac, 0x00, 0x00, 0x0f, 0xfb, 0xab, 0x45, 0x81, 0x8d, 0xaf,
+  0x1b, 0x3d, 0x78, 0xdc, 0xdf, 0x66, 0x66, 0x0c, 0xff, 0xfb, 0xfe, 0xbd, 0x63, 0x61, 0xeb, 0x63,
+  0x63, 0x18, 0xc1, 0xac, 0x59, 0x34, 0xb4, 0x20, 0x9a, 0x16, 0x2d, 0x68, 0x05, 0xa0, 0xb4, 0x09,
+  0xa0, 0xbb, 0x2d, 0x30, 0x2e, 0xc0, 0x2c, 0xb5, 0x96, 0xb2, 0xc1, 0x96, 0x60, 0xcc, 0x33, 0x19,
+  0xaf, 0x59, 0x86, 0x0c, 0xb0, 0xd3, 0x4d, 0x6b, 0x59, 0x7f, 0xff, 0xf5, 0x7c, 0x34, 0x35, 0x9a,
+  0xc3, 0x30, 0xc1, 0xac, 0x58, 0x48, 0x45, 0x60, 0xb3, 0x4c, 0x33, 0x19, 0x99, 0xb6, 0x3c, 0x6c,
+  0xda, 0xd8, 0xd6, 0x01, 0xdf, 0xff, 0xfd, 0xe3, 0x33, 0x36, 0xcd, 0xb3, 0xcd, 0xb3, 0xcd, 0x99,
+  0x9f, 0xf7, 0xff, 0xfa, 0xb3, 0x1b, 0x36, 0x6d, 0xb6, 0x6f, 0x33, 0xcc, 0xf5, 0xe3, 0x1b, 0x4f,
+  0xd6, 0x0d, 0x00, 0x1f, 0xf7, 0xff, 0x31, 0x99, 0x9b, 0x5e, 0x63, 0xd7, 0x87, 0xac, 0xd6, 0xff,
+  0xfe, 0xfb, 0x58, 0x6b, 0x6b, 0x6b, 0x35, 0xeb, 0x18, 0x19, 0xb1, 0x99, 0x98, 0xc3, 0x0d, 0x7f,
+  0xff, 0xcb, 0x7d, 0x9a, 0xcc, 0xc6, 0xd7, 0xaf, 0x5b, 0x4f, 0xc8, 0xc5, 0x6b, 0x06, 0xb6, 0x19,
+  0x99, 0x98, 0xf5, 0xb3, 0x5e, 0xbd, 0x6b, 0xd3, 0x59, 0x7f, 0xff, 0x7c, 0x6d, 0x6c, 0x6d, 0x78,
+  0xcc, 0xd7, 0xac, 0x60, 0x00, 0x00, 0x7f, 0xff, 0x6a, 0xd0, 0x0d, 0x66, 0x36, 0x66, 0x78, 0x38,
+  0x39, 0x6c, 0x66, 0x35, 0x9f, 0xff, 0xee, 0x1f, 0xd8, 0x6d, 0x6c, 0xd7, 0x8d, 0xaf, 0x5e, 0xb6,
+  0xb3, 0x06, 0x59, 0x6b, 0x41, 0x0b, 0x4b, 0x40, 0x59, 0x69, 0xa0, 0x16, 0x80, 0x9a, 0xb2, 0xd0,
+  0x07, 0x5a, 0xc3, 0xbe, 0x05, 0x96, 0xb5, 0xad, 0x6b, 0x58, 0x0d, 0x66, 0xb1, 0x8c, 0x1a, 0xf5,
+  0xb5, 0xb0, 0xc6, 0xb6, 0x98, 0x01, 0xa3, 0x5a, 0x6b, 0xef, 0xff, 0xfe, 0x3c, 0xb1, 0x6d, 0x31,
+  0xad, 0xad, 0xac, 0xcb, 0xd3, 0x2c, 0x07, 0x86, 0xf0, 0x06, 0xb0, 0xd7, 0xad, 0x8d, 0x8f, 0x1b,
+  0x63, 0xc6, 0xd7, 0x86, 0x00, 0x7f, 0x7f, 0xff, 0xf6, 0x63, 0x1e, 0xbd, 0x7b, 0x33, 0xd9, 0xb6,
+  0xd9, 0xb6, 0x6c, 0x3f, 0xff, 0xd5, 0xbd, 0x66, 0x7a, 0xf3, 0x6c, 0x1e, 0xd9, 0xe3, 0xcc, 0xc7,
+  0xac, 0x9b, 0xa7, 0xc6, 0x80, 0x0b, 0xff, 0xff, 0xcd, 0xaf, 0x5b, 0x1b, 0x1b, 0x33, 0x6b, 0xc6,
+  0x6b, 0xd6, 0xef, 0xff, 0xe9, 0x86, 0x18, 0x63, 0x18, 0xc0, 0x78, 0xcd, 0xaf, 0x18, 0xcd, 0x63,
+  0x5f, 0xff, 0x7f, 0xd6, 0x6b, 0x63, 0x33, 0x1b, 0x1a, 0x6e, 0x26, 0x0e, 0xc1, 0x86, 0x31, 0xb1,
+  0x99, 0x99, 0x98, 0xc6, 0x35, 0xac, 0xff, 0xbf, 0xfe, 0x30, 0xd8, 0xcc, 0xcc, 0xc6, 0x35, 0xeb,
+  0x58, 0x00, 0x01, 0xf7, 0xfd, 0xa5, 0xa1, 0xa6, 0xb6, 0xbd, 0x6c, 0xd9, 0x9b, 0x1d, 0x1d, 0xe6,
+  0x36, 0xb6, 0xb1, 0xff, 0xfe, 0xe5, 0xcc, 0x63, 0x6b, 0xc6, 0x66, 0x63, 0x31, 0xad, 0xa6, 0x5a,
+  0xd6, 0x84, 0xdd, 0xa0, 0x81, 0x65, 0xa6, 0x9a, 0x0b, 0x2d, 0x02, 0xd0, 0x2d, 0x00, 0x1d, 0x8f,
+  0x83, 0x85, 0x96, 0xb5, 0xa6, 0xb5, 0xad, 0x60, 0xd6, 0x18, 0xc0, 0x0c, 0xcc, 0x63, 0x0c, 0x35,
+  0x8b, 0x1a, 0x06, 0x86, 0xbf, 0xff, 0xf9, 0x7f, 0xed, 0x1a, 0xc1, 0x86, 0x6b, 0xd6, 0x30, 0x65,
+  0x80, 0xc0, 0xb2, 0xcd, 0x0d, 0x00, 0x3c, 0xcc, 0xcd, 0x9b, 0x33, 0x66, 0x33, 0x00, 0x1f, 0xff,
+  0x7f, 0xff, 0x61, 0xb3, 0x33, 0xcc, 0xf3, 0xcd, 0xb3, 0xcd, 0x99, 0xb3, 0xff, 0xfd, 0x5f, 0xe6,
+  0x66, 0xcd, 0xb0, 0x1f, 0x9e, 0x67, 0x8d, 0x98, 0xc9, 0x6a, 0x30, 0x30, 0x03, 0xff, 0xfb, 0xe6,
+  0x33, 0x33, 0x33, 0x36, 0x36, 0x33, 0x0d, 0xff, 0x7f, 0xd6, 0x18, 0x33, 0x59, 0x86, 0x60, 0x36,
+  0xc6, 0xc6, 0x66, 0x30, 0x6f, 0xfb, 0xff, 0xfe, 0x27, 0x59, 0x8c, 0x6d, 0x78, 0xcd, 0xaf, 0x4c,
+  0x40, 0xbd, 0x86, 0xb1, 0x8c, 0x63, 0x63, 0x63, 0x33, 0x35, 0xeb, 0x0d, 0x65, 0xff, 0xff, 0x49,
+  0xc3, 0x31, 0x99, 0x98, 0xda, 0xd8, 0x63, 0x58, 0x58, 0x00, 0x3f, 0xfa, 0x82, 0x69, 0xac, 0x6b,
+  0xc6, 0x6c, 0xd9, 0x8f, 0x4f, 0x9e, 0xbd, 0x7a, 0xc6, 0x1f, 0xff, 0xee, 0x83, 0x19, 0x99, 0x98,
+  0xf5, 0xb1, 0x98, 0xd6, 0x6b, 0x5a, 0xd6, 0x82, 0x16, 0x96, 0x8b, 0x2d, 0x69, 0xa1, 0xa2, 0xc5,
+  0xa0, 0x2d, 0x02, 0xd3, 0x42, 0xc6, 0x46, 0x2f, 0x2c, 0xb5, 0xad, 0x34, 0xd3, 0x59, 0x60, 0xd6,
+  0x6b, 0x35, 0xb4, 0x06, 0xc6, 0x61, 0x8c, 0x1a, 0xc0, 0x58, 0x68, 0x0f, 0xbf, 0xff, 0xf7, 0x8b,
+  0x68, 0xc3, 0x1a, 0xf5, 0x98, 0xcb, 0xd3, 0x16, 0x09, 0x08, 0x03, 0x40, 0x00, 0x7b, 0x33, 0x66,
+  0x7a, 0xf1, 0xb3, 0x31, 0x80, 0x0f, 0xff, 0xff, 0x5f, 0xeb, 0x1b, 0x1b, 0x3c, 0xcf, 0x37, 0x99,
+  0xe7, 0x8f, 0x1b, 0x3f, 0xff, 0xd6, 0x3f, 0xff, 0xd3, 0x7d, 0x6c, 0xcf, 0x18, 0x0d, 0xed, 0xb6,
+  0x66, 0x6c, 0x64, 0x94, 0xf6, 0x1a, 0x00, 0x3f, 0xbf, 0xfe, 0x6b, 0x63, 0x6b, 0xc6, 0x6c, 0xcc,
+  0xc6, 0x63, 0x5f, 0xfd, 0xfd, 0x8d, 0x63, 0x5b, 0x59, 0xad, 0xad, 0xa0, 0x78, 0xcd, 0x98, 0xcc,
+  0x63, 0x4f, 0xff, 0xf8, 0x56, 0xb6, 0xb6, 0x1e, 0xb6, 0x66, 0x66, 0x96, 0x7a, 0x74, 0x35, 0x83,
+  0x30, 0xda, 0xf5, 0xb3, 0x1b, 0x18, 0xcc, 0x1a, 0xcf, 0xfb, 0xff, 0xfb, 0x18, 0xd7, 0x87, 0xad,
+  0xaf, 0x0c, 0xc6, 0xb6, 0xb5, 0x8b, 0x40, 0x0e, 0xff, 0x88, 0x5a, 0xd6, 0xb3, 0x0d, 0x99, 0x9b,
+  0x61, 0xfa, 0x0d, 0xe3, 0x30, 0xc7, 0x7f, 0xff, 0xbb, 0x59, 0x8c, 0x6c, 0x6c, 0x6c, 0xd7, 0x86,
+  0x6b, 0x34, 0xd6, 0xb4, 0xdd, 0x90, 0x85, 0xa5, 0x93, 0x4d, 0x0d, 0x02, 0xcb, 0x5a, 0x05, 0xa0,
+  0xb5, 0xa0, 0x0c, 0x5c, 0x35, 0xcb, 0x5a, 0x6b, 0x4d, 0x34, 0xd6, 0x03, 0x06, 0x30, 0x03, 0x36,
+  0xb3, 0x35, 0x9a, 0xcd, 0x6b, 0x2c, 0x0b, 0x02, 0xc7, 0xff, 0xff, 0x07, 0xff, 0x6b, 0x2d, 0xa6,
+  0x6b, 0x31, 0x98, 0x60, 0xcb, 0x01, 0xa1, 0x61, 0xa0, 0x00, 0x0f, 0xd8, 0xd9, 0xb3, 0x63, 0xd7,
+  0x8c, 0x66, 0x00, 0xff, 0xff, 0xf3, 0xf9, 0x8c, 0xd8, 0xf3, 0x67, 0x9b, 0x6d, 0xb3, 0x6c, 0xd9,
+  0x9f, 0xf7, 0xff, 0xfa, 0x73, 0x1b, 0x3d, 0x78, 0x03, 0xdf, 0xaf, 0x36, 0x66, 0xd6, 0xc8, 0xe9,
+  0xac, 0x00, 0x01, 0xff, 0xff, 0xe8, 0x63, 0x1b, 0x1b, 0x33, 0x33, 0x33, 0x18, 0xd7, 0xff, 0xf4,
+  0x30, 0x61, 0x9a, 0xcc, 0x60, 0xda, 0xf1, 0xb3, 0x1b, 0x5e, 0xb1, 0x9f, 0xff, 0xf0, 0x3c, 0xc3,
+  0x31, 0xb5, 0xe3, 0x63, 0x64, 0x9b, 0x9b, 0x6e, 0xb5, 0x8c, 0x31, 0x98, 0xcc, 0xcc, 0x6d, 0x7a,
+  0xcc, 0x1a, 0xcf, 0xff, 0xf9, 0xae, 0xc6, 0x1b, 0x5b, 0x1b, 0x5b, 0x18, 0xc6, 0x1a, 0xd6, 0xb4,
+  0x00, 0xff, 0xaa, 0xd0, 0xb2, 0xc6, 0xb6, 0xbd, 0x6d, 0x8f, 0x19, 0x09, 0x10, 0xcd, 0xad, 0xac,
+  0x7d, 0xff, 0xfe, 0xf0, 0xc6, 0x36, 0xbc, 0x66, 0xc6, 0x66, 0x61, 0x83, 0x5a, 0x68, 0x2d, 0x5a,
+  0x10, 0x5a, 0x34, 0x00, 0x05, 0x96, 0x80, 0xb4, 0x16, 0xb4, 0x03, 0x0b, 0x02, 0xc7, 0xcb, 0x4d,
+  0x34, 0xd3, 0x5a, 0xcb, 0x1a, 0xc3, 0x0c, 0x60, 0xc3, 0xd6, 0x33, 0x0c, 0x0d, 0x62, 0xc5, 0x96,
+  0x59, 0x67, 0xf7, 0xff, 0xfe, 0xc3, 0x4d, 0x63, 0x0c, 0x66, 0x30, 0xc6, 0xb2, 0xc0, 0x80, 0x66,
+  0x80, 0x00, 0x07, 0xb6, 0xda, 0xf3, 0x36, 0x66, 0xc6, 0x60, 0x01, 0xff, 0xff, 0xe0, 0x63, 0x33,
+  0x67, 0xaf, 0x66, 0xf3, 0x3d, 0x9b, 0x66, 0xcc, 0x7f, 0xff, 0xa7, 0xb1, 0xb3, 0x60, 0x06, 0xfd,
+  0x9b, 0x66, 0x63, 0x6a, 0x2a, 0x5e, 0xc0, 0x00, 0x3f, 0xfe, 0xfe, 0x31, 0x99, 0x99, 0x9b, 0x19,
+  0xb1, 0x8c, 0x37, 0xff, 0xfb, 0x41, 0xac, 0x30, 0xc3, 0x30, 0xcd, 0xaf, 0x19, 0xb3, 0x31, 0xb5,
+  0x9a, 0xff, 0xfb, 0xff, 0x9a, 0xda, 0xcc, 0xcc, 0xcc, 0xcc, 0xda, 0x45, 0xb1, 0x9e, 0xc1, 0xad,
+  0xac, 0xc6, 0x63, 0x33, 0x31, 0x98, 0xd6, 0xd3, 0x3f, 0xef, 0xff, 0xac, 0xd6, 0x61, 0xb1, 0x8d,
+  0xaf, 0x58, 0xcd, 0x66, 0xb4, 0xd0, 0x41, 0x7f, 0xd6, 0xed, 0x69, 0x60, 0x63, 0x19, 0xb3, 0x36,
+  0x22, 0xa3, 0x9e, 0xb3, 0x35, 0x9b, 0xff, 0xef, 0xff, 0xe6, 0xbd, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x6b, 0x6b, 0x1a, 0x6b, 0x40, 0x85, 0xab, 0x42, 0xd0, 0x1a, 0x01, 0x61, 0x6b, 0x5a, 0x0b, 0x5a,
+  0x2d, 0x68, 0x05, 0xfd, 0xea, 0xc3, 0xe5, 0xa6, 0x9a, 0x6b, 0x5a, 0xcb, 0x69, 0x83, 0x18, 0x66,
+  0x31, 0xb5, 0x98, 0xc6, 0xb1, 0xad, 0x6b, 0x2c, 0xb5, 0xad, 0x6b, 0x5b, 0xff, 0xff, 0x6b, 0xe1,
+  0xa6, 0x30, 0xcc, 0x63, 0x35, 0x9a, 0xd6, 0x01, 0x00, 0x80, 0x00, 0x00, 0xde, 0xf1, 0xb3, 0x36,
+  0x6c, 0x6c, 0x63, 0x00, 0xef, 0xff, 0xfe, 0xe1, 0x99, 0x9b, 0x36, 0xcf, 0x36, 0xd9, 0xe6, 0xd9,
+  0xb3, 0x1f, 0xff, 0xea, 0x1f, 0xf6, 0x33, 0xd7, 0x98, 0x06, 0xf7, 0x9b, 0x36, 0x36, 0xbd, 0x43,
+  0xc9, 0xeb, 0x00, 0x01, 0xf7, 0xff, 0xff, 0x86, 0x61, 0xb1, 0xb5, 0xe3, 0x66, 0x63, 0x6b, 0x60,
+  0xdf, 0xff, 0xec, 0xa6, 0x06, 0x30, 0xc6, 0x33, 0x33, 0x6b, 0xcc, 0xcc, 0x6c, 0x1f, 0x7f, 0xff,
+  0xbb, 0x1a, 0xda, 0xd8, 0xda, 0xf1, 0xb3, 0x33, 0x48, 0x33, 0x30, 0xd8, 0xd6, 0x30, 0xcc, 0x63,
+  0x63, 0x31, 0x98, 0xd6, 0xd3, 0x3f, 0xff, 0xe4, 0x7e, 0xc3, 0x0c, 0xc6, 0x6b, 0xc3, 0x31, 0x86,
+  0x1a, 0x34, 0xb4, 0x1f, 0x7c, 0x96, 0xb4, 0x0d, 0x63, 0x33, 0x1e, 0x36, 0xc9, 0x29, 0x5b, 0x31,
+  0x98, 0x3f, 0xff, 0xbf, 0xf8, 0xc6, 0x63, 0x63, 0xd7, 0xaf, 0x5e, 0xbd, 0x6d, 0x6d, 0x61, 0xa6,
+  0xb4, 0x5a, 0x10, 0x82, 0x68, 0x05, 0x80, 0x16, 0x5a, 0xd0, 0x13, 0x45, 0xad, 0x02, 0xbc, 0xba,
+  0x2c, 0x1d, 0xda, 0x69, 0xad, 0x6b, 0x59, 0x6d, 0x35, 0x9a, 0xcd, 0x6d, 0x6d, 0x7a, 0xcc, 0x66,
+  0x18, 0xd6, 0x35, 0xad, 0x6b, 0x5a, 0xd3, 0x4d, 0x37, 0xff, 0xdf, 0xff, 0xfa, 0x76, 0x06, 0x31,
+  0x8c, 0x6d, 0x6d, 0x61, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x66, 0xcc, 0xd8, 0xf5,
+  0xb0, 0xc0, 0x3f, 0xbf, 0xff, 0xfa, 0xf3, 0x5e, 0xb6, 0x6c, 0xdb, 0x37, 0x99, 0xec, 0xf3, 0x3d,
+  0x79, 0x8f, 0xff, 0xbf, 0xff, 0xd2, 0x2c, 0xd8, 0xf3, 0x00, 0x7f, 0x9b, 0x66, 0x66, 0x62, 0x12,
+  0x41, 0xac, 0x00, 0x07, 0xff, 0xff, 0xa5, 0xb5, 0xb5, 0xeb, 0x66, 0x3d, 0x7a, 0xf1, 0x98, 0xcd,
+  0x6d, 0x6f, 0xff, 0xf6, 0x26, 0x5e, 0x98, 0x63, 0x0d, 0xad, 0x99, 0x9b, 0x33, 0x33, 0x19, 0xaf,
+  0xff, 0xf7, 0x31, 0x86, 0x66, 0x36, 0x6d, 0x78, 0xf5, 0xa3, 0xd8, 0x16, 0xc3, 0x06, 0x6b, 0x6b,
+  0x63, 0x31, 0x98, 0xda, 0xcd, 0x66, 0xb7, 0xdf, 0xff, 0xf1, 0x58, 0x30, 0xc6, 0xd6, 0xd7, 0xac,
+  0xc6, 0x6b, 0x6b, 0x00, 0x16, 0x93, 0x7f, 0xff, 0xfa, 0x74, 0x2d, 0x34, 0xd6, 0x31, 0x99, 0xb3,
+  0x31, 0x31, 0x39, 0x99, 0xaf, 0x58, 0x7f, 0xff, 0xc3, 0xff, 0xf6, 0x6b, 0x63, 0x6b, 0xc7, 0xad,
+  0x99, 0x8d, 0xad, 0xac, 0x34, 0xd3, 0x56, 0x45, 0xab, 0x42, 0xd0, 0x58, 0x05, 0x81, 0x62, 0xd6,
+  0x81, 0x68, 0x13, 0x42, 0xd7, 0x57, 0x16, 0x58, 0xb1, 0xfc, 0xd6, 0xb5, 0xad, 0x65, 0x86, 0xb0,
+  0x63, 0x0c, 0xc6, 0x33, 0x18, 0x66, 0xb0, 0x69, 0xad, 0x34, 0xd1, 0xa0, 0xff, 0xff, 0xd6, 0xe6,
+  0x59, 0x86, 0x31, 0xb0, 0xcd, 0x63, 0x58, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xcc, 0xd8, 0xf1,
+  0xb3, 0x31, 0x98, 0x03, 0xff, 0xbf, 0xff, 0xfa, 0x71, 0x98, 0xf1, 0xb6, 0xcd, 0xb6, 0xd9, 0xe6,
+  0xd9, 0x9b, 0x17, 0xff, 0xfa, 0x4e, 0xbc, 0x6c, 0xf0, 0x06, 0xf6, 0xd9, 0xb1, 0xeb, 0x62, 0x06,
+  0x34, 0xd6, 0x00, 0x07, 0xff, 0xf7, 0xd7, 0xac, 0x6c, 0x66, 0x66, 0xc6, 0xc6, 0x61, 0x9a, 0xdf,
+  0xff, 0xec, 0x16, 0x0c, 0x30, 0xc6, 0x63, 0xd6, 0xda, 0xf3, 0x33, 0x6b, 0xd6, 0x6f, 0xff, 0xf7,
+  0x0f, 0x8d, 0x66, 0x36, 0xbc, 0x67, 0xad, 0x9b, 0x11, 0xcb, 0x4a, 0xa6, 0xb1, 0x86, 0xbd, 0x6d,
+  0x6c, 0x63, 0x33, 0x5e, 0xb3, 0x58, 0xd7, 0xff, 0x7f, 0xf6, 0x0c, 0x33, 0x5e, 0xb3, 0x18, 0xcc,
+  0x31, 0x8b, 0x6a, 0xc4, 0x11, 0xff, 0xfd, 0xd0, 0xb5, 0xac, 0xb6, 0xb3, 0x19, 0xb3, 0x36, 0x50,
+  0x52, 0x66, 0x61, 0x9a, 0xff, 0xff, 0x89, 0xeb, 0x31, 0x99, 0x9b, 0x1b, 0x31, 0xb1, 0x8d, 0x66,
+  0x9a, 0x68, 0xb4, 0x42, 0xd5, 0xad, 0x2c, 0x2c, 0x2c, 0x05, 0x8b, 0x2d, 0x1b, 0xb1, 0x02, 0xd0,
+  0x2b, 0x8b, 0x5c, 0xb5, 0xac, 0x0f, 0x96, 0x5a, 0xd6, 0x2c, 0xd3, 0x2f, 0x5a, 0xd8, 0x36, 0x19,
+  0x8c, 0x63, 0x1a, 0xc0, 0xd3, 0x46, 0x80, 0x0f, 0xff, 0xfd, 0x9f, 0xff, 0xe6, 0x98, 0xd6, 0xc3,
+  0x61, 0xb5, 0xb5, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x5e, 0x3d, 0x78, 0xd9, 0x99,
+  0x8d, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xeb, 0x6b, 0xd6, 0xcd, 0x99, 0xe7, 0x99, 0xec, 0xf3, 0x66,
+  0xd8, 0xcd, 0xff, 0xfe, 0x97, 0xfd, 0xb5, 0xe6, 0x6d, 0x80, 0xdf, 0x8f, 0x33, 0x63, 0x31, 0xfe,
+  0x2e, 0xda, 0xd6, 0x00, 0x1f, 0xf7, 0xff, 0x5b, 0x59, 0x98, 0xd9, 0x8d, 0x99, 0x8d, 0xad, 0xac,
+  0xd6, 0xff, 0xfe, 0xad, 0xa6, 0x35, 0xb5, 0x99, 0x8d, 0x99, 0x9e, 0xbd, 0x78, 0xcc, 0x7f, 0xdf,
+  0xff, 0xc3, 0x5b, 0x5b, 0x31, 0xb3, 0x36, 0x63, 0xd4, 0x72, 0xa2, 0x7e, 0xb0, 0x63, 0x0c, 0xc3,
+  0x61, 0x99, 0x86, 0x6b, 0x0d, 0xff, 0xff, 0x06, 0x06, 0x18, 0xc6, 0x6b, 0x63, 0x0d, 0xac, 0xd6,
+  0x58, 0x5a, 0x08, 0x7f, 0xff, 0x7d, 0xa5, 0x96, 0x06, 0x33, 0x33, 0x33, 0x65, 0x45, 0x66, 0xd7,
+  0xac, 0xc1, 0xff, 0xff, 0x19, 0xcc, 0x66, 0x66, 0x66, 0x6c, 0xc6, 0xc6, 0x18, 0x69, 0xa0, 0x42,
+  0x16, 0xec, 0x82, 0xcb, 0x2c, 0x2c, 0x0b, 0x16, 0x5a, 0x02, 0xd1, 0x69, 0xa5, 0x96, 0xd6, 0x96,
+  0x9a, 0xd6, 0xb0, 0x3e, 0x59, 0x62, 0xc3, 0x5a, 0xc6, 0x0c, 0xd7, 0xac, 0xc6, 0x6b, 0xd6, 0x6b,
+  0x35, 0x81, 0xa1, 0xa0, 0x58, 0x3e, 0xff, 0xff, 0xd2, 0x06, 0x30, 0xd8, 0x6d, 0x7a, 0xcd, 0x66,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf6, 0x6c, 0xcc, 0xd9, 0x99, 0x98, 0xd0, 0x0f, 0xff, 0xff,
+  0x4f, 0xfb, 0x19, 0x99, 0x9b, 0x6c, 0xdb, 0x67, 0x9e, 0x67, 0x99, 0x99, 0xbf, 0xff, 0xbf, 0xff,
+  0xd0, 0xf6, 0x36, 0x7a, 0xf6, 0x07, 0xe6, 0x78, 0xd9, 0x98, 0xcf, 0xb1, 0x18, 0x6b, 0x20, 0x07,
+  0x7f, 0xff, 0xf9, 0x58, 0xcc, 0x66, 0x66, 0x6d, 0x78, 0xcc, 0xd6, 0xcb, 0xd3, 0x7f, 0xf7, 0xf6,
+  0x6b, 0x5e, 0x99, 0x86, 0xc6, 0x7a, 0xf5, 0xe6, 0x6c, 0x66, 0x3f, 0xff, 0xda, 0x30, 0xc3, 0x33,
+  0x33, 0x66, 0x66, 0xc6, 0x8e, 0x4f, 0x4a, 0xd6, 0x6b, 0x0c, 0xd6, 0xd6, 0xd6, 0xc3, 0x6b, 0xd6,
+  0x31, 0x83, 0xef, 0xff, 0xe0, 0x30, 0xc6, 0x35, 0xeb, 0x6b, 0x6b, 0x6b, 0x6b, 0x69, 0x96, 0x5a,
+  0xd1, 0x68, 0xbf, 0xfe, 0xfb, 0x42, 0xc6, 0xb0, 0xda, 0xf5, 0xe3, 0x3d, 0x2c, 0xad, 0x78, 0xcc,
+  0x33, 0x77, 0xff, 0xfc, 0x71, 0x8c, 0x6c, 0x6c, 0xd8, 0xd8, 0xd8, 0xc3, 0x06, 0xb4, 0x16, 0x88,
+  0x45, 0xa1, 0x65, 0xac, 0xb1, 0x60, 0xb0, 0xb2, 0xd6, 0x85, 0xad, 0x2d, 0x69, 0x65, 0x6b, 0x64,
+  0xd1, 0xa3, 0x5a, 0xc1, 0xbe, 0xac, 0x00, 0xcb, 0x35, 0x9a, 0xcc, 0x63, 0x31, 0x86, 0xd6, 0x35,
+  0x80, 0x00, 0x2c, 0x59, 0xff, 0xff, 0xad, 0xfd, 0x86, 0x18, 0xc6, 0xc3, 0x6b, 0x6b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xff, 0x1b, 0x33, 0x63, 0xd7, 0x8c, 0xc6, 0x00, 0xff, 0xff, 0xf2, 0xfb,
+  0x19, 0x8f, 0x1b, 0x67, 0x9b, 0x3c, 0xf3, 0x67, 0x8d, 0x99, 0xbb, 0xff, 0xfd, 0x18, 0xd9, 0x9b,
+  0x66, 0x33, 0xd7, 0xb3, 0x33, 0x63, 0x33, 0xdc, 0x3d, 0x83, 0x58, 0x00, 0xff, 0xff, 0xf5, 0xed,
+  0x7a, 0xcc, 0xc6, 0xc6, 0xcc, 0xc6, 0xc6, 0xbd, 0x63, 0x5b, 0xff, 0xbe, 0x35, 0x8d, 0x6d, 0x6c,
+  0x66, 0x6c, 0xd9, 0x99, 0xb1, 0x9f, 0xff, 0xec, 0xff, 0xc1, 0x86, 0xc6, 0xc6, 0xd8, 0xd9, 0x9b,
+  0x47, 0x25, 0x22, 0xe1, 0xac, 0xc1, 0x98, 0x66, 0x31, 0x8c, 0x63, 0x58, 0xff, 0xef, 0xf8, 0x35,
+  0x86, 0x19, 0xad, 0x86, 0x33, 0x0c, 0x35, 0x96, 0xb4, 0x2d, 0x0b, 0xff, 0xef, 0x8d, 0x06, 0xb3,
+  0x5e, 0xb3, 0x63, 0x66, 0x5d, 0x5f, 0x6d, 0x7a, 0xcc, 0x3b, 0xff, 0xfe, 0x43, 0x30, 0xda, 0xf1,
+  0xb3, 0x33, 0x66, 0x33, 0x0c, 0x34, 0xd0, 0x21, 0x08, 0xb4, 0xb2, 0xd6, 0xb5, 0x96, 0x2c, 0x0b,
+  0x16, 0x5a, 0x0b, 0x42, 0xd0, 0x4b, 0x4b, 0x10, 0x0d, 0x1a, 0xd6, 0x35, 0xaf, 0x80, 0x35, 0x86,
+  0xb6, 0xb1, 0x9a, 0xf5, 0x98, 0xc6, 0x6b, 0x1a, 0xcb, 0x00, 0x16, 0x59, 0x67, 0xff, 0xfe, 0xd7,
+  0xff, 0xf5, 0x86, 0xbd, 0x66, 0xbc, 0x36, 0x1b, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xf9,
+  0x8f, 0x5e, 0x36, 0x6c, 0x66, 0x30, 0x07, 0xff, 0xff, 0x85, 0x8c, 0xcc, 0xcd, 0xb3, 0xcd, 0x9e,
+  0x6d, 0xb3, 0xd7, 0x98, 0xda, 0xff, 0xff, 0x49, 0xff, 0xe6, 0xcc, 0xdb, 0x36, 0xd9, 0xb3, 0xd7,
+  0x99, 0x99, 0xaf, 0x3d, 0x42, 0xb5, 0x9a, 0x60, 0x03, 0xff, 0xfb, 0xeb, 0x19, 0x8c, 0xcc, 0xcc,
+  0xd8, 0xcc, 0x63, 0x0d, 0x6f, 0xef, 0xf8, 0x61, 0x86, 0x66, 0x66, 0xcd, 0x99, 0x9b, 0x1b, 0xfb,
+  0xff, 0xfd, 0x88, 0x35, 0x99, 0x8f, 0x5e, 0xbc, 0xcc, 0xd9, 0x89, 0x04, 0x54, 0x0c, 0xd6, 0x18,
+  0xd6, 0xd6, 0xd6, 0x63, 0x18, 0xc6, 0x1a, 0xcf, 0xff, 0xef, 0x83, 0x58, 0x61, 0x8c, 0x33, 0x1a,
+  0xf5, 0xb5, 0x86, 0xb4, 0xd0, 0x20, 0x5f, 0xff, 0x7d, 0xa3, 0x5a, 0xc6, 0x31, 0xb3, 0x1e, 0x98,
+  0x99, 0x19, 0x98, 0xc3, 0xfe, 0xff, 0xff, 0x93, 0xb6, 0xb6, 0x33, 0x36, 0x3c, 0x67, 0xac, 0xda,
+  0xcc, 0x0d, 0x34, 0x10, 0x88, 0x21, 0x6b, 0x4d, 0x6b, 0x2c, 0x58, 0x2c, 0x2d, 0x6b, 0x4b, 0x21,
+  0x68, 0x5a, 0xb3, 0xb0, 0x02, 0xc0, 0x35, 0x83, 0x0e, 0xe1, 0xad, 0x63, 0x58, 0xc6, 0x1b, 0x5b,
+  0x5e, 0xb3, 0x5b, 0x58, 0xd6, 0x2c, 0x16, 0x2d, 0x65, 0xad, 0xf7, 0xff, 0xfe, 0x9e, 0xb0, 0xc6,
+  0x33, 0x19, 0x8c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xe6, 0x66, 0xc7, 0xaf, 0x5e, 0x33,
+  0x18, 0x07, 0x7f, 0xff, 0xf7, 0x58, 0xcc, 0xcd, 0x99, 0xe6, 0xd9, 0xe6, 0xd9, 0xe3, 0xc6, 0x6d,
+  0x7d, 0xff, 0xfe, 0x86, 0xf5, 0xb6, 0x67, 0x99, 0xe6, 0xcd, 0x9b, 0x1b, 0x5e, 0xb3, 0xd4, 0x26,
+  0x6b, 0x1a, 0xc0, 0x0f, 0xfb, 0xff, 0xed, 0x66, 0x33, 0x1b, 0x1b, 0x33, 0x1e, 0xb3, 0x0c, 0x32,
+  0xef, 0xfe, 0x32, 0xf5, 0x8c, 0xc7, 0xaf, 0x1b, 0x66, 0x66, 0xcd, 0x7f, 0xff, 0xb1, 0x70, 0x33,
+  0x5e, 0xbd, 0x78, 0xd9, 0xb3, 0x33, 0x64, 0x8a, 0x01, 0xe1, 0xac, 0xd6, 0x6b, 0x6b, 0x19, 0xad,
+  0xad, 0xad, 0xac, 0xd6, 0xd6, 0xb7, 0xff, 0xfb, 0xac, 0x69, 0x83, 0x5b, 0x59, 0xad, 0xac, 0xc6,
+  0x6b, 0x6b, 0x0d, 0x34, 0x0b, 0x40, 0xbf, 0xfe, 0xfb, 0x4c, 0xb1, 0x86, 0x63, 0xd6, 0xcc, 0xcc,
+  0xd1, 0x8c, 0xc3, 0x1f, 0xff, 0x7f, 0xff, 0x06, 0xd6, 0xcc, 0xd8, 0xf5, 0xe3, 0x63, 0x31, 0x81,
+  0xad, 0x02, 0x11, 0x6a, 0xd1, 0x6b, 0x4d, 0x6b, 0x5a, 0xcb, 0x0b, 0x05, 0x96, 0xb4, 0x5a, 0x08,
+  0x2d, 0x59, 0xd8, 0x16, 0x5a, 0xd6, 0x2c, 0xd6, 0xb3, 0x58, 0x37, 0xf5, 0xac, 0x0c, 0x6b, 0x6b,
+  0x6b, 0xd6, 0x6b, 0xd6, 0x61, 0x83, 0x58, 0xb1, 0x65, 0xad, 0x6b, 0x5a, 0xff, 0xff, 0xd8, 0xfb,
+  0x58, 0xc3, 0x31, 0x98, 0xda, 0xcd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0x99, 0xb5, 0xe6,
+  0x66, 0x6d, 0x7a, 0xda, 0x01, 0xfd, 0xff, 0xff, 0xd9, 0x66, 0xbd, 0x7a, 0xf1, 0xb6, 0x78, 0xf6,
+  0x6d, 0xb3, 0x66, 0xcd, 0xad, 0xaf, 0xff, 0xf4, 0x6f, 0x99, 0xb3, 0x3c, 0xcf, 0x1e, 0x6c, 0x78,
+  0xc6, 0xd3, 0xcc, 0x25, 0x9a, 0xc6, 0x80, 0x1d, 0xff, 0xff, 0xe2, 0x66, 0xbd, 0x66, 0xc6, 0x66,
+  0xc6, 0xd7, 0xad, 0x86, 0x0c, 0xbb, 0xff, 0x9a, 0xcd, 0x66, 0x36, 0x66, 0x6d, 0x99, 0x9e, 0xb6,
+  0xff, 0xbf, 0xff, 0xd7, 0xb0, 0x61, 0xb1, 0x9e, 0xbc, 0x6d, 0x8d, 0x99, 0x26, 0x78, 0x70, 0x61,
+  0x86, 0xbd, 0x61, 0x98, 0x63, 0x0c, 0x60, 0xd7, 0xff, 0xfb, 0x8b, 0x5a, 0xd6, 0x1a, 0xda, 0xc3,
+  0x30, 0xc6, 0x61, 0x80, 0x68, 0x5a, 0xd0, 0xb3, 0xff, 0xff, 0x22, 0xb2, 0xcd, 0x61, 0xb5, 0xeb,
+  0x66, 0x66, 0xb6, 0xdd, 0x78, 0x6d, 0x63, 0xff, 0xfe, 0x87, 0xff, 0xec, 0x33, 0x31, 0xeb, 0xc7,
+  0xaf, 0x1b, 0x19, 0x8c, 0x1a, 0xd3, 0x45, 0xa2, 0x21, 0x6e, 0xcb, 0x4d, 0x34, 0xd6, 0xb2, 0xc1,
+  0x60, 0xb5, 0xad, 0x59, 0x04, 0x11, 0x67, 0x60, 0xb5, 0xa6, 0x9a, 0x62, 0xf4, 0xcb, 0xd6, 0xb6,
+  0xb1, 0x7c, 0x0d, 0x6d, 0x66, 0x19, 0x8c, 0x63, 0x0c, 0x1a, 0xd6, 0x59, 0x6b, 0x5a, 0x6b, 0x5b,
+  0xff, 0xff, 0x7b, 0xff, 0xf9, 0xac, 0x63, 0x19, 0x9a, 0xf0, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3d, 0xec, 0xda, 0xf1, 0xb3, 0x36, 0x33, 0x18, 0x07, 0xfd, 0xff, 0xff, 0xd4, 0xcc, 0x66, 0x6c,
+  0xd9, 0xb6, 0xcd, 0xb6, 0x7a, 0xf3, 0x66, 0x33, 0x7f, 0xdf, 0xff, 0xe8, 0x4d, 0x8d, 0xb3, 0x6c,
+  0xcf, 0x33, 0x36, 0x36, 0xb6, 0x79, 0x83, 0xd6, 0xd6, 0xb6, 0x80, 0x0f, 0xff, 0xff, 0x33, 0x18,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xc6, 0xd6, 0x60, 0xd6, 0x7d, 0xff, 0xc6, 0x35, 0xb1, 0xb1, 0xb3, 0xd7,
+  0x99, 0x9e, 0xb6, 0xff, 0xff, 0x60, 0xfb, 0x06, 0x31, 0xb3, 0x36, 0x66, 0xcc, 0xd8, 0x95, 0x37,
+  0x34, 0xb0, 0x63, 0x06, 0x6b, 0x30, 0xc6, 0x18, 0x61, 0xbb, 0xff, 0xfd, 0xbb, 0x5a, 0xd6, 0x06,
+  0x18, 0x61, 0x98, 0xc6, 0x19, 0x66, 0x82, 0xcb, 0x41, 0x67, 0xff, 0xfe, 0x24, 0x06, 0x18, 0xcc,
+  0xcc, 0xce, 0x0e, 0x5a, 0xf5, 0xeb, 0x32, 0xf7, 0xff, 0xfd, 0x1f, 0xd6, 0x33, 0x1b, 0x33, 0x63,
+  0xc6, 0xc6, 0xd6, 0xd6, 0x69, 0x93, 0x42, 0x10, 0x96, 0x96, 0xb4, 0x68, 0xd6, 0xb5, 0x96, 0x16,
+  0x0b, 0x2d, 0x0b, 0x45, 0xa5, 0xa2, 0xd2, 0xc6, 0xd0, 0x0d, 0x0c, 0xb3, 0x58, 0x31, 0x96, 0xd6,
+  0xef, 0x9a, 0xcd, 0x6d, 0x66, 0x31, 0x9a, 0xf5, 0x86, 0x0d, 0x6b, 0x5a, 0xd6, 0x9a, 0x6b, 0x5b,
+  0xff, 0xbf, 0xff, 0xf5, 0xf5, 0xac, 0xc3, 0x33, 0x5e, 0x19, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xf3, 0x63, 0x3d, 0x6c, 0xcc, 0xda, 0xf5, 0x98, 0x07, 0xff, 0xdf, 0xff, 0xfd, 0x18, 0x6c,
+  0x66, 0xcd, 0x9e, 0xbd, 0x9b, 0x66, 0xdb, 0x1e, 0x33, 0x0f, 0xff, 0xf4, 0x6f, 0xe3, 0x66, 0xcd,
+  0x9e, 0xbc, 0xd9, 0x99, 0x8d, 0xaf, 0x3d, 0x42, 0x18, 0x60, 0x00, 0x7f, 0xff, 0xfa, 0xf6, 0xb3,
+  0x5e, 0xbd, 0x6c, 0x6c, 0x6c, 0xc6, 0xc3, 0x35, 0xb4, 0xc5, 0xf7, 0xfc, 0xc3, 0x19, 0x99, 0xeb,
+  0xc7, 0x99, 0x9e, 0xb7, 0xdf, 0xff, 0xeb, 0xa0, 0x63, 0x33, 0x33, 0x6c, 0x78, 0xd9, 0x9a, 0x60,
+  0xd0, 0xc3, 0x59, 0x97, 0xac, 0x30, 0xcd, 0x66, 0xb6, 0xb1, 0xad, 0xac, 0x2f, 0xff, 0xeb, 0x2d,
+  0x60, 0xd6, 0x35, 0x98, 0x36, 0xb6, 0x18, 0x61, 0x60, 0x2d, 0x34, 0x59, 0x7f, 0xfd, 0xc3, 0x58,
+  0xd7, 0xac, 0xcc, 0xcc, 0xec, 0xef, 0xeb, 0xd7, 0xac, 0xd6, 0x7f, 0xff, 0xd3, 0x7c, 0xc6, 0x36,
+  0x36, 0x6c, 0xcd, 0x8d, 0x8c, 0x63, 0x5a, 0xd6, 0xb4, 0xb4, 0x42, 0x5a, 0x5a, 0xd0, 0x68, 0xd6,
+  0xb5, 0x8b, 0x05, 0x8b, 0x5a, 0x2d, 0x13, 0x76, 0x45, 0xad, 0x94, 0x02, 0xc0, 0x18, 0x30, 0x63,
+  0x59, 0xad, 0x67, 0x71, 0x86, 0x33, 0x5b, 0x1a, 0xf5, 0x86, 0x0d, 0x35, 0xad, 0x34, 0xd3, 0x4d,
+  0x7f, 0xff, 0xef, 0x46, 0x18, 0xc6, 0xd7, 0xad, 0xaf, 0x58, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0xf6, 0x36, 0x36, 0x66, 0x66, 0x66, 0x00, 0x3f, 0xff, 0xfd, 0xbf, 0xfe, 0xc6, 0x63, 0x63, 0xc7,
+  0x99, 0xe6, 0xcf, 0x1e, 0x67, 0xad, 0x8c, 0x3f, 0xff, 0xd0, 0xf6, 0x6c, 0x78, 0xf3, 0x36, 0x6c,
+  0x6c, 0x63, 0x3d, 0xc2, 0x66, 0xb3, 0x58, 0x00, 0x7f, 0xff, 0x7f, 0x6b, 0x19, 0x8c, 0xd8, 0xcd,
+  0x8d, 0xaf, 0x5b, 0x0c, 0x18, 0x3f, 0xfe, 0xed, 0x66, 0x31, 0xeb, 0xc7, 0x8f, 0x33, 0x3d, 0x6f,
+  0xff, 0xef, 0xe0, 0x6b, 0x63, 0x33, 0x66, 0xcd, 0x99, 0xb1, 0xa7, 0x0c, 0x0b, 0x31, 0xac, 0x61,
+  0xad, 0xac, 0xd6, 0x6b, 0x6b, 0x0c, 0x35, 0x8f, 0xff, 0xf6, 0xa5, 0x96, 0x06, 0xb0, 0xd6, 0x61,
+  0x9a, 0xf5, 0x9a, 0xf4, 0xd6, 0x0b, 0x16, 0x9a, 0x0b, 0x3f, 0xff, 0xef, 0x93, 0x59, 0xad, 0xad,
+  0xaf, 0x0f, 0x4f, 0x6f, 0xac, 0xc6, 0x31, 0xff, 0xff, 0x50, 0x63, 0x19, 0xb3, 0x33, 0xd7, 0x8d,
+  0x8d, 0x86, 0x35, 0x96, 0x5a, 0x2d, 0x5a, 0x42, 0x16, 0x83, 0x41, 0x33, 0x5e, 0xb6, 0xfb, 0x05,
+  0x96, 0x82, 0x08, 0xb4, 0xad, 0xec, 0xc1, 0x6b, 0x5a, 0xd6, 0x0d, 0x63, 0x06, 0x35, 0xb4, 0xc0,
+  0xdd, 0xf6, 0x61, 0x98, 0xc6, 0x18, 0xcb, 0x34, 0xd3, 0x4d, 0x34, 0x69, 0xaf, 0xff, 0xfe, 0x4f,
+  0xf9, 0xac, 0x61, 0xb5, 0xb1, 0xb5, 0xb5, 0x98, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0xc6, 0xc6,
+  0xcc, 0xcc, 0xcc, 0xd6, 0x00, 0xff, 0xff, 0xf4, 0xfe, 0x19, 0x8d, 0x99, 0xb3, 0x6c, 0xdb, 0x36,
+  0xcc, 0xf5, 0xe3, 0x18, 0xff, 0xbf, 0xff, 0xaf, 0x1b, 0x36, 0x7a, 0xf1, 0xb3, 0x33, 0x19, 0x9f,
+  0x21, 0x70, 0xc3, 0x00, 0x0f, 0xfe, 0xff, 0xed, 0x63, 0x19, 0x99, 0x9b, 0x5e, 0x33, 0x31, 0x8d,
+  0x7a, 0x65, 0x8f, 0xff, 0xf5, 0x6d, 0x63, 0x31, 0xb3, 0x66, 0x78, 0xf1, 0xb3, 0xff, 0xfd, 0x78,
+  0x0d, 0x7a, 0xcd, 0x8d, 0xb3, 0x3d, 0x78, 0xf5, 0xeb, 0xd3, 0xe5, 0xa5, 0x38, 0xcb, 0xd6, 0x18,
+  0xd6, 0x6b, 0x6b, 0x5e, 0x99, 0xac, 0x35, 0x9f, 0xff, 0x7d, 0x85, 0x83, 0x58, 0x30, 0x6d, 0x66,
+  0x31, 0x83, 0x58, 0xb1, 0x6b, 0x46, 0x8b, 0x1f, 0xff, 0xf7, 0x8b, 0x0d, 0x6c, 0x33, 0x33, 0x40,
+  0x41, 0x33, 0x18, 0x6e, 0xff, 0xff, 0xaa, 0x6b, 0x31, 0x9b, 0x1e, 0xbc, 0xcd, 0x8f, 0x5b, 0x18,
+  0x6b, 0x16, 0x5a, 0x5a, 0xb4, 0xb5, 0x69, 0x68, 0x34, 0x71, 0x8d, 0x86, 0x63, 0x8b, 0x2d, 0x04,
+  0x11, 0x05, 0xcd, 0xa8, 0xb4, 0xd0, 0x6b, 0x58, 0x6b, 0x6b, 0x0c, 0xd6, 0x1a, 0xc6, 0xb5, 0x8f,
+  0x8c, 0x63, 0x18, 0xc1, 0x81, 0xa6, 0x8d, 0x0d, 0x35, 0xbf, 0xff, 0xfa, 0xff, 0xff, 0xf7, 0xcd,
+  0x66, 0x19, 0x8c, 0xcd, 0x7a, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x66, 0x36, 0x3d, 0x6c,
+  0xcc, 0xc6, 0x00, 0x7f, 0xff, 0xf9, 0xff, 0x6d, 0x66, 0x66, 0x66, 0xcd, 0x9e, 0x3c, 0xd9, 0xb3,
+  0x3d, 0x6d, 0x7a, 0xc7, 0xff, 0xf7, 0xfd, 0x8d, 0xb1, 0xe3, 0xd7, 0x8d, 0x8d, 0xad, 0x87, 0xe8,
+  0x73, 0x35, 0x98, 0x00, 0x7f, 0x7f, 0xff, 0x35, 0xb5, 0x9b, 0x5b, 0x33, 0x33, 0x33, 0x1b, 0x59,
+  0x86, 0xb0, 0x7f, 0x7f, 0xda, 0xcc, 0x6c, 0x6d, 0x99, 0xe3, 0xd7, 0x9b, 0xef, 0xff, 0xf5, 0xe1,
+  0x7a, 0x66, 0x36, 0x66, 0xcd, 0x9b, 0x36, 0x32, 0x8c, 0xa8, 0x9b, 0x35, 0x9a, 0xc6, 0x0c, 0x6b,
+  0x6b, 0x5b, 0x58, 0x6b, 0x35, 0x9f, 0xf7, 0xf2, 0xc0, 0x35, 0xac, 0x6b, 0x35, 0xb5, 0xb0, 0xc6,
+  0x1a, 0xd6, 0x59, 0x6b, 0x4d, 0x00, 0x7f, 0xff, 0xdd, 0x83, 0x0c, 0xd7, 0x87, 0xa8, 0x68, 0x7d,
+  0x98, 0xd7, 0xad, 0xfd, 0xff, 0xff, 0x59, 0xb5, 0x98, 0xcc, 0xf5, 0xb6, 0x66, 0xc7, 0xaf, 0x5b,
+  0x5b, 0x5a, 0xc0, 0xb4, 0x42, 0x5a, 0xb5, 0x64, 0x07, 0x4d, 0xad, 0xaf, 0x5b, 0x5e, 0xb3, 0x3e,
+  0x2d, 0x34, 0xb4, 0x42, 0xd5, 0xaf, 0x2e, 0x16, 0x80, 0x00, 0xc1, 0x86, 0x30, 0xd6, 0xd6, 0xb3,
+  0x4c, 0x06, 0xa5, 0xeb, 0x19, 0xac, 0xd6, 0x01, 0xa3, 0x43, 0x46, 0xbe, 0xff, 0xff, 0xe6, 0x35,
+  0x9a, 0xcc, 0xd7, 0xaf, 0x59, 0x8c, 0x60, 0x06, 0x02, 0x00, 0x00, 0xde, 0xc3, 0xd6, 0xc6, 0xcc,
+  0x7a, 0xf5, 0xb1, 0x80, 0x1f, 0xff, 0xfe, 0x31, 0x9a, 0xf5, 0xeb, 0xc6, 0xcd, 0x9b, 0x66, 0xc6,
+  0xc7, 0xaf, 0x5b, 0x0c, 0x7f, 0xff, 0xa3, 0xfc, 0xcc, 0xd9, 0xb3, 0x33, 0x33, 0x18, 0xd0, 0x11,
+  0x23, 0x18, 0xd0, 0x03, 0xbf, 0xff, 0xfc, 0x5a, 0xcc, 0x66, 0x36, 0x66, 0x3d, 0x7a, 0xd8, 0x6d,
+  0x63, 0x58, 0x1f, 0xff, 0xd6, 0x19, 0x9b, 0x1e, 0x66, 0xd9, 0xb1, 0xfd, 0xff, 0xf0, 0x18, 0xc6,
+  0xcd, 0x99, 0xb6, 0x66, 0xcc, 0xd5, 0x04, 0xe4, 0x97, 0xac, 0x31, 0xac, 0xd6, 0x35, 0xb4, 0xc6,
+  0xb0, 0xc0, 0xdd, 0xff, 0xf0, 0x06, 0x8d, 0x61, 0xad, 0xac, 0x66, 0x30, 0xc1, 0xac, 0xb5, 0xad,
+  0x68, 0xd0, 0x35, 0xff, 0xff, 0x76, 0x18, 0xd7, 0xac, 0xcc, 0xd1, 0x71, 0xa6, 0xc3, 0x35, 0xff,
+  0x7f, 0xff, 0xd7, 0x8c, 0xc6, 0x66, 0xcd, 0x99, 0xb3, 0x33, 0x19, 0xac, 0x01, 0x37, 0x68, 0x88,
+  0x85, 0xa1, 0x7d, 0x8c, 0x66, 0x36, 0xb6, 0x19, 0xbf, 0xad, 0x68, 0xb4, 0x42, 0x15, 0xfd, 0xda,
+  0x02, 0xd6, 0xb2, 0xcd, 0x61, 0xaf, 0x58, 0xd7, 0xad, 0x6d, 0x60, 0xd6, 0x0d, 0x6b, 0x35, 0xab,
+  0x0c, 0x32, 0xcd, 0x06, 0x86, 0x8d, 0x37, 0xff, 0xff, 0x6b, 0x4c, 0xd6, 0x63, 0x1b, 0x5e, 0xb3,
+  0x0c, 0x03, 0x82, 0x80, 0x00, 0x7b, 0x1b, 0x5b, 0x31, 0xb1, 0xb3, 0x1b, 0x0c, 0x01, 0xff, 0xff,
+  0xe0, 0x6b, 0x63, 0x36, 0x36, 0x6c, 0xd9, 0xe8, 0x33, 0xc6, 0xd7, 0xac, 0x6b, 0x7f, 0xff, 0x7f,
+  0x6c, 0x6c, 0xd8, 0xd9, 0x8d, 0xad, 0x84, 0x1c, 0x5b, 0x30, 0xc6, 0x00, 0x3f, 0xff, 0xfc, 0xda,
+  0xcd, 0x7a, 0xf5, 0xb1, 0xb3, 0x31, 0xb1, 0xb5, 0x98, 0x30, 0x1f, 0xdf, 0xf3, 0x18, 0xf5, 0xe3,
+  0xc7, 0x99, 0xe3, 0x6f, 0xff, 0xbf, 0xe0, 0x31, 0x99, 0x9b, 0x36, 0x6c, 0xd9, 0x99, 0xab, 0x09,
+  0x08, 0x4c, 0x35, 0xb5, 0x86, 0x1a, 0xcd, 0x60, 0xc1, 0xac, 0xd3, 0xfb, 0xf8, 0x03, 0x46, 0x59,
+  0xac, 0x63, 0x18, 0xc3, 0x0d, 0x35, 0x96, 0x9a, 0x68, 0x68, 0xd7, 0xff, 0xfd, 0xd9, 0x83, 0x31,
+  0x99, 0xa4, 0x64, 0xb6, 0x31, 0x87, 0xff, 0xdf, 0xff, 0xc3, 0x31, 0x99, 0xb3, 0x66, 0x6c, 0xcd,
+  0x86, 0xd6, 0x06, 0x96, 0x4b, 0x48, 0x88, 0x21, 0xdc, 0x66, 0xbd, 0x7a, 0xcc, 0xc6, 0x31, 0xaf,
+  0xa0, 0x5a, 0xb4, 0xb5, 0x6b, 0x0e, 0xfe, 0x0b, 0x5a, 0x34, 0xd6, 0x18, 0x33, 0x0c, 0x30, 0xc0,
+  0xcb, 0x69, 0xac, 0x6b, 0x06, 0x37, 0x19, 0x63, 0x41, 0xa1, 0xa6, 0x9f, 0xff, 0xfe, 0xbf, 0xf1,
+  0x83, 0x35, 0xeb, 0x6b, 0xd6, 0xc3, 0x18, 0x0c, 0x09, 0xc6, 0x00, 0x66, 0x63, 0x6b, 0x66, 0x36,
+  0x36, 0x36, 0x31, 0x80, 0x5f, 0xff, 0xfd, 0xe6, 0x31, 0xb1, 0xb1, 0xe3, 0xd7, 0x9b, 0x01, 0xec,
+  0xc6, 0x6b, 0x69, 0xbf, 0xfb, 0xfe, 0xc6, 0xcd, 0x8d, 0x8c, 0xc6, 0x32, 0x1a, 0x37, 0x61, 0x98,
+  0x00, 0x1f, 0xff, 0xfe, 0xbc, 0xc3, 0x33, 0x1b, 0x31, 0xb3, 0x1b, 0x0d, 0xac, 0x6b, 0x0d, 0x77,
+  0xff, 0xcc, 0x36, 0x3c, 0x6d, 0x9e, 0xbc, 0xcd, 0xbf, 0xfe, 0xff, 0x80, 0xc6, 0x66, 0xc7, 0x99,
+  0xb6, 0x66, 0xc6, 0xb2, 0x22, 0x1f, 0x30, 0xc3, 0x06, 0x1a, 0xc6, 0xb0, 0xcb, 0x35, 0x81, 0xff,
+  0xf4, 0x34, 0x0d, 0x6b, 0x0c, 0x31, 0x98, 0x66, 0xb0, 0x69, 0xad, 0x69, 0xa6, 0x8d, 0x34, 0x7f,
+  0xff, 0xdd, 0xeb, 0x18, 0xc6, 0x62, 0x5a, 0x60, 0xcc, 0x6b, 0x6f, 0xff, 0xfb, 0xdf, 0xf8, 0xd6,
+  0xc6, 0x6c, 0x7a, 0xf3, 0x63, 0xc6, 0xc6, 0x30, 0x69, 0xa2, 0x6e, 0xd2, 0x12, 0x16, 0x9f, 0x76,
+  0x31, 0x9a, 0xf0, 0xda, 0xf5, 0x98, 0xd6, 0xee, 0x96, 0x4b, 0x48, 0x4c, 0x7c, 0x38, 0xb4, 0xd1,
+  0x63, 0x4c, 0x18, 0xc3, 0x18, 0xc1, 0x83, 0x2d, 0xa6, 0xb3, 0x4c, 0x32, 0xf5, 0x8c, 0xa0, 0x0d,
+  0x0d, 0x19, 0xdf, 0xff, 0xfe, 0x26, 0x5e, 0xb1, 0x8c, 0xcc, 0x36, 0xb3, 0x02, 0x21, 0xd8, 0x63,
+  0x59, 0x8d, 0x7a, 0xd8, 0x7a, 0xd8, 0xd8, 0xd8, 0xcc, 0xc0, 0x07, 0xdf, 0xff, 0xfd, 0xba, 0xcd,
+  0x7a, 0xd8, 0xf5, 0xb3, 0x66, 0x6c, 0x01, 0xec, 0xcc, 0x32, 0xf4, 0xbf, 0xff, 0x99, 0x99, 0x9b,
+  0x5e, 0xb6, 0xb6, 0xbd, 0x68, 0x99, 0x0c, 0xd7, 0xac, 0xc0, 0x01, 0xff, 0xfd, 0xfc, 0xc3, 0x33,
+  0x1b, 0x1e, 0xb6, 0x63, 0x6b, 0xd6, 0xd6, 0x32, 0xda, 0x1f, 0xff, 0xd1, 0xb1, 0xb1, 0xe6, 0xcd,
+  0x9b, 0x36, 0xff, 0xef, 0xff, 0xb0, 0x61, 0x99, 0xb3, 0x36, 0xcd, 0x9b, 0x1e, 0xb5, 0xb9, 0x00,
+  0xe9, 0x8d, 0x66, 0xb3, 0x58, 0x30, 0x6b, 0x1a, 0xd6, 0x6b, 0x59, 0xbe, 0xff, 0xa0, 0xd0, 0x69,
+  0x83, 0x18, 0x6d, 0x66, 0x18, 0x0d, 0x35, 0xa6, 0x9a, 0x69, 0xad, 0x6e, 0xff, 0xfe, 0xc3, 0x18,
+  0xc6, 0xd3, 0x93, 0xb9, 0x9a, 0xf5, 0x8f, 0xff, 0xfb, 0xff, 0x8d, 0x7a, 0xcc, 0xd8, 0xf1, 0xe3,
+  0x6c, 0x6c, 0x6d, 0x63, 0x5a, 0xd0, 0x25, 0xa8, 0x4b, 0x56, 0xb7, 0xfd, 0x30, 0xcc, 0x66, 0x33,
+  0x18, 0xcd, 0x66, 0xff, 0xe1, 0x08, 0x48, 0xcc, 0xc7, 0x16, 0x96, 0x2d, 0x60, 0xd6, 0x6b, 0x6b,
+  0x30, 0xcd, 0x63, 0x06, 0xb0, 0xd6, 0x0c, 0x1a, 0xda, 0xc6, 0x1b, 0x7f, 0x0d, 0x06, 0x8c, 0x3f,
+  0xfb, 0xff, 0xb5, 0x86, 0xbd, 0x6d, 0x6c, 0x66, 0x18, 0xc1, 0x61, 0x3c, 0x30, 0xc6, 0xbd, 0x66,
+  0x33, 0x31, 0xb1, 0x9b, 0x5e, 0x1b, 0x00, 0x1f, 0xdf, 0xff, 0xfd, 0x98, 0x36, 0x1e, 0xb6, 0x66,
+  0x7a, 0xf0, 0x00, 0xf6, 0xd6, 0xc1, 0x81, 0xff, 0x7d, 0xaf, 0x5e, 0x31, 0xb5, 0xeb, 0x18, 0x8c,
+  0x93, 0xd7, 0xac, 0xc6, 0x80, 0x0f, 0xfe, 0xff, 0xe6, 0x1b, 0x5b, 0x1b, 0x31, 0xb3, 0x31, 0x98,
+  0xc3, 0x58, 0xd3, 0x7f, 0xff, 0xb3, 0x46, 0x66, 0x7a, 0xf1, 0xe6, 0xcd, 0x9b, 0x7f, 0xdf, 0xff,
+  0x2c, 0xd6, 0x33, 0x63, 0xd7, 0x9b, 0x63, 0xcc, 0xcc, 0xbd, 0x1e, 0x1b, 0x6b, 0x6b, 0x0c, 0x32,
+  0xf4, 0xcb, 0xd3, 0x58, 0x6b, 0x0d, 0x61, 0xdf, 0xfc, 0x68, 0x06, 0xb5, 0x8c, 0x31, 0x8c, 0xd6,
+  0x6b, 0x06, 0x9a, 0x69, 0xa6, 0x9a, 0x65, 0x9f, 0x7f, 0xf0, 0xc6, 0x31, 0xb5, 0x0d, 0x1d, 0xeb,
+  0x6b, 0x6b, 0x3f, 0xff, 0xf0, 0x63, 0x5e, 0xb3, 0x63, 0x66, 0xcd, 0x9b, 0x1e, 0xbd, 0x6d, 0x66,
+  0xb2, 0xc8, 0x21, 0x5a, 0xb5, 0x69, 0x6f, 0xfa, 0x35, 0xb5, 0xb0, 0xcc, 0xcd, 0x7a, 0xda, 0xcc,
+  0x17, 0xfd, 0xa1, 0x10, 0x9a, 0x39, 0x85, 0xa5, 0xad, 0x35, 0xad, 0x6d, 0x33, 0x5b, 0x5b, 0x59,
+  0x86, 0x35, 0x8d, 0x61, 0xac, 0x35, 0x86, 0xb6, 0xb1, 0x86, 0x6b, 0xdf, 0xf0, 0xd0, 0xd0, 0x3f,
+  0xff, 0xfd, 0xbe, 0x61, 0x86, 0x63, 0x31, 0x8c, 0x60, 0xe0, 0xcb, 0x18, 0x61, 0x98, 0xc6, 0x63,
+  0x63, 0x36, 0xbd, 0x7a, 0xd8, 0xc0, 0x0f, 0xfb, 0xff, 0xff, 0xaf, 0x1a, 0xf5, 0x99, 0x99, 0x99,
+  0xb3, 0x00, 0x0f, 0x66, 0x6b, 0x35, 0xac, 0x3f, 0xee, 0x6d, 0x6c, 0x66, 0x19, 0xad, 0x21, 0x2d,
+  0xb1, 0x8c, 0x00, 0x0f, 0xfb, 0xff, 0xac, 0x61, 0xeb, 0x63, 0xd6, 0xcc, 0xc6, 0xc6, 0x30, 0xc0,
+  0xd3, 0xff, 0xef, 0xb6, 0xbd, 0x6c, 0xd9, 0xb3, 0x6c, 0xd9, 0xb7, 0xdf, 0xff, 0xed, 0x76, 0x35,
+  0x8d, 0xaf, 0x33, 0x66, 0xcf, 0x5e, 0x66, 0xd7, 0xb0, 0xc7, 0x46, 0x8c, 0x60, 0xc3, 0x59, 0xa6,
+  0x0d, 0x60, 0x6b, 0x1a, 0xc3, 0xef, 0xe8, 0x34, 0x0d, 0x61, 0x86, 0x61, 0x98, 0x30, 0x0d, 0x34,
+  0xd3, 0x4d, 0x6b, 0x2c, 0xfb, 0xff, 0x8c, 0x63, 0x19, 0x4f, 0x51, 0x8c, 0xc3, 0x5f, 0xff, 0xf8,
+  0x63, 0x0d, 0x8c, 0xf5, 0xe3, 0xcc, 0xd9, 0x99, 0x98, 0x6b, 0x05, 0xa2, 0xdd, 0xa2, 0xb4, 0x87,
+  0xf7, 0x03, 0x6b, 0x31, 0x8d, 0x8c, 0x66, 0xbd, 0x6b, 0xd3, 0x7f, 0x45, 0xab, 0x56, 0xad, 0x7d,
+  0x25, 0xab, 0x20, 0x68, 0xd6, 0x30, 0xc6, 0x31, 0x8c, 0x18, 0xd6, 0x0d, 0x66, 0xb5, 0x9a, 0xc6,
+  0xb3, 0x0c, 0x63, 0x77, 0xcd, 0x1a, 0x05, 0xff, 0xff, 0xe7, 0x60, 0xc6, 0x63, 0x19, 0x8d, 0x6c,
+  0x21, 0x1f, 0xb0, 0xcd, 0x66, 0xbd, 0x66, 0x33, 0x1b, 0x19, 0x99, 0x8c, 0xcd, 0x00, 0x7f, 0xf7,
+  0xff, 0xf5, 0xeb, 0x0d, 0x8c, 0xcc, 0xcd, 0x8f, 0x40, 0x07, 0xb3, 0x1a, 0xcd, 0x35, 0x93, 0xfe,
+  0xd6, 0xc3, 0x6b, 0x35, 0xb5, 0x27, 0x34, 0x33, 0x19, 0x80, 0x0f, 0xbf, 0xff, 0xac, 0x63, 0x31,
+  0xeb, 0x66, 0x66, 0x63, 0x6b, 0xd6, 0x18, 0x35, 0xaf, 0xff, 0xee, 0xcc, 0x6c, 0xcd, 0xb3, 0x6c,
+  0xd9, 0x9b, 0xff, 0xfd, 0xbc, 0x1a, 0xd8, 0xd8, 0xf1, 0xe6, 0xcc, 0xf5, 0xe3, 0x6c, 0x91, 0xb1,
+  0x8d, 0x63, 0x5b, 0x58, 0x6b, 0x1a, 0xd6, 0x69, 0xac, 0x1a, 0xc3, 0x58, 0xbf, 0xfe, 0x1a, 0x59,
+  0xa3, 0x06, 0x31, 0x8c, 0x60, 0xc0, 0x1a, 0x69, 0xa6, 0xb5, 0x96, 0x1f, 0xdf, 0xf3, 0x18, 0xc6,
+  0x56, 0xd7, 0x33, 0x35, 0x9b, 0xef, 0xff, 0xfc, 0x51, 0x86, 0xc6, 0xcc, 0xdb, 0x33, 0x66, 0xc6,
+  0xd6, 0xd6, 0x01, 0x68, 0x88, 0x90, 0x1f, 0xf5, 0x83, 0x18, 0xcc, 0x66, 0x33, 0x18, 0xcb, 0xd3,
+  0x0e, 0xd4, 0x23, 0x77, 0x61, 0x08, 0x05, 0x86, 0xb1, 0xad, 0x86, 0x33, 0x0c, 0x30, 0x60, 0xd6,
+  0x69, 0x86, 0x0c, 0x31, 0x86, 0x61, 0xfd, 0x34, 0x03, 0xfb, 0xff, 0xe5, 0xb5, 0x8c, 0x63, 0x6b,
+  0xd6, 0x31, 0x8a, 0x09, 0x58, 0x63, 0x0c, 0xd7, 0xad, 0xaf, 0x5b, 0x19, 0x98, 0xd8, 0xcc, 0x00,
+  0x3f, 0xfe, 0xff, 0xf8, 0xc3, 0x31, 0x99, 0x9b, 0x5e, 0x36, 0x00, 0x1b, 0xcc, 0x30, 0x1a, 0x6b,
+  0x3f, 0xe6, 0x6b, 0x6b, 0x35, 0xb4, 0xbc, 0xee, 0x1b, 0x5b, 0x1f, 0x00, 0x2f, 0xff, 0xff, 0x3b,
+  0x35, 0xeb, 0x31, 0xeb, 0x66, 0x6d, 0x7a, 0xf5, 0xb0, 0xc6, 0x06, 0xb5, 0xff, 0xfe, 0xe5, 0x63,
+  0x36, 0x3c, 0xcd, 0xb6, 0x67, 0xaf, 0x3f, 0xff, 0xdd, 0x3e, 0x0d, 0x7a, 0xcd, 0x99, 0xb3, 0xd7,
+  0x9b, 0x36, 0x63, 0x3c, 0x68, 0x5f, 0x58, 0xd6, 0xd6, 0x1a, 0xc3, 0x58, 0x0d, 0x60, 0x6b, 0x1a,
+  0xc3, 0xff, 0xe8, 0x00, 0x30, 0xd7, 0xac, 0x66, 0x18, 0x6b, 0x01, 0xa3, 0x4d, 0x6b, 0x59, 0x63,
+  0x5f, 0xfd, 0xd6, 0xd6, 0x63, 0x2c, 0xac, 0xf5, 0xeb, 0x35, 0xb7, 0xfd, 0xff, 0xff, 0x8e, 0x31,
+  0x8d, 0x8f, 0x1b, 0x66, 0x7a, 0xf3, 0x1e, 0xb3, 0x59, 0xa0, 0x21, 0x20, 0x00, 0xff, 0xe6, 0x18,
+  0xd7, 0xac, 0xcc, 0x66, 0x6b, 0xd6, 0x30, 0x00, 0xaa, 0x1c, 0x9b, 0xf0, 0xb4, 0xb2, 0xd6, 0xb0,
+  0x63, 0x0c, 0xc3, 0x6b, 0x35, 0xb5, 0x86, 0x06, 0x0c, 0xb6, 0xb0, 0xc1, 0x98, 0x63, 0x5e, 0xb7,
+  0xd0, 0x03, 0xff, 0xbf, 0xeb, 0x32, 0xf5, 0x99, 0xaf, 0x59, 0x8c, 0x0b, 0x8a, 0xd8, 0x63, 0x5e,
+  0xb1, 0x98, 0xcc, 0x66, 0x66, 0x33, 0x31, 0x80, 0x0f, 0xff, 0xef, 0xfe, 0xd6, 0x31, 0x8d, 0xaf,
+  0x19, 0x99, 0x80, 0x00, 0xfc, 0xc1, 0x96, 0x1a, 0x6b, 0x59, 0xf5, 0x8c, 0x32, 0x6e, 0x85, 0xaf,
+  0x5b, 0x17, 0xfd, 0xbb, 0x40, 0x3f, 0xff, 0xfd, 0x61, 0x98, 0xcc, 0xcc, 0xcd, 0xaf, 0x18, 0xda,
+  0xcd, 0x63, 0x4d, 0x5f, 0xff, 0xee, 0xac, 0x66, 0x6c, 0xd9, 0xb6, 0x7a, 0xf3, 0x37, 0xf7, 0xff,
+  0xf0, 0x33, 0x19, 0xeb, 0xcc, 0xdb, 0x3d, 0x78, 0xd9, 0xb5, 0x86, 0x85, 0xcc, 0x60, 0xc3, 0x58,
+  0x35, 0x8b, 0xd1, 0xac, 0x1a, 0xc6, 0xb1, 0xbf, 0xfe, 0xe2, 0xc0, 0x35, 0x9a, 0xda, 0xcc, 0x63,
+  0x5b, 0x4c, 0x5b, 0x41, 0xa6, 0xb5, 0xac, 0x06, 0xbf, 0xfe, 0x86, 0x61, 0xae, 0x2e, 0x4d, 0x86,
+  0xb7, 0xff, 0x7f, 0xff, 0x35, 0x8c, 0xc6, 0xcd, 0x9b, 0x36, 0x6c, 0xcc, 0xc6, 0x0d, 0x68, 0x22,
+  0x20, 0x01, 0x7f, 0x58, 0xd6, 0xd6, 0xd7, 0xac, 0xcc, 0xd7, 0xad, 0xac, 0xd6, 0x00, 0x0e, 0xeb,
+  0x75, 0xf3, 0x45, 0xa5, 0xa6, 0x9a, 0x60, 0xc3, 0x31, 0x8c, 0x63, 0x0c, 0x18, 0x6b, 0x0d, 0x63,
+  0x58, 0xc1, 0x8c, 0x31, 0x8d, 0x60, 0x03, 0xff, 0xfb, 0xe1, 0xaf, 0x59, 0x8c, 0x66, 0xbd, 0x60,
+  0xd4, 0xc8, 0xcd, 0x66, 0x18, 0xcc, 0x66, 0x33, 0x1b, 0x18, 0xd8, 0x60, 0x07, 0xff, 0xff, 0xb7,
+  0xf5, 0x8d, 0x7a, 0xcc, 0x66, 0x66, 0x66, 0x00, 0x01, 0xed, 0xac, 0x32, 0xc0, 0xd6, 0xb0, 0x3a,
+  0xcd, 0x4f, 0xd2, 0xde, 0xb3, 0x37, 0xfc, 0x84, 0x16, 0x7f, 0xff, 0x7c, 0xd6, 0x63, 0x36, 0xbc,
+  0x66, 0xc6, 0xc3, 0x60, 0xc3, 0x5a, 0xdf, 0xf7, 0xff, 0x19, 0x8f, 0x1b, 0x66, 0xd9, 0xb3, 0xd7,
+  0xaf, 0x7f, 0xff, 0xbe, 0x06, 0xb6, 0x36, 0x66, 0xcf, 0x1e, 0x66, 0xcc, 0xdb, 0xa3, 0x22, 0xcd,
+  0x6d, 0x63, 0x58, 0xd6, 0x06, 0xb5, 0x83, 0x5a, 0xc1, 0x83, 0x07, 0xdf, 0xf2, 0xc2, 0xcd, 0x31,
+  0x86, 0x33, 0x5e, 0x98, 0xd6, 0x58, 0x68, 0xd3, 0x5a, 0xcb, 0x1a, 0xd3, 0xff, 0xf8, 0xd6, 0xc3,
+  0x5e, 0xdf, 0x35, 0xeb, 0x19, 0xff, 0xfd, 0xff, 0xc6, 0x19, 0x99, 0x9b, 0x36, 0x6d, 0x99, 0x9b,
+  0x5e, 0xb1, 0xac, 0xb4, 0x12, 0xc0, 0x00, 0x5f, 0xd6, 0x6b, 0x35, 0xeb, 0x33, 0x19, 0x9a, 0xd8,
+  0x30, 0x00, 0x1f, 0x77, 0x97, 0x6c, 0x42, 0xd0, 0x0d, 0x61, 0x8c, 0x3d, 0x63, 0x30, 0xc3, 0x1a,
+  0xc3, 0x59, 0xad, 0x66, 0xb0, 0xc3, 0x0c, 0x33, 0x06, 0x00, 0x1f, 0xff, 0xfe, 0xb1, 0x86, 0x33,
+  0x18, 0xc6, 0x0f, 0x0e, 0x4c, 0x61, 0x8c, 0xc3, 0x33, 0x18, 0xd8, 0xc6, 0xc6, 0xbd, 0x00, 0x3f,
+  0xff, 0xfd, 0xbf, 0xec, 0x6b, 0x6b, 0x33, 0x19, 0x8f, 0x5b, 0x00, 0x00, 0x6f, 0x18, 0x19, 0x61,
+  0xa6, 0x06, 0xb5, 0xaa, 0x3a, 0x8c, 0x35, 0xcd, 0xda, 0x20, 0xb4, 0xff, 0xff, 0xef, 0x99, 0xad,
+  0x8c, 0xd8, 0xd9, 0x8d, 0x8c, 0xd7, 0xad, 0x6d, 0x32, 0xdf, 0xff, 0xdf, 0xdb, 0x5b, 0x1b, 0x36,
+  0xcd, 0x9e, 0x3c, 0xcc, 0xff, 0xef, 0xfe, 0x0c, 0xd7, 0x8d, 0xb1, 0xe6, 0xcf, 0x5e, 0x66, 0x6e,
+  0x41, 0x91, 0x66, 0xb3, 0x5b, 0x4c, 0x6b, 0x58, 0xd3, 0x58, 0xb3, 0x4d, 0x63, 0x58, 0x61, 0xbb,
+  0xff, 0xe5, 0x96, 0x0d, 0x63, 0x18, 0x6d, 0x66, 0xb1, 0xac, 0x59, 0xa1, 0xa6, 0x59, 0x63, 0x5a,
+  0xdf, 0x7f, 0xf3, 0x5b, 0x5b, 0x30, 0xf0, 0xf3, 0x18, 0xd7, 0xff, 0xfe, 0xaf, 0xf6, 0xb0, 0xcc,
+  0xda, 0xf3, 0x36, 0xcc, 0xf1, 0xb1, 0xb5, 0xb5, 0x96, 0x2d, 0x2d, 0x00, 0x00, 0x2f, 0xe0, 0xc6,
+  0x33, 0x19, 0x8c, 0xc3, 0x35, 0xac, 0x00, 0x0f, 0xaf, 0x59, 0x6a, 0xd0, 0x16, 0x1a, 0xcd, 0x6d,
+  0x6c, 0x33, 0x18, 0xd7, 0xa6, 0x32, 0xda, 0xd6, 0xd3, 0x0d, 0x63, 0x59, 0xac, 0xc3, 0x0c, 0x60,
+  0x01, 0x7f, 0xff, 0xf9, 0xb5, 0x8c, 0x63, 0x31, 0x8d, 0x79, 0x0d, 0x00, 0xc6, 0xbd, 0x63, 0x19,
+  0x8c, 0x66, 0x36, 0xb6, 0x36, 0xb3, 0x30, 0x03, 0xff, 0xff, 0xd7, 0xe3, 0x59, 0xad, 0x86, 0xc3,
+  0xd6, 0xd7, 0x80, 0x00, 0x0f, 0x63, 0x03, 0x58, 0x6b, 0x58, 0xd6, 0xb5, 0xa7, 0x28, 0x82, 0x5a,
+  0x42, 0xd2, 0xd6, 0xaf, 0xff, 0xfe, 0x7b, 0x31, 0x8d, 0x8d, 0x99, 0x99, 0x8c, 0xc6, 0xb3, 0x5a,
+  0xcb, 0xff, 0xfe, 0x22, 0xc6, 0x6c, 0x6d, 0xb3, 0x3c, 0xd9, 0xb3, 0x1f, 0xff, 0xf0, 0xc3, 0x5b,
+  0x19, 0xb6, 0x3c, 0xd9, 0xb6, 0x66, 0x6e, 0xb1, 0xa1, 0x6d, 0xac, 0xd6, 0x30, 0x35, 0x83, 0x4d,
+  0x65, 0x86, 0xb5, 0x9a, 0xc6, 0xb3, 0x2f, 0xff, 0xab, 0x2c, 0x1a, 0xda, 0xc6, 0x33, 0x59, 0x97,
+  0xa6, 0xb0, 0x0d, 0x35, 0xac, 0x5e, 0x8c, 0x3f, 0xfb, 0xed, 0x6d, 0x66, 0xc8, 0xc8, 0xcc, 0x30,
+  0xff, 0xff, 0xd7, 0xf9, 0xad, 0xad, 0x8c, 0xd9, 0x9e, 0x3c, 0x78, 0xd9, 0x98, 0x60, 0x59, 0x00,
+  0x00, 0x00, 0xff, 0x86, 0xbd, 0x66, 0xbd, 0x7a, 0xda, 0xf5, 0x98, 0xc3, 0x58, 0x00, 0x1f, 0xff,
+  0xbf, 0xc8, 0x41, 0x65, 0xac, 0x6b, 0x30, 0xcd, 0x7a, 0xd8, 0x63, 0x0c, 0x30, 0x30, 0xd6, 0x1a,
+  0xcd, 0x61, 0x8c, 0x31, 0xad, 0xac, 0x00, 0x77, 0xff, 0xff, 0x93, 0x5b, 0x59, 0x8c, 0x66, 0x18,
+  0x94, 0x8e, 0x63, 0x5e, 0xb1, 0x8c, 0xc3, 0x6b, 0xd6, 0xd7, 0xad, 0xaf, 0x5b, 0x5e, 0xb0, 0x01,
+  0xff, 0xff, 0xeb, 0xf3, 0x58, 0xc6, 0xbd, 0x6d, 0x7a, 0xd8, 0xcc, 0x00, 0x00, 0x3d, 0xb5, 0xac,
+  0xd6, 0xb1, 0xac, 0x1a, 0xd6, 0xa4, 0xe6, 0x42, 0x22, 0xd5, 0xa1, 0x6b, 0x57, 0xff, 0xff, 0x01,
+  0x8c, 0xc7, 0xad, 0x9b, 0x5e, 0x33, 0x18, 0xc1, 0xac, 0x7f, 0xdf, 0xff, 0x31, 0x99, 0xb3, 0x37,
+  0xaf, 0x3c, 0x6d, 0x99, 0xbf, 0xfe, 0xff, 0xe1, 0x8c, 0xd8, 0xf3, 0x36, 0xd9, 0x9b, 0x33, 0x79,
+  0x0d, 0x0b, 0x8c, 0xd6, 0x35, 0x8d, 0x30, 0x0d, 0x35, 0x80, 0xd6, 0x30, 0xd7, 0xa6, 0x7f, 0xf7,
+  0xcb, 0x58, 0x6b, 0x18, 0x66, 0x35, 0xb5, 0x86, 0xb1, 0x66, 0x8d, 0x32, 0xc1, 0xad, 0x66, 0xff,
+  0xff, 0xdb, 0x9b, 0x58, 0xcd, 0xce, 0xb3, 0x1a, 0xcf, 0xff, 0xfd, 0x8b, 0x59, 0xad, 0x8d, 0x99,
+  0xb3, 0x66, 0xd8, 0xf1, 0x98, 0xc0, 0x04, 0x00, 0x00, 0x03, 0xfa, 0x31, 0x8c, 0xd7, 0x86, 0xd6,
+  0xc3, 0x0d, 0x00, 0x03, 0xff, 0xfd, 0xff, 0xca, 0xd1, 0x6b, 0x5a, 0x60, 0xc3, 0x31, 0x8c, 0xc6,
+  0xbd, 0x63, 0x59, 0xac, 0x6b, 0x0d, 0x63, 0x58, 0x6b, 0x6b, 0x1a, 0xf5, 0x8c, 0x34, 0x00, 0x7f,
+  0x7f, 0xf5, 0x86, 0x61, 0xb5, 0xb0, 0xc5, 0x24, 0xf1, 0x98, 0x63, 0x35, 0xb0, 0xda, 0xd8, 0xc6,
+  0x63, 0x30, 0x00, 0x3f, 0xff, 0xfd, 0x2b, 0x06, 0x6b, 0x6b, 0x61, 0xb1, 0x8c, 0x00, 0x00, 0x1e,
+  0xf4, 0xc1, 0xac, 0xd6, 0xb6, 0x9a, 0xca, 0x2a, 0x40, 0x22, 0x11, 0x6a, 0xcb, 0x4d, 0xdf, 0xff,
+  0xfb, 0x38, 0x6d, 0x7a, 0xf5, 0xe3, 0x36, 0x36, 0xb6, 0x35, 0x9a, 0xcb, 0x3f, 0xff, 0xe5, 0xfe,
+  0x33, 0x31, 0xe6, 0x6d, 0xb3, 0x6c, 0xcd, 0x99, 0xff, 0xff, 0x24, 0x31, 0x99, 0xb3, 0x6c, 0xd9,
+  0xb3, 0x66, 0xd7, 0xc8, 0xd8, 0xc5, 0xb0, 0x63, 0x58, 0x35, 0x96, 0x0d, 0x1a, 0xc0, 0x61, 0x86,
+  0x19, 0x5f, 0xff, 0xda, 0xcb, 0x35, 0xaf, 0x58, 0xc6, 0x30, 0xc1, 0xac, 0xb0, 0xd3, 0x5a, 0xc0,
+  0x6b, 0x1b, 0xef, 0xff, 0x99, 0xad, 0xb4, 0xb4, 0xb0, 0xc6, 0x9f, 0xff, 0xfb, 0x3a, 0xc6, 0xbd,
+  0x6c, 0xcc, 0xd9, 0xeb, 0xcd, 0x99, 0xb1, 0x9a, 0xda, 0x68, 0x00, 0x00, 0x00, 0x1f, 0x73, 0x0c,
+  0xc6, 0x33, 0x31, 0xaf, 0x58, 0x00, 0x01, 0xff, 0xfe, 0x7f, 0x7c, 0x85, 0xa3, 0x46, 0x0c, 0x63,
+  0x19, 0x8c, 0x63, 0x5b, 0x58, 0xcb, 0xd3, 0x2f, 0x4c, 0x19, 0x7a, 0x63, 0x06, 0xd6, 0x30, 0xc0,
+  0x03, 0xfe, 0xff, 0xac, 0xd7, 0xac, 0x66, 0x31, 0xa5, 0xa5, 0x6c, 0xc3, 0x35, 0xeb, 0x18, 0xcd,
+  0x7a, 0xda, 0xf5, 0x98, 0xcc, 0x60, 0x00, 0xff, 0xff, 0xf4, 0xac, 0xd6, 0x19, 0xad, 0x8d, 0x78,
+  0x6d, 0x00, 0x00, 0x01, 0xef, 0x4c, 0x30, 0x6b, 0x69, 0xac, 0xa0, 0x61, 0xc2, 0x21, 0x08, 0x5a,
+  0xd3, 0x5f, 0xff, 0xfa, 0x86, 0x36, 0x36, 0x36, 0x3d, 0x6c, 0x36, 0xb3, 0x5a, 0xc7, 0x7f, 0xff,
+  0xcd, 0xdb, 0x5b, 0x1b, 0x36, 0x6d, 0xb3, 0x66, 0xd8, 0xd9, 0xff, 0xdf, 0xff, 0x18, 0xcc, 0xd9,
+  0xb3, 0xc7, 0x8f, 0x33, 0x37, 0xf8, 0xe0, 0xcd, 0xb5, 0x9a, 0xcd, 0x6b, 0x34, 0xd6, 0x2c, 0x1a,
+  0x6b, 0x59, 0xad, 0x6d, 0x6d, 0x61, 0x87, 0xff, 0xfb, 0x25, 0xac, 0x1a, 0xcc, 0x6b, 0xd6, 0x6b,
+  0x6b, 0x06, 0xb2, 0xc6, 0x9a, 0x62, 0xda, 0x6b, 0x0d, 0xff, 0xdf, 0xd8, 0xc6, 0xbe, 0xbb, 0x1a,
+  0xda, 0xef, 0xff, 0xfd, 0xbb, 0x5b, 0x5b, 0x5e, 0xbd, 0x78, 0xdb, 0x36, 0x6c, 0xd8, 0xd8, 0xc6,
+  0x99, 0x00, 0x00, 0x00, 0x03, 0xba, 0xc3, 0x6b, 0x63, 0x1b, 0x5b, 0x59, 0x80, 0x00, 0x1f, 0xff,
+  0xe3, 0xbf, 0xe8, 0x9a, 0x03, 0x58, 0xd6, 0xd7, 0xac, 0xc6, 0x33, 0x5e, 0xb0, 0xc3, 0x59, 0xad,
+  0x66, 0xb0, 0x6b, 0x35, 0x8d, 0x6d, 0x66, 0x18, 0xd0, 0x00, 0xff, 0xef, 0xe1, 0x8c, 0x63, 0x30,
+  0xcc, 0x4b, 0xd9, 0x86, 0x33, 0x5b, 0x5b, 0x0c, 0xd7, 0xad, 0xaf, 0x59, 0x8c, 0x60, 0x01, 0xff,
+  0xff, 0xe6, 0xd3, 0x59, 0xac, 0xc3, 0x31, 0x8c, 0xc0, 0x00, 0x00, 0x1e, 0xd8, 0x35, 0xb5, 0x83,
+  0x59, 0x3c, 0x3f, 0x04, 0x5a, 0xb5, 0x68, 0x2d, 0x35, 0x9f, 0xff, 0xf9, 0xe3, 0x1b, 0x31, 0xeb,
+  0xd7, 0xad, 0x9a, 0xd8, 0x35, 0x87, 0xff, 0xdf, 0xf5, 0x98, 0xcd, 0x99, 0xbd, 0x79, 0xeb, 0xd9,
+  0x9b, 0x1b, 0x7f, 0xff, 0xcf, 0xcd, 0x7a, 0xf5, 0xeb, 0xcd, 0x9e, 0xbc, 0xdb, 0x1e, 0xbd, 0x7f,
+  0x8f, 0x0d, 0x6b, 0xd6, 0x30, 0x6b, 0x0d, 0x32, 0xcb, 0x01, 0xa6, 0x0c, 0x31, 0x86, 0x5b, 0x7f,
+  0xff, 0x75, 0xac, 0x6b, 0x35, 0xb5, 0xb5, 0xb5, 0x9a, 0xc1, 0xac, 0x03, 0x4c, 0x5b, 0x4d, 0x63,
+  0x4f, 0xff, 0xeb, 0x31, 0xb9, 0xb8, 0x63, 0x0f, 0xef, 0xff, 0xac, 0x33, 0x19, 0xb1, 0xe3, 0xcc,
+  0xd9, 0xb3, 0x33, 0x5b, 0x59, 0x65, 0xf7, 0xf5, 0xb0, 0x00, 0x00, 0x03, 0xfe, 0xc3, 0x1b, 0x5b,
+  0x0f, 0x58, 0xc6, 0x58, 0x00, 0x1f, 0xff, 0xe0, 0xff, 0xfe, 0x5a, 0x00, 0x6b, 0x1a, 0xf5, 0x98,
+  0xc6, 0xd6, 0x63, 0x5b, 0x58, 0x6b, 0x35, 0x81, 0x83, 0x58, 0xc1, 0x9a, 0xcc, 0x6b, 0x34, 0x00,
+  0xfa, 0x9f, 0xf3, 0x18, 0x6d, 0x7a, 0xcd, 0x35, 0x33, 0x66, 0x18, 0xcd, 0x6d, 0x6d, 0x6c, 0x31,
+  0xb5, 0x98, 0xcd, 0x6c, 0x00, 0x3f, 0xff, 0xfc, 0xf4, 0xcb, 0xd3, 0x18, 0xd7, 0xac, 0xc6, 0x30,
+  0x00, 0x00, 0x03, 0xde, 0xb3, 0x59, 0xac, 0x6b, 0x58, 0xde, 0xeb, 0xab, 0x42, 0x22, 0xd2, 0xcb,
+  0x4c, 0xb7, 0xff, 0x7f, 0x33, 0x33, 0x36, 0xbc, 0x66, 0x61, 0x9a, 0xc5, 0x9f, 0xff, 0xf5, 0x76,
+  0x19, 0x99, 0xb3, 0xc7, 0x9b, 0x66, 0xda, 0xf3, 0x5e, 0xff, 0xbf, 0xff, 0xe9, 0x0c, 0xcc, 0xcf,
+  0x1e, 0x3c, 0xd9, 0xb3, 0x1f, 0xe4, 0x03, 0x8c, 0x63, 0x59, 0xad, 0x60, 0xd3, 0x59, 0x65, 0x83,
+  0x5a, 0xcd, 0x6d, 0x63, 0x1a, 0xc3, 0xef, 0xff, 0xb5, 0x86, 0xb3, 0x0c, 0xc3, 0x1a, 0xc3, 0x5a,
+  0xc0, 0xd6, 0xb0, 0x1a, 0xc6, 0xb7, 0xfd, 0xfd, 0x7a, 0x6e, 0x1e, 0x0c, 0xd7, 0xa6, 0x7f, 0xdf,
+  0xfd, 0x66, 0xb3, 0x1b, 0x1e, 0xbc, 0xcd, 0xb3, 0x3d, 0x78, 0xcc, 0x32, 0xc7, 0xff, 0xdc, 0x6d,
+  0x7a, 0x00, 0x00, 0x01, 0xf5, 0x7a, 0xcc, 0xd7, 0xad, 0x86, 0x61, 0xac, 0x00, 0x0f, 0xff, 0xf0,
+  0x3f, 0xfe, 0xa0, 0x2c, 0x35, 0x9a, 0xcc, 0x66, 0x31, 0x8c, 0x60, 0xc6, 0xb0, 0xd6, 0x1a, 0xc3,
+  0x58, 0xd6, 0xd6, 0x31, 0x8c, 0x18, 0x07, 0xf1, 0x63, 0xfa, 0x6b, 0xd6, 0x63, 0x31, 0xc9, 0xbb,
+  0x30, 0xcd, 0x6d, 0x7a, 0xc3, 0x6b, 0x6b, 0x6b, 0xd6, 0x33, 0x5e, 0xb0, 0x00, 0x7f, 0xff, 0xf9,
+  0xeb, 0x06, 0xb3, 0x5b, 0x59, 0x86, 0x63, 0x00, 0x00, 0x00, 0x0f, 0xcc, 0xc1, 0x8d, 0x6b, 0x4c,
+  0xed, 0xa1, 0x10, 0x84, 0x16, 0xb5, 0xac, 0x7d, 0xff, 0xc6, 0xc6, 0x6c, 0x6c, 0x66, 0x6b, 0x35,
+  0x83, 0xfb, 0xff, 0xfe, 0xbf, 0x6b, 0x33, 0x33, 0x66, 0xd9, 0xb6, 0xcd, 0x9b, 0x19, 0xbf, 0xff,
+  0xeb, 0x7e, 0x66, 0x3d, 0x79, 0xb3, 0x66, 0xd9, 0xb3, 0x1f, 0xe4, 0x43, 0xcc, 0x6b, 0x6b, 0x0d,
+  0x60, 0x34, 0xd3, 0x59, 0x60, 0x60, 0xc6, 0x18, 0xd6, 0x37, 0x7f, 0xff, 0x59, 0x7a, 0x66, 0xb6,
+  0xb6, 0xb6, 0xb1, 0xac, 0x6b, 0x58, 0x06, 0xb0, 0x19, 0x6d, 0x33, 0xff, 0xff, 0xbd, 0x7a, 0xdc,
+  0xbc, 0x98, 0xc3, 0x5f, 0xf7, 0xfd, 0x6d, 0x63, 0x31, 0xeb, 0xc6, 0xd9, 0xb3, 0x66, 0x6d, 0x78,
+  0x30, 0x7f, 0xff, 0xf7, 0xd8, 0xda, 0xd8, 0x00, 0x53, 0x58, 0xd6, 0x0d, 0xf4, 0x66, 0x33, 0x18,
+  0xd6, 0xd6, 0x00, 0x07, 0xff, 0xf8, 0x0f, 0xfe, 0xe8, 0xb2, 0xc0, 0xc3, 0x35, 0xb1, 0x8c, 0xc6,
+  0xbd, 0x6b, 0x6b, 0x1a, 0xc3, 0x58, 0x35, 0x8d, 0x63, 0x59, 0x86, 0x6b, 0x6b, 0x0c, 0x0f, 0xfb,
+  0x00, 0xdf, 0x7d, 0x98, 0x6d, 0x6c, 0x7a, 0x76, 0xcc, 0x6b, 0x61, 0x8c, 0x61, 0xb5, 0x98, 0x6d,
+  0x66, 0x18, 0x00, 0xbf, 0xff, 0xfc, 0xc0, 0xd6, 0x30, 0xc3, 0x30, 0xcd, 0x00, 0x00, 0x00, 0x07,
+  0xf8, 0xd7, 0xac, 0x1a, 0xd2, 0xfb, 0x28, 0xb5, 0x68, 0x8b, 0x45, 0xad, 0x6b, 0x06, 0xff, 0xff,
+  0xc1, 0x1e, 0xb6, 0x3d, 0x6c, 0xc6, 0x6b, 0xd3, 0x03, 0xff, 0xfe, 0xf7, 0xfb, 0x30, 0xd9, 0x99,
+  0xe6, 0x6f, 0x1e, 0x6c, 0xcd, 0xaf, 0x5d, 0xff, 0xff, 0x64, 0xcc, 0x6d, 0x8f, 0x36, 0x78, 0xdb,
+  0x07, 0xf9, 0x21, 0x03, 0x0c, 0x6b, 0x1a, 0xd6, 0x00, 0xd1, 0xad, 0x65, 0xb4, 0xc6, 0xbd, 0x61,
+  0x9a, 0xc0, 0xff, 0xfb, 0xac, 0x65, 0xeb, 0x30, 0xcd, 0x66, 0xb0, 0x6b, 0x58, 0x35, 0xac, 0x1a,
+  0xc1, 0x97, 0xdf, 0xfd, 0x9a, 0xe9, 0xe8, 0xc3, 0x07, 0xff, 0x7f, 0xd9, 0xac, 0xc6, 0x66, 0xc7,
+  0x8f, 0x33, 0x66, 0x6c, 0x66, 0xb0, 0xff, 0xff, 0xea, 0x33, 0x5e, 0xb6, 0xbd, 0x60, 0xe8, 0xc3,
+  0x06, 0x06, 0xb5, 0xae, 0xcc, 0x63, 0x18, 0x76, 0x00, 0x0f, 0xff, 0xf0, 0x0f, 0xef, 0xf9, 0x65,
+  0xac, 0x1a, 0xcc, 0x36, 0xb6, 0x31, 0x8d, 0x7a, 0xc3, 0x2f, 0x5a, 0xc6, 0xb2, 0xf4, 0xd6, 0x6b,
+  0x0c, 0x61, 0x9a, 0xf4, 0xc6, 0x17, 0xd6, 0x06, 0xb5, 0xaf, 0xac, 0xc6, 0x34, 0x13, 0xf8, 0xcc,
+  0x33, 0x5b, 0x59, 0x8d, 0x6c, 0x31, 0x8c, 0x60, 0x00, 0x5f, 0xff, 0xfe, 0x63, 0x5a, 0xc6, 0xb3,
+  0x5b, 0x58, 0xcd, 0x66, 0x00, 0x00, 0x00, 0x06, 0xff, 0x58, 0xd6, 0xd3, 0x59, 0x5d, 0x74, 0x5a,
+  0xb4, 0xb4, 0xb4, 0xb2, 0xd6, 0xb0, 0x67, 0xdf, 0xfd, 0x8f, 0x5e, 0xbc, 0x66, 0x33, 0x1a, 0xc1,
+  0xdf, 0xff, 0xf8, 0x3a, 0xda, 0xd8, 0xd9, 0x9b, 0x6c, 0xdb, 0x36, 0xcc, 0xcc, 0xd7, 0xff, 0xf7,
+  0xfd, 0x98, 0xd9, 0xb6, 0x67, 0x99, 0xb6, 0x0f, 0xf2, 0x72, 0x33, 0x18, 0x6b, 0x1a, 0xd6, 0x16,
+  0x34, 0x0d, 0x6b, 0x0c, 0x19, 0xaf, 0x5a, 0xf4, 0xc3, 0x5f, 0xdf, 0xfd, 0x86, 0x18, 0xc6, 0x35,
+  0x9a, 0xc3, 0x5a, 0xc0, 0xd6, 0xb1, 0xad, 0x63, 0x58, 0xff, 0xff, 0xf6, 0xc3, 0xb7, 0xb1, 0x86,
+  0x1f, 0xff, 0xdc, 0x61, 0x8c, 0xd8, 0xf5, 0xe6, 0x6d, 0x99, 0x9e, 0xb6, 0x18, 0x7f, 0xff, 0xf3,
+  0x5b, 0x5b, 0x0d, 0xaf, 0x58, 0xfa, 0x6b, 0x6b, 0x35, 0x9a, 0xc1, 0xad, 0x65, 0x85, 0x83, 0x4d,
+  0x61, 0x80, 0x1f, 0xff, 0xe0, 0x0f, 0xbf, 0xfa, 0xcb, 0x5a, 0xc6, 0xb1, 0x8c, 0x6d, 0x6d, 0x7a,
+  0xc6, 0x35, 0x9a, 0xc6, 0xb5, 0xb4, 0xd6, 0x35, 0x83, 0x0c, 0x61, 0xb5, 0x8c, 0x0e, 0xe5, 0x86,
+  0xb5, 0xac, 0x3a, 0xb3, 0x1a, 0x2a, 0x1c, 0xc3, 0x30, 0xc6, 0x35, 0xb0, 0x6d, 0x66, 0xb6, 0xb6,
+  0xb0, 0x00, 0xef, 0xff, 0xeb, 0x5a, 0xc3, 0x58, 0xd6, 0x61, 0x8c, 0x30, 0x00, 0x00, 0x00, 0x1f,
+  0xec, 0x30, 0x68, 0xa0, 0xac, 0x5a, 0x21, 0x16, 0x96, 0x5a, 0xd6, 0x1a, 0xda, 0xff, 0xee, 0xda,
+  0xf1, 0xb5, 0xe3, 0x18, 0xd6, 0x0f, 0xff, 0xef, 0xfa, 0xd7, 0xad, 0xaf, 0x1b, 0x36, 0xd9, 0xb3,
+  0xc7, 0x99, 0x98, 0xdd, 0xff, 0xff, 0x83, 0x6c, 0x6c, 0xd9, 0xb6, 0x6c, 0xf5, 0xe0, 0xff, 0x2a,
+  0x26, 0x30, 0xc3, 0x03, 0x5a, 0xcb, 0x04, 0x1a, 0x6b, 0x06, 0x31, 0xaf, 0x58, 0x60, 0x2f, 0xff,
+  0xe0, 0xc6, 0x19, 0x86, 0xb6, 0xb5, 0x9a, 0x65, 0x8d, 0x30, 0x19, 0x7a, 0x6b, 0x3f, 0xef, 0x87,
+  0x8f, 0x81, 0x86, 0x3f, 0xff, 0xfa, 0x63, 0x0c, 0xcc, 0x6c, 0xd9, 0xb3, 0x3d, 0x78, 0xf5, 0xb1,
+  0x87, 0xff, 0xff, 0x15, 0x8c, 0x66, 0x31, 0x97, 0xff, 0xf6, 0xbd, 0x63, 0x1a, 0xda, 0x61, 0xad,
+  0x6b, 0x05, 0x8d, 0x1a, 0xc1, 0x86, 0x07, 0xff, 0xf8, 0x01, 0xdf, 0xff, 0x26, 0xb5, 0x83, 0x0c,
+  0xc6, 0x33, 0x1a, 0xf5, 0x8d, 0x66, 0xb0, 0xd6, 0x0d, 0x61, 0xac, 0x30, 0xc6, 0x31, 0xaf, 0x5a,
+  0xda, 0xff, 0xfa, 0x2f, 0x46, 0xb0, 0x02, 0xec, 0xd4, 0x9c, 0x7e, 0x63, 0x1a, 0xf5, 0x8c, 0x31,
+  0x86, 0x31, 0x86, 0x00, 0x03, 0xbf, 0xff, 0x96, 0x06, 0xb0, 0x63, 0x0c, 0x31, 0x80, 0x00, 0x00,
+  0x00, 0x7e, 0xf1, 0x80, 0xc9, 0x29, 0xe5, 0xa5, 0xab, 0x45, 0xa2, 0xd6, 0x59, 0x6d, 0x63, 0x2f,
+  0xff, 0xb1, 0xb3, 0x1b, 0x5b, 0x0c, 0xb6, 0x9f, 0xff, 0xfa, 0x86, 0x19, 0x9b, 0x1e, 0x67, 0x99,
+  0xe6, 0xcd, 0x99, 0x8d, 0x7f, 0xf7, 0xff, 0xdb, 0x1b, 0x36, 0x6c, 0xf1, 0xe3, 0x07, 0xf9, 0x71,
+  0x4e, 0x6b, 0x6b, 0x35, 0xac, 0x69, 0xac, 0xb2, 0x00, 0x06, 0x30, 0xc6, 0xbd, 0x63, 0x58, 0xd1,
+  0xff, 0xfd, 0x35, 0x9a, 0xda, 0xda, 0xda, 0xd7, 0xa6, 0x06, 0xb0, 0x35, 0x83, 0x58, 0x30, 0x7d,
+  0x8f, 0x4f, 0x33, 0x5b, 0x5a, 0xff, 0xff, 0xe9, 0x6b, 0x18, 0xcc, 0xcc, 0xd9, 0xb3, 0x66, 0x7a,
+  0xd9, 0x8c, 0x7f, 0xff, 0x7c, 0xc6, 0x31, 0xb5, 0xb5, 0xbb, 0xff, 0xfb, 0xd6, 0x61, 0x8c, 0x18,
+  0x1a, 0xcb, 0x00, 0x1a, 0xc0, 0xc3, 0x18, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x5d, 0x69, 0xac,
+  0x35, 0xb5, 0x99, 0x86, 0xd6, 0xd6, 0xd6, 0x30, 0x6b, 0x1a, 0xd6, 0x69, 0x83, 0x59, 0xac, 0xd6,
+  0xd6, 0xd6, 0xd6, 0x6b, 0x1f, 0xff, 0xfe, 0x9f, 0xfd, 0x83, 0x59, 0x60, 0x69, 0xac, 0xe4, 0xdc,
+  0xc1, 0x8c, 0x33, 0x06, 0x65, 0xeb, 0x18, 0x63, 0x0c, 0x00, 0x0e, 0xff, 0xfe, 0x06, 0x99, 0x6d,
+  0x33, 0x58, 0xc3, 0x0c, 0x00, 0x00, 0x00, 0x03, 0xf7, 0x8c, 0x02, 0x12, 0x41, 0x69, 0x04, 0x40,
+  0xb5, 0x96, 0x18, 0x6b, 0xcf, 0xbf, 0xec, 0xcc, 0xc6, 0xd6, 0x6b, 0x07, 0xfd, 0xff, 0xff, 0xb1,
+  0xb5, 0x8c, 0xcc, 0xd9, 0xb3, 0xcc, 0xf3, 0x66, 0xc7, 0xac, 0xd6, 0xff, 0xff, 0xd0, 0x33, 0x66,
+  0x78, 0xf3, 0x66, 0x03, 0xfc, 0xc8, 0xb7, 0x18, 0x61, 0xac, 0x1a, 0x6b, 0x5a, 0x00, 0x00, 0xda,
+  0xd8, 0x63, 0x06, 0x06, 0xbf, 0xef, 0xe6, 0xb6, 0xb3, 0x0c, 0x65, 0xe9, 0x81, 0x96, 0x35, 0xac,
+  0x6b, 0x58, 0xd6, 0x0e, 0x3e, 0x3d, 0xb1, 0x82, 0xff, 0xfe, 0xd6, 0x19, 0x8c, 0xcd, 0x99, 0xb6,
+  0x3d, 0x79, 0x99, 0x8c, 0xff, 0xef, 0xf8, 0xc6, 0x31, 0x98, 0xcf, 0xef, 0xfe, 0xda, 0xda, 0xcd,
+  0x6d, 0x66, 0xb0, 0x35, 0x96, 0x01, 0xa6, 0x59, 0xac, 0x31, 0x8f, 0xff, 0xf0, 0x00, 0x7f, 0xff,
+  0x76, 0x9a, 0xd6, 0x6b, 0x35, 0xeb, 0x31, 0x9a, 0xf5, 0x8c, 0x18, 0xd6, 0xb3, 0x5a, 0xc3, 0x58,
+  0x30, 0x66, 0x18, 0xcd, 0x66, 0x5b, 0xff, 0xef, 0xff, 0x81, 0xac, 0x01, 0xa6, 0x58, 0x9e, 0x9d,
+  0x46, 0xb6, 0xb3, 0x5e, 0x99, 0xac, 0xd6, 0x6b, 0x30, 0xd6, 0xc0, 0x00, 0xef, 0xff, 0xe6, 0xb4,
+  0xcb, 0x0c, 0xb6, 0xb1, 0x83, 0x34, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xcc, 0x5b, 0x47, 0x88, 0x44,
+  0x12, 0xd2, 0xd0, 0xb2, 0xd6, 0x0d, 0x6c, 0x31, 0xdf, 0xd7, 0x8c, 0x6d, 0x6d, 0x60, 0x7f, 0xff,
+  0xf3, 0xf0, 0xc6, 0x66, 0x67, 0x8f, 0x36, 0xcd, 0xb3, 0x36, 0x33, 0x5b, 0xff, 0xbf, 0xfe, 0x66,
+  0xcc, 0xf5, 0xe7, 0xaf, 0x30, 0x1f, 0xe6, 0xc6, 0x38, 0x63, 0x06, 0x58, 0x34, 0x68, 0x00, 0x00,
+  0x3c, 0xc3, 0x35, 0x9a, 0xc0, 0x6f, 0xef, 0xfa, 0xd7, 0xac, 0x63, 0x0d, 0x66, 0xb0, 0x6b, 0x03,
+  0x2c, 0xd6, 0x5e, 0x98, 0x0a, 0xfb, 0xf9, 0xd7, 0xa6, 0x3b, 0xff, 0xac, 0x19, 0x98, 0xd8, 0xf1,
+  0xb6, 0x3c, 0x6c, 0xcc, 0x6f, 0xbf, 0xff, 0x8d, 0x6d, 0x66, 0x6b, 0xd6, 0x67, 0xff, 0x7d, 0x7a,
+  0xc6, 0x19, 0xac, 0xd6, 0x0d, 0x6b, 0x00, 0x35, 0xac, 0x6b, 0x0c, 0x63, 0xdf, 0xf4, 0x00, 0x0f,
+  0xfe, 0xfe, 0x35, 0xac, 0x6b, 0x31, 0x8d, 0xac, 0xc6, 0xbd, 0x6b, 0x6b, 0x0d, 0x60, 0x65, 0x9a,
+  0xd6, 0x6b, 0x18, 0x66, 0x19, 0x83, 0x3f, 0xef, 0xff, 0xfe, 0x7b, 0xd1, 0x8b, 0x34, 0x35, 0xad,
+  0x62, 0x72, 0x6b, 0x5e, 0xb5, 0xeb, 0x1b, 0xb6, 0xb1, 0x83, 0x18, 0x31, 0x80, 0x00, 0x77, 0xff,
+  0xf6, 0x59, 0x60, 0x30, 0x6b, 0x6b, 0x0c, 0x68, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xb5, 0x8b, 0x1b,
+  0x9e, 0xa0, 0x84, 0x20, 0x5a, 0xd6, 0x0d, 0x7a, 0xc6, 0x63, 0xbf, 0x8c, 0xc6, 0x30, 0x3e, 0xff,
+  0xff, 0xec, 0xc1, 0xb5, 0xb3, 0x33, 0xc7, 0x9b, 0x36, 0xd9, 0x9b, 0x18, 0x67, 0xff, 0xfe, 0xfd,
+  0x9b, 0x33, 0x6c, 0xd9, 0x80, 0x7f, 0x9d, 0x9b, 0x31, 0x86, 0x1a, 0xcb, 0x06, 0x80, 0x00, 0x00,
+  0x3d, 0x8d, 0x7a, 0xc3, 0x00, 0x6f, 0xff, 0xf6, 0x9d, 0x6d, 0x6d, 0x63, 0x0c, 0x19, 0x7a, 0x30,
+  0x32, 0xda, 0x60, 0xd6, 0x01, 0xfb, 0xf9, 0x61, 0xad, 0xf7, 0xfd, 0x63, 0x5b, 0x5e, 0xb6, 0x66,
+  0x6c, 0xcf, 0x5e, 0x36, 0x66, 0x37, 0xff, 0xfe, 0xa1, 0xac, 0x63, 0x19, 0x8c, 0xff, 0xfb, 0xe6,
+  0x6b, 0x6b, 0x6b, 0x35, 0xb5, 0xac, 0xd3, 0x58, 0x5b, 0x46, 0xb5, 0x8d, 0x61, 0x8c, 0x76, 0x79,
+  0x30, 0x00, 0x3f, 0xef, 0xe9, 0xa6, 0x18, 0x66, 0xbd, 0x6d, 0x6c, 0x35, 0xeb, 0x5e, 0x98, 0x35,
+  0x83, 0x58, 0x35, 0x8c, 0x35, 0xeb, 0x31, 0xaf, 0x58, 0xd5, 0xff, 0xff, 0xc6, 0x19, 0x60, 0xd3,
+  0x4d, 0x65, 0x93, 0x32, 0xfa, 0xda, 0xcd, 0x66, 0x18, 0xc2, 0xd6, 0x30, 0x63, 0x00, 0x01, 0xdf,
+  0xff, 0x0b, 0x03, 0x5a, 0xc6, 0xb1, 0xac, 0xd6, 0x30, 0x00, 0x00, 0x00, 0x06, 0xff, 0x1a, 0xc1,
+  0x91, 0xc2, 0x16, 0xad, 0x16, 0x8b, 0x5a, 0xcb, 0x0c, 0x33, 0x0f, 0x59, 0x7f, 0xf6, 0xd6, 0xc3,
+  0x03, 0xfb, 0xff, 0xac, 0x63, 0x1b, 0x33, 0xc7, 0x99, 0xe6, 0xcd, 0x9b, 0x0c, 0xd6, 0xff, 0xbf,
+  0xff, 0xb3, 0x63, 0xcc, 0xdb, 0x00, 0x3f, 0xd0, 0x0e, 0xcd, 0xac, 0x60, 0x6b, 0x0b, 0x00, 0x00,
+  0x00, 0x0d, 0xb3, 0x18, 0x30, 0x03, 0xfe, 0xfe, 0xcc, 0x30, 0xc6, 0xb1, 0xac, 0x35, 0x83, 0x2d,
+  0xa6, 0x0c, 0x00, 0xff, 0xfe, 0xb2, 0xf5, 0xaf, 0xbf, 0xac, 0xd6, 0x63, 0x33, 0x36, 0x3c, 0x6c,
+  0xd9, 0x98, 0xdb, 0xff, 0xef, 0xe1, 0x86, 0x31, 0x98, 0xd7, 0xff, 0x7c, 0x66, 0xbd, 0x63, 0x0c,
+  0x6b, 0x1a, 0x6b, 0x00, 0x6b, 0x2d, 0xa6, 0x35, 0x98, 0xe1, 0xe7, 0x60, 0x00, 0x3b, 0xff, 0xf8,
+  0xd6, 0xb3, 0x5b, 0x59, 0x9a, 0xf5, 0x9a, 0xf5, 0x86, 0x0c, 0x0d, 0x60, 0xd6, 0x1a, 0xc6, 0xb6,
+  0xb6, 0xb3, 0x18, 0xc3, 0x5f, 0xff, 0xfb, 0xe3, 0x58, 0x0d, 0x35, 0xad, 0x65, 0xa5, 0xa5, 0x35,
+  0x98, 0x36, 0xb1, 0x8d, 0x6d, 0x60, 0x6b, 0x5a, 0xc0, 0x00, 0x3b, 0xff, 0xed, 0x06, 0x8d, 0x60,
+  0x60, 0xc1, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xf1, 0x96, 0x2e, 0x34, 0x82, 0x10, 0xb4, 0xb2,
+  0xd6, 0xb2, 0xf5, 0xaf, 0x58, 0xda, 0xd8, 0xc7, 0xff, 0xd9, 0x86, 0x03, 0xff, 0xff, 0xdb, 0xb0,
+  0xcc, 0xc7, 0xaf, 0x33, 0xcc, 0xf3, 0x3c, 0x78, 0xc6, 0x34, 0xff, 0xff, 0xee, 0xe6, 0x6c, 0xf5,
+  0xe6, 0x00, 0x3f, 0x91, 0x50, 0x0c, 0xd6, 0xd6, 0xb6, 0x9a, 0xcb, 0x16, 0x10, 0x00, 0x00, 0x1e,
+  0xcc, 0x61, 0xac, 0x01, 0xf7, 0xfc, 0x63, 0x5b, 0x58, 0xd6, 0x6b, 0x5b, 0x4c, 0x1a, 0xc6, 0xb0,
+  0xd6, 0x00, 0xff, 0xff, 0x96, 0x1b, 0xfe, 0xfa, 0xda, 0xc6, 0x33, 0x6b, 0xcc, 0xcc, 0xf5, 0xe3,
+  0xd6, 0xcc, 0xef, 0xff, 0xe0, 0xc3, 0x35, 0xb0, 0xcc, 0xff, 0xff, 0xd5, 0x8c, 0x33, 0x5b, 0x0d,
+  0x6d, 0x60, 0x6b, 0x2c, 0x34, 0xd6, 0x0d, 0x6d, 0x36, 0xb3, 0x5b, 0x70, 0xcc, 0x00, 0x0f, 0xff,
+  0xff, 0x56, 0x98, 0x6b, 0x61, 0x98, 0xc6, 0x18, 0xd6, 0x35, 0x81, 0xac, 0x35, 0xac, 0xd6, 0x35,
+  0xb5, 0xb5, 0xeb, 0x19, 0xac, 0xd7, 0xff, 0xfe, 0xda, 0x6b, 0x03, 0x4d, 0x35, 0xac, 0x24, 0xe4,
+  0x58, 0x63, 0x0c, 0x61, 0x8c, 0xbd, 0x19, 0x65, 0x80, 0x00, 0x77, 0xff, 0x5a, 0xd6, 0x9a, 0xcb,
+  0x0c, 0xb3, 0x58, 0xcb, 0xd3, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xb6, 0x9a, 0x2b, 0x30, 0x0b, 0x56,
+  0x84, 0x16, 0x9a, 0xcb, 0x35, 0x98, 0x6d, 0x7a, 0xcc, 0xc7, 0xff, 0x00, 0x0f, 0xfb, 0xfe, 0x5e,
+  0xb3, 0x1b, 0x33, 0x6c, 0xdb, 0x36, 0x78, 0xd9, 0x8c, 0x35, 0xf7, 0xff, 0xf3, 0x36, 0x6c, 0xc0,
+  0x03, 0xf9, 0x2d, 0x18, 0xc3, 0x35, 0x81, 0xad, 0x65, 0x96, 0x5a, 0x00, 0x00, 0x03, 0xfd, 0x63,
+  0x0d, 0x60, 0x07, 0xff, 0xf1, 0x8c, 0x35, 0xb5, 0x86, 0x5b, 0x59, 0x7a, 0x61, 0xac, 0x35, 0x8c,
+  0x0f, 0xff, 0xf4, 0xb0, 0xfe, 0xfe, 0xcd, 0x63, 0x33, 0x1b, 0x1e, 0xbc, 0xcc, 0xd8, 0xd8, 0xdf,
+  0xff, 0x7c, 0x35, 0xb5, 0x9a, 0xd8, 0x66, 0x7f, 0xff, 0xe9, 0x76, 0x30, 0xcc, 0x33, 0x58, 0xcb,
+  0x69, 0xad, 0x60, 0xd3, 0x2d, 0xa6, 0x18, 0x66, 0x5e, 0x89, 0x8c, 0x00, 0x0f, 0xff, 0xbe, 0x30,
+  0x61, 0xb5, 0xb0, 0xc6, 0x30, 0x60, 0x60, 0x35, 0x86, 0xb0, 0x63, 0x0c, 0x66, 0x30, 0xc3, 0xff,
+  0xff, 0x63, 0xa6, 0x58, 0x69, 0xa6, 0xb5, 0xac, 0x48, 0x47, 0x30, 0xd6, 0xc3, 0x1a, 0xf5, 0x8d,
+  0x66, 0xb5, 0x8b, 0x00, 0x00, 0x5f, 0xff, 0x2c, 0xb5, 0x96, 0x03, 0x58, 0xd6, 0x35, 0x8d, 0x00,
+  0x00, 0x00, 0x00, 0x7f, 0xb0, 0x0a, 0x0b, 0x4b, 0x42, 0x16, 0x96, 0x4d, 0x6b, 0x5b, 0x4d, 0xac,
+  0xc6, 0x36, 0x1b, 0x58, 0x00, 0x7f, 0xff, 0xfa, 0xd9, 0x86, 0xcc, 0xcd, 0x9e, 0x3c, 0xdb, 0x33,
+  0x66, 0xbd, 0x60, 0xdd, 0x5e, 0x36, 0x00, 0x05, 0xfa, 0xa2, 0x98, 0x33, 0x5b, 0x5a, 0xc6, 0x9a,
+  0xd6, 0xb4, 0xd6, 0x80, 0x00, 0x00, 0x7e, 0x66, 0xb6, 0x98, 0x5e, 0x83, 0xff, 0xeb, 0x0d, 0x7a,
+  0xc3, 0x59, 0xac, 0x6b, 0x0c, 0x0c, 0x18, 0x00, 0xff, 0xff, 0x2b, 0x0f, 0xfe, 0x8d, 0x66, 0x33,
+  0x1b, 0x33, 0x63, 0xd7, 0x8d, 0x8d, 0xbe, 0xff, 0xf8, 0x6b, 0x35, 0x98, 0x66, 0x1b, 0xff, 0xff,
+  0x3f, 0xb5, 0x98, 0xc3, 0x6b, 0x35, 0x9a, 0xc0, 0xd6, 0x2d, 0xa3, 0x2c, 0xd6, 0x0c, 0x66, 0x06,
+  0x35, 0xeb, 0x30, 0x00, 0x1f, 0xf7, 0xfd, 0xac, 0x19, 0xad, 0x8d, 0x7a, 0xcc, 0x35, 0xb4, 0xc3,
+  0x59, 0x6d, 0x35, 0x86, 0xb1, 0xad, 0xac, 0xc3, 0x6b, 0x6b, 0x6b, 0x1f, 0xff, 0xdf, 0xf3, 0x58,
+  0x06, 0x9a, 0xd3, 0x58, 0x8d, 0x8b, 0x6b, 0x30, 0xc6, 0xbd, 0x66, 0x1a, 0xcd, 0x62, 0xcd, 0x00,
+  0x00, 0xbf, 0xfa, 0x0b, 0x0b, 0x1a, 0x6b, 0x1a, 0xc3, 0x06, 0x80, 0x00, 0x00, 0x00, 0x7e, 0xd8,
+  0x09, 0x4a, 0x8b, 0x4b, 0x42, 0x16, 0xb4, 0xd6, 0xb0, 0xc3, 0x31, 0x98, 0xcc, 0x60, 0x00, 0xff,
+  0xbf, 0xfb, 0x35, 0xeb, 0x63, 0xd7, 0x99, 0xb6, 0xcd, 0x9b, 0x36, 0x33, 0x58, 0x00, 0x00, 0x01,
+  0xdf, 0x8b, 0x0a, 0x58, 0xc6, 0x1a, 0xc1, 0xa6, 0x9a, 0x34, 0x30, 0x00, 0x00, 0x1e, 0xf0, 0xc6,
+  0xb5, 0x80, 0x3f, 0xef, 0xb0, 0xc6, 0xb6, 0xb5, 0xb5, 0x86, 0xb3, 0x58, 0x60, 0x60, 0xc0, 0xff,
+  0xff, 0x1d, 0xac, 0xff, 0xe8, 0x63, 0x1b, 0x5b, 0x33, 0x63, 0x66, 0x6c, 0x6d, 0x7b, 0xff, 0xfb,
+  0x8d, 0x63, 0x06, 0xd6, 0x61, 0xbf, 0xff, 0xf3, 0x78, 0xc6, 0x31, 0x8c, 0x30, 0xc5, 0xe9, 0xad,
+  0x61, 0xa6, 0x5e, 0x9a, 0xda, 0xc3, 0x5a, 0xdd, 0xdb, 0x5e, 0xb0, 0x00, 0x1d, 0xff, 0xfd, 0xac,
+  0x31, 0xaf, 0x5b, 0x0c, 0x6b, 0xd3, 0x1a, 0xc0, 0xd6, 0x0d, 0x60, 0xc1, 0x8c, 0x63, 0x19, 0xaf,
+  0x4c, 0xff, 0xfb, 0xff, 0xb5, 0x96, 0x68, 0x69, 0xa6, 0xb5, 0x91, 0x51, 0x06, 0x18, 0xc3, 0x6b,
+  0x35, 0xb5, 0x8c, 0xb0, 0xd0, 0x00, 0x03, 0xff, 0xe9, 0xa0, 0x01, 0xac, 0xb6, 0x98, 0x65, 0xe9,
+  0x80, 0x00, 0x00, 0x00, 0x7b, 0xf5, 0x81, 0x19, 0x42, 0xd1, 0x69, 0x68, 0xb5, 0xa3, 0x4c, 0x1a,
+  0xf5, 0x98, 0xcc, 0x66, 0x30, 0x00, 0x5f, 0xff, 0xfe, 0x83, 0x33, 0x1e, 0xbc, 0xcf, 0x5e, 0xcc,
+  0xf3, 0x33, 0x31, 0x8b, 0x00, 0x00, 0x02, 0x7d, 0xaf, 0xac, 0xe1, 0xb5, 0x86, 0x58, 0x68, 0x68,
+  0x00, 0x00, 0x00, 0x06, 0xfc, 0xd6, 0x19, 0x60, 0x1b, 0xff, 0xbe, 0xc6, 0xb6, 0xb0, 0xc6, 0xb1,
+  0x97, 0xa6, 0x35, 0x8d, 0x60, 0xc0, 0xff, 0xff, 0x15, 0xad, 0xff, 0xf0, 0xc3, 0x31, 0x99, 0x9b,
+  0x1b, 0x33, 0x63, 0x37, 0x7f, 0xfc, 0xd6, 0xb6, 0x99, 0x86, 0xbd, 0x66, 0xbf, 0xfe, 0xfe, 0xcd,
+  0x6d, 0x6d, 0x6c, 0x31, 0xac, 0xd6, 0x06, 0xb5, 0x86, 0xb5, 0x86, 0xb3, 0x59, 0xaa, 0xab, 0x0b,
+  0x31, 0x86, 0x00, 0x0f, 0xff, 0xff, 0x65, 0x8d, 0x7a, 0xc6, 0x61, 0x9a, 0xcd, 0x61, 0xac, 0x1a,
+  0xc0, 0x60, 0xd6, 0xd6, 0x31, 0x98, 0x6d, 0x66, 0xb7, 0xff, 0x7f, 0xfd, 0xac, 0xb1, 0xa1, 0xa3,
+  0x5a, 0x64, 0x3c, 0x29, 0xad, 0xac, 0xc3, 0x30, 0xcd, 0x63, 0x01, 0xa6, 0x80, 0x00, 0xff, 0xea,
+  0xd3, 0x41, 0xa3, 0x58, 0x1a, 0xcd, 0x60, 0xd6, 0x00, 0x00, 0x00, 0x07, 0xbf, 0x5a, 0xc2, 0x22,
+  0x7b, 0x4b, 0x5a, 0xb4, 0x2d, 0x1a, 0x35, 0x83, 0x31, 0x8c, 0xc6, 0x63, 0x00, 0x03, 0xff, 0xbf,
+  0x8c, 0xcc, 0xcc, 0xdb, 0x33, 0xcd, 0x99, 0xeb, 0xc3, 0x35, 0x90, 0x00, 0x00, 0x2b, 0xe9, 0x99,
+  0x83, 0x0c, 0xd6, 0x35, 0x80, 0x00, 0x58, 0xb0, 0x00, 0x00, 0x1b, 0xf3, 0x58, 0xd6, 0xb0, 0x68,
+  0xff, 0xba, 0xda, 0xc6, 0x1a, 0xf4, 0xc6, 0xb3, 0x58, 0xcb, 0xd3, 0x06, 0x81, 0xff, 0xfe, 0x1c,
+  0x3f, 0xf8, 0xd6, 0x63, 0x19, 0xb5, 0xe3, 0x66, 0x66, 0x66, 0xd7, 0xfd, 0xf6, 0xb0, 0x60, 0xcd,
+  0x6d, 0x66, 0xbf, 0xfe, 0xfe, 0xc3, 0x19, 0x86, 0x6b, 0x6b, 0x0c, 0xb1, 0xad, 0x60, 0x6b, 0x06,
+  0x0c, 0x69, 0xfa, 0x5b, 0x19, 0x86, 0x00, 0x07, 0xff, 0x7d, 0x66, 0xb6, 0xb6, 0xb3, 0x18, 0xd6,
+  0x6b, 0x0d, 0x6b, 0x1a, 0xd6, 0x1a, 0xc1, 0x9a, 0xcd, 0x7a, 0xcc, 0x66, 0xb3, 0x5f, 0xdf, 0xff,
+  0x4c, 0x00, 0x34, 0x69, 0xad, 0x09, 0x03, 0xb5, 0x86, 0x61, 0x9a, 0xf5, 0x8c, 0x6b, 0x0d, 0x6b,
+  0x58, 0x00, 0x0f, 0xfb, 0x8b, 0x5a, 0xd1, 0xad, 0x6b, 0x0d, 0x61, 0xac, 0x32, 0xf0, 0x00, 0x00,
+  0x00, 0x7e, 0xcd, 0x68, 0x88, 0x98, 0x10, 0xb4, 0x5a, 0x06, 0x9a, 0xc6, 0x19, 0x8c, 0xc6, 0xd6,
+  0xd6, 0x60, 0x02, 0xff, 0xff, 0xf4, 0x36, 0xb6, 0x66, 0xcc, 0xdb, 0x36, 0xcd, 0x8f, 0x5b, 0x06,
+  0x80, 0x00, 0x00, 0xe7, 0xbb, 0x73, 0x43, 0x18, 0xc1, 0xac, 0x58, 0x0b, 0x16, 0xb5, 0xa0, 0x00,
+  0x00, 0x37, 0xe6, 0xb3, 0x5a, 0xc0, 0xd3, 0x7f, 0xff, 0x2d, 0xac, 0xd6, 0xd6, 0x18, 0x61, 0x86,
+  0x0c, 0x0c, 0x07, 0xff, 0xf8, 0x71, 0x7f, 0xc6, 0x0d, 0xad, 0x8d, 0x8d, 0x8d, 0x99, 0x99, 0x8f,
+  0xff, 0xac, 0xb6, 0x98, 0xd6, 0x61, 0x86, 0xff, 0xfe, 0xfe, 0xd6, 0x6b, 0x61, 0xb5, 0x98, 0x31,
+  0xad, 0x63, 0x5a, 0xc0, 0x60, 0x61, 0x84, 0xac, 0xd3, 0x18, 0x6d, 0x60, 0x00, 0x7d, 0xff, 0xc3,
+  0x5e, 0xb1, 0x98, 0x63, 0x59, 0xac, 0x0c, 0xb1, 0xad, 0x63, 0x58, 0x6b, 0x6b, 0x6b, 0x6b, 0x61,
+  0x98, 0x3e, 0xff, 0xff, 0xca, 0x65, 0x80, 0x0d, 0x0d, 0x34, 0x0b, 0xf6, 0x6b, 0x35, 0xeb, 0x18,
+  0xcc, 0x31, 0xac, 0xd6, 0xb2, 0xc0, 0x00, 0x3e, 0xfe, 0x05, 0xad, 0x35, 0xac, 0x06, 0x5b, 0x5a,
+  0xcd, 0x60, 0x00, 0x00, 0x00, 0x6f, 0xd6, 0xd0, 0x42, 0x4d, 0x59, 0x04, 0x13, 0x40, 0x18, 0x33,
+  0x5e, 0xb6, 0xbd, 0x6c, 0x61, 0xb4, 0x00, 0x3f, 0xfb, 0xfb, 0x18, 0xf5, 0xe3, 0x6c, 0xd9, 0xb6,
+  0x66, 0xc6, 0xd6, 0x34, 0x00, 0x00, 0x0a, 0xde, 0x4e, 0xce, 0x0c, 0x61, 0x83, 0x58, 0xb1, 0x65,
+  0x93, 0x46, 0x80, 0x00, 0x00, 0x7b, 0xc6, 0x1a, 0xc0, 0xd3, 0x77, 0xff, 0x59, 0xac, 0xc1, 0x9a,
+  0xcd, 0x6d, 0x61, 0x86, 0xb1, 0x96, 0x07, 0xff, 0xf8, 0x71, 0xdf, 0xc6, 0x18, 0xcc, 0x6c, 0x6c,
+  0x6c, 0xcc, 0xcc, 0xfb, 0xfa, 0xc3, 0x58, 0x6b, 0xd6, 0xbd, 0x61, 0xbf, 0xfe, 0xff, 0x8c, 0x33,
+  0x18, 0xc3, 0x35, 0x86, 0xb0, 0x35, 0x81, 0xac, 0x30, 0x62, 0x2a, 0x3d, 0x86, 0x6b, 0x65, 0xe8,
+  0x00, 0x3f, 0xff, 0xfd, 0x8c, 0x1b, 0x5b, 0x59, 0x86, 0xb3, 0x5a, 0xc6, 0xb5, 0x86, 0xb5, 0xb4,
+  0xc3, 0x0c, 0xd7, 0xac, 0xc6, 0x30, 0xfb, 0xff, 0xff, 0x25, 0xac, 0x16, 0x01, 0xa1, 0xa7, 0xe7,
+  0xbc, 0x61, 0x8c, 0x63, 0x30, 0xc6, 0x0c, 0xb0, 0x00, 0x01, 0x7f, 0xf3, 0x45, 0x96, 0x5a, 0xcb,
+  0x1a, 0xd6, 0x35, 0x86, 0x5b, 0x58, 0x00, 0x00, 0x03, 0xf6, 0xb0, 0x11, 0x13, 0x2d, 0x04, 0x11,
+  0xbb, 0x00, 0xcb, 0xd6, 0x33, 0x19, 0x8c, 0xc6, 0x00, 0x03, 0xbf, 0xfe, 0x19, 0x99, 0xb3, 0x66,
+  0xcd, 0x9e, 0xbc, 0x6d, 0x6c, 0x00, 0x00, 0x00, 0x57, 0xfd, 0xd8, 0xfc, 0xf0, 0xc3, 0x35, 0x8d,
+  0x32, 0xcb, 0x5a, 0xd6, 0x80, 0x00, 0x00, 0x00, 0x7b, 0xcc, 0x1a, 0xc3, 0x5a, 0xd7, 0xf7, 0xd6,
+  0x60, 0xda, 0xc6, 0xbd, 0x61, 0x8d, 0x6d, 0x60, 0xcb, 0x03, 0xff, 0xfc, 0x38, 0xfb, 0xe3, 0x5b,
+  0x0c, 0xcc, 0x6c, 0x6c, 0xc7, 0xad, 0x9a, 0xfb, 0xe0, 0x60, 0x63, 0x06, 0x35, 0xfd, 0xff, 0xfd,
+  0x9a, 0xcc, 0x6b, 0xc3, 0x1a, 0xda, 0xc3, 0x58, 0x0d, 0x61, 0xad, 0x6d, 0x33, 0x59, 0x01, 0x0a,
+  0x6b, 0xd6, 0xd6, 0xd6, 0x30, 0x00, 0x7f, 0xdf, 0xcc, 0x33, 0x5e, 0xb1, 0x83, 0x0d, 0x60, 0x6b,
+  0x06, 0xb0, 0xd6, 0x6b, 0x6b, 0x31, 0x9a, 0xf5, 0x9a, 0xcf, 0xbf, 0xff, 0xf2, 0x19, 0x65, 0x80,
+  0xb0, 0x1a, 0x7b, 0x78, 0xc6, 0xb3, 0x18, 0xc6, 0x6b, 0xd6, 0x6b, 0x35, 0x80, 0x00, 0x00, 0xff,
+  0xe5, 0xa0, 0xb2, 0xc5, 0x86, 0xb5, 0x8d, 0x61, 0xac, 0xd6, 0x80, 0x00, 0x00, 0xfc, 0x6b, 0x2c,
+  0x46, 0x4d, 0xad, 0x16, 0x8b, 0x41, 0x60, 0x18, 0x63, 0x31, 0x98, 0xcc, 0x6b, 0xd0, 0x05, 0xf6,
+  0x1f, 0xd5, 0xe3, 0x36, 0x6c, 0xd9, 0xb6, 0x3c, 0x66, 0x35, 0x80, 0x00, 0x00, 0x77, 0xdf, 0x73,
+  0xc3, 0xc0, 0x7a, 0xc6, 0x6b, 0x06, 0xb5, 0xad, 0x69, 0xa0, 0x58, 0xb0, 0x00, 0x00, 0x0f, 0xd9,
+  0x86, 0xb0, 0xd6, 0xb3, 0xbf, 0xfa, 0xc6, 0x18, 0xc6, 0xb6, 0x0c, 0xd6, 0x30, 0x60, 0x07, 0xff,
+  0xf8, 0x71, 0xff, 0x4d, 0x66, 0xb6, 0x33, 0x1b, 0x31, 0xb3, 0x1b, 0x1b, 0xfe, 0xe0, 0xc0, 0xc6,
+  0xb3, 0x58, 0xd7, 0xdf, 0xff, 0xf8, 0xf8, 0x63, 0x18, 0xc6, 0x6b, 0x19, 0x6d, 0x30, 0x1a, 0xc1,
+  0xac, 0x6b, 0x35, 0x9d, 0x9e, 0xed, 0xaf, 0x58, 0xcc, 0x18, 0x00, 0x3b, 0xff, 0xac, 0x63, 0x0c,
+  0xd6, 0x6b, 0x06, 0xb0, 0x32, 0xcd, 0x30, 0xc3, 0x5b, 0x0c, 0xc6, 0x30, 0xcf, 0xef, 0xff, 0xa6,
+  0xb1, 0x62, 0xc5, 0x80, 0x3c, 0x3a, 0xe1, 0x86, 0x63, 0x19, 0x86, 0xd6, 0x35, 0x83, 0x4c, 0x00,
+  0x07, 0xdf, 0x5a, 0xd0, 0xb0, 0xb0, 0x6b, 0x59, 0xad, 0x66, 0xb0, 0x60, 0x00, 0x00, 0x6d, 0x86,
+  0xb5, 0x89, 0x0a, 0x20, 0x42, 0xd0, 0x59, 0x65, 0xb4, 0xcd, 0x6d, 0x6c, 0x66, 0x33, 0x0c, 0x60,
+  0xba, 0xd6, 0x35, 0xbb, 0xfb, 0x63, 0x66, 0xd8, 0xf3, 0x36, 0x66, 0x33, 0x58, 0x00, 0x00, 0x07,
+  0xf7, 0xf3, 0x8a, 0x42, 0x27, 0x6b, 0xd6, 0x18, 0x1a, 0x6b, 0x4d, 0x05, 0x96, 0xb5, 0xac, 0x00,
+  0x00, 0x07, 0xf9, 0xac, 0xd6, 0x1a, 0xcb, 0x3f, 0xfe, 0xac, 0x63, 0x18, 0x66, 0xb6, 0xb3, 0x5b,
+  0x58, 0x60, 0x03, 0xff, 0xfc, 0x38, 0xff, 0xfb, 0x35, 0xb5, 0x98, 0xcc, 0x6c, 0x7a, 0xd8, 0xd8,
+  0xcd, 0xff, 0xd6, 0x98, 0x35, 0x9a, 0xc6, 0xb3, 0x5b, 0xef, 0xff, 0xfc, 0xad, 0x63, 0x19, 0xaf,
+  0x59, 0xad, 0xac, 0x65, 0x9a, 0xd6, 0x0d, 0x60, 0xd6, 0x35, 0x9a, 0x6c, 0x71, 0xb3, 0x18, 0xd7,
+  0xac, 0x64, 0x00, 0x1f, 0xff, 0x43, 0x30, 0xc3, 0x0d, 0x61, 0xac, 0xbd, 0x18, 0x18, 0x30, 0xc6,
+  0x31, 0x8c, 0xc3, 0x5f, 0x7f, 0xff, 0x69, 0x96, 0xb2, 0xcb, 0x2c, 0xb0, 0x75, 0x72, 0xd7, 0xa6,
+  0x6b, 0xd6, 0x63, 0x31, 0x8d, 0x7a, 0x61, 0xad, 0x6b, 0x00, 0x02, 0xfe, 0xec, 0xb4, 0x0b, 0x03,
+  0x4c, 0x0c, 0x0c, 0x35, 0x9a, 0xc0, 0x00, 0x6c, 0xd6, 0x06, 0x89, 0x8a, 0x42, 0xd1, 0x68, 0x5a,
+  0xd6, 0xb0, 0x31, 0x8c, 0x66, 0x63, 0x30, 0xc3, 0x3f, 0xb5, 0x96, 0x1a, 0xda, 0xdf, 0xf1, 0xeb,
+  0xcc, 0xdb, 0x1e, 0x36, 0x63, 0x0c, 0x00, 0x00, 0x07, 0x7f, 0xf6, 0xb7, 0xa6, 0x64, 0xb6, 0xb6,
+  0xb3, 0x58, 0x34, 0x68, 0x05, 0xad, 0x34, 0x6b, 0x00, 0x00, 0x03, 0x7e, 0xd6, 0x30, 0x31, 0x7a,
+  0xff, 0xbf, 0x98, 0x66, 0x19, 0xaf, 0x58, 0xc6, 0x18, 0x6b, 0x34, 0x07, 0xff, 0xf8, 0x73, 0xbf,
+  0xed, 0xad, 0x7a, 0xcc, 0x66, 0x63, 0x66, 0x33, 0x63, 0x1f, 0xd4, 0xc1, 0x83, 0x59, 0xac, 0x6b,
+  0x5f, 0xff, 0xf9, 0xc6, 0x18, 0xcc, 0x36, 0xb1, 0x83, 0x01, 0x8b, 0xd3, 0x58, 0x6b, 0x1a, 0xda,
+  0x63, 0x67, 0x63, 0x19, 0x86, 0x19, 0x00, 0x07, 0xdf, 0xf1, 0x8c, 0x31, 0xac, 0x6b, 0x0d, 0x6b,
+  0x0d, 0x61, 0xac, 0x60, 0xcc, 0x6b, 0xd6, 0xd6, 0xd6, 0xd3, 0xfb, 0xff, 0xed, 0x35, 0xad, 0x6b,
+  0x5a, 0xd6, 0xb0, 0x39, 0x37, 0xeb, 0x30, 0xc6, 0x63, 0x6b, 0x31, 0x8c, 0xbd, 0x35, 0xac, 0x80,
+  0x00, 0xfb, 0xe5, 0x90, 0x00, 0xd3, 0x58, 0x6b, 0x1a, 0xc3, 0x58, 0xc3, 0x0d, 0x6b, 0x5b, 0x58,
+  0x65, 0x80, 0xa0, 0xac, 0x40, 0x82, 0xd6, 0x9a, 0xd6, 0x18, 0xc3, 0x63, 0x1b, 0x5b, 0x0c, 0x1f,
+  0xff, 0xfe, 0xb6, 0x58, 0x35, 0x9a, 0xda, 0xbe, 0xd9, 0x9b, 0x3d, 0x78, 0xd8, 0xcc, 0x00, 0x00,
+  0x00, 0x7f, 0xfd, 0x6b, 0x66, 0x8a, 0x70, 0xd7, 0xac, 0xd6, 0x00, 0xd0, 0xb2, 0xd0, 0x03, 0x40,
+  0x00, 0x00, 0x7e, 0xda, 0xcc, 0x0c, 0x0f, 0xbf, 0xf8, 0xc6, 0x33, 0x5b, 0x0c, 0xd6, 0xc1, 0x9a,
+  0xc3, 0x40, 0x7f, 0xff, 0x87, 0x5d, 0xfd, 0x9a, 0xda, 0xcc, 0x66, 0x66, 0x36, 0x33, 0x33, 0x1d,
+  0xfd, 0xac, 0xd3, 0x1a, 0xc3, 0x58, 0xd6, 0x7f, 0xff, 0xe9, 0x46, 0x19, 0x86, 0xd6, 0x61, 0x81,
+  0x83, 0x5a, 0xc6, 0xb5, 0x8d, 0x66, 0xb0, 0xb2, 0xba, 0xc3, 0x6b, 0x6b, 0x6b, 0x1a, 0xc0, 0x00,
+  0x7f, 0xfd, 0x6b, 0x60, 0xc6, 0xb1, 0xac, 0x1a, 0xcb, 0xd3, 0x2f, 0x4c, 0x31, 0xad, 0xaf, 0x58,
+  0xda, 0xcd, 0x6d, 0x7f, 0xf7, 0xfd, 0xa6, 0xb4, 0xd3, 0x4d, 0x69, 0xac, 0x37, 0xb6, 0x6b, 0x35,
+  0xb5, 0xb0, 0xd8, 0xc6, 0x31, 0x83, 0x2c, 0x20, 0x00, 0x1f, 0xfc, 0x16, 0x80, 0x68, 0xd6, 0x0d,
+  0x63, 0x58, 0x6b, 0x35, 0x9a, 0xc6, 0x1a, 0xcd, 0x63, 0x5a, 0xc4, 0x56, 0x5d, 0x68, 0x10, 0xb5,
+  0xa3, 0x4d, 0x60, 0xcc, 0x36, 0x1b, 0x18, 0xc6, 0x1f, 0xfd, 0xff, 0xf1, 0x60, 0xd6, 0x31, 0xaf,
+  0x5b, 0xfb, 0x1b, 0x66, 0x66, 0xc6, 0x34, 0x00, 0x00, 0x03, 0xff, 0xa2, 0xd5, 0xac, 0xa5, 0xcc,
+  0x6b, 0x6b, 0x58, 0x34, 0x58, 0xb4, 0x02, 0xcb, 0x00, 0x00, 0x00, 0xdf, 0x98, 0x61, 0x80, 0xef,
+  0xff, 0xed, 0xac, 0xc3, 0x6b, 0x61, 0x98, 0x66, 0x0c, 0x32, 0x03, 0xff, 0xfc, 0x3a, 0xfe, 0xec,
+  0xd6, 0x63, 0x19, 0x98, 0xd8, 0xda, 0xf5, 0xb3, 0x5e, 0xef, 0xe0, 0x60, 0xd6, 0x6b, 0x5b, 0x4c,
+  0x7f, 0xff, 0xeb, 0x70, 0xc6, 0x35, 0xeb, 0xd6, 0x18, 0xc0, 0xcb, 0x69, 0xac, 0x35, 0x83, 0x06,
+  0x28, 0xaa, 0x66, 0x33, 0x5e, 0xb1, 0x8d, 0x6b, 0x00, 0x03, 0xef, 0xfb, 0x0c, 0xd6, 0x35, 0x86,
+  0xb0, 0xd6, 0x0d, 0x61, 0x86, 0x18, 0xc6, 0x31, 0x9a, 0xc7, 0xff, 0xdf, 0xc6, 0x9a, 0x34, 0x1a,
+  0x35, 0xac, 0xd8, 0xd3, 0xac, 0x63, 0x19, 0x8c, 0xcd, 0x7a, 0xcd, 0x66, 0xb1, 0x60, 0x00, 0x03,
+  0xbf, 0x82, 0xd0, 0xd0, 0x6b, 0x2d, 0xa6, 0x1a, 0xc6, 0xb0, 0xc3, 0x0d, 0x6d, 0x60, 0xcb, 0xd3,
+  0x5a, 0xc5, 0xc6, 0x30, 0x26, 0xec, 0xb4, 0x06, 0x9a, 0xda, 0xc6, 0x63, 0x1b, 0x0d, 0xad, 0xac,
+  0x7f, 0xff, 0xf2, 0xf2, 0xc3, 0x5a, 0xda, 0xc6, 0x33, 0x5b, 0xec, 0x6c, 0xd8, 0xcc, 0x00, 0x00,
+  0x00, 0x7f, 0x7d, 0xab, 0x68, 0xdb, 0x57, 0xe6, 0xbd, 0x61, 0x96, 0x00, 0xb5, 0xa0, 0xb5, 0xad,
+  0x6b, 0x00, 0x00, 0x00, 0xfd, 0xb0, 0xc3, 0x03, 0x7f, 0x7f, 0xf5, 0xb5, 0xeb, 0x19, 0x8c, 0xc6,
+  0x31, 0x86, 0x18, 0x01, 0xff, 0xfe, 0x1d, 0xdf, 0xf6, 0x18, 0x6d, 0x6c, 0x63, 0x63, 0x6b, 0xd7,
+  0xad, 0x8c, 0x7d, 0xc6, 0x5b, 0x5a, 0xc6, 0xb0, 0xd6, 0x3f, 0xff, 0xf6, 0xff, 0x83, 0x18, 0xc6,
+  0x31, 0x83, 0x06, 0xb0, 0xd6, 0xb0, 0xd6, 0x35, 0x8c, 0x48, 0x4b, 0xcd, 0x7a, 0xcc, 0x63, 0x5b,
+  0x5a, 0xc0, 0x00, 0x3f, 0xfe, 0x18, 0x6b, 0x6b, 0x59, 0xad, 0x66, 0x98, 0x32, 0xf4, 0xc6, 0xb6,
+  0xb3, 0x18, 0xc6, 0x18, 0xff, 0xff, 0xcd, 0xe1, 0xa0, 0x00, 0x34, 0xc6, 0x96, 0x79, 0x8c, 0x6b,
+  0xc3, 0x63, 0x1b, 0x59, 0x86, 0xb0, 0x34, 0x00, 0x01, 0xfd, 0x4b, 0x26, 0x83, 0x4c, 0xb1, 0xac,
+  0x32, 0xf4, 0xc1, 0x8d, 0x63, 0x5b, 0x4c, 0x35, 0x81, 0xa1, 0x91, 0xa0, 0xb5, 0xab, 0x26, 0x8b,
+  0x06, 0xb5, 0xeb, 0x18, 0xcc, 0x6d, 0x7a, 0xcc, 0x33, 0xfb, 0xff, 0xff, 0x6d, 0xa0, 0xd6, 0x18,
+  0xc6, 0x30, 0xdb, 0xac, 0xcc, 0xcd, 0x60, 0x00, 0x00, 0x1f, 0x7c, 0x86, 0x6e, 0x05, 0xce, 0x6b,
+  0x65, 0xe9, 0x96, 0x05, 0xad, 0x02, 0xd1, 0xa1, 0xac, 0x00, 0x00, 0x0d, 0xfb, 0x0c, 0x6b, 0x1a,
+  0xdf, 0xf7, 0xff, 0x63, 0x18, 0xcc, 0x66, 0x31, 0x98, 0x61, 0x80, 0x0f, 0xff, 0xf0, 0xfb, 0xee,
+  0xb1, 0x8d, 0x7a, 0xd8, 0xc6, 0xc6, 0x66, 0x63, 0x19, 0xbf, 0xe9, 0x86, 0xb0, 0xd6, 0x1a, 0xd6,
+  0x7f, 0xf7, 0xff, 0xf6, 0x0c, 0x66, 0xbd, 0x63, 0x18, 0x35, 0x9a, 0xd6, 0x0d, 0x61, 0xac, 0x30,
+  0xc8, 0x08, 0x7a, 0xf5, 0x99, 0xaf, 0x58, 0xc3, 0x58, 0x80, 0x01, 0xf7, 0xf1, 0x86, 0xb6, 0xb5,
+  0x9a, 0x61, 0xac, 0x35, 0x8d, 0x66, 0x0c, 0xc3, 0x6b, 0x30, 0xd6, 0xff, 0xff, 0xce, 0x00, 0x05,
+  0x80, 0x34, 0xce, 0xc8, 0x63, 0x5e, 0xb6, 0xbd, 0x6c, 0x63, 0x6b, 0x6b, 0x6b, 0x59, 0xa3, 0x40,
+  0x00, 0x0f, 0xfa, 0x09, 0xa6, 0x8d, 0x6b, 0x1a, 0xd6, 0xd3, 0x1a, 0xc3, 0x5b, 0x5a, 0xf4, 0xc1,
+  0x81, 0x96, 0x01, 0xa9, 0xb9, 0x68, 0x2d, 0x0b, 0x16, 0x1a, 0xc6, 0xbd, 0x6d, 0x7a, 0xd8, 0xc6,
+  0x6b, 0x6b, 0x7f, 0xff, 0xea, 0xfd, 0x0d, 0x30, 0x61, 0x9a, 0xf5, 0x98, 0x61, 0xa3, 0x00, 0x00,
+  0x00, 0x1d, 0xf5, 0x68, 0xc9, 0xca, 0xc3, 0xcd, 0x6d, 0x66, 0xb5, 0x96, 0x2d, 0x68, 0x2d, 0x00,
+  0x0d, 0x60, 0x00, 0x00, 0xff, 0x33, 0x5b, 0x58, 0x6b, 0x7f, 0xf7, 0xfc, 0xcc, 0x36, 0xb6, 0x33,
+  0x35, 0xeb, 0x6b, 0x6b, 0x35, 0x8d, 0x01, 0xff, 0xfe, 0x1f, 0x7f, 0xd3, 0x18, 0xd7, 0xad, 0x8c,
+  0x6c, 0x66, 0x36, 0xbd, 0x6d, 0x7a, 0x7f, 0x06, 0xb1, 0xad, 0x63, 0x5a, 0xc7, 0xf7, 0xff, 0xfe,
+  0xee, 0xb1, 0x86, 0x6b, 0xd6, 0x6b, 0x6b, 0x0d, 0x61, 0xac, 0x0d, 0x63, 0x58, 0x60, 0x70, 0x76,
+  0xc6, 0x61, 0xb5, 0xb5, 0x86, 0x59, 0x00, 0x01, 0xff, 0xf3, 0x59, 0xac, 0x6b, 0x06, 0x06, 0x0c,
+  0x18, 0x63, 0x0c, 0xd7, 0xac, 0xd6, 0xd3, 0xbf, 0xff, 0x80, 0x2c, 0x5a, 0xcb, 0x03, 0x32, 0x30,
+  0x98, 0xd7, 0xac, 0xcc, 0xc6, 0x63, 0x18, 0xc0, 0xd6, 0xb0, 0x00, 0x01, 0xff, 0xc1, 0x6b, 0x4d,
+  0x35, 0xac, 0x6b, 0x06, 0x1a, 0xc6, 0xb1, 0xac, 0xd6, 0xb3, 0x58, 0x1a, 0xcb, 0x07, 0x27, 0x69,
+  0xa5, 0xad, 0x16, 0x5a, 0xd6, 0x1a, 0xcc, 0x33, 0x31, 0x98, 0xc6, 0x37, 0x7f, 0xff, 0xe6, 0xcd,
+  0x35, 0x83, 0x5b, 0x0c, 0x63, 0x18, 0x6b, 0x0b, 0x20, 0x00, 0x00, 0x5f, 0xd0, 0x9b, 0x1b, 0x53,
+  0x3a, 0xd8, 0x6b, 0x69, 0x96, 0x5a, 0xd0, 0x26, 0x8b, 0x2c, 0xb1, 0xa0, 0x00, 0x00, 0xfd, 0xb1,
+  0x9a, 0xc6, 0xb3, 0xff, 0xfd, 0x8b, 0xb5, 0xb5, 0xb0, 0xf5, 0xb5, 0xeb, 0xd6, 0xd6, 0xc6, 0xbd,
+  0x6b, 0xd3, 0x00, 0xff, 0xff, 0x0f, 0xfb, 0xf8, 0xc6, 0x19, 0x8c, 0xcc, 0x66, 0x63, 0x33, 0x5e,
+  0xb3, 0x3f, 0xa6, 0xb1, 0xad, 0x63, 0x5a, 0xc2, 0xff, 0xff, 0xe4, 0x30, 0xd7, 0xac, 0xc6, 0xbd,
+  0x61, 0x83, 0x01, 0x96, 0x6b, 0x59, 0xac, 0x30, 0x62, 0x67, 0xeb, 0x1b, 0x5b, 0x0c, 0xd6, 0x35,
+  0x96, 0x00, 0x01, 0xfd, 0xf6, 0xb3, 0x58, 0xd6, 0x1a, 0xc6, 0xb0, 0xd6, 0xd6, 0xbd, 0x61, 0x98,
+  0x66, 0xb6, 0xb3, 0x5f, 0xfd, 0xfc, 0x02, 0xd6, 0xb5, 0xad, 0x6b, 0x03, 0x12, 0xf8, 0xcd, 0x7a,
+  0xcc, 0xcc, 0x66, 0x6b, 0xd6, 0x6b, 0x1a, 0xd6, 0x40, 0x00, 0x0e, 0xeb, 0x39, 0x6b, 0x4d, 0x6b,
+  0x2f, 0x4d, 0x66, 0xb0, 0xc0, 0xc3, 0x59, 0xad, 0x63, 0x58, 0x0d, 0x6b, 0x47, 0xc7, 0xed, 0x2c,
+  0x82, 0xc9, 0xa6, 0x58, 0xc3, 0x19, 0x8d, 0xaf, 0x59, 0x8c, 0x3f, 0xef, 0xff, 0xb5, 0xad, 0x60,
+  0xc3, 0x5e, 0xb6, 0xb6, 0xb3, 0x06, 0xb0, 0x58, 0x00, 0x00, 0x0f, 0xf9, 0x0b, 0x58, 0x59, 0xb9,
+  0xab, 0xfe, 0xc6, 0x06, 0xb2, 0xd3, 0x42, 0xd0, 0x5a, 0xd3, 0x5a, 0xcd, 0x00, 0x00, 0x0f, 0x7b,
+  0x35, 0xb5, 0x9a, 0xc7, 0xff, 0xfa, 0xfe, 0xd6, 0x63, 0x31, 0xb1, 0x98, 0xda, 0xd8, 0x6b, 0xd3,
+  0x00, 0x7f, 0xff, 0x87, 0xff, 0xf4, 0x61, 0x98, 0x6c, 0x36, 0x33, 0x1b, 0x5e, 0xb3, 0x35, 0xeb,
+  0x3b, 0xec, 0x35, 0x81, 0xad, 0x61, 0xbf, 0xff, 0xfa, 0xe3, 0x0c, 0x36, 0xb6, 0xb3, 0x59, 0xac,
+  0x35, 0x83, 0x2c, 0x6b, 0x0d, 0x66, 0xb1, 0x51, 0x66, 0x63, 0x35, 0xeb, 0x31, 0x81, 0xac, 0xb0,
+  0x00, 0x17, 0xff, 0x31, 0xac, 0x30, 0x6b, 0x35, 0x83, 0x1a, 0xcd, 0x6d, 0x66, 0xbd, 0x63, 0x18,
+  0x3f, 0xff, 0xf5, 0xa1, 0x65, 0xad, 0x68, 0x69, 0xac, 0x17, 0xd7, 0x06, 0x6b, 0xd6, 0x66, 0x63,
+  0x6b, 0xd6, 0xd6, 0x60, 0xd6, 0x2c, 0x00, 0x00, 0xfb, 0xb0, 0xdd, 0x4d, 0x6b, 0x58, 0x35, 0x8d,
+  0x63, 0x58, 0xd6, 0x35, 0x83, 0x58, 0xd3, 0x16, 0xd0, 0xd2, 0x12, 0x18, 0x5a, 0x0b, 0x46, 0x8d,
+  0x6b, 0x35, 0xb5, 0xb5, 0xb1, 0x98, 0xda, 0xcc, 0x3f, 0xff, 0xef, 0xeb, 0x59, 0x63, 0x58, 0xc3,
+  0x31, 0xaf, 0x58, 0x6b, 0x02, 0xd0, 0x00, 0x00, 0x7f, 0x4b, 0x76, 0x5a, 0xff, 0x1b, 0x1b, 0x35,
+  0xff, 0xda, 0xc1, 0xad, 0x6b, 0x41, 0x34, 0xb2, 0x1a, 0x1a, 0xc6, 0x00, 0x00, 0x37, 0xfa, 0xd8,
+  0x63, 0x59, 0xf7, 0xff, 0xfa, 0xe6, 0x6b, 0x63, 0x31, 0xb1, 0x99, 0x98, 0x6d, 0x66, 0xb0, 0x03,
+  0xff, 0xfc, 0x77, 0xff, 0xc1, 0x98, 0x66, 0x31, 0xb1, 0x8d, 0x8c, 0x66, 0xbd, 0x6d, 0x6d, 0x7d,
+  0x6b, 0x58, 0x6b, 0x58, 0x0f, 0xff, 0xff, 0x2f, 0xe1, 0x86, 0x31, 0x8c, 0x30, 0xd6, 0x35, 0x81,
+  0xac, 0x35, 0x9a, 0xc3, 0x11, 0x93, 0x5b, 0x5e, 0xb3, 0x19, 0xaf, 0x4c, 0x6b, 0x59, 0x68, 0x00,
+  0x0f, 0xfe, 0x59, 0xac, 0x6b, 0x1a, 0xc6, 0x5b, 0x58, 0xd6, 0x6b, 0x6b, 0x30, 0xcd, 0x66, 0x5b,
+  0xef, 0xfe, 0xac, 0x2d, 0x1a, 0x00, 0xd6, 0x17, 0x56, 0xad, 0xaf, 0x58, 0xda, 0xf5, 0xeb, 0x63,
+  0x33, 0x5e, 0xb0, 0x62, 0xc0, 0x00, 0x03, 0xfa, 0xd6, 0xd6, 0x5f, 0x6b, 0x5a, 0xc3, 0x58, 0x6b,
+  0x35, 0x86, 0x5b, 0x5a, 0xc6, 0xb2, 0xcd, 0x32, 0xc0, 0x11, 0xd2, 0x16, 0xb4, 0x5a, 0xd0, 0x06,
+  0xb5, 0xb5, 0x98, 0x7a, 0xcc, 0xc6, 0x33, 0x5b, 0xef, 0xff, 0xe1, 0x60, 0xd6, 0x19, 0x86, 0x6b,
+  0x6b, 0x35, 0x96, 0x04, 0xc0, 0x00, 0x07, 0x7c, 0x41, 0x6b, 0xdb, 0xfb, 0xfc, 0xda, 0xf7, 0xff,
+  0xf5, 0x8d, 0x35, 0xa0, 0x5a, 0x2d, 0x68, 0xb0, 0x18, 0x60, 0x00, 0x06, 0xfd, 0x9a, 0xf5, 0x8c,
+  0x3f, 0xfe, 0xff, 0xb1, 0x8c, 0xc6, 0xcc, 0x6c, 0x66, 0x33, 0x0c, 0x34, 0x07, 0xff, 0xf8, 0xff,
+  0xbf, 0xac, 0xc3, 0x18, 0xda, 0xf5, 0x9b, 0x5b, 0x18, 0xda, 0xda, 0xf5, 0x8c, 0xc7, 0xf1, 0x6d,
+  0x35, 0xac, 0x34, 0xff, 0xef, 0xfe, 0x1a, 0xcd, 0x7a, 0xc6, 0x30, 0xc1, 0x81, 0xac, 0x35, 0x86,
+  0xb1, 0x80, 0x74, 0x7f, 0x0d, 0xad, 0x86, 0xd6, 0x65, 0xb4, 0xd6, 0x5a, 0x00, 0x03, 0xfb, 0xec,
+  0x30, 0xd6, 0x6b, 0x1a, 0xc6, 0x0c, 0x61, 0x86, 0x61, 0x86, 0x3f, 0xff, 0xb8, 0x2d, 0x68, 0x0b,
+  0x03, 0x58, 0xb6, 0xaf, 0x8c, 0x66, 0x33, 0x33, 0x19, 0x98, 0xd6, 0xd6, 0xb0, 0x00, 0x00, 0x2f,
+  0xed, 0x63, 0x58, 0x7f, 0x6b, 0x01, 0x97, 0xad, 0x6d, 0x60, 0xc1, 0xac, 0x1a, 0xc0, 0x69, 0x96,
+  0x22, 0x52, 0x53, 0x5b, 0x72, 0xd0, 0x05, 0x8d, 0x61, 0x8c, 0xc6, 0x63, 0x6b, 0x6b, 0x6b, 0x7f,
+  0xfd, 0xfc, 0x01, 0xac, 0x33, 0x5b, 0x5b, 0x5b, 0x59, 0xad, 0x60, 0x2d, 0x00, 0x00, 0x17, 0xf6,
+  0xad, 0x0b, 0x5d, 0x5c, 0xdc, 0xe6, 0xd7, 0xaf, 0x7f, 0xff, 0xe5, 0x06, 0x8d, 0x16, 0x82, 0xd1,
+  0x65, 0xad, 0x66, 0xb3, 0x00, 0x00, 0x37, 0xec, 0x6d, 0x66, 0xb1, 0xff, 0xfe, 0xb2, 0xb3, 0x19,
+  0x8d, 0x8f, 0x5b, 0x1b, 0x18, 0xcd, 0x66, 0xb0, 0x0f, 0xff, 0xf1, 0xff, 0xfd, 0xd8, 0x63, 0x18,
+  0xcc, 0xc6, 0x36, 0x31, 0x8d, 0xac, 0xc6, 0x31, 0xbe, 0xe3, 0x5a, 0xc0, 0xd1, 0xff, 0xfd, 0xd6,
+  0xd6, 0x19, 0x86, 0x30, 0xd6, 0xd3, 0x06, 0xb0, 0x6b, 0x1a, 0xc6, 0x03, 0x03, 0x4c, 0x63, 0x31,
+  0x9a, 0xda, 0xc3, 0x4d, 0x6b, 0x40, 0x00, 0x7d, 0xfd, 0x8d, 0x66, 0xb1, 0x83, 0x0d, 0x7a, 0x66,
+  0xb3, 0x5b, 0x59, 0x86, 0x1a, 0xbf, 0xff, 0x81, 0x68, 0x16, 0x5a, 0xc0, 0xc5, 0x95, 0x5c, 0x36,
+  0xb6, 0x36, 0xbd, 0x7a, 0xf5, 0xb1, 0x86, 0xd3, 0x00, 0x00, 0x00, 0xef, 0x98, 0x35, 0x8d, 0x7d,
+  0x60, 0xcb, 0x6b, 0x0c, 0x1a, 0xc6, 0xb0, 0x19, 0x60, 0x22, 0xc3, 0x21, 0xa1, 0x99, 0xac, 0xdf,
+  0xc1, 0x65, 0xac, 0x6b, 0x18, 0xc6, 0x66, 0x33, 0x18, 0x6f, 0xff, 0xfa, 0xc8, 0x0d, 0x6b, 0x35,
+  0xb5, 0xb5, 0x98, 0xc1, 0x80, 0x59, 0x00, 0x00, 0x0f, 0xe4, 0xb4, 0x0b, 0x8b, 0x2b, 0x33, 0x63,
+  0x37, 0x7f, 0xfc, 0xd0, 0x0b, 0x42, 0x0b, 0x5a, 0x35, 0x83, 0x30, 0x00, 0x06, 0xfd, 0x8d, 0xad,
+  0xac, 0x7d, 0xff, 0xfe, 0xac, 0xd6, 0xc6, 0x36, 0x63, 0xd6, 0xcc, 0xcd, 0x78, 0x61, 0x96, 0x03,
+  0xff, 0xfc, 0xbf, 0xff, 0xfd, 0x0c, 0x61, 0xb5, 0xb0, 0xd8, 0xc6, 0xd6, 0xc6, 0x33, 0x5e, 0xb1,
+  0x98, 0xd7, 0xbb, 0xfb, 0x58, 0x06, 0x0f, 0xff, 0xff, 0x4c, 0x35, 0xb5, 0x98, 0x63, 0x0d, 0x63,
+  0x58, 0x32, 0xcd, 0x6b, 0x6b, 0x5b, 0x58, 0x26, 0x2a, 0x63, 0x33, 0x5e, 0xb3, 0x0c, 0x0d, 0x6b,
+  0x5a, 0x00, 0x03, 0xef, 0xaf, 0x4c, 0x60, 0xc6, 0xb3, 0x59, 0xac, 0xcb, 0xd6, 0x6b, 0x30, 0xc3,
+  0x5f, 0xfd, 0xf0, 0x20, 0x2d, 0x6b, 0x4c, 0x0c, 0xae, 0xa6, 0xcc, 0x66, 0x33, 0x6b, 0xd7, 0xaf,
+  0x59, 0x98, 0x30, 0x0c, 0x00, 0x01, 0xf7, 0x35, 0x9a, 0xc0, 0xd7, 0x43, 0x59, 0xac, 0x65, 0xe9,
+  0x83, 0x59, 0x6d, 0x34, 0x96, 0x34, 0xc0, 0xc7, 0x87, 0x8d, 0x6d, 0x6d, 0x67, 0xd4, 0xd6, 0xb5,
+  0x8d, 0x66, 0xbd, 0x6d, 0x7a, 0xd8, 0xcd, 0x7a, 0xc7, 0x7f, 0xff, 0x68, 0xd3, 0x58, 0x63, 0x0d,
+  0xac, 0xd6, 0xd6, 0x59, 0xa2, 0xc8, 0x00, 0x00, 0xee, 0x84, 0x05, 0xad, 0x65, 0x69, 0xeb, 0x63,
+  0x1f, 0xdf, 0xf0, 0x0b, 0x45, 0xa1, 0x34, 0x03, 0x06, 0xc0, 0x00, 0x1b, 0xf6, 0x63, 0x18, 0x7f,
+  0xfd, 0xff, 0xdb, 0x5b, 0x5e, 0xb6, 0x63, 0xd7, 0xaf, 0x19, 0x99, 0x8c, 0x30, 0x01, 0xff, 0xfe,
+  0x7f, 0x7f, 0xfd, 0xb5, 0x9a, 0xd8, 0xc6, 0x63, 0x31, 0x98, 0xcc, 0x61, 0xb5, 0xb5, 0xb0, 0xc6,
+  0x7f, 0x76, 0x34, 0x03, 0xbf, 0xff, 0xfc, 0xb0, 0x63, 0x18, 0x66, 0xb1, 0xac, 0x35, 0x8d, 0x30,
+  0xd6, 0x35, 0x9a, 0xc1, 0xc2, 0x03, 0x6b, 0x61, 0xb0, 0xc3, 0x06, 0x9a, 0xd6, 0x80, 0x00, 0xfb,
+  0xe1, 0x86, 0x18, 0xd6, 0xd6, 0x35, 0xb5, 0x8c, 0x6b, 0xd6, 0xbd, 0x60, 0xef, 0xff, 0xb4, 0xb2,
+  0x0b, 0x5a, 0x1a, 0x6b, 0x34, 0xaa, 0xa2, 0xcc, 0x63, 0x63, 0x36, 0x33, 0x19, 0x86, 0x03, 0x40,
+  0x00, 0x0f, 0xe8, 0xc3, 0x58, 0x68, 0xdd, 0xda, 0xc6, 0x5e, 0xb5, 0xb5, 0xac, 0xd3, 0x24, 0x0d,
+  0x60, 0x32, 0xcd, 0x63, 0x53, 0x56, 0x18, 0xc1, 0xff, 0x68, 0xd3, 0x06, 0x6b, 0x63, 0x1b, 0x18,
+  0xcd, 0x67, 0xfd, 0xfd, 0x35, 0xad, 0x61, 0x8d, 0x7a, 0xc6, 0x60, 0xc0, 0x02, 0x00, 0x00, 0x1f,
+  0xc8, 0xb4, 0x0b, 0x3a, 0x6a, 0x76, 0x66, 0x31, 0x9f, 0xff, 0xfa, 0xa0, 0xb4, 0x20, 0x80, 0xb0,
+  0x6b, 0x6b, 0xd0, 0x00, 0x0d, 0xfb, 0x31, 0x98, 0x3f, 0xff, 0xd4, 0xc3, 0x6b, 0x66, 0x3d, 0x6d,
+  0x8c, 0xf5, 0xb1, 0x9a, 0xf5, 0x86, 0x80, 0xff, 0xff, 0x3f, 0xff, 0xb8, 0x63, 0x19, 0x8c, 0xd7,
+  0x86, 0xd7, 0xac, 0xcd, 0x7a, 0xc6, 0x63, 0x5e, 0xb3, 0x18, 0xdf, 0x7c, 0xd0, 0x07, 0xfd, 0xff,
+  0x2d, 0xac, 0x63, 0x1a, 0xf4, 0xc6, 0xb0, 0x60, 0x6b, 0x1a, 0xc6, 0xb3, 0x41, 0x41, 0x96, 0xd6,
+  0xc6, 0x33, 0x5e, 0xb1, 0x97, 0xa3, 0x5a, 0xd6, 0x80, 0x00, 0xfe, 0xe3, 0x0c, 0x31, 0xaf, 0x4c,
+  0xd6, 0x6b, 0x6b, 0x18, 0xd6, 0xd6, 0x0f, 0xff, 0xe4, 0x2d, 0x0b, 0x40, 0x1a, 0x60, 0xa6, 0x9e,
+  0xc6, 0xd6, 0xcc, 0x6c, 0x66, 0xc3, 0x6b, 0x6b, 0x06, 0x9a, 0x00, 0x00, 0xff, 0x86, 0x0c, 0x03,
+  0x41, 0xcd, 0x63, 0x59, 0xac, 0xad, 0x32, 0xc0, 0x32, 0xc6, 0xb5, 0x8d, 0x62, 0xe2, 0xed, 0x66,
+  0x18, 0x67, 0xfd, 0x03, 0x59, 0xac, 0xcd, 0x7a, 0xd8, 0xcc, 0x63, 0x5e, 0xff, 0xff, 0x9c, 0xad,
+  0x6b, 0x58, 0xd6, 0x61, 0x8c, 0x63, 0x58, 0x68, 0x08, 0x00, 0x00, 0xee, 0x44, 0xd0, 0x59, 0x50,
+  0xd1, 0x33, 0x31, 0x98, 0x7f, 0xdf, 0xf5, 0x90, 0x5a, 0xb4, 0x0b, 0x4c, 0xb6, 0xb1, 0xb0, 0x00,
+  0x0d, 0xfe, 0xbd, 0x6c, 0x61, 0xf7, 0xff, 0xfa, 0x83, 0x19, 0x98, 0xf5, 0xb3, 0x63, 0xd6, 0xcc,
+  0xc6, 0x60, 0xc0, 0x1f, 0xff, 0xeb, 0xff, 0xff, 0xd2, 0xc3, 0x6b, 0x6b, 0x63, 0x1b, 0x5b, 0x18,
+  0xcc, 0x63, 0x18, 0xc6, 0x61, 0x98, 0xd6, 0x70, 0x01, 0xff, 0xf7, 0xd6, 0x30, 0xcd, 0x66, 0x0c,
+  0x6b, 0x06, 0xb0, 0xd6, 0x35, 0x8d, 0x6d, 0x03, 0x84, 0x6b, 0x63, 0x19, 0x8c, 0x61, 0x97, 0xa3,
+  0x5a, 0xd6, 0x80, 0x00, 0xff, 0xa6, 0x0d, 0xac, 0x6b, 0x60, 0xc6, 0x18, 0xd7, 0xa6, 0x6b, 0x0f,
+  0xfb, 0xfb, 0x42, 0xd1, 0x68, 0x16, 0x06, 0x0a, 0x29, 0xac, 0x66, 0x66, 0x36, 0x63, 0x63, 0x18,
+  0xc1, 0xa6, 0xb0, 0x00, 0x0b, 0xfa, 0xf5, 0xaf, 0x4c, 0xb1, 0xa0, 0x0b, 0x5a, 0x34, 0x00, 0xd6,
+  0xb2, 0xda, 0x6b, 0x06, 0xb0, 0xd6, 0x27, 0x28, 0xb1, 0x86, 0x32, 0xdf, 0xdd, 0x63, 0x58, 0x66,
+  0x33, 0x19, 0x9a, 0xf5, 0xb5, 0x9f, 0xff, 0xf2, 0xf9, 0x65, 0x83, 0x0c, 0x63, 0x18, 0x60, 0xd1,
+  0xa5, 0xa0, 0x00, 0x03, 0xea, 0x16, 0x83, 0x58, 0x4d, 0xce, 0x63, 0x33, 0x18, 0x6f, 0xbf, 0xff,
+  0xf7, 0x75, 0xa5, 0xa2, 0xd1, 0x68, 0xd1, 0x83, 0x33, 0x00, 0x01, 0xef, 0x66, 0x63, 0x0f, 0xff,
+  0xbf, 0xfe, 0xf5, 0x99, 0x8f, 0x5b, 0x36, 0x36, 0x66, 0xc6, 0x66, 0xb6, 0xb0, 0x03, 0xff, 0xfd,
+  0xfd, 0xff, 0xf3, 0x5e, 0xb3, 0x0d, 0x8c, 0x66, 0x33, 0x19, 0x86, 0x63, 0x0c, 0xc6, 0x33, 0x0c,
+  0x60, 0x01, 0xff, 0xff, 0xed, 0xd8, 0x61, 0x9a, 0xda, 0xc6, 0xb3, 0x5a, 0xda, 0x60, 0x60, 0xc1,
+  0x98, 0x10, 0x15, 0x8c, 0x66, 0x33, 0x5e, 0xb0, 0xc0, 0xd6, 0x5a, 0xc0, 0x00, 0x3f, 0xf8, 0xc6,
+  0x18, 0xc6, 0x18, 0x66, 0xb1, 0x8d, 0x6d, 0x6b, 0x3e, 0xff, 0xad, 0x04, 0x5a, 0x0b, 0x2c, 0xb3,
+  0x58, 0xa0, 0x98, 0x66, 0x66, 0x66, 0x3d, 0x6c, 0xc6, 0x61, 0x86, 0xb5, 0xa0, 0x00, 0x0e, 0xfe,
+  0xcd, 0x66, 0xb5, 0x80, 0x05, 0x93, 0x42, 0xc2, 0xc1, 0xad, 0x60, 0x30, 0x35, 0x8d, 0x61, 0x09,
+  0x0e, 0x35, 0xb5, 0x8c, 0x1f, 0xfc, 0xb1, 0xac, 0x66, 0xbd, 0x6c, 0x66, 0x36, 0xb3, 0x57, 0xff,
+  0xc2, 0xc0, 0xc3, 0x18, 0x6d, 0x66, 0xb0, 0xd6, 0x9a, 0x5a, 0x00, 0x00, 0x3f, 0x91, 0x68, 0x69,
+  0x5f, 0x2d, 0x2f, 0x8d, 0x8c, 0x61, 0x97, 0xff, 0xff, 0x1c, 0x2d, 0x2d, 0x2d, 0x00, 0x30, 0x7a,
+  0xcc, 0x00, 0x0f, 0x7e, 0xbd, 0x7a, 0xf5, 0x8d, 0xff, 0xfe, 0x9c, 0x33, 0x31, 0xb3, 0x36, 0x66,
+  0x6c, 0x7a, 0xd8, 0xc6, 0xb6, 0x80, 0x7f, 0xff, 0xbf, 0xff, 0xbe, 0x33, 0x5b, 0x0d, 0x86, 0xd7,
+  0xad, 0xaf, 0x59, 0x8c, 0xd7, 0xac, 0x66, 0xb6, 0x1b, 0x5b, 0x5b, 0x2f, 0x58, 0x00, 0x7f, 0xff,
+  0xfa, 0x30, 0xc6, 0xbd, 0x61, 0x8c, 0xb6, 0xb5, 0x9a, 0xd6, 0x6b, 0x06, 0x0c, 0x02, 0x02, 0xd8,
+  0x66, 0x33, 0x18, 0x66, 0xb0, 0x6b, 0x59, 0x60, 0x00, 0x1d, 0xfd, 0xac, 0xc3, 0x30, 0xc3, 0x35,
+  0xb5, 0x8c, 0x30, 0x63, 0xbf, 0xe2, 0xd2, 0xd1, 0x69, 0x65, 0xa6, 0xb0, 0x62, 0x72, 0x51, 0xb5,
+  0xeb, 0xd6, 0xcc, 0xcc, 0xcc, 0xc6, 0x35, 0xb4, 0xcb, 0x58, 0x00, 0x07, 0xdf, 0x66, 0xb3, 0x5a,
+  0xc0, 0x2c, 0x5a, 0x01, 0x6b, 0x2c, 0x5e, 0x8d, 0x60, 0xd6, 0x0c, 0x0c, 0x0d, 0x8e, 0x5b, 0x59,
+  0xac, 0xd6, 0x37, 0x7f, 0xf6, 0xb0, 0xc6, 0x33, 0x19, 0x98, 0xcc, 0x37, 0xdf, 0xfc, 0xb0, 0x35,
+  0x8c, 0x6b, 0xd6, 0x61, 0xad, 0xa6, 0xb5, 0xa1, 0x00, 0x00, 0x0f, 0xe8, 0x5a, 0x06, 0xad, 0x92,
+  0x93, 0x6c, 0x6c, 0x31, 0x96, 0x7f, 0xff, 0xf4, 0x72, 0x6e, 0xd0, 0xb4, 0x59, 0x60, 0xcd, 0x7a,
+  0xf5, 0x80, 0x03, 0xf6, 0xcc, 0xcc, 0x6f, 0xef, 0xff, 0xf4, 0xbc, 0x63, 0x63, 0x66, 0xc6, 0xd8,
+  0xd9, 0xb5, 0xe1, 0xb5, 0x8d, 0x00, 0xff, 0xff, 0x7f, 0xff, 0xf9, 0xe3, 0x18, 0xc6, 0xd6, 0xc6,
+  0x63, 0x19, 0x8c, 0x63, 0x1a, 0xf5, 0xb5, 0xb0, 0xda, 0xcc, 0x6b, 0x00, 0x1f, 0x7f, 0xff, 0x65,
+  0xeb, 0x1a, 0xf5, 0x8d, 0x6d, 0x60, 0xc0, 0xcb, 0xd3, 0x06, 0x00, 0x00, 0x06, 0x63, 0x19, 0x8c,
+  0x66, 0xb3, 0x58, 0x6b, 0x2c, 0x58, 0x00, 0x0f, 0xea, 0xcd, 0x7a, 0xcc, 0x33, 0x5e, 0x9b, 0x58,
+  0x66, 0xb0, 0xc1, 0xf1, 0x68, 0x84, 0x16, 0x8d, 0x35, 0x8c, 0x4d, 0x48, 0xd8, 0xcc, 0xcc, 0xcc,
+  0xcd, 0xaf, 0x5b, 0x0c, 0x35, 0xac, 0xb0, 0x00, 0x0f, 0xee, 0xcd, 0x66, 0x98, 0x58, 0x2c, 0x8d,
+  0xd8, 0xb5, 0xa6, 0xb5, 0x80, 0xcb, 0x1a, 0xc3, 0x58, 0xd6, 0x05, 0x45, 0x8d, 0x6d, 0x63, 0x59,
+  0xad, 0xff, 0xdd, 0x96, 0xd6, 0x63, 0x1b, 0x5e, 0xbd, 0x66, 0x6b, 0x6b, 0xbf, 0xf8, 0x06, 0xb1,
+  0xad, 0x86, 0x6b, 0x6b, 0x1a, 0xd6, 0x5a, 0x2c, 0x00, 0x16, 0x0d, 0xfd, 0x13, 0x40, 0xd5, 0x80,
+  0x00, 0x00, 0x00, 0x00,
+};
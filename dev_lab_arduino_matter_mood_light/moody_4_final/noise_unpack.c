@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Packed noise image decoder
+ *
+ * Rows are split into blocks that are coded separately, decoding starts at
+ * the block holding the first value needed so at most count + block size
+ * values are decoded per frame.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "noise_unpack.h"
+
+// Must match pack_noise.py
+#define NOISE_UNPACK_BLOCK 128  // Values per block
+#define NOISE_UNPACK_ESCAPE 16  // Number of 1 bits that mark an escaped value
+
+// Read the next 25 or more bits from pos, most significant bit first
+static inline uint32_t noise_unpack_peek(const uint8_t *bits, uint32_t pos) {
+  const uint8_t *p = bits + (pos >> 3);
+  uint32_t w = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  return w << (pos & 7);
+}
+
+// Decode count values from a packed row starting at column col
+void noise_unpack_row(const uint8_t *bits, uint32_t row, const uint16_t *blocks, uint32_t col, uint8_t *values, uint16_t count) {
+  uint32_t block = col / NOISE_UNPACK_BLOCK;
+  uint32_t pos = (row >> 8) + ((block > 0) ? blocks[block - 1] : 0);
+  uint8_t k = row & 0xFF;
+  uint32_t end = col + count;
+  uint32_t w, q, z;
+  int32_t a = 0, b = 0, v;
+  // Decode from start of block with first value needed
+  for (uint32_t c = block * NOISE_UNPACK_BLOCK; c < end; c++) {
+    w = noise_unpack_peek(bits, pos);
+    // First two values of a block are stored as they are ?
+    if ((c % NOISE_UNPACK_BLOCK) < 2) {
+      v = w >> 24;
+      pos += 8;
+    }
+    // Escaped value ?
+    else if ((w >> (32 - NOISE_UNPACK_ESCAPE)) == (1u << NOISE_UNPACK_ESCAPE) - 1) {
+      v = (w << NOISE_UNPACK_ESCAPE) >> 24;
+      pos += NOISE_UNPACK_ESCAPE + 8;
+    }
+    // Rice coded error of value predicted from the previous two ?
+    else {
+      q = __builtin_clz(~w);
+      z = q << k;
+      if (k) z |= (w << (q + 1)) >> (32 - k);
+      pos += q + 1 + k;
+      v = 2 * a - b;
+      if (v < 0) v = 0;
+      else if (v > 255) v = 255;
+      v += (z & 1) ? -(int32_t)((z + 1) >> 1) : (int32_t)(z >> 1);
+    }
+    b = a;
+    a = v;
+    if (c >= col) values[c - col] = v;
+  }
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * Packed noise image decoder
+ *
+ * Decodes a segment of one row of a noise image packed by pack_noise.py,
+ * only the segment needed for each frame is decoded so the image can stay
+ * packed in flash.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef NOISE_UNPACK_H
+#define NOISE_UNPACK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decode count values from a packed row starting at column col
+//   bits   - packed rows (noise_bits[])
+//   row    - entry for the row (noise_rows[row])
+//   blocks - block offsets for the row (noise_blocks[row])
+void noise_unpack_row(const uint8_t *bits, uint32_t row, const uint16_t *blocks, uint32_t col, uint8_t *values, uint16_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NOISE_UNPACK_H
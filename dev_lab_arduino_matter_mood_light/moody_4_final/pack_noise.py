@@ -0,0 +1,193 @@
+"""
+*****************************************************************************
+Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+*****************************************************************************
+Noise image packer
+
+Converts a noise image header (noise.h, noise_subtle.h) into the packed
+format read by noise_unpack.c, for example:
+
+    python3 pack_noise.py noise_subtle.h noise_subtle_packed.h
+
+Rows are split into blocks of BLOCK values, coded separately so a segment of
+a row can be decoded without decoding the rest of the row:
+- The first two values of a block are stored as 8 bits each
+- Following values are predicted from the previous two (2a - b) and the
+  prediction error is Rice coded with a parameter chosen per row
+- Errors too large for Rice coding are escaped and stored as 8 bit values
+
+*****************************************************************************
+SPDX-License-Identifier: Zlib
+
+The licensor of this software is Silicon Laboratories Inc.
+
+This software is provided \'as-is\', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+
+*****************************************************************************
+# EXPERIMENTAL QUALITY
+This code has not been formally tested and is provided as-is. It is not
+suitable for production environments. In addition, this code will not be
+maintained and there may be no bug maintenance planned for these resources.
+Silicon Labs may update projects from time to time.
+******************************************************************************
+"""
+# Import core modules
+import re
+import sys
+
+# Must match noise_unpack.c
+BLOCK = 128      # Values per block
+RICE_K_MAX = 7   # Largest Rice parameter
+ESCAPE = 16      # Number of 1 bits that mark an escaped value
+PADDING = 4      # Bytes after the data so the decoder can always read 32 bits
+
+# Read noise image header
+def read_noise(path):
+    text = open(path).read()
+    width = int(re.search(r"#define NOISE_WIDTH (\d+)", text).group(1))
+    height = int(re.search(r"#define NOISE_HEIGHT (\d+)", text).group(1))
+    data = text.split("{", 1)[1].split("}", 1)[0]
+    values = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", data)]
+    if len(values) != width * height:
+        sys.exit("%s: expected %u values, found %u" % (path, width * height, len(values)))
+    return width, height, values
+
+# Predicted value from the previous two values
+def predict(a, b):
+    return min(255, max(0, 2 * a - b))
+
+# Prediction errors for a row, zigzag coded so they are all positive, None
+# for values stored as they are
+def row_errors(row):
+    errors = []
+    for c in range(len(row)):
+        if c % BLOCK < 2:
+            errors.append(None)
+        else:
+            e = row[c] - predict(row[c - 1], row[c - 2])
+            errors.append(2 * e if e >= 0 else -2 * e - 1)
+    return errors
+
+# Bits used to code a row's errors with Rice parameter k
+def row_bits(errors, k):
+    bits = 0
+    for z in errors:
+        if z is not None:
+            q = z >> k
+            bits += (q + 1 + k) if q < ESCAPE else (ESCAPE + 8)
+    return bits
+
+# Bit writer, most significant bit first
+class BitWriter():
+
+    # Initialisation
+    def __init__(self):
+        self.data = bytearray()
+        self.acc = 0
+        self.count = 0
+
+    # Total bits written
+    def position(self):
+        return len(self.data) * 8 + self.count
+
+    # Write value using bits
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.count += 1
+            if self.count == 8:
+                self.data.append(self.acc)
+                self.acc = 0
+                self.count = 0
+
+    # Flush partial byte and add padding
+    def finish(self):
+        if self.count:
+            self.write(0, 8 - self.count)
+        self.data.extend(bytes(PADDING))
+        return self.data
+
+# Pack noise image
+def pack(width, height, values):
+    writer = BitWriter()
+    rows = []
+    blocks = []
+    for r in range(height):
+        row = values[r * width:(r + 1) * width]
+        errors = row_errors(row)
+        k = min(range(RICE_K_MAX + 1), key=lambda k: row_bits(errors, k))
+        start = writer.position()
+        rows.append((start << 8) | k)
+        for c, z in enumerate(errors):
+            # Start of a block after the first ? Note offset from row start
+            if c > 0 and c % BLOCK == 0:
+                blocks.append(writer.position() - start)
+            if z is None:
+                writer.write(row[c], 8)
+            elif (z >> k) < ESCAPE:
+                q = z >> k
+                writer.write((1 << (q + 1)) - 2, q + 1)
+                writer.write(z & ((1 << k) - 1), k)
+            else:
+                writer.write((1 << ESCAPE) - 1, ESCAPE)
+                writer.write(row[c], 8)
+    if max(blocks, default=0) > 0xFFFF:
+        sys.exit("row too long for 16 bit block offsets")
+    return rows, blocks, writer.finish()
+
+# Size of packed noise in bytes
+def packed_size(rows, blocks, data):
+    return len(data) + len(rows) * 4 + len(blocks) * 2
+
+# Write packed noise header
+def write_header(path, source, width, height, rows, blocks, data):
+    with open(path, "w") as f:
+        f.write("// Generated by pack_noise.py from %s, do not edit\n" % source)
+        f.write("//\n")
+        f.write("// %u bytes packed into %u bytes\n" % (width * height, packed_size(rows, blocks, data)))
+        f.write("\n")
+        f.write("#define NOISE_HEIGHT %u\n" % height)
+        f.write("#define NOISE_WIDTH %u\n" % width)
+        f.write("#define NOISE_BLOCKS %u\n" % ((width + BLOCK - 1) // BLOCK))
+        f.write("\n")
+        f.write("// Bit offset of each row << 8 | Rice parameter\n")
+        f.write("const uint32_t noise_rows[] = {\n")
+        for i in range(0, len(rows), 8):
+            f.write("  " + ", ".join("0x%08x" % v for v in rows[i:i + 8]) + ",\n")
+        f.write("};\n")
+        f.write("\n")
+        f.write("// Bit offset of each block after the first from the start of its row\n")
+        f.write("const uint16_t noise_blocks[][NOISE_BLOCKS - 1] = {\n")
+        per_row = (width + BLOCK - 1) // BLOCK - 1
+        for i in range(0, len(blocks), per_row):
+            f.write("  { " + ", ".join("%u" % v for v in blocks[i:i + per_row]) + " },\n")
+        f.write("};\n")
+        f.write("\n")
+        f.write("// Packed rows\n")
+        f.write("const uint8_t noise_bits[] = {\n")
+        for i in range(0, len(data), 16):
+            f.write("  " + ", ".join("0x%02x" % v for v in data[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+# Main
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: pack_noise.py <noise.h> <packed.h>")
+    width, height, values = read_noise(sys.argv[1])
+    rows, blocks, data = pack(width, height, values)
+    write_header(sys.argv[2], sys.argv[1], width, height, rows, blocks, data)
+    print("%s: %u bytes packed into %u bytes" % (sys.argv[2], width * height, packed_size(rows, blocks, data)))
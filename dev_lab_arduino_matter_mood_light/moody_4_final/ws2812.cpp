@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * WS2812 output driver
+ *
+ * Each WS2812 bit is sent as 3 USART bits, 100 for 0 and 110 for 1, giving
+ * high times of 417ns and 833ns. The USART stays low after each frame for
+ * the reset (latch) period.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include <Arduino.h>
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "em_usart.h"
+#include "dmadrv.h"
+#include "ws2812.h"
+
+// Defines
+#define WS2812_USART USART0                                     // USART used for output, must not be used by another library
+#define WS2812_USART_INDEX 0                                    // USART index for routing
+#define WS2812_USART_CLOCK cmuClock_USART0                      // USART clock
+#define WS2812_USART_SIGNAL dmadrvPeripheralSignal_USART0_TXBL  // USART signal for LDMA
+#define WS2812_FREQ 2400000                                     // USART bit rate, 3 bits per WS2812 bit
+#define WS2812_PIXEL_BYTES 9                                    // Encoded bytes per pixel
+#define WS2812_RESET_BYTES 90                                   // Encoded bytes of low level for the reset period (>280us)
+#define WS2812_BUFFER_SIZE (WS2812_PIXEL_MAX * WS2812_PIXEL_BYTES + WS2812_RESET_BYTES)
+#define WS2812_TRANSFER_MAX 2048                                // Most items DMADRV sends in one transfer
+
+static_assert(WS2812_BUFFER_SIZE <= WS2812_TRANSFER_MAX, "Frame does not fit in one LDMA transfer, lower WS2812_PIXEL_MAX");
+
+// Encoded bits for each nibble, 4 WS2812 bits as 12 USART bits
+static const uint16_t ws2812_nibbles[16] = { 0x924, 0x926, 0x934, 0x936, 0x9a4, 0x9a6, 0x9b4, 0x9b6, 0xd24, 0xd26, 0xd34, 0xd36, 0xda4, 0xda6, 0xdb4, 0xdb6 };
+
+// Driver data
+static uint8_t ws2812_buffers[2][WS2812_BUFFER_SIZE];  // Encoded frames
+static uint8_t ws2812_back = 0;                        // Buffer to encode next frame into
+static unsigned int ws2812_channel;                    // LDMA channel
+static bool ws2812_ready = false;                      // LDMA channel allocated, frames can be transmitted
+static volatile bool ws2812_transmitting = false;      // Frame is being transmitted
+
+// LDMA transfer complete callback
+static bool ws2812_done(unsigned int channel, unsigned int sequence, void *param) {
+  (void)channel;
+  (void)sequence;
+  (void)param;
+  ws2812_transmitting = false;
+  return true;
+}
+
+// Set up driver and USART
+bool ws2812_begin(uint8_t pin) {
+  USART_InitSync_TypeDef init = USART_INITSYNC_DEFAULT;
+  GPIO_Port_TypeDef port = getSilabsPortFromArduinoPin(pinToPinName(pin));
+  uint32_t port_pin = getSilabsPinFromArduinoPin(pinToPinName(pin));
+  // Reset periods are already encoded at the end of the buffers
+  memset(ws2812_buffers, 0, sizeof(ws2812_buffers));
+  // USART, transmit only, most significant bit first
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(WS2812_USART_CLOCK, true);
+  init.enable = usartDisable;
+  init.baudrate = WS2812_FREQ;
+  init.msbf = true;
+  USART_InitSync(WS2812_USART, &init);
+  // Route transmit to pin, low when idle
+  GPIO_PinModeSet(port, port_pin, gpioModePushPull, 0);
+  GPIO->USARTROUTE[WS2812_USART_INDEX].TXROUTE = ((uint32_t)port << _GPIO_USART_TXROUTE_PORT_SHIFT)
+                                                 | (port_pin << _GPIO_USART_TXROUTE_PIN_SHIFT);
+  GPIO->USARTROUTE[WS2812_USART_INDEX].ROUTEEN = GPIO_USART_ROUTEEN_TXPEN;
+  USART_Enable(WS2812_USART, usartEnableTx);
+  // LDMA
+  DMADRV_Init();
+  ws2812_ready = (DMADRV_AllocateChannel(&ws2812_channel, NULL) == ECODE_EMDRV_DMADRV_OK);
+  return ws2812_ready;
+}
+
+// Check if a frame is being transmitted
+bool ws2812_busy() {
+  return ws2812_transmitting;
+}
+
+// Encode and transmit a frame of packed GRB colors
+void ws2812_write(const uint32_t *frame, uint16_t count) {
+  uint8_t *buffer = ws2812_buffers[ws2812_back];
+  uint8_t *out = buffer;
+  uint32_t color, bits;
+  if (!ws2812_ready) return;
+  if (count > WS2812_PIXEL_MAX) count = WS2812_PIXEL_MAX;
+  // Encode frame while previous frame is transmitted, green, red then blue
+  for (uint16_t p = 0; p < count; p++) {
+    color = frame[p];
+    for (int8_t shift = 16; shift >= 0; shift -= 8) {
+      bits = ((uint32_t)ws2812_nibbles[(color >> (shift + 4)) & 0xF] << 12) | ws2812_nibbles[(color >> shift) & 0xF];
+      *out++ = bits >> 16;
+      *out++ = bits >> 8;
+      *out++ = bits;
+    }
+  }
+  // Low for the reset period after the pixels
+  memset(out, 0, WS2812_RESET_BYTES);
+  // Wait for previous frame
+  while (ws2812_transmitting) {
+  }
+  // Transmit
+  ws2812_transmitting = true;
+  if (DMADRV_MemoryPeripheral(ws2812_channel, WS2812_USART_SIGNAL, (void *)&WS2812_USART->TXDATA, buffer, true,
+                              count * WS2812_PIXEL_BYTES + WS2812_RESET_BYTES, dmadrvDataSize1, ws2812_done, NULL)
+      != ECODE_EMDRV_DMADRV_OK) {
+    // Nothing was started so the done callback will not clear the flag, drop the frame
+    ws2812_transmitting = false;
+    return;
+  }
+  // Encode next frame into other buffer
+  ws2812_back ^= 1;
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 2024 Silicon Laboratories Inc. www.silabs.com
+ ******************************************************************************
+ * WS2812 output driver
+ *
+ * Encodes a frame of packed GRB colors into USART synchronous mode bits, 3
+ * bits per WS2812 bit at 2.4MHz, and transmits them with LDMA so interrupts
+ * stay enabled. Frames are double buffered, the next frame is encoded while
+ * the previous frame is transmitted.
+ *
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided \'as-is\', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef WS2812_H
+#define WS2812_H
+
+#include <stdint.h>
+
+#ifndef WS2812_PIXEL_MAX
+#define WS2812_PIXEL_MAX 128  // Maximum number of pixels, can be raised with a build flag for long chains
+#endif
+#if WS2812_PIXEL_MAX > 217
+#error "WS2812_PIXEL_MAX is at most 217, a frame of 9 bytes per pixel and 90 reset bytes is sent in one 2048 byte LDMA transfer"
+#endif
+#define WS2812_MEMORY (2 * (WS2812_PIXEL_MAX * 9 + 90))  // Bytes of RAM used by the two encoded frame buffers
+
+// Set up driver and USART, pin must not be used by another peripheral,
+// returns false if no LDMA channel is free and frames will not be written
+bool ws2812_begin(uint8_t pin);
+
+// Check if a frame is being transmitted
+bool ws2812_busy();
+
+// Encode and transmit a frame of packed GRB colors, waits if the previous
+// frame is still being transmitted
+void ws2812_write(const uint32_t *frame, uint16_t count);
+
+#endif // WS2812_H
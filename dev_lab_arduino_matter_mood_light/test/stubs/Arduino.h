@@ -0,0 +1,114 @@
+// Host test stub of the Arduino core for Silicon Labs boards
+//
+// Time is simulated, it only moves when the test advances it or the sketch
+// calls delay(). Serial output is kept for the test to read, Serial input is
+// queued by the test.
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "em_gpio.h"
+
+typedef uint8_t PinName;
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LED_BUILTIN 0x23
+#define LED_BUILTIN_ACTIVE HIGH
+#define LED_BUILTIN_INACTIVE LOW
+#define BTN_BUILTIN 0x24
+#define PIN_SPI_MOSI 0x25
+#define ARDUINO_STUB_PINS 0x40
+
+typedef struct {
+  uint64_t micros;                    // Simulated time
+  uint8_t levels[ARDUINO_STUB_PINS];  // Pin levels, written by the sketch or set by the test for inputs
+  std::string output;                 // Serial output
+  std::string input;                  // Serial input not read yet
+  bool echo;                          // Also print Serial output
+} arduino_stub_t;
+
+inline arduino_stub_t *arduino_stub() {
+  static arduino_stub_t stub;
+  return &stub;
+}
+
+inline uint32_t micros() {
+  return (uint32_t)arduino_stub()->micros;
+}
+
+inline uint32_t millis() {
+  return (uint32_t)(arduino_stub()->micros / 1000);
+}
+
+inline void delay(uint32_t ms) {
+  arduino_stub()->micros += (uint64_t)ms * 1000;
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode) {
+  // Pulled up inputs read high until the test pulls them low
+  if (mode == INPUT_PULLUP) arduino_stub()->levels[pin % ARDUINO_STUB_PINS] = HIGH;
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t level) {
+  arduino_stub()->levels[pin % ARDUINO_STUB_PINS] = level;
+}
+
+inline int digitalRead(uint8_t pin) {
+  return arduino_stub()->levels[pin % ARDUINO_STUB_PINS];
+}
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+class SerialStub {
+public:
+  void begin(unsigned long baud) {
+    (void)baud;
+  }
+  int available() {
+    return (int)arduino_stub()->input.size();
+  }
+  int read() {
+    std::string *input = &arduino_stub()->input;
+    if (input->empty()) return -1;
+    int c = (unsigned char)(*input)[0];
+    input->erase(0, 1);
+    return c;
+  }
+  void printf(const char *format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    arduino_stub()->output += line;
+    if (arduino_stub()->echo) fputs(line, stdout);
+  }
+};
+
+inline SerialStub Serial;
+
+inline PinName pinToPinName(uint8_t pin) {
+  return pin;
+}
+
+inline GPIO_Port_TypeDef getSilabsPortFromArduinoPin(PinName pin) {
+  return (GPIO_Port_TypeDef)(pin >> 4);
+}
+
+inline uint32_t getSilabsPinFromArduinoPin(PinName pin) {
+  return pin & 0xF;
+}
+
+#endif // ARDUINO_H
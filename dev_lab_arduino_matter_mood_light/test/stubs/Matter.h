@@ -0,0 +1,37 @@
+// Host test stub of the Silicon Labs Arduino Matter library
+//
+// The device is commissioned and online from the start.
+#ifndef MATTER_H
+#define MATTER_H
+
+#include <string>
+
+class MatterStub {
+public:
+  void begin() {
+  }
+  bool isDeviceCommissioned() {
+    return true;
+  }
+  bool isDeviceThreadConnected() {
+    return true;
+  }
+  std::string getManualPairingCode() {
+    return "00000000000";
+  }
+  std::string getOnboardingQRCodeUrl() {
+    return "";
+  }
+};
+
+inline MatterStub Matter;
+
+typedef int nvm3_Handle_t;
+inline nvm3_Handle_t *nvm3_defaultHandle = nullptr;
+
+inline int nvm3_eraseAll(nvm3_Handle_t *handle) {
+  (void)handle;
+  return 0;
+}
+
+#endif // MATTER_H
@@ -0,0 +1,63 @@
+// Host test stub of the Silicon Labs Arduino Matter color bulb
+//
+// The test changes a bulb with stub_set(), which calls the device change
+// callback as the Matter stack does.
+#ifndef MATTER_LIGHTBULB_H
+#define MATTER_LIGHTBULB_H
+
+#include <stdint.h>
+
+class MatterColorLightbulb {
+public:
+  void begin() {
+  }
+  bool is_online() {
+    return true;
+  }
+  void boost_saturation(uint8_t boost) {
+    (void)boost;
+  }
+  void set_device_change_callback(void (*callback)()) {
+    change_callback = callback;
+  }
+  void set_onoff(bool state) {
+    onoff = state;
+  }
+  void set_true_hue(uint16_t value) {
+    hue = value;
+  }
+  void set_saturation(uint8_t value) {
+    saturation = value;
+  }
+  void set_brightness(uint8_t value) {
+    brightness = value;
+  }
+  bool get_onoff() {
+    return onoff;
+  }
+  uint16_t get_true_hue() {
+    return hue;
+  }
+  uint8_t get_saturation() {
+    return saturation;
+  }
+  uint8_t get_brightness() {
+    return brightness;
+  }
+  void stub_set(bool state, uint16_t h, uint8_t s, uint8_t v) {
+    onoff = state;
+    hue = h;
+    saturation = s;
+    brightness = v;
+    if (change_callback) change_callback();
+  }
+
+private:
+  bool onoff = false;
+  uint16_t hue = 0;
+  uint8_t saturation = 0;
+  uint8_t brightness = 0;
+  void (*change_callback)() = nullptr;
+};
+
+#endif // MATTER_LIGHTBULB_H
@@ -0,0 +1,82 @@
+// Host test stub of the Gecko SDK DMA driver
+//
+// Transfers are not run, the stub records the last transfer for the test to
+// check and complete by calling its callback, or completes each transfer as
+// it starts.
+#ifndef DMADRV_H
+#define DMADRV_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t Ecode_t;
+typedef bool (*DMADRV_Callback_t)(unsigned int channel, unsigned int sequenceNo, void *userParam);
+
+#define ECODE_EMDRV_DMADRV_OK 0
+#define ECODE_EMDRV_DMADRV_CHANNELS_EXHAUSTED 0x3004
+#define ECODE_EMDRV_DMADRV_PARAM_ERROR 0x3001
+
+typedef enum {
+  dmadrvPeripheralSignal_USART0_TXBL
+} DMADRV_PeripheralSignal_t;
+
+typedef enum {
+  dmadrvDataSize1
+} DMADRV_DataSize_t;
+
+typedef struct {
+  Ecode_t allocate_result;   // Returned by DMADRV_AllocateChannel()
+  Ecode_t transfer_result;   // Returned by DMADRV_MemoryPeripheral()
+  bool complete;             // Complete transfers as they start
+  unsigned int transfers;    // Transfers started
+  const uint8_t *src;        // Last transfer
+  int len;
+  DMADRV_Callback_t callback;
+  void *param;
+} dmadrv_stub_t;
+
+inline dmadrv_stub_t *dmadrv_stub() {
+  static dmadrv_stub_t stub;
+  return &stub;
+}
+
+inline Ecode_t DMADRV_Init() {
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+inline Ecode_t DMADRV_AllocateChannel(unsigned int *channelId, void *capabilities) {
+  (void)capabilities;
+  *channelId = 0;
+  return dmadrv_stub()->allocate_result;
+}
+
+inline Ecode_t DMADRV_MemoryPeripheral(unsigned int channelId, DMADRV_PeripheralSignal_t peripheralSignal, void *dst,
+                                       void *src, bool srcInc, int len, DMADRV_DataSize_t size,
+                                       DMADRV_Callback_t callback, void *cbUserParam) {
+  (void)channelId;
+  (void)peripheralSignal;
+  (void)dst;
+  (void)srcInc;
+  (void)size;
+  dmadrv_stub_t *stub = dmadrv_stub();
+  if (stub->transfer_result != ECODE_EMDRV_DMADRV_OK) return stub->transfer_result;
+  stub->transfers++;
+  stub->src = (const uint8_t *)src;
+  stub->len = len;
+  stub->callback = callback;
+  stub->param = cbUserParam;
+  if (stub->complete) {
+    callback(channelId, 0, cbUserParam);
+    stub->callback = NULL;
+  }
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+// Complete the last transfer
+inline void dmadrv_stub_complete() {
+  dmadrv_stub_t *stub = dmadrv_stub();
+  if (stub->callback) stub->callback(0, 0, stub->param);
+  stub->callback = NULL;
+}
+
+#endif // DMADRV_H
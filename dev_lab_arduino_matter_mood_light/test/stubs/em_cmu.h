@@ -0,0 +1,15 @@
+// Host test stub of the Gecko SDK clock management unit driver
+#ifndef EM_CMU_H
+#define EM_CMU_H
+
+typedef enum {
+  cmuClock_GPIO,
+  cmuClock_USART0
+} CMU_Clock_TypeDef;
+
+inline void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable) {
+  (void)clock;
+  (void)enable;
+}
+
+#endif // EM_CMU_H
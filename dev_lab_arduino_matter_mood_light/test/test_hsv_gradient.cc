@@ -0,0 +1,186 @@
+// Host test of the batch HSV to RGB gradient conversion
+//
+// Runs the real hsv_gradient.c against fast_hsv2rgb_32bit(), which the sketch
+// called once per gradient color through fast_hsv_to_rgb(). Colors one hue
+// step apart must match fast_hsv2rgb_32bit() exactly for every saturation and
+// value, whole gradients must match per color conversions of the same
+// interpolated hue, saturation and value within rounding, and gradients built
+// in slices or scaled from full value must match whole gradients. A benchmark
+// then compares building the sketch's two gradients both ways.
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fast_hsv2rgb.h"
+#include "hsv_gradient.h"
+
+#define GRADIENT_COUNT 256
+#define GRADIENT_SLICE 64
+#define RANDOM_GRADIENTS 20000
+#define BENCHMARK_BUILDS 20000
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next() {
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+// Convert with fast_hsv2rgb_32bit() and pack as hsv_gradient() does
+static uint32_t fast_color(uint16_t h, uint8_t s, uint8_t v) {
+  uint8_t r, g, b;
+  fast_hsv2rgb_32bit(h, s, v, &r, &g, &b);
+  return ((uint32_t)g << 16) | ((uint32_t)r << 8) | b;
+}
+
+// Largest difference between the channels of two packed colors
+static int channel_difference(uint32_t a, uint32_t b) {
+  int most = 0;
+  for (int shift = 0; shift < 24; shift += 8) {
+    int d = abs((int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF));
+    if (d > most) most = d;
+  }
+  return most;
+}
+
+// A gradient once round the color wheel in HSV_HUE_STEPS colors converts
+// every hue step, compared for every saturation and value
+static void test_conversion() {
+  static uint32_t colors[HSV_HUE_STEPS + 1];
+  long mismatches = 0;
+  for (int s = 0; s <= 255; s++) {
+    for (int v = 0; v <= 255; v++) {
+      hsv_gradient(0, s, v, 360, s, v, colors, HSV_HUE_STEPS + 1);
+      for (int h = 0; h <= HSV_HUE_STEPS; h++) {
+        mismatches += (colors[h] != fast_color(h % HSV_HUE_STEPS, s, v)) ? 1 : 0;
+      }
+    }
+  }
+  printf("conversion: %ld of %d colors differ from fast_hsv2rgb_32bit()\n", mismatches, 256 * 256 * (HSV_HUE_STEPS + 1));
+  CHECK(mismatches == 0);
+}
+
+// Random gradients, including hues past 359 that cross red, against the
+// interpolated hue, saturation and value of each color converted on its own
+static void test_gradients() {
+  static uint32_t colors[GRADIENT_COUNT];
+  static uint32_t slices[GRADIENT_COUNT];
+  static uint32_t fulls[GRADIENT_COUNT];
+  static uint32_t scaled[GRADIENT_COUNT];
+  long exact = 0, total = 0;
+  int worst = 0, slice_mismatches = 0, scale_worst = 0;
+  for (int n = 0; n < RANDOM_GRADIENTS; n++) {
+    uint16_t h0 = random_next() % 360;
+    uint16_t h1 = h0 + random_next() % 360;
+    if (random_next() & 1) {
+      uint16_t swap = h0;
+      h0 = h1;
+      h1 = swap;
+    }
+    uint8_t s0 = random_next(), s1 = random_next();
+    uint8_t v0 = random_next(), v1 = random_next();
+    hsv_gradient(h0, s0, v0, h1, s1, v1, colors, GRADIENT_COUNT);
+    for (int i = 0; i < GRADIENT_COUNT; i++) {
+      double t = i / (double)(GRADIENT_COUNT - 1);
+      double h = (h0 + (h1 - (double)h0) * t) * HSV_HUE_STEPS / 360.0;
+      uint16_t fast_h = (uint16_t)floor(h + 0.5) % HSV_HUE_STEPS;
+      uint8_t s = (uint8_t)floor(s0 + (s1 - s0) * t + 0.5);
+      uint8_t v = (uint8_t)floor(v0 + (v1 - v0) * t + 0.5);
+      int d = channel_difference(colors[i], fast_color(fast_h, s, v));
+      exact += (d == 0) ? 1 : 0;
+      if (d > worst) worst = d;
+      total++;
+    }
+    // Slices as the sketch builds them between frames
+    for (int first = 0; first < GRADIENT_COUNT; first += GRADIENT_SLICE) {
+      hsv_gradient_part(h0, s0, v0, h1, s1, v1, slices, GRADIENT_COUNT, first, GRADIENT_SLICE);
+    }
+    slice_mismatches += memcmp(slices, colors, sizeof(colors)) ? 1 : 0;
+    // Values applied to a full value gradient
+    hsv_gradient(h0, s0, 255, h1, s1, 255, fulls, GRADIENT_COUNT);
+    hsv_gradient_scale(fulls, v0, v1, scaled, GRADIENT_COUNT);
+    for (int i = 0; i < GRADIENT_COUNT; i++) {
+      int d = channel_difference(scaled[i], colors[i]);
+      if (d > scale_worst) scale_worst = d;
+    }
+  }
+  printf("gradients: %.3f%% of colors exact, largest channel difference %d\n", 100.0 * exact / total, worst);
+  printf("slices: %d of %d gradients differ, scaled: largest channel difference %d\n", slice_mismatches,
+         RANDOM_GRADIENTS, scale_worst);
+  // A hue rounded the other way moves a channel by at most 1
+  CHECK(worst <= 1);
+  CHECK(slice_mismatches == 0);
+  // Scaling rounds twice, at full value and then at the value
+  CHECK(scale_worst <= 1);
+}
+
+// Sketch's gradient build before the batch conversion, map() and a
+// conversion for each color of both gradients
+static void build_per_color(const uint16_t *short_hues, const uint16_t *long_hues, const uint8_t *sats,
+                            const uint8_t *vals, uint32_t *shorts, uint32_t *longs) {
+  for (long i = 0; i < GRADIENT_COUNT; i++) {
+    long short_hue = short_hues[0] + (i * (short_hues[1] - short_hues[0])) / (GRADIENT_COUNT - 1);
+    long long_hue = long_hues[0] + (i * (long_hues[1] - long_hues[0])) / (GRADIENT_COUNT - 1);
+    uint8_t s = sats[0] + (i * (sats[1] - sats[0])) / (GRADIENT_COUNT - 1);
+    uint8_t v = vals[0] + (i * (vals[1] - vals[0])) / (GRADIENT_COUNT - 1);
+    shorts[i] = fast_color((short_hue % 360) * HSV_HUE_STEPS / 359, s, v);
+    longs[i] = fast_color((long_hue % 360) * HSV_HUE_STEPS / 359, s, v);
+  }
+}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// Host time to build the sketch's short and long gradients
+static void test_benchmark() {
+  static uint32_t shorts[GRADIENT_COUNT], longs[GRADIENT_COUNT];
+  static uint32_t short_fulls[GRADIENT_COUNT], long_fulls[GRADIENT_COUNT];
+  const uint16_t short_hues[2] = { 240, 300 };
+  const uint16_t long_hues[2] = { 600, 300 };
+  const uint8_t sats[2] = { 254, 200 };
+  const uint8_t vals[2] = { 254, 128 };
+  struct timespec start, end;
+  double times[3];
+  for (int path = 0; path < 3; path++) {
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int n = 0; n < BENCHMARK_BUILDS; n++) {
+      if (path == 0) {
+        build_per_color(short_hues, long_hues, sats, vals, shorts, longs);
+      } else if (path == 1) {
+        hsv_gradient(short_hues[0], sats[0], 255, short_hues[1], sats[1], 255, short_fulls, GRADIENT_COUNT);
+        hsv_gradient(long_hues[0], sats[0], 255, long_hues[1], sats[1], 255, long_fulls, GRADIENT_COUNT);
+        hsv_gradient_scale(short_fulls, vals[0], vals[1], shorts, GRADIENT_COUNT);
+        hsv_gradient_scale(long_fulls, vals[0], vals[1], longs, GRADIENT_COUNT);
+      } else {
+        hsv_gradient_scale(short_fulls, vals[0], vals[1], shorts, GRADIENT_COUNT);
+        hsv_gradient_scale(long_fulls, vals[0], vals[1], longs, GRADIENT_COUNT);
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    times[path] = elapsed_ns(&start, &end) / BENCHMARK_BUILDS;
+  }
+  printf("benchmark: %d colors, %.0f ns converting each color, %.0f ns batch, %.0f ns rescaling values only\n",
+         2 * GRADIENT_COUNT, times[0], times[1], times[2]);
+}
+
+int main() {
+  test_conversion();
+  test_gradients();
+  test_benchmark();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,193 @@
+// Host test of the procedural noise generator
+//
+// Runs the real noise_gen.c with the settings of the FastNoiseLite images it
+// replaced, noise.h uses FastNoiseLite's default frequency and octaves and
+// noise_subtle.h is matched by the sketch's NOISE_SCALE and NOISE_OCTAVES.
+// The values differ pixel by pixel, so the generated fields are checked
+// against the images for level statistics and feature size. Rows generated
+// in one call must match values generated one at a time, then the time to
+// generate a frame is compared with copying it from the image. Pass a folder
+// to also write PGM images of each image beside its generated field.
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "noise_gen.h"
+namespace noise_default {
+#include "noise.h"
+}
+#undef NOISE_HEIGHT
+#undef NOISE_WIDTH
+namespace noise_subtle {
+#include "noise_subtle.h"
+}
+#undef NOISE_HEIGHT
+#undef NOISE_WIDTH
+
+#define NOISE_WIDTH_MAX 641
+#define NOISE_HEIGHT_MAX 359
+#define BENCHMARK_PIXELS 80
+#define BENCHMARK_FRAMES 20000
+
+// Tolerances of the generated field against the image
+#define MEAN_TOLERANCE 10.0       // Mean level
+#define DEVIATION_TOLERANCE 5.0   // Standard deviation of levels
+#define SATURATED_TOLERANCE 0.03  // Fraction of values at 0 or 255
+#define FEATURE_TOLERANCE 0.2     // Feature size, relative
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Level statistics and feature size of an image
+typedef struct {
+  double mean;
+  double deviation;
+  double black;  // Fraction of values at 0
+  double white;  // Fraction of values at 255
+  int feature;   // Shortest horizontal shift with autocorrelation below 0.5
+} noise_stats_t;
+
+static noise_stats_t stats(const uint8_t *values, int width, int height) {
+  noise_stats_t s = {};
+  long count = (long)width * height;
+  double sum = 0, squares = 0;
+  for (long i = 0; i < count; i++) {
+    sum += values[i];
+    squares += (double)values[i] * values[i];
+    s.black += (values[i] == 0) ? 1 : 0;
+    s.white += (values[i] == 255) ? 1 : 0;
+  }
+  s.mean = sum / count;
+  s.deviation = sqrt(squares / count - s.mean * s.mean);
+  s.black /= count;
+  s.white /= count;
+  for (int shift = 1; shift < width / 2 && s.feature == 0; shift++) {
+    double correlation = 0;
+    long pairs = 0;
+    for (int y = 0; y < height; y++) {
+      const uint8_t *row = &values[y * width];
+      for (int x = 0; x + shift < width; x++, pairs++) {
+        correlation += (row[x] - s.mean) * (row[x + shift] - s.mean);
+      }
+    }
+    if (correlation / pairs < 0.5 * s.deviation * s.deviation) s.feature = shift;
+  }
+  return s;
+}
+
+static void print_stats(const char *name, const noise_stats_t *s) {
+  printf("  %-9s mean %5.1f deviation %4.1f black %.3f white %.3f feature %d px\n", name, s->mean, s->deviation,
+         s->black, s->white, s->feature);
+}
+
+// Write an image and the generated field side by side
+static void write_pgm(const char *folder, const char *name, const uint8_t *image, const uint8_t *field, int width,
+                      int height) {
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s.pgm", folder, name);
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    printf("FAIL cannot write %s\n", path);
+    failures++;
+    return;
+  }
+  fprintf(file, "P5\n%d %d\n255\n", 2 * width, height);
+  for (int y = 0; y < height; y++) {
+    fwrite(&image[y * width], 1, width, file);
+    fwrite(&field[y * width], 1, width, file);
+  }
+  fclose(file);
+  printf("  wrote %s\n", path);
+}
+
+// Generate a field the size of an image and compare them
+static void test_image(const char *name, const uint8_t *image, int width, int height, uint16_t scale, uint8_t octaves,
+                       const char *folder) {
+  static uint8_t field[NOISE_WIDTH_MAX * NOISE_HEIGHT_MAX];
+  noise_gen_init(1337, scale, octaves, -600, 700);
+  for (int y = 0; y < height; y++) noise_gen_row(0, y, &field[y * width], width);
+  noise_stats_t expected = stats(image, width, height);
+  noise_stats_t actual = stats(field, width, height);
+  printf("%s against scale %d, %d octaves\n", name, scale, octaves);
+  print_stats("image", &expected);
+  print_stats("generated", &actual);
+  CHECK(fabs(actual.mean - expected.mean) < MEAN_TOLERANCE);
+  CHECK(fabs(actual.deviation - expected.deviation) < DEVIATION_TOLERANCE);
+  CHECK(fabs(actual.black - expected.black) < SATURATED_TOLERANCE);
+  CHECK(fabs(actual.white - expected.white) < SATURATED_TOLERANCE);
+  CHECK(fabs(actual.feature - expected.feature) <= FEATURE_TOLERANCE * expected.feature + 1);
+  if (folder != NULL) write_pgm(folder, name, image, field, width, height);
+}
+
+// Stepping along a row gives the values of each position generated on its
+// own, including far from the origin where positions wrap
+static void test_rows() {
+  static const uint32_t starts[][2] = { { 0, 0 }, { 12345, 678 }, { 0xFFFFF000, 0x7FFFFFF0 } };
+  uint8_t row[NOISE_WIDTH_MAX];
+  uint8_t value;
+  int mismatches = 0;
+  noise_gen_init(1337, 200, 2, -600, 700);
+  for (unsigned s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+    for (uint32_t y = starts[s][1]; y < starts[s][1] + 8; y++) {
+      noise_gen_row(starts[s][0], y, row, NOISE_WIDTH_MAX);
+      for (uint32_t x = 0; x < NOISE_WIDTH_MAX; x++) {
+        noise_gen_row(starts[s][0] + x, y, &value, 1);
+        mismatches += (value != row[x]) ? 1 : 0;
+      }
+    }
+  }
+  printf("rows: %d mismatches against values generated one at a time\n", mismatches);
+  CHECK(mismatches == 0);
+}
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+// Keeps benchmark values from being optimised away
+volatile uint8_t benchmark_sink;
+
+// Host time of the noise for a frame, generated or copied from the image
+static void test_benchmark() {
+  static uint8_t values[BENCHMARK_PIXELS + 1];
+  struct timespec start, end;
+  noise_gen_init(1337, 200, 2, -600, 700);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int f = 0; f < BENCHMARK_FRAMES; f++) {
+    noise_gen_row(f, f, values, BENCHMARK_PIXELS + 1);
+    benchmark_sink = values[f % BENCHMARK_PIXELS];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double generated = elapsed_ns(&start, &end) / BENCHMARK_FRAMES;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int f = 0; f < BENCHMARK_FRAMES; f++) {
+    int row = f % NOISE_HEIGHT_MAX;
+    memcpy(values, &noise_subtle::noise[row * NOISE_WIDTH_MAX + f % (NOISE_WIDTH_MAX - BENCHMARK_PIXELS - 1)],
+           BENCHMARK_PIXELS + 1);
+    benchmark_sink = values[f % BENCHMARK_PIXELS];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double copied = elapsed_ns(&start, &end) / BENCHMARK_FRAMES;
+  printf("benchmark: %d pixel frame, %.0f ns generated (%.1f ns per pixel), %.0f ns copied from the image\n",
+         BENCHMARK_PIXELS, generated, generated / (BENCHMARK_PIXELS + 1), copied);
+}
+
+int main(int argc, char **argv) {
+  const char *folder = (argc > 1) ? argv[1] : NULL;
+  // FastNoiseLite defaults, frequency 0.01 and 3 octaves
+  test_image("noise", noise_default::noise, 479, 269, 100, 3, folder);
+  // Sketch settings
+  test_image("noise_subtle", noise_subtle::noise, NOISE_WIDTH_MAX, NOISE_HEIGHT_MAX, 200, 2, folder);
+  test_rows();
+  test_benchmark();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
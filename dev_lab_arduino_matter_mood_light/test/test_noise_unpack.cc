@@ -0,0 +1,183 @@
+// Host test of the packed noise format
+//
+// Round trips noise images through pack_noise.py and the real noise_unpack.c.
+// Run with IMAGE PACKED pairs of headers, every row and random segments of
+// rows are decoded from the packed header and must match the image exactly.
+// Run with --generate HEADER to write a synthetic image with rows of every
+// smoothness, jumps that need escapes and runs of saturated values, which
+// the noise images alone do not cover.
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "noise_unpack.h"
+
+#define SEGMENTS 20000
+#define RANDOM_WIDTH 300  // Two full blocks and a partial block
+#define RANDOM_HEIGHT 72
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next() {
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+// Noise image or packed noise read from a header
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+  std::vector<uint8_t> values;  // Image values or packed bits
+  std::vector<uint32_t> rows;
+  std::vector<uint16_t> blocks;
+  uint32_t blocks_per_row;
+} noise_header_t;
+
+static bool read_file(const char *path, std::string *text) {
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) return false;
+  char buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) text->append(buffer, length);
+  fclose(file);
+  return true;
+}
+
+static uint32_t read_define(const std::string &text, const char *name) {
+  size_t at = text.find(std::string("#define ") + name + " ");
+  return (at == std::string::npos) ? 0 : strtoul(text.c_str() + at + strlen(name) + 9, NULL, 0);
+}
+
+// Numbers of the array named name, up to the end of its initializer
+template <typename T>
+static std::vector<T> read_array(const std::string &text, const char *name) {
+  std::vector<T> values;
+  size_t at = text.find(std::string(" ") + name + "[");
+  if (at == std::string::npos) return values;
+  const char *p = text.c_str() + text.find('{', at) + 1;
+  const char *end = text.c_str() + text.find("};", at);
+  while (p < end) {
+    if (isdigit((unsigned char)*p)) {
+      char *next;
+      values.push_back((T)strtoul(p, &next, 0));
+      p = next;
+    } else {
+      p++;
+    }
+  }
+  return values;
+}
+
+static bool read_image(const char *path, noise_header_t *image) {
+  std::string text;
+  if (!read_file(path, &text)) return false;
+  image->width = read_define(text, "NOISE_WIDTH");
+  image->height = read_define(text, "NOISE_HEIGHT");
+  image->values = read_array<uint8_t>(text, "noise");
+  return image->values.size() == (size_t)image->width * image->height;
+}
+
+static bool read_packed(const char *path, noise_header_t *packed) {
+  std::string text;
+  if (!read_file(path, &text)) return false;
+  packed->width = read_define(text, "NOISE_WIDTH");
+  packed->height = read_define(text, "NOISE_HEIGHT");
+  packed->blocks_per_row = read_define(text, "NOISE_BLOCKS") - 1;
+  packed->rows = read_array<uint32_t>(text, "noise_rows");
+  packed->blocks = read_array<uint16_t>(text, "noise_blocks");
+  packed->values = read_array<uint8_t>(text, "noise_bits");
+  // A row without blocks after the first still has one entry
+  packed->blocks.resize(packed->height * (packed->blocks_per_row ? packed->blocks_per_row : 1));
+  return (packed->rows.size() == packed->height) && !packed->values.empty();
+}
+
+static void unpack(const noise_header_t *packed, uint32_t row, uint32_t col, uint8_t *values, uint16_t count) {
+  noise_unpack_row(packed->values.data(), packed->rows[row], &packed->blocks[row * packed->blocks_per_row], col,
+                   values, count);
+}
+
+// Decode whole rows and random segments and compare with the image
+static void test_round_trip(const char *image_path, const char *packed_path) {
+  noise_header_t image, packed;
+  if (!read_image(image_path, &image) || !read_packed(packed_path, &packed)) {
+    printf("FAIL cannot read %s or %s\n", image_path, packed_path);
+    failures++;
+    return;
+  }
+  CHECK(packed.width == image.width);
+  CHECK(packed.height == image.height);
+  if (packed.width != image.width || packed.height != image.height) return;
+  std::vector<uint8_t> values(image.width);
+  int mismatches = 0;
+  for (uint32_t r = 0; r < image.height; r++) {
+    unpack(&packed, r, 0, values.data(), image.width);
+    mismatches += memcmp(values.data(), &image.values[r * image.width], image.width) ? 1 : 0;
+  }
+  for (int s = 0; s < SEGMENTS; s++) {
+    uint32_t r = random_next() % image.height;
+    uint32_t col = random_next() % image.width;
+    uint16_t count = 1 + random_next() % (image.width - col);
+    unpack(&packed, r, col, values.data(), count);
+    mismatches += memcmp(values.data(), &image.values[r * image.width + col], count) ? 1 : 0;
+  }
+  printf("%s: %ux%u, %zu bytes packed, %d of %u rows and %d segments mismatched\n", packed_path, image.width,
+         image.height, packed.values.size() + packed.rows.size() * 4 + packed.blocks.size() * 2, mismatches,
+         image.height, SEGMENTS);
+  CHECK(mismatches == 0);
+}
+
+// Synthetic image, each row a random walk with steps of up to 2^(row % 9)
+// levels, some rows with jumps and runs of 0 and 255
+static bool generate(const char *path) {
+  FILE *file = fopen(path, "w");
+  if (file == NULL) return false;
+  fprintf(file, "// Synthetic noise image written by test_noise_unpack\n\n");
+  fprintf(file, "#define NOISE_HEIGHT %d\n#define NOISE_WIDTH %d\n\n", RANDOM_HEIGHT, RANDOM_WIDTH);
+  fprintf(file, "const uint8_t noise[]  = {\n");
+  for (int r = 0; r < RANDOM_HEIGHT; r++) {
+    int32_t step = 1 << (r % 9);
+    int32_t v = random_next() % 256;
+    fprintf(file, " ");
+    for (int c = 0; c < RANDOM_WIDTH; c++) {
+      v += (int32_t)(random_next() % (2 * step + 1)) - step;
+      if (r % 4 == 3 && random_next() % 16 == 0) v = random_next() % 256;
+      if (r % 8 == 7 && random_next() % 32 == 0) v = (v < 128) ? -1000 : 1000;
+      v = (v < 0) ? 0 : (v > 255) ? 255 : v;
+      fprintf(file, " 0x%02x,", v);
+    }
+    fprintf(file, "\n");
+  }
+  fprintf(file, "};\n");
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 3 && strcmp(argv[1], "--generate") == 0) {
+    if (generate(argv[2])) return 0;
+    printf("cannot write %s\n", argv[2]);
+    return 1;
+  }
+  if (argc < 3 || argc % 2 == 0) {
+    printf("usage: test_noise_unpack IMAGE PACKED [IMAGE PACKED]...\n"
+           "       test_noise_unpack --generate IMAGE\n");
+    return 1;
+  }
+  for (int i = 1; i + 1 < argc; i += 2) test_round_trip(argv[i], argv[i + 1]);
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,97 @@
+// Host test of the mood light frame renderer
+//
+// Builds the real sketch against stub Arduino and Matter libraries and
+// renders frames in every pixel mode with write_pixels(). Each frame's
+// channel levels are checked against a floating point blend of the two
+// palette colors either side of each pixel's palette index, gamma corrected
+// with powf(), then the host time to render a frame is reported per mode.
+#include <time.h>
+#include <Arduino.h>
+#include "dmadrv.h"
+#include "moody_4_final.ino"
+
+#define CHECK_FRAMES 200
+#define BENCHMARK_FRAMES 20000
+#define LEVEL_TOLERANCE 2  // Gamma table interpolation and rounding (8 fraction bits)
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+static const char *mode_names[PIXEL_MODE_COUNT] = { "solid 0",         "solid 1",        "gradient short",  "gradient long",
+                                                    "noise slow short", "noise slow long", "noise fast short", "noise fast long" };
+
+// Level expected for a channel part way between two packed colors
+static double expected_level(uint32_t color_0, uint32_t color_1, uint32_t fraction, uint8_t c) {
+  double channel_0 = (color_0 >> (16 - c * 8)) & 0xFF;
+  double channel_1 = (color_1 >> (16 - c * 8)) & 0xFF;
+  double channel = channel_0 + (channel_1 - channel_0) * fraction / 256.0;
+  return pow(channel / 255.0, PIXEL_GAMMA) * (255 << 8);
+}
+
+// Render the next frame of a segment, a frame period after the last
+static void render(segment_t *segment) {
+  arduino_stub()->micros += segment->period * 1000;
+  now_millis = millis();
+  next_frame(segment);
+}
+
+// Check the levels of the frame just rendered against its palette indexes
+static int check_frame(const segment_t *segment) {
+  const uint32_t *palette = segment->mode_palettes[segment->mode];
+  int bad = 0;
+  for (uint16_t p = 0; p < segment->count; p++) {
+    uint32_t index = pixel_indexes[p] >> 8;
+    uint32_t fraction = pixel_indexes[p] & 0xFF;
+    uint32_t color_1 = (fraction != 0) ? palette[index + 1] : palette[index];
+    for (uint8_t c = 0; c < 3; c++) {
+      double expected = expected_level(palette[index], color_1, fraction, c);
+      bad += (fabs(pixel_levels[(segment->first + p) * 3 + c] - expected) > LEVEL_TOLERANCE) ? 1 : 0;
+    }
+  }
+  return bad;
+}
+
+static void test_modes() {
+  segment_t *segment = &segments[0];
+  struct timespec start, end;
+  for (uint8_t m = 0; m < PIXEL_MODE_COUNT; m++) {
+    segment->mode = m;
+    int bad = 0;
+    for (int f = 0; f < CHECK_FRAMES; f++) {
+      render(segment);
+      bad += check_frame(segment);
+    }
+    // Solid modes show the bulb's color on every pixel
+    if (m == PIXEL_MODE_SOLID_0 || m == PIXEL_MODE_SOLID_1) {
+      uint32_t color = bulb_colors[segment->bulbs[m - PIXEL_MODE_SOLID_0]];
+      for (uint16_t p = 0; p < segment->count; p++) {
+        for (uint8_t c = 0; c < 3; c++) {
+          bad += (pixel_levels[(segment->first + p) * 3 + c] != pixel_gamma[(color >> (16 - c * 8)) & 0xFF]) ? 1 : 0;
+        }
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int f = 0; f < BENCHMARK_FRAMES; f++) render(segment);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCHMARK_FRAMES;
+    printf("%-16s %5.0f ns per %u pixel frame, %d levels out of tolerance\n", mode_names[m], ns, segment->count, bad);
+    CHECK(bad == 0);
+  }
+}
+
+int main() {
+  // Frames are sent as soon as they are written
+  dmadrv_stub()->complete = true;
+  setup();
+  CHECK(segments[0].gradient_slice == GRADIENT_COUNT);
+  test_modes();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
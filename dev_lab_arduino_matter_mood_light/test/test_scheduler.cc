@@ -0,0 +1,200 @@
+// Host test of the mood light task scheduler
+//
+// Builds the real sketch against stub Arduino and Matter libraries and calls
+// loop() as the Arduino core does, with simulated time moving on a fixed
+// amount each call. Checks each periodic task runs at its period without
+// missing deadlines, bulb changes are shown within a dither update of their
+// gradients being built, gradient slices wait for room before the next dither
+// update and stats requested over serial are written a line at a time.
+#include <Arduino.h>
+#include "dmadrv.h"
+#include "moody_4_final.ino"
+
+#define LOOP_MICROS 100  // Simulated time for each loop() call
+#define RUN_MILLIS 10000
+#define GRADIENT_LATE_MICROS 4000  // Time left before the next dither update when gradients are started
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Call loop() for ms of simulated time
+static void run(uint32_t ms) {
+  uint64_t end = arduino_stub()->micros + (uint64_t)ms * 1000;
+  while (arduino_stub()->micros < end) {
+    loop();
+    arduino_stub()->micros += LOOP_MICROS;
+  }
+}
+
+// Reset stats over serial, as a user would
+static void reset_stats() {
+  arduino_stub()->input += "r";
+  run(1);
+  arduino_stub()->output.clear();
+}
+
+// Runs expected of a periodic task in ms, one either way for where the run starts
+static bool runs_near(uint8_t t, uint32_t ms) {
+  uint32_t expected = ms / tasks[t].period;
+  return tasks[t].runs + 1 >= expected && tasks[t].runs <= expected + 1;
+}
+
+static void test_periods() {
+  reset_stats();
+  unsigned int transfers = dmadrv_stub()->transfers;
+  run(RUN_MILLIS);
+  printf("periods: dither %u runs, segment %u runs, dio %u runs in %ums\n", tasks[TASK_DITHER].runs,
+         tasks[TASK_SEGMENTS].runs, tasks[TASK_DIO].runs, RUN_MILLIS);
+  for (uint8_t t = 0; t < TASK_COUNT; t++) {
+    if (tasks[t].period == 0) continue;
+    CHECK(runs_near(t, RUN_MILLIS));
+    CHECK(tasks[t].missed == 0);
+    CHECK(tasks[t].late_max == 0);
+  }
+  // Each dither update writes a frame
+  CHECK(dmadrv_stub()->transfers - transfers == tasks[TASK_DITHER].runs);
+}
+
+// Change a bulb, returning the time its change is first shown (us)
+static uint32_t change_bulb(uint8_t bulb, uint16_t h, uint8_t s, uint8_t v) {
+  latency_last = 0;
+  bulbs[bulb].stub_set(true, h, s, v);
+  run(DITHER_PERIOD * 3);
+  return latency_last;
+}
+
+static void test_latency() {
+  reset_stats();
+  segment_t *segment = &segments[0];
+  uint8_t bulb = segment->bulbs[0];
+  // Hue change rebuilds the gradients at full value
+  uint32_t gradient_runs = tasks[TASK_GRADIENTS].runs;
+  uint32_t hue_latency = change_bulb(bulb, (bulb_hues[bulb] + 120) % 360, 200, 200);
+  CHECK(segment->gradient_slice == GRADIENT_COUNT);
+  CHECK(!segment->gradient_fulls);
+  CHECK(tasks[TASK_GRADIENTS].runs - gradient_runs == GRADIENT_COUNT / GRADIENT_SLICE);
+  // Value change only rescales them
+  gradient_runs = tasks[TASK_GRADIENTS].runs;
+  uint32_t value_latency = change_bulb(bulb, bulb_hues[bulb], 200, 100);
+  CHECK(segment->gradient_slice == GRADIENT_COUNT);
+  CHECK(segment->gradient_vals[0] == 100 || segment->gradient_vals[1] == 100);
+  CHECK(tasks[TASK_GRADIENTS].runs - gradient_runs == GRADIENT_COUNT / GRADIENT_SLICE);
+  // Fade finishes over its frames and the new color is shown
+  run(segment->period * FADE_FRAMES);
+  CHECK(segment->fade_level == 256);
+  uint8_t r, g, b;
+  fast_hsv_to_rgb(bulb_hues[bulb], 200, 100, &r, &g, &b);
+  CHECK(bulb_colors[bulb] == COLOR_GRB(r, g, b));
+  // Unchanged bulb shows nothing new
+  uint32_t unchanged_latency = change_bulb(bulb, bulb_hues[bulb], 200, 100);
+  printf("latency: hue change %uus, value change %uus, max %uus\n", hue_latency, value_latency, latency_max);
+  // Slices and the frame are built in the loops after the event, then the next dither update shows them
+  uint32_t bound = DITHER_PERIOD * 1000 + (GRADIENT_COUNT / GRADIENT_SLICE + 3) * LOOP_MICROS;
+  CHECK(hue_latency > 0 && hue_latency <= bound);
+  CHECK(value_latency > 0 && value_latency <= bound);
+  CHECK(unchanged_latency == 0);
+  CHECK(latency_max <= bound);
+}
+
+// Call loop() until there is less than micros left before the next dither update
+static void run_until_dither(uint32_t left) {
+  while ((int32_t)(tasks[TASK_DITHER].start_micros + DITHER_PERIOD * 1000 - micros()) > (int32_t)left) {
+    loop();
+    arduino_stub()->micros += LOOP_MICROS;
+  }
+}
+
+// Check gradient slices only start with room for their worst case before the next dither update
+static void test_gradient_fits(uint32_t wcet_micros) {
+  segment_t *segment = &segments[0];
+  uint8_t bulb = segment->bulbs[1];
+  tasks[TASK_GRADIENTS].wcet_micros = wcet_micros;
+  // Change late in the dither period, when only short slices fit
+  run_until_dither(GRADIENT_LATE_MICROS);
+  bulbs[bulb].stub_set(true, (bulb_hues[bulb] + 60) % 360, 250, 250);
+  uint32_t runs = tasks[TASK_GRADIENTS].runs;
+  uint32_t dithers = tasks[TASK_DITHER].runs;
+  int32_t budget_min = INT32_MAX;
+  while (segment->gradient_slice < GRADIENT_COUNT || tasks[TASK_GRADIENTS].runs == runs) {
+    uint32_t last = tasks[TASK_GRADIENTS].runs;
+    loop();
+    // Slice started, how long was left before the next dither update ?
+    if (tasks[TASK_GRADIENTS].runs != last) {
+      int32_t budget = (int32_t)(tasks[TASK_DITHER].start_micros + DITHER_PERIOD * 1000 - micros());
+      if (budget < budget_min) budget_min = budget;
+    }
+    arduino_stub()->micros += LOOP_MICROS;
+    if (tasks[TASK_DITHER].runs - dithers > 20) break;
+  }
+  printf("gradients: wcet %uus, %u slices over %u dither updates, least time left %dus\n", wcet_micros,
+         tasks[TASK_GRADIENTS].runs - runs, tasks[TASK_DITHER].runs - dithers, budget_min);
+  CHECK(segment->gradient_slice == GRADIENT_COUNT);
+  CHECK(tasks[TASK_GRADIENTS].runs - runs == GRADIENT_COUNT / GRADIENT_SLICE);
+  // Slices wait for the next dither update when they do not fit, those that can never fit run anyway
+  if (wcet_micros < DITHER_PERIOD * 1000) CHECK(budget_min >= (int32_t)wcet_micros);
+  if (wcet_micros > GRADIENT_LATE_MICROS && wcet_micros < DITHER_PERIOD * 1000) CHECK(tasks[TASK_DITHER].runs != dithers);
+  else CHECK(tasks[TASK_DITHER].runs == dithers);
+  CHECK(tasks[TASK_DITHER].missed == 0);
+  tasks[TASK_GRADIENTS].wcet_micros = 0;
+  run(DITHER_PERIOD * 3);
+}
+
+static void test_gradients() {
+  reset_stats();
+  test_gradient_fits(0);
+  test_gradient_fits(GRADIENT_LATE_MICROS / 2);
+  test_gradient_fits(DITHER_PERIOD * 1000 / 2);
+  test_gradient_fits(DITHER_PERIOD * 1000 * 3 / 4);
+  test_gradient_fits(DITHER_PERIOD * 1000);
+}
+
+// Count lines of stats output
+static int stats_lines(const std::string &output) {
+  int lines = 0;
+  for (size_t at = output.find("wcet = "); at != std::string::npos; at = output.find("wcet = ", at + 1)) lines++;
+  return lines;
+}
+
+static void test_stats() {
+  reset_stats();
+  run(RUN_MILLIS / 10);
+  std::string *output = &arduino_stub()->output;
+  arduino_stub()->input += "s";
+  // One line each stats run, frames keep flowing in between
+  while (output->empty()) {
+    loop();
+    arduino_stub()->micros += LOOP_MICROS;
+  }
+  CHECK(output->find("stats, latency") != std::string::npos);
+  CHECK(stats_lines(*output) == 1);
+  run(DITHER_PERIOD * 2);
+  printf("stats: %d lines for %u tasks\n", stats_lines(*output), TASK_COUNT);
+  CHECK(stats_lines(*output) == TASK_COUNT);
+  CHECK(output->find("0: dither, period = 20ms") != std::string::npos);
+  CHECK(output->find("missed = 0") != std::string::npos);
+  // Reset clears the counts
+  arduino_stub()->input += "r";
+  run(1);
+  CHECK(output->find("stats reset") != std::string::npos);
+  CHECK(tasks[TASK_DITHER].runs <= 1);
+  CHECK(tasks[TASK_SEGMENTS].runs <= 1);
+}
+
+int main() {
+  // Frames are sent as soon as they are written
+  dmadrv_stub()->complete = true;
+  setup();
+  test_periods();
+  test_latency();
+  test_gradients();
+  test_stats();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,133 @@
+// Host test of the WS2812 output driver
+//
+// Runs the real ws2812.cpp against stub drivers. Encoded frames are decoded
+// back from the USART bits, checking the 100 and 110 patterns, the GRB order,
+// the reset period and the transfer length, then the LDMA errors are checked
+// to leave the driver able to write the next frame.
+#include "dmadrv.h"
+#include "ws2812.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define WS2812_PIXEL_BYTES 9
+#define WS2812_RESET_BYTES 90
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (0)
+
+// Read a USART bit from an encoded frame, most significant bit first
+static int bit_at(const uint8_t *buffer, int bit) {
+  return (buffer[bit / 8] >> (7 - bit % 8)) & 1;
+}
+
+// Decode a transfer back to colors, returns false on a bad bit pattern
+static bool decode(const uint8_t *buffer, int count, uint32_t *colors) {
+  for (int p = 0; p < count; p++) {
+    uint32_t color = 0;
+    for (int b = 0; b < 24; b++) {
+      int bit = (p * 24 + b) * 3;
+      // 100 is a 0, 110 is a 1
+      if (bit_at(buffer, bit) != 1 || bit_at(buffer, bit + 2) != 0) return false;
+      color = (color << 1) | bit_at(buffer, bit + 1);
+    }
+    colors[p] = color;
+  }
+  return true;
+}
+
+// Check the last transfer carries count pixels of frame and the reset period
+static void check_transfer(const uint32_t *frame, int count) {
+  static uint32_t colors[WS2812_PIXEL_MAX];
+  dmadrv_stub_t *stub = dmadrv_stub();
+  CHECK(stub->len == count * WS2812_PIXEL_BYTES + WS2812_RESET_BYTES);
+  CHECK(decode(stub->src, count, colors));
+  int mismatches = 0;
+  for (int p = 0; p < count; p++) {
+    if (colors[p] != (frame[p] & 0xFFFFFF)) mismatches++;
+  }
+  CHECK(mismatches == 0);
+  int high = 0;
+  for (int i = 0; i < WS2812_RESET_BYTES; i++) {
+    if (stub->src[count * WS2812_PIXEL_BYTES + i]) high++;
+  }
+  CHECK(high == 0);
+}
+
+// No LDMA channel, frames are dropped rather than sent on channel 0
+static void test_no_channel() {
+  static const uint32_t frame[1] = { 0xFFFFFF };
+  dmadrv_stub()->allocate_result = ECODE_EMDRV_DMADRV_CHANNELS_EXHAUSTED;
+  CHECK(!ws2812_begin(0));
+  ws2812_write(frame, 1);
+  CHECK(dmadrv_stub()->transfers == 0);
+  CHECK(!ws2812_busy());
+  dmadrv_stub()->allocate_result = ECODE_EMDRV_DMADRV_OK;
+  CHECK(ws2812_begin(0));
+}
+
+// Every pixel value decodes back to itself, including the 16 nibble patterns
+static void test_encoding() {
+  static uint32_t frame[WS2812_PIXEL_MAX];
+  const uint8_t *last = NULL;
+  uint32_t seed = 12345;
+  for (int f = 0; f < 64; f++) {
+    int count = (f == 0) ? 16 : 1 + (int)(seed % WS2812_PIXEL_MAX);
+    for (int p = 0; p < count; p++) {
+      seed = seed * 1103515245 + 12345;
+      // First frame walks each nibble through every position, others are random with stray top bits
+      frame[p] = (f == 0) ? (uint32_t)p * 0x111111 : seed;
+    }
+    ws2812_write(frame, count);
+    CHECK(ws2812_busy());
+    check_transfer(frame, count);
+    // Double buffered, consecutive frames go out of different buffers
+    CHECK(dmadrv_stub()->src != last);
+    last = dmadrv_stub()->src;
+    dmadrv_stub_complete();
+    CHECK(!ws2812_busy());
+  }
+}
+
+// Frames longer than WS2812_PIXEL_MAX are cut to it
+static void test_clamp() {
+  static uint32_t frame[WS2812_PIXEL_MAX + 8];
+  for (int p = 0; p < WS2812_PIXEL_MAX + 8; p++) frame[p] = 0x00A5C3 + p;
+  ws2812_write(frame, WS2812_PIXEL_MAX + 8);
+  check_transfer(frame, WS2812_PIXEL_MAX);
+  dmadrv_stub_complete();
+}
+
+// A transfer that fails to start must not leave the driver waiting for it
+static void test_transfer_error() {
+  static const uint32_t frame[2] = { 0x123456, 0x654321 };
+  unsigned int transfers = dmadrv_stub()->transfers;
+  dmadrv_stub()->transfer_result = ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  ws2812_write(frame, 2);
+  CHECK(!ws2812_busy());
+  CHECK(dmadrv_stub()->transfers == transfers);
+  dmadrv_stub()->transfer_result = ECODE_EMDRV_DMADRV_OK;
+  // Would wait forever for the failed frame if the flag was left set
+  ws2812_write(frame, 2);
+  CHECK(dmadrv_stub()->transfers == transfers + 1);
+  check_transfer(frame, 2);
+  dmadrv_stub_complete();
+}
+
+int main() {
+  // Fail rather than hang if a write waits for a frame that never completes
+  alarm(10);
+  test_no_channel();
+  test_encoding();
+  test_clamp();
+  test_transfer_error();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -21,6 +21,7 @@
 #include "gpiointerrupt.h"
 #include "em_gpio.h"
 #include "em_core.h"
+#include <atomic>
 #include <cstdio>
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
@@ -28,6 +29,7 @@
 #endif
 
 #if defined (SL_CATALOG_ICM20689_DRIVER_PRESENT)
+#include "sl_icm20689.h"
 #include "sl_icm20689_config.h"
 #define  SL_IMU_INT_PORT SL_ICM20689_INT_PORT
 #define  SL_IMU_INT_PIN  SL_ICM20689_INT_PIN
@@ -39,97 +41,413 @@
 #error "No IMU driver defined"
 #endif
 
-// Size of the IMU data buffer in elements
-#define IMU_BUFFER_SIZE   200
+#if PROFILING
+#include "em_device.h"
+#define BUS_CYCLES_START()  uint32_t bus_start = DWT->CYCCNT
+#define BUS_CYCLES_END()    stats.bus_cycles += DWT->CYCCNT - bus_start
+#else
+#define BUS_CYCLES_START()
+#define BUS_CYCLES_END()
+#endif
+
+#if ACCELEROMETER_FIFO
+#if !defined (SL_CATALOG_ICM20689_DRIVER_PRESENT)
+#error "ACCELEROMETER_FIFO is only supported with the ICM20689"
+#endif
+
+// ICM20689 registers used for FIFO capture
+#define ICM20689_FIFO_WM_TH1        0x60
+#define ICM20689_FIFO_WM_TH2        0x61
+#define ICM20689_FIFO_EN            0x23
+#define ICM20689_FIFO_EN_ACCEL      0x08
+#define ICM20689_ACCEL_CONFIG       0x1C
+#define ICM20689_INT_ENABLE         0x38
+#define ICM20689_INT_FIFO_OFLOW     0x10
+#define ICM20689_FIFO_WM_INT_STATUS 0x39
+#define ICM20689_INT_STATUS         0x3A
+#define ICM20689_USER_CTRL          0x6A
+#define ICM20689_USER_CTRL_FIFO_EN  0x40
+#define ICM20689_USER_CTRL_FIFO_RST 0x04
+#define ICM20689_FIFO_COUNTH        0x72
+#define ICM20689_FIFO_R_W           0x74
+
+// Bytes per accelerometer sample in the FIFO
+#define FIFO_SAMPLE_BYTES  6
+
+// Samples read from the FIFO in one burst
+#define FIFO_BURST_SAMPLES 32
 
-// Accelerometer data from sensor
-typedef struct imu_data {
-  int16_t x;
-  int16_t y;
-  int16_t z;
-} imu_data_t;
+// Bursts read in one interrupt, enough to drain the full 4 kB FIFO
+#define FIFO_MAX_BURSTS    ((4096 / FIFO_SAMPLE_BYTES + FIFO_BURST_SAMPLES - 1) / FIFO_BURST_SAMPLES)
+
+// Accelerometer counts per g for the configured full scale
+static int32_t fifo_counts_per_g = 16384;
+#endif
+
+// Size of the IMU data buffer in elements, must be a power of two so the free
+// running indices can be masked into the buffer
+#define IMU_BUFFER_SIZE   256
+#define IMU_BUFFER_MASK   (IMU_BUFFER_SIZE - 1)
+
+static_assert((IMU_BUFFER_SIZE & IMU_BUFFER_MASK) == 0, "IMU_BUFFER_SIZE must be a power of two");
+static_assert(IMU_BUFFER_SIZE >= SEQUENCE_LENGTH, "IMU_BUFFER_SIZE too small for model input");
 
 // IMU data buffer
 static imu_data_t buffer[IMU_BUFFER_SIZE];
 
-// Current head pointer of the buffer
-static int head_ptr = 0;
+// Number of samples written, only updated by the interrupt handler
+static std::atomic<uint32_t> head(0);
+
+// First sample held by the reader, only updated by the main loop
+static std::atomic<uint32_t> tail(0);
+
+// Reader is holding a window, the interrupt handler must not overwrite it
+static std::atomic<bool> reading(false);
+
+// Samples dropped because the reader was holding the oldest slot
+static uint32_t overrun_count = 0;
 
 // Wait for buffer to be filled first time
-static bool init_done = false;
+static std::atomic<bool> init_done(false);
+
+// Number of new samples that make up a stride
+static int stride = 1;
+
+// New samples counted towards the next stride, only used by the interrupt
+static int stride_count = 0;
+
+// A stride of new samples has arrived since the flag was last taken
+static std::atomic<bool> stride_ready(false);
+
+// GPIO interrupt used for the IMU
+static int imu_int_id = INTERRUPT_UNAVAILABLE;
+
+// Capture rate and resampling to ACCELEROMETER_FREQ. Positions are in units
+// of captured samples in 16.16 fixed point, resample_phase is the position of
+// the next model rate sample after resample_prev.
+static int capture_freq = ACCELEROMETER_CAPTURE_FREQ;
+static uint32_t resample_step = 1 << 16;
+static uint32_t resample_phase = 1 << 16;
+static imu_data_t resample_prev;
+
+// Capture statistics since they were last read
+static acc_stats_t stats;
+
+// Add a sample at the model rate to the buffer
+static void accelerometer_push(const imu_data_t* sample)
+{
+  uint32_t h = head.load(std::memory_order_relaxed);
+
+  // Don't overwrite the window the reader is working on
+  if (reading.load(std::memory_order_acquire)
+      && ((h - tail.load(std::memory_order_relaxed)) >= IMU_BUFFER_SIZE)) {
+    overrun_count++;
+    return;
+  }
+
+  buffer[h & IMU_BUFFER_MASK] = *sample;
+
+  // Publish the sample to the reader
+  head.store(h + 1, std::memory_order_release);
+
+  if (h + 1 >= SEQUENCE_LENGTH) {
+    init_done.store(true, std::memory_order_relaxed);
+
+    // Flag a stride to the main loop
+    ++stride_count;
+    if (stride_count >= stride) {
+      stride_count = 0;
+      stride_ready.store(true, std::memory_order_release);
+    }
+  }
+}
+
+// Resample a sample at the capture rate to the model rate
+static void accelerometer_resample(const imu_data_t* sample)
+{
+  stats.samples++;
+
+  // Linear interpolation between the previous and this sample for every model
+  // rate sample that falls between them
+  while (resample_phase <= (1 << 16)) {
+    int64_t f = resample_phase;
+    imu_data_t out;
+    out.x = (int16_t)(resample_prev.x + (((sample->x - resample_prev.x) * f) >> 16));
+    out.y = (int16_t)(resample_prev.y + (((sample->y - resample_prev.y) * f) >> 16));
+    out.z = (int16_t)(resample_prev.z + (((sample->z - resample_prev.z) * f) >> 16));
+    accelerometer_push(&out);
+    resample_phase += resample_step;
+  }
+  resample_phase -= 1 << 16;
+  resample_prev = *sample;
+}
+
+#if ACCELEROMETER_FIFO
+// Called when the IMU FIFO reaches the watermark using gpio interrupt.
+static void on_data_available(uint8_t int_id, void *ctx)
+{
+  (void) int_id;
+  (void) ctx;
+
+  uint8_t status[2];
+  uint8_t count[2];
+  uint8_t data[FIFO_BURST_SAMPLES * FIFO_SAMPLE_BYTES];
+
+  stats.interrupts++;
+  {
+    BUS_CYCLES_START();
+    // Reading the status registers clears the interrupt
+    sl_icm20689_read_register(ICM20689_FIFO_WM_INT_STATUS, 2, status);
+    stats.bus_calls++;
+    BUS_CYCLES_END();
+  }
+
+  // The interrupt is edge triggered, so drain the FIFO until it is empty or
+  // samples left behind would not raise another interrupt
+  for (int burst = 0; burst < FIFO_MAX_BURSTS; burst++) {
+    int n;
+    {
+      BUS_CYCLES_START();
+      sl_icm20689_read_register(ICM20689_FIFO_COUNTH, 2, count);
+      stats.bus_calls++;
+      n = ((count[0] << 8) | count[1]) / FIFO_SAMPLE_BYTES;
+      if (n > FIFO_BURST_SAMPLES) {
+        n = FIFO_BURST_SAMPLES;
+      }
+      if (n > 0) {
+        // Drain the batch in a single burst, FIFO_R_W does not auto increment
+        sl_icm20689_read_register(ICM20689_FIFO_R_W, n * FIFO_SAMPLE_BYTES, data);
+        stats.bus_calls++;
+      }
+      BUS_CYCLES_END();
+    }
+    if (n == 0) {
+      break;
+    }
+
+    // Convert big endian counts to milli g as sl_imu_get_acceleration() does
+    for (int i = 0; i < n; i++) {
+      const uint8_t *d = &data[i * FIFO_SAMPLE_BYTES];
+      imu_data_t sample;
+      sample.x = (int16_t)(((int16_t)((d[0] << 8) | d[1]) * 1000) / fifo_counts_per_g);
+      sample.y = (int16_t)(((int16_t)((d[2] << 8) | d[3]) * 1000) / fifo_counts_per_g);
+      sample.z = (int16_t)(((int16_t)((d[4] << 8) | d[5]) * 1000) / fifo_counts_per_g);
+      accelerometer_resample(&sample);
+    }
+  }
+
+  // Recover from an overflow by starting the FIFO again
+  if (status[1] & ICM20689_INT_FIFO_OFLOW) {
+    uint8_t user_ctrl;
+    sl_icm20689_read_register(ICM20689_USER_CTRL, 1, &user_ctrl);
+    sl_icm20689_write_register(ICM20689_USER_CTRL, user_ctrl | ICM20689_USER_CTRL_FIFO_RST);
+    stats.bus_calls += 2;
+  }
+}
+
+// Capture accelerometer samples into the FIFO and interrupt at the watermark
+static void accelerometer_configure_fifo(void)
+{
+  uint8_t reg;
+  uint16_t watermark = ACCELEROMETER_FIFO_WATERMARK * FIFO_SAMPLE_BYTES;
 
+  // Scale of the FIFO counts from the full scale set by sl_imu
+  sl_icm20689_read_register(ICM20689_ACCEL_CONFIG, 1, &reg);
+  fifo_counts_per_g = 16384 >> ((reg >> 3) & 0x03);
+
+  // Only the accelerometer goes into the FIFO
+  sl_icm20689_write_register(ICM20689_FIFO_EN, ICM20689_FIFO_EN_ACCEL);
+  sl_icm20689_write_register(ICM20689_FIFO_WM_TH1, (watermark >> 8) & 0x03);
+  sl_icm20689_write_register(ICM20689_FIFO_WM_TH2, watermark & 0xFF);
+
+  // Interrupt on watermark and overflow instead of every sample
+  sl_icm20689_write_register(ICM20689_INT_ENABLE, ICM20689_INT_FIFO_OFLOW);
+
+  sl_icm20689_read_register(ICM20689_USER_CTRL, 1, &reg);
+  sl_icm20689_write_register(ICM20689_USER_CTRL, reg | ICM20689_USER_CTRL_FIFO_EN | ICM20689_USER_CTRL_FIFO_RST);
+}
+#else
 // Called when the IMU has data available using gpio interrupt.
 static void on_data_available(uint8_t int_id, void *ctx)
 {
   (void) int_id;
   (void) ctx;
 
-  if (!sl_imu_is_data_ready()) {
+  stats.interrupts++;
+  BUS_CYCLES_START();
+  bool ready = sl_imu_is_data_ready();
+  stats.bus_calls++;
+  if (!ready) {
+    BUS_CYCLES_END();
     return;
   }
   sl_imu_update();
+  stats.bus_calls++;
+  BUS_CYCLES_END();
 
   int16_t m[3];
   sl_imu_get_acceleration(m);
 
-  buffer[head_ptr].x = m[0];
-  buffer[head_ptr].y = m[1];
-  buffer[head_ptr].z = m[2];
-  head_ptr += 1;
+  imu_data_t sample;
+  sample.x = m[0];
+  sample.y = m[1];
+  sample.z = m[2];
+  accelerometer_resample(&sample);
+}
+#endif
 
-  if (head_ptr >= SEQUENCE_LENGTH) {
-    init_done = true;
-  }
+// Configure the sensor for a capture rate and the resampler to convert it
+static void accelerometer_configure(int freq)
+{
+  sl_imu_configure((float)freq);
+#if ACCELEROMETER_FIFO
+  accelerometer_configure_fifo();
+#endif
 
-  if (head_ptr >= IMU_BUFFER_SIZE) {
-    head_ptr = 0;
-    init_done = true;
-  }
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  capture_freq = freq;
+  resample_step = (uint32_t)(((uint64_t)freq << 16) / ACCELEROMETER_FREQ);
+  resample_phase = 1 << 16;
+  CORE_EXIT_ATOMIC();
 }
 
 sl_status_t accelerometer_setup(void)
 {
   sl_status_t status = SL_STATUS_OK;
-  int int_id;
 
   // Initialize accelerometer sensor
   status = sl_imu_init();
   if (status != SL_STATUS_OK) {
     return status;
   }
-  sl_imu_configure(ACCELEROMETER_FREQ);
+  accelerometer_configure(capture_freq);
   // Setup interrupt from accelerometer on falling edge
   GPIO_PinModeSet(SL_IMU_INT_PORT, SL_IMU_INT_PIN, gpioModeInput, 0);
-  int_id = GPIOINT_CallbackRegisterExt(SL_IMU_INT_PIN, on_data_available, NULL);
-  if (int_id != INTERRUPT_UNAVAILABLE) {
-    GPIO_ExtIntConfig(SL_IMU_INT_PORT, SL_IMU_INT_PIN, int_id, false, true, true);
+  imu_int_id = GPIOINT_CallbackRegisterExt(SL_IMU_INT_PIN, on_data_available, NULL);
+  if (imu_int_id != INTERRUPT_UNAVAILABLE) {
+    GPIO_ExtIntConfig(SL_IMU_INT_PORT, SL_IMU_INT_PIN, imu_int_id, false, true, true);
   } else {
     status = SL_STATUS_FAIL;
   }
   return status;
 }
 
-sl_status_t accelerometer_read(acc_data_t* dst, int n)
+sl_status_t accelerometer_set_rate(int freq)
 {
-  if (init_done == false) {
-    return SL_STATUS_FAIL;
+  if ((freq < ACCELEROMETER_FREQ_MIN) || (freq > ACCELEROMETER_FREQ_MAX)) {
+    return SL_STATUS_INVALID_PARAMETER;
   }
+  if (imu_int_id == INTERRUPT_UNAVAILABLE) {
+    return SL_STATUS_NOT_READY;
+  }
+
+  // Keep the interrupt handler off the bus while the sensor is reconfigured
+  GPIO_IntDisable(1 << imu_int_id);
+  accelerometer_configure(freq);
+  GPIO_IntEnable(1 << imu_int_id);
+  return SL_STATUS_OK;
+}
+
+int accelerometer_get_rate(void)
+{
+  return capture_freq;
+}
 
+void accelerometer_get_stats(acc_stats_t* dst)
+{
   CORE_DECLARE_IRQ_STATE;
-  CORE_ENTER_CRITICAL();
+  CORE_ENTER_ATOMIC();
+  *dst = stats;
+  stats.interrupts = 0;
+  stats.bus_calls = 0;
+  stats.bus_cycles = 0;
+  stats.samples = 0;
+  CORE_EXIT_ATOMIC();
+}
 
-  for (int i = 0; i < n; i++) {
-    int index = head_ptr - n + i;
-    if (index < 0 ) {
-      index += IMU_BUFFER_SIZE;
-    }
-    imu_data_t src = buffer[index];
+sl_status_t accelerometer_acquire(acc_window_t* window, int n)
+{
+  if ((n < 0) || (n > IMU_BUFFER_SIZE)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (init_done.load(std::memory_order_relaxed) == false) {
+    return SL_STATUS_FAIL;
+  }
 
-    dst[i].x = src.x;
-    dst[i].y = src.y;
-    dst[i].z = src.z;
+  uint32_t h;
+  uint32_t t;
+  do {
+    h = head.load(std::memory_order_acquire);
+    t = h - (uint32_t)n;
+    tail.store(t, std::memory_order_relaxed);
+    reading.store(true, std::memory_order_seq_cst);
+    // A sample may have landed between reading head and holding the window,
+    // retry if it overwrote the oldest sample of the window
+  } while ((head.load(std::memory_order_acquire) - t) > IMU_BUFFER_SIZE);
+
+  uint32_t start = t & IMU_BUFFER_MASK;
+  window->first = &buffer[start];
+  window->first_len = n;
+  window->second = buffer;
+  window->second_len = 0;
+  window->end = h;
+  if (start + n > IMU_BUFFER_SIZE) {
+    window->first_len = IMU_BUFFER_SIZE - start;
+    window->second_len = n - window->first_len;
   }
-  CORE_EXIT_CRITICAL();
   return SL_STATUS_OK;
 }
 
+void accelerometer_release(void)
+{
+  reading.store(false, std::memory_order_release);
+}
+
+uint32_t accelerometer_get_overrun_count(void)
+{
+  return overrun_count;
+}
+
+void accelerometer_set_stride(int n)
+{
+  if (n < 1) {
+    n = 1;
+  }
+  stride = n;
+}
+
+bool accelerometer_stride_pending(void)
+{
+  return stride_ready.load(std::memory_order_acquire);
+}
+
+bool accelerometer_take_stride(void)
+{
+  return stride_ready.exchange(false, std::memory_order_acq_rel);
+}
+
+sl_status_t accelerometer_read(acc_data_t* dst, int n)
+{
+  acc_window_t window;
+  sl_status_t status = accelerometer_acquire(&window, n);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  for (int i = 0; i < window.first_len; i++) {
+    dst->x = window.first[i].x;
+    dst->y = window.first[i].y;
+    dst->z = window.first[i].z;
+    dst++;
+  }
+  for (int i = 0; i < window.second_len; i++) {
+    dst->x = window.second[i].x;
+    dst->y = window.second[i].y;
+    dst->z = window.second[i].z;
+    dst++;
+  }
+
+  accelerometer_release();
+  return SL_STATUS_OK;
+}
@@ -19,6 +19,8 @@
 #define ACCELEROMETER_H
 
 #include "sl_status.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 // Accelerometer data structure used by the model
 typedef struct acc_data {
@@ -27,6 +29,33 @@ typedef struct acc_data {
   float z;
 } acc_data_t;
 
+// Accelerometer data from sensor
+typedef struct imu_data {
+  int16_t x;
+  int16_t y;
+  int16_t z;
+} imu_data_t;
+
+// View of the latest samples in the accelerometer buffer. The samples are
+// split in two spans when the window wraps around the end of the buffer, the
+// oldest sample is first[0] and the newest is the last sample of the window.
+// end is the total number of samples captured up to and including the newest.
+typedef struct acc_window {
+  const imu_data_t *first;
+  int first_len;
+  const imu_data_t *second;
+  int second_len;
+  uint32_t end;
+} acc_window_t;
+
+// Accelerometer capture statistics
+typedef struct acc_stats {
+  uint32_t interrupts;  // IMU interrupts handled
+  uint32_t bus_calls;   // IMU driver calls that access the bus
+  uint32_t bus_cycles;  // CPU cycles spent on the bus, counted when PROFILING
+  uint32_t samples;     // Samples captured at the capture rate
+} acc_stats_t;
+
 /***************************************************************************//**
  * @brief
  *   Configure accelerometer to read data regularly to an internal buffer.
@@ -36,6 +65,39 @@ typedef struct acc_data {
  ******************************************************************************/
 sl_status_t accelerometer_setup(void);
 
+/***************************************************************************//**
+ * @brief
+ *   Change the rate the accelerometer is sampled at.
+ *
+ * @details
+ *   Samples are resampled to ACCELEROMETER_FREQ before being stored so the
+ *   model input is unaffected by the capture rate.
+ *
+ * @param freq
+ *   Capture rate in Hz, between ACCELEROMETER_FREQ_MIN and
+ *   ACCELEROMETER_FREQ_MAX.
+ *
+ * @return
+ *   SL_STATUS_OK on success, SL_STATUS_INVALID_PARAMETER if the rate is out of
+ *   range, SL_STATUS_NOT_READY if the accelerometer is not set up.
+ ******************************************************************************/
+sl_status_t accelerometer_set_rate(int freq);
+
+/***************************************************************************//**
+ * @brief
+ *   Get the rate the accelerometer is sampled at in Hz.
+ ******************************************************************************/
+int accelerometer_get_rate(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Read and reset the capture statistics.
+ *
+ * @param dst
+ *   Statistics since the previous call.
+ ******************************************************************************/
+void accelerometer_get_stats(acc_stats_t* dst);
+
 /***************************************************************************//**
  * @brief
  *   Read data from accelerometer buffer into the machine model input buffer.
@@ -51,4 +113,66 @@ sl_status_t accelerometer_setup(void);
  ******************************************************************************/
 sl_status_t accelerometer_read(acc_data_t* dst, int n);
 
+/***************************************************************************//**
+ * @brief
+ *   Get a view of the last n samples in the accelerometer buffer without
+ *   copying them.
+ *
+ * @details
+ *   The samples in the window are not overwritten by the interrupt handler
+ *   until accelerometer_release() is called. New samples arriving while the
+ *   window is held are dropped if the buffer would otherwise overwrite it.
+ *
+ * @param window
+ *   Filled with one or two spans covering the requested samples.
+ *
+ * @param n
+ *   Number of samples in the window.
+ *
+ * @return
+ *   SL_STATUS_OK on success, SL_STATUS_FAIL if the buffer has not been filled
+ *   yet, SL_STATUS_INVALID_PARAMETER if n does not fit in the buffer.
+ ******************************************************************************/
+sl_status_t accelerometer_acquire(acc_window_t* window, int n);
+
+/***************************************************************************//**
+ * @brief
+ *   Release the window obtained by accelerometer_acquire().
+ ******************************************************************************/
+void accelerometer_release(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Number of samples dropped because the reader was holding a window.
+ ******************************************************************************/
+uint32_t accelerometer_get_overrun_count(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Set the number of new samples that make up a stride.
+ *
+ * @param stride
+ *   Number of samples, the interrupt handler flags a stride each time this
+ *   many samples have arrived once the buffer has been filled.
+ ******************************************************************************/
+void accelerometer_set_stride(int stride);
+
+/***************************************************************************//**
+ * @brief
+ *   Check if a stride of new samples has arrived.
+ *
+ * @return
+ *   true if a stride is pending.
+ ******************************************************************************/
+bool accelerometer_stride_pending(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Check and clear the pending stride flag.
+ *
+ * @return
+ *   true if a stride was pending.
+ ******************************************************************************/
+bool accelerometer_take_stride(void);
+
 #endif // ACCELEROMETER_H
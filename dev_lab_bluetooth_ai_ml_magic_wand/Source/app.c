@@ -32,6 +32,12 @@
 #include "app_assert.h"
 #include "sl_bluetooth.h"
 #include "app.h"
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#include "sl_power_manager.h"
+#endif
 
 // Constants
 #include "constants.h"
@@ -45,11 +51,17 @@
 #include "sl_sleeptimer.h"
 // Magic Wand
 #include "magic_wand.h"
+// Scan filter
+#include "scan_filter.h"
 
 // Function prototypes ---------------------------------------------------------
 static bool process_scan_response(sl_bt_evt_scanner_legacy_advertisement_report_t *pResp);
+static void scan_start(void);
+static void scan_loop(void);
 static void app_tick_timer_cb(sl_sleeptimer_timer_handle_t *tick_timer_cb, void *data);
 static void button_loop(void);
+static void gatt_queue_write(uint8_t value);
+static void gatt_queue_process(void);
 
 // Local data ------------------------------------------------------------------
 // Sleep timer
@@ -62,6 +74,31 @@ static uint8_t button_state = APP_STATE_NONE;
 static uint8_t _conn_handle = 0xFF;
 static uint32_t _service_handle = 0;
 static uint16_t _char_handle = 0;
+static bool _write_no_response = false;
+// Last connected peer, reconnects to it skip service and characteristic
+// discovery and scan passively for its address instead of its name
+static struct
+{
+  bool valid;
+  bd_addr address;
+  uint8_t address_type;
+  uint32_t service_handle;
+  uint16_t char_handle;
+  bool write_no_response;
+} peer;
+static volatile uint8_t reconnect_ticks = 0;
+// GATT write queue, the light only needs the latest on/off value so the queue
+// holds one pending write and later commands replace it
+static struct
+{
+  bool pending;    // value waiting to be written
+  uint8_t value;   // value waiting to be written
+  bool in_flight;  // acknowledged write waiting for its procedure to complete
+  uint32_t queued;
+  uint32_t coalesced;
+  uint32_t sent;
+  uint32_t dropped;
+} tx;
 // Blinky service UUID: de8a5aac-a99b-c315-0c80-60d4cbb51224
 const uint8_t serviceUUID[16] =
 { 0x24, 0x12, 0xb5, 0xcb, 0xd4, 0x60, 0x80, 0x0c, 0x15, 0xc3, 0x9b, 0xa9, 0xac, 0x5a, 0x8a, 0xde };
@@ -112,8 +149,40 @@ SL_WEAK void app_process_action(void)
   magic_wand_loop();
   // Process button
   button_loop();
+  // Process scanning
+  scan_loop();
+  // Process writes that couldn't be sent straight away
+  gatt_queue_process();
+}
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+/**************************************************************************//**
+ * Application is OK to sleep.
+ * This overrides the dummy weak implementation.
+ *****************************************************************************/
+bool app_is_ok_to_sleep(void)
+{
+  // Sleep unless an inference, button press or write is waiting to be processed
+  return magic_wand_is_ok_to_sleep() && (APP_STATE_NONE == button_state)
+         && (reconnect_ticks < RECONNECT_SCAN_TICKS)
+         && (!tx.pending || tx.in_flight);
 }
 
+/**************************************************************************//**
+ * Application sleep on ISR exit.
+ * This overrides the dummy weak implementation.
+ *****************************************************************************/
+sl_power_manager_on_isr_exit_t app_sleep_on_isr_exit(void)
+{
+  // Wake the main loop if an interrupt left work for it
+  if (!app_is_ok_to_sleep())
+  {
+    return SL_POWER_MANAGER_WAKEUP;
+  }
+  return SL_POWER_MANAGER_IGNORE;
+}
+#endif
+
 /**************************************************************************//**
  * Bluetooth stack event handler.
  * This overrides the dummy weak implementation.
@@ -136,9 +205,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // Set state
     sc = app_set_state(APP_STATE_SCAN);
     // Start scanning
-    sc = sl_bt_scanner_set_parameters(sl_bt_scanner_scan_mode_active, 32, 32);
-    sc = sl_bt_scanner_start(sl_bt_gap_1m_phy, sl_bt_scanner_discover_generic);
-    app_log("0x%04x = sl_bt_scanner_start()\r\n", (uint16_t ) sc);
+    scan_start();
     break;
 
   case sl_bt_evt_scanner_legacy_advertisement_report_id:
@@ -150,8 +217,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     {
       app_log("sl_bt_on_event(sl_bt_evt_scanner_legacy_advertisement_report_id)\r\n");
       // Open connection
-      sc = sl_bt_connection_open(evt->data.evt_scanner_scan_report.address,
-          evt->data.evt_scanner_scan_report.address_type, sl_bt_gap_1m_phy, &_conn_handle);
+      sc = sl_bt_connection_open(evt->data.evt_scanner_legacy_advertisement_report.address,
+          evt->data.evt_scanner_legacy_advertisement_report.address_type, sl_bt_gap_1m_phy, &_conn_handle);
       app_log("0x%04x = sl_bt_connection_open()\r\n", (uint16_t ) sc);
       // Success ?
       if (SL_STATUS_OK == sc)
@@ -168,11 +235,29 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // This event indicates a connection has been opened.
     //
     app_log("sl_bt_on_event(sl_bt_evt_connection_opened_id)\r\n");
-    // Set state
-    sc = app_set_state(APP_STATE_SERVICE);
-    // Discover services
-    sc = sl_bt_gatt_discover_primary_services_by_uuid(_conn_handle, 16, serviceUUID);
-    app_log("0x%04x = sl_bt_gatt_discover_primary_services_by_uuid()\r\n", (uint16_t ) sc);
+    // Reconnected to the known peer ?
+    if (peer.valid
+        && peer.address_type == evt->data.evt_connection_opened.address_type
+        && memcmp(&peer.address, &evt->data.evt_connection_opened.address, sizeof(bd_addr)) == 0)
+    {
+      // Reuse the handles instead of discovering them again
+      _service_handle = peer.service_handle;
+      _char_handle = peer.char_handle;
+      _write_no_response = peer.write_no_response;
+      sc = app_set_state(APP_STATE_CONNECTED);
+    }
+    else
+    {
+      // Note peer, it becomes known once its handles are discovered
+      peer.valid = false;
+      peer.address = evt->data.evt_connection_opened.address;
+      peer.address_type = evt->data.evt_connection_opened.address_type;
+      // Set state
+      sc = app_set_state(APP_STATE_SERVICE);
+      // Discover services
+      sc = sl_bt_gatt_discover_primary_services_by_uuid(_conn_handle, 16, serviceUUID);
+      app_log("0x%04x = sl_bt_gatt_discover_primary_services_by_uuid()\r\n", (uint16_t ) sc);
+    }
     break;
 
   case sl_bt_evt_gatt_service_id:
@@ -205,6 +290,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
         app_log("sl_bt_on_event(sl_bt_evt_gatt_characteristic_id)\r\n");
         // Save handle
         _char_handle = evt->data.evt_gatt_characteristic.characteristic;
+        // Property 0x04 = Write Without Response
+        _write_no_response = (evt->data.evt_gatt_characteristic.properties & 0x04) != 0;
       }
     }
     break;
@@ -242,6 +329,11 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       // Found characteristic handle ?
       if (_char_handle > 0)
       {
+        // Remember handles for reconnecting
+        peer.service_handle = _service_handle;
+        peer.char_handle = _char_handle;
+        peer.write_no_response = _write_no_response;
+        peer.valid = true;
         // Next state
         sc = app_set_state(APP_STATE_CONNECTED);
       }
@@ -256,11 +348,23 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       break;
 
     case APP_STATE_OFF:
-      app_log("sl_bt_on_event(sl_bt_evt_gatt_procedure_completed_id)\r\n");
-      break;
-
     case APP_STATE_ON:
       app_log("sl_bt_on_event(sl_bt_evt_gatt_procedure_completed_id)\r\n");
+      // Write complete
+      tx.in_flight = false;
+      // Remembered handle no longer valid ?
+      if (evt->data.evt_gatt_procedure_completed.result == SL_STATUS_BT_ATT_INVALID_HANDLE)
+      {
+        // Forget peer and disconnect to discover it again
+        peer.valid = false;
+        sc = sl_bt_connection_close(_conn_handle);
+        app_log("0x%04x = sl_bt_connection_close()\r\n", (uint16_t ) sc);
+      }
+      else
+      {
+        // Send the next value
+        gatt_queue_process();
+      }
       break;
 
     default:
@@ -277,12 +381,18 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     _conn_handle = 0xFF;
     _service_handle = 0;
     _char_handle = 0;
+    _write_no_response = false;
+    // Reset write queue
+    if (tx.pending)
+    {
+      tx.pending = false;
+      tx.dropped++;
+    }
+    tx.in_flight = false;
     // Set state
     sc = app_set_state(APP_STATE_SCAN);
     // Start scanning
-    sc = sl_bt_scanner_set_parameters(sl_bt_scanner_scan_mode_active, 32, 32);
-    sc = sl_bt_scanner_start(sl_bt_gap_1m_phy, sl_bt_scanner_discover_generic);
-    app_log("0x%04x = sl_bt_scanner_start()\r\n", (uint16_t ) sc);
+    scan_start();
     break;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -296,6 +406,57 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
   }
 }
 
+/**************************************************************************//**
+ * Start scanning.
+ *
+ * Searches for AD_NAME with active scanning or, once a peer is known, for its
+ * address with passive scanning.
+ *****************************************************************************/
+static void scan_start(void)
+{
+  sl_status_t sc;
+
+  // Clear scan filter
+  scan_filter_clear();
+  reconnect_ticks = 0;
+  // Known peer ?
+  if (peer.valid)
+  {
+    // Names are in scan responses, the address is in every advertisement
+    sc = sl_bt_scanner_set_parameters(sl_bt_scanner_scan_mode_passive,
+        RECONNECT_SCAN_INTERVAL, RECONNECT_SCAN_WINDOW);
+  }
+  else
+  {
+    sc = sl_bt_scanner_set_parameters(sl_bt_scanner_scan_mode_active,
+        SCAN_INTERVAL, SCAN_WINDOW);
+  }
+  sc = sl_bt_scanner_start(sl_bt_gap_1m_phy, sl_bt_scanner_discover_generic);
+  app_log("0x%04x = sl_bt_scanner_start(%s)\r\n", (uint16_t ) sc, peer.valid ? "passive" : "active");
+}
+
+/**************************************************************************//**
+ * Scan loop processing.
+ *****************************************************************************/
+static void scan_loop(void)
+{
+  sl_status_t sc;
+
+  // Known peer not seen for a while ?
+  if (reconnect_ticks >= RECONNECT_SCAN_TICKS)
+  {
+    reconnect_ticks = 0;
+    if (APP_STATE_SCAN == state && peer.valid)
+    {
+      // Forget it and search by name again
+      peer.valid = false;
+      sc = sl_bt_scanner_stop();
+      app_log("0x%04x = sl_bt_scanner_stop()\r\n", (uint16_t ) sc);
+      scan_start();
+    }
+  }
+}
+
 /**************************************************************************//**
  * Scan response event handler.
  *
@@ -304,42 +465,53 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
  *****************************************************************************/
 static bool process_scan_response(sl_bt_evt_scanner_legacy_advertisement_report_t *pResp)
 {
+  const uint8_t *data = pResp->data.data;
+  uint8_t len = pResp->data.len;
   uint8_t i = 0, ad_len, ad_type;
-  bool ad_name_found = false;
-  char ad_name[32];
 
+  // Known peer ? Only its address matters
+  if (peer.valid)
+  {
+    return (pResp->address_type == peer.address_type)
+           && (memcmp(&pResp->address, &peer.address, sizeof(bd_addr)) == 0);
+  }
+  // Address already seen with another name ?
+  if (scan_filter_test(&pResp->address))
+  {
+    return false;
+  }
   // Loop through advertising packets
-  while (i < (pResp->data.len - 1))
+  while (i + 1 < len)
   {
     // Extract length and type
-    ad_len = pResp->data.data[i];
-    ad_type = pResp->data.data[i + 1];
+    ad_len = data[i];
+    ad_type = data[i + 1];
+    // Padding or malformed record ?
+    if (ad_len == 0 || i + 1 + ad_len > len)
+    {
+      break;
+    }
     // Type 0x08 = Shortened Local Name
     // Type 0x09 = Complete Local Name
     if (ad_type == 0x08 || ad_type == 0x09)
     {
-      // Copy name
-      memcpy(ad_name, &(pResp->data.data[i + 2]), ad_len - 1);
-      ad_name[ad_len - 1] = 0;
-      // Name matches ?
-      if (strcmp(AD_NAME, ad_name) == 0)
+      // Name matches ? Compare in place, the length rejects most names
+      if (ad_len - 1 == AD_NAME_LEN && memcmp(AD_NAME, &data[i + 2], AD_NAME_LEN) == 0)
       {
-        // Note we found the name we were looking for
-        ad_name_found = true;
-        // Log
-        //app_log(
-        //		"process_scan_response(%02x:%02x:%02x:%02x:%02x:%02x, %d, \"%s\")\r\n",
-        //		pResp->address.addr[0], pResp->address.addr[1],
-        //		pResp->address.addr[2], pResp->address.addr[3],
-        //		pResp->address.addr[4], pResp->address.addr[5],
-        //		pResp->rssi, ad_name);
+        return true;
+      }
+      // Another device's complete name ? Don't parse this device again
+      if (ad_type == 0x09)
+      {
+        scan_filter_add(&pResp->address);
+        return false;
       }
     }
     // Jump to next AD record
     i = i + ad_len + 1;
   }
 
-  return ad_name_found;
+  return false;
 }
 
 /**************************************************************************//**
@@ -352,6 +524,16 @@ static void app_tick_timer_cb(sl_sleeptimer_timer_handle_t *handle, void *data)
 
   // Increment counter
   tick_counter++;
+  // Count time scanning for known peer
+  if (APP_STATE_SCAN == state && peer.valid && reconnect_ticks < RECONNECT_SCAN_TICKS)
+  {
+    reconnect_ticks++;
+  }
+  // Count age of scan filter while searching by name
+  if (APP_STATE_SCAN == state && !peer.valid)
+  {
+    scan_filter_tick();
+  }
   // Which state ?
   switch (state)
   {
@@ -485,33 +667,97 @@ sl_status_t app_set_state(uint8_t new_state)
   // OK to change state ?
   if (SL_STATUS_OK == sc)
   {
-    sl_status_t sc_tx = SL_STATUS_FAIL;
-    uint8_t data;
-
     // Note new state
     state = new_state;
-    app_log("0x%04x = app_set_state(%s)\r\n", (uint16_t ) sc, app_states[state]);
-    // Moved to on state ?
-    if (APP_STATE_ON == state)
-    {
-      // Transmit data
-      data = 1;
-      sc_tx = sl_bt_gatt_write_characteristic_value(_conn_handle, _char_handle, 1, &data);
-      app_log("0x%04x = sl_bt_gatt_write_characteristic_value(%d)\r\n", (uint16_t ) sc_tx, data);
-    }
-    // Moved to off state ?
-    else if (APP_STATE_OFF == state)
+    // Moved to on or off state ?
+    if (APP_STATE_ON == state || APP_STATE_OFF == state)
     {
-      // Transmit data
-      data = 0;
-      sc_tx = sl_bt_gatt_write_characteristic_value(_conn_handle, _char_handle, 1, &data);
-      app_log("0x%04x = sl_bt_gatt_write_characteristic_value(%d)\r\n", (uint16_t ) sc_tx, data);
+      // Queue data, transmitting it now if possible
+      gatt_queue_write((APP_STATE_ON == state) ? 1 : 0);
     }
+    app_log("0x%04x = app_set_state(%s)\r\n", (uint16_t ) sc, app_states[state]);
+  }
+  // Rejected on or off ?
+  else if (APP_STATE_ON == new_state || APP_STATE_OFF == new_state)
+  {
+    tx.dropped++;
   }
 
   return sc;
 }
 
+/**************************************************************************//**
+ * Queue a value to be written to the light.
+ *
+ * A new value replaces any value still waiting to be written, so a burst of
+ * gestures and button presses costs at most one write after the write in
+ * flight. Every new value is written even if it matches the last value sent,
+ * the light may have been switched since by another device.
+ *****************************************************************************/
+static void gatt_queue_write(uint8_t value)
+{
+  tx.queued++;
+  // Replace value still waiting to be written
+  if (tx.pending)
+  {
+    tx.coalesced++;
+  }
+  tx.value = value;
+  tx.pending = true;
+  gatt_queue_process();
+}
+
+/**************************************************************************//**
+ * Write the pending value to the light.
+ *
+ * Uses write without response when the characteristic allows it, these are
+ * buffered by the stack and go out in the next connection event. Otherwise
+ * uses an acknowledged write and sends the pending value when the previous
+ * write's procedure completes.
+ *****************************************************************************/
+static void gatt_queue_process(void)
+{
+  sl_status_t sc;
+  uint16_t sent_len;
+
+  // Nothing to write, not connected or waiting for an acknowledgement ?
+  if (!tx.pending || state < APP_STATE_CONNECTED || tx.in_flight)
+  {
+    return;
+  }
+  if (_write_no_response)
+  {
+    sc = sl_bt_gatt_write_characteristic_value_without_response(_conn_handle,
+        _char_handle, 1, &tx.value, &sent_len);
+  }
+  else
+  {
+    sc = sl_bt_gatt_write_characteristic_value(_conn_handle, _char_handle, 1, &tx.value);
+  }
+  // Stack buffers full or a procedure still running ? Retry from the loop
+  if (SL_STATUS_NO_MORE_RESOURCE == sc || SL_STATUS_INVALID_STATE == sc)
+  {
+    return;
+  }
+  tx.pending = false;
+  if (SL_STATUS_OK == sc)
+  {
+    tx.in_flight = !_write_no_response;
+    tx.sent++;
+  }
+  else
+  {
+    tx.dropped++;
+  }
+  // Log after transmitting so UART output doesn't delay the write
+  app_log("0x%04x = %s(%d) queued=%lu coalesced=%lu sent=%lu dropped=%lu\r\n",
+          (uint16_t ) sc,
+          _write_no_response ? "sl_bt_gatt_write_characteristic_value_without_response"
+                             : "sl_bt_gatt_write_characteristic_value",
+          tx.value, (unsigned long) tx.queued, (unsigned long) tx.coalesced,
+          (unsigned long) tx.sent, (unsigned long) tx.dropped);
+}
+
 /**************************************************************************//**
  * Application get state
  *****************************************************************************/
@@ -23,6 +23,24 @@
 
 // Bluetooth device name to connect to
 #define AD_NAME    "Blinky Example"
+#define AD_NAME_LEN  (sizeof(AD_NAME) - 1)
+
+// Scan interval and window in 0.625 ms units when searching for AD_NAME
+#define SCAN_INTERVAL           32
+#define SCAN_WINDOW             32
+
+// Scan interval and window in 0.625 ms units when reconnecting to a known peer
+#define RECONNECT_SCAN_INTERVAL 160
+#define RECONNECT_SCAN_WINDOW    48
+
+// Forget the known peer and search by name again if it is not seen for this
+// many tick timer periods
+#define RECONNECT_SCAN_TICKS    100
+
+// Clear the scan filter this many tick timer periods into a search by name, so
+// an address that was filtered gets parsed again, for example when the light
+// is renamed to AD_NAME or a false positive hides it
+#define SCAN_FILTER_RESET_TICKS  20
 
 // Application states
 #define APP_STATE_NONE           0
@@ -37,12 +55,39 @@
 #define ACCELEROMETER_FREQ      25
 #define ACCELEROMETER_CHANNELS   3
 
+// The rate the accelerometer is sampled at, samples are resampled to
+// ACCELEROMETER_FREQ for the model. Can be changed at runtime within the range.
+#define ACCELEROMETER_CAPTURE_FREQ  ACCELEROMETER_FREQ
+#define ACCELEROMETER_FREQ_MIN     10
+#define ACCELEROMETER_FREQ_MAX    200
+
+// Set to 1 to batch samples in the IMU FIFO and read them in one burst when
+// the watermark is reached instead of taking an interrupt for every sample
+#define ACCELEROMETER_FIFO              0
+#define ACCELEROMETER_FIFO_WATERMARK    5
+
+// The capture rate drops to ACCELEROMETER_IDLE_FREQ once the wand has been
+// still for ACCELEROMETER_IDLE_STRIDES inference strides, and goes back to
+// ACCELEROMETER_CAPTURE_FREQ as soon as a stride has a change between samples
+// above ACCELEROMETER_MOTION_MG. Off by default, samples captured below
+// ACCELEROMETER_FREQ are interpolated which smears the start of a gesture and
+// changing the rate reconfigures the sensor. Set ACCELEROMETER_IDLE_FREQ to
+// ACCELEROMETER_FREQ_MIN to save power while the wand is still.
+#define ACCELEROMETER_IDLE_FREQ         ACCELEROMETER_CAPTURE_FREQ
+#define ACCELEROMETER_IDLE_STRIDES     25
+#define ACCELEROMETER_MOTION_MG        60
+
 // LEDs are active for this amount of time before they are turned off
 #define TOGGLE_DELAY_MS       2000
 
-// Inference it triggered by a periodic timer, this configuration is the time
-// between each trigger
-#define INFERENCE_PERIOD_MS    200
+// Inference is triggered by the accelerometer interrupt when this many new
+// samples have arrived, 5 samples at 25 Hz is an inference every 200 ms
+#define INFERENCE_STRIDE         5
+
+// Set to 1 to measure the cycles spent in each stage of the inference pipeline,
+// a histogram of each stage is printed after PROFILER_REPORT_COUNT inferences
+#define PROFILING                0
+#define PROFILER_REPORT_COUNT  100
 
 // Length of the accelerator input sequence expected by the model
 #define SEQUENCE_LENGTH         90
@@ -63,4 +108,17 @@
 #define PREDICTION_HISTORY_LEN   5
 #define PREDICTION_SUPPRESSION  18
 
+// How the model output is smoothed over time before a prediction is made
+#define PREDICTION_SMOOTHING_AVERAGE   0   // Average of the last predictions
+#define PREDICTION_SMOOTHING_EMA       1   // Exponential moving average
+#define PREDICTION_SMOOTHING_MEDIAN    2   // Median of the last predictions
+#define PREDICTION_SMOOTHING     PREDICTION_SMOOTHING_AVERAGE
+
+// Weight of the latest prediction when using the exponential moving average
+#define PREDICTION_EMA_ALPHA      0.4f
+
+// The running sums used for averaging are recalculated from the history after
+// this many predictions to stop float rounding errors from accumulating
+#define PREDICTION_RENORMALISE   64
+
 #endif // CONSTANTS_H
@@ -0,0 +1,158 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sliding window feeding accelerometer data to the model input
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include "feeder.h"
+#include "constants.h"
+#include <cstdint>
+#include <cstring>
+
+// Number of values in the window
+#define WINDOW_VALUES  (SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS)
+
+// Fractional bits of the fixed point quantization multiplier
+#define QUANT_SHIFT    16
+
+// Converted samples, every sample is stored twice SEQUENCE_LENGTH apart so the
+// latest SEQUENCE_LENGTH samples are always contiguous starting at window_pos.
+static union {
+  float f[2 * WINDOW_VALUES];
+  int16_t i16[2 * WINDOW_VALUES];
+  int8_t i8[2 * WINDOW_VALUES];
+} window;
+
+// Position of the oldest sample in the window
+static int window_pos = 0;
+
+// Number of accelerometer samples converted so far
+static uint32_t fed_count = 0;
+
+// Format of the window and its quantization parameters
+static feeder_format_t window_format = FEEDER_FORMAT_FLOAT;
+static int32_t quant_multiplier = 1 << QUANT_SHIFT;
+static int32_t quant_zero_point = 0;
+
+// Quantize a raw sample, saturating to the element range
+static inline int32_t feeder_quantize(int16_t value, int32_t min, int32_t max)
+{
+  int32_t q = (int32_t)((((int64_t)value * quant_multiplier) + (1 << (QUANT_SHIFT - 1))) >> QUANT_SHIFT);
+  q += quant_zero_point;
+  if (q < min) {
+    return min;
+  }
+  if (q > max) {
+    return max;
+  }
+  return q;
+}
+
+// Append one sample to the window
+static void feeder_push(const imu_data_t* src)
+{
+  int i = window_pos * ACCELEROMETER_CHANNELS;
+  int j = i + WINDOW_VALUES;
+
+  switch (window_format) {
+    case FEEDER_FORMAT_INT8:
+      window.i8[i] = window.i8[j] = (int8_t)feeder_quantize(src->x, INT8_MIN, INT8_MAX);
+      window.i8[i + 1] = window.i8[j + 1] = (int8_t)feeder_quantize(src->y, INT8_MIN, INT8_MAX);
+      window.i8[i + 2] = window.i8[j + 2] = (int8_t)feeder_quantize(src->z, INT8_MIN, INT8_MAX);
+      break;
+    case FEEDER_FORMAT_INT16:
+      window.i16[i] = window.i16[j] = (int16_t)feeder_quantize(src->x, INT16_MIN, INT16_MAX);
+      window.i16[i + 1] = window.i16[j + 1] = (int16_t)feeder_quantize(src->y, INT16_MIN, INT16_MAX);
+      window.i16[i + 2] = window.i16[j + 2] = (int16_t)feeder_quantize(src->z, INT16_MIN, INT16_MAX);
+      break;
+    case FEEDER_FORMAT_FLOAT:
+    default:
+      window.f[i] = window.f[j] = src->x;
+      window.f[i + 1] = window.f[j + 1] = src->y;
+      window.f[i + 2] = window.f[j + 2] = src->z;
+      break;
+  }
+
+  ++window_pos;
+  if (window_pos >= SEQUENCE_LENGTH) {
+    window_pos = 0;
+  }
+}
+
+sl_status_t feeder_init(feeder_format_t format, float scale, int32_t zero_point)
+{
+  if (format != FEEDER_FORMAT_FLOAT) {
+    // The multiplier must fit the fixed point range
+    if (!(scale > 0.0f) || ((1.0f / scale) >= (float)(INT32_MAX >> QUANT_SHIFT))) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    quant_multiplier = (int32_t)(((float)(1 << QUANT_SHIFT) / scale) + 0.5f);
+    quant_zero_point = zero_point;
+  }
+  window_format = format;
+
+  // Convert a full window with the new format on the next update
+  window_pos = 0;
+  fed_count = 0;
+  return SL_STATUS_OK;
+}
+
+sl_status_t feeder_update(void)
+{
+  acc_window_t src;
+  sl_status_t status = accelerometer_acquire(&src, SEQUENCE_LENGTH);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // Only the samples that arrived since last time need converting, if more
+  // than a window has arrived the oldest are skipped
+  uint32_t n = src.end - fed_count;
+  if (n > SEQUENCE_LENGTH) {
+    n = SEQUENCE_LENGTH;
+  }
+  int skip = SEQUENCE_LENGTH - (int)n;
+
+  for (int i = skip; i < src.first_len; i++) {
+    feeder_push(&src.first[i]);
+  }
+  skip -= src.first_len;
+  if (skip < 0) {
+    skip = 0;
+  }
+  for (int i = skip; i < src.second_len; i++) {
+    feeder_push(&src.second[i]);
+  }
+
+  fed_count = src.end;
+  accelerometer_release();
+  return SL_STATUS_OK;
+}
+
+void feeder_write(void* dst)
+{
+  int i = window_pos * ACCELEROMETER_CHANNELS;
+
+  switch (window_format) {
+    case FEEDER_FORMAT_INT8:
+      memcpy(dst, &window.i8[i], WINDOW_VALUES * sizeof(int8_t));
+      break;
+    case FEEDER_FORMAT_INT16:
+      memcpy(dst, &window.i16[i], WINDOW_VALUES * sizeof(int16_t));
+      break;
+    case FEEDER_FORMAT_FLOAT:
+    default:
+      memcpy(dst, &window.f[i], WINDOW_VALUES * sizeof(float));
+      break;
+  }
+}
@@ -0,0 +1,74 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sliding window feeding accelerometer data to the model input
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#ifndef FEEDER_H
+#define FEEDER_H
+
+#include "accelerometer.h"
+#include "sl_status.h"
+#include <stdint.h>
+
+// Element type of the model input
+typedef enum feeder_format {
+  FEEDER_FORMAT_FLOAT,
+  FEEDER_FORMAT_INT8,
+  FEEDER_FORMAT_INT16
+} feeder_format_t;
+
+/***************************************************************************//**
+ * @brief
+ *   Set the format samples are converted to for the model input.
+ *
+ * @details
+ *   Quantized formats convert the raw accelerometer samples with
+ *   q = round(sample / scale) + zero_point, saturated to the element range.
+ *
+ * @param format
+ *   Element type of the model input.
+ *
+ * @param scale
+ *   Quantization scale, ignored for FEEDER_FORMAT_FLOAT.
+ *
+ * @param zero_point
+ *   Quantization zero point, ignored for FEEDER_FORMAT_FLOAT.
+ *
+ * @return
+ *   SL_STATUS_OK on success, SL_STATUS_INVALID_PARAMETER if the
+ *   quantization parameters can't be used.
+ ******************************************************************************/
+sl_status_t feeder_init(feeder_format_t format, float scale, int32_t zero_point);
+
+/***************************************************************************//**
+ * @brief
+ *   Convert accelerometer samples that arrived since the last call into the
+ *   resident model input window.
+ *
+ * @return
+ *   SL_STATUS_OK on success, SL_STATUS_FAIL if the accelerometer buffer has
+ *   not been filled yet.
+ ******************************************************************************/
+sl_status_t feeder_update(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Write the latest SEQUENCE_LENGTH samples into the model input buffer.
+ *
+ * @param dst
+ *   Machine learning model input buffer, in the format set by feeder_init().
+ ******************************************************************************/
+void feeder_write(void* dst);
+
+#endif // FEEDER_H
@@ -17,27 +17,20 @@
 #include "magic_wand.h"
 #include "accelerometer.h"
 #include "constants.h"
+#include "feeder.h"
 #include "predictor.h"
+#include "profiler.h"
 #include "sl_tflite_micro_model.h"
 #include "sl_tflite_micro_init.h"
 #include "sl_sleeptimer.h"
 #include "sl_status.h"
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 
-static int input_length;
-static volatile bool inference_timeout;
-static sl_sleeptimer_timer_handle_t inference_timer;
 static TfLiteTensor* model_input;
 static tflite::MicroInterpreter* interpreter;
 
-// Triggered by the inference_timer
-static void on_timeout_inference(sl_sleeptimer_timer_handle_t *handle, void* data)
-{
-  (void)handle; // unused
-  (void)data; // unused
-  inference_timeout = true;
-}
-
 void magic_wand_init(void)
 {
   printf("Magic Wand\n");
@@ -47,14 +40,45 @@ void magic_wand_init(void)
   interpreter = sl_tflite_micro_get_interpreter();
   if ((model_input->dims->size != 4) || (model_input->dims->data[0] != 1)
       || (model_input->dims->data[1] != SEQUENCE_LENGTH)
-      || (model_input->dims->data[2] != ACCELEROMETER_CHANNELS)
-      || (model_input->type != kTfLiteFloat32)) {
+      || (model_input->dims->data[2] != ACCELEROMETER_CHANNELS)) {
     printf("error: bad input tensor parameters in model\n");
     EFM_ASSERT(false);
     return;
   }
 
-  input_length = model_input->bytes / sizeof(float);
+  // Float and quantized models are supported, quantized inputs are written
+  // straight from the raw accelerometer samples
+  feeder_format_t format;
+  if (model_input->type == kTfLiteFloat32) {
+    format = FEEDER_FORMAT_FLOAT;
+  } else if (model_input->type == kTfLiteInt8) {
+    format = FEEDER_FORMAT_INT8;
+  } else if (model_input->type == kTfLiteInt16) {
+    format = FEEDER_FORMAT_INT16;
+  } else {
+    printf("error: unsupported input tensor type in model\n");
+    EFM_ASSERT(false);
+    return;
+  }
+  if (feeder_init(format, model_input->params.scale, model_input->params.zero_point) != SL_STATUS_OK) {
+    printf("error: bad input tensor quantization in model\n");
+    EFM_ASSERT(false);
+    return;
+  }
+
+  TfLiteTensor* model_output = interpreter->output(0);
+  if ((model_output->type != kTfLiteFloat32)
+      && (model_output->type != kTfLiteInt8)
+      && (model_output->type != kTfLiteInt16)) {
+    printf("error: unsupported output tensor type in model\n");
+    EFM_ASSERT(false);
+    return;
+  }
+
+  profiler_init();
+
+  // Inference is triggered by strides of new accelerometer samples
+  accelerometer_set_stride(INFERENCE_STRIDE);
 
   sl_status_t setup_status = accelerometer_setup();
 
@@ -64,68 +88,227 @@ void magic_wand_init(void)
     return;
   }
 
-  // Waiting for accelerometer to become ready
-  while (true) {
-    sl_status_t status = accelerometer_read(NULL, 0);
-    if (status == SL_STATUS_OK) {
-      break;
+  // The first stride is flagged once the accelerometer buffer has been filled
+  printf("ready\n");
+}
+
+
+// Get the model output as scores, dequantizing quantized outputs.
+static const model_output_t *read_output(const TfLiteTensor *tensor)
+{
+  static model_output_t dequantized;
+  const float scale = tensor->params.scale;
+  const int32_t zero_point = tensor->params.zero_point;
+
+  if (tensor->type == kTfLiteInt8) {
+    for (int i = 0; i < GESTURE_COUNT; i++) {
+      dequantized.gesture[i] = (tensor->data.int8[i] - zero_point) * scale;
+    }
+    return &dequantized;
+  } else if (tensor->type == kTfLiteInt16) {
+    for (int i = 0; i < GESTURE_COUNT; i++) {
+      dequantized.gesture[i] = (tensor->data.i16[i] - zero_point) * scale;
     }
+    return &dequantized;
   }
+  return (const model_output_t *)tensor->data.f;
+}
 
-  inference_timeout = false;
-  sl_sleeptimer_start_periodic_timer_ms(&inference_timer, INFERENCE_PERIOD_MS, on_timeout_inference, NULL, 0, 0);
-  printf("ready\n");
+// Action taken when a gesture is detected, indexed by gesture id
+typedef struct gesture_action {
+  const char *name;   // Name for the log
+  char symbol;        // Symbol drawn for the log
+  uint8_t app_state;  // State requested from the application, written to the
+                      // light over GATT, APP_STATE_NONE for no change
+} gesture_action_t;
+
+static constexpr gesture_action_t gesture_actions[GESTURE_COUNT] = {
+  { "wing",  'W', APP_STATE_NONE },  // WING_GESTURE
+  { "ring",  'O', APP_STATE_OFF },   // RING_GESTURE
+  { "slope", 'L', APP_STATE_ON },    // SLOPE_GESTURE
+  { NULL,    ' ', APP_STATE_NONE },  // NO_GESTURE
+};
+
+static_assert(gesture_actions[WING_GESTURE].symbol == 'W', "gesture_actions out of order");
+static_assert(gesture_actions[RING_GESTURE].symbol == 'O', "gesture_actions out of order");
+static_assert(gesture_actions[SLOPE_GESTURE].symbol == 'L', "gesture_actions out of order");
+static_assert(gesture_actions[NO_GESTURE].name == NULL, "no gesture must not be logged");
+
+// Events waiting to be logged, the log is written when the main loop has
+// nothing else to do so UART output doesn't delay the action
+#define EVENT_LOG_SIZE  8
+
+typedef enum event_type {
+  EVENT_DETECTION,    // value is the gesture
+  EVENT_RATE,         // value is the new capture rate
+  EVENT_RATE_FAILED   // value is the capture rate that couldn't be set
+} event_type_t;
+
+typedef struct event {
+  uint32_t tick;
+  event_type_t type;
+  int value;
+} event_t;
+
+static event_t event_log[EVENT_LOG_SIZE];
+static uint8_t event_log_head = 0;
+static uint8_t event_log_tail = 0;
+static uint32_t event_log_dropped = 0;
+
+// Queue an event to be logged
+static void event_log_push(event_type_t type, int value)
+{
+  uint8_t next = (event_log_head + 1) % EVENT_LOG_SIZE;
+  if (next == event_log_tail) {
+    event_log_dropped++;
+    return;
+  }
+  event_log[event_log_head].tick = sl_sleeptimer_get_tick_count();
+  event_log[event_log_head].type = type;
+  event_log[event_log_head].value = value;
+  event_log_head = next;
 }
 
+// Print one queued event
+static void event_log_flush(void)
+{
+  if (event_log_tail == event_log_head) {
+    return;
+  }
+  const event_t *entry = &event_log[event_log_tail];
+  unsigned long ms = sl_sleeptimer_tick_to_ms(entry->tick);
+  if (entry->type == EVENT_DETECTION) {
+    const gesture_action_t *action = &gesture_actions[entry->value];
+    printf("t=%lu detection=%s (%c)\n", ms, action->name, action->symbol);
+  } else {
+    printf("t=%lu capture rate %d Hz%s\n", ms, entry->value, (entry->type == EVENT_RATE) ? "" : " failed");
+  }
+  event_log_tail = (event_log_tail + 1) % EVENT_LOG_SIZE;
+
+  if (event_log_dropped > 0) {
+    printf("warning: %lu events not logged\n", (unsigned long)event_log_dropped);
+    event_log_dropped = 0;
+  }
+}
 
-// Prints result and toggle LEDs. (red: wing, yellow: ring, green: slope)
+// Act on the detected gesture, logging is deferred.
 static void handle_output(int gesture)
 {
-  uint32_t ts = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count());
-
-  if (gesture == WING_GESTURE) {
-    printf("t=%lu detection=wing (W)\n", ts);
-  } else if (gesture == RING_GESTURE) {
-    printf("t=%lu detection=ring (O)\n", ts);
-    // Attempt application state change
-    app_set_state(APP_STATE_OFF);
-  } else if (gesture == SLOPE_GESTURE) {
-    printf("t=%lu detection=slope (L)\n", ts);
-    // Attempt application state change
-    app_set_state(APP_STATE_ON);
-  } else if (gesture == NO_GESTURE) {
-    // No spell detected
+  if ((gesture < 0) || (gesture >= GESTURE_COUNT)) {
+    return;
+  }
+  const gesture_action_t *action = &gesture_actions[gesture];
+
+  // Attempt application state change
+  if (action->app_state != APP_STATE_NONE) {
+    app_set_state(action->app_state);
+  }
+  if (action->name != NULL) {
+    event_log_push(EVENT_DETECTION, gesture);
+  }
+}
+
+// Capture rate is picked for the latest stride when the main loop is idle
+static bool rate_pending = false;
+
+// Strides in a row without motion
+static int still_strides = 0;
+
+// Largest change in any axis between two samples
+static int sample_change(const imu_data_t *a, const imu_data_t *b)
+{
+  int change = abs(a->x - b->x);
+  change = (abs(a->y - b->y) > change) ? abs(a->y - b->y) : change;
+  change = (abs(a->z - b->z) > change) ? abs(a->z - b->z) : change;
+  return change;
+}
+
+// Pick the capture rate from the motion in the latest stride, capturing at
+// the idle rate while the wand is still. Changing the rate reconfigures the
+// sensor, so this is kept out of the inference path.
+static void select_rate(void)
+{
+  acc_window_t window;
+  const imu_data_t *previous = NULL;
+  int motion = 0;
+
+  if (accelerometer_acquire(&window, INFERENCE_STRIDE + 1) != SL_STATUS_OK) {
+    return;
+  }
+  for (int i = 0; i < window.first_len; i++) {
+    if (previous != NULL) {
+      motion = std::max(motion, sample_change(previous, &window.first[i]));
+    }
+    previous = &window.first[i];
+  }
+  for (int i = 0; i < window.second_len; i++) {
+    motion = std::max(motion, sample_change(previous, &window.second[i]));
+    previous = &window.second[i];
+  }
+  accelerometer_release();
+
+  if (motion > ACCELEROMETER_MOTION_MG) {
+    still_strides = 0;
+  } else if (still_strides < ACCELEROMETER_IDLE_STRIDES) {
+    still_strides++;
+  }
+  int rate = (still_strides >= ACCELEROMETER_IDLE_STRIDES) ? ACCELEROMETER_IDLE_FREQ : ACCELEROMETER_CAPTURE_FREQ;
+  if (rate != accelerometer_get_rate()) {
+    sl_status_t status = accelerometer_set_rate(rate);
+    event_log_push((status == SL_STATUS_OK) ? EVENT_RATE : EVENT_RATE_FAILED, rate);
   }
 }
 
 void magic_wand_loop(void)
 {
-  // Insert data from accelerometer to the model.
-  acc_data_t *dst = (acc_data_t *) model_input->data.f;
-  size_t n = input_length / 3;
-  sl_status_t status = accelerometer_read(dst, n);
+  // Inference is triggered by the accelerometer after a stride of new samples
+  if (!accelerometer_take_stride()) {
+    // Nothing to infer, pick the capture rate and log
+    if (rate_pending) {
+      rate_pending = false;
+      select_rate();
+    }
+    event_log_flush();
+    return;
+  }
+  rate_pending = (ACCELEROMETER_IDLE_FREQ != ACCELEROMETER_CAPTURE_FREQ);
+
+  profiler_start();
+
+  // Convert the newly arrived accelerometer data
+  sl_status_t status = feeder_update();
 
   // If there was no new data, wait until next time.
   if (status == SL_STATUS_FAIL) {
+    profiler_end();
     return;
   }
 
-  // Inference is triggered periodically by a timer
-  if (inference_timeout) {
-    inference_timeout = false;
+  // Insert data from accelerometer to the model.
+  feeder_write(model_input->data.data);
+  profiler_mark(PROFILER_STAGE_FEED);
 
-    TfLiteStatus invoke_status = interpreter->Invoke();
+  TfLiteStatus invoke_status = interpreter->Invoke();
+  profiler_mark(PROFILER_STAGE_INVOKE);
 
-    if (invoke_status != kTfLiteOk) {
-      printf("error: inference failed\n");
-      return;
-    }
+  if (invoke_status != kTfLiteOk) {
+    printf("error: inference failed\n");
+    profiler_end();
+    return;
+  }
 
-    // Analyze the results to obtain a prediction
-    const model_output_t *output = (const model_output_t *)interpreter->output(0)->data.f;
-    int gesture = predict_gesture(output);
+  // Analyze the results to obtain a prediction
+  const model_output_t *output = read_output(interpreter->output(0));
+  int gesture = predict_gesture(output);
+  profiler_mark(PROFILER_STAGE_PREDICT);
 
-    // Produce an output
-    handle_output(gesture);
-  }
+  // Produce an output
+  handle_output(gesture);
+  profiler_mark(PROFILER_STAGE_OUTPUT);
+  profiler_end();
+}
+
+bool magic_wand_is_ok_to_sleep(void)
+{
+  return !accelerometer_stride_pending() && !rate_pending && (event_log_tail == event_log_head);
 }
@@ -38,6 +38,15 @@ void magic_wand_init(void);
  ******************************************************************************/
 void magic_wand_loop(void);
 
+/***************************************************************************//**
+ * @brief
+ *   Check if the application can sleep.
+ *
+ * @return
+ *   true if no inference is waiting for magic_wand_loop() to run it.
+ ******************************************************************************/
+bool magic_wand_is_ok_to_sleep(void);
+
 // Implemented in app.c
 sl_status_t app_set_state(uint8_t);
 
@@ -16,39 +16,131 @@
  ******************************************************************************/
 #include "predictor.h"
 #include "constants.h"
+#include <cmath>
 #include <cstdio>
 
 // State for the averaging algorithm we're using.
-//static float prediction_history[GESTURE_COUNT][PREDICTION_HISTORY_LEN] = {};
 static model_output_t history[PREDICTION_HISTORY_LEN] = {};
 static int history_index = 0;
 static int suppression_count = 0;
 static int previous_prediction = NO_GESTURE;
 
+#if (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_AVERAGE)
+// Running sum of the history for each gesture
+static float history_sum[GESTURE_COUNT] = {};
+static int renormalise_count = 0;
+
+// Running sums this close to a decision boundary are recalculated from the
+// history so decisions match summing the history directly
+#define PREDICTION_SUM_EPSILON   1e-4f
+
+// Recalculate the running sums from the history
+static void history_renormalise(void)
+{
+  renormalise_count = 0;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    float prediction_sum = 0.0f;
+    for (int j = 0; j < PREDICTION_HISTORY_LEN; ++j) {
+      prediction_sum += history[j].gesture[i];
+    }
+    history_sum[i] = prediction_sum;
+  }
+}
+
+// Check if the running sums are close enough to a decision boundary that
+// rounding errors could change the prediction
+static bool history_near_boundary(void)
+{
+  const float threshold = DETECTION_THRESHOLD * PREDICTION_HISTORY_LEN;
+  float first = history_sum[0];
+  float second = -1.0f;
+
+  for (int i = 1; i < GESTURE_COUNT; i++) {
+    if (history_sum[i] > first) {
+      second = first;
+      first = history_sum[i];
+    } else if (history_sum[i] > second) {
+      second = history_sum[i];
+    }
+  }
+  return ((first - second) < PREDICTION_SUM_EPSILON)
+         || (fabsf(first - threshold) < PREDICTION_SUM_EPSILON);
+}
+#elif (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_EMA)
+// Exponential moving average for each gesture
+static float history_ema[GESTURE_COUNT] = {};
+#endif
+
+#if (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_MEDIAN)
+// Median of the history for one gesture
+static float history_median(int gesture)
+{
+  float sorted[PREDICTION_HISTORY_LEN];
+
+  // Insertion sort, the history is short
+  for (int j = 0; j < PREDICTION_HISTORY_LEN; ++j) {
+    float value = history[j].gesture[gesture];
+    int k = j;
+    while ((k > 0) && (sorted[k - 1] > value)) {
+      sorted[k] = sorted[k - 1];
+      --k;
+    }
+    sorted[k] = value;
+  }
+  if (PREDICTION_HISTORY_LEN & 1) {
+    return sorted[PREDICTION_HISTORY_LEN / 2];
+  }
+  return (sorted[(PREDICTION_HISTORY_LEN / 2) - 1] + sorted[PREDICTION_HISTORY_LEN / 2]) / 2.0f;
+}
+#endif
+
 int predict_gesture(const model_output_t* output)
 {
-  // Record the latest predictions in our rolling history buffer.
+  // Smoothed score for each gesture
+  float score[GESTURE_COUNT];
+
+#if (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_AVERAGE)
+  // Update the running sums with the latest prediction replacing the oldest,
+  // recalculating them from the history every so often to bound drift.
+  ++renormalise_count;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    history_sum[i] += output->gesture[i] - history[history_index].gesture[i];
+  }
+  history[history_index] = *output;
+  if ((renormalise_count >= PREDICTION_RENORMALISE) || history_near_boundary()) {
+    history_renormalise();
+  }
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    score[i] = history_sum[i] / PREDICTION_HISTORY_LEN;
+  }
+#elif (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_EMA)
   history[history_index] = *output;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    history_ema[i] += PREDICTION_EMA_ALPHA * (output->gesture[i] - history_ema[i]);
+    score[i] = history_ema[i];
+  }
+#elif (PREDICTION_SMOOTHING == PREDICTION_SMOOTHING_MEDIAN)
+  history[history_index] = *output;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    score[i] = history_median(i);
+  }
+#else
+#error "Unknown PREDICTION_SMOOTHING"
+#endif
 
   ++history_index;
   if (history_index >= PREDICTION_HISTORY_LEN) {
     history_index = 0;
   }
 
-  // Average the last n predictions for each gesture, and find which has the
-  // highest score.
+  // Find which gesture has the highest smoothed score.
   int max_predict_index = -1;
   float max_predict_score = 0.0f;
 
   for (int i = 0; i < GESTURE_COUNT; i++) {
-    float prediction_sum = 0.0f;
-    for (int j = 0; j < PREDICTION_HISTORY_LEN; ++j) {
-      prediction_sum += history[j].gesture[i];
-    }
-    const float prediction_average = prediction_sum / PREDICTION_HISTORY_LEN;
-    if ((max_predict_index == -1) || (prediction_average > max_predict_score)) {
+    if ((max_predict_index == -1) || (score[i] > max_predict_score)) {
       max_predict_index = i;
-      max_predict_score = prediction_average;
+      max_predict_score = score[i];
     }
   }
 
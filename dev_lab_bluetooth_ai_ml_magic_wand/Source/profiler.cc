@@ -0,0 +1,139 @@
+/***************************************************************************//**
+ * @file
+ * @brief Cycle count profiling of the inference pipeline
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include "profiler.h"
+
+#if PROFILING
+
+#include "accelerometer.h"
+#include "em_device.h"
+#include "sl_sleeptimer.h"
+#include <cstdio>
+
+// Histogram buckets, bucket n counts stages taking less than 2^n cycles
+#define PROFILER_BUCKETS  32
+
+static const char *stage_names[PROFILER_STAGE_COUNT] = {
+  "feed", "invoke", "predict", "output"
+};
+
+static uint32_t histogram[PROFILER_STAGE_COUNT][PROFILER_BUCKETS];
+static uint32_t stage_min[PROFILER_STAGE_COUNT];
+static uint32_t stage_max[PROFILER_STAGE_COUNT];
+static uint64_t stage_total[PROFILER_STAGE_COUNT];
+static uint32_t stage_count[PROFILER_STAGE_COUNT];
+static uint32_t pass_count = 0;
+static uint32_t mark_cycles = 0;
+static bool pass_open = false;
+static uint32_t report_tick = 0;
+
+static void profiler_reset(void)
+{
+  for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+    for (int j = 0; j < PROFILER_BUCKETS; j++) {
+      histogram[i][j] = 0;
+    }
+    stage_min[i] = UINT32_MAX;
+    stage_max[i] = 0;
+    stage_total[i] = 0;
+    stage_count[i] = 0;
+  }
+  pass_count = 0;
+  report_tick = sl_sleeptimer_get_tick_count();
+}
+
+void profiler_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  profiler_reset();
+}
+
+void profiler_start(void)
+{
+  mark_cycles = DWT->CYCCNT;
+  pass_open = true;
+}
+
+void profiler_mark(profiler_stage_t stage)
+{
+  // Only time stages between profiler_start() and profiler_end()
+  if (!pass_open) {
+    return;
+  }
+  uint32_t now = DWT->CYCCNT;
+  uint32_t cycles = now - mark_cycles;
+  mark_cycles = now;
+
+  int bucket = 32 - __CLZ(cycles);
+  if (bucket >= PROFILER_BUCKETS) {
+    bucket = PROFILER_BUCKETS - 1;
+  }
+  histogram[stage][bucket]++;
+  stage_total[stage] += cycles;
+  stage_count[stage]++;
+  if (cycles < stage_min[stage]) {
+    stage_min[stage] = cycles;
+  }
+  if (cycles > stage_max[stage]) {
+    stage_max[stage] = cycles;
+  }
+}
+
+void profiler_end(void)
+{
+  if (!pass_open) {
+    return;
+  }
+  pass_open = false;
+  ++pass_count;
+  if (pass_count < PROFILER_REPORT_COUNT) {
+    return;
+  }
+
+  printf("profile: %lu passes at %lu Hz\n", pass_count, SystemCoreClock);
+  for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+    // Passes that failed part way have no marks for the later stages
+    if (stage_count[i] == 0) {
+      printf("  %s: no passes\n", stage_names[i]);
+      continue;
+    }
+    printf("  %s: %lu passes, min=%lu avg=%lu max=%lu cycles\n", stage_names[i], stage_count[i],
+           stage_min[i], (uint32_t)(stage_total[i] / stage_count[i]), stage_max[i]);
+    for (int j = 0; j < PROFILER_BUCKETS; j++) {
+      if (histogram[i][j] > 0) {
+        printf("    <%lu: %lu\n", 1UL << j, histogram[i][j]);
+      }
+    }
+  }
+
+  // Accelerometer capture load over the same period
+  acc_stats_t stats;
+  accelerometer_get_stats(&stats);
+  uint32_t ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count() - report_tick);
+  if (ms > 0) {
+    printf("  capture: %d Hz, %lu samples/s, %lu interrupts/s, %lu bus calls/s, %lu bus cycles/s\n",
+           accelerometer_get_rate(),
+           (uint32_t)((stats.samples * 1000ULL) / ms),
+           (uint32_t)((stats.interrupts * 1000ULL) / ms),
+           (uint32_t)((stats.bus_calls * 1000ULL) / ms),
+           (uint32_t)((stats.bus_cycles * 1000ULL) / ms));
+  }
+  profiler_reset();
+}
+
+#endif // PROFILING
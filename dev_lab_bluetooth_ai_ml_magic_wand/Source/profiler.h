@@ -0,0 +1,71 @@
+/***************************************************************************//**
+ * @file
+ * @brief Cycle count profiling of the inference pipeline
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2022 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "constants.h"
+
+// Stages of the inference pipeline
+typedef enum profiler_stage {
+  PROFILER_STAGE_FEED,
+  PROFILER_STAGE_INVOKE,
+  PROFILER_STAGE_PREDICT,
+  PROFILER_STAGE_OUTPUT,
+  PROFILER_STAGE_COUNT
+} profiler_stage_t;
+
+#if PROFILING
+
+/***************************************************************************//**
+ * @brief
+ *   Enable the cycle counter.
+ ******************************************************************************/
+void profiler_init(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Start timing a pass through the pipeline.
+ ******************************************************************************/
+void profiler_start(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Record the cycles spent in a stage since the previous mark.
+ *
+ * @param stage
+ *   Stage that has just completed.
+ ******************************************************************************/
+void profiler_mark(profiler_stage_t stage);
+
+/***************************************************************************//**
+ * @brief
+ *   Finish a pass through the pipeline, printing the histograms every
+ *   PROFILER_REPORT_COUNT passes. Must be called on every path out of the
+ *   pipeline after profiler_start(), including early returns on failure.
+ ******************************************************************************/
+void profiler_end(void);
+
+#else
+
+static inline void profiler_init(void) {}
+static inline void profiler_start(void) {}
+static inline void profiler_mark(profiler_stage_t stage) { (void)stage; }
+static inline void profiler_end(void) {}
+
+#endif // PROFILING
+
+#endif // PROFILER_H
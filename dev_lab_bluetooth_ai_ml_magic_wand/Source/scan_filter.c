@@ -0,0 +1,112 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scan filter, addresses not to parse again while scanning.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+// Includes --------------------------------------------------------------------
+#include <string.h>
+#include "constants.h"
+#include "scan_filter.h"
+
+// Local data ------------------------------------------------------------------
+static uint32_t scan_filter[SCAN_FILTER_BITS / 32];
+static uint8_t scan_filter_entries = 0;
+static volatile uint8_t scan_filter_ticks = 0;
+
+/**************************************************************************//**
+ * Scan filter hash of an address.
+ *****************************************************************************/
+static uint32_t scan_filter_hash(const bd_addr *address)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (uint8_t i = 0; i < sizeof(address->addr); i++)
+  {
+    hash ^= address->addr[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**************************************************************************//**
+ * Clear the scan filter.
+ *****************************************************************************/
+void scan_filter_clear(void)
+{
+  memset(scan_filter, 0, sizeof(scan_filter));
+  scan_filter_entries = 0;
+  scan_filter_ticks = 0;
+}
+
+/**************************************************************************//**
+ * Check if an address may be in the scan filter.
+ *****************************************************************************/
+bool scan_filter_test(const bd_addr *address)
+{
+  // Filter old enough to have hidden a renamed or unlucky address ?
+  if (scan_filter_ticks >= SCAN_FILTER_RESET_TICKS)
+  {
+    scan_filter_clear();
+    return false;
+  }
+  uint32_t hash = scan_filter_hash(address);
+  uint8_t bit_a = hash % SCAN_FILTER_BITS;
+  uint8_t bit_b = (hash >> 16) % SCAN_FILTER_BITS;
+
+  return (scan_filter[bit_a / 32] & (1UL << (bit_a % 32)))
+         && (scan_filter[bit_b / 32] & (1UL << (bit_b % 32)));
+}
+
+/**************************************************************************//**
+ * Add an address to the scan filter.
+ *****************************************************************************/
+void scan_filter_add(const bd_addr *address)
+{
+  uint32_t hash = scan_filter_hash(address);
+  uint8_t bit_a = hash % SCAN_FILTER_BITS;
+  uint8_t bit_b = (hash >> 16) % SCAN_FILTER_BITS;
+
+  // Start again before false positives become likely
+  if (scan_filter_entries >= SCAN_FILTER_MAX_ENTRIES)
+  {
+    scan_filter_clear();
+  }
+  scan_filter[bit_a / 32] |= (1UL << (bit_a % 32));
+  scan_filter[bit_b / 32] |= (1UL << (bit_b % 32));
+  scan_filter_entries++;
+}
+
+/**************************************************************************//**
+ * Age the scan filter by one tick timer period.
+ *****************************************************************************/
+void scan_filter_tick(void)
+{
+  if (scan_filter_ticks < SCAN_FILTER_RESET_TICKS)
+  {
+    scan_filter_ticks++;
+  }
+}
@@ -0,0 +1,64 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scan filter, addresses not to parse again while scanning.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2020 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef SCAN_FILTER_H
+#define SCAN_FILTER_H
+
+// Includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include "sl_bluetooth.h"
+
+// Bloom filter of addresses advertising a name other than AD_NAME, cleared
+// before false positives become likely
+#define SCAN_FILTER_BITS        256
+#define SCAN_FILTER_MAX_ENTRIES  32
+
+/**************************************************************************//**
+ * Clear the scan filter.
+ *****************************************************************************/
+void scan_filter_clear(void);
+
+/**************************************************************************//**
+ * Check if an address may be in the scan filter.
+ *
+ * Clears the filter and returns false once it is SCAN_FILTER_RESET_TICKS old.
+ *****************************************************************************/
+bool scan_filter_test(const bd_addr *address);
+
+/**************************************************************************//**
+ * Add an address to the scan filter.
+ *****************************************************************************/
+void scan_filter_add(const bd_addr *address);
+
+/**************************************************************************//**
+ * Age the scan filter by one tick timer period, from interrupt context.
+ *****************************************************************************/
+void scan_filter_tick(void);
+
+#endif // SCAN_FILTER_H
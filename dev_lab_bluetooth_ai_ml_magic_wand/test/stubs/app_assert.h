@@ -0,0 +1,9 @@
+// Host test stub of the Gecko SDK application assert component
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include <assert.h>
+
+#define app_assert(expr, ...) assert(expr)
+
+#endif // APP_ASSERT_H
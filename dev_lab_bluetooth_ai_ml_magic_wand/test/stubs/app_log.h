@@ -0,0 +1,11 @@
+// Host test stub of the Gecko SDK application log component, the log is
+// discarded
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+static inline void app_log(const char *format, ...)
+{
+  (void)format;
+}
+
+#endif // APP_LOG_H
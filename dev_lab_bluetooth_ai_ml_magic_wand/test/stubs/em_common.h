@@ -0,0 +1,13 @@
+// Host test stub of the Gecko SDK common definitions
+#ifndef EM_COMMON_H
+#define EM_COMMON_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SL_WEAK __attribute__((weak))
+
+#define EFM_ASSERT(expr) assert(expr)
+
+#endif // EM_COMMON_H
@@ -0,0 +1,23 @@
+// Host test stub of the Gecko SDK core critical sections
+//
+// The "interrupt" is a second thread that takes core_lock() around each call
+// to the interrupt handler, so atomic sections on the main thread keep it out
+// as they would on the device.
+#ifndef EM_CORE_H
+#define EM_CORE_H
+
+#include <mutex>
+
+inline std::recursive_mutex &core_lock()
+{
+  static std::recursive_mutex lock;
+  return lock;
+}
+
+#define CORE_DECLARE_IRQ_STATE  int irqState = 0
+#define CORE_ENTER_ATOMIC()     ((void)irqState, core_lock().lock())
+#define CORE_EXIT_ATOMIC()      core_lock().unlock()
+#define CORE_ENTER_CRITICAL()   CORE_ENTER_ATOMIC()
+#define CORE_EXIT_CRITICAL()    CORE_EXIT_ATOMIC()
+
+#endif // EM_CORE_H
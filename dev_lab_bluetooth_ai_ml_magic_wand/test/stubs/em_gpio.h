@@ -0,0 +1,47 @@
+// Host test stub of the Gecko SDK GPIO driver
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdint.h>
+
+typedef enum {
+  gpioPortA,
+  gpioPortB,
+  gpioPortC,
+  gpioPortD
+} GPIO_Port_TypeDef;
+
+typedef enum {
+  gpioModeInput
+} GPIO_Mode_TypeDef;
+
+inline void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out)
+{
+  (void)port;
+  (void)pin;
+  (void)mode;
+  (void)out;
+}
+
+inline void GPIO_ExtIntConfig(GPIO_Port_TypeDef port, unsigned int pin, unsigned int intNo,
+                              bool risingEdge, bool fallingEdge, bool enable)
+{
+  (void)port;
+  (void)pin;
+  (void)intNo;
+  (void)risingEdge;
+  (void)fallingEdge;
+  (void)enable;
+}
+
+inline void GPIO_IntDisable(uint32_t flags)
+{
+  (void)flags;
+}
+
+inline void GPIO_IntEnable(uint32_t flags)
+{
+  (void)flags;
+}
+
+#endif // EM_GPIO_H
@@ -0,0 +1,25 @@
+// Host test stub of the Gecko SDK GPIO interrupt dispatcher, the registered
+// callback is kept so the test can call it as the interrupt
+#ifndef GPIOINTERRUPT_H
+#define GPIOINTERRUPT_H
+
+#include <stdint.h>
+
+#define INTERRUPT_UNAVAILABLE 0xFF
+
+typedef void (*GPIOINT_IrqCallbackPtrExt_t)(uint8_t intNo, void *ctx);
+
+inline GPIOINT_IrqCallbackPtrExt_t &gpioint_stub_callback()
+{
+  static GPIOINT_IrqCallbackPtrExt_t callback = nullptr;
+  return callback;
+}
+
+inline unsigned int GPIOINT_CallbackRegisterExt(uint8_t pin, GPIOINT_IrqCallbackPtrExt_t callbackPtr, void *callbackCtx)
+{
+  (void)callbackCtx;
+  gpioint_stub_callback() = callbackPtr;
+  return pin;
+}
+
+#endif // GPIOINTERRUPT_H
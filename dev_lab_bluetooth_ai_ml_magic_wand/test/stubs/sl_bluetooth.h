@@ -0,0 +1,129 @@
+// Host test stub of the Gecko SDK Bluetooth API
+//
+// Only the events and commands the application uses. Events are built and
+// passed to sl_bt_on_event() by the test, commands are defined by the test.
+#ifndef SL_BLUETOOTH_H
+#define SL_BLUETOOTH_H
+
+#include "sl_status.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  uint8_t addr[6];
+} bd_addr;
+
+typedef struct {
+  uint8_t len;
+  uint8_t data[31];
+} uint8array;
+
+#define SL_BT_MSG_ID(header) (header)
+
+#define sl_bt_evt_system_boot_id                           0x000000a0
+#define sl_bt_evt_scanner_legacy_advertisement_report_id   0x000500a0
+#define sl_bt_evt_connection_opened_id                     0x000600a0
+#define sl_bt_evt_connection_closed_id                     0x010600a0
+#define sl_bt_evt_gatt_service_id                          0x010900a0
+#define sl_bt_evt_gatt_characteristic_id                   0x020900a0
+#define sl_bt_evt_gatt_procedure_completed_id              0x060900a0
+
+typedef struct {
+  uint8_t event_flags;
+  bd_addr address;
+  uint8_t address_type;
+  int8_t rssi;
+  uint8array data;
+} sl_bt_evt_scanner_legacy_advertisement_report_t;
+
+typedef struct {
+  bd_addr address;
+  uint8_t address_type;
+  uint8_t connection;
+} sl_bt_evt_connection_opened_t;
+
+typedef struct {
+  uint16_t reason;
+  uint8_t connection;
+} sl_bt_evt_connection_closed_t;
+
+typedef struct {
+  uint8_t connection;
+  uint32_t service;
+  uint8array uuid;
+} sl_bt_evt_gatt_service_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t characteristic;
+  uint8_t properties;
+  uint8array uuid;
+} sl_bt_evt_gatt_characteristic_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t result;
+} sl_bt_evt_gatt_procedure_completed_t;
+
+typedef struct {
+  uint32_t header;
+  union {
+    sl_bt_evt_scanner_legacy_advertisement_report_t evt_scanner_legacy_advertisement_report;
+    sl_bt_evt_connection_opened_t evt_connection_opened;
+    sl_bt_evt_connection_closed_t evt_connection_closed;
+    sl_bt_evt_gatt_service_t evt_gatt_service;
+    sl_bt_evt_gatt_characteristic_t evt_gatt_characteristic;
+    sl_bt_evt_gatt_procedure_completed_t evt_gatt_procedure_completed;
+  } data;
+} sl_bt_msg_t;
+
+typedef enum {
+  sl_bt_gap_1m_phy = 0x1
+} sl_bt_gap_phy_t;
+
+typedef enum {
+  sl_bt_scanner_scan_mode_passive = 0x0,
+  sl_bt_scanner_scan_mode_active = 0x1
+} sl_bt_scanner_scan_mode_t;
+
+typedef enum {
+  sl_bt_scanner_discover_generic = 0x2
+} sl_bt_scanner_discover_mode_t;
+
+void sl_bt_on_event(sl_bt_msg_t *evt);
+
+sl_status_t sl_bt_scanner_set_parameters(uint8_t mode, uint16_t interval, uint16_t window);
+
+sl_status_t sl_bt_scanner_start(uint8_t scanning_phy, uint8_t discover_mode);
+
+sl_status_t sl_bt_scanner_stop(void);
+
+sl_status_t sl_bt_connection_open(bd_addr address, uint8_t address_type, uint8_t initiating_phy,
+                                  uint8_t *connection);
+
+sl_status_t sl_bt_connection_close(uint8_t connection);
+
+sl_status_t sl_bt_gatt_discover_primary_services_by_uuid(uint8_t connection, size_t uuid_len,
+                                                         const uint8_t *uuid);
+
+sl_status_t sl_bt_gatt_discover_characteristics(uint8_t connection, uint32_t service);
+
+sl_status_t sl_bt_gatt_write_characteristic_value(uint8_t connection, uint16_t characteristic,
+                                                  size_t value_len, const uint8_t *value);
+
+sl_status_t sl_bt_gatt_write_characteristic_value_without_response(uint8_t connection,
+                                                                   uint16_t characteristic,
+                                                                   size_t value_len,
+                                                                   const uint8_t *value,
+                                                                   uint16_t *sent_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_BLUETOOTH_H
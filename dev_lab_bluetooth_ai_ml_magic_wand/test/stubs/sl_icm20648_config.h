@@ -0,0 +1,8 @@
+// Host test stub of the ICM20648 configuration
+#ifndef SL_ICM20648_CONFIG_H
+#define SL_ICM20648_CONFIG_H
+
+#define SL_ICM20648_INT_PORT gpioPortB
+#define SL_ICM20648_INT_PIN  1
+
+#endif // SL_ICM20648_CONFIG_H
@@ -0,0 +1,42 @@
+// Host test stub of the Gecko SDK IMU driver, returns the acceleration set by
+// the test
+#ifndef SL_IMU_H
+#define SL_IMU_H
+
+#include "sl_status.h"
+#include <stdint.h>
+
+inline int16_t *sl_imu_stub_acceleration()
+{
+  static int16_t acceleration[3];
+  return acceleration;
+}
+
+inline sl_status_t sl_imu_init(void)
+{
+  return SL_STATUS_OK;
+}
+
+inline void sl_imu_configure(float sampleRate)
+{
+  (void)sampleRate;
+}
+
+inline bool sl_imu_is_data_ready(void)
+{
+  return true;
+}
+
+inline void sl_imu_update(void)
+{
+}
+
+inline void sl_imu_get_acceleration(int16_t avec[3])
+{
+  const int16_t *acceleration = sl_imu_stub_acceleration();
+  avec[0] = acceleration[0];
+  avec[1] = acceleration[1];
+  avec[2] = acceleration[2];
+}
+
+#endif // SL_IMU_H
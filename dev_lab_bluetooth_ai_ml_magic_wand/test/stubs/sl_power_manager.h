@@ -0,0 +1,18 @@
+// Host test stub of the Gecko SDK power manager
+#ifndef SL_POWER_MANAGER_H
+#define SL_POWER_MANAGER_H
+
+#include <stdbool.h>
+
+typedef enum {
+  SL_POWER_MANAGER_IGNORE = (1UL << 0UL),
+  SL_POWER_MANAGER_SLEEP = (1UL << 1UL),
+  SL_POWER_MANAGER_WAKEUP = (1UL << 2UL)
+} sl_power_manager_on_isr_exit_t;
+
+// Sleep hooks the application overrides
+bool app_is_ok_to_sleep(void);
+
+sl_power_manager_on_isr_exit_t app_sleep_on_isr_exit(void);
+
+#endif // SL_POWER_MANAGER_H
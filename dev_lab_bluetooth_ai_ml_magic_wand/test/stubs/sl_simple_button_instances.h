@@ -0,0 +1,21 @@
+// Host test stub of the Gecko SDK simple button instances, the buttons are
+// never pressed
+#ifndef SL_SIMPLE_BUTTON_INSTANCES_H
+#define SL_SIMPLE_BUTTON_INSTANCES_H
+
+#include <stdint.h>
+
+typedef struct {
+  int instance;
+} sl_button_t;
+
+static const sl_button_t sl_button_btn0 = { 0 };
+static const sl_button_t sl_button_btn1 = { 1 };
+
+static inline uint8_t sl_button_get_state(const sl_button_t *handle)
+{
+  (void)handle;
+  return 0;
+}
+
+#endif // SL_SIMPLE_BUTTON_INSTANCES_H
@@ -0,0 +1,22 @@
+// Host test stub of the Gecko SDK simple LED instances
+#ifndef SL_SIMPLE_LED_INSTANCES_H
+#define SL_SIMPLE_LED_INSTANCES_H
+
+typedef struct {
+  int instance;
+} sl_led_t;
+
+static const sl_led_t sl_led_led0 = { 0 };
+static const sl_led_t sl_led_led1 = { 1 };
+
+static inline void sl_led_turn_on(const sl_led_t *led)
+{
+  (void)led;
+}
+
+static inline void sl_led_turn_off(const sl_led_t *led)
+{
+  (void)led;
+}
+
+#endif // SL_SIMPLE_LED_INSTANCES_H
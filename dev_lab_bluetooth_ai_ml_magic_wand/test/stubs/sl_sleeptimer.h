@@ -0,0 +1,67 @@
+// Host test stub of the Gecko SDK sleep timer
+//
+// The tick count is a deterministic clock set by the test, so logged times
+// and latencies measured in ticks are the same on every run.
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include "sl_status.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SL_SLEEPTIMER_STUB_FREQUENCY 32768
+
+typedef struct sl_sleeptimer_timer_handle sl_sleeptimer_timer_handle_t;
+
+typedef void (*sl_sleeptimer_timer_callback_t)(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+struct sl_sleeptimer_timer_handle {
+  sl_sleeptimer_timer_callback_t callback;
+  void *data;
+  uint32_t timeout_ms;
+};
+
+// Current tick count, defined and advanced by the test
+extern uint32_t sl_sleeptimer_stub_tick;
+
+// Periodic timer started by the application, defined and fired by the test
+extern sl_sleeptimer_timer_handle_t *sl_sleeptimer_stub_timer;
+
+static inline sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                                uint32_t timeout_ms,
+                                                                sl_sleeptimer_timer_callback_t callback,
+                                                                void *callback_data, uint8_t priority,
+                                                                uint16_t option_flags)
+{
+  (void)priority;
+  (void)option_flags;
+  handle->callback = callback;
+  handle->data = callback_data;
+  handle->timeout_ms = timeout_ms;
+  sl_sleeptimer_stub_timer = handle;
+  return SL_STATUS_OK;
+}
+
+static inline uint32_t sl_sleeptimer_get_tick_count(void)
+{
+  return sl_sleeptimer_stub_tick;
+}
+
+static inline uint32_t sl_sleeptimer_get_timer_frequency(void)
+{
+  return SL_SLEEPTIMER_STUB_FREQUENCY;
+}
+
+static inline uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick)
+{
+  return (uint32_t)(((uint64_t)tick * 1000) / SL_SLEEPTIMER_STUB_FREQUENCY);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_SLEEPTIMER_H
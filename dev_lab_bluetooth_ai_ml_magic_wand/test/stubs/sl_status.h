@@ -0,0 +1,17 @@
+// Host test stub of the Gecko SDK status codes
+#ifndef SL_STATUS_H
+#define SL_STATUS_H
+
+#include <stdint.h>
+
+typedef uint32_t sl_status_t;
+
+#define SL_STATUS_OK                    0x0000
+#define SL_STATUS_FAIL                  0x0001
+#define SL_STATUS_INVALID_STATE         0x0002
+#define SL_STATUS_NOT_READY             0x0003
+#define SL_STATUS_NO_MORE_RESOURCE      0x0019
+#define SL_STATUS_INVALID_PARAMETER     0x0021
+#define SL_STATUS_BT_ATT_INVALID_HANDLE 0x1101
+
+#endif // SL_STATUS_H
@@ -0,0 +1,90 @@
+// Host test stub of the Gecko SDK TensorFlow Lite Micro component
+//
+// TensorFlow Lite Micro is not part of this tree. The stub has the tensor and
+// interpreter types the sources use, and Invoke() runs a model function set by
+// the test on the input and output tensors it provides.
+#ifndef SL_TFLITE_MICRO_INIT_H
+#define SL_TFLITE_MICRO_INIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+  kTfLiteNoType = 0,
+  kTfLiteFloat32 = 1,
+  kTfLiteInt16 = 7,
+  kTfLiteInt8 = 9
+} TfLiteType;
+
+typedef enum {
+  kTfLiteOk = 0,
+  kTfLiteError = 1
+} TfLiteStatus;
+
+typedef struct {
+  int size;
+  int data[4];
+} TfLiteIntArray;
+
+typedef struct {
+  float scale;
+  int32_t zero_point;
+} TfLiteQuantizationParams;
+
+typedef union {
+  int32_t *i32;
+  float *f;
+  int16_t *i16;
+  int8_t *int8;
+  void *data;
+} TfLitePtrUnion;
+
+typedef struct {
+  TfLiteType type;
+  TfLitePtrUnion data;
+  TfLiteIntArray *dims;
+  TfLiteQuantizationParams params;
+} TfLiteTensor;
+
+namespace tflite {
+
+class MicroInterpreter {
+public:
+  typedef TfLiteStatus (*Model)(const TfLiteTensor *input, TfLiteTensor *output);
+
+  MicroInterpreter(Model model, TfLiteTensor *input, TfLiteTensor *output)
+    : model_(model), input_(input), output_(output)
+  {
+  }
+
+  TfLiteStatus Invoke()
+  {
+    return model_(input_, output_);
+  }
+
+  TfLiteTensor *input(size_t index)
+  {
+    (void)index;
+    return input_;
+  }
+
+  TfLiteTensor *output(size_t index)
+  {
+    (void)index;
+    return output_;
+  }
+
+private:
+  Model model_;
+  TfLiteTensor *input_;
+  TfLiteTensor *output_;
+};
+
+} // namespace tflite
+
+// Defined by the test
+TfLiteTensor *sl_tflite_micro_get_input_tensor(void);
+
+tflite::MicroInterpreter *sl_tflite_micro_get_interpreter(void);
+
+#endif // SL_TFLITE_MICRO_INIT_H
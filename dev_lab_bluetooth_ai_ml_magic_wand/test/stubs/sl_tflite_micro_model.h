@@ -0,0 +1,6 @@
+// Host test stub of the Gecko SDK TensorFlow Lite Micro model, the model is
+// supplied by the test through the interpreter stub
+#ifndef SL_TFLITE_MICRO_MODEL_H
+#define SL_TFLITE_MICRO_MODEL_H
+
+#endif // SL_TFLITE_MICRO_MODEL_H
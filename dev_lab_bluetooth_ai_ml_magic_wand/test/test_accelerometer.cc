@@ -0,0 +1,237 @@
+// Host test of the accelerometer sample ring
+//
+// Runs the real accelerometer.cc against stub drivers. The checks cover the
+// window spans, overruns while a window is held and strides, then a stress
+// run drives the interrupt handler from one thread while the main loop
+// thread takes windows, checking every window for torn or overwritten
+// samples. Last the strides flagged over a long run are counted.
+#include "accelerometer.h"
+#include "constants.h"
+#include "em_core.h"
+#include "gpiointerrupt.h"
+#include "sl_imu.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#define STRESS_SAMPLES 500000
+
+static int failures = 0;
+
+#define CHECK(condition)                                             \
+  do {                                                               \
+    if (!(condition)) {                                              \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);    \
+      failures++;                                                    \
+    }                                                                \
+  } while (0)
+
+// Sample carrying a sequence number and a check value, any mix of two
+// samples fails the check
+static imu_data_t sample_encode(uint32_t seq)
+{
+  imu_data_t sample;
+  sample.x = (int16_t)(seq & 0x3FFF);
+  sample.y = (int16_t)((seq >> 14) & 0x3FFF);
+  sample.z = (int16_t)((sample.x * 7 + sample.y * 13) & 0x3FFF);
+  return sample;
+}
+
+static bool sample_valid(const imu_data_t *sample)
+{
+  return sample->z == (int16_t)((sample->x * 7 + sample->y * 13) & 0x3FFF);
+}
+
+static uint32_t sample_seq(const imu_data_t *sample)
+{
+  return (uint32_t)sample->x | ((uint32_t)sample->y << 14);
+}
+
+// Deliver one sample through the interrupt handler
+static void interrupt(uint32_t seq)
+{
+  imu_data_t sample = sample_encode(seq);
+  std::lock_guard<std::recursive_mutex> lock(core_lock());
+  sl_imu_stub_acceleration()[0] = sample.x;
+  sl_imu_stub_acceleration()[1] = sample.y;
+  sl_imu_stub_acceleration()[2] = sample.z;
+  gpioint_stub_callback()(0, nullptr);
+}
+
+// Copy a window into one array, oldest first
+static void window_copy(const acc_window_t *window, imu_data_t *dst)
+{
+  memcpy(dst, window->first, window->first_len * sizeof(imu_data_t));
+  memcpy(dst + window->first_len, window->second, window->second_len * sizeof(imu_data_t));
+}
+
+// Check samples are intact and in order, returns false on the first bad one
+static bool window_valid(const imu_data_t *samples, int n)
+{
+  for (int i = 0; i < n; i++) {
+    if (!sample_valid(&samples[i])) {
+      return false;
+    }
+    if ((i > 0) && (sample_seq(&samples[i]) <= sample_seq(&samples[i - 1]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void test_window(void)
+{
+  acc_window_t window;
+  imu_data_t held[SEQUENCE_LENGTH];
+  imu_data_t now[SEQUENCE_LENGTH];
+  uint32_t seq = 0;
+
+  // Not filled yet
+  CHECK(accelerometer_acquire(&window, SEQUENCE_LENGTH) == SL_STATUS_FAIL);
+  CHECK(accelerometer_acquire(&window, -1) == SL_STATUS_INVALID_PARAMETER);
+  CHECK(accelerometer_acquire(&window, 100000) == SL_STATUS_INVALID_PARAMETER);
+
+  // Fill past the end of the buffer so the window wraps
+  accelerometer_set_stride(INFERENCE_STRIDE);
+  for (; seq < 300; seq++) {
+    interrupt(seq);
+  }
+  CHECK(accelerometer_take_stride());
+  CHECK(!accelerometer_take_stride());
+  CHECK(accelerometer_acquire(&window, SEQUENCE_LENGTH) == SL_STATUS_OK);
+  CHECK(window.end == 300);
+  CHECK(window.first_len + window.second_len == SEQUENCE_LENGTH);
+  CHECK(window.second_len > 0);
+  window_copy(&window, held);
+  CHECK(window_valid(held, SEQUENCE_LENGTH));
+  CHECK(sample_seq(&held[0]) == 300 - SEQUENCE_LENGTH);
+  CHECK(sample_seq(&held[SEQUENCE_LENGTH - 1]) == 299);
+
+  // Samples arriving while the window is held must not overwrite it
+  for (; seq < 600; seq++) {
+    interrupt(seq);
+  }
+  window_copy(&window, now);
+  CHECK(memcmp(held, now, sizeof(held)) == 0);
+  CHECK(accelerometer_get_overrun_count() > 0);
+  accelerometer_release();
+
+  // Newest samples after the release
+  for (; seq < 610; seq++) {
+    interrupt(seq);
+  }
+  CHECK(accelerometer_acquire(&window, SEQUENCE_LENGTH) == SL_STATUS_OK);
+  window_copy(&window, now);
+  CHECK(window_valid(now, SEQUENCE_LENGTH));
+  CHECK(sample_seq(&now[SEQUENCE_LENGTH - 1]) == 609);
+  accelerometer_release();
+
+  // Strides are counted from the interrupt, start at a stride boundary
+  accelerometer_take_stride();
+  do {
+    interrupt(seq++);
+  } while (!accelerometer_take_stride());
+  for (int i = 0; i < INFERENCE_STRIDE - 1; i++) {
+    interrupt(seq++);
+  }
+  CHECK(!accelerometer_stride_pending());
+  interrupt(seq++);
+  CHECK(accelerometer_take_stride());
+}
+
+// Count the strides flagged over a long run with different stride lengths,
+// taking the flag after every sample as the main loop does
+static void test_stride_count(void)
+{
+  static const int strides[] = { 1, 3, INFERENCE_STRIDE, 7, 16 };
+  uint32_t seq = 1000 + STRESS_SAMPLES;
+
+  for (int n : strides) {
+    accelerometer_set_stride(n);
+    // Start at a stride boundary
+    accelerometer_take_stride();
+    do {
+      interrupt(seq++);
+    } while (!accelerometer_take_stride());
+
+    int count = 0;
+    for (int i = 0; i < 200 * n; i++) {
+      interrupt(seq++);
+      count += accelerometer_take_stride() ? 1 : 0;
+    }
+    printf("stride %d: %d strides in %d samples\n", n, count, 200 * n);
+    CHECK(count == 200);
+  }
+  accelerometer_set_stride(INFERENCE_STRIDE);
+}
+
+static void test_stress(void)
+{
+  std::atomic<bool> done(false);
+  std::atomic<uint32_t> produced(0);
+  uint32_t windows = 0;
+  uint32_t torn = 0;
+  uint32_t overwritten = 0;
+  uint32_t overruns = accelerometer_get_overrun_count();
+  imu_data_t held[SEQUENCE_LENGTH];
+  imu_data_t now[SEQUENCE_LENGTH];
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread producer([&done, &produced]() {
+    for (uint32_t seq = 1000; seq < 1000 + STRESS_SAMPLES; seq++) {
+      interrupt(seq);
+      produced.store(seq - 999);
+      // Let the main loop thread run between interrupts
+      std::this_thread::yield();
+    }
+    done.store(true);
+  });
+
+  while (!done.load()) {
+    acc_window_t window;
+    if (accelerometer_acquire(&window, SEQUENCE_LENGTH) != SL_STATUS_OK) {
+      continue;
+    }
+    window_copy(&window, held);
+    // Hold the window for a while as inference would, sometimes for longer
+    // than it takes the interrupt to fill the buffer
+    std::this_thread::yield();
+    if ((windows % 64) == 0) {
+      uint32_t until = produced.load() + 300;
+      while (!done.load() && (produced.load() < until)) {
+        std::this_thread::yield();
+      }
+    }
+    window_copy(&window, now);
+    accelerometer_release();
+    windows++;
+    if (!window_valid(held, SEQUENCE_LENGTH)) {
+      torn++;
+    }
+    if (memcmp(held, now, sizeof(held)) != 0) {
+      overwritten++;
+    }
+  }
+  producer.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("stress: %d samples, %lu windows, %lu overruns in %.2f s (%.0f samples/s, %.0f windows/s)\n",
+         STRESS_SAMPLES, (unsigned long)windows, (unsigned long)(accelerometer_get_overrun_count() - overruns),
+         seconds, STRESS_SAMPLES / seconds, windows / seconds);
+  CHECK(windows > 0);
+  CHECK(torn == 0);
+  CHECK(overwritten == 0);
+}
+
+int main(void)
+{
+  CHECK(accelerometer_setup() == SL_STATUS_OK);
+  CHECK(gpioint_stub_callback() != nullptr);
+  test_window();
+  test_stress();
+  test_stride_count();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
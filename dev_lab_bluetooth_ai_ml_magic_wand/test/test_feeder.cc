@@ -0,0 +1,189 @@
+// Host test of the model input feeder
+//
+// Runs the real feeder.cc and accelerometer.cc against stub drivers. Samples
+// arrive in random batches, including batches of more than a window, and the
+// window written after every update is checked against the previous float
+// path, which copied the latest samples with accelerometer_read(). Quantized
+// windows are checked against the float path within the quantization error.
+// A benchmark then compares the cost of an inference period with both paths.
+#include "feeder.h"
+#include "accelerometer.h"
+#include "constants.h"
+#include "em_core.h"
+#include "gpiointerrupt.h"
+#include "sl_imu.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+#define EQUIVALENCE_UPDATES  100000
+#define QUANTIZATION_WINDOWS 2000
+#define BENCHMARK_PERIODS    200000
+
+static int failures = 0;
+
+#define CHECK(condition)                                             \
+  do {                                                               \
+    if (!(condition)) {                                              \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);    \
+      failures++;                                                    \
+    }                                                                \
+  } while (0)
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next(void)
+{
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+// Random sample value in [-limit, limit)
+static int16_t random_value(int32_t limit)
+{
+  return (int16_t)((int32_t)(random_next() % (uint32_t)(2 * limit)) - limit);
+}
+
+// Deliver one random sample through the interrupt handler
+static void interrupt(int32_t limit = 32768)
+{
+  std::lock_guard<std::recursive_mutex> lock(core_lock());
+  sl_imu_stub_acceleration()[0] = random_value(limit);
+  sl_imu_stub_acceleration()[1] = random_value(limit);
+  sl_imu_stub_acceleration()[2] = random_value(limit);
+  gpioint_stub_callback()(0, nullptr);
+}
+
+static void test_equivalence(void)
+{
+  static float expected[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+  static float actual[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+  int mismatches = 0;
+
+  CHECK(feeder_init(FEEDER_FORMAT_FLOAT, 0.0f, 0) == SL_STATUS_OK);
+
+  // Nothing to feed until the accelerometer buffer has been filled
+  CHECK(feeder_update() == SL_STATUS_FAIL);
+  for (int i = 0; i < SEQUENCE_LENGTH - 1; i++) {
+    interrupt();
+  }
+  CHECK(feeder_update() == SL_STATUS_FAIL);
+  interrupt();
+
+  for (int n = 0; n < EQUIVALENCE_UPDATES; n++) {
+    // Mostly a stride or two, sometimes nothing, sometimes more than a window
+    uint32_t r = random_next() % 100;
+    int batch = (r < 5) ? 0 : (r < 10) ? SEQUENCE_LENGTH + (int)(random_next() % 200)
+                : 1 + (int)(random_next() % (2 * INFERENCE_STRIDE));
+    for (int i = 0; i < batch; i++) {
+      interrupt();
+    }
+    CHECK(feeder_update() == SL_STATUS_OK);
+    feeder_write(actual);
+    CHECK(accelerometer_read((acc_data_t *)expected, SEQUENCE_LENGTH) == SL_STATUS_OK);
+    if (memcmp(expected, actual, sizeof(actual)) != 0) {
+      if (mismatches < 10) {
+        printf("mismatch at update %d after %d samples\n", n, batch);
+      }
+      mismatches++;
+    }
+  }
+  printf("equivalence: %d updates, %d mismatches\n", EQUIVALENCE_UPDATES, mismatches);
+  CHECK(mismatches == 0);
+}
+
+// Quantize windows of samples up to limit mg and check every value against
+// the float path: within half a step plus the error of the fixed point
+// multiplier, or saturated when out of range
+template <typename T>
+static void test_quantization(feeder_format_t format, float scale, int32_t zero_point, int32_t limit,
+                              const char *name)
+{
+  static float expected[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+  static T actual[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+  const int32_t min = std::numeric_limits<T>::min();
+  const int32_t max = std::numeric_limits<T>::max();
+  int bad = 0;
+  int saturated = 0;
+  double error_max = 0.0;
+
+  CHECK(feeder_init(format, scale, zero_point) == SL_STATUS_OK);
+  for (int n = 0; n < QUANTIZATION_WINDOWS; n++) {
+    for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+      interrupt(limit);
+    }
+    CHECK(feeder_update() == SL_STATUS_OK);
+    feeder_write(actual);
+    CHECK(accelerometer_read((acc_data_t *)expected, SEQUENCE_LENGTH) == SL_STATUS_OK);
+    for (int i = 0; i < SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS; i++) {
+      double exact = expected[i] / scale + zero_point;
+      if ((exact <= min - 0.5) || (exact >= max + 0.5)) {
+        saturated++;
+        bad += (actual[i] != ((exact < 0) ? min : max)) ? 1 : 0;
+        continue;
+      }
+      double bound = 0.5 + fabs(expected[i]) * 0.5 / (1 << 16) + 1e-6;
+      double error = fabs(actual[i] - exact);
+      error_max = std::max(error_max, error * scale);
+      bad += (error > bound) ? 1 : 0;
+    }
+  }
+  printf("%s: scale %g zero point %d, max error %.3f mg, %d saturated, %d out of bounds\n", name, scale,
+         zero_point, error_max, saturated, bad);
+  CHECK(bad == 0);
+}
+
+// Host time of an inference period, a stride of new samples followed by
+// filling the model input, with the previous and the incremental path
+static void test_benchmark(void)
+{
+  static float input[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+  double elapsed[2] = {};
+
+  for (int path = 0; path < 2; path++) {
+    std::chrono::steady_clock::duration total(0);
+    for (int n = 0; n < BENCHMARK_PERIODS; n++) {
+      for (int i = 0; i < INFERENCE_STRIDE; i++) {
+        interrupt();
+      }
+      auto start = std::chrono::steady_clock::now();
+      if (path == 0) {
+        accelerometer_read((acc_data_t *)input, SEQUENCE_LENGTH);
+      } else {
+        feeder_update();
+        feeder_write(input);
+      }
+      total += std::chrono::steady_clock::now() - start;
+    }
+    elapsed[path] = std::chrono::duration<double, std::nano>(total).count() / BENCHMARK_PERIODS;
+  }
+  printf("benchmark: %.0f ns per period reading the window, %.0f ns per period feeding %d new samples\n",
+         elapsed[0], elapsed[1], INFERENCE_STRIDE);
+}
+
+int main(void)
+{
+  CHECK(accelerometer_setup() == SL_STATUS_OK);
+  CHECK(gpioint_stub_callback() != nullptr);
+  accelerometer_set_stride(INFERENCE_STRIDE);
+  test_equivalence();
+  // Unusable quantization
+  CHECK(feeder_init(FEEDER_FORMAT_INT8, 0.0f, 0) == SL_STATUS_INVALID_PARAMETER);
+  CHECK(feeder_init(FEEDER_FORMAT_INT8, -1.0f, 0) == SL_STATUS_INVALID_PARAMETER);
+  CHECK(feeder_init(FEEDER_FORMAT_INT16, 1e-5f, 0) == SL_STATUS_INVALID_PARAMETER);
+  // Typical +-2 g and +-8 g input ranges with awkward scales, then the
+  // whole sample range to saturate
+  test_quantization<int8_t>(FEEDER_FORMAT_INT8, 15.7f, -3, 2000, "int8");
+  test_quantization<int8_t>(FEEDER_FORMAT_INT8, 15.7f, -3, 32768, "int8 saturating");
+  test_quantization<int16_t>(FEEDER_FORMAT_INT16, 0.37f, 7, 8000, "int16");
+  test_quantization<int16_t>(FEEDER_FORMAT_INT16, 0.37f, 7, 32768, "int16 saturating");
+  CHECK(feeder_init(FEEDER_FORMAT_FLOAT, 0.0f, 0) == SL_STATUS_OK);
+  test_benchmark();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
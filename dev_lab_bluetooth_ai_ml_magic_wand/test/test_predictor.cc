@@ -0,0 +1,161 @@
+// Host golden test of the prediction smoothing
+//
+// Feeds the same model outputs to predict_gesture() and to the previous
+// predictor, which summed the whole history on every call, and checks every
+// decision is the same. The outputs are generated: idle noise, gestures
+// ramping up over several inferences, runs averaging close to the detection
+// threshold and ties.
+#include "predictor.h"
+#include "constants.h"
+#include <cstdint>
+#include <cstdio>
+
+#define GOLDEN_INFERENCES 1000000
+
+static int failures = 0;
+
+#define CHECK(condition)                                             \
+  do {                                                               \
+    if (!(condition)) {                                              \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);    \
+      failures++;                                                    \
+    }                                                                \
+  } while (0)
+
+// Previous predictor, summing the history for each gesture on every call
+namespace reference {
+
+static model_output_t history[PREDICTION_HISTORY_LEN] = {};
+static int history_index = 0;
+static int suppression_count = 0;
+static int previous_prediction = NO_GESTURE;
+
+static int predict_gesture(const model_output_t* output)
+{
+  history[history_index] = *output;
+  ++history_index;
+  if (history_index >= PREDICTION_HISTORY_LEN) {
+    history_index = 0;
+  }
+
+  int max_predict_index = -1;
+  float max_predict_score = 0.0f;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    float prediction_sum = 0.0f;
+    for (int j = 0; j < PREDICTION_HISTORY_LEN; ++j) {
+      prediction_sum += history[j].gesture[i];
+    }
+    const float prediction_average = prediction_sum / PREDICTION_HISTORY_LEN;
+    if ((max_predict_index == -1) || (prediction_average > max_predict_score)) {
+      max_predict_index = i;
+      max_predict_score = prediction_average;
+    }
+  }
+
+  if (suppression_count > 0) {
+    --suppression_count;
+  }
+  if ((max_predict_index == NO_GESTURE)
+      || (max_predict_score < DETECTION_THRESHOLD)
+      || ((max_predict_index == previous_prediction) && (suppression_count > 0))) {
+    return NO_GESTURE;
+  }
+  suppression_count = PREDICTION_SUPPRESSION;
+  previous_prediction = max_predict_index;
+  return max_predict_index;
+}
+
+} // namespace reference
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next(void)
+{
+  random_state = random_state * 1664525u + 1013904223u;
+  return random_state >> 8;
+}
+
+// Output with one gesture at score, the rest split over the others
+static model_output_t output_make(int gesture, float score)
+{
+  model_output_t output;
+  float left = 1.0f - score;
+  int last = (gesture == GESTURE_COUNT - 1) ? GESTURE_COUNT - 2 : GESTURE_COUNT - 1;
+  for (int i = 0; i < GESTURE_COUNT; i++) {
+    float value = score;
+    if (i == last) {
+      value = left;
+    } else if (i != gesture) {
+      value = left * (random_next() % 256) / 255.0f;
+      left -= value;
+    }
+    output.gesture[i] = value;
+  }
+  return output;
+}
+
+// Next generated output
+static model_output_t output_next(void)
+{
+  static int mode = 0;
+  static int remaining = 0;
+  static int gesture = NO_GESTURE;
+  static int step = 0;
+
+  if (remaining == 0) {
+    mode = random_next() % 4;
+    gesture = random_next() % GESTURE_COUNT;
+    remaining = 3 + random_next() % 20;
+    step = 0;
+  }
+  remaining--;
+  step++;
+  switch (mode) {
+    case 0:
+      // Idle, mostly no gesture
+      return output_make(NO_GESTURE, (150 + random_next() % 106) / 255.0f);
+    case 1:
+      // Gesture ramping up then holding near the top
+      return output_make(gesture, ((step * 40 < 250) ? step * 40 : 230 + random_next() % 26) / 255.0f);
+    case 2:
+      // Scores averaging close to the threshold, where rounding matters
+      return output_make(gesture, DETECTION_THRESHOLD + ((int)(random_next() % 7) - 3) * 0.01f);
+    default:
+      // Two gestures tied
+      {
+        model_output_t output = {};
+        int other = (gesture + 1) % GESTURE_COUNT;
+        float score = (100 + random_next() % 28) / 255.0f;
+        output.gesture[gesture] = score;
+        output.gesture[other] = score;
+        return output;
+      }
+  }
+}
+
+int main(void)
+{
+  int detections = 0;
+  int mismatches = 0;
+
+  for (int n = 0; n < GOLDEN_INFERENCES; n++) {
+    model_output_t output = output_next();
+    int expected = reference::predict_gesture(&output);
+    int actual = predict_gesture(&output);
+    if (expected != actual) {
+      if (mismatches < 10) {
+        printf("mismatch at %d: expected %d, got %d\n", n, expected, actual);
+      }
+      mismatches++;
+    }
+    if (expected != NO_GESTURE) {
+      detections++;
+    }
+  }
+  printf("golden: %d inferences, %d detections, %d mismatches\n", GOLDEN_INFERENCES, detections, mismatches);
+  CHECK(detections > 0);
+  CHECK(mismatches == 0);
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,962 @@
+// Host replay harness of the inference pipeline
+//
+// Replays accelerometer recordings through the real accelerometer.cc,
+// feeder.cc, predictor.cc, magic_wand.cc and app.c against stub drivers, with
+// the sleep timer stub as a deterministic clock advanced sample by sample.
+// The application is connected to a stub light before the recording starts.
+// TensorFlow Lite Micro is not part of this tree, so the interpreter stub runs
+// a stand-in model in place of the trained one: a template matcher scoring
+// the wing, ring and slope shapes the synthetic recordings are made of.
+//
+// Recordings are CSV files with one sample per line at ACCELEROMETER_FREQ,
+//   x,y,z[,gesture]
+// in mg, where gesture is wing, ring or slope on the last sample of a
+// gesture. Lines starting with # are comments.
+//
+// Each recording is replayed in its own process so it starts from reset. The
+// harness reports the host time taken by each stage of the pipeline, the
+// latency from the end of each gesture to its detection and the false
+// positives, the inferences run, the fraction of the time the main loop is
+// idle and the host time from a detection to its GATT write. It fails if a
+// gesture is missed or detected late, there is a false positive, a stride of
+// samples doesn't trigger exactly one inference, a GATT write waits for a
+// later pass of the main loop than its detection or a detection is logged
+// before the main loop is idle.
+//
+// Quantized models are replayed with --format and their detections are
+// compared with the float model's.
+//
+// usage: test_replay --generate DIR                         write synthetic
+//                                                           recordings to DIR
+//        test_replay [--format int8,int16] RECORDING...     replay recordings
+#include "accelerometer.h"
+#include "constants.h"
+#include "em_core.h"
+#include "gpiointerrupt.h"
+#include "magic_wand.h"
+#include "predictor.h"
+#include "sl_bluetooth.h"
+#include "sl_imu.h"
+#include "sl_sleeptimer.h"
+#include "sl_tflite_micro_init.h"
+extern "C" {
+#include "app.h"
+#include "sl_power_manager.h"
+}
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Samples in a gesture template, 1.6 s at ACCELEROMETER_FREQ
+#define TEMPLATE_LENGTH        40
+
+// Gesture amplitude in mg
+#define TEMPLATE_AMPLITUDE    800.0f
+
+// The stand-in model ignores windows with less motion than this in mg
+#define MODEL_MOTION_MIN      100.0f
+
+// A detection belongs to a gesture if it comes between the gesture being
+// half done and it leaving the model input window
+#define DETECTION_EARLY_MS    ((TEMPLATE_LENGTH / 2) * 1000 / ACCELEROMETER_FREQ)
+#define DETECTION_LATE_MS     (SEQUENCE_LENGTH * 1000 / ACCELEROMETER_FREQ)
+
+// Latest detection the harness accepts after the end of a gesture
+#define DETECTION_LATENCY_MAX_MS  1500
+
+// Largest shift of a detection with a quantized model against the float model
+#define QUANTIZED_SHIFT_MAX_MS  (INFERENCE_STRIDE * 1000 / ACCELEROMETER_FREQ)
+
+// Detections kept for comparing formats
+#define DETECTIONS_MAX         64
+
+// Stage latency histogram buckets, bucket n counts stages taking less than
+// 2^n ns
+#define HISTOGRAM_BUCKETS      32
+
+static const char *gesture_names[GESTURE_COUNT] = { "wing", "ring", "slope", NULL };
+
+// Current tick and periodic timer of the sleep timer stub
+uint32_t sl_sleeptimer_stub_tick = 0;
+sl_sleeptimer_timer_handle_t *sl_sleeptimer_stub_timer = NULL;
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next(void)
+{
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+// Uniform random number in [lo, hi)
+static float random_range(float lo, float hi)
+{
+  return lo + (hi - lo) * (float)(random_next() & 0xFFFF) / 65536.0f;
+}
+
+// Gesture shape at t in [0, 1], the x and y axes in units of the amplitude
+static void template_shape(int gesture, float t, float *x, float *y)
+{
+  const float pi = 3.14159265f;
+
+  switch (gesture) {
+    case WING_GESTURE:
+      // W, left to right with two dips
+      *x = 2.0f * t - 1.0f;
+      *y = cosf(4.0f * pi * t);
+      break;
+    case RING_GESTURE:
+      // O, one circle
+      *x = sinf(2.0f * pi * t);
+      *y = cosf(2.0f * pi * t);
+      break;
+    case SLOPE_GESTURE:
+    default:
+      // L, down then right
+      if (t < 0.5f) {
+        *x = -1.0f;
+        *y = 1.0f - 4.0f * t;
+      } else {
+        *x = 4.0f * (t - 0.5f) - 1.0f;
+        *y = -1.0f;
+      }
+      break;
+  }
+}
+
+/*******************************************************************************
+ * Recordings
+ ******************************************************************************/
+
+typedef struct sample {
+  int16_t x;
+  int16_t y;
+  int16_t z;
+  int8_t gesture;  // Gesture ending on this sample, NO_GESTURE for none
+} sample_t;
+
+typedef std::vector<sample_t> recording_t;
+
+// The wand lying still, with sensor noise
+static void recording_still(recording_t *recording, int n)
+{
+  for (int i = 0; i < n; i++) {
+    sample_t sample;
+    sample.x = (int16_t)random_range(-8.0f, 8.0f);
+    sample.y = (int16_t)random_range(-8.0f, 8.0f);
+    sample.z = (int16_t)(1000.0f + random_range(-8.0f, 8.0f));
+    sample.gesture = NO_GESTURE;
+    recording->push_back(sample);
+  }
+}
+
+// A gesture stretched in time and scaled in amplitude, with sensor noise
+static void recording_gesture(recording_t *recording, int gesture)
+{
+  int n = (int)(TEMPLATE_LENGTH * random_range(0.9f, 1.1f));
+  float amplitude = TEMPLATE_AMPLITUDE * random_range(0.7f, 1.3f);
+
+  for (int i = 0; i < n; i++) {
+    float x, y;
+    template_shape(gesture, (float)i / (float)(n - 1), &x, &y);
+    sample_t sample;
+    sample.x = (int16_t)(x * amplitude + random_range(-40.0f, 40.0f));
+    sample.y = (int16_t)(y * amplitude + random_range(-40.0f, 40.0f));
+    sample.z = (int16_t)(1000.0f + random_range(-40.0f, 40.0f));
+    sample.gesture = (i == n - 1) ? gesture : NO_GESTURE;
+    recording->push_back(sample);
+  }
+}
+
+// Handling the wand without making a gesture, a random walk that turns
+// every 200 ms
+static void recording_motion(recording_t *recording, int n)
+{
+  float x = 0.0f, y = 0.0f, z = 1000.0f;
+  float dx = 0.0f, dy = 0.0f, dz = 0.0f;
+
+  for (int i = 0; i < n; i++) {
+    if ((i % (ACCELEROMETER_FREQ / 5)) == 0) {
+      dx = random_range(-60.0f, 60.0f);
+      dy = random_range(-60.0f, 60.0f);
+      dz = random_range(-30.0f, 30.0f);
+    }
+    x = fminf(fmaxf(x + dx, -900.0f), 900.0f);
+    y = fminf(fmaxf(y + dy, -900.0f), 900.0f);
+    z = fminf(fmaxf(z + dz, 600.0f), 1400.0f);
+    sample_t sample;
+    sample.x = (int16_t)(x + random_range(-40.0f, 40.0f));
+    sample.y = (int16_t)(y + random_range(-40.0f, 40.0f));
+    sample.z = (int16_t)(z + random_range(-40.0f, 40.0f));
+    sample.gesture = NO_GESTURE;
+    recording->push_back(sample);
+  }
+}
+
+static bool recording_save(const recording_t *recording, const std::string &path, const char *comment)
+{
+  FILE *file = fopen(path.c_str(), "w");
+  if (file == NULL) {
+    printf("error: can't write %s\n", path.c_str());
+    return false;
+  }
+  fprintf(file, "# %s\n# x,y,z[,gesture] in mg at %d Hz\n", comment, ACCELEROMETER_FREQ);
+  for (const sample_t &sample : *recording) {
+    fprintf(file, "%d,%d,%d", sample.x, sample.y, sample.z);
+    if (sample.gesture != NO_GESTURE) {
+      fprintf(file, ",%s", gesture_names[sample.gesture]);
+    }
+    fprintf(file, "\n");
+  }
+  fclose(file);
+  return true;
+}
+
+static bool recording_load(recording_t *recording, const char *path)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    printf("error: can't read %s\n", path);
+    return false;
+  }
+  char line[128];
+  int line_number = 0;
+  bool ok = true;
+  while (ok && (fgets(line, sizeof(line), file) != NULL)) {
+    line_number++;
+    if ((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r')) {
+      continue;
+    }
+    int x, y, z;
+    char name[16] = "";
+    int fields = sscanf(line, "%d,%d,%d,%15[a-z]", &x, &y, &z, name);
+    sample_t sample;
+    sample.x = (int16_t)x;
+    sample.y = (int16_t)y;
+    sample.z = (int16_t)z;
+    sample.gesture = NO_GESTURE;
+    if (fields == 4) {
+      for (int i = 0; i < NO_GESTURE; i++) {
+        if (strcmp(name, gesture_names[i]) == 0) {
+          sample.gesture = i;
+        }
+      }
+    }
+    if ((fields < 3) || ((fields == 4) && (sample.gesture == NO_GESTURE))) {
+      printf("error: %s:%d: bad sample\n", path, line_number);
+      ok = false;
+    }
+    recording->push_back(sample);
+  }
+  fclose(file);
+  return ok;
+}
+
+static bool generate(const char *dir)
+{
+  recording_t still;
+  recording_still(&still, 60 * ACCELEROMETER_FREQ);
+
+  // Every gesture, repeated and in turn, with pauses between them
+  static const int sequence[] = {
+    WING_GESTURE, RING_GESTURE, SLOPE_GESTURE, RING_GESTURE, RING_GESTURE,
+    SLOPE_GESTURE, SLOPE_GESTURE, WING_GESTURE, WING_GESTURE, RING_GESTURE
+  };
+  recording_t gestures;
+  recording_still(&gestures, 4 * ACCELEROMETER_FREQ);
+  for (int gesture : sequence) {
+    recording_gesture(&gestures, gesture);
+    recording_still(&gestures, (int)(random_range(3.0f, 5.0f) * ACCELEROMETER_FREQ));
+  }
+
+  recording_t motion;
+  recording_still(&motion, 4 * ACCELEROMETER_FREQ);
+  recording_motion(&motion, 60 * ACCELEROMETER_FREQ);
+
+  std::string base(dir);
+  return recording_save(&still, base + "/still.csv", "Wand lying still")
+         && recording_save(&gestures, base + "/gestures.csv", "Gestures separated by pauses")
+         && recording_save(&motion, base + "/motion.csv", "Wand handled without gestures");
+}
+
+/*******************************************************************************
+ * Stand-in model
+ ******************************************************************************/
+
+// Templates with the mean removed and scaled to unit length, x then y
+static float templates[NO_GESTURE][2 * TEMPLATE_LENGTH];
+
+static void model_setup(void)
+{
+  for (int g = 0; g < NO_GESTURE; g++) {
+    float *v = templates[g];
+    float mean_x = 0.0f, mean_y = 0.0f;
+    for (int i = 0; i < TEMPLATE_LENGTH; i++) {
+      template_shape(g, (float)i / (TEMPLATE_LENGTH - 1), &v[i], &v[TEMPLATE_LENGTH + i]);
+      mean_x += v[i];
+      mean_y += v[TEMPLATE_LENGTH + i];
+    }
+    mean_x /= TEMPLATE_LENGTH;
+    mean_y /= TEMPLATE_LENGTH;
+    float norm = 0.0f;
+    for (int i = 0; i < TEMPLATE_LENGTH; i++) {
+      v[i] -= mean_x;
+      v[TEMPLATE_LENGTH + i] -= mean_y;
+      norm += v[i] * v[i] + v[TEMPLATE_LENGTH + i] * v[TEMPLATE_LENGTH + i];
+    }
+    norm = sqrtf(norm);
+    for (int i = 0; i < 2 * TEMPLATE_LENGTH; i++) {
+      v[i] /= norm;
+    }
+  }
+}
+
+// Input element i dequantized to mg
+static float model_input_value(const TfLiteTensor *input, int i)
+{
+  switch (input->type) {
+    case kTfLiteInt8:
+      return (input->data.int8[i] - input->params.zero_point) * input->params.scale;
+    case kTfLiteInt16:
+      return (input->data.i16[i] - input->params.zero_point) * input->params.scale;
+    case kTfLiteFloat32:
+    default:
+      return input->data.f[i];
+  }
+}
+
+// Output score i quantized to the output type
+static void model_output_value(TfLiteTensor *output, int i, float score)
+{
+  if (output->type == kTfLiteInt8) {
+    long q = lroundf(score / output->params.scale) + output->params.zero_point;
+    output->data.int8[i] = (int8_t)std::min(std::max(q, (long)INT8_MIN), (long)INT8_MAX);
+  } else if (output->type == kTfLiteInt16) {
+    long q = lroundf(score / output->params.scale) + output->params.zero_point;
+    output->data.i16[i] = (int16_t)std::min(std::max(q, (long)INT16_MIN), (long)INT16_MAX);
+  } else {
+    output->data.f[i] = score;
+  }
+}
+
+// Scores each gesture with the best normalized correlation of its template
+// against any TEMPLATE_LENGTH samples of the window, so a gesture keeps
+// scoring while it is in the window as it would with the trained model
+static TfLiteStatus model_run(const TfLiteTensor *input, TfLiteTensor *output)
+{
+  float x[SEQUENCE_LENGTH], y[SEQUENCE_LENGTH];
+  for (int i = 0; i < SEQUENCE_LENGTH; i++) {
+    x[i] = model_input_value(input, i * ACCELEROMETER_CHANNELS);
+    y[i] = model_input_value(input, i * ACCELEROMETER_CHANNELS + 1);
+  }
+
+  float best[NO_GESTURE] = {};
+  for (int offset = 0; offset + TEMPLATE_LENGTH <= SEQUENCE_LENGTH; offset++) {
+    float mean_x = 0.0f, mean_y = 0.0f;
+    for (int i = 0; i < TEMPLATE_LENGTH; i++) {
+      mean_x += x[offset + i];
+      mean_y += y[offset + i];
+    }
+    mean_x /= TEMPLATE_LENGTH;
+    mean_y /= TEMPLATE_LENGTH;
+    float energy = 0.0f;
+    for (int i = 0; i < TEMPLATE_LENGTH; i++) {
+      float u = x[offset + i] - mean_x;
+      float v = y[offset + i] - mean_y;
+      energy += u * u + v * v;
+    }
+    // Still, correlation with noise means nothing
+    if (energy < MODEL_MOTION_MIN * MODEL_MOTION_MIN * TEMPLATE_LENGTH) {
+      continue;
+    }
+    float norm = sqrtf(energy);
+    for (int g = 0; g < NO_GESTURE; g++) {
+      const float *t = templates[g];
+      float dot = 0.0f;
+      for (int i = 0; i < TEMPLATE_LENGTH; i++) {
+        dot += (x[offset + i] - mean_x) * t[i] + (y[offset + i] - mean_y) * t[TEMPLATE_LENGTH + i];
+      }
+      best[g] = std::max(best[g], dot / norm);
+    }
+  }
+
+  float most = 0.0f;
+  for (int g = 0; g < NO_GESTURE; g++) {
+    model_output_value(output, g, best[g]);
+    most = std::max(most, best[g]);
+  }
+  model_output_value(output, NO_GESTURE, 1.0f - most);
+  return kTfLiteOk;
+}
+
+// Model input and output formats, the quantized formats with the parameters
+// a converted model would typically have
+typedef struct model_format {
+  const char *name;
+  TfLiteType type;
+  float input_scale;
+  int32_t input_zero_point;
+  float output_scale;
+  int32_t output_zero_point;
+} model_format_t;
+
+static const model_format_t model_formats[] = {
+  { "float", kTfLiteFloat32, 0.0f, 0, 0.0f, 0 },
+  // +-2 g in 16 mg steps, softmax output
+  { "int8", kTfLiteInt8, 16.0f, 0, 1.0f / 256.0f, -128 },
+  // +-8 g in 0.25 mg steps
+  { "int16", kTfLiteInt16, 0.25f, 0, 1.0f / 32768.0f, 0 },
+};
+
+#define MODEL_FORMAT_COUNT  ((int)(sizeof(model_formats) / sizeof(model_formats[0])))
+
+/*******************************************************************************
+ * Pipeline hooks
+ ******************************************************************************/
+
+typedef std::chrono::steady_clock::time_point time_point_t;
+
+// Times taken in the current pass of the main loop
+static time_point_t invoke_start;
+static time_point_t invoke_end;
+static time_point_t predict_end;
+static bool invoked = false;
+
+typedef struct detection {
+  uint32_t ms;
+  int gesture;
+} detection_t;
+
+static std::vector<detection_t> detections;
+
+// A detection was made in the current pass of the main loop
+static bool pass_detection = false;
+
+static TfLiteStatus model_invoke(const TfLiteTensor *input, TfLiteTensor *output)
+{
+  invoke_start = std::chrono::steady_clock::now();
+  TfLiteStatus status = model_run(input, output);
+  invoke_end = std::chrono::steady_clock::now();
+  invoked = true;
+  return status;
+}
+
+static float input_data[SEQUENCE_LENGTH * ACCELEROMETER_CHANNELS];
+static float output_data[GESTURE_COUNT];
+static TfLiteIntArray input_dims = { 4, { 1, SEQUENCE_LENGTH, ACCELEROMETER_CHANNELS, 1 } };
+static TfLiteTensor input_tensor = { kTfLiteFloat32, { .f = input_data }, &input_dims, { 0.0f, 0 } };
+static TfLiteTensor output_tensor = { kTfLiteFloat32, { .f = output_data }, NULL, { 0.0f, 0 } };
+static tflite::MicroInterpreter interpreter(model_invoke, &input_tensor, &output_tensor);
+
+TfLiteTensor *sl_tflite_micro_get_input_tensor(void)
+{
+  return &input_tensor;
+}
+
+tflite::MicroInterpreter *sl_tflite_micro_get_interpreter(void)
+{
+  return &interpreter;
+}
+
+// predictor.cc is built with its predict_gesture() renamed so the harness
+// sees every prediction
+int predictor_predict_gesture(const model_output_t *output);
+
+int predict_gesture(const model_output_t *output)
+{
+  int gesture = predictor_predict_gesture(output);
+  predict_end = std::chrono::steady_clock::now();
+  if (gesture != NO_GESTURE) {
+    detections.push_back({ sl_sleeptimer_tick_to_ms(sl_sleeptimer_stub_tick), gesture });
+    pass_detection = true;
+  }
+  return gesture;
+}
+
+/*******************************************************************************
+ * Measurements
+ ******************************************************************************/
+
+typedef enum stage {
+  STAGE_FEED,
+  STAGE_INVOKE,
+  STAGE_PREDICT,
+  STAGE_OUTPUT,
+  STAGE_COUNT
+} stage_t;
+
+static const char *stage_names[STAGE_COUNT] = { "feed", "invoke", "predict", "output" };
+
+typedef struct histogram {
+  uint32_t buckets[HISTOGRAM_BUCKETS];
+  uint64_t min;
+  uint64_t max;
+  uint64_t total;
+  uint32_t count;
+} histogram_t;
+
+static histogram_t stage_histograms[STAGE_COUNT];
+
+// Host time spent in the main loop and the number of times it was woken
+static uint64_t busy_ns = 0;
+static uint32_t wakeups = 0;
+
+// Detections still waiting to be logged after the pass that made them
+static int logs_deferred = 0;
+
+static void histogram_add(histogram_t *histogram, uint64_t ns)
+{
+  int bucket = 0;
+  while ((bucket < HISTOGRAM_BUCKETS - 1) && ((1ULL << bucket) <= ns)) {
+    bucket++;
+  }
+  histogram->buckets[bucket]++;
+  histogram->min = (histogram->count == 0) ? ns : std::min(histogram->min, ns);
+  histogram->max = std::max(histogram->max, ns);
+  histogram->total += ns;
+  histogram->count++;
+}
+
+static uint64_t elapsed_ns(time_point_t from, time_point_t to)
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+}
+
+/*******************************************************************************
+ * Bluetooth
+ ******************************************************************************/
+
+// Defined in app.c
+extern "C" const uint8_t serviceUUID[16];
+extern "C" const uint8_t charUUID[16];
+
+#define LIGHT_CONNECTION      1
+#define LIGHT_SERVICE         0x10
+#define LIGHT_CHARACTERISTIC  0x20
+
+// Writes to the light, the light acknowledges a write before the next sample
+static int writes = 0;
+static int writes_in_pass = 0;
+static bool write_in_flight = false;
+static histogram_t write_histogram;
+
+extern "C" sl_status_t sl_bt_gatt_write_characteristic_value(uint8_t connection, uint16_t characteristic,
+                                                             size_t value_len, const uint8_t *value)
+{
+  (void)value;
+  if ((connection != LIGHT_CONNECTION) || (characteristic != LIGHT_CHARACTERISTIC) || (value_len != 1)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (write_in_flight) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  write_in_flight = true;
+  writes++;
+  // Time from the prediction to the write when it is made in the same pass
+  if (pass_detection) {
+    histogram_add(&write_histogram, elapsed_ns(predict_end, std::chrono::steady_clock::now()));
+    writes_in_pass++;
+  }
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_gatt_write_characteristic_value_without_response(uint8_t connection,
+                                                                              uint16_t characteristic,
+                                                                              size_t value_len,
+                                                                              const uint8_t *value,
+                                                                              uint16_t *sent_len)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)value_len;
+  (void)value;
+  (void)sent_len;
+  // The stub light's characteristic only takes acknowledged writes
+  return SL_STATUS_INVALID_PARAMETER;
+}
+
+extern "C" sl_status_t sl_bt_scanner_set_parameters(uint8_t mode, uint16_t interval, uint16_t window)
+{
+  (void)mode;
+  (void)interval;
+  (void)window;
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_scanner_start(uint8_t scanning_phy, uint8_t discover_mode)
+{
+  (void)scanning_phy;
+  (void)discover_mode;
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_scanner_stop(void)
+{
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_connection_open(bd_addr address, uint8_t address_type, uint8_t initiating_phy,
+                                             uint8_t *connection)
+{
+  (void)address;
+  (void)address_type;
+  (void)initiating_phy;
+  *connection = LIGHT_CONNECTION;
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_connection_close(uint8_t connection)
+{
+  (void)connection;
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_gatt_discover_primary_services_by_uuid(uint8_t connection, size_t uuid_len,
+                                                                    const uint8_t *uuid)
+{
+  (void)connection;
+  (void)uuid_len;
+  (void)uuid;
+  return SL_STATUS_OK;
+}
+
+extern "C" sl_status_t sl_bt_gatt_discover_characteristics(uint8_t connection, uint32_t service)
+{
+  (void)connection;
+  (void)service;
+  return SL_STATUS_OK;
+}
+
+static void bt_event(uint32_t id, sl_bt_msg_t *evt)
+{
+  evt->header = id;
+  sl_bt_on_event(evt);
+}
+
+// Take the application from boot to connected to the stub light, returns
+// true if it got there
+static bool bt_connect(void)
+{
+  static const bd_addr light = { { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 } };
+  sl_bt_msg_t evt;
+
+  memset(&evt, 0, sizeof(evt));
+  bt_event(sl_bt_evt_system_boot_id, &evt);
+
+  // Advertisement with the light's complete name
+  memset(&evt, 0, sizeof(evt));
+  sl_bt_evt_scanner_legacy_advertisement_report_t *report = &evt.data.evt_scanner_legacy_advertisement_report;
+  report->address = light;
+  report->data.len = (uint8_t)(AD_NAME_LEN + 2);
+  report->data.data[0] = (uint8_t)(AD_NAME_LEN + 1);
+  report->data.data[1] = 0x09;
+  memcpy(&report->data.data[2], AD_NAME, AD_NAME_LEN);
+  bt_event(sl_bt_evt_scanner_legacy_advertisement_report_id, &evt);
+
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_connection_opened.address = light;
+  evt.data.evt_connection_opened.connection = LIGHT_CONNECTION;
+  bt_event(sl_bt_evt_connection_opened_id, &evt);
+
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_gatt_service.service = LIGHT_SERVICE;
+  evt.data.evt_gatt_service.uuid.len = 16;
+  memcpy(evt.data.evt_gatt_service.uuid.data, serviceUUID, 16);
+  bt_event(sl_bt_evt_gatt_service_id, &evt);
+
+  memset(&evt, 0, sizeof(evt));
+  bt_event(sl_bt_evt_gatt_procedure_completed_id, &evt);
+
+  // Write property only, so writes are acknowledged
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_gatt_characteristic.characteristic = LIGHT_CHARACTERISTIC;
+  evt.data.evt_gatt_characteristic.properties = 0x08;
+  evt.data.evt_gatt_characteristic.uuid.len = 16;
+  memcpy(evt.data.evt_gatt_characteristic.uuid.data, charUUID, 16);
+  bt_event(sl_bt_evt_gatt_characteristic_id, &evt);
+
+  memset(&evt, 0, sizeof(evt));
+  bt_event(sl_bt_evt_gatt_procedure_completed_id, &evt);
+
+  return app_get_state() == APP_STATE_CONNECTED;
+}
+
+// Acknowledge the write in flight
+static void bt_acknowledge(void)
+{
+  if (write_in_flight) {
+    write_in_flight = false;
+    sl_bt_msg_t evt;
+    memset(&evt, 0, sizeof(evt));
+    evt.data.evt_gatt_procedure_completed.connection = LIGHT_CONNECTION;
+    evt.data.evt_gatt_procedure_completed.result = SL_STATUS_OK;
+    bt_event(sl_bt_evt_gatt_procedure_completed_id, &evt);
+  }
+}
+
+/*******************************************************************************
+ * Replay
+ ******************************************************************************/
+
+// Deliver one sample through the interrupt handler
+static void interrupt(const sample_t *sample)
+{
+  std::lock_guard<std::recursive_mutex> lock(core_lock());
+  sl_imu_stub_acceleration()[0] = sample->x;
+  sl_imu_stub_acceleration()[1] = sample->y;
+  sl_imu_stub_acceleration()[2] = sample->z;
+  gpioint_stub_callback()(0, nullptr);
+}
+
+// Run the main loop until it would sleep, timing the stages of inferences
+static void main_loop(void)
+{
+  wakeups++;
+  do {
+    invoked = false;
+    pass_detection = false;
+    time_point_t loop_start = std::chrono::steady_clock::now();
+    app_process_action();
+    time_point_t loop_end = std::chrono::steady_clock::now();
+    busy_ns += elapsed_ns(loop_start, loop_end);
+    if (invoked) {
+      histogram_add(&stage_histograms[STAGE_FEED], elapsed_ns(loop_start, invoke_start));
+      histogram_add(&stage_histograms[STAGE_INVOKE], elapsed_ns(invoke_start, invoke_end));
+      histogram_add(&stage_histograms[STAGE_PREDICT], elapsed_ns(invoke_end, predict_end));
+      histogram_add(&stage_histograms[STAGE_OUTPUT], elapsed_ns(predict_end, loop_end));
+    }
+    // The detection must still be waiting to be logged
+    if (pass_detection && !magic_wand_is_ok_to_sleep()) {
+      logs_deferred++;
+    }
+  } while (!app_is_ok_to_sleep());
+}
+
+// Replay a recording with a model format, returns true if it passes
+static bool replay(const char *path, const model_format_t *format)
+{
+  recording_t recording;
+  if (!recording_load(&recording, path)) {
+    return false;
+  }
+
+  model_setup();
+  input_tensor.type = format->type;
+  input_tensor.params.scale = format->input_scale;
+  input_tensor.params.zero_point = format->input_zero_point;
+  output_tensor.type = format->type;
+  output_tensor.params.scale = format->output_scale;
+  output_tensor.params.zero_point = format->output_zero_point;
+  app_init();
+  if ((gpioint_stub_callback() == nullptr) || (sl_sleeptimer_stub_timer == NULL)) {
+    printf("error: accelerometer interrupt or tick timer not registered\n");
+    return false;
+  }
+  if (!bt_connect()) {
+    printf("error: not connected to the light\n");
+    return false;
+  }
+
+  // Samples are taken from the recording at the capture rate, which the
+  // application may change while the recording plays
+  const uint64_t duration_us = (uint64_t)recording.size() * 1000000 / ACCELEROMETER_FREQ;
+  uint64_t us = 0;
+  uint64_t timer_us = 0;
+  while (us < duration_us) {
+    const sample_t *sample = &recording[us * ACCELEROMETER_FREQ / 1000000];
+    sl_sleeptimer_stub_tick = (uint32_t)(us * SL_SLEEPTIMER_STUB_FREQUENCY / 1000000);
+    bt_acknowledge();
+    while (timer_us <= us) {
+      sl_sleeptimer_stub_timer->callback(sl_sleeptimer_stub_timer, sl_sleeptimer_stub_timer->data);
+      timer_us += sl_sleeptimer_stub_timer->timeout_ms * 1000;
+    }
+    interrupt(sample);
+    main_loop();
+    us += 1000000 / accelerometer_get_rate();
+  }
+
+  // Every stride of samples at the model rate must trigger one inference
+  acc_window_t window;
+  uint32_t strides = 0;
+  if (accelerometer_acquire(&window, 0) == SL_STATUS_OK) {
+    strides = (window.end - SEQUENCE_LENGTH + 1) / INFERENCE_STRIDE;
+    accelerometer_release();
+  }
+  uint32_t inferences = stage_histograms[STAGE_INVOKE].count;
+
+  // Match detections to the gestures in the recording
+  std::vector<bool> matched(recording.size(), false);
+  int gestures = 0, found = 0, false_positives = 0, late = 0, switches = 0;
+  uint32_t latency_min = UINT32_MAX, latency_max = 0, latency_total = 0;
+  for (const sample_t &sample : recording) {
+    gestures += (sample.gesture != NO_GESTURE) ? 1 : 0;
+  }
+  for (const detection_t &detection : detections) {
+    // Ring switches the light off and slope on, each one must be written
+    switches += ((detection.gesture == RING_GESTURE) || (detection.gesture == SLOPE_GESTURE)) ? 1 : 0;
+    bool ok = false;
+    for (size_t i = 0; (i < recording.size()) && !ok; i++) {
+      uint32_t ms = (uint32_t)(i * 1000 / ACCELEROMETER_FREQ);
+      if ((recording[i].gesture == detection.gesture) && !matched[i]
+          && (detection.ms + DETECTION_EARLY_MS >= ms) && (detection.ms <= ms + DETECTION_LATE_MS)) {
+        matched[i] = true;
+        ok = true;
+        int32_t latency = std::max((int32_t)(detection.ms - ms), 0);
+        latency_min = std::min(latency_min, (uint32_t)latency);
+        latency_max = std::max(latency_max, (uint32_t)latency);
+        latency_total += latency;
+        late += (latency > DETECTION_LATENCY_MAX_MS) ? 1 : 0;
+        found++;
+      }
+    }
+    if (!ok) {
+      printf("  false positive: t=%u %s\n", detection.ms, gesture_names[detection.gesture]);
+      false_positives++;
+    }
+  }
+
+  printf("  %zu samples, %d gestures, %d detected, %d missed, %d false positives\n",
+         recording.size(), gestures, found, gestures - found, false_positives);
+  printf("  %u inferences for %u strides, %u wakeups, %.1f%% of them with an inference\n",
+         inferences, strides, wakeups, 100.0 * inferences / wakeups);
+  printf("  main loop busy for %llu us of %llu ms replayed, idle %.3f%%\n", (unsigned long long)(busy_ns / 1000),
+         (unsigned long long)(duration_us / 1000), 100.0 - (busy_ns / 10.0) / duration_us);
+  printf("  %d GATT writes for %d on/off detections, %d in the pass of their detection, %d of %zu detections "
+         "logged later\n", writes, switches, writes_in_pass, logs_deferred, detections.size());
+  if (writes_in_pass > 0) {
+    printf("  detection to GATT write: min=%llu avg=%llu max=%llu ns\n", (unsigned long long)write_histogram.min,
+           (unsigned long long)(write_histogram.total / write_histogram.count),
+           (unsigned long long)write_histogram.max);
+  }
+  if (found > 0) {
+    printf("  detection latency: min=%u avg=%u max=%u ms\n", latency_min, latency_total / found, latency_max);
+  }
+  for (int i = 0; i < STAGE_COUNT; i++) {
+    const histogram_t *histogram = &stage_histograms[i];
+    if (histogram->count == 0) {
+      printf("  %s: no passes\n", stage_names[i]);
+      continue;
+    }
+    printf("  %s: %u passes, min=%llu avg=%llu max=%llu ns\n", stage_names[i], histogram->count,
+           (unsigned long long)histogram->min, (unsigned long long)(histogram->total / histogram->count),
+           (unsigned long long)histogram->max);
+    for (int j = 0; j < HISTOGRAM_BUCKETS; j++) {
+      if (histogram->buckets[j] > 0) {
+        printf("    <%llu: %u\n", 1ULL << j, histogram->buckets[j]);
+      }
+    }
+  }
+
+  bool ok = (found == gestures) && (false_positives == 0) && (late == 0) && (inferences == strides)
+            && (writes == switches) && (writes_in_pass == writes) && (logs_deferred == (int)detections.size());
+  if (late > 0) {
+    printf("  %d gestures detected later than %d ms\n", late, DETECTION_LATENCY_MAX_MS);
+  }
+  return ok;
+}
+
+// Detections of a replay, shared with the parent process
+typedef struct replay_result {
+  int count;
+  detection_t detections[DETECTIONS_MAX];
+} replay_result_t;
+
+// Replay a recording in a fresh process, the sources keep their state in
+// statics
+static bool replay_process(const char *path, const model_format_t *format, replay_result_t *result)
+{
+  printf("replay %s (%s)\n", path, format->name);
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    bool ok = replay(path, format);
+    result->count = std::min((int)detections.size(), DETECTIONS_MAX);
+    std::copy(detections.begin(), detections.begin() + result->count, result->detections);
+    fflush(stdout);
+    _exit(ok ? 0 : 1);
+  }
+  int status = 0;
+  if ((pid < 0) || (waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+    printf("  FAILED\n");
+    return false;
+  }
+  return true;
+}
+
+// Compare the detections with a quantized model against the float model
+static bool replay_compare(const model_format_t *format, const replay_result_t *result,
+                           const replay_result_t *reference)
+{
+  int same = 0;
+  int32_t shift_max = 0;
+  for (int i = 0; (i < result->count) && (i < reference->count); i++) {
+    int32_t shift = (int32_t)(result->detections[i].ms - reference->detections[i].ms);
+    if ((result->detections[i].gesture == reference->detections[i].gesture)
+        && (abs(shift) <= QUANTIZED_SHIFT_MAX_MS)) {
+      same++;
+    }
+    if (abs(shift) > abs(shift_max)) {
+      shift_max = shift;
+    }
+  }
+  printf("  %s against float: %d of %d detections the same, largest shift %+d ms\n", format->name, same,
+         reference->count, shift_max);
+  return (same == reference->count) && (result->count == reference->count);
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc == 3) && (strcmp(argv[1], "--generate") == 0)) {
+    return generate(argv[2]) ? 0 : 1;
+  }
+
+  // Formats to replay with, the float model is always replayed to compare
+  // the quantized models against
+  bool formats[MODEL_FORMAT_COUNT] = { true };
+  int first = 1;
+  if ((argc > 2) && (strcmp(argv[1], "--format") == 0)) {
+    for (int f = 1; f < MODEL_FORMAT_COUNT; f++) {
+      formats[f] = (strstr(argv[2], model_formats[f].name) != NULL);
+    }
+    first = 3;
+  }
+  if ((argc <= first) || (argv[first][0] == '-')) {
+    printf("usage: %s --generate DIR\n       %s [--format int8,int16] RECORDING...\n", argv[0], argv[0]);
+    return 2;
+  }
+
+  replay_result_t *results = (replay_result_t *)mmap(NULL, MODEL_FORMAT_COUNT * sizeof(replay_result_t),
+                                                     PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (results == MAP_FAILED) {
+    printf("error: can't share results\n");
+    return 1;
+  }
+
+  int failures = 0;
+  for (int i = first; i < argc; i++) {
+    for (int f = 0; f < MODEL_FORMAT_COUNT; f++) {
+      if (!formats[f]) {
+        continue;
+      }
+      if (!replay_process(argv[i], &model_formats[f], &results[f])) {
+        failures++;
+      } else if ((f > 0) && !replay_compare(&model_formats[f], &results[f], &results[0])) {
+        printf("  FAILED\n");
+        failures++;
+      }
+    }
+  }
+
+  printf("%s: %s\n", argv[0], failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
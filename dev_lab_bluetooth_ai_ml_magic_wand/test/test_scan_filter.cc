@@ -0,0 +1,141 @@
+// Host test of the scan filter
+//
+// Fills the real scan_filter.c with random addresses and checks that every
+// added address is found, that the false positive rate of a full filter stays
+// near the rate expected of its size, and that the filter is cleared on the
+// add after a full filter and once it is SCAN_FILTER_RESET_TICKS old.
+#include "constants.h"
+extern "C" {
+#include "scan_filter.h"
+}
+#include <cmath>
+#include <cstdio>
+
+#define FILLS  2000
+#define PROBES 1000
+
+static int failures = 0;
+
+#define CHECK(condition)                                             \
+  do {                                                               \
+    if (!(condition)) {                                              \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);    \
+      failures++;                                                    \
+    }                                                                \
+  } while (0)
+
+// Deterministic random numbers, the same on every host
+static uint32_t random_state = 12345;
+
+static uint32_t random_next(void)
+{
+  random_state = random_state * 1103515245u + 12345u;
+  return random_state >> 8;
+}
+
+static bd_addr random_address(void)
+{
+  bd_addr address;
+  for (unsigned i = 0; i < sizeof(address.addr); i++) {
+    address.addr[i] = (uint8_t)random_next();
+  }
+  return address;
+}
+
+// Fill the filter with SCAN_FILTER_MAX_ENTRIES addresses and probe it with
+// other addresses, no added address may be missed
+static void test_false_positives(void)
+{
+  bd_addr added[SCAN_FILTER_MAX_ENTRIES];
+  long probes = 0;
+  long positives = 0;
+  int misses = 0;
+
+  for (int n = 0; n < FILLS; n++) {
+    scan_filter_clear();
+    for (int i = 0; i < SCAN_FILTER_MAX_ENTRIES; i++) {
+      added[i] = random_address();
+      scan_filter_add(&added[i]);
+    }
+    for (int i = 0; i < SCAN_FILTER_MAX_ENTRIES; i++) {
+      misses += scan_filter_test(&added[i]) ? 0 : 1;
+    }
+    for (int i = 0; i < PROBES; i++) {
+      bd_addr address = random_address();
+      positives += scan_filter_test(&address) ? 1 : 0;
+      probes++;
+    }
+  }
+  // Two bits per address in SCAN_FILTER_BITS
+  double expected = pow(1.0 - exp(-2.0 * SCAN_FILTER_MAX_ENTRIES / SCAN_FILTER_BITS), 2);
+  double rate = (double)positives / probes;
+  printf("false positives: %.2f%% of %ld probes of a full filter, %.2f%% expected, %d misses\n", 100.0 * rate,
+         probes, 100.0 * expected, misses);
+  CHECK(misses == 0);
+  CHECK(rate < 1.5 * expected);
+}
+
+// Adding to a full filter starts again with only the new address
+static void test_full_reset(void)
+{
+  bd_addr added[SCAN_FILTER_MAX_ENTRIES + 1];
+  int kept = 0;
+
+  scan_filter_clear();
+  for (int i = 0; i <= SCAN_FILTER_MAX_ENTRIES; i++) {
+    added[i] = random_address();
+    scan_filter_add(&added[i]);
+  }
+  CHECK(scan_filter_test(&added[SCAN_FILTER_MAX_ENTRIES]));
+  for (int i = 0; i < SCAN_FILTER_MAX_ENTRIES; i++) {
+    kept += scan_filter_test(&added[i]) ? 1 : 0;
+  }
+  // Only false positives of a filter holding one address
+  printf("full reset: %d of %d earlier addresses still found\n", kept, SCAN_FILTER_MAX_ENTRIES);
+  CHECK(kept <= 1);
+}
+
+// The filter ages with the tick timer, is cleared by the first test once it
+// is SCAN_FILTER_RESET_TICKS old and the age stops counting there
+static void test_tick_reset(void)
+{
+  bd_addr address = random_address();
+
+  scan_filter_clear();
+  scan_filter_add(&address);
+  for (int i = 0; i < SCAN_FILTER_RESET_TICKS - 1; i++) {
+    scan_filter_tick();
+  }
+  CHECK(scan_filter_test(&address));
+  scan_filter_tick();
+  CHECK(!scan_filter_test(&address));
+  CHECK(!scan_filter_test(&address));
+
+  // Age saturates while nothing is tested instead of wrapping around to a
+  // young filter, one clear still restarts it
+  scan_filter_add(&address);
+  for (int i = 0; i < 256; i++) {
+    scan_filter_tick();
+  }
+  CHECK(!scan_filter_test(&address));
+  scan_filter_add(&address);
+  CHECK(scan_filter_test(&address));
+
+  // Clearing restarts the age
+  for (int i = 0; i < SCAN_FILTER_RESET_TICKS - 1; i++) {
+    scan_filter_tick();
+  }
+  scan_filter_clear();
+  scan_filter_add(&address);
+  scan_filter_tick();
+  CHECK(scan_filter_test(&address));
+}
+
+int main(void)
+{
+  test_false_positives();
+  test_full_reset();
+  test_tick_reset();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}